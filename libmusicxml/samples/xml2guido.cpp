@@ -31,6 +31,7 @@ static void usage() {
     cerr << "                --begin <int>   : starting measure number (default: 0)" << endl;
     cerr << "                --end <int>   : end on measure (default: infinite)" << endl;
 	cerr << "                --part <int>   : The part number to convert. 0 for all. (default: 0)" << endl;
+	cerr << "                --parallel : convert the parts concurrently" << endl;
 	cerr << "                -h --help : print this help" << endl;
 	exit(1);
 }
@@ -110,6 +111,7 @@ int main(int argc, char *argv[])
         partFilter = intOpt(argc, argv, "--part");
 
 	bool generateBars = !checkOpt (argc, argv, "--autobars");
+	bool parallelParts = checkOpt (argc, argv, "--parallel");
 	const char * file = argv[argc-1];
 	const char * outfile = fileOpt (argc, argv, "-o");
 	ostream * out = &cout;
@@ -125,9 +127,9 @@ int main(int argc, char *argv[])
 
 	xmlErr err = kNoErr;
 	if (!strcmp(file, "-"))
-		err = musicxmlfd2guido(stdin, generateBars, beginMeasure, endMeasure, partFilter, *out);
+		err = musicxmlfd2guido(stdin, generateBars, beginMeasure, endMeasure, partFilter, *out, parallelParts);
 	else
-		err = musicxmlfile2guido(file, generateBars, beginMeasure, endMeasure, partFilter, *out);
+		err = musicxmlfile2guido(file, generateBars, beginMeasure, endMeasure, partFilter, *out, parallelParts);
 	if (err == kUnsupported)
 		cerr << "unsupported xml format" << endl;
 	else if (err ) {
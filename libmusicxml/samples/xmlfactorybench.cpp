@@ -0,0 +1,102 @@
+/*
+
+  Copyright (C) 2003-2008  Grame
+  Grame Research Laboratory, 9 rue du Garet, 69001 Lyon - France
+  research@grame.fr
+
+  This file is provided as an example of the MusicXML Library use.
+  It measures the elements creation rate of the factory.
+*/
+
+#ifdef WIN32
+# pragma warning (disable : 4786)
+#endif
+
+#include <stdlib.h>
+#include <chrono>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+#ifndef WIN32
+#include <libgen.h>
+#endif
+
+#include "elements.h"
+#include "factory.h"
+
+using namespace std;
+using namespace MusicXML2;
+
+static void usage (char* name)
+{
+#ifndef WIN32
+	const char* tool = basename (name);
+#else
+	const char* tool = name;
+#endif
+	cerr << "usage: " << tool << " [count]" << endl;
+	cerr << "       creates <count> times each MusicXML element (default 1000)" << endl;
+	cerr << "       by name and by type and reports the creation rates" << endl;
+	exit(1);
+}
+
+//_______________________________________________________________________________
+static double elapsed (chrono::steady_clock::time_point start)
+{
+	return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+static void report (const char* what, size_t n, double seconds)
+{
+	cout << what << ": " << n << " in " << seconds * 1000 << " ms, " << (n / seconds) / 1e6 << " M/s" << endl;
+}
+
+//_______________________________________________________________________________
+int main(int argc, char *argv[])
+{
+	int count = 1000;
+	if (argc > 2) usage (argv[0]);
+	if (argc == 2) {
+		count = atoi (argv[1]);
+		if (count < 1) usage (argv[0]);
+	}
+
+	factory& f = factory::instance();
+	vector<string> names;
+	map<string, int> namesMap;		// the name to type mapping used before the perfect hash
+	for (int type = kComment; type < kEndElement; type++) {
+		Sxmlelement elt = f.create (type);
+		names.push_back (elt->getName());
+		namesMap[elt->getName()] = type;
+	}
+	size_t n = names.size() * count;
+
+	// name to type lookups only
+	long check = 0;
+	auto start = chrono::steady_clock::now();
+	for (int i = 0; i < count; i++)
+		for (auto& name: names) check += namesMap.find (name)->second;
+	report ("std::map lookups", n, elapsed (start));
+
+	start = chrono::steady_clock::now();
+	for (int i = 0; i < count; i++)
+		for (auto& name: names) check -= f.type (name.data(), name.size());
+	report ("perfect hash lookups", n, elapsed (start));
+	if (check) {
+		cerr << "unexpected name to type mapping" << endl;
+		return 1;
+	}
+
+	// elements creation, the elements are released inside the timed section
+	start = chrono::steady_clock::now();
+	for (int i = 0; i < count; i++)
+		for (auto& name: names) f.create (name);
+	report ("creations by name", n, elapsed (start));
+
+	start = chrono::steady_clock::now();
+	for (int i = 0; i < count; i++)
+		for (int type = kComment; type < kEndElement; type++) f.create (type);
+	report ("creations by type", n, elapsed (start));
+	return 0;
+}
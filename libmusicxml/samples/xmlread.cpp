@@ -14,10 +14,10 @@
 #include <stdlib.h>
 #include <iostream>
 #include <fstream>
+#include <string.h>
 #ifndef WIN32
 #include <libgen.h>
 #include <signal.h>
-#include <string.h>
 #endif
 
 #include "xml.h"
@@ -38,6 +38,7 @@ static void usage (char* name)
 #endif
 	cerr << "usage: " << tool << " [options] <musicxml file>" << endl;
 	cerr << "       read a musicxml file and re-write it" << endl;
+	cerr << "       compressed musicxml files (.mxl) are decompressed in memory" << endl;
 	cerr << "       options:" << endl;
 	cerr << "           	-o <file>: output file name" << endl;
 	cerr << "       writes to standard output when -o option is missing." << endl;
@@ -119,7 +120,9 @@ int main(int argc, char *argv[])
 	else out = &cout;
 
 	xmlreader r;
-	SXMLFile file = r.read(filename);
+	size_t len = strlen(filename);
+	bool mxl = (len > 4) && !strcmp(filename + len - 4, ".mxl");
+	SXMLFile file = mxl ? r.readmxl(filename) : r.read(filename);
 	if (file) {
 //		Sxmlelement st = file->elements();
 		file->print(*out);
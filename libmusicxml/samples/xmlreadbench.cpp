@@ -0,0 +1,251 @@
+/*
+
+  Copyright (C) 2003-2008  Grame
+  Grame Research Laboratory, 9 rue du Garet, 69001 Lyon - France
+  research@grame.fr
+
+  This file is provided as an example of the MusicXML Library use.
+*/
+
+#ifdef WIN32
+# pragma warning (disable : 4786)
+#endif
+
+#include <stdlib.h>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <sstream>
+#include <thread>
+#include <vector>
+#ifndef WIN32
+#include <libgen.h>
+#include <sys/resource.h>
+#endif
+#include <sys/stat.h>
+
+#include "xml.h"
+#include "xmlfile.h"
+#include "xmlreader.h"
+#include "xmlvisitor.h"
+
+using namespace std;
+using namespace MusicXML2;
+
+static void usage (char* name)
+{
+#ifndef WIN32
+	const char* tool = basename (name);
+#else
+	const char* tool = name;
+#endif
+	cerr << "usage: " << tool << " [options] <musicxml files>" << endl;
+	cerr << "       compares the flex/bison reader and the memory mapped reader, in tree and streaming modes" << endl;
+	cerr << "       options:" << endl;
+	cerr << "           	-n <count>: number of reads of each file (default 5)" << endl;
+	cerr << "           	-j <threads>: then reads all the files concurrently in <threads> threads" << endl;
+	cerr << "           	              with the mapped reader and checks the trees are identical" << endl;
+	cerr << "           	-r <heap|arena|stream>: only reads the files with the mapped reader, allocating the trees" << endl;
+	cerr << "           	              on the heap or in an arena, or visiting and releasing the measures" << endl;
+	cerr << "           	              while reading, and reports the read and release times and the peak memory use" << endl;
+	exit(1);
+}
+
+//_______________________________________________________________________________
+typedef SXMLFile (*readfunction)(const char* file);
+
+static SXMLFile classicread (const char* file)	{ xmlreader r; return r.read (file); }
+static SXMLFile mappedread (const char* file)	{ xmlreader r; return r.readmapped (file); }
+static SXMLFile arenaread (const char* file)	{ xmlreader r; r.useArena (true); return r.readmapped (file); }
+
+// counts the elements, as a minimal streaming visitor
+class elementscounter : public visitor<Sxmlelement>
+{
+	public:
+		size_t	fCount = 0;
+		void	visitStart (Sxmlelement& elt)	{ fCount++; }
+};
+
+static SXMLFile streamread (const char* file)
+{
+	elementscounter counter;
+	xmlreader r;
+	r.stream (&counter);
+	return r.readmapped (file);
+}
+
+// returns the best time in seconds, the tree is released inside the timed section
+static double timeread (readfunction f, const char* file, int count, bool& ok)
+{
+	double best = 0;
+	ok = true;
+	for (int i = 0; i < count; i++) {
+		auto start = chrono::steady_clock::now();
+		{
+			SXMLFile xml = f (file);
+			if (!xml) ok = false;
+		}
+		double elapsed = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+		if (!i || (elapsed < best)) best = elapsed;
+	}
+	return best;
+}
+
+static string printed (SXMLFile xml)
+{
+	stringstream s;
+	if (xml) xml->print (s);
+	return s.str();
+}
+
+// prints the file while reading it in streaming mode
+static string streamprinted (const char* file)
+{
+	stringstream elts;
+	xmlvisitor v (elts);
+	xmlreader r;
+	r.stream (&v);
+	SXMLFile xml = r.readmapped (file);
+	if (!xml) return "";
+
+	stringstream s;
+	if (xml->getXMLDecl()) xml->getXMLDecl()->print (s);
+	if (xml->getDocType()) xml->getDocType()->print (s);
+	return s.str() + elts.str();
+}
+
+//_______________________________________________________________________________
+// reads the files with the given allocation mode, the peak memory use is the whole process one
+static int allocationreads (const vector<const char*>& files, int count, const string& mode)
+{
+	readfunction f = (mode == "arena") ? arenaread : (mode == "stream") ? streamread : mappedread;
+	double total = 0, totalBytes = 0;
+	int errors = 0;
+	for (auto file: files) {
+		struct stat st;
+		if (stat (file, &st)) {
+			cerr << "can't stat " << file << endl;
+			continue;
+		}
+		bool ok;
+		double t = timeread (f, file, count, ok);
+		cout << file << ": " << st.st_size << " bytes, read and release " << t * 1000 << " ms"
+			 << (ok ? "" : " [read error]") << endl;
+		if (ok) {
+			total += t;
+			totalBytes += st.st_size;
+		}
+		else errors++;
+	}
+	double mb = totalBytes / (1024 * 1024);
+	cout << mode << ": total " << mb << " MB in " << total * 1000 << " ms, " << mb / total << " MB/s" << endl;
+#ifndef WIN32
+	struct rusage usage;
+	getrusage (RUSAGE_SELF, &usage);
+#ifdef __APPLE__
+	long maxrss = usage.ru_maxrss / 1024;		// in bytes on macOS
+#else
+	long maxrss = usage.ru_maxrss;				// in kilobytes
+#endif
+	cout << "peak RSS: " << maxrss << " KB" << endl;
+#endif
+	return errors;
+}
+
+//_______________________________________________________________________________
+// each thread reads all the files, starting at a different one
+static int concurrentreads (const vector<const char*>& files, int threadsCount)
+{
+	vector<string> reference;
+	for (auto file: files) reference.push_back (printed (mappedread (file)));
+
+	atomic<int> differences (0);
+	auto start = chrono::steady_clock::now();
+	vector<thread> threads;
+	for (int t = 0; t < threadsCount; t++) {
+		threads.push_back (thread ([&files, &reference, &differences, t] () {
+			for (size_t i = 0; i < files.size(); i++) {
+				size_t n = (i + t) % files.size();
+				if (printed (mappedread (files[n])) != reference[n]) {
+					cerr << files[n] << ": different tree in thread " << t << endl;
+					differences++;
+				}
+			}
+		}));
+	}
+	for (auto& t: threads) t.join();
+	double elapsed = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+	cout << threadsCount << " threads: " << files.size() * threadsCount << " reads in " << elapsed << " s, "
+		 << differences << " different tree(s)" << endl;
+	return differences;
+}
+
+//_______________________________________________________________________________
+int main(int argc, char *argv[])
+{
+	int count = 5;
+	int threadsCount = 0;
+	string allocation;
+	vector<const char*> files;
+	for (int i = 1; i < argc; i++) {
+		string arg = argv[i];
+		if (arg == "-n") {
+			if (++i >= argc) usage (argv[0]);
+			count = atoi (argv[i]);
+		}
+		else if (arg == "-j") {
+			if (++i >= argc) usage (argv[0]);
+			threadsCount = atoi (argv[i]);
+		}
+		else if (arg == "-r") {
+			if (++i >= argc) usage (argv[0]);
+			allocation = argv[i];
+			if ((allocation != "heap") && (allocation != "arena") && (allocation != "stream")) usage (argv[0]);
+		}
+		else if (arg[0] == '-') usage (argv[0]);
+		else files.push_back (argv[i]);
+	}
+	if (files.empty() || (count < 1)) usage (argv[0]);
+	if (allocation.size())
+		return allocationreads (files, count, allocation) ? 1 : 0;
+
+	double totalClassic = 0, totalMapped = 0, totalBytes = 0;
+	int differences = 0;
+	for (auto file: files) {
+		struct stat st;
+		if (stat (file, &st)) {
+			cerr << "can't stat " << file << endl;
+			continue;
+		}
+		bool classicok, mappedok;
+		double classic = timeread (classicread, file, count, classicok);
+		double mapped  = timeread (mappedread, file, count, mappedok);
+		string reference = printed (mappedread (file));
+		bool same = printed (classicread (file)) == reference;
+		bool samestreamed = streamprinted (file) == reference;
+		if (!same || !samestreamed) differences++;
+
+		cout << file << ": " << st.st_size << " bytes, flex " << classic * 1000 << " ms, mapped " << mapped * 1000 << " ms"
+			 << (classicok ? "" : " [flex read error]")
+			 << (mappedok ? "" : " [mapped read error]")
+			 << (same ? "" : " [trees differ]")
+			 << (samestreamed ? "" : " [streamed tree differs]") << endl;
+		if (classicok && mappedok) {
+			totalClassic += classic;
+			totalMapped += mapped;
+			totalBytes += st.st_size;
+		}
+	}
+
+	double mb = totalBytes / (1024 * 1024);
+	if (totalClassic > 0 && totalMapped > 0) {
+		cout << "total " << mb << " MB: flex " << mb / totalClassic << " MB/s, mapped " << mb / totalMapped << " MB/s, speedup "
+			 << totalClassic / totalMapped << endl;
+	}
+	cout << differences << " file(s) with different trees" << endl;
+
+	if (threadsCount > 0)
+		differences += concurrentreads (files, threadsCount);
+	return differences ? 1 : 0;
+}
@@ -0,0 +1,151 @@
+/*
+
+  Copyright (C) 2003-2008  Grame
+  Grame Research Laboratory, 9 rue du Garet, 69001 Lyon - France
+  research@grame.fr
+
+  This file is provided as an example of the MusicXML Library use.
+*/
+
+#ifdef WIN32
+# pragma warning (disable : 4786)
+#endif
+
+#include <stdlib.h>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <vector>
+#ifndef WIN32
+#include <libgen.h>
+#endif
+
+#include "xml.h"
+#include "xmlfile.h"
+#include "xmlreader.h"
+#include "xmlvisitor.h"
+#include "xmlwriter.h"
+
+using namespace std;
+using namespace MusicXML2;
+
+static void usage (char* name)
+{
+#ifndef WIN32
+	const char* tool = basename (name);
+#else
+	const char* tool = name;
+#endif
+	cerr << "usage: " << tool << " [options] <musicxml files>" << endl;
+	cerr << "       compares the output throughput of xmlvisitor and xmlwriter, in indented and compact modes" << endl;
+	cerr << "       options:" << endl;
+	cerr << "           	-n <count>: number of writes of each file (default 5)" << endl;
+	cerr << "           	-o <file>: the file written to (default /dev/null)" << endl;
+	exit(1);
+}
+
+//_______________________________________________________________________________
+enum writemode { kVisitor, kWriter, kCompact };
+
+static void write (SXMLFile xml, ostream& out, writemode mode)
+{
+	if (xml->getXMLDecl()) xml->getXMLDecl()->print (out);
+	if (xml->getDocType()) xml->getDocType()->print (out);
+	if (mode == kVisitor) {
+		xmlvisitor v (out);
+		tree_browser<xmlelement> browser (&v);
+		browser.browse (*xml->elements());
+	}
+	else {
+		xmlwriter w (out, mode == kCompact);
+		tree_browser<xmlelement> browser (&w);
+		browser.browse (*xml->elements());
+	}
+	out << endl;
+}
+
+static string written (SXMLFile xml, writemode mode)
+{
+	stringstream s;
+	write (xml, s, mode);
+	return s.str();
+}
+
+// returns the best time in seconds
+static double timewrite (SXMLFile xml, const string& output, writemode mode, int count)
+{
+	double best = 0;
+	for (int i = 0; i < count; i++) {
+		ofstream out (output);
+		auto start = chrono::steady_clock::now();
+		write (xml, out, mode);
+		out.close();
+		double elapsed = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+		if (!i || (elapsed < best)) best = elapsed;
+	}
+	return best;
+}
+
+//_______________________________________________________________________________
+int main(int argc, char *argv[])
+{
+	int count = 5;
+#ifndef WIN32
+	string output = "/dev/null";
+#else
+	string output = "NUL";
+#endif
+	vector<const char*> files;
+	for (int i = 1; i < argc; i++) {
+		string arg = argv[i];
+		if (arg == "-n") {
+			if (++i >= argc) usage (argv[0]);
+			count = atoi (argv[i]);
+		}
+		else if (arg == "-o") {
+			if (++i >= argc) usage (argv[0]);
+			output = argv[i];
+		}
+		else if (arg[0] == '-') usage (argv[0]);
+		else files.push_back (argv[i]);
+	}
+	if (files.empty() || (count < 1)) usage (argv[0]);
+
+	double totalVisitor = 0, totalWriter = 0, totalCompact = 0, totalBytes = 0, totalCompactBytes = 0;
+	int differences = 0;
+	for (auto file: files) {
+		xmlreader r;
+		SXMLFile xml = r.readmapped (file);
+		if (!xml || !xml->elements()) {
+			cerr << file << ": read error" << endl;
+			continue;
+		}
+		string reference = written (xml, kVisitor);
+		bool same = written (xml, kWriter) == reference;
+		if (!same) differences++;
+		size_t compactSize = written (xml, kCompact).size();
+
+		double visitor = timewrite (xml, output, kVisitor, count);
+		double writer  = timewrite (xml, output, kWriter, count);
+		double compact = timewrite (xml, output, kCompact, count);
+		cout << file << ": " << reference.size() << " bytes, xmlvisitor " << visitor * 1000 << " ms, xmlwriter " << writer * 1000
+			 << " ms, compact " << compactSize << " bytes " << compact * 1000 << " ms"
+			 << (same ? "" : " [outputs differ]") << endl;
+		totalVisitor += visitor;
+		totalWriter += writer;
+		totalCompact += compact;
+		totalBytes += reference.size();
+		totalCompactBytes += compactSize;
+	}
+
+	double mb = totalBytes / (1024 * 1024);
+	double compactmb = totalCompactBytes / (1024 * 1024);
+	if (totalVisitor > 0 && totalWriter > 0 && totalCompact > 0) {
+		cout << "total " << mb << " MB: xmlvisitor " << mb / totalVisitor << " MB/s, xmlwriter " << mb / totalWriter << " MB/s, speedup "
+			 << totalVisitor / totalWriter << endl;
+		cout << "compact " << compactmb << " MB: " << compactmb / totalCompact << " MB/s, speedup " << totalVisitor / totalCompact << endl;
+	}
+	cout << differences << " file(s) with different outputs" << endl;
+	return differences ? 1 : 0;
+}
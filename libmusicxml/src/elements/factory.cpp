@@ -27,941 +27,1989 @@
 
 using namespace std; 
 
-// libmxmllineno is outside of name space MusicXML2
-extern int libmxmllineno;
-
-
 namespace MusicXML2 
 {
 
-
 template<int elt>
-class newElementFunctor : public functor<Sxmlelement>
+static Sxmlelement newElement (int inputLineNumber)
 {
-  public:
-  
-    Sxmlelement operator ()()
-        { return musicxml<elt>::new_musicxml (libmxmllineno); }
-};
+	return musicxml<elt>::new_musicxml (inputLineNumber);
+}
 
 
-Sxmlelement factory::create (const string& eltname) const
+Sxmlelement factory::create (const char* eltname, size_t len, int inputLineNumber) const
 { 
-	map<std::string, functor<Sxmlelement>*>::const_iterator i = fMap.find (eltname);
-	if (i != fMap.end()) {
-		functor<Sxmlelement>* f = i->second;
-		if (f) {
-			Sxmlelement elt = (*f)();
-			elt->setName(eltname);
-			return elt;
-		}
-	}
-	cerr << "Sxmlelement factory::create called with unknown element \"" << eltname << "\"" << endl;
+	int eltType = type (eltname, len);
+	if (eltType != kNoElement) return create (eltType, inputLineNumber);
+	cerr << "Sxmlelement factory::create called with unknown element \"" << string(eltname, len) << "\"" << endl;
 	return 0;
 }
 
-Sxmlelement factory::create(int type) const
+Sxmlelement factory::create(int type, int inputLineNumber) const
 { 
-	map<int, const char*>::const_iterator i = fType2Name.find (type);
-	if (i != fType2Name.end()) {
-		return create (i->second);
+	if ((type > kNoElement) && (type < kEndElement)) {
+		Sxmlelement elt = fConstructors[type](inputLineNumber);
+		elt->setName(&fNames[type]);
+		return elt;
 	}
 	cerr << "Sxmlelement factory::create called with unknown type \"" << type << "\"" << endl;
 	return 0;
 }
 
 
-factory::factory() 
+enum { kBuckets = 256, kSlotsCount = 1024 };
+
+static const unsigned short kDisplacements[kBuckets] = {
+	2, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 1,
+	1, 6, 0, 0, 3, 0, 4, 2, 0, 1, 0, 0, 4, 0, 0, 0,
+	0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 3, 2, 1, 0, 0,
+	2, 5, 0, 0, 1, 0, 0, 6, 0, 0, 3, 0, 0, 0, 5, 0,
+	0, 1, 0, 0, 4, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 2, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 1,
+	0, 0, 0, 0, 0, 0, 0, 1, 0, 3, 0, 1, 0, 0, 1, 0,
+	0, 1, 0, 0, 1, 3, 0, 0, 2, 1, 0, 2, 8, 0, 0, 0,
+	2, 0, 0, 0, 0, 0, 1, 6, 0, 0, 0, 0, 3, 0, 0, 0,
+	0, 0, 7, 1, 1, 0, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0,
+	0, 0, 0, 3, 0, 0, 0, 0, 2, 0, 0, 0, 0, 1, 0, 1,
+	0, 1, 0, 0, 0, 0, 4, 2, 0, 0, 2, 1, 1, 0, 0, 0,
+	1, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0,
+	0, 1, 2, 0, 0, 1, 1, 0, 1, 4, 0, 0, 3, 0, 0, 0,
+	5, 0, 1, 1, 2, 0, 0, 0, 1, 0, 1, 0, 0, 0, 1, 0,
+	0, 0, 1, 2, 0, 1, 1, 2, 0, 0, 2, 0, 0, 4, 1, 0,
+};
+
+static const short kSlots[kSlotsCount] = {
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	k_other_play,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	k_wedge,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	k_part_group,
+	k_slide,
+	k_encoding_date,
+	kNoElement,
+	kNoElement,
+	k_voice,
+	kNoElement,
+	k_pitch,
+	k_smear,
+	k_end_paragraph,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	k_scoop,
+	k_pull_off,
+	k_glyph,
+	kNoElement,
+	k_first,
+	k_virtual_library,
+	kNoElement,
+	kNoElement,
+	k_harmon_closed,
+	k_system_dividers,
+	k_print,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	k_scordatura,
+	k_numeral_alter,
+	k_time_relation,
+	kNoElement,
+	k_double_tongue,
+	k_cue,
+	k_credit_symbol,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	k_dot,
+	k_toe,
+	kNoElement,
+	k_key,
+	k_ensemble,
+	k_diatonic,
+	kNoElement,
+	k_breath_mark,
+	kNoElement,
+	k_measure_style,
+	k_beat_repeat,
+	kNoElement,
+	kNoElement,
+	k_tuplet_number,
+	kNoElement,
+	k_staccato,
+	k_spiccato,
+	k_multiple_rest,
+	kNoElement,
+	kNoElement,
+	k_degree_type,
+	k_frame_frets,
+	k_player_name,
+	k_relation,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	k_metronome_relation,
+	k_ffffff,
+	kNoElement,
+	k_f,
+	k_duration,
+	k_page_layout,
+	kNoElement,
+	k_credit_type,
+	kNoElement,
+	k_degree,
+	k_accord,
+	k_accent,
+	k_n,
+	k_p,
+	kNoElement,
+	kNoElement,
+	k_midi_name,
+	k_beater,
+	k_miscellaneous,
+	k_backup,
+	kNoElement,
+	kNoElement,
+	k_dashes,
+	k_part_symbol,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	k_part_clef,
+	kNoElement,
+	k_key_accidental,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	k_hammer_on,
+	kNoElement,
+	k_swing_style,
+	k_unstress,
+	kNoElement,
+	k_beat_unit,
+	kNoElement,
+	kNoElement,
+	k_staff_distance,
+	k_player,
+	kNoElement,
+	k_listen,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	k_lyric_language,
+	k_suffix,
+	k_tenths,
+	k_coda,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	k_heel,
+	kNoElement,
+	kNoElement,
+	k_metronome_arrows,
+	k_score_instrument,
+	k_capo,
+	k_stress,
+	k_miscellaneous_field,
+	k_tied,
+	k_damp,
+	k_numeral_fifths,
+	k_bass,
+	k_metronome_tied,
+	k_flip,
+	k_other_dynamics,
+	k_root_step,
+	kNoElement,
+	kNoElement,
+	k_time,
+	k_doit,
+	k_degree_alter,
+	k_fret,
+	kNoElement,
+	k_schleifer,
+	kNoElement,
+	k_rehearsal,
+	kNoElement,
+	k_score_partwise,
+	k_sffz,
+	k_plop,
+	k_snap_pizzicato,
+	k_solo,
+	k_rest,
+	k_left_divider,
+	k_page_margins,
+	k_direction,
+	kNoElement,
+	k_sfzp,
+	k_unpitched,
+	k_root,
+	kNoElement,
+	k_elevation,
+	kNoElement,
+	k_midi_program,
+	kNoElement,
+	kNoElement,
+	k_instruments,
+	k_octave_shift,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	k_virtual_name,
+	k_staff_tuning,
+	k_pf,
+	kNoElement,
+	kProcessingInstruction,
+	kNoElement,
+	k_detached_legato,
+	kNoElement,
+	k_inversion,
+	k_bracket,
+	k_normal_notes,
+	k_notations,
+	k_staff_layout,
+	k_pp,
+	k_fermata,
+	k_encoder,
+	k_senza_misura,
+	k_measure_numbering,
+	k_half_muted,
+	k_hole_shape,
+	kNoElement,
+	k_numeral_root,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	k_creator,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	k_accordion_registration,
+	kNoElement,
+	k_staff_size,
+	k_normal_dot,
+	kNoElement,
+	kNoElement,
+	k_score_part,
+	kNoElement,
+	k_grace,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	k_per_minute,
+	k_music_font,
+	k_first_fret,
+	k_group_time,
+	k_root_alter,
+	k_lyric_font,
+	kNoElement,
+	k_stick_type,
+	kNoElement,
+	kNoElement,
+	k_other_direction,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	k_octave_change,
+	kNoElement,
+	kNoElement,
+	k_encoding_description,
+	kNoElement,
+	kNoElement,
+	k_artificial,
+	k_interchangeable,
+	k_segno,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	k_movement_number,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	k_midi_instrument,
+	kNoElement,
+	k_for_part,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	k_key_step,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	k_concert_score,
+	kNoElement,
+	k_strong_accent,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	k_bottom_margin,
+	kNoElement,
+	k_frame_strings,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	k_encoding,
+	k_line_detail,
+	k_sfp,
+	k_metronome_dot,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	k_ppp,
+	k_harp_pedals,
+	k_harmonic,
+	kNoElement,
+	k_tuplet_normal,
+	kNoElement,
+	k_bookmark,
+	k_left_margin,
+	k_soft_accent,
+	k_sfz,
+	k_up_bow,
+	kNoElement,
+	kNoElement,
+	k_delayed_inverted_turn,
+	k_staff_lines,
+	k_other_articulation,
+	k_other_appearance,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	k_software,
+	k_midi_bank,
+	k_harmon_mute,
+	kNoElement,
+	kNoElement,
+	k_system_layout,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	k_credit,
+	k_double,
+	kNoElement,
+	kNoElement,
+	k_string_mute,
+	k_tuning_step,
+	kNoElement,
+	k_octave,
+	kNoElement,
+	k_figure,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	k_virtual_instrument,
+	k_tuplet_type,
+	kNoElement,
+	kNoElement,
+	k_rights,
+	k_assess,
+	k_bar_style,
+	k_bass_step,
+	kNoElement,
+	k_staves,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	k_ffff,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	k_metronome_tuplet,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	k_touching_pitch,
+	k_bass_separator,
+	k_line,
+	k_midi_channel,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	k_instrument_sound,
+	k_link,
+	k_direction_type,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	k_note,
+	k_wait,
+	k_part,
+	k_metronome_note,
+	k_other_notation,
+	k_movement_title,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	k_pppp,
+	k_system_margins,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	k_turn,
+	kNoElement,
+	k_identification,
+	k_except_voice,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	k_time_modification,
+	k_mf,
+	kNoElement,
+	k_metronome,
+	k_ornaments,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	k_clef_octave_change,
+	kNoElement,
+	k_bend_alter,
+	k_inverted_vertical_turn,
+	k_mp,
+	k_pitched,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	k_fffff,
+	k_trill_mark,
+	k_stopped,
+	kNoElement,
+	k_tremolo,
+	k_image,
+	k_staff_type,
+	kNoElement,
+	k_pedal,
+	kNoElement,
+	k_group_link,
+	kNoElement,
+	k_slash_type,
+	kNoElement,
+	k_end_line,
+	k_pre_bend,
+	kNoElement,
+	kNoElement,
+	k_appearance,
+	k_chord,
+	kNoElement,
+	kNoElement,
+	k_metal,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	k_level,
+	k_staff,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	k_with_bar,
+	kNoElement,
+	kNoElement,
+	k_lyric,
+	kNoElement,
+	kNoElement,
+	k_staff_details,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	k_down_bow,
+	kNoElement,
+	kNoElement,
+	k_ppppp,
+	k_accordion_low,
+	k_right_divider,
+	kNoElement,
+	k_instrument_link,
+	kNoElement,
+	kNoElement,
+	k_group_barline,
+	k_figure_number,
+	k_eyeglasses,
+	k_notehead_text,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	k_pan,
+	kNoElement,
+	kNoElement,
+	k_tie,
+	kNoElement,
+	kNoElement,
+	k_tuplet_actual,
+	kNoElement,
+	k_attributes,
+	k_tap,
+	kNoElement,
+	k_notehead,
+	k_pedal_alter,
+	k_distance,
+	kNoElement,
+	kNoElement,
+	k_laughing,
+	k_accordion_middle,
+	kNoElement,
+	kNoElement,
+	k_syllabic,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	k_inverted_turn,
+	k_defaults,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	k_beat_unit_tied,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	k_cancel,
+	k_function,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	k_effect,
+	k_footnote,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	k_staccatissimo,
+	k_normal_type,
+	k_work_number,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	k_second,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	k_fifths,
+	kNoElement,
+	k_inverted_mordent,
+	k_offset,
+	k_arrow_style,
+	kNoElement,
+	k_beat_type,
+	kNoElement,
+	kNoElement,
+	k_key_alter,
+	k_slash_dot,
+	kNoElement,
+	k_non_arpeggiate,
+	kNoElement,
+	k_part_link,
+	k_midi_unpitched,
+	k_prefix,
+	k_beam,
+	kNoElement,
+	kNoElement,
+	k_metronome_beam,
+	k_stick_material,
+	k_other_percussion,
+	kNoElement,
+	k_top_system_distance,
+	k_note_size,
+	k_tenuto,
+	k_word_font,
+	k_measure_repeat,
+	k_pppppp,
+	kNoElement,
+	k_stick_location,
+	k_display_octave,
+	kNoElement,
+	k_kind,
+	k_mode,
+	k_millimeters,
+	kNoElement,
+	k_technical,
+	k_sounding_pitch,
+	k_circular_arrow,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	k_credit_image,
+	kNoElement,
+	k_other_ornament,
+	kNoElement,
+	kNoElement,
+	k_staff_divide,
+	k_play,
+	kNoElement,
+	kNoElement,
+	k_sfpp,
+	k_chromatic,
+	k_mute,
+	k_sync,
+	k_semi_pitched,
+	k_figured_bass,
+	kNoElement,
+	kNoElement,
+	k_thumb_position,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	k_numeral_mode,
+	k_pedal_tuning,
+	k_work,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	k_ff,
+	k_listening,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	k_fp,
+	kNoElement,
+	k_divisions,
+	k_rf,
+	kNoElement,
+	k_tuning_alter,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	k_transpose,
+	k_fz,
+	k_display_step,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	k_caesura,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	k_display_text,
+	k_page_width,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	k_bass_alter,
+	kNoElement,
+	k_measure,
+	k_elision,
+	kComment,
+	k_humming,
+	k_forward,
+	kNoElement,
+	k_key_octave,
+	kNoElement,
+	k_accidental_text,
+	kNoElement,
+	k_group_name,
+	kNoElement,
+	k_harmony,
+	k_other_technical,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	k_principal_voice,
+	kNoElement,
+	kNoElement,
+	k_accidental,
+	k_damp_all,
+	kNoElement,
+	k_frame,
+	k_shake,
+	k_barre,
+	kNoElement,
+	k_beats,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	k_work_title,
+	k_tuplet_dot,
+	k_haydn,
+	kNoElement,
+	k_swing_type,
+	k_golpe,
+	k_arpeggiate,
+	k_arrow_direction,
+	k_slash,
+	k_alter,
+	k_system_distance,
+	k_stick,
+	k_group_name_display,
+	k_pluck,
+	k_other_listening,
+	k_glass,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	k_instrument_name,
+	k_swing,
+	k_sound,
+	k_arrow,
+	kNoElement,
+	k_group,
+	kNoElement,
+	k_words,
+	kNoElement,
+	kNoElement,
+	k_fff,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	k_ipa,
+	k_handbell,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	k_midi_device,
+	kNoElement,
+	kNoElement,
+	k_page_height,
+	kNoElement,
+	k_tuning_octave,
+	kNoElement,
+	k_membrane,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	k_percussion,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	k_triple_tongue,
+	k_hole_closed,
+	k_vertical_turn,
+	k_rfz,
+	k_group_abbreviation,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	k_instrument,
+	kNoElement,
+	k_dynamics,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	k_straight,
+	kNoElement,
+	k_measure_distance,
+	k_grouping,
+	k_numeral_key,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	k_group_abbreviation_display,
+	k_ending,
+	k_open_string,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	k_instrument_abbreviation,
+	kNoElement,
+	kNoElement,
+	k_accordion_high,
+	k_repeat,
+	k_articulations,
+	kNoElement,
+	kNoElement,
+	k_part_name,
+	kNoElement,
+	kNoElement,
+	k_extend,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	k_supports,
+	k_source,
+	kNoElement,
+	kNoElement,
+	k_fingernails,
+	kNoElement,
+	k_symbol,
+	k_hole_type,
+	k_volume,
+	k_bend,
+	k_clef,
+	kNoElement,
+	k_wavy_line,
+	k_string,
+	k_tuplet,
+	kNoElement,
+	k_part_list,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	k_part_name_display,
+	k_hole,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	k_score_timewise,
+	k_sign,
+	k_open,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	k_degree_value,
+	k_stem,
+	k_wood,
+	kNoElement,
+	k_step,
+	k_fingering,
+	k_measure_layout,
+	k_directive,
+	k_arrowhead,
+	kNoElement,
+	kNoElement,
+	k_part_transpose,
+	k_glissando,
+	k_type,
+	k_text,
+	k_opus,
+	k_metronome_type,
+	k_right_margin,
+	k_slur,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	k_delayed_turn,
+	kNoElement,
+	k_actual_notes,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	k_credit_words,
+	k_sf,
+	kNoElement,
+	k_part_abbreviation,
+	kNoElement,
+	k_falloff,
+	k_other_listen,
+	kNoElement,
+	k_accidental_mark,
+	k_brass_bend,
+	k_release,
+	k_barline,
+	k_base_pitch,
+	kNoElement,
+	kNoElement,
+	k_scaling,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	k_instrument_change,
+	k_feature,
+	k_frame_note,
+	k_pedal_step,
+	k_group_symbol,
+	kNoElement,
+	k_timpani,
+	kNoElement,
+	k_numeral,
+	kNoElement,
+	k_line_width,
+	k_natural,
+	kNoElement,
+	kNoElement,
+	kNoElement,
+	k_mordent,
+	kNoElement,
+	k_part_abbreviation_display,
+	k_top_margin,
+	k_beat_unit_dot,
+};
+
+int factory::type (const char* name, size_t len) const
+{
+	unsigned int h = 0, g = 0;
+	for (size_t i = 0; i < len; i++) {
+		unsigned char c = name[i];
+		h = h * 31 + c;
+		g = g * 257 + c;
+	}
+	int type = kSlots[(g + kDisplacements[h % kBuckets]) % kSlotsCount];
+	const string& eltname = fNames[type];
+	return ((eltname.size() == len) && !eltname.compare (0, len, name, len)) ? type : kNoElement;
+}
+
+factory::factory()
 {
-	fMap["comment"] 		= new newElementFunctor<kComment>;
-	fMap["pi"] 				= new newElementFunctor<kProcessingInstruction>;
-	fType2Name[kComment] 	= "comment";
-	fType2Name[kProcessingInstruction]  = "pi";
+	fConstructors[kNoElement] = 0;
+	fConstructors[kComment] = newElement<kComment>;
+	fConstructors[kProcessingInstruction] = newElement<kProcessingInstruction>;
+	fNames[kComment] = "comment";
+	fNames[kProcessingInstruction] = "pi";
 
-	fMap["accent"] 	= new newElementFunctor<k_accent>;
-	fMap["accidental"] 	= new newElementFunctor<k_accidental>;
-	fMap["accidental-mark"] 	= new newElementFunctor<k_accidental_mark>;
-	fMap["accidental-text"] 	= new newElementFunctor<k_accidental_text>;
-	fMap["accord"] 	= new newElementFunctor<k_accord>;
-	fMap["accordion-high"] 	= new newElementFunctor<k_accordion_high>;
-	fMap["accordion-low"] 	= new newElementFunctor<k_accordion_low>;
-	fMap["accordion-middle"] 	= new newElementFunctor<k_accordion_middle>;
-	fMap["accordion-registration"] 	= new newElementFunctor<k_accordion_registration>;
-	fMap["actual-notes"] 	= new newElementFunctor<k_actual_notes>;
-	fMap["alter"] 	= new newElementFunctor<k_alter>;
-	fMap["appearance"] 	= new newElementFunctor<k_appearance>;
-	fMap["arpeggiate"] 	= new newElementFunctor<k_arpeggiate>;
-	fMap["arrow"] 	= new newElementFunctor<k_arrow>;
-	fMap["arrow-direction"] 	= new newElementFunctor<k_arrow_direction>;
-	fMap["arrow-style"] 	= new newElementFunctor<k_arrow_style>;
-	fMap["arrowhead"] 	= new newElementFunctor<k_arrowhead>;
-	fMap["articulations"] 	= new newElementFunctor<k_articulations>;
-	fMap["artificial"] 	= new newElementFunctor<k_artificial>;
-	fMap["assess"] 	= new newElementFunctor<k_assess>;
-	fMap["attributes"] 	= new newElementFunctor<k_attributes>;
-	fMap["backup"] 	= new newElementFunctor<k_backup>;
-	fMap["bar-style"] 	= new newElementFunctor<k_bar_style>;
-	fMap["barline"] 	= new newElementFunctor<k_barline>;
-	fMap["barre"] 	= new newElementFunctor<k_barre>;
-	fMap["base-pitch"] 	= new newElementFunctor<k_base_pitch>;
-	fMap["bass"] 	= new newElementFunctor<k_bass>;
-	fMap["bass-alter"] 	= new newElementFunctor<k_bass_alter>;
-	fMap["bass-separator"] 	= new newElementFunctor<k_bass_separator>;
-	fMap["bass-step"] 	= new newElementFunctor<k_bass_step>;
-	fMap["beam"] 	= new newElementFunctor<k_beam>;
-	fMap["beat-repeat"] 	= new newElementFunctor<k_beat_repeat>;
-	fMap["beat-type"] 	= new newElementFunctor<k_beat_type>;
-	fMap["beat-unit"] 	= new newElementFunctor<k_beat_unit>;
-	fMap["beat-unit-dot"] 	= new newElementFunctor<k_beat_unit_dot>;
-	fMap["beat-unit-tied"] 	= new newElementFunctor<k_beat_unit_tied>;
-	fMap["beater"] 	= new newElementFunctor<k_beater>;
-	fMap["beats"] 	= new newElementFunctor<k_beats>;
-	fMap["bend"] 	= new newElementFunctor<k_bend>;
-	fMap["bend-alter"] 	= new newElementFunctor<k_bend_alter>;
-	fMap["bookmark"] 	= new newElementFunctor<k_bookmark>;
-	fMap["bottom-margin"] 	= new newElementFunctor<k_bottom_margin>;
-	fMap["bracket"] 	= new newElementFunctor<k_bracket>;
-	fMap["brass-bend"] 	= new newElementFunctor<k_brass_bend>;
-	fMap["breath-mark"] 	= new newElementFunctor<k_breath_mark>;
-	fMap["caesura"] 	= new newElementFunctor<k_caesura>;
-	fMap["cancel"] 	= new newElementFunctor<k_cancel>;
-	fMap["capo"] 	= new newElementFunctor<k_capo>;
-	fMap["chord"] 	= new newElementFunctor<k_chord>;
-	fMap["chromatic"] 	= new newElementFunctor<k_chromatic>;
-	fMap["circular-arrow"] 	= new newElementFunctor<k_circular_arrow>;
-	fMap["clef"] 	= new newElementFunctor<k_clef>;
-	fMap["clef-octave-change"] 	= new newElementFunctor<k_clef_octave_change>;
-	fMap["coda"] 	= new newElementFunctor<k_coda>;
-	fMap["concert-score"] 	= new newElementFunctor<k_concert_score>;
-	fMap["creator"] 	= new newElementFunctor<k_creator>;
-	fMap["credit"] 	= new newElementFunctor<k_credit>;
-	fMap["credit-image"] 	= new newElementFunctor<k_credit_image>;
-	fMap["credit-symbol"] 	= new newElementFunctor<k_credit_symbol>;
-	fMap["credit-type"] 	= new newElementFunctor<k_credit_type>;
-	fMap["credit-words"] 	= new newElementFunctor<k_credit_words>;
-	fMap["cue"] 	= new newElementFunctor<k_cue>;
-	fMap["damp"] 	= new newElementFunctor<k_damp>;
-	fMap["damp-all"] 	= new newElementFunctor<k_damp_all>;
-	fMap["dashes"] 	= new newElementFunctor<k_dashes>;
-	fMap["defaults"] 	= new newElementFunctor<k_defaults>;
-	fMap["degree"] 	= new newElementFunctor<k_degree>;
-	fMap["degree-alter"] 	= new newElementFunctor<k_degree_alter>;
-	fMap["degree-type"] 	= new newElementFunctor<k_degree_type>;
-	fMap["degree-value"] 	= new newElementFunctor<k_degree_value>;
-	fMap["delayed-inverted-turn"] 	= new newElementFunctor<k_delayed_inverted_turn>;
-	fMap["delayed-turn"] 	= new newElementFunctor<k_delayed_turn>;
-	fMap["detached-legato"] 	= new newElementFunctor<k_detached_legato>;
-	fMap["diatonic"] 	= new newElementFunctor<k_diatonic>;
-	fMap["direction"] 	= new newElementFunctor<k_direction>;
-	fMap["direction-type"] 	= new newElementFunctor<k_direction_type>;
-	fMap["directive"] 	= new newElementFunctor<k_directive>;
-	fMap["display-octave"] 	= new newElementFunctor<k_display_octave>;
-	fMap["display-step"] 	= new newElementFunctor<k_display_step>;
-	fMap["display-text"] 	= new newElementFunctor<k_display_text>;
-	fMap["distance"] 	= new newElementFunctor<k_distance>;
-	fMap["divisions"] 	= new newElementFunctor<k_divisions>;
-	fMap["doit"] 	= new newElementFunctor<k_doit>;
-	fMap["dot"] 	= new newElementFunctor<k_dot>;
-	fMap["double"] 	= new newElementFunctor<k_double>;
-	fMap["double-tongue"] 	= new newElementFunctor<k_double_tongue>;
-	fMap["down-bow"] 	= new newElementFunctor<k_down_bow>;
-	fMap["duration"] 	= new newElementFunctor<k_duration>;
-	fMap["dynamics"] 	= new newElementFunctor<k_dynamics>;
-	fMap["effect"] 	= new newElementFunctor<k_effect>;
-	fMap["elevation"] 	= new newElementFunctor<k_elevation>;
-	fMap["elision"] 	= new newElementFunctor<k_elision>;
-	fMap["encoder"] 	= new newElementFunctor<k_encoder>;
-	fMap["encoding"] 	= new newElementFunctor<k_encoding>;
-	fMap["encoding-date"] 	= new newElementFunctor<k_encoding_date>;
-	fMap["encoding-description"] 	= new newElementFunctor<k_encoding_description>;
-	fMap["end-line"] 	= new newElementFunctor<k_end_line>;
-	fMap["end-paragraph"] 	= new newElementFunctor<k_end_paragraph>;
-	fMap["ending"] 	= new newElementFunctor<k_ending>;
-	fMap["ensemble"] 	= new newElementFunctor<k_ensemble>;
-	fMap["except-voice"] 	= new newElementFunctor<k_except_voice>;
-	fMap["extend"] 	= new newElementFunctor<k_extend>;
-	fMap["eyeglasses"] 	= new newElementFunctor<k_eyeglasses>;
-	fMap["f"] 	= new newElementFunctor<k_f>;
-	fMap["falloff"] 	= new newElementFunctor<k_falloff>;
-	fMap["feature"] 	= new newElementFunctor<k_feature>;
-	fMap["fermata"] 	= new newElementFunctor<k_fermata>;
-	fMap["ff"] 	= new newElementFunctor<k_ff>;
-	fMap["fff"] 	= new newElementFunctor<k_fff>;
-	fMap["ffff"] 	= new newElementFunctor<k_ffff>;
-	fMap["fffff"] 	= new newElementFunctor<k_fffff>;
-	fMap["ffffff"] 	= new newElementFunctor<k_ffffff>;
-	fMap["fifths"] 	= new newElementFunctor<k_fifths>;
-	fMap["figure"] 	= new newElementFunctor<k_figure>;
-	fMap["figure-number"] 	= new newElementFunctor<k_figure_number>;
-	fMap["figured-bass"] 	= new newElementFunctor<k_figured_bass>;
-	fMap["fingering"] 	= new newElementFunctor<k_fingering>;
-	fMap["fingernails"] 	= new newElementFunctor<k_fingernails>;
-	fMap["first"] 	= new newElementFunctor<k_first>;
-	fMap["first-fret"] 	= new newElementFunctor<k_first_fret>;
-	fMap["flip"] 	= new newElementFunctor<k_flip>;
-	fMap["footnote"] 	= new newElementFunctor<k_footnote>;
-	fMap["for-part"] 	= new newElementFunctor<k_for_part>;
-	fMap["forward"] 	= new newElementFunctor<k_forward>;
-	fMap["fp"] 	= new newElementFunctor<k_fp>;
-	fMap["frame"] 	= new newElementFunctor<k_frame>;
-	fMap["frame-frets"] 	= new newElementFunctor<k_frame_frets>;
-	fMap["frame-note"] 	= new newElementFunctor<k_frame_note>;
-	fMap["frame-strings"] 	= new newElementFunctor<k_frame_strings>;
-	fMap["fret"] 	= new newElementFunctor<k_fret>;
-	fMap["function"] 	= new newElementFunctor<k_function>;
-	fMap["fz"] 	= new newElementFunctor<k_fz>;
-	fMap["glass"] 	= new newElementFunctor<k_glass>;
-	fMap["glissando"] 	= new newElementFunctor<k_glissando>;
-	fMap["glyph"] 	= new newElementFunctor<k_glyph>;
-	fMap["golpe"] 	= new newElementFunctor<k_golpe>;
-	fMap["grace"] 	= new newElementFunctor<k_grace>;
-	fMap["group"] 	= new newElementFunctor<k_group>;
-	fMap["group-abbreviation"] 	= new newElementFunctor<k_group_abbreviation>;
-	fMap["group-abbreviation-display"] 	= new newElementFunctor<k_group_abbreviation_display>;
-	fMap["group-barline"] 	= new newElementFunctor<k_group_barline>;
-	fMap["group-link"] 	= new newElementFunctor<k_group_link>;
-	fMap["group-name"] 	= new newElementFunctor<k_group_name>;
-	fMap["group-name-display"] 	= new newElementFunctor<k_group_name_display>;
-	fMap["group-symbol"] 	= new newElementFunctor<k_group_symbol>;
-	fMap["group-time"] 	= new newElementFunctor<k_group_time>;
-	fMap["grouping"] 	= new newElementFunctor<k_grouping>;
-	fMap["half-muted"] 	= new newElementFunctor<k_half_muted>;
-	fMap["hammer-on"] 	= new newElementFunctor<k_hammer_on>;
-	fMap["handbell"] 	= new newElementFunctor<k_handbell>;
-	fMap["harmon-closed"] 	= new newElementFunctor<k_harmon_closed>;
-	fMap["harmon-mute"] 	= new newElementFunctor<k_harmon_mute>;
-	fMap["harmonic"] 	= new newElementFunctor<k_harmonic>;
-	fMap["harmony"] 	= new newElementFunctor<k_harmony>;
-	fMap["harp-pedals"] 	= new newElementFunctor<k_harp_pedals>;
-	fMap["haydn"] 	= new newElementFunctor<k_haydn>;
-	fMap["heel"] 	= new newElementFunctor<k_heel>;
-	fMap["hole"] 	= new newElementFunctor<k_hole>;
-	fMap["hole-closed"] 	= new newElementFunctor<k_hole_closed>;
-	fMap["hole-shape"] 	= new newElementFunctor<k_hole_shape>;
-	fMap["hole-type"] 	= new newElementFunctor<k_hole_type>;
-	fMap["humming"] 	= new newElementFunctor<k_humming>;
-	fMap["identification"] 	= new newElementFunctor<k_identification>;
-	fMap["image"] 	= new newElementFunctor<k_image>;
-	fMap["instrument"] 	= new newElementFunctor<k_instrument>;
-	fMap["instrument-abbreviation"] 	= new newElementFunctor<k_instrument_abbreviation>;
-	fMap["instrument-change"] 	= new newElementFunctor<k_instrument_change>;
-	fMap["instrument-link"] 	= new newElementFunctor<k_instrument_link>;
-	fMap["instrument-name"] 	= new newElementFunctor<k_instrument_name>;
-	fMap["instrument-sound"] 	= new newElementFunctor<k_instrument_sound>;
-	fMap["instruments"] 	= new newElementFunctor<k_instruments>;
-	fMap["interchangeable"] 	= new newElementFunctor<k_interchangeable>;
-	fMap["inversion"] 	= new newElementFunctor<k_inversion>;
-	fMap["inverted-mordent"] 	= new newElementFunctor<k_inverted_mordent>;
-	fMap["inverted-turn"] 	= new newElementFunctor<k_inverted_turn>;
-	fMap["inverted-vertical-turn"] 	= new newElementFunctor<k_inverted_vertical_turn>;
-	fMap["ipa"] 	= new newElementFunctor<k_ipa>;
-	fMap["key"] 	= new newElementFunctor<k_key>;
-	fMap["key-accidental"] 	= new newElementFunctor<k_key_accidental>;
-	fMap["key-alter"] 	= new newElementFunctor<k_key_alter>;
-	fMap["key-octave"] 	= new newElementFunctor<k_key_octave>;
-	fMap["key-step"] 	= new newElementFunctor<k_key_step>;
-	fMap["kind"] 	= new newElementFunctor<k_kind>;
-	fMap["laughing"] 	= new newElementFunctor<k_laughing>;
-	fMap["left-divider"] 	= new newElementFunctor<k_left_divider>;
-	fMap["left-margin"] 	= new newElementFunctor<k_left_margin>;
-	fMap["level"] 	= new newElementFunctor<k_level>;
-	fMap["line"] 	= new newElementFunctor<k_line>;
-	fMap["line-detail"] 	= new newElementFunctor<k_line_detail>;
-	fMap["line-width"] 	= new newElementFunctor<k_line_width>;
-	fMap["link"] 	= new newElementFunctor<k_link>;
-	fMap["listen"] 	= new newElementFunctor<k_listen>;
-	fMap["listening"] 	= new newElementFunctor<k_listening>;
-	fMap["lyric"] 	= new newElementFunctor<k_lyric>;
-	fMap["lyric-font"] 	= new newElementFunctor<k_lyric_font>;
-	fMap["lyric-language"] 	= new newElementFunctor<k_lyric_language>;
-	fMap["measure"] 	= new newElementFunctor<k_measure>;
-	fMap["measure-distance"] 	= new newElementFunctor<k_measure_distance>;
-	fMap["measure-layout"] 	= new newElementFunctor<k_measure_layout>;
-	fMap["measure-numbering"] 	= new newElementFunctor<k_measure_numbering>;
-	fMap["measure-repeat"] 	= new newElementFunctor<k_measure_repeat>;
-	fMap["measure-style"] 	= new newElementFunctor<k_measure_style>;
-	fMap["membrane"] 	= new newElementFunctor<k_membrane>;
-	fMap["metal"] 	= new newElementFunctor<k_metal>;
-	fMap["metronome"] 	= new newElementFunctor<k_metronome>;
-	fMap["metronome-arrows"] 	= new newElementFunctor<k_metronome_arrows>;
-	fMap["metronome-beam"] 	= new newElementFunctor<k_metronome_beam>;
-	fMap["metronome-dot"] 	= new newElementFunctor<k_metronome_dot>;
-	fMap["metronome-note"] 	= new newElementFunctor<k_metronome_note>;
-	fMap["metronome-relation"] 	= new newElementFunctor<k_metronome_relation>;
-	fMap["metronome-tied"] 	= new newElementFunctor<k_metronome_tied>;
-	fMap["metronome-tuplet"] 	= new newElementFunctor<k_metronome_tuplet>;
-	fMap["metronome-type"] 	= new newElementFunctor<k_metronome_type>;
-	fMap["mf"] 	= new newElementFunctor<k_mf>;
-	fMap["midi-bank"] 	= new newElementFunctor<k_midi_bank>;
-	fMap["midi-channel"] 	= new newElementFunctor<k_midi_channel>;
-	fMap["midi-device"] 	= new newElementFunctor<k_midi_device>;
-	fMap["midi-instrument"] 	= new newElementFunctor<k_midi_instrument>;
-	fMap["midi-name"] 	= new newElementFunctor<k_midi_name>;
-	fMap["midi-program"] 	= new newElementFunctor<k_midi_program>;
-	fMap["midi-unpitched"] 	= new newElementFunctor<k_midi_unpitched>;
-	fMap["millimeters"] 	= new newElementFunctor<k_millimeters>;
-	fMap["miscellaneous"] 	= new newElementFunctor<k_miscellaneous>;
-	fMap["miscellaneous-field"] 	= new newElementFunctor<k_miscellaneous_field>;
-	fMap["mode"] 	= new newElementFunctor<k_mode>;
-	fMap["mordent"] 	= new newElementFunctor<k_mordent>;
-	fMap["movement-number"] 	= new newElementFunctor<k_movement_number>;
-	fMap["movement-title"] 	= new newElementFunctor<k_movement_title>;
-	fMap["mp"] 	= new newElementFunctor<k_mp>;
-	fMap["multiple-rest"] 	= new newElementFunctor<k_multiple_rest>;
-	fMap["music-font"] 	= new newElementFunctor<k_music_font>;
-	fMap["mute"] 	= new newElementFunctor<k_mute>;
-	fMap["n"] 	= new newElementFunctor<k_n>;
-	fMap["natural"] 	= new newElementFunctor<k_natural>;
-	fMap["non-arpeggiate"] 	= new newElementFunctor<k_non_arpeggiate>;
-	fMap["normal-dot"] 	= new newElementFunctor<k_normal_dot>;
-	fMap["normal-notes"] 	= new newElementFunctor<k_normal_notes>;
-	fMap["normal-type"] 	= new newElementFunctor<k_normal_type>;
-	fMap["notations"] 	= new newElementFunctor<k_notations>;
-	fMap["note"] 	= new newElementFunctor<k_note>;
-	fMap["note-size"] 	= new newElementFunctor<k_note_size>;
-	fMap["notehead"] 	= new newElementFunctor<k_notehead>;
-	fMap["notehead-text"] 	= new newElementFunctor<k_notehead_text>;
-	fMap["numeral"] 	= new newElementFunctor<k_numeral>;
-	fMap["numeral-alter"] 	= new newElementFunctor<k_numeral_alter>;
-	fMap["numeral-fifths"] 	= new newElementFunctor<k_numeral_fifths>;
-	fMap["numeral-key"] 	= new newElementFunctor<k_numeral_key>;
-	fMap["numeral-mode"] 	= new newElementFunctor<k_numeral_mode>;
-	fMap["numeral-root"] 	= new newElementFunctor<k_numeral_root>;
-	fMap["octave"] 	= new newElementFunctor<k_octave>;
-	fMap["octave-change"] 	= new newElementFunctor<k_octave_change>;
-	fMap["octave-shift"] 	= new newElementFunctor<k_octave_shift>;
-	fMap["offset"] 	= new newElementFunctor<k_offset>;
-	fMap["open"] 	= new newElementFunctor<k_open>;
-	fMap["open-string"] 	= new newElementFunctor<k_open_string>;
-	fMap["opus"] 	= new newElementFunctor<k_opus>;
-	fMap["ornaments"] 	= new newElementFunctor<k_ornaments>;
-	fMap["other-appearance"] 	= new newElementFunctor<k_other_appearance>;
-	fMap["other-articulation"] 	= new newElementFunctor<k_other_articulation>;
-	fMap["other-direction"] 	= new newElementFunctor<k_other_direction>;
-	fMap["other-dynamics"] 	= new newElementFunctor<k_other_dynamics>;
-	fMap["other-listen"] 	= new newElementFunctor<k_other_listen>;
-	fMap["other-listening"] 	= new newElementFunctor<k_other_listening>;
-	fMap["other-notation"] 	= new newElementFunctor<k_other_notation>;
-	fMap["other-ornament"] 	= new newElementFunctor<k_other_ornament>;
-	fMap["other-percussion"] 	= new newElementFunctor<k_other_percussion>;
-	fMap["other-play"] 	= new newElementFunctor<k_other_play>;
-	fMap["other-technical"] 	= new newElementFunctor<k_other_technical>;
-	fMap["p"] 	= new newElementFunctor<k_p>;
-	fMap["page-height"] 	= new newElementFunctor<k_page_height>;
-	fMap["page-layout"] 	= new newElementFunctor<k_page_layout>;
-	fMap["page-margins"] 	= new newElementFunctor<k_page_margins>;
-	fMap["page-width"] 	= new newElementFunctor<k_page_width>;
-	fMap["pan"] 	= new newElementFunctor<k_pan>;
-	fMap["part"] 	= new newElementFunctor<k_part>;
-	fMap["part-abbreviation"] 	= new newElementFunctor<k_part_abbreviation>;
-	fMap["part-abbreviation-display"] 	= new newElementFunctor<k_part_abbreviation_display>;
-	fMap["part-clef"] 	= new newElementFunctor<k_part_clef>;
-	fMap["part-group"] 	= new newElementFunctor<k_part_group>;
-	fMap["part-link"] 	= new newElementFunctor<k_part_link>;
-	fMap["part-list"] 	= new newElementFunctor<k_part_list>;
-	fMap["part-name"] 	= new newElementFunctor<k_part_name>;
-	fMap["part-name-display"] 	= new newElementFunctor<k_part_name_display>;
-	fMap["part-symbol"] 	= new newElementFunctor<k_part_symbol>;
-	fMap["part-transpose"] 	= new newElementFunctor<k_part_transpose>;
-	fMap["pedal"] 	= new newElementFunctor<k_pedal>;
-	fMap["pedal-alter"] 	= new newElementFunctor<k_pedal_alter>;
-	fMap["pedal-step"] 	= new newElementFunctor<k_pedal_step>;
-	fMap["pedal-tuning"] 	= new newElementFunctor<k_pedal_tuning>;
-	fMap["per-minute"] 	= new newElementFunctor<k_per_minute>;
-	fMap["percussion"] 	= new newElementFunctor<k_percussion>;
-	fMap["pf"] 	= new newElementFunctor<k_pf>;
-	fMap["pitch"] 	= new newElementFunctor<k_pitch>;
-	fMap["pitched"] 	= new newElementFunctor<k_pitched>;
-	fMap["play"] 	= new newElementFunctor<k_play>;
-	fMap["player"] 	= new newElementFunctor<k_player>;
-	fMap["player-name"] 	= new newElementFunctor<k_player_name>;
-	fMap["plop"] 	= new newElementFunctor<k_plop>;
-	fMap["pluck"] 	= new newElementFunctor<k_pluck>;
-	fMap["pp"] 	= new newElementFunctor<k_pp>;
-	fMap["ppp"] 	= new newElementFunctor<k_ppp>;
-	fMap["pppp"] 	= new newElementFunctor<k_pppp>;
-	fMap["ppppp"] 	= new newElementFunctor<k_ppppp>;
-	fMap["pppppp"] 	= new newElementFunctor<k_pppppp>;
-	fMap["pre-bend"] 	= new newElementFunctor<k_pre_bend>;
-	fMap["prefix"] 	= new newElementFunctor<k_prefix>;
-	fMap["principal-voice"] 	= new newElementFunctor<k_principal_voice>;
-	fMap["print"] 	= new newElementFunctor<k_print>;
-	fMap["pull-off"] 	= new newElementFunctor<k_pull_off>;
-	fMap["rehearsal"] 	= new newElementFunctor<k_rehearsal>;
-	fMap["relation"] 	= new newElementFunctor<k_relation>;
-	fMap["release"] 	= new newElementFunctor<k_release>;
-	fMap["repeat"] 	= new newElementFunctor<k_repeat>;
-	fMap["rest"] 	= new newElementFunctor<k_rest>;
-	fMap["rf"] 	= new newElementFunctor<k_rf>;
-	fMap["rfz"] 	= new newElementFunctor<k_rfz>;
-	fMap["right-divider"] 	= new newElementFunctor<k_right_divider>;
-	fMap["right-margin"] 	= new newElementFunctor<k_right_margin>;
-	fMap["rights"] 	= new newElementFunctor<k_rights>;
-	fMap["root"] 	= new newElementFunctor<k_root>;
-	fMap["root-alter"] 	= new newElementFunctor<k_root_alter>;
-	fMap["root-step"] 	= new newElementFunctor<k_root_step>;
-	fMap["scaling"] 	= new newElementFunctor<k_scaling>;
-	fMap["schleifer"] 	= new newElementFunctor<k_schleifer>;
-	fMap["scoop"] 	= new newElementFunctor<k_scoop>;
-	fMap["scordatura"] 	= new newElementFunctor<k_scordatura>;
-	fMap["score-instrument"] 	= new newElementFunctor<k_score_instrument>;
-	fMap["score-part"] 	= new newElementFunctor<k_score_part>;
-	fMap["score-partwise"] 	= new newElementFunctor<k_score_partwise>;
-	fMap["score-timewise"] 	= new newElementFunctor<k_score_timewise>;
-	fMap["second"] 	= new newElementFunctor<k_second>;
-	fMap["segno"] 	= new newElementFunctor<k_segno>;
-	fMap["semi-pitched"] 	= new newElementFunctor<k_semi_pitched>;
-	fMap["senza-misura"] 	= new newElementFunctor<k_senza_misura>;
-	fMap["sf"] 	= new newElementFunctor<k_sf>;
-	fMap["sffz"] 	= new newElementFunctor<k_sffz>;
-	fMap["sfp"] 	= new newElementFunctor<k_sfp>;
-	fMap["sfpp"] 	= new newElementFunctor<k_sfpp>;
-	fMap["sfz"] 	= new newElementFunctor<k_sfz>;
-	fMap["sfzp"] 	= new newElementFunctor<k_sfzp>;
-	fMap["shake"] 	= new newElementFunctor<k_shake>;
-	fMap["sign"] 	= new newElementFunctor<k_sign>;
-	fMap["slash"] 	= new newElementFunctor<k_slash>;
-	fMap["slash-dot"] 	= new newElementFunctor<k_slash_dot>;
-	fMap["slash-type"] 	= new newElementFunctor<k_slash_type>;
-	fMap["slide"] 	= new newElementFunctor<k_slide>;
-	fMap["slur"] 	= new newElementFunctor<k_slur>;
-	fMap["smear"] 	= new newElementFunctor<k_smear>;
-	fMap["snap-pizzicato"] 	= new newElementFunctor<k_snap_pizzicato>;
-	fMap["soft-accent"] 	= new newElementFunctor<k_soft_accent>;
-	fMap["software"] 	= new newElementFunctor<k_software>;
-	fMap["solo"] 	= new newElementFunctor<k_solo>;
-	fMap["sound"] 	= new newElementFunctor<k_sound>;
-	fMap["sounding-pitch"] 	= new newElementFunctor<k_sounding_pitch>;
-	fMap["source"] 	= new newElementFunctor<k_source>;
-	fMap["spiccato"] 	= new newElementFunctor<k_spiccato>;
-	fMap["staccatissimo"] 	= new newElementFunctor<k_staccatissimo>;
-	fMap["staccato"] 	= new newElementFunctor<k_staccato>;
-	fMap["staff"] 	= new newElementFunctor<k_staff>;
-	fMap["staff-details"] 	= new newElementFunctor<k_staff_details>;
-	fMap["staff-distance"] 	= new newElementFunctor<k_staff_distance>;
-	fMap["staff-divide"] 	= new newElementFunctor<k_staff_divide>;
-	fMap["staff-layout"] 	= new newElementFunctor<k_staff_layout>;
-	fMap["staff-lines"] 	= new newElementFunctor<k_staff_lines>;
-	fMap["staff-size"] 	= new newElementFunctor<k_staff_size>;
-	fMap["staff-tuning"] 	= new newElementFunctor<k_staff_tuning>;
-	fMap["staff-type"] 	= new newElementFunctor<k_staff_type>;
-	fMap["staves"] 	= new newElementFunctor<k_staves>;
-	fMap["stem"] 	= new newElementFunctor<k_stem>;
-	fMap["step"] 	= new newElementFunctor<k_step>;
-	fMap["stick"] 	= new newElementFunctor<k_stick>;
-	fMap["stick-location"] 	= new newElementFunctor<k_stick_location>;
-	fMap["stick-material"] 	= new newElementFunctor<k_stick_material>;
-	fMap["stick-type"] 	= new newElementFunctor<k_stick_type>;
-	fMap["stopped"] 	= new newElementFunctor<k_stopped>;
-	fMap["straight"] 	= new newElementFunctor<k_straight>;
-	fMap["stress"] 	= new newElementFunctor<k_stress>;
-	fMap["string"] 	= new newElementFunctor<k_string>;
-	fMap["string-mute"] 	= new newElementFunctor<k_string_mute>;
-	fMap["strong-accent"] 	= new newElementFunctor<k_strong_accent>;
-	fMap["suffix"] 	= new newElementFunctor<k_suffix>;
-	fMap["supports"] 	= new newElementFunctor<k_supports>;
-	fMap["swing"] 	= new newElementFunctor<k_swing>;
-	fMap["swing-style"] 	= new newElementFunctor<k_swing_style>;
-	fMap["swing-type"] 	= new newElementFunctor<k_swing_type>;
-	fMap["syllabic"] 	= new newElementFunctor<k_syllabic>;
-	fMap["symbol"] 	= new newElementFunctor<k_symbol>;
-	fMap["sync"] 	= new newElementFunctor<k_sync>;
-	fMap["system-distance"] 	= new newElementFunctor<k_system_distance>;
-	fMap["system-dividers"] 	= new newElementFunctor<k_system_dividers>;
-	fMap["system-layout"] 	= new newElementFunctor<k_system_layout>;
-	fMap["system-margins"] 	= new newElementFunctor<k_system_margins>;
-	fMap["tap"] 	= new newElementFunctor<k_tap>;
-	fMap["technical"] 	= new newElementFunctor<k_technical>;
-	fMap["tenths"] 	= new newElementFunctor<k_tenths>;
-	fMap["tenuto"] 	= new newElementFunctor<k_tenuto>;
-	fMap["text"] 	= new newElementFunctor<k_text>;
-	fMap["thumb-position"] 	= new newElementFunctor<k_thumb_position>;
-	fMap["tie"] 	= new newElementFunctor<k_tie>;
-	fMap["tied"] 	= new newElementFunctor<k_tied>;
-	fMap["time"] 	= new newElementFunctor<k_time>;
-	fMap["time-modification"] 	= new newElementFunctor<k_time_modification>;
-	fMap["time-relation"] 	= new newElementFunctor<k_time_relation>;
-	fMap["timpani"] 	= new newElementFunctor<k_timpani>;
-	fMap["toe"] 	= new newElementFunctor<k_toe>;
-	fMap["top-margin"] 	= new newElementFunctor<k_top_margin>;
-	fMap["top-system-distance"] 	= new newElementFunctor<k_top_system_distance>;
-	fMap["touching-pitch"] 	= new newElementFunctor<k_touching_pitch>;
-	fMap["transpose"] 	= new newElementFunctor<k_transpose>;
-	fMap["tremolo"] 	= new newElementFunctor<k_tremolo>;
-	fMap["trill-mark"] 	= new newElementFunctor<k_trill_mark>;
-	fMap["triple-tongue"] 	= new newElementFunctor<k_triple_tongue>;
-	fMap["tuning-alter"] 	= new newElementFunctor<k_tuning_alter>;
-	fMap["tuning-octave"] 	= new newElementFunctor<k_tuning_octave>;
-	fMap["tuning-step"] 	= new newElementFunctor<k_tuning_step>;
-	fMap["tuplet"] 	= new newElementFunctor<k_tuplet>;
-	fMap["tuplet-actual"] 	= new newElementFunctor<k_tuplet_actual>;
-	fMap["tuplet-dot"] 	= new newElementFunctor<k_tuplet_dot>;
-	fMap["tuplet-normal"] 	= new newElementFunctor<k_tuplet_normal>;
-	fMap["tuplet-number"] 	= new newElementFunctor<k_tuplet_number>;
-	fMap["tuplet-type"] 	= new newElementFunctor<k_tuplet_type>;
-	fMap["turn"] 	= new newElementFunctor<k_turn>;
-	fMap["type"] 	= new newElementFunctor<k_type>;
-	fMap["unpitched"] 	= new newElementFunctor<k_unpitched>;
-	fMap["unstress"] 	= new newElementFunctor<k_unstress>;
-	fMap["up-bow"] 	= new newElementFunctor<k_up_bow>;
-	fMap["vertical-turn"] 	= new newElementFunctor<k_vertical_turn>;
-	fMap["virtual-instrument"] 	= new newElementFunctor<k_virtual_instrument>;
-	fMap["virtual-library"] 	= new newElementFunctor<k_virtual_library>;
-	fMap["virtual-name"] 	= new newElementFunctor<k_virtual_name>;
-	fMap["voice"] 	= new newElementFunctor<k_voice>;
-	fMap["volume"] 	= new newElementFunctor<k_volume>;
-	fMap["wait"] 	= new newElementFunctor<k_wait>;
-	fMap["wavy-line"] 	= new newElementFunctor<k_wavy_line>;
-	fMap["wedge"] 	= new newElementFunctor<k_wedge>;
-	fMap["with-bar"] 	= new newElementFunctor<k_with_bar>;
-	fMap["wood"] 	= new newElementFunctor<k_wood>;
-	fMap["word-font"] 	= new newElementFunctor<k_word_font>;
-	fMap["words"] 	= new newElementFunctor<k_words>;
-	fMap["work"] 	= new newElementFunctor<k_work>;
-	fMap["work-number"] 	= new newElementFunctor<k_work_number>;
-	fMap["work-title"] 	= new newElementFunctor<k_work_title>;
+	fConstructors[k_accent] 	= newElement<k_accent>;
+	fConstructors[k_accidental] 	= newElement<k_accidental>;
+	fConstructors[k_accidental_mark] 	= newElement<k_accidental_mark>;
+	fConstructors[k_accidental_text] 	= newElement<k_accidental_text>;
+	fConstructors[k_accord] 	= newElement<k_accord>;
+	fConstructors[k_accordion_high] 	= newElement<k_accordion_high>;
+	fConstructors[k_accordion_low] 	= newElement<k_accordion_low>;
+	fConstructors[k_accordion_middle] 	= newElement<k_accordion_middle>;
+	fConstructors[k_accordion_registration] 	= newElement<k_accordion_registration>;
+	fConstructors[k_actual_notes] 	= newElement<k_actual_notes>;
+	fConstructors[k_alter] 	= newElement<k_alter>;
+	fConstructors[k_appearance] 	= newElement<k_appearance>;
+	fConstructors[k_arpeggiate] 	= newElement<k_arpeggiate>;
+	fConstructors[k_arrow] 	= newElement<k_arrow>;
+	fConstructors[k_arrow_direction] 	= newElement<k_arrow_direction>;
+	fConstructors[k_arrow_style] 	= newElement<k_arrow_style>;
+	fConstructors[k_arrowhead] 	= newElement<k_arrowhead>;
+	fConstructors[k_articulations] 	= newElement<k_articulations>;
+	fConstructors[k_artificial] 	= newElement<k_artificial>;
+	fConstructors[k_assess] 	= newElement<k_assess>;
+	fConstructors[k_attributes] 	= newElement<k_attributes>;
+	fConstructors[k_backup] 	= newElement<k_backup>;
+	fConstructors[k_bar_style] 	= newElement<k_bar_style>;
+	fConstructors[k_barline] 	= newElement<k_barline>;
+	fConstructors[k_barre] 	= newElement<k_barre>;
+	fConstructors[k_base_pitch] 	= newElement<k_base_pitch>;
+	fConstructors[k_bass] 	= newElement<k_bass>;
+	fConstructors[k_bass_alter] 	= newElement<k_bass_alter>;
+	fConstructors[k_bass_separator] 	= newElement<k_bass_separator>;
+	fConstructors[k_bass_step] 	= newElement<k_bass_step>;
+	fConstructors[k_beam] 	= newElement<k_beam>;
+	fConstructors[k_beat_repeat] 	= newElement<k_beat_repeat>;
+	fConstructors[k_beat_type] 	= newElement<k_beat_type>;
+	fConstructors[k_beat_unit] 	= newElement<k_beat_unit>;
+	fConstructors[k_beat_unit_dot] 	= newElement<k_beat_unit_dot>;
+	fConstructors[k_beat_unit_tied] 	= newElement<k_beat_unit_tied>;
+	fConstructors[k_beater] 	= newElement<k_beater>;
+	fConstructors[k_beats] 	= newElement<k_beats>;
+	fConstructors[k_bend] 	= newElement<k_bend>;
+	fConstructors[k_bend_alter] 	= newElement<k_bend_alter>;
+	fConstructors[k_bookmark] 	= newElement<k_bookmark>;
+	fConstructors[k_bottom_margin] 	= newElement<k_bottom_margin>;
+	fConstructors[k_bracket] 	= newElement<k_bracket>;
+	fConstructors[k_brass_bend] 	= newElement<k_brass_bend>;
+	fConstructors[k_breath_mark] 	= newElement<k_breath_mark>;
+	fConstructors[k_caesura] 	= newElement<k_caesura>;
+	fConstructors[k_cancel] 	= newElement<k_cancel>;
+	fConstructors[k_capo] 	= newElement<k_capo>;
+	fConstructors[k_chord] 	= newElement<k_chord>;
+	fConstructors[k_chromatic] 	= newElement<k_chromatic>;
+	fConstructors[k_circular_arrow] 	= newElement<k_circular_arrow>;
+	fConstructors[k_clef] 	= newElement<k_clef>;
+	fConstructors[k_clef_octave_change] 	= newElement<k_clef_octave_change>;
+	fConstructors[k_coda] 	= newElement<k_coda>;
+	fConstructors[k_concert_score] 	= newElement<k_concert_score>;
+	fConstructors[k_creator] 	= newElement<k_creator>;
+	fConstructors[k_credit] 	= newElement<k_credit>;
+	fConstructors[k_credit_image] 	= newElement<k_credit_image>;
+	fConstructors[k_credit_symbol] 	= newElement<k_credit_symbol>;
+	fConstructors[k_credit_type] 	= newElement<k_credit_type>;
+	fConstructors[k_credit_words] 	= newElement<k_credit_words>;
+	fConstructors[k_cue] 	= newElement<k_cue>;
+	fConstructors[k_damp] 	= newElement<k_damp>;
+	fConstructors[k_damp_all] 	= newElement<k_damp_all>;
+	fConstructors[k_dashes] 	= newElement<k_dashes>;
+	fConstructors[k_defaults] 	= newElement<k_defaults>;
+	fConstructors[k_degree] 	= newElement<k_degree>;
+	fConstructors[k_degree_alter] 	= newElement<k_degree_alter>;
+	fConstructors[k_degree_type] 	= newElement<k_degree_type>;
+	fConstructors[k_degree_value] 	= newElement<k_degree_value>;
+	fConstructors[k_delayed_inverted_turn] 	= newElement<k_delayed_inverted_turn>;
+	fConstructors[k_delayed_turn] 	= newElement<k_delayed_turn>;
+	fConstructors[k_detached_legato] 	= newElement<k_detached_legato>;
+	fConstructors[k_diatonic] 	= newElement<k_diatonic>;
+	fConstructors[k_direction] 	= newElement<k_direction>;
+	fConstructors[k_direction_type] 	= newElement<k_direction_type>;
+	fConstructors[k_directive] 	= newElement<k_directive>;
+	fConstructors[k_display_octave] 	= newElement<k_display_octave>;
+	fConstructors[k_display_step] 	= newElement<k_display_step>;
+	fConstructors[k_display_text] 	= newElement<k_display_text>;
+	fConstructors[k_distance] 	= newElement<k_distance>;
+	fConstructors[k_divisions] 	= newElement<k_divisions>;
+	fConstructors[k_doit] 	= newElement<k_doit>;
+	fConstructors[k_dot] 	= newElement<k_dot>;
+	fConstructors[k_double] 	= newElement<k_double>;
+	fConstructors[k_double_tongue] 	= newElement<k_double_tongue>;
+	fConstructors[k_down_bow] 	= newElement<k_down_bow>;
+	fConstructors[k_duration] 	= newElement<k_duration>;
+	fConstructors[k_dynamics] 	= newElement<k_dynamics>;
+	fConstructors[k_effect] 	= newElement<k_effect>;
+	fConstructors[k_elevation] 	= newElement<k_elevation>;
+	fConstructors[k_elision] 	= newElement<k_elision>;
+	fConstructors[k_encoder] 	= newElement<k_encoder>;
+	fConstructors[k_encoding] 	= newElement<k_encoding>;
+	fConstructors[k_encoding_date] 	= newElement<k_encoding_date>;
+	fConstructors[k_encoding_description] 	= newElement<k_encoding_description>;
+	fConstructors[k_end_line] 	= newElement<k_end_line>;
+	fConstructors[k_end_paragraph] 	= newElement<k_end_paragraph>;
+	fConstructors[k_ending] 	= newElement<k_ending>;
+	fConstructors[k_ensemble] 	= newElement<k_ensemble>;
+	fConstructors[k_except_voice] 	= newElement<k_except_voice>;
+	fConstructors[k_extend] 	= newElement<k_extend>;
+	fConstructors[k_eyeglasses] 	= newElement<k_eyeglasses>;
+	fConstructors[k_f] 	= newElement<k_f>;
+	fConstructors[k_falloff] 	= newElement<k_falloff>;
+	fConstructors[k_feature] 	= newElement<k_feature>;
+	fConstructors[k_fermata] 	= newElement<k_fermata>;
+	fConstructors[k_ff] 	= newElement<k_ff>;
+	fConstructors[k_fff] 	= newElement<k_fff>;
+	fConstructors[k_ffff] 	= newElement<k_ffff>;
+	fConstructors[k_fffff] 	= newElement<k_fffff>;
+	fConstructors[k_ffffff] 	= newElement<k_ffffff>;
+	fConstructors[k_fifths] 	= newElement<k_fifths>;
+	fConstructors[k_figure] 	= newElement<k_figure>;
+	fConstructors[k_figure_number] 	= newElement<k_figure_number>;
+	fConstructors[k_figured_bass] 	= newElement<k_figured_bass>;
+	fConstructors[k_fingering] 	= newElement<k_fingering>;
+	fConstructors[k_fingernails] 	= newElement<k_fingernails>;
+	fConstructors[k_first] 	= newElement<k_first>;
+	fConstructors[k_first_fret] 	= newElement<k_first_fret>;
+	fConstructors[k_flip] 	= newElement<k_flip>;
+	fConstructors[k_footnote] 	= newElement<k_footnote>;
+	fConstructors[k_for_part] 	= newElement<k_for_part>;
+	fConstructors[k_forward] 	= newElement<k_forward>;
+	fConstructors[k_fp] 	= newElement<k_fp>;
+	fConstructors[k_frame] 	= newElement<k_frame>;
+	fConstructors[k_frame_frets] 	= newElement<k_frame_frets>;
+	fConstructors[k_frame_note] 	= newElement<k_frame_note>;
+	fConstructors[k_frame_strings] 	= newElement<k_frame_strings>;
+	fConstructors[k_fret] 	= newElement<k_fret>;
+	fConstructors[k_function] 	= newElement<k_function>;
+	fConstructors[k_fz] 	= newElement<k_fz>;
+	fConstructors[k_glass] 	= newElement<k_glass>;
+	fConstructors[k_glissando] 	= newElement<k_glissando>;
+	fConstructors[k_glyph] 	= newElement<k_glyph>;
+	fConstructors[k_golpe] 	= newElement<k_golpe>;
+	fConstructors[k_grace] 	= newElement<k_grace>;
+	fConstructors[k_group] 	= newElement<k_group>;
+	fConstructors[k_group_abbreviation] 	= newElement<k_group_abbreviation>;
+	fConstructors[k_group_abbreviation_display] 	= newElement<k_group_abbreviation_display>;
+	fConstructors[k_group_barline] 	= newElement<k_group_barline>;
+	fConstructors[k_group_link] 	= newElement<k_group_link>;
+	fConstructors[k_group_name] 	= newElement<k_group_name>;
+	fConstructors[k_group_name_display] 	= newElement<k_group_name_display>;
+	fConstructors[k_group_symbol] 	= newElement<k_group_symbol>;
+	fConstructors[k_group_time] 	= newElement<k_group_time>;
+	fConstructors[k_grouping] 	= newElement<k_grouping>;
+	fConstructors[k_half_muted] 	= newElement<k_half_muted>;
+	fConstructors[k_hammer_on] 	= newElement<k_hammer_on>;
+	fConstructors[k_handbell] 	= newElement<k_handbell>;
+	fConstructors[k_harmon_closed] 	= newElement<k_harmon_closed>;
+	fConstructors[k_harmon_mute] 	= newElement<k_harmon_mute>;
+	fConstructors[k_harmonic] 	= newElement<k_harmonic>;
+	fConstructors[k_harmony] 	= newElement<k_harmony>;
+	fConstructors[k_harp_pedals] 	= newElement<k_harp_pedals>;
+	fConstructors[k_haydn] 	= newElement<k_haydn>;
+	fConstructors[k_heel] 	= newElement<k_heel>;
+	fConstructors[k_hole] 	= newElement<k_hole>;
+	fConstructors[k_hole_closed] 	= newElement<k_hole_closed>;
+	fConstructors[k_hole_shape] 	= newElement<k_hole_shape>;
+	fConstructors[k_hole_type] 	= newElement<k_hole_type>;
+	fConstructors[k_humming] 	= newElement<k_humming>;
+	fConstructors[k_identification] 	= newElement<k_identification>;
+	fConstructors[k_image] 	= newElement<k_image>;
+	fConstructors[k_instrument] 	= newElement<k_instrument>;
+	fConstructors[k_instrument_abbreviation] 	= newElement<k_instrument_abbreviation>;
+	fConstructors[k_instrument_change] 	= newElement<k_instrument_change>;
+	fConstructors[k_instrument_link] 	= newElement<k_instrument_link>;
+	fConstructors[k_instrument_name] 	= newElement<k_instrument_name>;
+	fConstructors[k_instrument_sound] 	= newElement<k_instrument_sound>;
+	fConstructors[k_instruments] 	= newElement<k_instruments>;
+	fConstructors[k_interchangeable] 	= newElement<k_interchangeable>;
+	fConstructors[k_inversion] 	= newElement<k_inversion>;
+	fConstructors[k_inverted_mordent] 	= newElement<k_inverted_mordent>;
+	fConstructors[k_inverted_turn] 	= newElement<k_inverted_turn>;
+	fConstructors[k_inverted_vertical_turn] 	= newElement<k_inverted_vertical_turn>;
+	fConstructors[k_ipa] 	= newElement<k_ipa>;
+	fConstructors[k_key] 	= newElement<k_key>;
+	fConstructors[k_key_accidental] 	= newElement<k_key_accidental>;
+	fConstructors[k_key_alter] 	= newElement<k_key_alter>;
+	fConstructors[k_key_octave] 	= newElement<k_key_octave>;
+	fConstructors[k_key_step] 	= newElement<k_key_step>;
+	fConstructors[k_kind] 	= newElement<k_kind>;
+	fConstructors[k_laughing] 	= newElement<k_laughing>;
+	fConstructors[k_left_divider] 	= newElement<k_left_divider>;
+	fConstructors[k_left_margin] 	= newElement<k_left_margin>;
+	fConstructors[k_level] 	= newElement<k_level>;
+	fConstructors[k_line] 	= newElement<k_line>;
+	fConstructors[k_line_detail] 	= newElement<k_line_detail>;
+	fConstructors[k_line_width] 	= newElement<k_line_width>;
+	fConstructors[k_link] 	= newElement<k_link>;
+	fConstructors[k_listen] 	= newElement<k_listen>;
+	fConstructors[k_listening] 	= newElement<k_listening>;
+	fConstructors[k_lyric] 	= newElement<k_lyric>;
+	fConstructors[k_lyric_font] 	= newElement<k_lyric_font>;
+	fConstructors[k_lyric_language] 	= newElement<k_lyric_language>;
+	fConstructors[k_measure] 	= newElement<k_measure>;
+	fConstructors[k_measure_distance] 	= newElement<k_measure_distance>;
+	fConstructors[k_measure_layout] 	= newElement<k_measure_layout>;
+	fConstructors[k_measure_numbering] 	= newElement<k_measure_numbering>;
+	fConstructors[k_measure_repeat] 	= newElement<k_measure_repeat>;
+	fConstructors[k_measure_style] 	= newElement<k_measure_style>;
+	fConstructors[k_membrane] 	= newElement<k_membrane>;
+	fConstructors[k_metal] 	= newElement<k_metal>;
+	fConstructors[k_metronome] 	= newElement<k_metronome>;
+	fConstructors[k_metronome_arrows] 	= newElement<k_metronome_arrows>;
+	fConstructors[k_metronome_beam] 	= newElement<k_metronome_beam>;
+	fConstructors[k_metronome_dot] 	= newElement<k_metronome_dot>;
+	fConstructors[k_metronome_note] 	= newElement<k_metronome_note>;
+	fConstructors[k_metronome_relation] 	= newElement<k_metronome_relation>;
+	fConstructors[k_metronome_tied] 	= newElement<k_metronome_tied>;
+	fConstructors[k_metronome_tuplet] 	= newElement<k_metronome_tuplet>;
+	fConstructors[k_metronome_type] 	= newElement<k_metronome_type>;
+	fConstructors[k_mf] 	= newElement<k_mf>;
+	fConstructors[k_midi_bank] 	= newElement<k_midi_bank>;
+	fConstructors[k_midi_channel] 	= newElement<k_midi_channel>;
+	fConstructors[k_midi_device] 	= newElement<k_midi_device>;
+	fConstructors[k_midi_instrument] 	= newElement<k_midi_instrument>;
+	fConstructors[k_midi_name] 	= newElement<k_midi_name>;
+	fConstructors[k_midi_program] 	= newElement<k_midi_program>;
+	fConstructors[k_midi_unpitched] 	= newElement<k_midi_unpitched>;
+	fConstructors[k_millimeters] 	= newElement<k_millimeters>;
+	fConstructors[k_miscellaneous] 	= newElement<k_miscellaneous>;
+	fConstructors[k_miscellaneous_field] 	= newElement<k_miscellaneous_field>;
+	fConstructors[k_mode] 	= newElement<k_mode>;
+	fConstructors[k_mordent] 	= newElement<k_mordent>;
+	fConstructors[k_movement_number] 	= newElement<k_movement_number>;
+	fConstructors[k_movement_title] 	= newElement<k_movement_title>;
+	fConstructors[k_mp] 	= newElement<k_mp>;
+	fConstructors[k_multiple_rest] 	= newElement<k_multiple_rest>;
+	fConstructors[k_music_font] 	= newElement<k_music_font>;
+	fConstructors[k_mute] 	= newElement<k_mute>;
+	fConstructors[k_n] 	= newElement<k_n>;
+	fConstructors[k_natural] 	= newElement<k_natural>;
+	fConstructors[k_non_arpeggiate] 	= newElement<k_non_arpeggiate>;
+	fConstructors[k_normal_dot] 	= newElement<k_normal_dot>;
+	fConstructors[k_normal_notes] 	= newElement<k_normal_notes>;
+	fConstructors[k_normal_type] 	= newElement<k_normal_type>;
+	fConstructors[k_notations] 	= newElement<k_notations>;
+	fConstructors[k_note] 	= newElement<k_note>;
+	fConstructors[k_note_size] 	= newElement<k_note_size>;
+	fConstructors[k_notehead] 	= newElement<k_notehead>;
+	fConstructors[k_notehead_text] 	= newElement<k_notehead_text>;
+	fConstructors[k_numeral] 	= newElement<k_numeral>;
+	fConstructors[k_numeral_alter] 	= newElement<k_numeral_alter>;
+	fConstructors[k_numeral_fifths] 	= newElement<k_numeral_fifths>;
+	fConstructors[k_numeral_key] 	= newElement<k_numeral_key>;
+	fConstructors[k_numeral_mode] 	= newElement<k_numeral_mode>;
+	fConstructors[k_numeral_root] 	= newElement<k_numeral_root>;
+	fConstructors[k_octave] 	= newElement<k_octave>;
+	fConstructors[k_octave_change] 	= newElement<k_octave_change>;
+	fConstructors[k_octave_shift] 	= newElement<k_octave_shift>;
+	fConstructors[k_offset] 	= newElement<k_offset>;
+	fConstructors[k_open] 	= newElement<k_open>;
+	fConstructors[k_open_string] 	= newElement<k_open_string>;
+	fConstructors[k_opus] 	= newElement<k_opus>;
+	fConstructors[k_ornaments] 	= newElement<k_ornaments>;
+	fConstructors[k_other_appearance] 	= newElement<k_other_appearance>;
+	fConstructors[k_other_articulation] 	= newElement<k_other_articulation>;
+	fConstructors[k_other_direction] 	= newElement<k_other_direction>;
+	fConstructors[k_other_dynamics] 	= newElement<k_other_dynamics>;
+	fConstructors[k_other_listen] 	= newElement<k_other_listen>;
+	fConstructors[k_other_listening] 	= newElement<k_other_listening>;
+	fConstructors[k_other_notation] 	= newElement<k_other_notation>;
+	fConstructors[k_other_ornament] 	= newElement<k_other_ornament>;
+	fConstructors[k_other_percussion] 	= newElement<k_other_percussion>;
+	fConstructors[k_other_play] 	= newElement<k_other_play>;
+	fConstructors[k_other_technical] 	= newElement<k_other_technical>;
+	fConstructors[k_p] 	= newElement<k_p>;
+	fConstructors[k_page_height] 	= newElement<k_page_height>;
+	fConstructors[k_page_layout] 	= newElement<k_page_layout>;
+	fConstructors[k_page_margins] 	= newElement<k_page_margins>;
+	fConstructors[k_page_width] 	= newElement<k_page_width>;
+	fConstructors[k_pan] 	= newElement<k_pan>;
+	fConstructors[k_part] 	= newElement<k_part>;
+	fConstructors[k_part_abbreviation] 	= newElement<k_part_abbreviation>;
+	fConstructors[k_part_abbreviation_display] 	= newElement<k_part_abbreviation_display>;
+	fConstructors[k_part_clef] 	= newElement<k_part_clef>;
+	fConstructors[k_part_group] 	= newElement<k_part_group>;
+	fConstructors[k_part_link] 	= newElement<k_part_link>;
+	fConstructors[k_part_list] 	= newElement<k_part_list>;
+	fConstructors[k_part_name] 	= newElement<k_part_name>;
+	fConstructors[k_part_name_display] 	= newElement<k_part_name_display>;
+	fConstructors[k_part_symbol] 	= newElement<k_part_symbol>;
+	fConstructors[k_part_transpose] 	= newElement<k_part_transpose>;
+	fConstructors[k_pedal] 	= newElement<k_pedal>;
+	fConstructors[k_pedal_alter] 	= newElement<k_pedal_alter>;
+	fConstructors[k_pedal_step] 	= newElement<k_pedal_step>;
+	fConstructors[k_pedal_tuning] 	= newElement<k_pedal_tuning>;
+	fConstructors[k_per_minute] 	= newElement<k_per_minute>;
+	fConstructors[k_percussion] 	= newElement<k_percussion>;
+	fConstructors[k_pf] 	= newElement<k_pf>;
+	fConstructors[k_pitch] 	= newElement<k_pitch>;
+	fConstructors[k_pitched] 	= newElement<k_pitched>;
+	fConstructors[k_play] 	= newElement<k_play>;
+	fConstructors[k_player] 	= newElement<k_player>;
+	fConstructors[k_player_name] 	= newElement<k_player_name>;
+	fConstructors[k_plop] 	= newElement<k_plop>;
+	fConstructors[k_pluck] 	= newElement<k_pluck>;
+	fConstructors[k_pp] 	= newElement<k_pp>;
+	fConstructors[k_ppp] 	= newElement<k_ppp>;
+	fConstructors[k_pppp] 	= newElement<k_pppp>;
+	fConstructors[k_ppppp] 	= newElement<k_ppppp>;
+	fConstructors[k_pppppp] 	= newElement<k_pppppp>;
+	fConstructors[k_pre_bend] 	= newElement<k_pre_bend>;
+	fConstructors[k_prefix] 	= newElement<k_prefix>;
+	fConstructors[k_principal_voice] 	= newElement<k_principal_voice>;
+	fConstructors[k_print] 	= newElement<k_print>;
+	fConstructors[k_pull_off] 	= newElement<k_pull_off>;
+	fConstructors[k_rehearsal] 	= newElement<k_rehearsal>;
+	fConstructors[k_relation] 	= newElement<k_relation>;
+	fConstructors[k_release] 	= newElement<k_release>;
+	fConstructors[k_repeat] 	= newElement<k_repeat>;
+	fConstructors[k_rest] 	= newElement<k_rest>;
+	fConstructors[k_rf] 	= newElement<k_rf>;
+	fConstructors[k_rfz] 	= newElement<k_rfz>;
+	fConstructors[k_right_divider] 	= newElement<k_right_divider>;
+	fConstructors[k_right_margin] 	= newElement<k_right_margin>;
+	fConstructors[k_rights] 	= newElement<k_rights>;
+	fConstructors[k_root] 	= newElement<k_root>;
+	fConstructors[k_root_alter] 	= newElement<k_root_alter>;
+	fConstructors[k_root_step] 	= newElement<k_root_step>;
+	fConstructors[k_scaling] 	= newElement<k_scaling>;
+	fConstructors[k_schleifer] 	= newElement<k_schleifer>;
+	fConstructors[k_scoop] 	= newElement<k_scoop>;
+	fConstructors[k_scordatura] 	= newElement<k_scordatura>;
+	fConstructors[k_score_instrument] 	= newElement<k_score_instrument>;
+	fConstructors[k_score_part] 	= newElement<k_score_part>;
+	fConstructors[k_score_partwise] 	= newElement<k_score_partwise>;
+	fConstructors[k_score_timewise] 	= newElement<k_score_timewise>;
+	fConstructors[k_second] 	= newElement<k_second>;
+	fConstructors[k_segno] 	= newElement<k_segno>;
+	fConstructors[k_semi_pitched] 	= newElement<k_semi_pitched>;
+	fConstructors[k_senza_misura] 	= newElement<k_senza_misura>;
+	fConstructors[k_sf] 	= newElement<k_sf>;
+	fConstructors[k_sffz] 	= newElement<k_sffz>;
+	fConstructors[k_sfp] 	= newElement<k_sfp>;
+	fConstructors[k_sfpp] 	= newElement<k_sfpp>;
+	fConstructors[k_sfz] 	= newElement<k_sfz>;
+	fConstructors[k_sfzp] 	= newElement<k_sfzp>;
+	fConstructors[k_shake] 	= newElement<k_shake>;
+	fConstructors[k_sign] 	= newElement<k_sign>;
+	fConstructors[k_slash] 	= newElement<k_slash>;
+	fConstructors[k_slash_dot] 	= newElement<k_slash_dot>;
+	fConstructors[k_slash_type] 	= newElement<k_slash_type>;
+	fConstructors[k_slide] 	= newElement<k_slide>;
+	fConstructors[k_slur] 	= newElement<k_slur>;
+	fConstructors[k_smear] 	= newElement<k_smear>;
+	fConstructors[k_snap_pizzicato] 	= newElement<k_snap_pizzicato>;
+	fConstructors[k_soft_accent] 	= newElement<k_soft_accent>;
+	fConstructors[k_software] 	= newElement<k_software>;
+	fConstructors[k_solo] 	= newElement<k_solo>;
+	fConstructors[k_sound] 	= newElement<k_sound>;
+	fConstructors[k_sounding_pitch] 	= newElement<k_sounding_pitch>;
+	fConstructors[k_source] 	= newElement<k_source>;
+	fConstructors[k_spiccato] 	= newElement<k_spiccato>;
+	fConstructors[k_staccatissimo] 	= newElement<k_staccatissimo>;
+	fConstructors[k_staccato] 	= newElement<k_staccato>;
+	fConstructors[k_staff] 	= newElement<k_staff>;
+	fConstructors[k_staff_details] 	= newElement<k_staff_details>;
+	fConstructors[k_staff_distance] 	= newElement<k_staff_distance>;
+	fConstructors[k_staff_divide] 	= newElement<k_staff_divide>;
+	fConstructors[k_staff_layout] 	= newElement<k_staff_layout>;
+	fConstructors[k_staff_lines] 	= newElement<k_staff_lines>;
+	fConstructors[k_staff_size] 	= newElement<k_staff_size>;
+	fConstructors[k_staff_tuning] 	= newElement<k_staff_tuning>;
+	fConstructors[k_staff_type] 	= newElement<k_staff_type>;
+	fConstructors[k_staves] 	= newElement<k_staves>;
+	fConstructors[k_stem] 	= newElement<k_stem>;
+	fConstructors[k_step] 	= newElement<k_step>;
+	fConstructors[k_stick] 	= newElement<k_stick>;
+	fConstructors[k_stick_location] 	= newElement<k_stick_location>;
+	fConstructors[k_stick_material] 	= newElement<k_stick_material>;
+	fConstructors[k_stick_type] 	= newElement<k_stick_type>;
+	fConstructors[k_stopped] 	= newElement<k_stopped>;
+	fConstructors[k_straight] 	= newElement<k_straight>;
+	fConstructors[k_stress] 	= newElement<k_stress>;
+	fConstructors[k_string] 	= newElement<k_string>;
+	fConstructors[k_string_mute] 	= newElement<k_string_mute>;
+	fConstructors[k_strong_accent] 	= newElement<k_strong_accent>;
+	fConstructors[k_suffix] 	= newElement<k_suffix>;
+	fConstructors[k_supports] 	= newElement<k_supports>;
+	fConstructors[k_swing] 	= newElement<k_swing>;
+	fConstructors[k_swing_style] 	= newElement<k_swing_style>;
+	fConstructors[k_swing_type] 	= newElement<k_swing_type>;
+	fConstructors[k_syllabic] 	= newElement<k_syllabic>;
+	fConstructors[k_symbol] 	= newElement<k_symbol>;
+	fConstructors[k_sync] 	= newElement<k_sync>;
+	fConstructors[k_system_distance] 	= newElement<k_system_distance>;
+	fConstructors[k_system_dividers] 	= newElement<k_system_dividers>;
+	fConstructors[k_system_layout] 	= newElement<k_system_layout>;
+	fConstructors[k_system_margins] 	= newElement<k_system_margins>;
+	fConstructors[k_tap] 	= newElement<k_tap>;
+	fConstructors[k_technical] 	= newElement<k_technical>;
+	fConstructors[k_tenths] 	= newElement<k_tenths>;
+	fConstructors[k_tenuto] 	= newElement<k_tenuto>;
+	fConstructors[k_text] 	= newElement<k_text>;
+	fConstructors[k_thumb_position] 	= newElement<k_thumb_position>;
+	fConstructors[k_tie] 	= newElement<k_tie>;
+	fConstructors[k_tied] 	= newElement<k_tied>;
+	fConstructors[k_time] 	= newElement<k_time>;
+	fConstructors[k_time_modification] 	= newElement<k_time_modification>;
+	fConstructors[k_time_relation] 	= newElement<k_time_relation>;
+	fConstructors[k_timpani] 	= newElement<k_timpani>;
+	fConstructors[k_toe] 	= newElement<k_toe>;
+	fConstructors[k_top_margin] 	= newElement<k_top_margin>;
+	fConstructors[k_top_system_distance] 	= newElement<k_top_system_distance>;
+	fConstructors[k_touching_pitch] 	= newElement<k_touching_pitch>;
+	fConstructors[k_transpose] 	= newElement<k_transpose>;
+	fConstructors[k_tremolo] 	= newElement<k_tremolo>;
+	fConstructors[k_trill_mark] 	= newElement<k_trill_mark>;
+	fConstructors[k_triple_tongue] 	= newElement<k_triple_tongue>;
+	fConstructors[k_tuning_alter] 	= newElement<k_tuning_alter>;
+	fConstructors[k_tuning_octave] 	= newElement<k_tuning_octave>;
+	fConstructors[k_tuning_step] 	= newElement<k_tuning_step>;
+	fConstructors[k_tuplet] 	= newElement<k_tuplet>;
+	fConstructors[k_tuplet_actual] 	= newElement<k_tuplet_actual>;
+	fConstructors[k_tuplet_dot] 	= newElement<k_tuplet_dot>;
+	fConstructors[k_tuplet_normal] 	= newElement<k_tuplet_normal>;
+	fConstructors[k_tuplet_number] 	= newElement<k_tuplet_number>;
+	fConstructors[k_tuplet_type] 	= newElement<k_tuplet_type>;
+	fConstructors[k_turn] 	= newElement<k_turn>;
+	fConstructors[k_type] 	= newElement<k_type>;
+	fConstructors[k_unpitched] 	= newElement<k_unpitched>;
+	fConstructors[k_unstress] 	= newElement<k_unstress>;
+	fConstructors[k_up_bow] 	= newElement<k_up_bow>;
+	fConstructors[k_vertical_turn] 	= newElement<k_vertical_turn>;
+	fConstructors[k_virtual_instrument] 	= newElement<k_virtual_instrument>;
+	fConstructors[k_virtual_library] 	= newElement<k_virtual_library>;
+	fConstructors[k_virtual_name] 	= newElement<k_virtual_name>;
+	fConstructors[k_voice] 	= newElement<k_voice>;
+	fConstructors[k_volume] 	= newElement<k_volume>;
+	fConstructors[k_wait] 	= newElement<k_wait>;
+	fConstructors[k_wavy_line] 	= newElement<k_wavy_line>;
+	fConstructors[k_wedge] 	= newElement<k_wedge>;
+	fConstructors[k_with_bar] 	= newElement<k_with_bar>;
+	fConstructors[k_wood] 	= newElement<k_wood>;
+	fConstructors[k_word_font] 	= newElement<k_word_font>;
+	fConstructors[k_words] 	= newElement<k_words>;
+	fConstructors[k_work] 	= newElement<k_work>;
+	fConstructors[k_work_number] 	= newElement<k_work_number>;
+	fConstructors[k_work_title] 	= newElement<k_work_title>;
 
-	fType2Name[k_accent] 	= "accent";
-	fType2Name[k_accidental] 	= "accidental";
-	fType2Name[k_accidental_mark] 	= "accidental-mark";
-	fType2Name[k_accidental_text] 	= "accidental-text";
-	fType2Name[k_accord] 	= "accord";
-	fType2Name[k_accordion_high] 	= "accordion-high";
-	fType2Name[k_accordion_low] 	= "accordion-low";
-	fType2Name[k_accordion_middle] 	= "accordion-middle";
-	fType2Name[k_accordion_registration] 	= "accordion-registration";
-	fType2Name[k_actual_notes] 	= "actual-notes";
-	fType2Name[k_alter] 	= "alter";
-	fType2Name[k_appearance] 	= "appearance";
-	fType2Name[k_arpeggiate] 	= "arpeggiate";
-	fType2Name[k_arrow] 	= "arrow";
-	fType2Name[k_arrow_direction] 	= "arrow-direction";
-	fType2Name[k_arrow_style] 	= "arrow-style";
-	fType2Name[k_arrowhead] 	= "arrowhead";
-	fType2Name[k_articulations] 	= "articulations";
-	fType2Name[k_artificial] 	= "artificial";
-	fType2Name[k_assess] 	= "assess";
-	fType2Name[k_attributes] 	= "attributes";
-	fType2Name[k_backup] 	= "backup";
-	fType2Name[k_bar_style] 	= "bar-style";
-	fType2Name[k_barline] 	= "barline";
-	fType2Name[k_barre] 	= "barre";
-	fType2Name[k_base_pitch] 	= "base-pitch";
-	fType2Name[k_bass] 	= "bass";
-	fType2Name[k_bass_alter] 	= "bass-alter";
-	fType2Name[k_bass_separator] 	= "bass-separator";
-	fType2Name[k_bass_step] 	= "bass-step";
-	fType2Name[k_beam] 	= "beam";
-	fType2Name[k_beat_repeat] 	= "beat-repeat";
-	fType2Name[k_beat_type] 	= "beat-type";
-	fType2Name[k_beat_unit] 	= "beat-unit";
-	fType2Name[k_beat_unit_dot] 	= "beat-unit-dot";
-	fType2Name[k_beat_unit_tied] 	= "beat-unit-tied";
-	fType2Name[k_beater] 	= "beater";
-	fType2Name[k_beats] 	= "beats";
-	fType2Name[k_bend] 	= "bend";
-	fType2Name[k_bend_alter] 	= "bend-alter";
-	fType2Name[k_bookmark] 	= "bookmark";
-	fType2Name[k_bottom_margin] 	= "bottom-margin";
-	fType2Name[k_bracket] 	= "bracket";
-	fType2Name[k_brass_bend] 	= "brass-bend";
-	fType2Name[k_breath_mark] 	= "breath-mark";
-	fType2Name[k_caesura] 	= "caesura";
-	fType2Name[k_cancel] 	= "cancel";
-	fType2Name[k_capo] 	= "capo";
-	fType2Name[k_chord] 	= "chord";
-	fType2Name[k_chromatic] 	= "chromatic";
-	fType2Name[k_circular_arrow] 	= "circular-arrow";
-	fType2Name[k_clef] 	= "clef";
-	fType2Name[k_clef_octave_change] 	= "clef-octave-change";
-	fType2Name[k_coda] 	= "coda";
-	fType2Name[k_concert_score] 	= "concert-score";
-	fType2Name[k_creator] 	= "creator";
-	fType2Name[k_credit] 	= "credit";
-	fType2Name[k_credit_image] 	= "credit-image";
-	fType2Name[k_credit_symbol] 	= "credit-symbol";
-	fType2Name[k_credit_type] 	= "credit-type";
-	fType2Name[k_credit_words] 	= "credit-words";
-	fType2Name[k_cue] 	= "cue";
-	fType2Name[k_damp] 	= "damp";
-	fType2Name[k_damp_all] 	= "damp-all";
-	fType2Name[k_dashes] 	= "dashes";
-	fType2Name[k_defaults] 	= "defaults";
-	fType2Name[k_degree] 	= "degree";
-	fType2Name[k_degree_alter] 	= "degree-alter";
-	fType2Name[k_degree_type] 	= "degree-type";
-	fType2Name[k_degree_value] 	= "degree-value";
-	fType2Name[k_delayed_inverted_turn] 	= "delayed-inverted-turn";
-	fType2Name[k_delayed_turn] 	= "delayed-turn";
-	fType2Name[k_detached_legato] 	= "detached-legato";
-	fType2Name[k_diatonic] 	= "diatonic";
-	fType2Name[k_direction] 	= "direction";
-	fType2Name[k_direction_type] 	= "direction-type";
-	fType2Name[k_directive] 	= "directive";
-	fType2Name[k_display_octave] 	= "display-octave";
-	fType2Name[k_display_step] 	= "display-step";
-	fType2Name[k_display_text] 	= "display-text";
-	fType2Name[k_distance] 	= "distance";
-	fType2Name[k_divisions] 	= "divisions";
-	fType2Name[k_doit] 	= "doit";
-	fType2Name[k_dot] 	= "dot";
-	fType2Name[k_double] 	= "double";
-	fType2Name[k_double_tongue] 	= "double-tongue";
-	fType2Name[k_down_bow] 	= "down-bow";
-	fType2Name[k_duration] 	= "duration";
-	fType2Name[k_dynamics] 	= "dynamics";
-	fType2Name[k_effect] 	= "effect";
-	fType2Name[k_elevation] 	= "elevation";
-	fType2Name[k_elision] 	= "elision";
-	fType2Name[k_encoder] 	= "encoder";
-	fType2Name[k_encoding] 	= "encoding";
-	fType2Name[k_encoding_date] 	= "encoding-date";
-	fType2Name[k_encoding_description] 	= "encoding-description";
-	fType2Name[k_end_line] 	= "end-line";
-	fType2Name[k_end_paragraph] 	= "end-paragraph";
-	fType2Name[k_ending] 	= "ending";
-	fType2Name[k_ensemble] 	= "ensemble";
-	fType2Name[k_except_voice] 	= "except-voice";
-	fType2Name[k_extend] 	= "extend";
-	fType2Name[k_eyeglasses] 	= "eyeglasses";
-	fType2Name[k_f] 	= "f";
-	fType2Name[k_falloff] 	= "falloff";
-	fType2Name[k_feature] 	= "feature";
-	fType2Name[k_fermata] 	= "fermata";
-	fType2Name[k_ff] 	= "ff";
-	fType2Name[k_fff] 	= "fff";
-	fType2Name[k_ffff] 	= "ffff";
-	fType2Name[k_fffff] 	= "fffff";
-	fType2Name[k_ffffff] 	= "ffffff";
-	fType2Name[k_fifths] 	= "fifths";
-	fType2Name[k_figure] 	= "figure";
-	fType2Name[k_figure_number] 	= "figure-number";
-	fType2Name[k_figured_bass] 	= "figured-bass";
-	fType2Name[k_fingering] 	= "fingering";
-	fType2Name[k_fingernails] 	= "fingernails";
-	fType2Name[k_first] 	= "first";
-	fType2Name[k_first_fret] 	= "first-fret";
-	fType2Name[k_flip] 	= "flip";
-	fType2Name[k_footnote] 	= "footnote";
-	fType2Name[k_for_part] 	= "for-part";
-	fType2Name[k_forward] 	= "forward";
-	fType2Name[k_fp] 	= "fp";
-	fType2Name[k_frame] 	= "frame";
-	fType2Name[k_frame_frets] 	= "frame-frets";
-	fType2Name[k_frame_note] 	= "frame-note";
-	fType2Name[k_frame_strings] 	= "frame-strings";
-	fType2Name[k_fret] 	= "fret";
-	fType2Name[k_function] 	= "function";
-	fType2Name[k_fz] 	= "fz";
-	fType2Name[k_glass] 	= "glass";
-	fType2Name[k_glissando] 	= "glissando";
-	fType2Name[k_glyph] 	= "glyph";
-	fType2Name[k_golpe] 	= "golpe";
-	fType2Name[k_grace] 	= "grace";
-	fType2Name[k_group] 	= "group";
-	fType2Name[k_group_abbreviation] 	= "group-abbreviation";
-	fType2Name[k_group_abbreviation_display] 	= "group-abbreviation-display";
-	fType2Name[k_group_barline] 	= "group-barline";
-	fType2Name[k_group_link] 	= "group-link";
-	fType2Name[k_group_name] 	= "group-name";
-	fType2Name[k_group_name_display] 	= "group-name-display";
-	fType2Name[k_group_symbol] 	= "group-symbol";
-	fType2Name[k_group_time] 	= "group-time";
-	fType2Name[k_grouping] 	= "grouping";
-	fType2Name[k_half_muted] 	= "half-muted";
-	fType2Name[k_hammer_on] 	= "hammer-on";
-	fType2Name[k_handbell] 	= "handbell";
-	fType2Name[k_harmon_closed] 	= "harmon-closed";
-	fType2Name[k_harmon_mute] 	= "harmon-mute";
-	fType2Name[k_harmonic] 	= "harmonic";
-	fType2Name[k_harmony] 	= "harmony";
-	fType2Name[k_harp_pedals] 	= "harp-pedals";
-	fType2Name[k_haydn] 	= "haydn";
-	fType2Name[k_heel] 	= "heel";
-	fType2Name[k_hole] 	= "hole";
-	fType2Name[k_hole_closed] 	= "hole-closed";
-	fType2Name[k_hole_shape] 	= "hole-shape";
-	fType2Name[k_hole_type] 	= "hole-type";
-	fType2Name[k_humming] 	= "humming";
-	fType2Name[k_identification] 	= "identification";
-	fType2Name[k_image] 	= "image";
-	fType2Name[k_instrument] 	= "instrument";
-	fType2Name[k_instrument_abbreviation] 	= "instrument-abbreviation";
-	fType2Name[k_instrument_change] 	= "instrument-change";
-	fType2Name[k_instrument_link] 	= "instrument-link";
-	fType2Name[k_instrument_name] 	= "instrument-name";
-	fType2Name[k_instrument_sound] 	= "instrument-sound";
-	fType2Name[k_instruments] 	= "instruments";
-	fType2Name[k_interchangeable] 	= "interchangeable";
-	fType2Name[k_inversion] 	= "inversion";
-	fType2Name[k_inverted_mordent] 	= "inverted-mordent";
-	fType2Name[k_inverted_turn] 	= "inverted-turn";
-	fType2Name[k_inverted_vertical_turn] 	= "inverted-vertical-turn";
-	fType2Name[k_ipa] 	= "ipa";
-	fType2Name[k_key] 	= "key";
-	fType2Name[k_key_accidental] 	= "key-accidental";
-	fType2Name[k_key_alter] 	= "key-alter";
-	fType2Name[k_key_octave] 	= "key-octave";
-	fType2Name[k_key_step] 	= "key-step";
-	fType2Name[k_kind] 	= "kind";
-	fType2Name[k_laughing] 	= "laughing";
-	fType2Name[k_left_divider] 	= "left-divider";
-	fType2Name[k_left_margin] 	= "left-margin";
-	fType2Name[k_level] 	= "level";
-	fType2Name[k_line] 	= "line";
-	fType2Name[k_line_detail] 	= "line-detail";
-	fType2Name[k_line_width] 	= "line-width";
-	fType2Name[k_link] 	= "link";
-	fType2Name[k_listen] 	= "listen";
-	fType2Name[k_listening] 	= "listening";
-	fType2Name[k_lyric] 	= "lyric";
-	fType2Name[k_lyric_font] 	= "lyric-font";
-	fType2Name[k_lyric_language] 	= "lyric-language";
-	fType2Name[k_measure] 	= "measure";
-	fType2Name[k_measure_distance] 	= "measure-distance";
-	fType2Name[k_measure_layout] 	= "measure-layout";
-	fType2Name[k_measure_numbering] 	= "measure-numbering";
-	fType2Name[k_measure_repeat] 	= "measure-repeat";
-	fType2Name[k_measure_style] 	= "measure-style";
-	fType2Name[k_membrane] 	= "membrane";
-	fType2Name[k_metal] 	= "metal";
-	fType2Name[k_metronome] 	= "metronome";
-	fType2Name[k_metronome_arrows] 	= "metronome-arrows";
-	fType2Name[k_metronome_beam] 	= "metronome-beam";
-	fType2Name[k_metronome_dot] 	= "metronome-dot";
-	fType2Name[k_metronome_note] 	= "metronome-note";
-	fType2Name[k_metronome_relation] 	= "metronome-relation";
-	fType2Name[k_metronome_tied] 	= "metronome-tied";
-	fType2Name[k_metronome_tuplet] 	= "metronome-tuplet";
-	fType2Name[k_metronome_type] 	= "metronome-type";
-	fType2Name[k_mf] 	= "mf";
-	fType2Name[k_midi_bank] 	= "midi-bank";
-	fType2Name[k_midi_channel] 	= "midi-channel";
-	fType2Name[k_midi_device] 	= "midi-device";
-	fType2Name[k_midi_instrument] 	= "midi-instrument";
-	fType2Name[k_midi_name] 	= "midi-name";
-	fType2Name[k_midi_program] 	= "midi-program";
-	fType2Name[k_midi_unpitched] 	= "midi-unpitched";
-	fType2Name[k_millimeters] 	= "millimeters";
-	fType2Name[k_miscellaneous] 	= "miscellaneous";
-	fType2Name[k_miscellaneous_field] 	= "miscellaneous-field";
-	fType2Name[k_mode] 	= "mode";
-	fType2Name[k_mordent] 	= "mordent";
-	fType2Name[k_movement_number] 	= "movement-number";
-	fType2Name[k_movement_title] 	= "movement-title";
-	fType2Name[k_mp] 	= "mp";
-	fType2Name[k_multiple_rest] 	= "multiple-rest";
-	fType2Name[k_music_font] 	= "music-font";
-	fType2Name[k_mute] 	= "mute";
-	fType2Name[k_n] 	= "n";
-	fType2Name[k_natural] 	= "natural";
-	fType2Name[k_non_arpeggiate] 	= "non-arpeggiate";
-	fType2Name[k_normal_dot] 	= "normal-dot";
-	fType2Name[k_normal_notes] 	= "normal-notes";
-	fType2Name[k_normal_type] 	= "normal-type";
-	fType2Name[k_notations] 	= "notations";
-	fType2Name[k_note] 	= "note";
-	fType2Name[k_note_size] 	= "note-size";
-	fType2Name[k_notehead] 	= "notehead";
-	fType2Name[k_notehead_text] 	= "notehead-text";
-	fType2Name[k_numeral] 	= "numeral";
-	fType2Name[k_numeral_alter] 	= "numeral-alter";
-	fType2Name[k_numeral_fifths] 	= "numeral-fifths";
-	fType2Name[k_numeral_key] 	= "numeral-key";
-	fType2Name[k_numeral_mode] 	= "numeral-mode";
-	fType2Name[k_numeral_root] 	= "numeral-root";
-	fType2Name[k_octave] 	= "octave";
-	fType2Name[k_octave_change] 	= "octave-change";
-	fType2Name[k_octave_shift] 	= "octave-shift";
-	fType2Name[k_offset] 	= "offset";
-	fType2Name[k_open] 	= "open";
-	fType2Name[k_open_string] 	= "open-string";
-	fType2Name[k_opus] 	= "opus";
-	fType2Name[k_ornaments] 	= "ornaments";
-	fType2Name[k_other_appearance] 	= "other-appearance";
-	fType2Name[k_other_articulation] 	= "other-articulation";
-	fType2Name[k_other_direction] 	= "other-direction";
-	fType2Name[k_other_dynamics] 	= "other-dynamics";
-	fType2Name[k_other_listen] 	= "other-listen";
-	fType2Name[k_other_listening] 	= "other-listening";
-	fType2Name[k_other_notation] 	= "other-notation";
-	fType2Name[k_other_ornament] 	= "other-ornament";
-	fType2Name[k_other_percussion] 	= "other-percussion";
-	fType2Name[k_other_play] 	= "other-play";
-	fType2Name[k_other_technical] 	= "other-technical";
-	fType2Name[k_p] 	= "p";
-	fType2Name[k_page_height] 	= "page-height";
-	fType2Name[k_page_layout] 	= "page-layout";
-	fType2Name[k_page_margins] 	= "page-margins";
-	fType2Name[k_page_width] 	= "page-width";
-	fType2Name[k_pan] 	= "pan";
-	fType2Name[k_part] 	= "part";
-	fType2Name[k_part_abbreviation] 	= "part-abbreviation";
-	fType2Name[k_part_abbreviation_display] 	= "part-abbreviation-display";
-	fType2Name[k_part_clef] 	= "part-clef";
-	fType2Name[k_part_group] 	= "part-group";
-	fType2Name[k_part_link] 	= "part-link";
-	fType2Name[k_part_list] 	= "part-list";
-	fType2Name[k_part_name] 	= "part-name";
-	fType2Name[k_part_name_display] 	= "part-name-display";
-	fType2Name[k_part_symbol] 	= "part-symbol";
-	fType2Name[k_part_transpose] 	= "part-transpose";
-	fType2Name[k_pedal] 	= "pedal";
-	fType2Name[k_pedal_alter] 	= "pedal-alter";
-	fType2Name[k_pedal_step] 	= "pedal-step";
-	fType2Name[k_pedal_tuning] 	= "pedal-tuning";
-	fType2Name[k_per_minute] 	= "per-minute";
-	fType2Name[k_percussion] 	= "percussion";
-	fType2Name[k_pf] 	= "pf";
-	fType2Name[k_pitch] 	= "pitch";
-	fType2Name[k_pitched] 	= "pitched";
-	fType2Name[k_play] 	= "play";
-	fType2Name[k_player] 	= "player";
-	fType2Name[k_player_name] 	= "player-name";
-	fType2Name[k_plop] 	= "plop";
-	fType2Name[k_pluck] 	= "pluck";
-	fType2Name[k_pp] 	= "pp";
-	fType2Name[k_ppp] 	= "ppp";
-	fType2Name[k_pppp] 	= "pppp";
-	fType2Name[k_ppppp] 	= "ppppp";
-	fType2Name[k_pppppp] 	= "pppppp";
-	fType2Name[k_pre_bend] 	= "pre-bend";
-	fType2Name[k_prefix] 	= "prefix";
-	fType2Name[k_principal_voice] 	= "principal-voice";
-	fType2Name[k_print] 	= "print";
-	fType2Name[k_pull_off] 	= "pull-off";
-	fType2Name[k_rehearsal] 	= "rehearsal";
-	fType2Name[k_relation] 	= "relation";
-	fType2Name[k_release] 	= "release";
-	fType2Name[k_repeat] 	= "repeat";
-	fType2Name[k_rest] 	= "rest";
-	fType2Name[k_rf] 	= "rf";
-	fType2Name[k_rfz] 	= "rfz";
-	fType2Name[k_right_divider] 	= "right-divider";
-	fType2Name[k_right_margin] 	= "right-margin";
-	fType2Name[k_rights] 	= "rights";
-	fType2Name[k_root] 	= "root";
-	fType2Name[k_root_alter] 	= "root-alter";
-	fType2Name[k_root_step] 	= "root-step";
-	fType2Name[k_scaling] 	= "scaling";
-	fType2Name[k_schleifer] 	= "schleifer";
-	fType2Name[k_scoop] 	= "scoop";
-	fType2Name[k_scordatura] 	= "scordatura";
-	fType2Name[k_score_instrument] 	= "score-instrument";
-	fType2Name[k_score_part] 	= "score-part";
-	fType2Name[k_score_partwise] 	= "score-partwise";
-	fType2Name[k_score_timewise] 	= "score-timewise";
-	fType2Name[k_second] 	= "second";
-	fType2Name[k_segno] 	= "segno";
-	fType2Name[k_semi_pitched] 	= "semi-pitched";
-	fType2Name[k_senza_misura] 	= "senza-misura";
-	fType2Name[k_sf] 	= "sf";
-	fType2Name[k_sffz] 	= "sffz";
-	fType2Name[k_sfp] 	= "sfp";
-	fType2Name[k_sfpp] 	= "sfpp";
-	fType2Name[k_sfz] 	= "sfz";
-	fType2Name[k_sfzp] 	= "sfzp";
-	fType2Name[k_shake] 	= "shake";
-	fType2Name[k_sign] 	= "sign";
-	fType2Name[k_slash] 	= "slash";
-	fType2Name[k_slash_dot] 	= "slash-dot";
-	fType2Name[k_slash_type] 	= "slash-type";
-	fType2Name[k_slide] 	= "slide";
-	fType2Name[k_slur] 	= "slur";
-	fType2Name[k_smear] 	= "smear";
-	fType2Name[k_snap_pizzicato] 	= "snap-pizzicato";
-	fType2Name[k_soft_accent] 	= "soft-accent";
-	fType2Name[k_software] 	= "software";
-	fType2Name[k_solo] 	= "solo";
-	fType2Name[k_sound] 	= "sound";
-	fType2Name[k_sounding_pitch] 	= "sounding-pitch";
-	fType2Name[k_source] 	= "source";
-	fType2Name[k_spiccato] 	= "spiccato";
-	fType2Name[k_staccatissimo] 	= "staccatissimo";
-	fType2Name[k_staccato] 	= "staccato";
-	fType2Name[k_staff] 	= "staff";
-	fType2Name[k_staff_details] 	= "staff-details";
-	fType2Name[k_staff_distance] 	= "staff-distance";
-	fType2Name[k_staff_divide] 	= "staff-divide";
-	fType2Name[k_staff_layout] 	= "staff-layout";
-	fType2Name[k_staff_lines] 	= "staff-lines";
-	fType2Name[k_staff_size] 	= "staff-size";
-	fType2Name[k_staff_tuning] 	= "staff-tuning";
-	fType2Name[k_staff_type] 	= "staff-type";
-	fType2Name[k_staves] 	= "staves";
-	fType2Name[k_stem] 	= "stem";
-	fType2Name[k_step] 	= "step";
-	fType2Name[k_stick] 	= "stick";
-	fType2Name[k_stick_location] 	= "stick-location";
-	fType2Name[k_stick_material] 	= "stick-material";
-	fType2Name[k_stick_type] 	= "stick-type";
-	fType2Name[k_stopped] 	= "stopped";
-	fType2Name[k_straight] 	= "straight";
-	fType2Name[k_stress] 	= "stress";
-	fType2Name[k_string] 	= "string";
-	fType2Name[k_string_mute] 	= "string-mute";
-	fType2Name[k_strong_accent] 	= "strong-accent";
-	fType2Name[k_suffix] 	= "suffix";
-	fType2Name[k_supports] 	= "supports";
-	fType2Name[k_swing] 	= "swing";
-	fType2Name[k_swing_style] 	= "swing-style";
-	fType2Name[k_swing_type] 	= "swing-type";
-	fType2Name[k_syllabic] 	= "syllabic";
-	fType2Name[k_symbol] 	= "symbol";
-	fType2Name[k_sync] 	= "sync";
-	fType2Name[k_system_distance] 	= "system-distance";
-	fType2Name[k_system_dividers] 	= "system-dividers";
-	fType2Name[k_system_layout] 	= "system-layout";
-	fType2Name[k_system_margins] 	= "system-margins";
-	fType2Name[k_tap] 	= "tap";
-	fType2Name[k_technical] 	= "technical";
-	fType2Name[k_tenths] 	= "tenths";
-	fType2Name[k_tenuto] 	= "tenuto";
-	fType2Name[k_text] 	= "text";
-	fType2Name[k_thumb_position] 	= "thumb-position";
-	fType2Name[k_tie] 	= "tie";
-	fType2Name[k_tied] 	= "tied";
-	fType2Name[k_time] 	= "time";
-	fType2Name[k_time_modification] 	= "time-modification";
-	fType2Name[k_time_relation] 	= "time-relation";
-	fType2Name[k_timpani] 	= "timpani";
-	fType2Name[k_toe] 	= "toe";
-	fType2Name[k_top_margin] 	= "top-margin";
-	fType2Name[k_top_system_distance] 	= "top-system-distance";
-	fType2Name[k_touching_pitch] 	= "touching-pitch";
-	fType2Name[k_transpose] 	= "transpose";
-	fType2Name[k_tremolo] 	= "tremolo";
-	fType2Name[k_trill_mark] 	= "trill-mark";
-	fType2Name[k_triple_tongue] 	= "triple-tongue";
-	fType2Name[k_tuning_alter] 	= "tuning-alter";
-	fType2Name[k_tuning_octave] 	= "tuning-octave";
-	fType2Name[k_tuning_step] 	= "tuning-step";
-	fType2Name[k_tuplet] 	= "tuplet";
-	fType2Name[k_tuplet_actual] 	= "tuplet-actual";
-	fType2Name[k_tuplet_dot] 	= "tuplet-dot";
-	fType2Name[k_tuplet_normal] 	= "tuplet-normal";
-	fType2Name[k_tuplet_number] 	= "tuplet-number";
-	fType2Name[k_tuplet_type] 	= "tuplet-type";
-	fType2Name[k_turn] 	= "turn";
-	fType2Name[k_type] 	= "type";
-	fType2Name[k_unpitched] 	= "unpitched";
-	fType2Name[k_unstress] 	= "unstress";
-	fType2Name[k_up_bow] 	= "up-bow";
-	fType2Name[k_vertical_turn] 	= "vertical-turn";
-	fType2Name[k_virtual_instrument] 	= "virtual-instrument";
-	fType2Name[k_virtual_library] 	= "virtual-library";
-	fType2Name[k_virtual_name] 	= "virtual-name";
-	fType2Name[k_voice] 	= "voice";
-	fType2Name[k_volume] 	= "volume";
-	fType2Name[k_wait] 	= "wait";
-	fType2Name[k_wavy_line] 	= "wavy-line";
-	fType2Name[k_wedge] 	= "wedge";
-	fType2Name[k_with_bar] 	= "with-bar";
-	fType2Name[k_wood] 	= "wood";
-	fType2Name[k_word_font] 	= "word-font";
-	fType2Name[k_words] 	= "words";
-	fType2Name[k_work] 	= "work";
-	fType2Name[k_work_number] 	= "work-number";
-	fType2Name[k_work_title] 	= "work-title";
+	fNames[k_accent] 	= "accent";
+	fNames[k_accidental] 	= "accidental";
+	fNames[k_accidental_mark] 	= "accidental-mark";
+	fNames[k_accidental_text] 	= "accidental-text";
+	fNames[k_accord] 	= "accord";
+	fNames[k_accordion_high] 	= "accordion-high";
+	fNames[k_accordion_low] 	= "accordion-low";
+	fNames[k_accordion_middle] 	= "accordion-middle";
+	fNames[k_accordion_registration] 	= "accordion-registration";
+	fNames[k_actual_notes] 	= "actual-notes";
+	fNames[k_alter] 	= "alter";
+	fNames[k_appearance] 	= "appearance";
+	fNames[k_arpeggiate] 	= "arpeggiate";
+	fNames[k_arrow] 	= "arrow";
+	fNames[k_arrow_direction] 	= "arrow-direction";
+	fNames[k_arrow_style] 	= "arrow-style";
+	fNames[k_arrowhead] 	= "arrowhead";
+	fNames[k_articulations] 	= "articulations";
+	fNames[k_artificial] 	= "artificial";
+	fNames[k_assess] 	= "assess";
+	fNames[k_attributes] 	= "attributes";
+	fNames[k_backup] 	= "backup";
+	fNames[k_bar_style] 	= "bar-style";
+	fNames[k_barline] 	= "barline";
+	fNames[k_barre] 	= "barre";
+	fNames[k_base_pitch] 	= "base-pitch";
+	fNames[k_bass] 	= "bass";
+	fNames[k_bass_alter] 	= "bass-alter";
+	fNames[k_bass_separator] 	= "bass-separator";
+	fNames[k_bass_step] 	= "bass-step";
+	fNames[k_beam] 	= "beam";
+	fNames[k_beat_repeat] 	= "beat-repeat";
+	fNames[k_beat_type] 	= "beat-type";
+	fNames[k_beat_unit] 	= "beat-unit";
+	fNames[k_beat_unit_dot] 	= "beat-unit-dot";
+	fNames[k_beat_unit_tied] 	= "beat-unit-tied";
+	fNames[k_beater] 	= "beater";
+	fNames[k_beats] 	= "beats";
+	fNames[k_bend] 	= "bend";
+	fNames[k_bend_alter] 	= "bend-alter";
+	fNames[k_bookmark] 	= "bookmark";
+	fNames[k_bottom_margin] 	= "bottom-margin";
+	fNames[k_bracket] 	= "bracket";
+	fNames[k_brass_bend] 	= "brass-bend";
+	fNames[k_breath_mark] 	= "breath-mark";
+	fNames[k_caesura] 	= "caesura";
+	fNames[k_cancel] 	= "cancel";
+	fNames[k_capo] 	= "capo";
+	fNames[k_chord] 	= "chord";
+	fNames[k_chromatic] 	= "chromatic";
+	fNames[k_circular_arrow] 	= "circular-arrow";
+	fNames[k_clef] 	= "clef";
+	fNames[k_clef_octave_change] 	= "clef-octave-change";
+	fNames[k_coda] 	= "coda";
+	fNames[k_concert_score] 	= "concert-score";
+	fNames[k_creator] 	= "creator";
+	fNames[k_credit] 	= "credit";
+	fNames[k_credit_image] 	= "credit-image";
+	fNames[k_credit_symbol] 	= "credit-symbol";
+	fNames[k_credit_type] 	= "credit-type";
+	fNames[k_credit_words] 	= "credit-words";
+	fNames[k_cue] 	= "cue";
+	fNames[k_damp] 	= "damp";
+	fNames[k_damp_all] 	= "damp-all";
+	fNames[k_dashes] 	= "dashes";
+	fNames[k_defaults] 	= "defaults";
+	fNames[k_degree] 	= "degree";
+	fNames[k_degree_alter] 	= "degree-alter";
+	fNames[k_degree_type] 	= "degree-type";
+	fNames[k_degree_value] 	= "degree-value";
+	fNames[k_delayed_inverted_turn] 	= "delayed-inverted-turn";
+	fNames[k_delayed_turn] 	= "delayed-turn";
+	fNames[k_detached_legato] 	= "detached-legato";
+	fNames[k_diatonic] 	= "diatonic";
+	fNames[k_direction] 	= "direction";
+	fNames[k_direction_type] 	= "direction-type";
+	fNames[k_directive] 	= "directive";
+	fNames[k_display_octave] 	= "display-octave";
+	fNames[k_display_step] 	= "display-step";
+	fNames[k_display_text] 	= "display-text";
+	fNames[k_distance] 	= "distance";
+	fNames[k_divisions] 	= "divisions";
+	fNames[k_doit] 	= "doit";
+	fNames[k_dot] 	= "dot";
+	fNames[k_double] 	= "double";
+	fNames[k_double_tongue] 	= "double-tongue";
+	fNames[k_down_bow] 	= "down-bow";
+	fNames[k_duration] 	= "duration";
+	fNames[k_dynamics] 	= "dynamics";
+	fNames[k_effect] 	= "effect";
+	fNames[k_elevation] 	= "elevation";
+	fNames[k_elision] 	= "elision";
+	fNames[k_encoder] 	= "encoder";
+	fNames[k_encoding] 	= "encoding";
+	fNames[k_encoding_date] 	= "encoding-date";
+	fNames[k_encoding_description] 	= "encoding-description";
+	fNames[k_end_line] 	= "end-line";
+	fNames[k_end_paragraph] 	= "end-paragraph";
+	fNames[k_ending] 	= "ending";
+	fNames[k_ensemble] 	= "ensemble";
+	fNames[k_except_voice] 	= "except-voice";
+	fNames[k_extend] 	= "extend";
+	fNames[k_eyeglasses] 	= "eyeglasses";
+	fNames[k_f] 	= "f";
+	fNames[k_falloff] 	= "falloff";
+	fNames[k_feature] 	= "feature";
+	fNames[k_fermata] 	= "fermata";
+	fNames[k_ff] 	= "ff";
+	fNames[k_fff] 	= "fff";
+	fNames[k_ffff] 	= "ffff";
+	fNames[k_fffff] 	= "fffff";
+	fNames[k_ffffff] 	= "ffffff";
+	fNames[k_fifths] 	= "fifths";
+	fNames[k_figure] 	= "figure";
+	fNames[k_figure_number] 	= "figure-number";
+	fNames[k_figured_bass] 	= "figured-bass";
+	fNames[k_fingering] 	= "fingering";
+	fNames[k_fingernails] 	= "fingernails";
+	fNames[k_first] 	= "first";
+	fNames[k_first_fret] 	= "first-fret";
+	fNames[k_flip] 	= "flip";
+	fNames[k_footnote] 	= "footnote";
+	fNames[k_for_part] 	= "for-part";
+	fNames[k_forward] 	= "forward";
+	fNames[k_fp] 	= "fp";
+	fNames[k_frame] 	= "frame";
+	fNames[k_frame_frets] 	= "frame-frets";
+	fNames[k_frame_note] 	= "frame-note";
+	fNames[k_frame_strings] 	= "frame-strings";
+	fNames[k_fret] 	= "fret";
+	fNames[k_function] 	= "function";
+	fNames[k_fz] 	= "fz";
+	fNames[k_glass] 	= "glass";
+	fNames[k_glissando] 	= "glissando";
+	fNames[k_glyph] 	= "glyph";
+	fNames[k_golpe] 	= "golpe";
+	fNames[k_grace] 	= "grace";
+	fNames[k_group] 	= "group";
+	fNames[k_group_abbreviation] 	= "group-abbreviation";
+	fNames[k_group_abbreviation_display] 	= "group-abbreviation-display";
+	fNames[k_group_barline] 	= "group-barline";
+	fNames[k_group_link] 	= "group-link";
+	fNames[k_group_name] 	= "group-name";
+	fNames[k_group_name_display] 	= "group-name-display";
+	fNames[k_group_symbol] 	= "group-symbol";
+	fNames[k_group_time] 	= "group-time";
+	fNames[k_grouping] 	= "grouping";
+	fNames[k_half_muted] 	= "half-muted";
+	fNames[k_hammer_on] 	= "hammer-on";
+	fNames[k_handbell] 	= "handbell";
+	fNames[k_harmon_closed] 	= "harmon-closed";
+	fNames[k_harmon_mute] 	= "harmon-mute";
+	fNames[k_harmonic] 	= "harmonic";
+	fNames[k_harmony] 	= "harmony";
+	fNames[k_harp_pedals] 	= "harp-pedals";
+	fNames[k_haydn] 	= "haydn";
+	fNames[k_heel] 	= "heel";
+	fNames[k_hole] 	= "hole";
+	fNames[k_hole_closed] 	= "hole-closed";
+	fNames[k_hole_shape] 	= "hole-shape";
+	fNames[k_hole_type] 	= "hole-type";
+	fNames[k_humming] 	= "humming";
+	fNames[k_identification] 	= "identification";
+	fNames[k_image] 	= "image";
+	fNames[k_instrument] 	= "instrument";
+	fNames[k_instrument_abbreviation] 	= "instrument-abbreviation";
+	fNames[k_instrument_change] 	= "instrument-change";
+	fNames[k_instrument_link] 	= "instrument-link";
+	fNames[k_instrument_name] 	= "instrument-name";
+	fNames[k_instrument_sound] 	= "instrument-sound";
+	fNames[k_instruments] 	= "instruments";
+	fNames[k_interchangeable] 	= "interchangeable";
+	fNames[k_inversion] 	= "inversion";
+	fNames[k_inverted_mordent] 	= "inverted-mordent";
+	fNames[k_inverted_turn] 	= "inverted-turn";
+	fNames[k_inverted_vertical_turn] 	= "inverted-vertical-turn";
+	fNames[k_ipa] 	= "ipa";
+	fNames[k_key] 	= "key";
+	fNames[k_key_accidental] 	= "key-accidental";
+	fNames[k_key_alter] 	= "key-alter";
+	fNames[k_key_octave] 	= "key-octave";
+	fNames[k_key_step] 	= "key-step";
+	fNames[k_kind] 	= "kind";
+	fNames[k_laughing] 	= "laughing";
+	fNames[k_left_divider] 	= "left-divider";
+	fNames[k_left_margin] 	= "left-margin";
+	fNames[k_level] 	= "level";
+	fNames[k_line] 	= "line";
+	fNames[k_line_detail] 	= "line-detail";
+	fNames[k_line_width] 	= "line-width";
+	fNames[k_link] 	= "link";
+	fNames[k_listen] 	= "listen";
+	fNames[k_listening] 	= "listening";
+	fNames[k_lyric] 	= "lyric";
+	fNames[k_lyric_font] 	= "lyric-font";
+	fNames[k_lyric_language] 	= "lyric-language";
+	fNames[k_measure] 	= "measure";
+	fNames[k_measure_distance] 	= "measure-distance";
+	fNames[k_measure_layout] 	= "measure-layout";
+	fNames[k_measure_numbering] 	= "measure-numbering";
+	fNames[k_measure_repeat] 	= "measure-repeat";
+	fNames[k_measure_style] 	= "measure-style";
+	fNames[k_membrane] 	= "membrane";
+	fNames[k_metal] 	= "metal";
+	fNames[k_metronome] 	= "metronome";
+	fNames[k_metronome_arrows] 	= "metronome-arrows";
+	fNames[k_metronome_beam] 	= "metronome-beam";
+	fNames[k_metronome_dot] 	= "metronome-dot";
+	fNames[k_metronome_note] 	= "metronome-note";
+	fNames[k_metronome_relation] 	= "metronome-relation";
+	fNames[k_metronome_tied] 	= "metronome-tied";
+	fNames[k_metronome_tuplet] 	= "metronome-tuplet";
+	fNames[k_metronome_type] 	= "metronome-type";
+	fNames[k_mf] 	= "mf";
+	fNames[k_midi_bank] 	= "midi-bank";
+	fNames[k_midi_channel] 	= "midi-channel";
+	fNames[k_midi_device] 	= "midi-device";
+	fNames[k_midi_instrument] 	= "midi-instrument";
+	fNames[k_midi_name] 	= "midi-name";
+	fNames[k_midi_program] 	= "midi-program";
+	fNames[k_midi_unpitched] 	= "midi-unpitched";
+	fNames[k_millimeters] 	= "millimeters";
+	fNames[k_miscellaneous] 	= "miscellaneous";
+	fNames[k_miscellaneous_field] 	= "miscellaneous-field";
+	fNames[k_mode] 	= "mode";
+	fNames[k_mordent] 	= "mordent";
+	fNames[k_movement_number] 	= "movement-number";
+	fNames[k_movement_title] 	= "movement-title";
+	fNames[k_mp] 	= "mp";
+	fNames[k_multiple_rest] 	= "multiple-rest";
+	fNames[k_music_font] 	= "music-font";
+	fNames[k_mute] 	= "mute";
+	fNames[k_n] 	= "n";
+	fNames[k_natural] 	= "natural";
+	fNames[k_non_arpeggiate] 	= "non-arpeggiate";
+	fNames[k_normal_dot] 	= "normal-dot";
+	fNames[k_normal_notes] 	= "normal-notes";
+	fNames[k_normal_type] 	= "normal-type";
+	fNames[k_notations] 	= "notations";
+	fNames[k_note] 	= "note";
+	fNames[k_note_size] 	= "note-size";
+	fNames[k_notehead] 	= "notehead";
+	fNames[k_notehead_text] 	= "notehead-text";
+	fNames[k_numeral] 	= "numeral";
+	fNames[k_numeral_alter] 	= "numeral-alter";
+	fNames[k_numeral_fifths] 	= "numeral-fifths";
+	fNames[k_numeral_key] 	= "numeral-key";
+	fNames[k_numeral_mode] 	= "numeral-mode";
+	fNames[k_numeral_root] 	= "numeral-root";
+	fNames[k_octave] 	= "octave";
+	fNames[k_octave_change] 	= "octave-change";
+	fNames[k_octave_shift] 	= "octave-shift";
+	fNames[k_offset] 	= "offset";
+	fNames[k_open] 	= "open";
+	fNames[k_open_string] 	= "open-string";
+	fNames[k_opus] 	= "opus";
+	fNames[k_ornaments] 	= "ornaments";
+	fNames[k_other_appearance] 	= "other-appearance";
+	fNames[k_other_articulation] 	= "other-articulation";
+	fNames[k_other_direction] 	= "other-direction";
+	fNames[k_other_dynamics] 	= "other-dynamics";
+	fNames[k_other_listen] 	= "other-listen";
+	fNames[k_other_listening] 	= "other-listening";
+	fNames[k_other_notation] 	= "other-notation";
+	fNames[k_other_ornament] 	= "other-ornament";
+	fNames[k_other_percussion] 	= "other-percussion";
+	fNames[k_other_play] 	= "other-play";
+	fNames[k_other_technical] 	= "other-technical";
+	fNames[k_p] 	= "p";
+	fNames[k_page_height] 	= "page-height";
+	fNames[k_page_layout] 	= "page-layout";
+	fNames[k_page_margins] 	= "page-margins";
+	fNames[k_page_width] 	= "page-width";
+	fNames[k_pan] 	= "pan";
+	fNames[k_part] 	= "part";
+	fNames[k_part_abbreviation] 	= "part-abbreviation";
+	fNames[k_part_abbreviation_display] 	= "part-abbreviation-display";
+	fNames[k_part_clef] 	= "part-clef";
+	fNames[k_part_group] 	= "part-group";
+	fNames[k_part_link] 	= "part-link";
+	fNames[k_part_list] 	= "part-list";
+	fNames[k_part_name] 	= "part-name";
+	fNames[k_part_name_display] 	= "part-name-display";
+	fNames[k_part_symbol] 	= "part-symbol";
+	fNames[k_part_transpose] 	= "part-transpose";
+	fNames[k_pedal] 	= "pedal";
+	fNames[k_pedal_alter] 	= "pedal-alter";
+	fNames[k_pedal_step] 	= "pedal-step";
+	fNames[k_pedal_tuning] 	= "pedal-tuning";
+	fNames[k_per_minute] 	= "per-minute";
+	fNames[k_percussion] 	= "percussion";
+	fNames[k_pf] 	= "pf";
+	fNames[k_pitch] 	= "pitch";
+	fNames[k_pitched] 	= "pitched";
+	fNames[k_play] 	= "play";
+	fNames[k_player] 	= "player";
+	fNames[k_player_name] 	= "player-name";
+	fNames[k_plop] 	= "plop";
+	fNames[k_pluck] 	= "pluck";
+	fNames[k_pp] 	= "pp";
+	fNames[k_ppp] 	= "ppp";
+	fNames[k_pppp] 	= "pppp";
+	fNames[k_ppppp] 	= "ppppp";
+	fNames[k_pppppp] 	= "pppppp";
+	fNames[k_pre_bend] 	= "pre-bend";
+	fNames[k_prefix] 	= "prefix";
+	fNames[k_principal_voice] 	= "principal-voice";
+	fNames[k_print] 	= "print";
+	fNames[k_pull_off] 	= "pull-off";
+	fNames[k_rehearsal] 	= "rehearsal";
+	fNames[k_relation] 	= "relation";
+	fNames[k_release] 	= "release";
+	fNames[k_repeat] 	= "repeat";
+	fNames[k_rest] 	= "rest";
+	fNames[k_rf] 	= "rf";
+	fNames[k_rfz] 	= "rfz";
+	fNames[k_right_divider] 	= "right-divider";
+	fNames[k_right_margin] 	= "right-margin";
+	fNames[k_rights] 	= "rights";
+	fNames[k_root] 	= "root";
+	fNames[k_root_alter] 	= "root-alter";
+	fNames[k_root_step] 	= "root-step";
+	fNames[k_scaling] 	= "scaling";
+	fNames[k_schleifer] 	= "schleifer";
+	fNames[k_scoop] 	= "scoop";
+	fNames[k_scordatura] 	= "scordatura";
+	fNames[k_score_instrument] 	= "score-instrument";
+	fNames[k_score_part] 	= "score-part";
+	fNames[k_score_partwise] 	= "score-partwise";
+	fNames[k_score_timewise] 	= "score-timewise";
+	fNames[k_second] 	= "second";
+	fNames[k_segno] 	= "segno";
+	fNames[k_semi_pitched] 	= "semi-pitched";
+	fNames[k_senza_misura] 	= "senza-misura";
+	fNames[k_sf] 	= "sf";
+	fNames[k_sffz] 	= "sffz";
+	fNames[k_sfp] 	= "sfp";
+	fNames[k_sfpp] 	= "sfpp";
+	fNames[k_sfz] 	= "sfz";
+	fNames[k_sfzp] 	= "sfzp";
+	fNames[k_shake] 	= "shake";
+	fNames[k_sign] 	= "sign";
+	fNames[k_slash] 	= "slash";
+	fNames[k_slash_dot] 	= "slash-dot";
+	fNames[k_slash_type] 	= "slash-type";
+	fNames[k_slide] 	= "slide";
+	fNames[k_slur] 	= "slur";
+	fNames[k_smear] 	= "smear";
+	fNames[k_snap_pizzicato] 	= "snap-pizzicato";
+	fNames[k_soft_accent] 	= "soft-accent";
+	fNames[k_software] 	= "software";
+	fNames[k_solo] 	= "solo";
+	fNames[k_sound] 	= "sound";
+	fNames[k_sounding_pitch] 	= "sounding-pitch";
+	fNames[k_source] 	= "source";
+	fNames[k_spiccato] 	= "spiccato";
+	fNames[k_staccatissimo] 	= "staccatissimo";
+	fNames[k_staccato] 	= "staccato";
+	fNames[k_staff] 	= "staff";
+	fNames[k_staff_details] 	= "staff-details";
+	fNames[k_staff_distance] 	= "staff-distance";
+	fNames[k_staff_divide] 	= "staff-divide";
+	fNames[k_staff_layout] 	= "staff-layout";
+	fNames[k_staff_lines] 	= "staff-lines";
+	fNames[k_staff_size] 	= "staff-size";
+	fNames[k_staff_tuning] 	= "staff-tuning";
+	fNames[k_staff_type] 	= "staff-type";
+	fNames[k_staves] 	= "staves";
+	fNames[k_stem] 	= "stem";
+	fNames[k_step] 	= "step";
+	fNames[k_stick] 	= "stick";
+	fNames[k_stick_location] 	= "stick-location";
+	fNames[k_stick_material] 	= "stick-material";
+	fNames[k_stick_type] 	= "stick-type";
+	fNames[k_stopped] 	= "stopped";
+	fNames[k_straight] 	= "straight";
+	fNames[k_stress] 	= "stress";
+	fNames[k_string] 	= "string";
+	fNames[k_string_mute] 	= "string-mute";
+	fNames[k_strong_accent] 	= "strong-accent";
+	fNames[k_suffix] 	= "suffix";
+	fNames[k_supports] 	= "supports";
+	fNames[k_swing] 	= "swing";
+	fNames[k_swing_style] 	= "swing-style";
+	fNames[k_swing_type] 	= "swing-type";
+	fNames[k_syllabic] 	= "syllabic";
+	fNames[k_symbol] 	= "symbol";
+	fNames[k_sync] 	= "sync";
+	fNames[k_system_distance] 	= "system-distance";
+	fNames[k_system_dividers] 	= "system-dividers";
+	fNames[k_system_layout] 	= "system-layout";
+	fNames[k_system_margins] 	= "system-margins";
+	fNames[k_tap] 	= "tap";
+	fNames[k_technical] 	= "technical";
+	fNames[k_tenths] 	= "tenths";
+	fNames[k_tenuto] 	= "tenuto";
+	fNames[k_text] 	= "text";
+	fNames[k_thumb_position] 	= "thumb-position";
+	fNames[k_tie] 	= "tie";
+	fNames[k_tied] 	= "tied";
+	fNames[k_time] 	= "time";
+	fNames[k_time_modification] 	= "time-modification";
+	fNames[k_time_relation] 	= "time-relation";
+	fNames[k_timpani] 	= "timpani";
+	fNames[k_toe] 	= "toe";
+	fNames[k_top_margin] 	= "top-margin";
+	fNames[k_top_system_distance] 	= "top-system-distance";
+	fNames[k_touching_pitch] 	= "touching-pitch";
+	fNames[k_transpose] 	= "transpose";
+	fNames[k_tremolo] 	= "tremolo";
+	fNames[k_trill_mark] 	= "trill-mark";
+	fNames[k_triple_tongue] 	= "triple-tongue";
+	fNames[k_tuning_alter] 	= "tuning-alter";
+	fNames[k_tuning_octave] 	= "tuning-octave";
+	fNames[k_tuning_step] 	= "tuning-step";
+	fNames[k_tuplet] 	= "tuplet";
+	fNames[k_tuplet_actual] 	= "tuplet-actual";
+	fNames[k_tuplet_dot] 	= "tuplet-dot";
+	fNames[k_tuplet_normal] 	= "tuplet-normal";
+	fNames[k_tuplet_number] 	= "tuplet-number";
+	fNames[k_tuplet_type] 	= "tuplet-type";
+	fNames[k_turn] 	= "turn";
+	fNames[k_type] 	= "type";
+	fNames[k_unpitched] 	= "unpitched";
+	fNames[k_unstress] 	= "unstress";
+	fNames[k_up_bow] 	= "up-bow";
+	fNames[k_vertical_turn] 	= "vertical-turn";
+	fNames[k_virtual_instrument] 	= "virtual-instrument";
+	fNames[k_virtual_library] 	= "virtual-library";
+	fNames[k_virtual_name] 	= "virtual-name";
+	fNames[k_voice] 	= "voice";
+	fNames[k_volume] 	= "volume";
+	fNames[k_wait] 	= "wait";
+	fNames[k_wavy_line] 	= "wavy-line";
+	fNames[k_wedge] 	= "wedge";
+	fNames[k_with_bar] 	= "with-bar";
+	fNames[k_wood] 	= "wood";
+	fNames[k_word_font] 	= "word-font";
+	fNames[k_words] 	= "words";
+	fNames[k_work] 	= "work";
+	fNames[k_work_number] 	= "work-number";
+	fNames[k_work_title] 	= "work-title";
 }
 }
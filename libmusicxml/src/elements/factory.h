@@ -14,8 +14,7 @@
 #define __factory__
 
 #include <string>
-#include <map>
-#include "functor.h"
+#include "elements.h"
 #include "singleton.h"
 #include "xml.h"
 
@@ -27,16 +26,34 @@ namespace MusicXML2
 @{
 */
 
+/*!
+\brief The elements factory.
+
+	Element names are mapped to element types using a perfect hash generated
+	from the MusicXML DTD, element types index the constructors table.
+	The elements names are shared by all the elements of a given type.
+*/
 class EXP factory : public singleton<factory>{
 
-	std::map<std::string, functor<Sxmlelement>*> fMap;
-	std::map<int, const char*>	fType2Name;
+	typedef Sxmlelement (*constructor)(int inputLineNumber);
+
+	constructor	fConstructors[kEndElement];
+	std::string	fNames[kEndElement];
 	public:
 				 factory();
 		virtual ~factory() {}
 
-		Sxmlelement create(const std::string& elt) const;	
-		Sxmlelement create(int type) const;	
+		//! creates an element with no input line number, to be used when generating MusicXML
+		Sxmlelement create(const std::string& elt) const				{ return create (elt, 0); }
+		Sxmlelement create(int type) const								{ return create (type, 0); }
+
+		//! creates an element read from the given input line
+		Sxmlelement create(const std::string& elt, int inputLineNumber) const	{ return create (elt.data(), elt.size(), inputLineNumber); }
+		Sxmlelement create(const char* elt, size_t len, int inputLineNumber) const;
+		Sxmlelement create(int type, int inputLineNumber) const;
+
+		//! returns the type of an element given its name, kNoElement when unknown
+		int			type (const char* name, size_t len) const;
 };
 
 }
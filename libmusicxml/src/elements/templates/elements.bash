@@ -33,17 +33,88 @@ case $3 in
     # to standard output
     cat $2/license.txt $2/factory.txt
 
-    # generate fMap entries for the markups found in the DTD
-   for a in $(cat $1 | cut -d' ' -f1 | sort -u)
+    # generate a perfect hash from the element names to the element types:
+    # the name is hashed twice, h selects a bucket which displacement is added to g
+    # the displacements are searched for the largest buckets first
+    (echo comment kComment; echo pi kProcessingInstruction
+     for a in $(cat $1 | cut -d' ' -f1 | sort -u)
+     do
+       echo "$a $(kname $a)"
+     done) | awk '
+      BEGIN { buckets = 256; slots = 1024; for (i = 1; i < 256; i++) ord[sprintf("%c", i)] = i }
+      {
+        name[NR] = $1; type[NR] = $2; h = 0; g = 0
+        for (i = 1; i <= length($1); i++) {
+          c = ord[substr($1, i, 1)]
+          h = (h * 31 + c) % 4294967296
+          g = (g * 257 + c) % 4294967296
+        }
+        b = h % buckets; hash[NR] = g
+        keys[b, ++size[b]] = NR
+        if (size[b] > maxsize) maxsize = size[b]
+      }
+      END {
+        for (n = maxsize; n > 0; n--) {
+          for (b = 0; b < buckets; b++) {
+            if (size[b] != n) continue
+            for (d = 0; d < slots; d++) {
+              ok = 1; split("", used)
+              for (k = 1; ok && (k <= n); k++) {
+                s = (hash[keys[b, k]] + d) % slots
+                if ((s in table) || (s in used)) ok = 0
+                used[s] = 1
+              }
+              if (ok) break
+            }
+            if (!ok) { print "#error no perfect hash found"; exit 1 }
+            displacement[b] = d
+            for (k = 1; k <= n; k++) table[(hash[keys[b, k]] + d) % slots] = type[keys[b, k]]
+          }
+        }
+        print "static const unsigned short kDisplacements[kBuckets] = {"
+        for (b = 0; b < buckets; b++) printf("%s%d,%s", (b % 16) ? " " : "\t", displacement[b] + 0, (b % 16 == 15) ? "\n" : "")
+        print "};"
+        print ""
+        print "static const short kSlots[kSlotsCount] = {"
+        for (s = 0; s < slots; s++) print "\t" ((s in table) ? table[s] : "kNoElement") ","
+        print "};"
+        print ""
+      }' || exit 1
+
+    cat << !
+int factory::type (const char* name, size_t len) const
+{
+	unsigned int h = 0, g = 0;
+	for (size_t i = 0; i < len; i++) {
+		unsigned char c = name[i];
+		h = h * 31 + c;
+		g = g * 257 + c;
+	}
+	int type = kSlots[(g + kDisplacements[h % kBuckets]) % kSlotsCount];
+	const string& eltname = fNames[type];
+	return ((eltname.size() == len) && !eltname.compare (0, len, name, len)) ? type : kNoElement;
+}
+
+factory::factory()
+{
+	fConstructors[kNoElement] = 0;
+	fConstructors[kComment] = newElement<kComment>;
+	fConstructors[kProcessingInstruction] = newElement<kProcessingInstruction>;
+	fNames[kComment] = "comment";
+	fNames[kProcessingInstruction] = "pi";
+
+!
+
+    # generate the constructors and names tables entries for the markups found in the DTD
+    for a in $(cat $1 | cut -d' ' -f1 | sort -u)
     do
-      echo "	fMap[\"$a\"] 	= new newElementFunctor<$(kname $a)>;"
+      echo "	fConstructors[$(kname $a)] 	= newElement<$(kname $a)>;"
     done
     echo
 
-    # generate fType2Name entries for the markups found in the DTD
     for a in $(cat $1 | cut -d' ' -f1 | sort -u)
     do
-      echo "	fType2Name[$(kname $a)] 	= \"$a\";"
+      echo "	fNames[$(kname $a)] 	= \"$a\";"
     done
 
     # generate epiloque
@@ -66,7 +66,7 @@ xmlattribute::operator float () const	{ return (float)atof(fValue.c_str()); }
 Sxmlelement xmlelement::create(int lineno)			{ xmlelement * o = new xmlelement(lineno); assert(o!=0); return o; }
 void xmlelement::setValue (int value)				{ setValue((long)value); }
 void xmlelement::setValue (const string& value) 	{ fValue = value; }
-void xmlelement::setName (const string& name) 		{ fName = name; }
+void xmlelement::setName (const string& name) 		{ fLocalName = name; fName = &fLocalName; }
 //______________________________________________________________________________
 void xmlelement::setValue (long value)
 {
@@ -100,7 +100,7 @@ long xmlelement::add (const Sxmlattribute& attr)
 
 //______________________________________________________________________________
 void xmlelement::acceptIn(basevisitor& v) {
-	visitor<Sxmlelement>* p = dynamic_cast<visitor<Sxmlelement>*>(&v);
+	visitor<Sxmlelement>* p = visitor<Sxmlelement>::cast (&v);
 	if (p) {
 		Sxmlelement xml = this;
 		p->visitStart (xml);
@@ -109,7 +109,7 @@ void xmlelement::acceptIn(basevisitor& v) {
 
 //______________________________________________________________________________
 void xmlelement::acceptOut(basevisitor& v) {
-	visitor<Sxmlelement>* p = dynamic_cast<visitor<Sxmlelement>*>(&v);
+	visitor<Sxmlelement>* p = visitor<Sxmlelement>::cast (&v);
 	if (p) {
 		Sxmlelement xml = this;
 		p->visitEnd (xml);
@@ -21,6 +21,7 @@
 #endif
 
 #include "exports.h"
+#include "arena.h"
 #include "ctree.h"
 #include "smartpointer.h"
 
@@ -55,8 +56,14 @@ class EXP xmlattribute : public smartable {
     public:
 		static SMARTP<xmlattribute> create();
 
+		//! attributes are allocated in the current arena, if any
+		static void* operator new (size_t size)		{ return arena::newObject (size); }
+		static void  operator delete (void* ptr)	{ arena::deleteObject (ptr); }
+
 		void setName (const std::string& name);
 		void setValue (const std::string& value);
+		void setName (const char* name, size_t len)		{ fName.assign (name, len); }
+		void setValue (const char* value, size_t len)	{ fValue.assign (value, len); }
 		void setValue (long value);
 		void setValue (int value);
 		void setValue (float value);
@@ -85,8 +92,10 @@ class EXP xmlattribute : public smartable {
 class EXP xmlelement : public ctree<xmlelement>, public visitable
 {
 	private:
-		//! the element name
-		std::string fName;
+		//! the element name, shared by the elements created by the factory
+		const std::string* fName;
+		//! the name storage when set using setName (const std::string&)
+		std::string fLocalName;
 		//! the element value
 		std::string fValue;
 		//! list of the element attributes
@@ -104,7 +113,8 @@ class EXP xmlelement : public ctree<xmlelement>, public visitable
 //     JMI
 //     xmlelement (int inputLineNumber) : fType(0), fInputLineNumber(inputLineNumber) {}
     xmlelement (int inputStartLineNumber)
-      : fType(0),
+      : fName (&fLocalName),
+        fType(0),
         fInputStartLineNumber (inputStartLineNumber),
         fInputEndLineNumber (inputStartLineNumber) // default value JMI v0.9.69
     {}
@@ -116,6 +126,10 @@ class EXP xmlelement : public ctree<xmlelement>, public visitable
 
 		static SMARTP<xmlelement> create (int inputStartLineNumber);
 
+		//! elements are allocated in the current arena, if any
+		static void* operator new (size_t size)		{ return arena::newObject (size); }
+		static void  operator delete (void* ptr)	{ arena::deleteObject (ptr); }
+
 		virtual void acceptIn  (basevisitor& visitor);
 		virtual void acceptOut (basevisitor& visitor);
 
@@ -137,9 +151,12 @@ class EXP xmlelement : public ctree<xmlelement>, public visitable
 		void setValue (float value);
 		void setValue (const std::string& value);
 		void setName  (const std::string& name);
+		//! sets a shared name, which must outlive the element
+		void setName  (const std::string* name)			{ fName = name; }
+		void setValue (const char* value, size_t len)	{ fValue.assign (value, len); }
 
 		int                 getType () const    { return fType; }
-		const std::string&  getName () const    { return fName; }
+		const std::string&  getName () const    { return *fName; }
 
 		//! returns the element value as a string
 		const std::string& getValue () const    { return fValue; }
@@ -0,0 +1,95 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#ifdef MSVC
+# pragma warning (disable : 4786)
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#ifndef WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#include "mappedfile.h"
+
+namespace MusicXML2
+{
+
+static const char* kEmptyData = "";
+
+//______________________________________________________________________________
+#ifndef WIN32
+mappedfile::mappedfile (const char* file) : fData(0), fSize(0), fMapped(false)
+{
+	int fd = open (file, O_RDONLY);
+	if (fd < 0) return;
+
+	struct stat st;
+	if (fstat (fd, &st) == 0) {
+		if (st.st_size == 0)
+			fData = kEmptyData;
+		else {
+			void* addr = mmap (0, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+			if (addr != MAP_FAILED) {
+				// the file is read once from start to end
+				madvise (addr, st.st_size, MADV_SEQUENTIAL);
+				fData = (const char*)addr;
+				fSize = st.st_size;
+				fMapped = true;
+			}
+		}
+	}
+	close (fd);
+}
+
+#else
+mappedfile::mappedfile (const char* file) : fData(0), fSize(0), fMapped(false)
+{
+	FILE * fd = fopen (file, "rb");
+	if (!fd) return;
+
+	fseek (fd, 0, SEEK_END);
+	long size = ftell (fd);
+	fseek (fd, 0, SEEK_SET);
+	if (size == 0)
+		fData = kEmptyData;
+	else if (size > 0) {
+		char* buff = (char*)malloc (size);
+		if (buff && (fread (buff, 1, size, fd) == size_t(size))) {
+			fData = buff;
+			fSize = size;
+		}
+		else free (buff);
+	}
+	fclose (fd);
+}
+#endif
+
+//______________________________________________________________________________
+mappedfile::~mappedfile ()
+{
+	if (!fSize) return;
+#ifndef WIN32
+	if (fMapped) {
+		munmap ((void*)fData, fSize);
+		return;
+	}
+#endif
+	free ((void*)fData);
+}
+
+}
@@ -0,0 +1,52 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#ifndef __mappedfile__
+#define __mappedfile__
+
+#include <stddef.h>
+#include "exports.h"
+
+namespace MusicXML2
+{
+
+//______________________________________________________________________________
+/*!
+\brief A read only view of a whole file contents.
+
+	The file is memory mapped when the platform supports it,
+	otherwise it is read at once into a memory buffer.
+	The data remains valid as long as the object is alive.
+*/
+class EXP mappedfile
+{
+	const char*	fData;
+	size_t		fSize;
+	bool		fMapped;		// true when fData comes from mmap, false when allocated
+
+	public:
+				 mappedfile (const char* file);
+		virtual ~mappedfile ();
+
+		//! true when the file has been successfully opened
+		bool		opened () const		{ return fData != 0; }
+		const char*	data () const		{ return fData; }
+		size_t		size () const		{ return fSize; }
+
+	private:
+		mappedfile (const mappedfile&);
+		mappedfile& operator= (const mappedfile&);
+};
+
+}
+
+#endif
@@ -0,0 +1,364 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#ifdef MSVC
+# pragma warning (disable : 4786)
+#endif
+
+#include <string.h>
+
+#include "mxlfile.h"
+
+using namespace std;
+
+namespace MusicXML2
+{
+
+//______________________________________________________________________________
+// zip archives values are little endian
+static inline unsigned get16 (const unsigned char* p)	{ return p[0] | (p[1] << 8); }
+static inline unsigned get32 (const unsigned char* p)	{ return get16(p) | (get16(p + 2) << 16); }
+
+enum {
+	kLocalHeaderSig		= 0x04034b50,	kLocalHeaderSize	= 30,
+	kCentralHeaderSig	= 0x02014b50,	kCentralHeaderSize	= 46,
+	kEndOfDirSig		= 0x06054b50,	kEndOfDirSize		= 22,
+	kStored = 0, kDeflated = 8
+};
+
+//______________________________________________________________________________
+struct crctable {
+	unsigned fValues[256];
+	crctable () {
+		for (unsigned n = 0; n < 256; n++) {
+			unsigned c = n;
+			for (int k = 0; k < 8; k++) c = (c & 1) ? 0xedb88320 ^ (c >> 1) : c >> 1;
+			fValues[n] = c;
+		}
+	}
+};
+
+static unsigned crc32 (const char* data, size_t size)
+{
+	static const crctable table;
+	unsigned crc = 0xffffffff;
+	for (size_t i = 0; i < size; i++)
+		crc = table.fValues[(crc ^ (unsigned char)data[i]) & 0xff] ^ (crc >> 8);
+	return crc ^ 0xffffffff;
+}
+
+//______________________________________________________________________________
+/*
+	A deflate decoder (RFC 1951), after Mark Adler's puff.
+*/
+class inflater
+{
+	struct huffman {
+		short	fCount[16];		// number of symbols of each length
+		short	fSymbol[288];	// the symbols ordered by length
+	};
+	struct error {};
+
+	const unsigned char*	fIn;
+	size_t					fInSize;
+	size_t					fInPos;
+	unsigned				fBitBuf;
+	int						fBitCount;
+	string&					fOut;
+
+	int bits (int need) {
+		unsigned val = fBitBuf;
+		while (fBitCount < need) {
+			if (fInPos == fInSize) throw error();
+			val |= unsigned(fIn[fInPos++]) << fBitCount;
+			fBitCount += 8;
+		}
+		fBitBuf = val >> need;
+		fBitCount -= need;
+		return int(val & ((1U << need) - 1));
+	}
+
+	int decode (const huffman& h) {
+		int code = 0, first = 0, index = 0;
+		for (int len = 1; len < 16; len++) {
+			code |= bits(1);
+			int count = h.fCount[len];
+			if (code - count < first) return h.fSymbol[index + (code - first)];
+			index += count;
+			first += count;
+			first <<= 1;
+			code <<= 1;
+		}
+		throw error();
+	}
+
+	// builds a decoding table, returns 0 for a complete code, > 0 for an incomplete one
+	static int construct (huffman& h, const short* length, int n) {
+		for (int len = 0; len < 16; len++) h.fCount[len] = 0;
+		for (int symbol = 0; symbol < n; symbol++) h.fCount[length[symbol]]++;
+		if (h.fCount[0] == n) return 0;
+
+		int left = 1;
+		for (int len = 1; len < 16; len++) {
+			left <<= 1;
+			left -= h.fCount[len];
+			if (left < 0) throw error();		// over-subscribed
+		}
+		short offs[16];
+		offs[1] = 0;
+		for (int len = 1; len < 15; len++) offs[len + 1] = offs[len] + h.fCount[len];
+		for (int symbol = 0; symbol < n; symbol++)
+			if (length[symbol]) h.fSymbol[offs[length[symbol]]++] = symbol;
+		return left;
+	}
+
+	void stored () {
+		fBitBuf = 0;
+		fBitCount = 0;
+		if (fInPos + 4 > fInSize) throw error();
+		unsigned len = get16 (fIn + fInPos);
+		if ((~get16 (fIn + fInPos + 2) & 0xffff) != len) throw error();
+		fInPos += 4;
+		if (fInPos + len > fInSize) throw error();
+		fOut.append ((const char*)fIn + fInPos, len);
+		fInPos += len;
+	}
+
+	void codes (const huffman& lencode, const huffman& distcode) {
+		static const short lbase[29] = {
+			3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+			35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+		static const short lext[29] = {
+			0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+			3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+		static const short dbase[30] = {
+			1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+			257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145,
+			8193, 12289, 16385, 24577 };
+		static const short dext[30] = {
+			0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+			7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+
+		while (true) {
+			int symbol = decode (lencode);
+			if (symbol < 256) fOut += char(symbol);
+			else if (symbol == 256) return;
+			else {
+				symbol -= 257;
+				if (symbol >= 29) throw error();
+				size_t len = lbase[symbol] + bits (lext[symbol]);
+				symbol = decode (distcode);
+				if (symbol >= 30) throw error();
+				size_t dist = dbase[symbol] + bits (dext[symbol]);
+				if (dist > fOut.size()) throw error();
+				// the copy may overlap the bytes it produces
+				size_t from = fOut.size() - dist;
+				for (size_t i = 0; i < len; i++) fOut += fOut[from + i];
+			}
+		}
+	}
+
+	struct fixedcodes {
+		huffman fLencode, fDistcode;
+		fixedcodes () {
+			short lengths[288];
+			int symbol = 0;
+			for (; symbol < 144; symbol++) lengths[symbol] = 8;
+			for (; symbol < 256; symbol++) lengths[symbol] = 9;
+			for (; symbol < 280; symbol++) lengths[symbol] = 7;
+			for (; symbol < 288; symbol++) lengths[symbol] = 8;
+			construct (fLencode, lengths, 288);
+			for (symbol = 0; symbol < 30; symbol++) lengths[symbol] = 5;
+			construct (fDistcode, lengths, 30);
+		}
+	};
+
+	void fixed () {
+		static const fixedcodes fixedCodes;
+		codes (fixedCodes.fLencode, fixedCodes.fDistcode);
+	}
+
+	void dynamic () {
+		static const short order[19] = { 16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15 };
+		short lengths[320];
+		int nlen = bits(5) + 257;
+		int ndist = bits(5) + 1;
+		int ncode = bits(4) + 4;
+		if ((nlen > 286) || (ndist > 30)) throw error();
+
+		int index = 0;
+		for (; index < ncode; index++) lengths[order[index]] = bits(3);
+		for (; index < 19; index++) lengths[order[index]] = 0;
+		huffman lencode, distcode;
+		if (construct (lencode, lengths, 19)) throw error();
+
+		index = 0;
+		while (index < nlen + ndist) {
+			int symbol = decode (lencode);
+			if (symbol < 16) lengths[index++] = symbol;
+			else {
+				int len = 0, repeat;
+				if (symbol == 16) {
+					if (!index) throw error();
+					len = lengths[index - 1];
+					repeat = 3 + bits(2);
+				}
+				else if (symbol == 17) repeat = 3 + bits(3);
+				else repeat = 11 + bits(7);
+				if (index + repeat > nlen + ndist) throw error();
+				while (repeat--) lengths[index++] = len;
+			}
+		}
+		if (!lengths[256]) throw error();	// no end of block code
+		int err = construct (lencode, lengths, nlen);
+		if (err && ((err < 0) || (nlen != lencode.fCount[0] + lencode.fCount[1]))) throw error();
+		err = construct (distcode, lengths + nlen, ndist);
+		if (err && ((err < 0) || (ndist != distcode.fCount[0] + distcode.fCount[1]))) throw error();
+		codes (lencode, distcode);
+	}
+
+	public:
+		inflater (const unsigned char* in, size_t size, string& out)
+			: fIn(in), fInSize(size), fInPos(0), fBitBuf(0), fBitCount(0), fOut(out) {}
+
+		bool inflate () {
+			try {
+				int last;
+				do {
+					last = bits(1);
+					switch (bits(2)) {
+						case 0:	stored(); break;
+						case 1: fixed(); break;
+						case 2: dynamic(); break;
+						default: return false;
+					}
+				} while (!last);
+			}
+			catch (error&) {
+				return false;
+			}
+			return true;
+		}
+};
+
+//______________________________________________________________________________
+mxlfile::mxlfile (const char* file) : fFile (file), fOpened(false)
+{
+	if (!fFile.opened())
+		fail (string("can't open file ") + file);
+	else
+		fOpened = readCentralDirectory();
+}
+
+//______________________________________________________________________________
+bool mxlfile::readCentralDirectory ()
+{
+	const unsigned char* data = (const unsigned char*)fFile.data();
+	size_t size = fFile.size();
+	if (size < kEndOfDirSize) return fail ("not a zip archive");
+
+	// the end of central directory record is followed by a comment of at most 64 KB
+	const unsigned char* end = 0;
+	size_t limit = (size > kEndOfDirSize + 0xffff) ? size - kEndOfDirSize - 0xffff : 0;
+	for (size_t pos = size - kEndOfDirSize + 1; pos-- > limit; ) {
+		if (get32 (data + pos) == kEndOfDirSig) {
+			end = data + pos;
+			break;
+		}
+	}
+	if (!end) return fail ("not a zip archive");
+
+	unsigned count = get16 (end + 10);
+	size_t offset = get32 (end + 16);
+	if ((count == 0xffff) || (offset == 0xffffffff)) return fail ("zip64 archives are not supported");
+
+	for (unsigned i = 0; i < count; i++) {
+		if ((offset + kCentralHeaderSize > size) || (get32 (data + offset) != kCentralHeaderSig))
+			return fail ("corrupted zip central directory");
+		const unsigned char* header = data + offset;
+		size_t namelen = get16 (header + 28);
+		size_t next = offset + kCentralHeaderSize + namelen + get16 (header + 30) + get16 (header + 32);
+		if (next > size) return fail ("corrupted zip central directory");
+
+		entry e;
+		e.fMethod = get16 (header + 10);
+		e.fCrc = get32 (header + 16);
+		e.fCompressedSize = get32 (header + 20);
+		e.fSize = get32 (header + 24);
+		e.fLocalHeader = get32 (header + 42);
+		e.fName.assign ((const char*)header + kCentralHeaderSize, namelen);
+		fEntries.push_back (e);
+		offset = next;
+	}
+	return true;
+}
+
+//______________________________________________________________________________
+bool mxlfile::extract (const string& name, string& data)
+{
+	const entry* e = 0;
+	for (auto& i: fEntries) {
+		if (i.fName == name) {
+			e = &i;
+			break;
+		}
+	}
+	if (!e) return fail ("no " + name + " entry in the archive");
+
+	const unsigned char* base = (const unsigned char*)fFile.data();
+	size_t size = fFile.size();
+	if ((e->fLocalHeader + kLocalHeaderSize > size) || (get32 (base + e->fLocalHeader) != kLocalHeaderSig))
+		return fail ("corrupted zip entry " + name);
+	const unsigned char* header = base + e->fLocalHeader;
+	size_t start = e->fLocalHeader + kLocalHeaderSize + get16 (header + 26) + get16 (header + 28);
+	if ((start > size) || (e->fCompressedSize > size - start))
+		return fail ("corrupted zip entry " + name);
+
+	data.clear();
+	data.reserve (e->fSize);
+	if (e->fMethod == kStored)
+		data.assign ((const char*)base + start, e->fCompressedSize);
+	else if (e->fMethod == kDeflated) {
+		inflater i (base + start, e->fCompressedSize, data);
+		if (!i.inflate()) return fail ("corrupted compressed data in entry " + name);
+	}
+	else return fail ("unsupported compression method for entry " + name);
+
+	if ((data.size() != e->fSize) || (crc32 (data.data(), data.size()) != e->fCrc))
+		return fail ("crc error in entry " + name);
+	return true;
+}
+
+//______________________________________________________________________________
+// the first rootfile element of the container gives the root file path
+string mxlfile::rootFile ()
+{
+	string container;
+	if (extract ("META-INF/container.xml", container)) {
+		size_t pos = container.find ("<rootfile");
+		if (pos != string::npos) pos = container.find ("full-path", pos);
+		if (pos != string::npos) pos = container.find_first_of ("\"'", pos);
+		if (pos != string::npos) {
+			size_t end = container.find (container[pos], pos + 1);
+			if (end != string::npos) return container.substr (pos + 1, end - pos - 1);
+		}
+	}
+	for (auto& e: fEntries) {
+		const string& name = e.fName;
+		if ((name.compare (0, 9, "META-INF/") != 0) && (name.size() > 4) && (name.compare (name.size() - 4, 4, ".xml") == 0))
+			return name;
+	}
+	fail ("no MusicXML file in the archive");
+	return "";
+}
+
+}
@@ -0,0 +1,73 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#ifndef __mxlfile__
+#define __mxlfile__
+
+#include <string>
+#include <vector>
+#include "exports.h"
+#include "mappedfile.h"
+
+namespace MusicXML2
+{
+
+//______________________________________________________________________________
+/*!
+\brief A compressed MusicXML (.mxl) file.
+
+	An mxl file is a zip archive: its central directory is read from the
+	memory mapped file and the entries are inflated in memory.
+	The root MusicXML file is given by the META-INF/container.xml entry.
+	Only the stored and deflated compression methods are supported,
+	which are the ones allowed by the MusicXML specification.
+*/
+class EXP mxlfile
+{
+	public:
+		struct entry {
+			std::string	fName;
+			int			fMethod;			// 0: stored, 8: deflated
+			unsigned	fCrc;
+			size_t		fCompressedSize;
+			size_t		fSize;
+			size_t		fLocalHeader;		// the local header offset
+		};
+
+				 mxlfile (const char* file);
+		virtual ~mxlfile() {}
+
+		//! true when the file is a readable zip archive
+		bool	opened () const							{ return fOpened; }
+		//! a message describing the last error
+		const std::string&	error () const				{ return fError; }
+
+		const std::vector<entry>&	entries () const	{ return fEntries; }
+
+		//! inflates the named entry into data, returns false in case of error
+		bool	extract (const std::string& name, std::string& data);
+		//! the root file path from META-INF/container.xml, or the first .xml entry outside of META-INF
+		std::string	rootFile ();
+
+	private:
+		mappedfile			fFile;
+		bool				fOpened;
+		std::vector<entry>	fEntries;
+		std::string			fError;
+
+		bool	readCentralDirectory ();
+		bool	fail (const std::string& msg)	{ fError = msg; return false; }
+};
+
+}
+
+#endif
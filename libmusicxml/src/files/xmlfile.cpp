@@ -12,7 +12,7 @@
 
 #include <iostream>
 #include "xmlfile.h"
-#include "xmlvisitor.h"
+#include "xmlwriter.h"
 #include "tree_browser.h"
 
 using namespace std; 
@@ -54,13 +54,14 @@ void TXMLDecl::print (ostream& s)
 }
 
 //______________________________________________________________________________
-void TXMLFile::print (ostream& stream) 
+void TXMLFile::print (ostream& stream, bool compact) 
 {
 	if (fXMLDecl) fXMLDecl->print(stream);
 	if (fDocType) fDocType->print(stream);
-	xmlvisitor v(stream);
-	tree_browser<xmlelement> browser(&v);
+	xmlwriter w(stream, compact);
+	tree_browser<xmlelement> browser(&w);
 	browser.browse(*elements());
+	w.flush();
 }
 
 }
@@ -15,8 +15,17 @@
 #endif
 
 #include <iostream>
+#include <mutex>
+#include <string.h>
 #include "xmlreader.h"
+#include "xmlscanner.h"
+#include "mappedfile.h"
+#include "mxlfile.h"
 #include "factory.h"
+#include "tree_browser.h"
+
+// libmxmllineno is outside of name space MusicXML2
+extern int libmxmllineno;
 
 using namespace std;
 
@@ -35,62 +44,183 @@ bool readbuffer (const char * buffer, reader * r);
 #define debug(str,val)
 #endif
 
+// the flex/bison parser state is global
+static mutex gParserMutex;
+
 //_______________________________________________________________________________
-SXMLFile xmlreader::readbuff(const char* buffer)
+void xmlreader::start()
 {
 	fFile = TXMLFile::create();
+	if (fUseArena) fFile->set (arena::create());
+	fStack = stack<Sxmlelement>();
+	fEntered = 0;
+}
+
+//_______________________________________________________________________________
+// adds a new element to the tree and makes it the current element
+void xmlreader::push(const Sxmlelement& elt)
+{
+	if (!fFile->elements()) {
+		fFile->set(elt);
+	}
+	else {
+		Sxmlelement parent = fStack.top();
+		if (fStack.size() <= fStreamDepth) {
+			// streaming mode: the previous sub-elements are visited, they are released
+			parent->elements().clear();
+			parent->push(elt);
+			// a parent is visited in with its first sub-element, when its attributes are complete
+			if (fStreamVisitor && (fEntered < fStack.size())) {
+				parent->acceptIn(*fStreamVisitor);
+				fEntered = fStack.size();
+			}
+		}
+		else parent->push(elt);
+	}
+	fStack.push(elt);
+}
+
+//_______________________________________________________________________________
+// closes the current element
+void xmlreader::pop()
+{
+	Sxmlelement elt = fStack.top();
+	fStack.pop();
+	size_t depth = fStack.size();
+	if (!fStreamDepth || (depth > fStreamDepth)) return;
+
+	// streaming mode: the element is visited, it remains the last sub-element
+	// of its parent until the next one, so that the parent is never seen empty
+	if (fStreamVisitor) {
+		if (depth == fStreamDepth) {
+			tree_browser<xmlelement> browser(fStreamVisitor);
+			browser.browse(*elt);
+		}
+		else {
+			if (fEntered == depth) elt->acceptIn(*fStreamVisitor);	// an element without sub-elements
+			elt->acceptOut(*fStreamVisitor);
+		}
+	}
+	fEntered = depth;
+	if (depth < fStreamDepth) elt->elements().clear();
+}
+
+//_______________________________________________________________________________
+// the current input line number, from the in place scanner or from the flex lexer
+int xmlreader::lineno()
+{
+	return fScanner ? fScanner->lineno() : libmxmllineno;
+}
+
+//_______________________________________________________________________________
+SXMLFile xmlreader::readbuff(const char* buffer)
+{
+	lock_guard<mutex> lock (gParserMutex);
+	start();
 	debug("read buffer", '-');
+	arena::scope scope (fFile->getArena());
 	return readbuffer (buffer, this) ? fFile : 0;
 }
 
 //_______________________________________________________________________________
 SXMLFile xmlreader::read(const char* file)
 {
-	fFile = TXMLFile::create();
+	lock_guard<mutex> lock (gParserMutex);
+	start();
 	debug("read", file);
+	arena::scope scope (fFile->getArena());
 	return readfile (file, this) ? fFile : 0;
 }
 
 //_______________________________________________________________________________
 SXMLFile xmlreader::read(FILE* file)
 {
-	fFile = TXMLFile::create();
+	lock_guard<mutex> lock (gParserMutex);
+	start();
+	arena::scope scope (fFile->getArena());
 	return readstream (file, this) ? fFile : 0;
 }
 
+//_______________________________________________________________________________
+SXMLFile xmlreader::readbuff(const char* buffer, size_t size)
+{
+	start();
+	debug("read buffer in place", size);
+	xmlscanner scanner (buffer, size, this);
+	arena::scope scope (fFile->getArena());
+	fScanner = &scanner;
+	bool ok = scanner.scan();
+	fScanner = 0;
+	return ok ? fFile : 0;
+}
+
+//_______________________________________________________________________________
+SXMLFile xmlreader::readmapped(const char* file)
+{
+	debug("read mapped", file);
+	mappedfile mapped (file);
+	if (!mapped.opened()) {
+		cerr << "can't open file " << file << endl;
+		return 0;
+	}
+	// the in place scanner doesn't handle UTF-16 encoded files
+	if (xmlscanner::isUTF16 (mapped.data(), mapped.size()))
+		return read (file);
+	return readbuff (mapped.data(), mapped.size());
+}
+
+//_______________________________________________________________________________
+SXMLFile xmlreader::readmxl(const char* file)
+{
+	debug("read mxl", file);
+	mxlfile mxl (file);
+	string root, data;
+	if (mxl.opened()) root = mxl.rootFile();
+	if (root.empty() || !mxl.extract (root, data)) {
+		cerr << file << ": " << mxl.error() << endl;
+		return 0;
+	}
+	if (xmlscanner::isUTF16 (data.data(), data.size())) {
+		cerr << file << ": UTF-16 encoded " << root << " is not supported" << endl;
+		return 0;
+	}
+	return readbuff (data.data(), data.size());
+}
+
 //_______________________________________________________________________________
 void xmlreader::newComment (const char* comment)
 {
-	Sxmlelement elt = factory::instance().create("comment");
+	Sxmlelement elt = factory::instance().create(kComment, lineno());
 	elt->setValue(comment);
 	// comments outside the xml hierarchy are lost
-	if (fStack.size()) fStack.top()->push(elt);
+	if (fStack.size()) {
+		push(elt);
+		pop();
+	}
 }
 
 //_______________________________________________________________________________
 void xmlreader::newProcessingInstruction (const char* pi)
 {
-	Sxmlelement elt = factory::instance().create("pi");
-	elt->setValue(pi);
+	Sxmlelement elt = factory::instance().create(kProcessingInstruction, lineno());
+	// the flex lexer includes the closing "?>" in the processing instruction text
+	size_t n = strlen(pi);
+	if ((n >= 2) && !strcmp (&pi[n-2], "?>")) n -= 2;
+	elt->setValue(pi, n);
 	// processing instructions outside the xml hierarchy are lost
-	if (fStack.size()) fStack.top()->push(elt);
+	if (fStack.size()) {
+		push(elt);
+		pop();
+	}
 }
 
 //_______________________________________________________________________________
 bool xmlreader::newElement (const char* eltName)
 {
 	debug("newElement", eltName);
-	Sxmlelement elt = factory::instance().create(eltName);
+	Sxmlelement elt = factory::instance().create(eltName, lineno());
 	if (!elt) return false;
-	if (!fFile->elements()) {
-	debug("first element", eltName);
-		fFile->set(elt);
-	}
-	else {
-	debug("push element", eltName);
-		fStack.top()->push(elt);
-	}
-	fStack.push(elt);
+	push(elt);
 	return true;
 }
 
@@ -98,9 +228,9 @@ bool xmlreader::newElement (const char* eltName)
 bool xmlreader::endElement (const char* eltName)
 {
 	debug("endElement", eltName);
-	Sxmlelement top = fStack.top();
-	fStack.pop();
-	return top->getName() == eltName;
+	if (fStack.top()->getName() != eltName) return false;
+	pop();
+	return true;
 }
 
 //_______________________________________________________________________________
@@ -117,6 +247,44 @@ bool xmlreader::newAttribute (const char* name, const char *value)
 	return false;
 }
 
+//_______________________________________________________________________________
+// in place variants: element names are looked up without copy
+bool xmlreader::newElement (const char* eltName, size_t len)
+{
+	Sxmlelement elt = factory::instance().create(eltName, len, lineno());
+	if (!elt) return false;
+	push(elt);
+	return true;
+}
+
+//_______________________________________________________________________________
+bool xmlreader::endElement (const char* eltName, size_t len)
+{
+	const string& name = fStack.top()->getName();
+	if ((name.size() != len) || name.compare (0, len, eltName, len)) return false;
+	pop();
+	return true;
+}
+
+//_______________________________________________________________________________
+bool xmlreader::newAttribute (const char* name, size_t namelen, const char *value, size_t vallen)
+{
+	Sxmlattribute attr = xmlattribute::create();
+	if (attr) {
+		attr->setName(name, namelen);
+		attr->setValue(value, vallen);
+		fStack.top()->add(attr);
+		return true;
+	}
+	return false;
+}
+
+//_______________________________________________________________________________
+void xmlreader::setValue (const char* value, size_t len)
+{
+	fStack.top()->setValue(value, len);
+}
+
 //_______________________________________________________________________________
 bool xmlreader::xmlDecl (const char* version, const char *encoding, int standalone)
 {
@@ -22,20 +22,72 @@
 namespace MusicXML2 
 {
 
+class basevisitor;
+class xmlscanner;
+
 //______________________________________________________________________________
+/*!
+\brief Builds a TXMLFile from a MusicXML file or buffer.
+
+	The in place methods (readmapped() and readbuff(buffer, size)) are reentrant:
+	each xmlreader owns its scanner state and line counter, so that several
+	xmlreader instances can read concurrently in separate threads.
+	The other methods use the flex/bison parser, which relies on global state:
+	they are serialized by a mutex.
+
+	In arena mode, the elements and attributes of the tree are allocated in
+	a monotonic arena owned by the TXMLFile: they are released at once
+	when the last of them and the file are released.
+
+	In streaming mode, the elements are visited while they are read and
+	released once visited, so that only a small part of the tree is in memory.
+*/
 class EXP xmlreader : public reader
 { 
 	std::stack<Sxmlelement>	fStack;
 	SXMLFile				fFile;
+	xmlscanner*				fScanner;		// the in place scanner, when in use
+	bool					fUseArena;
+	basevisitor*			fStreamVisitor;
+	size_t					fStreamDepth;	// 0 when not streaming
+	size_t					fEntered;		// the number of streamed levels visited in
+
+	void	start ();
+	int		lineno ();
+	void	push (const Sxmlelement& elt);
+	void	pop ();
 
 	public:
-				 xmlreader() {}
+				 xmlreader() : fScanner(0), fUseArena(false), fStreamVisitor(0), fStreamDepth(0), fEntered(0) {}
 		virtual ~xmlreader() {}
+
+		//! the trees are allocated in an arena when state is true (false by default)
+		void	useArena (bool state)	{ fUseArena = state; }
+
+		/*!
+		\brief Visits the elements while they are read.
+
+			The elements at the given depth (2 for the measures of a partwise score)
+			are browsed with the visitor as soon as they are closed, and released
+			with the next one. Their ancestors are visited in and out around them,
+			so that the visitor gets the same calls as from a tree_browser on the
+			whole tree, but the visited elements are not kept: the resulting tree
+			is reduced to its root element. A null visitor only releases the elements.
+			A depth of 0 disables the streaming mode (the default).
+		*/
+		void	stream (basevisitor* visitor, size_t depth = 2)	{ fStreamVisitor = visitor; fStreamDepth = depth; }
 		
 		SXMLFile readbuff(const char* file);
 		SXMLFile read(const char* file);
 		SXMLFile read(FILE* file);
 
+		//! reads a memory mapped file, scanning it in place (falls back to read() for UTF-16 files)
+		SXMLFile readmapped(const char* file);
+		//! reads the root file of a compressed MusicXML (.mxl) file, decompressed in memory
+		SXMLFile readmxl(const char* file);
+		//! scans a caller owned buffer in place, the buffer doesn't need to be nul terminated
+		SXMLFile readbuff(const char* buffer, size_t size);
+
 		bool	xmlDecl (const char* version, const char *encoding, int standalone);
 		bool	docType (const char* start, bool status, const char *pub, const char *sys);
 
@@ -46,6 +98,11 @@ class EXP xmlreader : public reader
 		void	setValue (const char* value);
 		bool	endElement (const char* eltName);
 		void	error (const char* s, int lineno);
+
+		bool	newElement (const char* eltName, size_t len);
+		bool	newAttribute (const char* eltName, size_t namelen, const char *val, size_t vallen);
+		void	setValue (const char* value, size_t len);
+		bool	endElement (const char* eltName, size_t len);
 };
 
 }
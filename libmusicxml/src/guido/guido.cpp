@@ -40,13 +40,15 @@ Sguidotag guidotag::create(string name)	{ guidotag* o = new guidotag(name); asse
 Sguidotag guidotag::create(string name, string sep)	{ guidotag* o = new guidotag(name, sep); assert(o!=0); return o;}
 
 //______________________________________________________________________________
-guidonotestatus* guidonotestatus::fInstances[kMaxInstances] = { 0 };
+// the instances are per thread, so that parts may be converted concurrently
+static thread_local guidonotestatus* gInstances[guidonotestatus::kMaxInstances] = { 0 };
+
 guidonotestatus* guidonotestatus::get (unsigned short voice)
 { 
     if (voice < kMaxInstances) {
-        if (!fInstances[voice])
-            fInstances[voice] = new guidonotestatus; 
-        return fInstances[voice];
+        if (!gInstances[voice])
+            gInstances[voice] = new guidonotestatus; 
+        return gInstances[voice];
     }
     return 0;
 }
@@ -54,15 +56,15 @@ guidonotestatus* guidonotestatus::get (unsigned short voice)
 void guidonotestatus::resetall ()
 { 
     for (int i=0; i<kMaxInstances; i++) {
-        if (fInstances[i]) fInstances[i]->reset();
+        if (gInstances[i]) gInstances[i]->reset();
     }
 }
 
 void guidonotestatus::freeall ()
 { 
     for (int i=0; i<kMaxInstances; i++) {
-        delete fInstances[i];
-		fInstances[i] = 0;
+        delete gInstances[i];
+		gInstances[i] = 0;
     }
 }
 
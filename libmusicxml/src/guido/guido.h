@@ -226,9 +226,9 @@ typedef SMARTP<guidonote> Sguidonote;
     sequence or chord, or assumed to have standard values.
 \n
 	The object is defined as a multi-voices singleton: a single
-    object is allocated for a specific voice and thus it will
+    object is allocated for a specific voice and thread and thus it will
 	not operate correctly on a same voice parrallel formatting 
-    operations.
+    operations within a thread. freeall() releases the objects of the calling thread.
 
 \todo handling the current beat value for \e *num duration form.
 */
@@ -252,8 +252,6 @@ class EXP guidonotestatus {
 
 	protected:
 		guidonotestatus() :	fOctave(defoctave), fDur(defnum, defdenom, 0) {}
-	private:
-		static guidonotestatus * fInstances[kMaxInstances];
 };
 
 /*!
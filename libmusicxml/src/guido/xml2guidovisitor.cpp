@@ -14,9 +14,13 @@
 # pragma warning (disable : 4786)
 #endif
 
+#include <algorithm>
+#include <atomic>
+#include <future>
 #include <iostream>
 #include <sstream>
 #include <string>
+#include <thread>
 
 #include "partsummary.h"
 #include "rational.h"
@@ -35,7 +39,7 @@ namespace MusicXML2
     //______________________________________________________________________________
     xml2guidovisitor::xml2guidovisitor(bool generateComments, bool generateStem, bool generateBar, int partNum, int beginMeasure, int endMeasure, int endMeasureOffset) :
     fGenerateComments(generateComments), fGenerateStem(generateStem),
-    fGenerateBars(generateBar), fGeneratePositions(true),
+    fGenerateBars(generateBar), fGeneratePositions(true), fParallelParts(false),
     fCurrentStaffIndex(0), previousStaffHasLyrics(false), fCurrentAccoladeIndex(0), fPartNum(partNum),
     fBeginMeasure(beginMeasure), fEndMeasure(endMeasure), fEndMeasureOffset(endMeasureOffset), fTotalMeasures(0)
     , fTotalDuration(0.0)
@@ -50,6 +54,7 @@ namespace MusicXML2
         if (xml) {
             tree_browser<xmlelement> browser(this);
             browser.browse(*xml);
+            convertPendingParts();
             gmn = current();
         }
         return gmn;
@@ -209,9 +214,11 @@ namespace MusicXML2
         smartlist<int>::ptr voices = ps.getVoices ();
         int targetStaff = 0xffff;	// initialized to a value we'll unlikely encounter
         bool notesOnly = false;
-        rational currentTimeSign (0,1);
-        std::vector<int> processedDirections;
-                
+        
+        partConversion part;
+        part.fPart = elt;
+        part.fTimePositions = ps.timePositions;
+        
         // browse the parts voice by voice: allows to describe voices that spans over several staves
         for (unsigned int i = 0; i < voices->size(); i++) {
             int targetVoice = (*voices)[i];
@@ -289,34 +296,104 @@ namespace MusicXML2
                     add (tag4);
                 }
             }
-                        
+            pop();
+            
+            // the voice contents are generated by xmlpart2guido, see convertVoices()
+            voiceConversion voice;
+            voice.fSeq = seq;
+            voice.fTargetStaff = targetStaff;
+            voice.fStaffIndex = fCurrentStaffIndex;
+            voice.fTargetVoice = targetVoice;
+            voice.fNotesOnly = notesOnly;
+            voice.fOctavas = ps.fOctavas[targetStaff];
+            part.fVoices.push_back (voice);
+        }
+        
+        if (fParallelParts)
+            fPendingParts.push_back (part);
+        else {
+            convertVoices (part);
+            collectResults (part);
+        }
+    }
+    
+    //______________________________________________________________________________
+    // browse the part voice by voice: the time signature and the processed directions
+    // are passed from one voice to the next one
+    void xml2guidovisitor::convertVoices ( partConversion& part ) const
+    {
+        rational currentTimeSign (0,1);
+        std::vector<int> processedDirections;
+        
+        for (auto& voice: part.fVoices) {
             //// Browse XML and convert
             xmlpart2guido pv(fGenerateComments, fGenerateStem, fGenerateBars, fBeginMeasure, fEndMeasure, fEndMeasureOffset);
             pv.generatePositions (fGeneratePositions);
             xml_tree_browser browser(&pv);
-            pv.initialize(seq, targetStaff, fCurrentStaffIndex, targetVoice, notesOnly, currentTimeSign);
-            pv.octavas = ps.fOctavas[targetStaff];
+            pv.initialize(voice.fSeq, voice.fTargetStaff, voice.fStaffIndex, voice.fTargetVoice, voice.fNotesOnly, currentTimeSign);
+            pv.octavas = voice.fOctavas;
             pv.processedDirections = processedDirections;
-            pv.timePositions = ps.timePositions;
-            browser.browse(*elt);
-            pop();
+            pv.timePositions = part.fTimePositions;
+            browser.browse(*part.fPart);
             currentTimeSign = pv.getTimeSign();
-            previousStaffHasLyrics = pv.hasLyrics();
-            fBeginPosition = pv.fStartPosition;
-            fEndPosition = pv.fEndPosition;
             processedDirections.insert(processedDirections.end(), pv.processedDirections.begin(), pv.processedDirections.end());
             
-            if (pv.lastMeasureNumber() > fTotalMeasures) {
-                fTotalMeasures = pv.lastMeasureNumber();
+            voice.fHasLyrics = pv.hasLyrics();
+            voice.fStartPosition = pv.fStartPosition;
+            voice.fEndPosition = pv.fEndPosition;
+            voice.fLastMeasureNumber = pv.lastMeasureNumber();
+            voice.fMeasurePositionMap = pv.measurePositionMap;
+            voice.fTotalPartDuration = pv.totalPartDuration();
+        }
+    }
+    
+    //______________________________________________________________________________
+    void xml2guidovisitor::collectResults ( const partConversion& part )
+    {
+        for (const auto& voice: part.fVoices) {
+            previousStaffHasLyrics = voice.fHasLyrics;
+            fBeginPosition = voice.fStartPosition;
+            fEndPosition = voice.fEndPosition;
+            
+            if (voice.fLastMeasureNumber > fTotalMeasures) {
+                fTotalMeasures = voice.fLastMeasureNumber;
             }
-            measurePositionMap = pv.measurePositionMap;
+            measurePositionMap = voice.fMeasurePositionMap;
             
-            if (pv.totalPartDuration() > fTotalDuration) {
-                fTotalDuration = pv.totalPartDuration();
+            if (voice.fTotalPartDuration > fTotalDuration) {
+                fTotalDuration = voice.fTotalPartDuration;
             }
         }
     }
     
+    //______________________________________________________________________________
+    // the parts don't share any xml element nor guido element: each worker thread
+    // converts whole parts, the guido notes status being allocated per thread
+    void xml2guidovisitor::convertPendingParts ()
+    {
+        size_t count = fPendingParts.size();
+        if (!count) return;
+        
+        size_t threadsCount = std::min<size_t>(count, std::max(2u, std::thread::hardware_concurrency()));
+        std::atomic<size_t> next (0);
+        std::vector<std::future<void> > workers;
+        for (size_t i = 0; i < threadsCount; i++) {
+            workers.push_back (std::async (std::launch::async, [this, &next, count] {
+                size_t n;
+                while ((n = next++) < count)
+                    convertVoices (fPendingParts[n]);
+                guidonotestatus::freeall();
+            }));
+        }
+        for (auto& worker: workers)
+            worker.get();	// throws the exceptions raised in the worker
+        
+        // the results are merged in the score order
+        for (const auto& part: fPendingParts)
+            collectResults (part);
+        fPendingParts.clear();
+    }
+    
     //______________________________________________________________________________
     void xml2guidovisitor::addPosition	( Sxmlelement elt, Sguidoelement& tag, float yoffset)
     {
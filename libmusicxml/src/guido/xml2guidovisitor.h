@@ -18,6 +18,7 @@
 #include <map>
 #include <string>
 #include <set>
+#include <vector>
 
 #include "exports.h"
 #include "guido.h"
@@ -25,6 +26,7 @@
 #include "visitor.h"
 #include "xml.h"
 #include "rational.h"
+#include "timePositions.h"
 
 
 #include "partlistvisitor.h"
@@ -45,6 +47,29 @@ typedef struct {
     std::vector<S_creator>	fCreators;
 } scoreHeader;
 
+//______________________________________________________________________________
+// a voice of a part, converted by xmlpart2guido into its guido sequence
+typedef struct {
+    Sguidoelement	fSeq;
+    int				fTargetStaff, fStaffIndex, fTargetVoice;
+    bool			fNotesOnly;
+    std::map<std::string, std::map<rational, int>> fOctavas;
+    
+    // the conversion results
+    bool			fHasLyrics;
+    rational		fStartPosition, fEndPosition;
+    int				fLastMeasureNumber;
+    std::map<double, int> fMeasurePositionMap;
+    double			fTotalPartDuration;
+} voiceConversion;
+
+// the voices of a part, that are converted in sequence since each voice depends on the previous one
+typedef struct {
+    Sxmlelement						fPart;
+    MusicXMLTimePositions			fTimePositions;
+    std::vector<voiceConversion>	fVoices;
+} partConversion;
+
 /*!
  \brief A score visitor to produce a Guido representation.
  */
@@ -63,7 +88,7 @@ public clefvisitor
 private:
     // the guido elements stack
     std::stack<Sguidoelement>	fStack;
-    bool	fGenerateComments, fGenerateStem, fGenerateBars, fGeneratePositions;
+    bool	fGenerateComments, fGenerateStem, fGenerateBars, fGeneratePositions, fParallelParts;
     
     scoreHeader		fHeader;		// musicxml header elements (should be flushed at the beginning of the first voice)
     std::string		fCurrentPartID;
@@ -83,6 +108,12 @@ private:
     void flushPartHeader ( partHeader& header );
     void flushPartGroup (std::string partID);
     
+    std::vector<partConversion>	fPendingParts;	// the parts to be converted concurrently at the end of the score
+    
+    void convertVoices	 ( partConversion& part ) const;
+    void collectResults	 ( const partConversion& part );
+    void convertPendingParts ();
+    
 protected:
     
     virtual void visitStart( S_score_partwise& elt);
@@ -136,6 +167,11 @@ public:
     // ie converts relative-x/-y into dx/dy attributes
     void generatePositions (bool state)		{ fGeneratePositions = state; }
     
+    // the voices of a part depend on each other but the parts are independent:
+    // when state is true, the parts are converted concurrently into their guido sequences,
+    // which are then merged in the score order. The output is the same as with sequential conversion.
+    void generatePartsInParallel (bool state)	{ fParallelParts = state; }
+    
     /// MARK: Position Helpers
 
     static void addPosition	 ( Sxmlelement elt, Sguidoelement& tag, float yoffset);
@@ -80,9 +80,10 @@ EXP const char*   musicxml2guidoVersionStr();
   \param endMeasure for Partial conversion: end measure number (default: infinite)
   \param partFilter Part number to convert or 0 for all (default: 0)
   \param out the output stream
+  \param parallelParts converts the parts concurrently (default: false), the output is unchanged
   \return an error code (\c kNoErr when success)
 */
-EXP xmlErr      musicxmlfile2guido  (const char *file, bool generateBars, int beginMeasure, int endMeasure, int partFilter, std::ostream& out);
+EXP xmlErr      musicxmlfile2guido  (const char *file, bool generateBars, int beginMeasure, int endMeasure, int partFilter, std::ostream& out, bool parallelParts=false);
 
 /*!
   \brief Converts a MusicXML representation to the Guido format.
@@ -92,9 +93,10 @@ EXP xmlErr      musicxmlfile2guido  (const char *file, bool generateBars, int be
   \param endMeasure for Partial conversion: end measure number (default: infinite)
   \param partFilter Part number to convert or 0 for all (default: 0)
   \param out the output stream
+  \param parallelParts converts the parts concurrently (default: false), the output is unchanged
   \return an error code (\c kNoErr when success)
 */
-EXP xmlErr      musicxmlfd2guido  (FILE* fd, bool generateBars, int beginMeasure, int endMeasure, int partFilter, std::ostream& out);
+EXP xmlErr      musicxmlfd2guido  (FILE* fd, bool generateBars, int beginMeasure, int endMeasure, int partFilter, std::ostream& out, bool parallelParts=false);
 
 /*!
   \brief Converts a MusicXML representation to the Guido format.
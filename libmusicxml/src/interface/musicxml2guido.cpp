@@ -27,13 +27,14 @@ namespace MusicXML2
 {
 
 //_______________________________________________________________________________
-static xmlErr xml2guido(SXMLFile& xmlfile, bool generateBars, int partFilter, ostream& out, const char* file)
+static xmlErr xml2guido(SXMLFile& xmlfile, bool generateBars, int partFilter, ostream& out, const char* file, bool parallelParts=false)
 {
 	Sxmlelement st = xmlfile->elements();
 	if (st) {
 		if (st->getName() == "score-timewise") return kUnsupported;
 		
 		xml2guidovisitor v(true, true, generateBars, partFilter);
+		v.generatePartsInParallel (parallelParts);
 		Sguidoelement gmn = v.convert(st);
 		if (file) {
 			out << "(*\n  gmn code converted from '" << file << "'"
@@ -49,13 +50,14 @@ static xmlErr xml2guido(SXMLFile& xmlfile, bool generateBars, int partFilter, os
 }
 
 //_______________________________________________________________________________
-static xmlErr partialxml2guido(SXMLFile& xmlfile, bool generateBars, int partFilter, int beginMeasure, int endMeasure, ostream& out, const char* file)
+static xmlErr partialxml2guido(SXMLFile& xmlfile, bool generateBars, int partFilter, int beginMeasure, int endMeasure, ostream& out, const char* file, bool parallelParts=false)
 {
     Sxmlelement st = xmlfile->elements();
     if (st) {
         if (st->getName() == "score-timewise") return kUnsupported;
         
         xml2guidovisitor v(true, true, generateBars, partFilter, beginMeasure, endMeasure);
+        v.generatePartsInParallel (parallelParts);
         Sguidoelement gmn = v.convert(st);
         if (file) {
             out << "(*\n  gmn code converted from '" << file << "'"
@@ -71,31 +73,31 @@ static xmlErr partialxml2guido(SXMLFile& xmlfile, bool generateBars, int partFil
 }
 
 //_______________________________________________________________________________
-EXP xmlErr musicxmlfile2guido(const char *file, bool generateBars, int beginMeasure, int endMeasure, int partFilter, ostream& out)
+EXP xmlErr musicxmlfile2guido(const char *file, bool generateBars, int beginMeasure, int endMeasure, int partFilter, ostream& out, bool parallelParts)
 {
 	xmlreader r;
 	SXMLFile xmlfile;
 	xmlfile = r.read(file);
 	if (xmlfile) {
         if ((beginMeasure != 0) || (endMeasure != 0)) {
-            return partialxml2guido(xmlfile, generateBars, partFilter, beginMeasure, endMeasure, out, 0);
+            return partialxml2guido(xmlfile, generateBars, partFilter, beginMeasure, endMeasure, out, 0, parallelParts);
         }
-		return xml2guido(xmlfile, generateBars, partFilter, out, file);
+		return xml2guido(xmlfile, generateBars, partFilter, out, file, parallelParts);
 	}
 	return kInvalidFile;
 }
 
 //_______________________________________________________________________________
-EXP xmlErr musicxmlfd2guido(FILE * fd, bool generateBars, int beginMeasure, int endMeasure, int partFilter, ostream& out)
+EXP xmlErr musicxmlfd2guido(FILE * fd, bool generateBars, int beginMeasure, int endMeasure, int partFilter, ostream& out, bool parallelParts)
 {
 	xmlreader r;
 	SXMLFile xmlfile;
 	xmlfile = r.read(fd);
 	if (xmlfile) {
         if ((beginMeasure != 0) || (endMeasure != 0)) {
-            return partialxml2guido(xmlfile, generateBars, partFilter, beginMeasure, endMeasure, out, 0);
+            return partialxml2guido(xmlfile, generateBars, partFilter, beginMeasure, endMeasure, out, 0, parallelParts);
         }
-		return xml2guido(xmlfile, generateBars, partFilter, out, 0);
+		return xml2guido(xmlfile, generateBars, partFilter, out, 0, parallelParts);
 	}
 	return kInvalidFile;
 }
@@ -0,0 +1,96 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#ifdef MSVC
+# pragma warning (disable : 4786)
+#endif
+
+#include <stdlib.h>
+#include <cstddef>
+#include <new>
+
+#include "arena.h"
+
+namespace MusicXML2
+{
+
+// the objects header, that stores the object arena
+// its size keeps the objects aligned as required by any type
+static const size_t kAlignment = alignof(std::max_align_t);
+static const size_t kHeaderSize = (sizeof(arena*) + kAlignment - 1) & ~(kAlignment - 1);
+
+static inline size_t aligned (size_t size)	{ return (size + kAlignment - 1) & ~(kAlignment - 1); }
+
+static thread_local arena* gCurrentArena = 0;
+
+//______________________________________________________________________________
+Sarena arena::create (size_t chunkSize)	{ arena* o = new arena (chunkSize); assert(o!=0); return o; }
+
+arena::arena (size_t chunkSize) : fFree(0), fLeft(0), fChunkSize(aligned(chunkSize)), fSize(0) {}
+
+arena::~arena ()
+{
+	for (auto chunk: fChunks) free (chunk);
+}
+
+//______________________________________________________________________________
+void* arena::allocate (size_t size)
+{
+	size = aligned (size);
+	if (size > fLeft) {
+		// large objects get their own chunk, the current chunk remains in use
+		size_t chunkSize = (size > fChunkSize / 4) ? size : fChunkSize;
+		char* chunk = (char*)malloc (chunkSize);
+		if (!chunk) throw std::bad_alloc();
+		fChunks.push_back (chunk);
+		fSize += chunkSize;
+		if (chunkSize == size) return chunk;
+		fFree = chunk;
+		fLeft = chunkSize;
+	}
+	void* ptr = fFree;
+	fFree += size;
+	fLeft -= size;
+	return ptr;
+}
+
+//______________________________________________________________________________
+arena* arena::current ()	{ return gCurrentArena; }
+
+arena::scope::scope (arena* a) : fPrevious(gCurrentArena)	{ gCurrentArena = a; }
+arena::scope::~scope ()										{ gCurrentArena = fPrevious; }
+
+//______________________________________________________________________________
+void* arena::newObject (size_t size)
+{
+	arena* a = gCurrentArena;
+	char* ptr;
+	if (a) {
+		ptr = (char*)a->allocate (kHeaderSize + size);
+		a->addReference();
+	}
+	else ptr = (char*)::operator new (kHeaderSize + size);
+	*(arena**)ptr = a;
+	return ptr + kHeaderSize;
+}
+
+void arena::deleteObject (void* ptr)
+{
+	if (!ptr) return;
+	char* block = (char*)ptr - kHeaderSize;
+	arena* a = *(arena**)block;
+	// the memory of arena objects is released with the arena
+	if (a) a->removeReference();
+	else ::operator delete (block);
+}
+
+}
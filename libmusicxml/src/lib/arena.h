@@ -0,0 +1,83 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#ifndef __arena__
+#define __arena__
+
+#include <stddef.h>
+#include <vector>
+#include "exports.h"
+#include "smartpointer.h"
+
+namespace MusicXML2
+{
+
+//______________________________________________________________________________
+/*!
+\brief A monotonic memory arena.
+
+	Memory is carved from large chunks and is never released individually:
+	the chunks are released at once when the arena is deleted.
+
+	Classes that support arena allocation (xmlelement and xmlattribute) define
+	their operator new and delete using newObject() and deleteObject():
+	objects are allocated in the current arena of the calling thread, if any,
+	otherwise on the heap. An object allocated in an arena holds a reference
+	to the arena, which is thus deleted with its last object.
+*/
+class EXP arena : public smartable
+{
+	std::vector<char*>	fChunks;
+	char*				fFree;		// the free space of the last chunk
+	size_t				fLeft;
+	size_t				fChunkSize;
+	size_t				fSize;		// the total chunks size
+
+	protected:
+				 arena (size_t chunkSize);
+		virtual ~arena ();
+
+	public:
+		static SMARTP<arena> create (size_t chunkSize = 256 * 1024);
+
+		//! allocates size bytes, aligned for any object
+		void*	allocate (size_t size);
+		//! the memory allocated for the chunks
+		size_t	size () const			{ return fSize; }
+
+		//! allocates an object in the current arena or on the heap
+		static void*	newObject (size_t size);
+		//! releases an object allocated by newObject(): nothing is done for arena objects
+		static void		deleteObject (void* ptr);
+
+		//! the current arena of the calling thread, 0 when objects are allocated on the heap
+		static arena*	current ();
+
+		/*!
+		\brief Sets the current arena of the calling thread for the scope lifetime.
+		*/
+		class EXP scope {
+			arena*	fPrevious;
+			public:
+					 scope (arena* a);
+					~scope ();
+		};
+
+	private:
+		arena (const arena&);
+		arena& operator= (const arena&);
+};
+typedef SMARTP<arena> Sarena;
+
+}
+
+#endif
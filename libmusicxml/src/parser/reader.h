@@ -13,6 +13,8 @@
 #ifndef __reader__
 #define __reader__
 
+#include <string>
+
 class reader
 { 
 	public:
@@ -29,6 +31,18 @@ class reader
 		virtual void	setValue (const char* value) = 0;
 		virtual bool	endElement (const char* eltName) = 0;
 		virtual void	error (const char* s, int lineno) = 0;
+
+		// in place variants: the names and values are views into the input buffer
+		// and are not nul terminated. They are used by the xmlscanner, the default
+		// implementations copy them and call the methods above.
+		virtual bool	newElement (const char* eltName, size_t len)
+							{ return newElement (std::string(eltName, len).c_str()); }
+		virtual bool	newAttribute (const char* eltName, size_t namelen, const char *val, size_t vallen)
+							{ return newAttribute (std::string(eltName, namelen).c_str(), std::string(val, vallen).c_str()); }
+		virtual void	setValue (const char* value, size_t len)
+							{ setValue (std::string(value, len).c_str()); }
+		virtual bool	endElement (const char* eltName, size_t len)
+							{ return endElement (std::string(eltName, len).c_str()); }
 };
 
 
@@ -57,7 +57,7 @@ char doctypeSys[MAXLEN];
 reader * gReader;
 
 static void init (reader * r) {
-	gReader = r;
+	gReader = r;	libmxmllineno = 1;
 	xmlStandalone = -1;
 	eltName[0]		= 0;
 	attributeName[0] = 0;
@@ -199,7 +199,7 @@ bool readfile (const char * file, reader * r)
 		return false;
 	}
 	init(r);
-	libmxmlrestart(fd);
+	lexinit(fd);				// resets the UTF-16 detection state
 	libmxmlin = fd;
  	int ret = yyparse();
  	fclose (fd);
@@ -211,7 +211,7 @@ bool readstream (FILE * fd, reader * r)
 {
 	if (!fd) return false;
 	init(r);
-	libmxmlrestart(fd);
+	lexinit(fd);				// resets the UTF-16 detection state
 	libmxmlin = fd;
  	int ret = yyparse();
 	BEGIN(INITIAL);
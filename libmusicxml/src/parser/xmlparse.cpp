@@ -190,7 +190,7 @@ reader * gReader;
 using namespace MusicXML2;
 
 static void init (reader * r) {
-	gReader = r;
+	gReader = r;	libmxmllineno = 1;
 	xmlStandalone = -1;
 	eltName[0]		= 0;
 	attributeName[0] = 0;
@@ -1857,7 +1857,7 @@ bool readfile (const char * file, reader * r)
 		return false;
 	}
 	init(r);
-	libmxmlrestart(fd);
+	lexinit(fd);				// resets the UTF-16 detection state
 	libmxmlin = fd;
  	int ret = yyparse();
  	fclose (fd);
@@ -1869,7 +1869,7 @@ bool readstream (FILE * fd, reader * r)
 {
 	if (!fd) return false;
 	init(r);
-	libmxmlrestart(fd);
+	lexinit(fd);				// resets the UTF-16 detection state
 	libmxmlin = fd;
  	int ret = yyparse();
 	BEGIN(INITIAL);
@@ -0,0 +1,360 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#ifdef MSVC
+# pragma warning (disable : 4786)
+#endif
+
+#include <string.h>
+#include <string>
+
+#include "xmlscanner.h"
+
+using namespace std;
+
+namespace MusicXML2
+{
+
+static inline bool isSpace (char c)		{ return (c == ' ') || (c == '\t') || (c == '\n') || (c == '\r'); }
+static inline bool isBlank (char c)		{ return (c == ' ') || (c == '\t'); }
+static inline bool isFirstChar (char c)	{ return ((c >= 'a') && (c <= 'z')) || ((c >= 'A') && (c <= 'Z')) || (c == '_'); }
+static inline bool isNameChar (char c)	{ return isFirstChar(c) || ((c >= '0') && (c <= '9')) || (c == '-') || (c == '.') || (c == ':'); }
+
+//______________________________________________________________________________
+xmlscanner::xmlscanner (const char* buffer, size_t size, reader* r)
+	: fStart(buffer), fEnd(buffer + size), fPos(buffer), fReader(r), fLine(1), fLinePos(buffer)
+{
+}
+
+//______________________________________________________________________________
+bool xmlscanner::isUTF16 (const char* buffer, size_t size)
+{
+	if (size < 2) return false;
+	unsigned char c0 = buffer[0], c1 = buffer[1];
+	return ((c0 == 0xff) && (c1 == 0xfe)) || ((c0 == 0xfe) && (c1 == 0xff));
+}
+
+//______________________________________________________________________________
+int xmlscanner::lineno ()
+{
+	const char* end = (fPos < fEnd) ? fPos : fEnd;
+	while (fLinePos < end) {
+		const char* nl = (const char*)memchr (fLinePos, '\n', end - fLinePos);
+		if (!nl) {
+			fLinePos = end;
+			break;
+		}
+		fLine++;
+		fLinePos = nl + 1;
+	}
+	return fLine;
+}
+
+//______________________________________________________________________________
+bool xmlscanner::error (const char* msg)
+{
+	fReader->error (msg, lineno());
+	return false;
+}
+
+//______________________________________________________________________________
+void xmlscanner::skipSpaces ()
+{
+	while ((fPos < fEnd) && isSpace(*fPos)) fPos++;
+}
+
+void xmlscanner::skipBlanks ()
+{
+	while ((fPos < fEnd) && isBlank(*fPos)) fPos++;
+}
+
+bool xmlscanner::lookingAt (const char* str, size_t len) const
+{
+	return (size_t(fEnd - fPos) >= len) && !strncmp (fPos, str, len);
+}
+
+bool xmlscanner::expect (char c)
+{
+	if ((fPos < fEnd) && (*fPos == c)) {
+		fPos++;
+		return true;
+	}
+	return error ("syntax error");
+}
+
+//______________________________________________________________________________
+bool xmlscanner::name (const char*& str, size_t& len)
+{
+	if ((fPos >= fEnd) || !isFirstChar(*fPos)) return error ("syntax error");
+	str = fPos++;
+	while ((fPos < fEnd) && isNameChar(*fPos)) fPos++;
+	len = fPos - str;
+	return true;
+}
+
+//______________________________________________________________________________
+bool xmlscanner::quoted (const char*& str, size_t& len)
+{
+	if ((fPos >= fEnd) || ((*fPos != '"') && (*fPos != '\''))) return error ("syntax error");
+	const char* end = (const char*)memchr (fPos + 1, *fPos, fEnd - fPos - 1);
+	if (!end) return error ("unterminated quoted string");
+	str = fPos + 1;
+	len = end - str;
+	fPos = end + 1;
+	return true;
+}
+
+//______________________________________________________________________________
+bool xmlscanner::scan ()
+{
+	fPos = fStart;
+	// skip an UTF-8 byte order mark
+	if (lookingAt ("\xef\xbb\xbf", 3)) fPos += 3;
+
+	return prolog() && elements() && epilog();
+}
+
+//______________________________________________________________________________
+bool xmlscanner::prolog ()
+{
+	skipSpaces();
+	if (lookingAt ("<?xml", 5) && (fPos + 5 < fEnd) && isSpace(fPos[5])) {
+		fPos += 5;
+		if (!xmlDecl()) return false;
+	}
+	while (true) {
+		skipSpaces();
+		if (lookingAt ("<!--", 4)) {
+			if (!comment()) return false;
+		}
+		else if (lookingAt ("<!DOCTYPE", 9)) {
+			if (!docType()) return false;
+		}
+		else if (lookingAt ("<?", 2)) {
+			if (!procInstr()) return false;
+		}
+		else break;
+	}
+	if ((fPos >= fEnd) || (*fPos != '<')) return error ("syntax error");
+	return true;
+}
+
+//______________________________________________________________________________
+// misc: only spaces, comments and processing instructions may follow the root element
+bool xmlscanner::epilog ()
+{
+	while (true) {
+		skipSpaces();
+		if (fPos >= fEnd) return true;
+		if (lookingAt ("<!--", 4)) {
+			if (!comment()) return false;
+		}
+		else if (lookingAt ("<?", 2)) {
+			if (!procInstr()) return false;
+		}
+		else return error ("syntax error");
+	}
+}
+
+//______________________________________________________________________________
+bool xmlscanner::xmlDecl ()
+{
+	string version, encoding;
+	int standalone = -1;
+	while (true) {
+		skipSpaces();
+		if (lookingAt ("?>", 2)) {
+			fPos += 2;
+			break;
+		}
+		const char* attr; size_t attrlen;
+		const char* val; size_t vallen;
+		if (!name (attr, attrlen)) return false;
+		skipSpaces();
+		if (!expect ('=')) return false;
+		skipSpaces();
+		if (!quoted (val, vallen)) return false;
+
+		string attrname (attr, attrlen);
+		if (attrname == "version")			version.assign (val, vallen);
+		else if (attrname == "encoding")	encoding.assign (val, vallen);
+		else if (attrname == "standalone")	standalone = ((vallen == 3) && !strncmp (val, "yes", 3)) ? 1 : 0;
+		else return error ("syntax error");
+	}
+	if (!fReader->xmlDecl (version.c_str(), encoding.c_str(), standalone))
+		return error ("xmlDecl error");
+	return true;
+}
+
+//______________________________________________________________________________
+bool xmlscanner::docType ()
+{
+	fPos += 9;		// skip "<!DOCTYPE"
+	skipSpaces();
+
+	const char* start; size_t startlen;
+	if (!name (start, startlen)) return false;
+	skipSpaces();
+
+	const char* pub = fPos; size_t publen = 0;
+	const char* sys = fPos; size_t syslen = 0;
+	bool ispublic = lookingAt ("PUBLIC", 6);
+	if (ispublic) {
+		fPos += 6;
+		skipSpaces();
+		if (!quoted (pub, publen)) return false;
+		skipSpaces();
+		if (!quoted (sys, syslen)) return false;
+	}
+	else if (lookingAt ("SYSTEM", 6)) {
+		fPos += 6;
+		skipSpaces();
+		if (!quoted (sys, syslen)) return false;
+	}
+	else return error ("syntax error");
+
+	skipSpaces();
+	if (!expect ('>')) return false;
+	fReader->docType (string(start, startlen).c_str(), ispublic, string(pub, publen).c_str(), string(sys, syslen).c_str());
+	return true;
+}
+
+//______________________________________________________________________________
+bool xmlscanner::comment ()
+{
+	const char* text = fPos + 4;	// skip "<!--"
+	for (const char* ptr = text; ptr < fEnd; ptr++) {
+		ptr = (const char*)memchr (ptr, '-', fEnd - ptr);
+		if (!ptr) break;
+		if ((fEnd - ptr >= 3) && (ptr[1] == '-') && (ptr[2] == '>')) {
+			fPos = ptr;		// the comment line number is the line of its end
+			fReader->newComment (string(text, ptr - text).c_str());
+			fPos += 3;
+			return true;
+		}
+	}
+	return error ("unterminated comment");
+}
+
+//______________________________________________________________________________
+bool xmlscanner::procInstr ()
+{
+	const char* text = fPos + 2;	// skip "<?"
+	for (const char* ptr = text; ptr < fEnd; ptr++) {
+		ptr = (const char*)memchr (ptr, '?', fEnd - ptr);
+		if (!ptr) break;
+		if ((fEnd - ptr >= 2) && (ptr[1] == '>')) {
+			fPos = ptr;
+			fReader->newProcessingInstruction (string(text, ptr - text).c_str());
+			fPos += 2;
+			return true;
+		}
+	}
+	return error ("unterminated processing instruction");
+}
+
+//______________________________________________________________________________
+bool xmlscanner::startTag (bool& empty)
+{
+	fPos++;		// skip '<'
+	skipBlanks();
+
+	const char* elt; size_t eltlen;
+	if (!name (elt, eltlen)) return false;
+	if (!fReader->newElement (elt, eltlen)) return error ("element error");
+
+	while (true) {
+		skipSpaces();
+		if (fPos >= fEnd) return error ("unexpected end of file");
+		if (*fPos == '>') {
+			fPos++;
+			empty = false;
+			return true;
+		}
+		if (lookingAt ("/>", 2)) {
+			fPos += 2;
+			if (!fReader->endElement (elt, eltlen)) return error ("end element error");
+			empty = true;
+			return true;
+		}
+
+		const char* attr; size_t attrlen;
+		const char* val; size_t vallen;
+		if (!name (attr, attrlen)) return false;
+		skipBlanks();
+		if (!expect ('=')) return false;
+		skipBlanks();
+		if (!quoted (val, vallen)) return false;
+		if (!fReader->newAttribute (attr, attrlen, val, vallen)) return error ("attribute error");
+	}
+}
+
+//______________________________________________________________________________
+bool xmlscanner::endTag ()
+{
+	fPos += 2;		// skip "</"
+	skipBlanks();
+
+	const char* elt; size_t eltlen;
+	if (!name (elt, eltlen)) return false;
+	skipSpaces();
+	if (!expect ('>')) return false;
+	if (!fReader->endElement (elt, eltlen)) return error ("end element error");
+	return true;
+}
+
+//______________________________________________________________________________
+// scans the root element and its content, the current position is on a '<'
+// elements are handled iteratively, the reader maintains the elements stack
+bool xmlscanner::elements ()
+{
+	int depth = 0;
+	while (true) {
+		if (lookingAt ("<!--", 4)) {
+			if (!comment()) return false;
+		}
+		else if (lookingAt ("<?", 2)) {
+			if (!procInstr()) return false;
+		}
+		else if (lookingAt ("</", 2)) {
+			if (!depth) return error ("syntax error");
+			if (!endTag()) return false;
+			depth--;
+		}
+		else {
+			bool empty;
+			if (!startTag (empty)) return false;
+			if (!empty) {
+				depth++;
+				const char* data = fPos;
+				fPos = (const char*)memchr (fPos, '<', fEnd - fPos);
+				if (!fPos) {
+					fPos = fEnd;
+					return error ("unexpected end of file");
+				}
+				const char* ptr = data;
+				while ((ptr < fPos) && isSpace(*ptr)) ptr++;
+				if (ptr < fPos) {
+					// character data is only supported as the sole content of an element
+					if (!lookingAt ("</", 2)) return error ("syntax error");
+					fReader->setValue (data, fPos - data);
+				}
+				continue;
+			}
+		}
+		if (!depth) return true;
+		skipSpaces();
+		if ((fPos >= fEnd) || (*fPos != '<')) return error ("syntax error");
+	}
+}
+
+}
@@ -0,0 +1,81 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#ifndef __xmlscanner__
+#define __xmlscanner__
+
+#include <stddef.h>
+#include "exports.h"
+#include "reader.h"
+
+namespace MusicXML2
+{
+
+//______________________________________________________________________________
+/*!
+\brief An in place xml scanner.
+
+	The scanner covers the same subset of xml as the flex/bison parser
+	but works directly on a memory buffer (typically a memory mapped file):
+	element names, attribute names and values are passed to the reader
+	as views into the buffer, using the reader in place methods.
+
+	UTF-16 input is not supported, use the flex/bison parser in this case.
+	The scanner state is local to each instance: a reader may call lineno()
+	from its callbacks to get the input line number.
+*/
+class EXP xmlscanner
+{
+	const char*	fStart;
+	const char*	fEnd;
+	const char*	fPos;
+	reader*		fReader;
+
+	int			fLine;		// the line number at fLinePos
+	const char*	fLinePos;	// line numbers are computed lazily, up to fPos
+
+	public:
+				 xmlscanner (const char* buffer, size_t size, reader* r);
+		virtual ~xmlscanner() {}
+
+		//! scans the whole buffer, returns false in case of syntax error
+		bool	scan ();
+		//! the line number of the current position
+		int		lineno ();
+
+		//! true when the buffer starts with an UTF-16 byte order mark
+		static bool isUTF16 (const char* buffer, size_t size);
+
+	private:
+		bool	prolog ();
+		bool	xmlDecl ();
+		bool	docType ();
+		bool	comment ();
+		bool	procInstr ();
+		bool	elements ();
+		bool	startTag (bool& empty);
+		bool	endTag ();
+		bool	epilog ();
+
+		bool	name (const char*& str, size_t& len);
+		bool	quoted (const char*& str, size_t& len);
+		bool	expect (char c);
+		bool	lookingAt (const char* str, size_t len) const;
+		void	skipSpaces ();
+		void	skipBlanks ();
+
+		bool	error (const char* msg);
+};
+
+}
+
+#endif
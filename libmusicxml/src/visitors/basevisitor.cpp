@@ -0,0 +1,81 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#ifdef MSVC
+# pragma warning (disable : 4786)
+#endif
+
+#include <cassert>
+#include <map>
+#include <mutex>
+#include <typeindex>
+
+#include "basevisitor.h"
+
+using namespace std;
+
+namespace MusicXML2 
+{
+
+static mutex& tablesMutex ()
+{
+	static mutex theMutex;
+	return theMutex;
+}
+
+//______________________________________________________________________________
+int visitortable::newId ()
+{
+	static atomic<int> nextId (0);
+	int id = nextId++;
+	assert (id < kPages * kPageSize);
+	return id;
+}
+
+visitortable* visitortable::get (const type_info& type)
+{
+	// the tables live as long as the program
+	static map<type_index, visitortable*> tables;
+	lock_guard<mutex> lock (tablesMutex());
+	visitortable*& table = tables[type_index(type)];
+	if (!table) table = new visitortable;
+	return table;
+}
+
+//______________________________________________________________________________
+visitortable::visitortable ()
+{
+	for (int i = 0; i < kPages; i++) fPages[i] = 0;
+}
+
+atomic<intptr_t>* visitortable::newPage (int index)
+{
+	atomic<intptr_t>* page = new atomic<intptr_t>[kPageSize];
+	for (int i = 0; i < kPageSize; i++) page[i] = kUnknown;
+	atomic<intptr_t>* expected = 0;
+	if (!fPages[index].compare_exchange_strong (expected, page, memory_order_acq_rel)) {
+		// another thread did it first
+		delete [] page;
+		return expected;
+	}
+	return page;
+}
+
+intptr_t visitortable::resolve (int id, basevisitor* v, resolver cast)
+{
+	void* p = cast (v);
+	intptr_t offset = p ? (char*)p - (char*)v : kNone;
+	entry(id).store (offset, memory_order_relaxed);
+	return offset;
+}
+
+}
@@ -13,6 +13,11 @@
 #ifndef __basevisitor__
 #define __basevisitor__
 
+#include <atomic>
+#include <stdint.h>
+#include <typeinfo>
+
+#include "exports.h"
 
 #ifdef WIN32
 #pragma warning (disable : 4251 4275)
@@ -21,10 +26,76 @@
 namespace MusicXML2 
 {
 
+class basevisitor;
+
+//______________________________________________________________________________
+/*!
+\brief The visitors dispatch table.
+
+	Each visitor<C> interface gets an id when first used. A table is built
+	for each visitor dynamic type, it gives the offset of the visitor<C>
+	interfaces from the basevisitor part of the visitor, indexed by their id.
+	An entry is set by the first dynamic_cast for the interface, the next
+	lookups are an indexed read.
+*/
+class EXP visitortable
+{
+	public:
+		typedef void* (*resolver)(basevisitor* v);
+
+		//! allocates an id for a visitor<C> interface
+		static int				newId ();
+		//! the table of a visitor dynamic type
+		static visitortable*	get (const std::type_info& type);
+
+		//! the interface with the given id of v, resolved using cast when unknown
+		void*	cast (int id, basevisitor* v, resolver cast) {
+			intptr_t offset = entry(id).load (std::memory_order_relaxed);
+			if (offset == kUnknown) offset = resolve (id, v, cast);
+			return (offset == kNone) ? 0 : (char*)v + offset;
+		}
+
+	private:
+		enum { kPageSize = 256, kPages = 256 };
+		static const intptr_t kUnknown	= INTPTR_MIN;		// the entry is not resolved yet
+		static const intptr_t kNone		= INTPTR_MIN + 1;	// the visitor doesn't implement the interface
+
+		std::atomic<std::atomic<intptr_t>*> fPages[kPages];
+
+				 visitortable ();
+				~visitortable () {}
+
+		std::atomic<intptr_t>& entry (int id) {
+			std::atomic<intptr_t>* page = fPages[id / kPageSize].load (std::memory_order_acquire);
+			if (!page) page = newPage (id / kPageSize);
+			return page[id % kPageSize];
+		}
+		std::atomic<intptr_t>*	newPage (int index);
+		intptr_t				resolve (int id, basevisitor* v, resolver cast);
+};
+
+//______________________________________________________________________________
 class basevisitor 
 {
+	mutable const std::type_info*	fDispatchType;		// the dynamic type of the table
+	mutable visitortable*			fDispatchTable;
+
 	public:
+				 basevisitor() : fDispatchType(0), fDispatchTable(0) {}
+				 basevisitor(const basevisitor&) : fDispatchType(0), fDispatchTable(0) {}
 		virtual ~basevisitor() {}
+
+		basevisitor& operator= (const basevisitor&)	{ return *this; }
+
+		//! the dispatch table of the visitor dynamic type (which differs while under construction)
+		visitortable* dispatchTable () const {
+			const std::type_info& type = typeid(*this);
+			if (fDispatchType != &type) {
+				fDispatchTable = visitortable::get (type);
+				fDispatchType = &type;
+			}
+			return fDispatchTable;
+		}
 };
 
 }
@@ -29,6 +29,15 @@ template<class C> class visitor : virtual public basevisitor
 		virtual ~visitor() {}
 		virtual void visitStart( C& elt ) {};
 		virtual void visitEnd  ( C& elt ) {};
+
+		//! the visitor<C> interface of v, if any: same as dynamic_cast<visitor<C>*>(v) using the v dispatch table
+		static visitor<C>* cast (basevisitor* v) {
+			static const int id = visitortable::newId();
+			return static_cast<visitor<C>*>(v->dispatchTable()->cast (id, v, resolve));
+		}
+
+	private:
+		static void* resolve (basevisitor* v)	{ return dynamic_cast<visitor<C>*>(v); }
 };
 
 /*! @} */
@@ -0,0 +1,174 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#include <cctype>
+#include <cstdint>
+#include <cstring>
+#include "xmlwriter.h"
+
+using namespace std;
+
+namespace MusicXML2
+{
+
+//______________________________________________________________________________
+// the special characters are searched 8 bytes at a time:
+// a word contains the byte b when (word ^ b * kOnes) contains a null byte
+static const uint64_t kOnes  = 0x0101010101010101ULL;
+static const uint64_t kHighs = 0x8080808080808080ULL;
+
+static inline uint64_t hasbyte (uint64_t word, char b)
+{
+	uint64_t x = word ^ (kOnes * (unsigned char)b);
+	return (x - kOnes) & ~x & kHighs;
+}
+
+static inline bool isspecial (char c, bool attribute)
+{
+	return (c == '<') || (c == '&') || (attribute && (c == '"'));
+}
+
+// tells whether s starts with an entity or character reference such as "&amp;" or "&#233;"
+static bool isreference (const char* s, size_t n)
+{
+	size_t i = 1;
+	if ((i < n) && (s[i] == '#')) {
+		i++;
+		bool hex = (i < n) && ((s[i] == 'x') || (s[i] == 'X'));
+		if (hex) i++;
+		size_t first = i;
+		while ((i < n) && (hex ? isxdigit((unsigned char)s[i]) : isdigit((unsigned char)s[i]))) i++;
+		if (i == first) return false;
+	}
+	else {
+		if ((i >= n) || !(isalpha((unsigned char)s[i]) || (s[i] == '_') || (s[i] == ':'))) return false;
+		while ((i < n) && (isalnum((unsigned char)s[i]) || strchr ("-_.:", s[i]))) i++;
+	}
+	return (i < n) && (s[i] == ';');
+}
+
+void xmlwriter::escape (const string& value, bool attribute, string& out)
+{
+	const char* s = value.data();
+	size_t n = value.size();
+	size_t start = 0, i = 0;
+	while (true) {
+		// skip the words without special characters
+		while (i + 8 <= n) {
+			uint64_t word;
+			memcpy (&word, s + i, 8);
+			if (hasbyte(word, '<') | hasbyte(word, '&') | (attribute ? hasbyte(word, '"') : 0)) break;
+			i += 8;
+		}
+		size_t end = (i + 8 <= n) ? i + 8 : n;
+		while ((i < end) && !isspecial (s[i], attribute)) i++;
+		if (i == n) break;
+		if (i == end) continue;
+
+		out.append (s + start, i - start);
+		switch (s[i]) {
+			case '<':	out += "&lt;"; break;
+			case '"':	out += "&quot;"; break;
+			default:	out += isreference (s + i, n - i) ? "&" : "&amp;";
+		}
+		start = ++i;
+	}
+	out.append (s + start, n - start);
+}
+
+//______________________________________________________________________________
+xmlwriter::xmlwriter (ostream& stream, bool compact, size_t chunkSize)
+	: fOut(stream), fCompact(compact), fChunkSize(chunkSize), fIndentation("\n"), fDepth(0)
+{
+	fBuffer.reserve (fChunkSize + fChunkSize / 4);
+}
+
+xmlwriter::~xmlwriter ()	{ flush(); }
+
+void xmlwriter::flush ()
+{
+	fOut.write (fBuffer.data(), fBuffer.size());
+	fBuffer.clear();
+}
+
+//______________________________________________________________________________
+// the equivalent of xmlendl, a negative depth is written as no indentation
+void xmlwriter::newline ()
+{
+	if (fCompact && (fDepth > 0)) return;
+	size_t size = 1 + 4 * (fDepth > 0 ? fDepth : 0);
+	if (fIndentation.size() < size) fIndentation.resize (size, ' ');
+	fBuffer.append (fIndentation.data(), size);
+}
+
+//______________________________________________________________________________
+void xmlwriter::visitStart ( S_comment& elt )
+{
+	newline();
+	fBuffer += "<!--";
+	fBuffer += elt->getValue();
+	fBuffer += "-->";
+	if (fBuffer.size() >= fChunkSize) flush();
+}
+
+//______________________________________________________________________________
+void xmlwriter::visitStart ( S_processing_instruction& elt )
+{
+	newline();
+	fBuffer += "<?";
+	fBuffer += elt->getValue();
+	fBuffer += "?>";
+	if (fBuffer.size() >= fChunkSize) flush();
+}
+
+//______________________________________________________________________________
+void xmlwriter::visitStart ( Sxmlelement& elt )
+{
+	newline();
+	fBuffer += '<';
+	fBuffer += elt->getName();
+	// write the element attributes first
+	for (const auto& attr: elt->attributes()) {
+		fBuffer += ' ';
+		fBuffer += attr->getName();
+		fBuffer += "=\"";
+		escape (attr->getValue(), true, fBuffer);
+		fBuffer += '"';
+	}
+	if (elt->empty()) {
+		fBuffer += "/>";	// element is empty, we can directly close it
+	}
+	else {
+		fBuffer += '>';
+		if (!elt->getValue().empty())
+			escape (elt->getValue(), false, fBuffer);
+		if (elt->size())
+			fDepth++;
+	}
+	if (fBuffer.size() >= fChunkSize) flush();
+}
+
+//______________________________________________________________________________
+void xmlwriter::visitEnd ( Sxmlelement& elt )
+{
+	if (!elt->empty()) {
+		if (elt->size()) {
+			fDepth--;
+			newline();
+		}
+		fBuffer += "</";
+		fBuffer += elt->getName();
+		fBuffer += '>';
+	}
+}
+
+}
@@ -0,0 +1,76 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#ifndef __xmlwriter__
+#define __xmlwriter__
+
+#include <ostream>
+#include <string>
+
+#include "exports.h"
+#include "typedefs.h"
+#include "visitor.h"
+#include "xml.h"
+
+namespace MusicXML2
+{
+
+//______________________________________________________________________________
+/*!
+\brief a fast xml serializer.
+
+	xmlwriter produces the same output as xmlvisitor, but the elements
+	are written to a contiguous buffer, using a precomputed indentation string,
+	and the buffer is written to the output stream in large chunks, without flushing it.
+
+	The text and attribute values are escaped on the fly: '<' and the '&' that don't start
+	an entity or character reference become entities, as well as '"' in the attribute values.
+	The values read by xmlreader are thus written unchanged.
+
+	In compact mode, the top level elements are written on their own line,
+	without line breaks nor indentation inside them.
+*/
+class EXP xmlwriter :
+	public visitor<S_comment>,
+	public visitor<S_processing_instruction>,
+	public visitor<Sxmlelement>
+{
+	std::ostream&	fOut;
+	bool			fCompact;
+	size_t			fChunkSize;		// the size above which the buffer is written to fOut
+
+	std::string		fBuffer;
+	std::string		fIndentation;	// a newline followed by the indentation spaces of the deepest element so far
+	int				fDepth;
+
+	void	newline ();
+
+    public:
+				 xmlwriter(std::ostream& stream, bool compact=false, size_t chunkSize=256*1024);
+		virtual ~xmlwriter();
+
+		virtual void visitStart ( Sxmlelement& elt);
+		virtual void visitEnd   ( Sxmlelement& elt);
+		virtual void visitStart ( S_comment& elt);
+		virtual void visitStart ( S_processing_instruction& elt);
+
+		//! writes the buffer contents to the output stream, which is not flushed
+		void	flush ();
+
+		//! appends value to out, escaped for use as an element text or as an attribute value
+		static void escape (const std::string& value, bool attribute, std::string& out);
+};
+
+} // namespace MusicXML2
+
+
+#endif
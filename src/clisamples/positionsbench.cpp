@@ -0,0 +1,166 @@
+/*
+  MusicFormats Library
+  Copyright (C) Jacques Menu 2016-2025
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, you can obtain one at http://mozilla.org/MPL/2.0/.
+
+  https://github.com/jacques-menu/musicformats
+*/
+
+/*
+  This file measures the rational arithmetic used by the MSR measures:
+  the computation of the notes positions in measures
+  and the finalization of the measures,
+  i.e. padding them up to the time signature duration
+*/
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <stdlib.h>
+
+#include "mfDurationsAndPositionInMeasures.h"
+#include "mfMoments.h"
+
+
+using namespace MusicFormats;
+
+
+//------------------------------------------------------------------------
+static void usage (char* name)
+{
+  std::cerr <<
+    "usage: " << name << " [count]" << std::endl <<
+    "       computes the positions in measures of <count> notes (default 1000000)" << std::endl <<
+    "       and finalizes the resulting measures, reporting the rates" << std::endl;
+
+  exit (1);
+}
+
+//------------------------------------------------------------------------
+static double elapsed (std::chrono::steady_clock::time_point start)
+{
+  return
+    std::chrono::duration<double> (
+      std::chrono::steady_clock::now () - start).count ();
+}
+
+static void report (const char* what, size_t n, double seconds)
+{
+  std::cout <<
+    what << ": " << n << " in " << seconds * 1000 << " ms, " <<
+    (n / seconds) / 1e6 << " M/s" << std::endl;
+}
+
+//------------------------------------------------------------------------
+int main (int argc, char* argv[])
+{
+  int count = 1000000;
+
+  if (argc > 2) usage (argv [0]);
+  if (argc == 2) {
+    count = atoi (argv [1]);
+    if (count < 1) usage (argv [0]);
+  }
+
+  // the notes durations, including dotted notes and tuplets members,
+  // as found in the usual scores
+  const std::vector<mfWholeNotes>
+    durations = {
+      mfWholeNotes (1, 4), mfWholeNotes (1, 8), mfWholeNotes (1, 16),
+      mfWholeNotes (3, 8), mfWholeNotes (3, 16), mfWholeNotes (1, 2),
+      mfWholeNotes (1, 12), mfWholeNotes (1, 12), mfWholeNotes (1, 12),
+      mfWholeNotes (1, 20), mfWholeNotes (1, 24), mfWholeNotes (7, 32)
+    };
+
+  const mfWholeNotes
+    fullMeasureWholeNotes (3, 4);
+
+  std::vector<mfWholeNotes> notesDurations;
+  notesDurations.reserve (count);
+
+  srand (1);
+  for (int i = 0; i < count; ++i) {
+    notesDurations.push_back (durations [rand () % durations.size ()]);
+  }
+
+  const mfPositionInMeasure
+    fullMeasurePosition =
+      mfPositionInMeasure::createFromWholeNotes (fullMeasureWholeNotes);
+
+  // positions in measures: the notes are appended to the current measure,
+  // and a new measure is started when the note doesn't fit in it
+  std::vector<mfPositionInMeasure> notesPositions;
+  notesPositions.reserve (count);
+
+  std::vector<mfPositionInMeasure> measuresEndPositions;
+
+  auto start = std::chrono::steady_clock::now ();
+
+  mfPositionInMeasure currentPosition;
+
+  for (const mfWholeNotes& noteDuration : notesDurations) {
+    if (currentPosition + noteDuration > fullMeasurePosition) {
+      measuresEndPositions.push_back (currentPosition);
+      currentPosition = K_POSITION_IN_MEASURE_ZERO;
+    }
+
+    notesPositions.push_back (currentPosition);
+
+    currentPosition += noteDuration;
+  }
+
+  report ("positions in measures", notesPositions.size (), elapsed (start));
+
+  // measures finalization: the measures shorter than the time signature
+  // are padded, the others are checked against the longest measure so far
+  start = std::chrono::steady_clock::now ();
+
+  mfWholeNotes
+    paddingsTotal,
+    longestMeasureWholeNotes;
+  mfMoment
+    latestMoment (K_POSITION_IN_MEASURE_ZERO);
+  size_t
+    overfullMeasuresNumber = 0;
+
+  for (const mfPositionInMeasure& endPosition : measuresEndPositions) {
+    mfWholeNotes
+      measureWholeNotes =
+        endPosition - K_POSITION_IN_MEASURE_ZERO;
+
+    if (measureWholeNotes < fullMeasureWholeNotes) {
+      paddingsTotal += fullMeasureWholeNotes - measureWholeNotes;
+    }
+    else if (measureWholeNotes > fullMeasureWholeNotes) {
+      ++overfullMeasuresNumber;
+    }
+
+    if (measureWholeNotes > longestMeasureWholeNotes) {
+      longestMeasureWholeNotes = measureWholeNotes;
+    }
+
+    mfMoment
+      endMoment (
+        endPosition,
+        measureWholeNotes - fullMeasureWholeNotes);
+
+    if (endMoment > latestMoment) {
+      latestMoment = endMoment;
+    }
+  }
+
+  report ("measures finalizations", measuresEndPositions.size (), elapsed (start));
+
+  std::cout <<
+    "check: " <<
+    overfullMeasuresNumber << " overfull measures, " <<
+    "paddings " << paddingsTotal.asFractionString () << ", " <<
+    "longest " << longestMeasureWholeNotes.asFractionString () << ", " <<
+    "latest moment " << latestMoment.asString () << std::endl;
+
+  return 0;
+}
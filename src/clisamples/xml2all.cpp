@@ -0,0 +1,24 @@
+/*
+  MusicFormats Library
+  Copyright (C) Jacques Menu 2016-2025
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, you can obtain one at http://mozilla.org/MPL/2.0/.
+
+  https://github.com/jacques-menu/musicformats
+*/
+
+#include "xml2allInterface.h"
+
+
+using namespace MusicFormats;
+
+//_______________________________________________________________________________
+int main (int argc, char* argv[])
+{
+  return
+    xml2all (
+      argc,
+      argv);
+}
@@ -40,6 +40,7 @@
 #include "LilyPondIssue34Component.h"
 
 // converters
+#include "musicxml2allComponent.h"
 #include "musicxml2brailleComponent.h"
 #include "musicxml2guidoComponent.h"
 #include "musicxml2lilypondComponent.h"
@@ -345,7 +345,7 @@ void msdl2brailleInsiderOahGroup::acceptIn (basevisitor* v)
 
   if (visitor<S_msdl2brailleInsiderOahGroup>*
     p =
-      dynamic_cast<visitor<S_msdl2brailleInsiderOahGroup>*> (v)) {
+      visitor<S_msdl2brailleInsiderOahGroup>::cast (v)) {
         S_msdl2brailleInsiderOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -381,7 +381,7 @@ void msdl2brailleInsiderOahGroup::acceptOut (basevisitor* v)
 
   if (visitor<S_msdl2brailleInsiderOahGroup>*
     p =
-      dynamic_cast<visitor<S_msdl2brailleInsiderOahGroup>*> (v)) {
+      visitor<S_msdl2brailleInsiderOahGroup>::cast (v)) {
         S_msdl2brailleInsiderOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
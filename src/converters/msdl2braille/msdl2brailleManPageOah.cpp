@@ -95,7 +95,7 @@ void msdl2brailleManPageGenerateAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_msdl2brailleManPageGenerateAtom>*
     p =
-      dynamic_cast<visitor<S_msdl2brailleManPageGenerateAtom>*> (v)) {
+      visitor<S_msdl2brailleManPageGenerateAtom>::cast (v)) {
         S_msdl2brailleManPageGenerateAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -131,7 +131,7 @@ void msdl2brailleManPageGenerateAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_msdl2brailleManPageGenerateAtom>*
     p =
-      dynamic_cast<visitor<S_msdl2brailleManPageGenerateAtom>*> (v)) {
+      visitor<S_msdl2brailleManPageGenerateAtom>::cast (v)) {
         S_msdl2brailleManPageGenerateAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -332,7 +332,7 @@ void msdl2brailleManPageOahGroup::acceptIn (basevisitor* v)
 
   if (visitor<S_msdl2brailleManPageOahGroup>*
     p =
-      dynamic_cast<visitor<S_msdl2brailleManPageOahGroup>*> (v)) {
+      visitor<S_msdl2brailleManPageOahGroup>::cast (v)) {
         S_msdl2brailleManPageOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -368,7 +368,7 @@ void msdl2brailleManPageOahGroup::acceptOut (basevisitor* v)
 
   if (visitor<S_msdl2brailleManPageOahGroup>*
     p =
-      dynamic_cast<visitor<S_msdl2brailleManPageOahGroup>*> (v)) {
+      visitor<S_msdl2brailleManPageOahGroup>::cast (v)) {
         S_msdl2brailleManPageOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -342,7 +342,7 @@ void msdl2guidoInsiderOahGroup::acceptIn (basevisitor* v)
 
   if (visitor<S_msdl2guidoInsiderOahGroup>*
     p =
-      dynamic_cast<visitor<S_msdl2guidoInsiderOahGroup>*> (v)) {
+      visitor<S_msdl2guidoInsiderOahGroup>::cast (v)) {
         S_msdl2guidoInsiderOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -378,7 +378,7 @@ void msdl2guidoInsiderOahGroup::acceptOut (basevisitor* v)
 
   if (visitor<S_msdl2guidoInsiderOahGroup>*
     p =
-      dynamic_cast<visitor<S_msdl2guidoInsiderOahGroup>*> (v)) {
+      visitor<S_msdl2guidoInsiderOahGroup>::cast (v)) {
         S_msdl2guidoInsiderOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -95,7 +95,7 @@ void msdl2guidoManPageGenerateAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_msdl2guidoManPageGenerateAtom>*
     p =
-      dynamic_cast<visitor<S_msdl2guidoManPageGenerateAtom>*> (v)) {
+      visitor<S_msdl2guidoManPageGenerateAtom>::cast (v)) {
         S_msdl2guidoManPageGenerateAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -131,7 +131,7 @@ void msdl2guidoManPageGenerateAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_msdl2guidoManPageGenerateAtom>*
     p =
-      dynamic_cast<visitor<S_msdl2guidoManPageGenerateAtom>*> (v)) {
+      visitor<S_msdl2guidoManPageGenerateAtom>::cast (v)) {
         S_msdl2guidoManPageGenerateAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -345,7 +345,7 @@ void msdl2guidoManPageOahGroup::acceptIn (basevisitor* v)
 
   if (visitor<S_msdl2guidoManPageOahGroup>*
     p =
-      dynamic_cast<visitor<S_msdl2guidoManPageOahGroup>*> (v)) {
+      visitor<S_msdl2guidoManPageOahGroup>::cast (v)) {
         S_msdl2guidoManPageOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -381,7 +381,7 @@ void msdl2guidoManPageOahGroup::acceptOut (basevisitor* v)
 
   if (visitor<S_msdl2guidoManPageOahGroup>*
     p =
-      dynamic_cast<visitor<S_msdl2guidoManPageOahGroup>*> (v)) {
+      visitor<S_msdl2guidoManPageOahGroup>::cast (v)) {
         S_msdl2guidoManPageOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -1252,6 +1252,7 @@ void msdl2guidoRegularHandler::createOutputRegularGroup ()
   registerAtomInRegularSubgroup ("generate-guido-comments", subGroup);
   registerAtomInRegularSubgroup ("generate-guido-stem", subGroup);
   registerAtomInRegularSubgroup ("generate-guido-bars", subGroup);
+  registerAtomInRegularSubgroup ("generate-guido-parts-in-parallel", subGroup);
 }
 
 //______________________________________________________________________________
@@ -381,7 +381,7 @@ void msdl2lilypondInsiderOahGroup::acceptIn (basevisitor* v)
 
   if (visitor<S_msdl2lilypondInsiderOahGroup>*
     p =
-      dynamic_cast<visitor<S_msdl2lilypondInsiderOahGroup>*> (v)) {
+      visitor<S_msdl2lilypondInsiderOahGroup>::cast (v)) {
         S_msdl2lilypondInsiderOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -417,7 +417,7 @@ void msdl2lilypondInsiderOahGroup::acceptOut (basevisitor* v)
 
   if (visitor<S_msdl2lilypondInsiderOahGroup>*
     p =
-      dynamic_cast<visitor<S_msdl2lilypondInsiderOahGroup>*> (v)) {
+      visitor<S_msdl2lilypondInsiderOahGroup>::cast (v)) {
         S_msdl2lilypondInsiderOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
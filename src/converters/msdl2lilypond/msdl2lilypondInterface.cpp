@@ -372,6 +372,9 @@ mfMusicformatsErrorKind convertMsdlStream2lilypondWithHandler (
     }
 #endif // MF_TRACE_IS_ENABLED
 
+    // write the buffered LilyPond code before closing the file
+    lilypondFileOutputStream.flush ();
+
     outputFileStream.close ();
   }
 
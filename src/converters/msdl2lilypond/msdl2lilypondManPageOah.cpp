@@ -95,7 +95,7 @@ void msdl2lilypondManPageGenerateAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_msdl2lilypondManPageGenerateAtom>*
     p =
-      dynamic_cast<visitor<S_msdl2lilypondManPageGenerateAtom>*> (v)) {
+      visitor<S_msdl2lilypondManPageGenerateAtom>::cast (v)) {
         S_msdl2lilypondManPageGenerateAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -131,7 +131,7 @@ void msdl2lilypondManPageGenerateAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_msdl2lilypondManPageGenerateAtom>*
     p =
-      dynamic_cast<visitor<S_msdl2lilypondManPageGenerateAtom>*> (v)) {
+      visitor<S_msdl2lilypondManPageGenerateAtom>::cast (v)) {
         S_msdl2lilypondManPageGenerateAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -345,7 +345,7 @@ void msdl2lilypondManPageOahGroup::acceptIn (basevisitor* v)
 
   if (visitor<S_msdl2lilypondManPageOahGroup>*
     p =
-      dynamic_cast<visitor<S_msdl2lilypondManPageOahGroup>*> (v)) {
+      visitor<S_msdl2lilypondManPageOahGroup>::cast (v)) {
         S_msdl2lilypondManPageOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -381,7 +381,7 @@ void msdl2lilypondManPageOahGroup::acceptOut (basevisitor* v)
 
   if (visitor<S_msdl2lilypondManPageOahGroup>*
     p =
-      dynamic_cast<visitor<S_msdl2lilypondManPageOahGroup>*> (v)) {
+      visitor<S_msdl2lilypondManPageOahGroup>::cast (v)) {
         S_msdl2lilypondManPageOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
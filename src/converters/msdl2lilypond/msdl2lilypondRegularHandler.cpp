@@ -821,6 +821,7 @@ void msdl2lilypondRegularHandler::createRestsRegularGroup ()
   // atoms
 
   registerAtomInRegularSubgroup ("avoid-msr2msr", subGroup); // for TESTS
+  registerAtomInRegularSubgroup ("share-msr-notes", subGroup);
 
   registerAtomInRegularSubgroup ("delay-rests-slashes", subGroup);
 
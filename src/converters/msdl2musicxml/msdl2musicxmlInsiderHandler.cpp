@@ -344,7 +344,7 @@ void msdl2musicxmlInsiderOahGroup::acceptIn (basevisitor* v)
 
   if (visitor<S_msdl2musicxmlInsiderOahGroup>*
     p =
-      dynamic_cast<visitor<S_msdl2musicxmlInsiderOahGroup>*> (v)) {
+      visitor<S_msdl2musicxmlInsiderOahGroup>::cast (v)) {
         S_msdl2musicxmlInsiderOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -380,7 +380,7 @@ void msdl2musicxmlInsiderOahGroup::acceptOut (basevisitor* v)
 
   if (visitor<S_msdl2musicxmlInsiderOahGroup>*
     p =
-      dynamic_cast<visitor<S_msdl2musicxmlInsiderOahGroup>*> (v)) {
+      visitor<S_msdl2musicxmlInsiderOahGroup>::cast (v)) {
         S_msdl2musicxmlInsiderOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -95,7 +95,7 @@ void msdl2musicxmlManPageGenerateAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_msdl2musicxmlManPageGenerateAtom>*
     p =
-      dynamic_cast<visitor<S_msdl2musicxmlManPageGenerateAtom>*> (v)) {
+      visitor<S_msdl2musicxmlManPageGenerateAtom>::cast (v)) {
         S_msdl2musicxmlManPageGenerateAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -131,7 +131,7 @@ void msdl2musicxmlManPageGenerateAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_msdl2musicxmlManPageGenerateAtom>*
     p =
-      dynamic_cast<visitor<S_msdl2musicxmlManPageGenerateAtom>*> (v)) {
+      visitor<S_msdl2musicxmlManPageGenerateAtom>::cast (v)) {
         S_msdl2musicxmlManPageGenerateAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -345,7 +345,7 @@ void msdl2musicxmlManPageOahGroup::acceptIn (basevisitor* v)
 
   if (visitor<S_msdl2musicxmlManPageOahGroup>*
     p =
-      dynamic_cast<visitor<S_msdl2musicxmlManPageOahGroup>*> (v)) {
+      visitor<S_msdl2musicxmlManPageOahGroup>::cast (v)) {
         S_msdl2musicxmlManPageOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -381,7 +381,7 @@ void msdl2musicxmlManPageOahGroup::acceptOut (basevisitor* v)
 
   if (visitor<S_msdl2musicxmlManPageOahGroup>*
     p =
-      dynamic_cast<visitor<S_msdl2musicxmlManPageOahGroup>*> (v)) {
+      visitor<S_msdl2musicxmlManPageOahGroup>::cast (v)) {
         S_msdl2musicxmlManPageOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
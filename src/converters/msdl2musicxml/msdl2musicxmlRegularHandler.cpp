@@ -1254,6 +1254,7 @@ void msdl2musicxmlRegularHandler::createOutputRegularGroup ()
 
   registerAtomInRegularSubgroup ("msdl2musicxml-infos", subGroup);
   registerAtomInRegularSubgroup ("musicxml-comments", subGroup);
+  registerAtomInRegularSubgroup ("compact-musicxml", subGroup);
 }
 
 //______________________________________________________________________________
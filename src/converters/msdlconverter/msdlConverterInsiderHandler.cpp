@@ -926,7 +926,7 @@ void msdlConverterInsiderOahGroup::acceptIn (basevisitor* v)
 
   if (visitor<S_msdlConverterInsiderOahGroup>*
     p =
-      dynamic_cast<visitor<S_msdlConverterInsiderOahGroup>*> (v)) {
+      visitor<S_msdlConverterInsiderOahGroup>::cast (v)) {
         S_msdlConverterInsiderOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -962,7 +962,7 @@ void msdlConverterInsiderOahGroup::acceptOut (basevisitor* v)
 
   if (visitor<S_msdlConverterInsiderOahGroup>*
     p =
-      dynamic_cast<visitor<S_msdlConverterInsiderOahGroup>*> (v)) {
+      visitor<S_msdlConverterInsiderOahGroup>::cast (v)) {
         S_msdlConverterInsiderOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
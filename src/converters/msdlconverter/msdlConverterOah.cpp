@@ -102,7 +102,7 @@ void msdlConverterOahGroup::acceptIn (basevisitor* v)
 
   if (visitor<S_msdlConverterOahGroup>*
     p =
-      dynamic_cast<visitor<S_msdlConverterOahGroup>*> (v)) {
+      visitor<S_msdlConverterOahGroup>::cast (v)) {
         S_msdlConverterOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -138,7 +138,7 @@ void msdlConverterOahGroup::acceptOut (basevisitor* v)
 
   if (visitor<S_msdlConverterOahGroup>*
     p =
-      dynamic_cast<visitor<S_msdlConverterOahGroup>*> (v)) {
+      visitor<S_msdlConverterOahGroup>::cast (v)) {
         S_msdlConverterOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
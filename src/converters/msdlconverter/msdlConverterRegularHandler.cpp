@@ -375,6 +375,7 @@ void msdlConverterRegularHandler::createGuidoRegularGroup ()
   registerAtomInRegularSubgroup ("generate-guido-comments", subGroup);
   registerAtomInRegularSubgroup ("generate-guido-stem", subGroup);
   registerAtomInRegularSubgroup ("generate-guido-bars", subGroup);
+  registerAtomInRegularSubgroup ("generate-guido-parts-in-parallel", subGroup);
 }
 
 void msdlConverterRegularHandler::createBrailleRegularGroup ()
@@ -562,7 +562,7 @@ void msr2brailleInsiderOahGroup::acceptIn (basevisitor* v)
 
   if (visitor<S_msr2brailleInsiderOahGroup>*
     p =
-      dynamic_cast<visitor<S_msr2brailleInsiderOahGroup>*> (v)) {
+      visitor<S_msr2brailleInsiderOahGroup>::cast (v)) {
         S_msr2brailleInsiderOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -598,7 +598,7 @@ void msr2brailleInsiderOahGroup::acceptOut (basevisitor* v)
 
   if (visitor<S_msr2brailleInsiderOahGroup>*
     p =
-      dynamic_cast<visitor<S_msr2brailleInsiderOahGroup>*> (v)) {
+      visitor<S_msr2brailleInsiderOahGroup>::cast (v)) {
         S_msr2brailleInsiderOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
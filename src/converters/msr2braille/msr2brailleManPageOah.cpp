@@ -97,7 +97,7 @@ void msr2brailleManPageGenerateAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_msr2brailleManPageGenerateAtom>*
     p =
-      dynamic_cast<visitor<S_msr2brailleManPageGenerateAtom>*> (v)) {
+      visitor<S_msr2brailleManPageGenerateAtom>::cast (v)) {
         S_msr2brailleManPageGenerateAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -133,7 +133,7 @@ void msr2brailleManPageGenerateAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_msr2brailleManPageGenerateAtom>*
     p =
-      dynamic_cast<visitor<S_msr2brailleManPageGenerateAtom>*> (v)) {
+      visitor<S_msr2brailleManPageGenerateAtom>::cast (v)) {
         S_msr2brailleManPageGenerateAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -334,7 +334,7 @@ void msr2brailleManPageOahGroup::acceptIn (basevisitor* v)
 
   if (visitor<S_msr2brailleManPageOahGroup>*
     p =
-      dynamic_cast<visitor<S_msr2brailleManPageOahGroup>*> (v)) {
+      visitor<S_msr2brailleManPageOahGroup>::cast (v)) {
         S_msr2brailleManPageOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -370,7 +370,7 @@ void msr2brailleManPageOahGroup::acceptOut (basevisitor* v)
 
   if (visitor<S_msr2brailleManPageOahGroup>*
     p =
-      dynamic_cast<visitor<S_msr2brailleManPageOahGroup>*> (v)) {
+      visitor<S_msr2brailleManPageOahGroup>::cast (v)) {
         S_msr2brailleManPageOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -478,7 +478,7 @@ void msr2guidoInsiderOahGroup::acceptIn (basevisitor* v)
 
   if (visitor<S_msr2guidoInsiderOahGroup>*
     p =
-      dynamic_cast<visitor<S_msr2guidoInsiderOahGroup>*> (v)) {
+      visitor<S_msr2guidoInsiderOahGroup>::cast (v)) {
         S_msr2guidoInsiderOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -514,7 +514,7 @@ void msr2guidoInsiderOahGroup::acceptOut (basevisitor* v)
 
   if (visitor<S_msr2guidoInsiderOahGroup>*
     p =
-      dynamic_cast<visitor<S_msr2guidoInsiderOahGroup>*> (v)) {
+      visitor<S_msr2guidoInsiderOahGroup>::cast (v)) {
         S_msr2guidoInsiderOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
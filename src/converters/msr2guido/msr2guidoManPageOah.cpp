@@ -95,7 +95,7 @@ void msr2guidoManPageGenerateAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_msr2guidoManPageGenerateAtom>*
     p =
-      dynamic_cast<visitor<S_msr2guidoManPageGenerateAtom>*> (v)) {
+      visitor<S_msr2guidoManPageGenerateAtom>::cast (v)) {
         S_msr2guidoManPageGenerateAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -131,7 +131,7 @@ void msr2guidoManPageGenerateAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_msr2guidoManPageGenerateAtom>*
     p =
-      dynamic_cast<visitor<S_msr2guidoManPageGenerateAtom>*> (v)) {
+      visitor<S_msr2guidoManPageGenerateAtom>::cast (v)) {
         S_msr2guidoManPageGenerateAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -345,7 +345,7 @@ void msr2guidoManPageOahGroup::acceptIn (basevisitor* v)
 
   if (visitor<S_msr2guidoManPageOahGroup>*
     p =
-      dynamic_cast<visitor<S_msr2guidoManPageOahGroup>*> (v)) {
+      visitor<S_msr2guidoManPageOahGroup>::cast (v)) {
         S_msr2guidoManPageOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -381,7 +381,7 @@ void msr2guidoManPageOahGroup::acceptOut (basevisitor* v)
 
   if (visitor<S_msr2guidoManPageOahGroup>*
     p =
-      dynamic_cast<visitor<S_msr2guidoManPageOahGroup>*> (v)) {
+      visitor<S_msr2guidoManPageOahGroup>::cast (v)) {
         S_msr2guidoManPageOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -1250,6 +1250,7 @@ void msr2guidoRegularHandler::createOutputRegularGroup ()
   registerAtomInRegularSubgroup ("generate-guido-comments", subGroup);
   registerAtomInRegularSubgroup ("generate-guido-stem", subGroup);
   registerAtomInRegularSubgroup ("generate-guido-bars", subGroup);
+  registerAtomInRegularSubgroup ("generate-guido-parts-in-parallel", subGroup);
 }
 
 //______________________________________________________________________________
@@ -526,7 +526,7 @@ void msr2lilypondInsiderOahGroup::acceptIn (basevisitor* v)
 
   if (visitor<S_msr2lilypondInsiderOahGroup>*
     p =
-      dynamic_cast<visitor<S_msr2lilypondInsiderOahGroup>*> (v)) {
+      visitor<S_msr2lilypondInsiderOahGroup>::cast (v)) {
         S_msr2lilypondInsiderOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -562,7 +562,7 @@ void msr2lilypondInsiderOahGroup::acceptOut (basevisitor* v)
 
   if (visitor<S_msr2lilypondInsiderOahGroup>*
     p =
-      dynamic_cast<visitor<S_msr2lilypondInsiderOahGroup>*> (v)) {
+      visitor<S_msr2lilypondInsiderOahGroup>::cast (v)) {
         S_msr2lilypondInsiderOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
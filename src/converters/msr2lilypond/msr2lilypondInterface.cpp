@@ -267,6 +267,9 @@ EXP mfMusicformatsErrorKind msrScore2lilypondWithHandler (
       }
 #endif // MF_TRACE_IS_ENABLED
 
+      // write the buffered LilyPond code before closing the file
+      lilypondFileOutputStream.flush ();
+
       outputFileStream.close ();
     }
   }
@@ -95,7 +95,7 @@ void msr2lilypondManPageGenerateAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_msr2lilypondManPageGenerateAtom>*
     p =
-      dynamic_cast<visitor<S_msr2lilypondManPageGenerateAtom>*> (v)) {
+      visitor<S_msr2lilypondManPageGenerateAtom>::cast (v)) {
         S_msr2lilypondManPageGenerateAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -131,7 +131,7 @@ void msr2lilypondManPageGenerateAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_msr2lilypondManPageGenerateAtom>*
     p =
-      dynamic_cast<visitor<S_msr2lilypondManPageGenerateAtom>*> (v)) {
+      visitor<S_msr2lilypondManPageGenerateAtom>::cast (v)) {
         S_msr2lilypondManPageGenerateAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -345,7 +345,7 @@ void msr2lilypondManPageOahGroup::acceptIn (basevisitor* v)
 
   if (visitor<S_msr2lilypondManPageOahGroup>*
     p =
-      dynamic_cast<visitor<S_msr2lilypondManPageOahGroup>*> (v)) {
+      visitor<S_msr2lilypondManPageOahGroup>::cast (v)) {
         S_msr2lilypondManPageOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -381,7 +381,7 @@ void msr2lilypondManPageOahGroup::acceptOut (basevisitor* v)
 
   if (visitor<S_msr2lilypondManPageOahGroup>*
     p =
-      dynamic_cast<visitor<S_msr2lilypondManPageOahGroup>*> (v)) {
+      visitor<S_msr2lilypondManPageOahGroup>::cast (v)) {
         S_msr2lilypondManPageOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -817,6 +817,7 @@ void msr2lilypondRegularHandler::createRestsRegularGroup ()
 
 
   registerAtomInRegularSubgroup ("avoid-msr2msr", subGroup); // for TESTS
+  registerAtomInRegularSubgroup ("share-msr-notes", subGroup);
 
   registerAtomInRegularSubgroup ("delay-rests-slashes", subGroup);
 
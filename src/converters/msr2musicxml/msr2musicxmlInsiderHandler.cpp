@@ -477,7 +477,7 @@ void msr2musicxmlInsiderOahGroup::acceptIn (basevisitor* v)
 
   if (visitor<S_msr2musicxmlInsiderOahGroup>*
     p =
-      dynamic_cast<visitor<S_msr2musicxmlInsiderOahGroup>*> (v)) {
+      visitor<S_msr2musicxmlInsiderOahGroup>::cast (v)) {
         S_msr2musicxmlInsiderOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -513,7 +513,7 @@ void msr2musicxmlInsiderOahGroup::acceptOut (basevisitor* v)
 
   if (visitor<S_msr2musicxmlInsiderOahGroup>*
     p =
-      dynamic_cast<visitor<S_msr2musicxmlInsiderOahGroup>*> (v)) {
+      visitor<S_msr2musicxmlInsiderOahGroup>::cast (v)) {
         S_msr2musicxmlInsiderOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
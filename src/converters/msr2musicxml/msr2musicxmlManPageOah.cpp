@@ -95,7 +95,7 @@ void msr2musicxmlManPageGenerateAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_msr2musicxmlManPageGenerateAtom>*
     p =
-      dynamic_cast<visitor<S_msr2musicxmlManPageGenerateAtom>*> (v)) {
+      visitor<S_msr2musicxmlManPageGenerateAtom>::cast (v)) {
         S_msr2musicxmlManPageGenerateAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -131,7 +131,7 @@ void msr2musicxmlManPageGenerateAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_msr2musicxmlManPageGenerateAtom>*
     p =
-      dynamic_cast<visitor<S_msr2musicxmlManPageGenerateAtom>*> (v)) {
+      visitor<S_msr2musicxmlManPageGenerateAtom>::cast (v)) {
         S_msr2musicxmlManPageGenerateAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -345,7 +345,7 @@ void msr2musicxmlManPageOahGroup::acceptIn (basevisitor* v)
 
   if (visitor<S_msr2musicxmlManPageOahGroup>*
     p =
-      dynamic_cast<visitor<S_msr2musicxmlManPageOahGroup>*> (v)) {
+      visitor<S_msr2musicxmlManPageOahGroup>::cast (v)) {
         S_msr2musicxmlManPageOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -381,7 +381,7 @@ void msr2musicxmlManPageOahGroup::acceptOut (basevisitor* v)
 
   if (visitor<S_msr2musicxmlManPageOahGroup>*
     p =
-      dynamic_cast<visitor<S_msr2musicxmlManPageOahGroup>*> (v)) {
+      visitor<S_msr2musicxmlManPageOahGroup>::cast (v)) {
         S_msr2musicxmlManPageOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
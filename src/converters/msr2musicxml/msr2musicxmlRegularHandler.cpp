@@ -1254,6 +1254,7 @@ void msr2musicxmlRegularHandler::createOutputRegularGroup ()
 
   registerAtomInRegularSubgroup ("msr2musicxml-infos", subGroup);
   registerAtomInRegularSubgroup ("musicxml-comments", subGroup);
+  registerAtomInRegularSubgroup ("compact-musicxml", subGroup);
 }
 
 //______________________________________________________________________________
@@ -0,0 +1,118 @@
+/*
+  MusicFormats Library
+  Copyright (C) Jacques Menu 2016-2025
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, you can obtain one at http://mozilla.org/MPL/2.0/.
+
+  https://github.com/jacques-menu/musicformats
+*/
+
+#include "mfcComponents.h"
+
+
+namespace MusicFormats
+{
+
+static S_mfcConverterComponent pConverterComponent;
+
+//______________________________________________________________________________
+static void populateMultiComponent ()
+{
+  // populate the converter's representations list
+  pConverterComponent->
+    appendRepresentationToMultiComponent (
+      createMxsrRepresentationComponent ());
+  pConverterComponent->
+    appendRepresentationToMultiComponent (
+      createMsrRepresentationComponent ());
+  pConverterComponent->
+    appendRepresentationToMultiComponent (
+      createLpsrRepresentationComponent ());
+  pConverterComponent->
+    appendRepresentationToMultiComponent (
+      createBsrRepresentationComponent ());
+
+  // populate the converter's passes list
+  pConverterComponent->
+    appendPassToMultiComponent (
+      createMxsr2msrComponent ());
+
+  pConverterComponent->
+    appendPassToMultiComponent (
+      createMsr2msrComponent ());
+
+  pConverterComponent->
+    appendPassToMultiComponent (
+      createMsr2lpsrComponent ());
+  pConverterComponent->
+    appendPassToMultiComponent (
+      createLpsr2lilypondComponent ());
+
+  pConverterComponent->
+    appendPassToMultiComponent (
+      createMsr2bsrComponent ());
+  pConverterComponent->
+    appendPassToMultiComponent (
+      createBsr2bsrComponent ());
+  pConverterComponent->
+    appendPassToMultiComponent (
+      createBsr2brailleComponent ());
+
+  pConverterComponent->
+    appendPassToMultiComponent (
+      createMsr2mxsrComponent ());
+  pConverterComponent->
+    appendPassToMultiComponent (
+      createMxsr2musicxmlComponent ());
+  pConverterComponent->
+    appendPassToMultiComponent (
+      createMxsr2guidoComponent ());
+}
+
+//______________________________________________________________________________
+EXP S_mfcConverterComponent createMusicxml2allConverterComponent ()
+{
+  // protect library against multiple initializations
+  if (! pConverterComponent) {
+
+#ifdef MF_TRACE_IS_ENABLED
+    if (gEarlyOptions.getEarlyTraceComponents ()) {
+      std::stringstream ss;
+
+      ss <<
+        "Creating the musicxml2all component";
+
+      gWaeHandler->waeTraceWithoutInputLocation (
+        __FILE__, mfInputLineNumber (__LINE__),
+        ss.str ());
+    }
+#endif // MF_TRACE_IS_ENABLED
+
+    // create the converter component
+    pConverterComponent =
+      mfcConverterComponent::create (
+        "musicxml2all",
+        mfcMultiComponentEntropicityKind::kComponentEntropicityYes,
+        mfcMultiComponentUsedFromTheCLIKind::kComponentUsedFromTheCLIYes); // JMI ???
+
+    // populate the converter's own history
+    pConverterComponent->
+      appendVersionToComponent (
+        mfcVersion::create (
+          mfcVersionNumber::createFromString ("0.9.75"),
+          "June 14, 2025",
+          std::list <std::string> {
+            "Start of the multi-target converter"
+          }
+      ));
+
+    populateMultiComponent ();
+  }
+
+  return pConverterComponent;
+}
+
+
+}
@@ -0,0 +1,31 @@
+/*
+  MusicFormats Library
+  Copyright (C) Jacques Menu 2016-2025
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, you can obtain one at http://mozilla.org/MPL/2.0/.
+
+  https://github.com/jacques-menu/musicformats
+*/
+
+#ifndef ___musicxml2allComponent___
+#define ___musicxml2allComponent___
+
+#include "exports.h"
+
+#include "mfcBasicTypes.h"
+
+
+namespace MusicFormats
+{
+
+//______________________________________________________________________________
+EXP S_mfcConverterComponent createMusicxml2allConverterComponent ();
+
+
+}
+
+
+#endif // ___musicxml2allComponent___
+
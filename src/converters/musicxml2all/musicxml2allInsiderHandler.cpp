@@ -0,0 +1,888 @@
+/*
+  MusicFormats Library
+  Copyright (C) Jacques Menu 2016-2025
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, you can obtain one at http://mozilla.org/MPL/2.0/.
+
+  https://github.com/jacques-menu/musicformats
+*/
+
+#include <iomanip>      // std::setw, std::setprecision, ...
+
+#include "visitor.h"
+
+#include "mfPreprocessorSettings.h"
+
+#include "oahWae.h"
+
+#include "mfInitialization.h"
+#include "mfServices.h"
+#include "mfStringsHandling.h"
+
+#include "msrInitialization.h"
+#include "lpsrInitialization.h"
+#include "bsrInitialization.h"
+
+#include "oahOah.h"
+#include "waeOah.h"
+#include "mfOutputFileOah.h"
+#include "oahDisplayOah.h"
+#include "oahHarmoniesExtraOah.h"
+
+#include "mxsr2msrOah.h"
+#include "msrOah.h"
+#include "msr2msrOah.h"
+#include "msr2lpsrOah.h"
+#include "lpsrOah.h"
+#include "lpsr2lilypondOah.h"
+#include "msr2bsrOah.h"
+#include "bsrOah.h"
+#include "brailleGenerationOah.h"
+#include "msr2mxsrOah.h"
+#include "guidoGenerationOah.h"
+
+#include "oahEarlyOptions.h"
+
+#include "musicxml2allComponent.h"
+
+#include "musicxml2allInsiderHandler.h"
+
+#include "waeHandlers.h"
+
+
+namespace MusicFormats
+{
+
+//______________________________________________________________________________
+S_xml2allInsiderHandler xml2allInsiderHandler::create (
+  const std::string& serviceName,
+  const std::string& handlerHeader)
+{
+  // create the insider handler
+  xml2allInsiderHandler* obj = new
+    xml2allInsiderHandler (
+      serviceName,
+      handlerHeader);
+  assert (obj!=0);
+
+  return obj;
+}
+
+xml2allInsiderHandler::xml2allInsiderHandler (
+  const std::string& serviceName,
+  const std::string& handlerHeader)
+  : oahInsiderHandler (
+      serviceName,
+      handlerHeader,
+R"(
+      Welcome to the MusicXML to LilyPond, braille, MusicXML
+                  and Guido multi-target converter
+          delivered as part of the MusicFormats library.
+
+      --- https://github.com/jacques-menu/musicformats ---
+)",
+R"(
+Usage: xml2all [[option]* [MusicXMLFile|-] [[option]*
+)")
+{
+#ifdef MF_TRACE_IS_ENABLED
+  if (gEarlyOptions.getTraceEarlyOptions ()) {
+    std::stringstream ss;
+
+    ss <<
+      "Initializing \"" <<
+      fHandlerHeader <<
+      "\" insider options handler";
+
+    gWaeHandler->waeTraceWithoutInputLocation (
+      __FILE__, mfInputLineNumber (__LINE__),
+      ss.str ());
+  }
+#endif // MF_TRACE_IS_ENABLED
+
+  // initialize the history
+  initializeHandlerMultiComponent ();
+
+  // create the xml2all prefixes
+  createTheXml2allPrefixes ();
+
+  // create the xml2all option groups
+  createTheXml2allOptionGroups (serviceName);
+}
+
+xml2allInsiderHandler::~xml2allInsiderHandler ()
+{}
+
+void xml2allInsiderHandler::initializeHandlerMultiComponent ()
+{
+  fHandlerMultiComponent =
+    createMusicxml2allConverterComponent ();
+}
+
+//_______________________________________________________________________________
+std::string xml2allInsiderHandler::handlerServiceAboutInformation () const
+{
+  return
+R"(What xml2all does:
+
+    This multi-pass converter parses its input once
+    and generates several output formats from it:
+        Pass 1: reads the contents of MusicXMLFile or stdin ('-')
+                and converts it to a first MusicXML tree;
+        Pass 2: converts that MusicXML tree into
+                a first Music Score Representation (MSR) skeleton;
+        Pass 3: populates the MSR skeleton from the MusicXML tree
+                to get a full MSR;
+        Pass 4: converts the first MSR a second MSR, to apply options.
+
+    The following passes are then run on the second MSR
+    for each of the selected formats, all of them by default:
+        LilyPond: converts it into an LPSR (pass 5),
+                  then into LilyPond code (pass 6);
+        braille:  converts it into a first BSR (pass 5),
+                  then into a finalized BSR (pass 6),
+                  then into braille music (pass 7);
+        MusicXML, Guido:
+                  converts it into a second MusicXML tree (pass 5),
+                  shared by these two formats,
+                  then into MusicXML or Guido text (pass 6).
+
+    The output files are named after the '-o, -output-file-name' value
+    or after the input file name without its extension,
+    with the suffix suited to each format appended.
+
+    The activity log and warning/error messages go to standard error.)";
+}
+
+//______________________________________________________________________________
+void xml2allInsiderHandler::createTheXml2allPrefixes ()
+{
+#ifdef MF_TRACE_IS_ENABLED
+  if (gEarlyOptions.getTraceEarlyOptionsDetails ()) {
+    std::stringstream ss;
+
+    ss <<
+      "Creating the xml2all prefixes in \"" <<
+      fHandlerHeader <<
+      "\"";
+
+    gWaeHandler->waeTraceWithoutInputLocation (
+      __FILE__, mfInputLineNumber (__LINE__),
+      ss.str ());
+  }
+#endif // MF_TRACE_IS_ENABLED
+
+  createTheCommonPrefixes ();
+}
+
+//______________________________________________________________________________
+void xml2allInsiderHandler::createTheXml2allOptionGroups (
+  const std::string& serviceName)
+{
+#ifdef MF_TRACE_IS_ENABLED
+  if (gEarlyOptions.getTraceEarlyOptionsDetails ()) {
+    std::stringstream ss;
+
+    ss <<
+      "Creating the \"" <<
+      fHandlerHeader <<
+      "\" insider option groups";
+
+    gWaeHandler->waeTraceWithoutInputLocation (
+      __FILE__, mfInputLineNumber (__LINE__),
+      ss.str ());
+  }
+#endif // MF_TRACE_IS_ENABLED
+
+  // initialize options handling, phase 1
+  // ------------------------------------------------------
+
+  // create the OAH OAH group first
+  appendGroupToHandler (
+    createGlobalOahOahGroup (
+      serviceName));
+
+  // create the WAE OAH group
+  appendGroupToHandler (
+    createGlobalWaeOahGroup ());
+
+#ifdef MF_TRACE_IS_ENABLED
+  // create the trace OAH group
+  appendGroupToHandler (
+    createGlobalTraceOahGroup (
+      this));
+#endif // MF_TRACE_IS_ENABLED
+
+  // create the output file OAH group
+  appendGroupToHandler (
+    createGlobalOutputFileOahGroup ());
+
+  // create the display OAH group
+  appendGroupToHandler (
+    createGlobalDisplayOahGroup ());
+
+  // initialize the library
+  // ------------------------------------------------------
+
+  initializeMSR ();
+  initializeLPSR ();
+  initializeBSR ();
+
+  // initialize options handling, phase 2
+  // ------------------------------------------------------
+
+  // create the mxsr2msr OAH group
+  appendGroupToHandler (
+    createGlobalMxsr2msrOahGroup (
+      this));
+
+  // create the MSR OAH group
+  appendGroupToHandler (
+    createGlobalMsrOahGroup ());
+
+  // create the msr2msr OAH group
+  appendGroupToHandler (
+    createGlobalMsr2msrOahGroup ());
+
+  // create the msr2lpsr OAH group
+  appendGroupToHandler (
+    createGlobalMsr2lpsrOahGroup ());
+
+  // create the LPSR OAH group
+  appendGroupToHandler (
+    createGlobalLpsrOahGroup ());
+
+  // create the lpsr2lilypond OAH group
+  appendGroupToHandler (
+    createGlobalLpsr2lilypondOahGroup ());
+
+  // create the msr2bsr OAH group
+  appendGroupToHandler (
+    createGlobalMsr2bsrOahGroup ());
+
+  // create the BSR OAH group
+  appendGroupToHandler (
+    createGlobalBsrOahGroup ());
+
+  // create the braille generation OAH group
+  appendGroupToHandler (
+    createGlobalBrailleGenerationOahGroup ());
+
+  // create the msr2mxsr OAH group
+  appendGroupToHandler (
+    createGlobalMsr2mxsr2msrOahGroup ());
+
+  // create the Guido generation OAH group
+  appendGroupToHandler (
+    createGlobalGuidoGenerationOahGroup ());
+
+  // create the extra OAH group
+  appendGroupToHandler (
+    createGlobalHarmoniesExtraOahGroup ());
+
+  // create the global xml2all OAH group only now,
+  // after the groups whose options it may use
+  // have been created
+  appendGroupToHandler (
+    createGlobalXml2allOahGroup ());
+}
+
+//______________________________________________________________________________
+void xml2allInsiderHandler::checkOptionsAndArguments () const
+{
+#ifdef MF_TRACE_IS_ENABLED
+  if (gEarlyOptions.getTraceEarlyOptionsDetails ()) {
+    std::stringstream ss;
+
+    ss <<
+      "Checking options and arguments from argc/argv in \"" <<
+      fHandlerHeader <<
+      "\"";
+
+    gWaeHandler->waeTraceWithoutInputLocation (
+      __FILE__, mfInputLineNumber (__LINE__),
+      ss.str ());
+  }
+#endif // MF_TRACE_IS_ENABLED
+
+  checkSingleInputSourceInArgumentsVector ();
+}
+
+//______________________________________________________________________________
+std::string xml2allInsiderHandler::fetchOutputFileNameFromTheOptions () const
+{
+  // each generated format has its own output file,
+  // whose name is built by the converter
+  return "";
+}
+
+std::string xml2allInsiderHandler::fetchOutputFilesBaseNameFromTheOptions () const
+{
+#ifdef MF_TRACE_IS_ENABLED
+  if (gEarlyOptions.getTraceEarlyOptionsDetails ()) {
+    std::stringstream ss;
+
+    ss <<
+      "Fetching the output files base name from the options in OAH handler \"" <<
+      fHandlerHeader <<
+      "\"";
+
+    gWaeHandler->waeTraceWithoutInputLocation (
+      __FILE__, mfInputLineNumber (__LINE__),
+      ss.str ());
+  }
+#endif // MF_TRACE_IS_ENABLED
+
+  S_oahStringAtom
+    outputFileNameStringAtom =
+      gGlobalOutputFileOahGroup->
+        getOutputFileNameStringAtom ();
+
+  std::string outputFilesBaseName;
+
+  if (outputFileNameStringAtom->getSelected ()) {
+    // '-o, -output-file-name' has been selected,
+    // its value is used as is as the base name
+    outputFilesBaseName =
+      outputFileNameStringAtom->
+        getStringVariable ();
+  }
+
+  else {
+    // the generated files go to the current directory,
+    // as with '-aofn, -auto-output-file-name'
+    std::string
+      inputSourceName =
+        gServiceRunData->getInputSourceName ();
+
+    if (inputSourceName == "-") {
+      outputFilesBaseName = "stdin";
+    }
+    else {
+      outputFilesBaseName =
+        mfBaseName (inputSourceName);
+
+      // remove the file extension if any
+      size_t
+        posInString =
+          outputFilesBaseName.rfind ('.');
+
+      if (posInString != std::string::npos) {
+        outputFilesBaseName.replace (
+          posInString,
+          outputFilesBaseName.size () - posInString,
+          "");
+      }
+    }
+  }
+
+#ifdef MF_TRACE_IS_ENABLED
+  if (gEarlyOptions.getTraceEarlyOptionsDetails ()) {
+    std::stringstream ss;
+
+    ss <<
+      "xml2allInsiderHandler::fetchOutputFilesBaseNameFromTheOptions(): outputFilesBaseName: \"" <<
+      outputFilesBaseName <<
+      "\"";
+
+    gWaeHandler->waeTraceWithoutInputLocation (
+      __FILE__, mfInputLineNumber (__LINE__),
+      ss.str ());
+  }
+#endif // MF_TRACE_IS_ENABLED
+
+  return outputFilesBaseName;
+}
+
+//______________________________________________________________________________
+void xml2allInsiderHandler::checkHandlerOptionsConsistency ()
+{
+  gGlobalXml2allInsiderOahGroup->
+    selectAllFormatsIfNoneIsSelected ();
+}
+
+//______________________________________________________________________________
+void xml2allInsiderHandler::enforceHandlerQuietness ()
+{
+#ifdef MF_TRACE_IS_ENABLED
+  gTraceOahGroup->
+    enforceGroupQuietness ();
+#endif // MF_TRACE_IS_ENABLED
+
+  gGlobalXml2allInsiderOahGroup->
+    enforceGroupQuietness ();
+
+  gGlobalMxsr2msrOahGroup->
+    enforceGroupQuietness ();
+
+  gMsrOahGroup->
+    enforceGroupQuietness ();
+
+  gGlobalMsr2lpsrOahGroup->
+    enforceGroupQuietness ();
+
+  gLpsrOahGroup->
+    enforceGroupQuietness ();
+
+  gGlobalLpsr2lilypondOahGroup->
+    enforceGroupQuietness ();
+
+  gGlobalMsr2bsrOahGroup->
+    enforceGroupQuietness ();
+
+  gBsrOahGroup->
+    enforceGroupQuietness ();
+
+  gGlobalBrailleGenerationOahGroup->
+    enforceGroupQuietness ();
+
+  gGlobalMsr2mxsr2msrOahGroup->
+    enforceGroupQuietness ();
+
+  gHarmoniesExtraOahGroup->
+    enforceGroupQuietness ();
+}
+
+//______________________________________________________________________________
+void xml2allInsiderOahGroup::selectAllFormatsIfNoneIsSelected ()
+{
+  if (
+    ! (
+      fGenerateLilypond
+        ||
+      fGenerateBraille
+        ||
+      fGenerateMusicXML
+        ||
+      fGenerateGuido
+    )
+  ) {
+    fGenerateLilypond = true;
+    fGenerateBraille  = true;
+    fGenerateMusicXML = true;
+    fGenerateGuido    = true;
+  }
+}
+
+//______________________________________________________________________________
+void xml2allInsiderOahGroup::enforceGroupQuietness ()
+{}
+
+//______________________________________________________________________________
+void xml2allInsiderOahGroup::checkGroupOptionsConsistency ()
+{}
+
+//______________________________________________________________________________
+void xml2allInsiderOahGroup::acceptIn (basevisitor* v)
+{
+#ifdef MF_TRACE_IS_ENABLED
+  if (gOahOahGroup->getTraceOahVisitors ()) {
+    std::stringstream ss;
+
+    ss <<
+      ".\\\" ==> xml2allInsiderOahGroup::acceptIn ()";
+
+    gWaeHandler->waeTraceWithoutInputLocation (
+      __FILE__, mfInputLineNumber (__LINE__),
+      ss.str ());
+  }
+#endif // MF_TRACE_IS_ENABLED
+
+  if (visitor<S_xml2allInsiderOahGroup>*
+    p =
+      visitor<S_xml2allInsiderOahGroup>::cast (v)) {
+        S_xml2allInsiderOahGroup elem = this;
+
+#ifdef MF_TRACE_IS_ENABLED
+        if (gOahOahGroup->getTraceOahVisitors ()) {
+          std::stringstream ss;
+
+          ss <<
+            ".\\\" ==> Launching xml2allInsiderOahGroup::visitStart ()";
+
+          gWaeHandler->waeTraceWithoutInputLocation (
+            __FILE__, mfInputLineNumber (__LINE__),
+            ss.str ());
+        }
+#endif // MF_TRACE_IS_ENABLED
+        p->visitStart (elem);
+  }
+}
+
+void xml2allInsiderOahGroup::acceptOut (basevisitor* v)
+{
+#ifdef MF_TRACE_IS_ENABLED
+  if (gOahOahGroup->getTraceOahVisitors ()) {
+    std::stringstream ss;
+
+    ss <<
+      ".\\\" ==> xml2allInsiderOahGroup::acceptOut ()";
+
+    gWaeHandler->waeTraceWithoutInputLocation (
+      __FILE__, mfInputLineNumber (__LINE__),
+      ss.str ());
+  }
+#endif // MF_TRACE_IS_ENABLED
+
+  if (visitor<S_xml2allInsiderOahGroup>*
+    p =
+      visitor<S_xml2allInsiderOahGroup>::cast (v)) {
+        S_xml2allInsiderOahGroup elem = this;
+
+#ifdef MF_TRACE_IS_ENABLED
+        if (gOahOahGroup->getTraceOahVisitors ()) {
+          std::stringstream ss;
+
+          ss <<
+            ".\\\" ==> Launching xml2allInsiderOahGroup::visitEnd ()";
+
+          gWaeHandler->waeTraceWithoutInputLocation (
+            __FILE__, mfInputLineNumber (__LINE__),
+            ss.str ());
+        }
+#endif // MF_TRACE_IS_ENABLED
+        p->visitEnd (elem);
+  }
+}
+
+void xml2allInsiderOahGroup::browseData (basevisitor* v)
+{
+#ifdef MF_TRACE_IS_ENABLED
+  if (gOahOahGroup->getTraceOahVisitors ()) {
+    std::stringstream ss;
+
+    ss <<
+      ".\\\" ==> xml2allInsiderOahGroup::browseData ()";
+
+    gWaeHandler->waeTraceWithoutInputLocation (
+      __FILE__, mfInputLineNumber (__LINE__),
+      ss.str ());
+  }
+#endif // MF_TRACE_IS_ENABLED
+
+  oahGroup::browseData (v);
+}
+
+//______________________________________________________________________________
+void xml2allInsiderHandler::print (std::ostream& os) const
+{
+  constexpr int fieldWidth = 27;
+
+  os <<
+    "xml2allInsiderHandler:" <<
+    std::endl;
+
+  ++gIndenter;
+
+  printHandlerEssentials (
+    os, fieldWidth);
+  os << std::endl;
+
+  os <<
+    "Options groups (" <<
+    mfSingularOrPlural (
+      fHandlerGroupsList.size (), "element",  "elements") <<
+    "):" <<
+    std::endl;
+
+  if (fHandlerGroupsList.size ()) {
+    os << std::endl;
+
+    ++gIndenter;
+
+    std::list <S_oahGroup>::const_iterator
+      iBegin = fHandlerGroupsList.begin (),
+      iEnd   = fHandlerGroupsList.end (),
+      i      = iBegin;
+    for ( ; ; ) {
+      // print the element
+      os << (*i);
+      if (++i == iEnd) break;
+      os << std::endl;
+    } // for
+
+    --gIndenter;
+  }
+
+  --gIndenter;
+
+  os << std::endl;
+}
+
+std::ostream& operator << (std::ostream& os, const S_xml2allInsiderHandler& elt)
+{
+  if (elt) {
+    elt->print (os);
+  }
+  else {
+    os << "[NULL]" << std::endl;
+  }
+
+  return os;
+}
+
+//_______________________________________________________________________________
+S_xml2allInsiderOahGroup gGlobalXml2allInsiderOahGroup;
+
+S_xml2allInsiderOahGroup xml2allInsiderOahGroup::create ()
+{
+  xml2allInsiderOahGroup* obj = new xml2allInsiderOahGroup ();
+  assert (obj!=0);
+
+  return obj;
+}
+
+xml2allInsiderOahGroup::xml2allInsiderOahGroup ()
+  : oahGroup (
+      "xml2all",
+      "help-xml2all", "hx2all",
+R"(Options that are used by xml2all are grouped here.)",
+      oahElementVisibilityKind::kElementVisibilityWhole)
+{
+  initializeXml2allInsiderOahGroup ();
+}
+
+xml2allInsiderOahGroup::~xml2allInsiderOahGroup ()
+{}
+
+//_______________________________________________________________________________
+void xml2allInsiderOahGroup::initializeXml2allInsiderOahGroup ()
+{
+#ifdef MF_TRACE_IS_ENABLED
+  if (gEarlyOptions.getTraceEarlyOptions ()) {
+  gLog << std::left <<
+    "Initializing \"" <<
+    fGroupHeader <<
+    "\" group" <<
+    std::endl;
+  }
+#endif // MF_TRACE_IS_ENABLED
+
+  // generated formats
+  // --------------------------------------
+
+  createInsiderFormatsSubGroup ();
+
+  // quit after some passes
+  // --------------------------------------
+
+  createInsiderQuitSubGroup ();
+}
+
+//_______________________________________________________________________________
+void xml2allInsiderOahGroup::createInsiderFormatsSubGroup ()
+{
+#ifdef MF_TRACE_IS_ENABLED
+  if (gEarlyOptions.getTraceEarlyOptionsDetails ()) {
+  gLog << std::left <<
+    "Creating insider formats subgroup in \"" <<
+    fGroupHeader <<
+    "\"" <<
+    std::endl;
+  }
+#endif // MF_TRACE_IS_ENABLED
+
+  S_oahSubGroup
+    subGroup =
+      oahSubGroup::create (
+        "Generated formats",
+        "help-xml2all-formats", "hx2allf",
+R"(All the formats are generated if none of these options is used.)",
+      oahElementVisibilityKind::kElementVisibilityWhole,
+      this);
+
+  appendSubGroupToGroup (subGroup);
+
+  // LilyPond
+
+  subGroup->
+    appendAtomToSubGroup (
+      oahBooleanAtom::create (
+        "lilypond", "ly",
+R"(Generate LilyPond code.)",
+        "fGenerateLilypond",
+        fGenerateLilypond));
+
+  // braille
+
+  subGroup->
+    appendAtomToSubGroup (
+      oahBooleanAtom::create (
+        "braille", "brl",
+R"(Generate braille music.)",
+        "fGenerateBraille",
+        fGenerateBraille));
+
+  // MusicXML
+
+  subGroup->
+    appendAtomToSubGroup (
+      oahBooleanAtom::create (
+        "musicxml", "xml",
+R"(Generate MusicXML.)",
+        "fGenerateMusicXML",
+        fGenerateMusicXML));
+
+  // Guido
+
+  subGroup->
+    appendAtomToSubGroup (
+      oahBooleanAtom::create (
+        "guido", "gmn",
+R"(Generate Guido code.)",
+        "fGenerateGuido",
+        fGenerateGuido));
+}
+
+//_______________________________________________________________________________
+void xml2allInsiderOahGroup::createInsiderQuitSubGroup ()
+{
+#ifdef MF_TRACE_IS_ENABLED
+  if (gEarlyOptions.getTraceEarlyOptionsDetails ()) {
+  gLog << std::left <<
+    "Creating insider quit subgroup in \"" <<
+    fGroupHeader <<
+    "\"" <<
+    std::endl;
+  }
+#endif // MF_TRACE_IS_ENABLED
+
+  S_oahSubGroup
+    subGroup =
+      oahSubGroup::create (
+        "Quit after some passes",
+        "help-xml2all-quit", "hx2allquit",
+R"()",
+      oahElementVisibilityKind::kElementVisibilityWhole,
+      this);
+
+  appendSubGroupToGroup (subGroup);
+
+  // quit after pass 2
+
+  subGroup->
+    appendAtomToSubGroup (
+      oahBooleanAtom::create (
+        "quit-after-pass-2", "qap2",
+R"(Quit after pass 2, i.e. after conversion
+of the MusicXML tree to an MSR skeleton.)",
+        "fQuitAfterPass2",
+        fQuitAfterPass2));
+
+  // quit after pass 3
+
+  subGroup->
+    appendAtomToSubGroup (
+      oahBooleanAtom::create (
+        "quit-after-pass-3", "qap3",
+R"(Quit after pass 3, i.e. after conversion
+of the MusicXML tree to MSR.)",
+        "fQuitAfterPass3",
+        fQuitAfterPass3));
+
+  // quit after pass 4
+
+  subGroup->
+    appendAtomToSubGroup (
+      oahBooleanAtom::create (
+        "quit-after-pass-4", "qap4",
+R"(Quit after pass 4, i.e. after conversion
+of the first MSR to the second one.)",
+        "fQuitAfterPass4",
+        fQuitAfterPass4));
+}
+
+//______________________________________________________________________________
+void xml2allInsiderOahGroup::printXml2allInsiderOahGroupValues (int fieldWidth)
+{
+  gLog <<
+    "The xml2all options are:" <<
+    std::endl;
+
+  ++gIndenter;
+
+  // generated formats
+  // --------------------------------------
+
+  gLog <<
+    "Generated formats:" <<
+    std::endl;
+
+  ++gIndenter;
+
+  gLog << std::left <<
+    std::setw (fieldWidth) << "fGenerateLilypond" << ": " <<
+    fGenerateLilypond <<
+    std::endl <<
+    std::setw (fieldWidth) << "fGenerateBraille" << ": " <<
+    fGenerateBraille <<
+    std::endl <<
+    std::setw (fieldWidth) << "fGenerateMusicXML" << ": " <<
+    fGenerateMusicXML <<
+    std::endl <<
+    std::setw (fieldWidth) << "fGenerateGuido" << ": " <<
+    fGenerateGuido <<
+    std::endl;
+
+  --gIndenter;
+
+  // quit after some passes
+  // --------------------------------------
+
+  gLog <<
+    "Quit after some passes:" <<
+    std::endl;
+
+  ++gIndenter;
+
+  gLog << std::left <<
+    std::setw (fieldWidth) << "fQuitAfterPass2" << ": " <<
+    fQuitAfterPass2 <<
+    std::endl <<
+    std::setw (fieldWidth) << "fQuitAfterPass3" << ": " <<
+    fQuitAfterPass3 <<
+    std::endl <<
+    std::setw (fieldWidth) << "fQuitAfterPass4" << ": " <<
+    fQuitAfterPass4 <<
+    std::endl;
+
+  --gIndenter;
+
+  --gIndenter;
+}
+
+//______________________________________________________________________________
+S_xml2allInsiderOahGroup createGlobalXml2allOahGroup ()
+{
+#ifdef MF_TRACE_IS_ENABLED
+  if (gEarlyOptions.getTraceEarlyOptions ()) {
+    std::stringstream ss;
+
+    ss <<
+      "Creating global xml2all OAH group";
+
+    gWaeHandler->waeTraceWithoutInputLocation (
+      __FILE__, mfInputLineNumber (__LINE__),
+      ss.str ());
+  }
+#endif // MF_TRACE_IS_ENABLED
+
+  // protect library against multiple initializations
+  if (! gGlobalXml2allInsiderOahGroup) {
+
+    // create the global OAH group
+    // ------------------------------------------------------
+
+    gGlobalXml2allInsiderOahGroup =
+      xml2allInsiderOahGroup::create ();
+    assert (gGlobalXml2allInsiderOahGroup != 0);
+  }
+
+  // return the global OAH group
+  return gGlobalXml2allInsiderOahGroup;
+}
+
+
+}
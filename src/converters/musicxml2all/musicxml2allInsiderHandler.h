@@ -0,0 +1,234 @@
+/*
+  MusicFormats Library
+  Copyright (C) Jacques Menu 2016-2025
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, you can obtain one at http://mozilla.org/MPL/2.0/.
+
+  https://github.com/jacques-menu/musicformats
+*/
+
+#ifndef ___musicxml2allInsiderHandler___
+#define ___musicxml2allInsiderHandler___
+
+#include "oahBasicTypes.h"
+
+#include "oahInsiderHandlers.h"
+
+#include "oahAtomsCollection.h"
+
+
+namespace MusicFormats
+{
+
+//_______________________________________________________________________________
+/*
+  xml2all creates the option groups of xml2ly, xml2brl, xml2xml and xml2gmn
+  in a single handler, so that the first and second MSRs are built once
+  and shared by all the generated formats.
+
+  CAUTION:
+    some option names are identical in OAH groups
+    that are not meant to be used at the same time,
+    such as gGlobalMsr2msrOahGroup and gGlobalMsr2lpsrOahGroup:
+    the last group created wins in such a case
+*/
+
+class EXP xml2allInsiderHandler : public oahInsiderHandler
+{
+  public:
+
+    // creation
+    // ------------------------------------------------------
+
+    static SMARTP<xml2allInsiderHandler> create (
+                            const std::string& serviceName,
+                            const std::string& handlerHeader);
+
+  protected:
+
+    // constructors/destructor
+    // ------------------------------------------------------
+
+                          xml2allInsiderHandler (
+                            const std::string& serviceName,
+                            const std::string& handlerHeader);
+
+    virtual               ~xml2allInsiderHandler ();
+
+  protected:
+
+    // protected initialization
+    // ------------------------------------------------------
+
+    void                  initializeHandlerMultiComponent () override;
+
+
+    // private initialization
+    // ------------------------------------------------------
+
+    void                  createTheXml2allPrefixes ();
+
+    void                  createTheXml2allOptionGroups (
+                            const std::string& serviceName);
+
+  public:
+
+    // public services
+    // ------------------------------------------------------
+
+    std::string           handlerServiceAboutInformation () const override;
+
+    void                  checkOptionsAndArguments () const override;
+
+    // there is no single output file name with xml2all,
+    // see fetchOutputFilesBaseNameFromTheOptions ()
+    std::string           fetchOutputFileNameFromTheOptions () const override;
+
+    // the generated files are named after this base name,
+    // with the suffix suited to each of them
+    std::string           fetchOutputFilesBaseNameFromTheOptions () const;
+
+    // quiet mode
+    void                  enforceHandlerQuietness () override;
+
+    // consistency check
+    void                  checkHandlerOptionsConsistency () override;
+
+  public:
+
+    // print
+    // ------------------------------------------------------
+
+    void                  print (std::ostream& os) const override;
+};
+typedef SMARTP<xml2allInsiderHandler> S_xml2allInsiderHandler;
+EXP std::ostream& operator << (std::ostream& os, const S_xml2allInsiderHandler& elt);
+
+//______________________________________________________________________________
+class EXP xml2allInsiderOahGroup : public oahGroup
+{
+  public:
+
+    static SMARTP<xml2allInsiderOahGroup> create ();
+
+  public:
+
+    // initialisation
+    // ------------------------------------------------------
+
+    void                  initializeXml2allInsiderOahGroup ();
+
+  protected:
+
+    // constructors/destructor
+    // ------------------------------------------------------
+
+                          xml2allInsiderOahGroup ();
+
+    virtual               ~xml2allInsiderOahGroup ();
+
+  public:
+
+    // set and get
+    // ------------------------------------------------------
+
+    // generated formats
+    Bool                  getGenerateLilypond () const
+                              { return fGenerateLilypond; }
+
+    Bool                  getGenerateBraille () const
+                              { return fGenerateBraille; }
+
+    Bool                  getGenerateMusicXML () const
+                              { return fGenerateMusicXML; }
+
+    Bool                  getGenerateGuido () const
+                              { return fGenerateGuido; }
+
+    // quit after some passes
+    void                  setQuitAfterPass2 ()
+                              { fQuitAfterPass2 = true; }
+    Bool                  getQuitAfterPass2 () const
+                              { return fQuitAfterPass2; }
+
+    void                  setQuitAfterPass3 ()
+                              { fQuitAfterPass3 = true; }
+    Bool                  getQuitAfterPass3 () const
+                              { return fQuitAfterPass3; }
+
+    void                  setQuitAfterPass4 ()
+                              { fQuitAfterPass4 = true; }
+    Bool                  getQuitAfterPass4 () const
+                              { return fQuitAfterPass4; }
+
+  public:
+
+    // public services
+    // ------------------------------------------------------
+
+    // all the formats are generated if none has been selected
+    void                  selectAllFormatsIfNoneIsSelected ();
+
+    // quiet mode
+    void                  enforceGroupQuietness () override;
+
+    // consistency check
+    void                  checkGroupOptionsConsistency () override;
+
+  public:
+
+    // visitors
+    // ------------------------------------------------------
+
+    void                  acceptIn  (basevisitor* v) override;
+    void                  acceptOut (basevisitor* v) override;
+
+    void                  browseData (basevisitor* v) override;
+
+  public:
+
+    // print
+    // ------------------------------------------------------
+
+    void                  printXml2allInsiderOahGroupValues (int fieldWidth);
+
+  private:
+
+    // private services
+    // ------------------------------------------------------
+
+    void                  createInsiderFormatsSubGroup ();
+
+    void                  createInsiderQuitSubGroup ();
+
+  private:
+
+    // private fields
+    // ------------------------------------------------------
+
+    // generated formats
+    Bool                  fGenerateLilypond;
+    Bool                  fGenerateBraille;
+    Bool                  fGenerateMusicXML;
+    Bool                  fGenerateGuido;
+
+    // quit after some passes
+    Bool                  fQuitAfterPass2;
+    Bool                  fQuitAfterPass3;
+    Bool                  fQuitAfterPass4;
+};
+typedef SMARTP<xml2allInsiderOahGroup> S_xml2allInsiderOahGroup;
+EXP std::ostream& operator << (std::ostream& os, const S_xml2allInsiderOahGroup& elt);
+
+EXP extern S_xml2allInsiderOahGroup gGlobalXml2allInsiderOahGroup;
+
+//______________________________________________________________________________
+S_xml2allInsiderOahGroup createGlobalXml2allOahGroup ();
+
+
+}
+
+
+#endif // ___musicxml2allInsiderHandler___
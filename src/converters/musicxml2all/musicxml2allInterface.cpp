@@ -0,0 +1,734 @@
+/*
+  MusicFormats Library
+  Copyright (C) Jacques Menu 2016-2025
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, you can obtain one at http://mozilla.org/MPL/2.0/.
+
+  https://github.com/jacques-menu/musicformats
+*/
+
+#include <iostream>
+#include <fstream>      // std::ofstream, std::ofstream::open(), std::ofstream::close()
+
+#include "xml.h"
+#include "xmlfile.h"
+#include "xmlreader.h"
+
+#include "mfPasses.h"
+#include "msrScores.h"
+
+#include "lpsrScores.h"
+#include "bsrScores.h"
+
+#include "oahWae.h"
+#include "mxsr2msrWae.h"
+#include "msr2msrWae.h"
+#include "msr2lpsrWae.h"
+#include "lpsr2lilypondWae.h"
+#include "msr2bsrWae.h"
+#include "bsr2bsrWae.h"
+#include "bsr2brailleWae.h"
+#include "msr2mxsrWae.h"
+#include "mxsr2musicxmlWae.h"
+#include "mxsr2guidoWae.h"
+
+#include "mfPreprocessorSettings.h"
+
+#include "mfServices.h"
+#include "mfStringsHandling.h"
+
+#include "musicxml2allComponent.h"
+
+#include "oahOah.h"
+#include "waeOah.h"
+
+#include "msrOah.h"
+#include "msr2msrOah.h"
+#include "msr2lpsrOah.h"
+#include "lpsrOah.h"
+#include "bsrOah.h"
+
+#include "oahEarlyOptions.h"
+
+#include "musicxml2mxsrInterface.h"
+#include "mxsr2msrSkeletonBuilderInterface.h"
+#include "mxsr2msrSkeletonPopulatorInterface.h"
+#include "msr2msrInterface.h"
+#include "msr2lpsrInterface.h"
+#include "lpsr2lilypondInterface.h"
+#include "msr2bsrInterface.h"
+#include "bsr2bsrFinalizerInterface.h"
+#include "bsr2brailleTranslatorInterface.h"
+#include "msr2mxsrInterface.h"
+#include "mxsr2musicxmlTranlatorInterface.h"
+#include "mxsr2guidoTranlatorInterface.h"
+
+#include "msrInterface.h"
+#include "lpsrInterface.h"
+#include "bsrInterface.h"
+
+#include "musicxml2allInterface.h"
+
+#include "waeHandlers.h"
+
+
+namespace MusicFormats
+{
+
+/*
+  The MXSR, the first and the second MSRs are built once,
+  and the second MSR is then only read by the generation passes below.
+
+  These passes are run one after the other: they share the global
+  indenter, log streams, timing items list and OAH groups,
+  which are not meant to be used by several threads.
+*/
+
+//_______________________________________________________________________________
+static mfMusicformatsErrorKind generateLilypondFromMsr (
+  const S_msrScore&  secondMsrScore,
+  const std::string& outputFileName,
+  std::ostream&      err)
+{
+  // create the LPSR from the MSR (pass 5)
+  // ------------------------------------------------------
+
+  S_lpsrScore theLpsrScore;
+
+  try {
+    theLpsrScore =
+      translateMsrToLpsr (
+        secondMsrScore,
+        gMsrOahGroup,
+        gLpsrOahGroup,
+        mfPassIDKind::kMfPassID_5,
+        gGlobalMsr2msrOahGroup->getAvoidMsr2msr ()
+          ? gLanguage->convertTheFirstMSRIntoAnLPSR ()
+          : gLanguage->convertTheSecondMSRIntoAnLPSR (),
+        createMusicxml2allConverterComponent ());
+  } // try
+
+  catch (msr2lpsrException& e) {
+    mfDisplayException (e, gOutput);
+    return mfMusicformatsErrorKind::kMusicformatsErrorInvalidFile;
+  }
+  catch (std::exception& e) {
+    mfDisplayException (e, gOutput);
+    return mfMusicformatsErrorKind::kMusicformatsErrorInvalidFile;
+  }
+
+  // convert the LPSR to LilyPond code (pass 6)
+  // ------------------------------------------------------
+
+#ifdef MF_TRACE_IS_ENABLED
+  if (gEarlyOptions.getEarlyTracePasses ()) {
+    err <<
+      std::endl <<
+      gLanguage->openingLilypondFileForWriting (outputFileName) <<
+      std::endl;
+  }
+#endif // MF_TRACE_IS_ENABLED
+
+  std::ofstream
+    outputFileStream (
+      outputFileName.c_str (),
+      std::ofstream::out);
+
+  if (! outputFileStream.is_open ()) {
+    std::stringstream ss;
+
+    ss <<
+      gLanguage->cannotOpenLilypondFileForWriting (outputFileName);
+
+    std::string message = ss.str ();
+
+    err <<
+      message <<
+      std::endl;
+
+    throw lpsr2lilypondException (message);
+  }
+
+  // create an indented output stream for the LilyPond code
+  // to be written to outputFileStream
+  mfIndentedOstream
+    lilypondFileOutputStream (
+      outputFileStream,
+      gIndenter);
+
+  try {
+    translateLpsrToLilypond (
+      theLpsrScore,
+      gMsrOahGroup,
+      gLpsrOahGroup,
+      mfPassIDKind::kMfPassID_6,
+      gLanguage->convertTheLPSRIntoLilyPondCode (),
+      lilypondFileOutputStream);
+  } // try
+
+  catch (lpsr2lilypondException& e) {
+    mfDisplayException (e, gOutput);
+    return mfMusicformatsErrorKind::kMusicformatsErrorInvalidFile;
+  }
+  catch (std::exception& e) {
+    mfDisplayException (e, gOutput);
+    return mfMusicformatsErrorKind::kMusicformatsErrorInvalidFile;
+  }
+
+  // write the buffered LilyPond code before closing the file
+  lilypondFileOutputStream.flush ();
+
+  outputFileStream.close ();
+
+  return mfMusicformatsErrorKind::kMusicformatsError_NONE;
+}
+
+//_______________________________________________________________________________
+static mfMusicformatsErrorKind generateBrailleFromMsr (
+  const S_msrScore&  secondMsrScore,
+  const std::string& outputFileName,
+  std::ostream&      err)
+{
+  // create the first BSR from the MSR (pass 5)
+  // ------------------------------------------------------
+
+  S_bsrScore firstBsrScore;
+
+  try {
+    firstBsrScore =
+      translateMsrToBsr (
+        secondMsrScore,
+        gMsrOahGroup,
+        gBsrOahGroup,
+        mfPassIDKind::kMfPassID_5,
+        "Create a first BSR from the MSR");
+  } // try
+
+  catch (msr2bsrException& e) {
+    mfDisplayException (e, gOutput);
+    return mfMusicformatsErrorKind::kMusicformatsErrorInvalidFile;
+  }
+  catch (std::exception& e) {
+    mfDisplayException (e, gOutput);
+    return mfMusicformatsErrorKind::kMusicformatsErrorInvalidFile;
+  }
+
+  if (gBsrOahGroup->getDisplayFirstBsr ()) {
+    displayBsrScore (
+      firstBsrScore,
+      gMsrOahGroup,
+      gBsrOahGroup,
+      gLanguage->displayTheFirstBSRAsText ());
+  }
+
+  if (gBsrOahGroup->getDisplayFirstBsrFull ()) {
+    displayBsrScoreFull (
+      firstBsrScore,
+      gMsrOahGroup,
+      gBsrOahGroup,
+      gLanguage->displayTheFirstBSRAsText ());
+  }
+
+  // create the finalized BSR from the first BSR (pass 6)
+  // ------------------------------------------------------
+
+  S_bsrScore finalizedBsrScore;
+
+  try {
+    finalizedBsrScore =
+      translateBsrToFinalizedBsr (
+        firstBsrScore,
+        gBsrOahGroup,
+        mfPassIDKind::kMfPassID_6,
+        "Create the finalized BSR from the first BSR");
+  } // try
+
+  catch (bsr2finalizedBsrException& e) {
+    mfDisplayException (e, gOutput);
+    return mfMusicformatsErrorKind::kMusicformatsErrorInvalidFile;
+  }
+  catch (std::exception& e) {
+    mfDisplayException (e, gOutput);
+    return mfMusicformatsErrorKind::kMusicformatsErrorInvalidFile;
+  }
+
+  if (gBsrOahGroup->getDisplaySecondBsr ()) {
+    displayBsrScore (
+      finalizedBsrScore,
+      gMsrOahGroup,
+      gBsrOahGroup,
+      gLanguage->displayTheFinalizedBSRAsText ());
+  }
+
+  if (gBsrOahGroup->getDisplaySecondBsrFull ()) {
+    displayBsrScoreFull (
+      finalizedBsrScore,
+      gMsrOahGroup,
+      gBsrOahGroup,
+      gLanguage->displayTheFinalizedBSRAsText ());
+  }
+
+  // convert the finalized BSR to braille (pass 7)
+  // ------------------------------------------------------
+
+#ifdef MF_TRACE_IS_ENABLED
+  if (gEarlyOptions.getEarlyTracePasses ()) {
+    err <<
+      std::endl <<
+      gLanguage->openingBrailleMusicFileForWriting (outputFileName) <<
+      std::endl;
+  }
+#endif // MF_TRACE_IS_ENABLED
+
+  std::ofstream
+    brailleCodeFileOutputStream (
+      outputFileName.c_str (),
+      std::ofstream::out);
+
+  if (! brailleCodeFileOutputStream.is_open ()) {
+    std::stringstream ss;
+
+    ss <<
+      gLanguage->cannotOpenBrailleMusicFileForWriting (outputFileName);
+
+    std::string message = ss.str ();
+
+    err <<
+      message <<
+      std::endl;
+
+    throw bsr2brailleException (message);
+  }
+
+  try {
+    translateBsrToBraille (
+      finalizedBsrScore,
+      gBsrOahGroup,
+      mfPassIDKind::kMfPassID_7,
+      "Convert the finalized BSR into braille",
+      brailleCodeFileOutputStream);
+  }
+  catch (bsr2brailleException& e) {
+    mfDisplayException (e, gOutput);
+    return mfMusicformatsErrorKind::kMusicformatsErrorInvalidFile;
+  }
+  catch (std::exception& e) {
+    mfDisplayException (e, gOutput);
+    return mfMusicformatsErrorKind::kMusicformatsErrorInvalidFile;
+  }
+
+  brailleCodeFileOutputStream.close ();
+
+  return mfMusicformatsErrorKind::kMusicformatsError_NONE;
+}
+
+//_______________________________________________________________________________
+static mfMusicformatsErrorKind generateMusicXMLAndGuidoFromMsr (
+  const S_msrScore&  secondMsrScore,
+  const std::string& musicxmlOutputFileName, // empty if not generated
+  const std::string& guidoOutputFileName,    // empty if not generated
+  std::ostream&      err)
+{
+  // convert the second MSR into an MXSR (pass 5),
+  // shared by the MusicXML and Guido generations
+  // ------------------------------------------------------
+
+  Sxmlelement secondMxsr;
+
+  try {
+    secondMxsr =
+      translateMsrToMxsr (
+        secondMsrScore,
+        gMsrOahGroup,
+        mfPassIDKind::kMfPassID_5,
+        "Convert the second MSR into an MXSR",
+        mfTimingItemKind::kMandatory);
+  } // try
+
+  catch (msr2mxsrException& e) {
+    mfDisplayException (e, gOutput);
+    return mfMusicformatsErrorKind::kMusicformatsErrorInvalidFile;
+  }
+  catch (std::exception& e) {
+    mfDisplayException (e, gOutput);
+    return mfMusicformatsErrorKind::kMusicformatsErrorInvalidFile;
+  }
+
+  // convert the MXSR to MusicXML (pass 6)
+  // ------------------------------------------------------
+
+  if (musicxmlOutputFileName.size ()) {
+    try {
+      translateMxsrToMusicXML (
+        secondMxsr,
+        musicxmlOutputFileName,
+        err,
+        mfPassIDKind::kMfPassID_6,
+        "Convert the MXSR into MusicXML text");
+    } // try
+
+    catch (mxsr2musicxmlException& e) {
+      mfDisplayException (e, gOutput);
+      return mfMusicformatsErrorKind::kMusicformatsErrorInvalidFile;
+    }
+    catch (std::exception& e) {
+      mfDisplayException (e, gOutput);
+      return mfMusicformatsErrorKind::kMusicformatsErrorInvalidFile;
+    }
+  }
+
+  // convert the MXSR to Guido (pass 6)
+  // ------------------------------------------------------
+
+  if (guidoOutputFileName.size ()) {
+    try {
+      translateMxsrToGuido (
+        secondMxsr,
+        guidoOutputFileName,
+        err,
+        mfPassIDKind::kMfPassID_6,
+        "Convert the MXSR into Guido text");
+    } // try
+
+    catch (mxsr2guidoException& e) {
+      mfDisplayException (e, gOutput);
+      return mfMusicformatsErrorKind::kMusicformatsErrorInvalidFile;
+    }
+    catch (std::exception& e) {
+      mfDisplayException (e, gOutput);
+      return mfMusicformatsErrorKind::kMusicformatsErrorInvalidFile;
+    }
+  }
+
+  return mfMusicformatsErrorKind::kMusicformatsError_NONE;
+}
+
+//_______________________________________________________________________________
+static mfMusicformatsErrorKind sxmlFile2allWithHandler (
+  SXMLFile&                      sxmlfile,
+  const char*                    streamedFileName,
+  std::ostream&                  out,
+  std::ostream&                  err,
+  const S_xml2allInsiderHandler& handler)
+{
+  if (! sxmlfile) {
+    return mfMusicformatsErrorKind::kMusicformatsErrorInvalidFile;
+  }
+
+  // has quiet mode been requested?
+  // ------------------------------------------------------
+
+  if (gEarlyOptions.getEarlyQuietOption ()) {
+    // disable all trace and display options
+    handler->
+      enforceHandlerQuietness ();
+  }
+
+  // get the MXSR
+  // ------------------------------------------------------
+
+  Sxmlelement
+    theMxsr =
+      sxmlfile->elements ();
+
+  // the MSR score
+  // ------------------------------------------------------
+
+  S_msrScore firstMsrScore;
+
+  // create the skeleton of the first MSR from the MXSR (pass 2)
+  // ------------------------------------------------------
+
+  mxsrEventsCollection eventsCollection;
+
+  // passes 2 and 3 can be fused, except in streaming mode
+  Bool
+    fusePasses2And3 =
+      gGlobalMxsr2msrOahGroup->getFuseMxsrToMsrPasses ()
+        &&
+      ! streamedFileName;
+
+  try {
+    if (fusePasses2And3) {
+      firstMsrScore =
+        buildAndPopulateMsrFromMxsr (
+          theMxsr,
+          eventsCollection,
+          mfPassIDKind::kMfPassID_2,
+          gLanguage->convertTheMXSRIntoAPopulatedMSR ());
+    }
+    else if (streamedFileName) {
+      firstMsrScore =
+        translateMusicXMLFileToMsrSkeleton (
+          streamedFileName,
+          eventsCollection,
+          gMsrOahGroup,
+          mfPassIDKind::kMfPassID_2,
+          gLanguage->convertTheMXSRIntoAnMSRSkeleton ());
+    }
+    else {
+      firstMsrScore =
+        translateMxsrToMsrSkeleton (
+          theMxsr,
+          eventsCollection,
+          gMsrOahGroup,
+          mfPassIDKind::kMfPassID_2,
+          gLanguage->convertTheMXSRIntoAnMSRSkeleton ());
+    }
+  } // try
+
+  catch (mxsr2msrException& e) {
+    mfDisplayException (e, gOutput);
+    return mfMusicformatsErrorKind::kMusicformatsErrorInvalidFile;
+  }
+  catch (std::exception& e) {
+    mfDisplayException (e, gOutput);
+    return mfMusicformatsErrorKind::kMusicformatsErrorInvalidFile;
+  }
+
+  // should we return now?
+  // ------------------------------------------------------
+
+  if (gGlobalXml2allInsiderOahGroup->getQuitAfterPass2 ()) {
+#ifdef MF_TRACE_IS_ENABLED
+    gWaeHandler->waeTraceToStreamWithoutInputLocation (
+      err,
+      __FILE__, mfInputLineNumber (__LINE__),
+      gLanguage->quittingAfterPass (mfPassIDKind::kMfPassID_2));
+#endif // MF_TRACE_IS_ENABLED
+
+    return mfMusicformatsErrorKind::kMusicformatsError_NONE;
+  }
+
+  // populate the MSR skeleton from the MXSR (pass 3)
+  // ------------------------------------------------------
+
+  try {
+    if (streamedFileName) {
+      populateMsrSkeletonFromMusicXMLFile (
+        streamedFileName,
+        firstMsrScore,
+        eventsCollection,
+        mfPassIDKind::kMfPassID_3,
+        gLanguage->populateTheMSRSkeletonFromMusicXMLData ());
+    }
+    else if (! fusePasses2And3) { // otherwise populated in pass 2
+      populateMsrSkeletonFromMxsr (
+        theMxsr,
+        firstMsrScore,
+        eventsCollection,
+        mfPassIDKind::kMfPassID_3,
+        gLanguage->populateTheMSRSkeletonFromMusicXMLData ());
+    }
+  } // try
+
+  catch (mxsr2msrException& e) {
+    mfDisplayException (e, gOutput);
+    return mfMusicformatsErrorKind::kMusicformatsErrorInvalidFile;
+  }
+  catch (std::exception& e) {
+    mfDisplayException (e, gOutput);
+    return mfMusicformatsErrorKind::kMusicformatsErrorInvalidFile;
+  }
+
+  // should we return now?
+  // ------------------------------------------------------
+
+  if (gGlobalXml2allInsiderOahGroup->getQuitAfterPass3 ()) {
+#ifdef MF_TRACE_IS_ENABLED
+    gWaeHandler->waeTraceToStreamWithoutInputLocation (
+      err,
+      __FILE__, mfInputLineNumber (__LINE__),
+      gLanguage->quittingAfterPass (mfPassIDKind::kMfPassID_3));
+#endif // MF_TRACE_IS_ENABLED
+
+    return mfMusicformatsErrorKind::kMusicformatsError_NONE;
+  }
+
+  // convert the first MSR score into a second MSR if needed (pass 4)
+  // ------------------------------------------------------
+
+  S_msrScore secondMsrScore;
+
+  if (gGlobalMsr2msrOahGroup->getAvoidMsr2msr ()) {
+    secondMsrScore = firstMsrScore;
+  }
+
+  else {
+    try {
+      secondMsrScore =
+        translateMsrToMsr (
+          firstMsrScore,
+          gMsrOahGroup,
+          gGlobalMsr2msrOahGroup,
+          mfPassIDKind::kMfPassID_4,
+          gLanguage->convertTheFirstMSRIntoASecondMSR ());
+    } // try
+
+    catch (msr2msrException& e) {
+      mfDisplayException (e, gOutput);
+      return mfMusicformatsErrorKind::kMusicformatsErrorInvalidFile;
+    }
+    catch (std::exception& e) {
+      mfDisplayException (e, gOutput);
+      return mfMusicformatsErrorKind::kMusicformatsErrorInvalidFile;
+    }
+
+    // should we return now?
+    // ------------------------------------------------------
+
+    if (gGlobalXml2allInsiderOahGroup->getQuitAfterPass4 ()) {
+#ifdef MF_TRACE_IS_ENABLED
+      gWaeHandler->waeTraceToStreamWithoutInputLocation (
+        err,
+        __FILE__, mfInputLineNumber (__LINE__),
+        gLanguage->quittingAfterPass (mfPassIDKind::kMfPassID_4));
+#endif // MF_TRACE_IS_ENABLED
+
+      return mfMusicformatsErrorKind::kMusicformatsError_NONE;
+    }
+  }
+
+  // generate the selected formats from the second MSR
+  // ------------------------------------------------------
+
+  std::string
+    outputFilesBaseName =
+      handler->
+        fetchOutputFilesBaseNameFromTheOptions ();
+
+  mfMusicformatsErrorKind
+    result =
+      mfMusicformatsErrorKind::kMusicformatsError_NONE,
+    formatResult;
+
+  // a failing format does not prevent the other ones from being generated
+
+  if (gGlobalXml2allInsiderOahGroup->getGenerateLilypond ()) {
+    formatResult =
+      generateLilypondFromMsr (
+        secondMsrScore,
+        outputFilesBaseName + ".ly",
+        err);
+
+    if (formatResult != mfMusicformatsErrorKind::kMusicformatsError_NONE) {
+      result = formatResult;
+    }
+  }
+
+  if (gGlobalXml2allInsiderOahGroup->getGenerateBraille ()) {
+    formatResult =
+      generateBrailleFromMsr (
+        secondMsrScore,
+        outputFilesBaseName + ".brf",
+        err);
+
+    if (formatResult != mfMusicformatsErrorKind::kMusicformatsError_NONE) {
+      result = formatResult;
+    }
+  }
+
+  if (
+    gGlobalXml2allInsiderOahGroup->getGenerateMusicXML ()
+      ||
+    gGlobalXml2allInsiderOahGroup->getGenerateGuido ()
+  ) {
+    formatResult =
+      generateMusicXMLAndGuidoFromMsr (
+        secondMsrScore,
+        gGlobalXml2allInsiderOahGroup->getGenerateMusicXML ()
+          ? outputFilesBaseName + ".xml"
+          : "",
+        gGlobalXml2allInsiderOahGroup->getGenerateGuido ()
+          ? outputFilesBaseName + ".gmn"
+          : "",
+        err);
+
+    if (formatResult != mfMusicformatsErrorKind::kMusicformatsError_NONE) {
+      result = formatResult;
+    }
+  }
+
+  return result;
+}
+
+//_______________________________________________________________________________
+mfMusicformatsErrorKind convertMusicxmlFile2allWithHandler (
+  const char*                    fileName,
+  std::ostream&                  out,
+  std::ostream&                  err,
+  const S_xml2allInsiderHandler& handler)
+{
+  SXMLFile
+    sxmlfile =
+      createSXMLFileFromFile (
+        fileName,
+        mfPassIDKind::kMfPassID_1,
+        gLanguage->convertAMusicXMLStreamIntoAnMXSR ());
+
+  // in streaming mode, the file is read again in passes 2 and 3
+  const char*
+    streamedFileName =
+      gGlobalMxsr2msrOahGroup->getStreamMusicXMLInput ()
+        ? fileName
+        : nullptr;
+
+  return
+    sxmlFile2allWithHandler (
+      sxmlfile,
+      streamedFileName,
+      out,
+      err,
+      handler);
+}
+
+//_______________________________________________________________________________
+mfMusicformatsErrorKind convertMusicxmlFd2allWithHandler (
+  FILE*                          fd,
+  std::ostream&                  out,
+  std::ostream&                  err,
+  const S_xml2allInsiderHandler& handler)
+{
+  SXMLFile
+    sxmlfile =
+      createSXMLFileFromFd (
+        fd,
+        mfPassIDKind::kMfPassID_1,
+        gLanguage->convertAMusicXMLDescriptorIntoAnMXSR ());
+
+  return
+    sxmlFile2allWithHandler (
+      sxmlfile,
+      nullptr,
+      out,
+      err,
+      handler);
+}
+
+//_______________________________________________________________________________
+mfMusicformatsErrorKind convertMusicxmlString2allWithHandler (
+  const char*                    buffer,
+  std::ostream&                  out,
+  std::ostream&                  err,
+  const S_xml2allInsiderHandler& handler)
+{
+  SXMLFile
+    sxmlfile =
+      createSXMLFileFromString (
+        buffer,
+        mfPassIDKind::kMfPassID_1,
+        gLanguage->convertAMusicXMLBufferIntoAnMXSR ());
+
+  return
+    sxmlFile2allWithHandler (
+      sxmlfile,
+      nullptr,
+      out,
+      err,
+      handler);
+}
+
+
+}
@@ -0,0 +1,54 @@
+/*
+  MusicFormats Library
+  Copyright (C) Jacques Menu 2016-2025
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, you can obtain one at http://mozilla.org/MPL/2.0/.
+
+  https://github.com/jacques-menu/musicformats
+*/
+
+#ifndef ___musicxml2allInterface___
+#define ___musicxml2allInterface___
+
+#include <ostream>
+
+#include "mfMusicformatsErrors.h" // for mfMusicformatsErrorKind
+
+#include "musicxml2allInsiderHandler.h"
+
+
+namespace MusicFormats
+{
+/*
+  These functions parse the MusicXML data and build the MSR once,
+  then generate the formats selected in gGlobalXml2allInsiderOahGroup
+  from that shared MSR, each one to its own file
+*/
+
+//_______________________________________________________________________________
+EXP mfMusicformatsErrorKind convertMusicxmlFile2allWithHandler (
+  const char*                    fileName,
+  std::ostream&                  out,
+  std::ostream&                  err,
+  const S_xml2allInsiderHandler& handler);
+
+//_______________________________________________________________________________
+EXP mfMusicformatsErrorKind convertMusicxmlFd2allWithHandler (
+  FILE*                          fd,
+  std::ostream&                  out,
+  std::ostream&                  err,
+  const S_xml2allInsiderHandler& handler);
+
+//_______________________________________________________________________________
+EXP mfMusicformatsErrorKind convertMusicxmlString2allWithHandler (
+  const char*                    buffer,
+  std::ostream&                  out,
+  std::ostream&                  err,
+  const S_xml2allInsiderHandler& handler);
+
+
+}
+
+#endif // ___musicxml2allInterface___
@@ -584,7 +584,7 @@ void xml2brlInsiderOahGroup::acceptIn (basevisitor* v)
 
   if (visitor<S_xml2brlInsiderOahGroup>*
     p =
-      dynamic_cast<visitor<S_xml2brlInsiderOahGroup>*> (v)) {
+      visitor<S_xml2brlInsiderOahGroup>::cast (v)) {
         S_xml2brlInsiderOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -620,7 +620,7 @@ void xml2brlInsiderOahGroup::acceptOut (basevisitor* v)
 
   if (visitor<S_xml2brlInsiderOahGroup>*
     p =
-      dynamic_cast<visitor<S_xml2brlInsiderOahGroup>*> (v)) {
+      visitor<S_xml2brlInsiderOahGroup>::cast (v)) {
         S_xml2brlInsiderOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -70,6 +70,7 @@ namespace MusicFormats
 //_______________________________________________________________________________
 static mfMusicformatsErrorKind xmlFile2brailleWithHandler (
   SXMLFile&     sxmlfile,
+  const char*   streamedFileName,
   std::ostream& out,
   std::ostream& err,
   S_oahHandler  handler)
@@ -122,14 +123,40 @@ static mfMusicformatsErrorKind xmlFile2brailleWithHandler (
 
   mxsrEventsCollection eventsCollection;
 
+  // passes 2 and 3 can be fused, except in streaming mode
+  Bool
+    fusePasses2And3 =
+      gGlobalMxsr2msrOahGroup->getFuseMxsrToMsrPasses ()
+        &&
+      ! streamedFileName;
+
   try {
-    firstMsrScore =
-      translateMxsrToMsrSkeleton (
-        theMxsr,
-        eventsCollection,
-        gMsrOahGroup,
-        mfPassIDKind::kMfPassID_2,
-        gLanguage->convertTheMXSRIntoAnMSRSkeleton ());
+    if (fusePasses2And3) {
+      firstMsrScore =
+        buildAndPopulateMsrFromMxsr (
+          theMxsr,
+          eventsCollection,
+          mfPassIDKind::kMfPassID_2,
+          gLanguage->convertTheMXSRIntoAPopulatedMSR ());
+    }
+    else if (streamedFileName) {
+      firstMsrScore =
+        translateMusicXMLFileToMsrSkeleton (
+          streamedFileName,
+          eventsCollection,
+          gMsrOahGroup,
+          mfPassIDKind::kMfPassID_2,
+          gLanguage->convertTheMXSRIntoAnMSRSkeleton ());
+    }
+    else {
+      firstMsrScore =
+        translateMxsrToMsrSkeleton (
+          theMxsr,
+          eventsCollection,
+          gMsrOahGroup,
+          mfPassIDKind::kMfPassID_2,
+          gLanguage->convertTheMXSRIntoAnMSRSkeleton ());
+    }
   } // try
 
   catch (mxsr2msrException& e) {
@@ -159,12 +186,22 @@ static mfMusicformatsErrorKind xmlFile2brailleWithHandler (
   // ------------------------------------------------------
 
   try {
-    populateMsrSkeletonFromMxsr (
-      theMxsr,
-      firstMsrScore,
-      eventsCollection,
-      mfPassIDKind::kMfPassID_3,
-      gLanguage->populateTheMSRSkeletonFromMusicXMLData ());
+    if (streamedFileName) {
+      populateMsrSkeletonFromMusicXMLFile (
+        streamedFileName,
+        firstMsrScore,
+        eventsCollection,
+        mfPassIDKind::kMfPassID_3,
+        gLanguage->populateTheMSRSkeletonFromMusicXMLData ());
+    }
+    else if (! fusePasses2And3) { // otherwise populated in pass 2
+      populateMsrSkeletonFromMxsr (
+        theMxsr,
+        firstMsrScore,
+        eventsCollection,
+        mfPassIDKind::kMfPassID_3,
+        gLanguage->populateTheMSRSkeletonFromMusicXMLData ());
+    }
   } // try
 
   catch (mxsr2msrException& e) {
@@ -632,6 +669,7 @@ static mfMusicformatsErrorKind xmlFile2brailleWithOptionsAndArguments (
 
   xmlFile2brailleWithHandler (
     sxmlfile,
+    nullptr,
     out,
     err,
     handler);
@@ -680,9 +718,17 @@ mfMusicformatsErrorKind convertMusicxmlFile2brailleWithHandler (
         gLanguage->convertAMusicXMLStreamIntoAnMXSR ());
 
   if (sxmlfile) {
+    // in streaming mode, the file is read again in passes 2 and 3
+    const char*
+      streamedFileName =
+        gGlobalMxsr2msrOahGroup->getStreamMusicXMLInput ()
+          ? fileName
+          : nullptr;
+
     return
       xmlFile2brailleWithHandler (
         sxmlfile,
+        streamedFileName,
         out,
         err,
         handler);
@@ -734,6 +780,7 @@ mfMusicformatsErrorKind convertMusicxmlFd2brailleWithHandler (
     return
       xmlFile2brailleWithHandler (
         sxmlfile,
+        nullptr,
         out,
         err,
         handler);
@@ -786,6 +833,7 @@ mfMusicformatsErrorKind convertMusicxmlString2brailleWithHandler (
   return
     xmlFile2brailleWithHandler (
       sxmlfile,
+      nullptr,
       out,
       err,
       handler);
@@ -95,7 +95,7 @@ void xml2brlManPageGenerateAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_xml2brlManPageGenerateAtom>*
     p =
-      dynamic_cast<visitor<S_xml2brlManPageGenerateAtom>*> (v)) {
+      visitor<S_xml2brlManPageGenerateAtom>::cast (v)) {
         S_xml2brlManPageGenerateAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -131,7 +131,7 @@ void xml2brlManPageGenerateAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_xml2brlManPageGenerateAtom>*
     p =
-      dynamic_cast<visitor<S_xml2brlManPageGenerateAtom>*> (v)) {
+      visitor<S_xml2brlManPageGenerateAtom>::cast (v)) {
         S_xml2brlManPageGenerateAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -332,7 +332,7 @@ void xml2brlManPageOahGroup::acceptIn (basevisitor* v)
 
   if (visitor<S_xml2brlManPageOahGroup>*
     p =
-      dynamic_cast<visitor<S_xml2brlManPageOahGroup>*> (v)) {
+      visitor<S_xml2brlManPageOahGroup>::cast (v)) {
         S_xml2brlManPageOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -368,7 +368,7 @@ void xml2brlManPageOahGroup::acceptOut (basevisitor* v)
 
   if (visitor<S_xml2brlManPageOahGroup>*
     p =
-      dynamic_cast<visitor<S_xml2brlManPageOahGroup>*> (v)) {
+      visitor<S_xml2brlManPageOahGroup>::cast (v)) {
         S_xml2brlManPageOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
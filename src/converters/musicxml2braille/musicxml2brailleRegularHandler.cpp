@@ -850,6 +850,8 @@ void xml2brlRegularHandler::createNotesRegularGroup ()
   // atoms
 
   registerAtomInRegularSubgroup ("msr-pitches-language", subGroup);
+
+  registerAtomInRegularSubgroup ("share-msr-notes", subGroup);
 }
 
 void xml2brlRegularHandler::creatBeamsRegularGroup ()
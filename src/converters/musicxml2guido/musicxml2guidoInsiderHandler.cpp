@@ -496,7 +496,7 @@ void xml2gmnInsiderOahGroup::acceptIn (basevisitor* v)
 
   if (visitor<S_xml2gmnInsiderOahGroup>*
     p =
-      dynamic_cast<visitor<S_xml2gmnInsiderOahGroup>*> (v)) {
+      visitor<S_xml2gmnInsiderOahGroup>::cast (v)) {
         S_xml2gmnInsiderOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -532,7 +532,7 @@ void xml2gmnInsiderOahGroup::acceptOut (basevisitor* v)
 
   if (visitor<S_xml2gmnInsiderOahGroup>*
     p =
-      dynamic_cast<visitor<S_xml2gmnInsiderOahGroup>*> (v)) {
+      visitor<S_xml2gmnInsiderOahGroup>::cast (v)) {
         S_xml2gmnInsiderOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
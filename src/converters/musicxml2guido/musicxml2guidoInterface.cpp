@@ -64,6 +64,7 @@ namespace MusicFormats
 //_______________________________________________________________________________
 static mfMusicformatsErrorKind xmlFile2guidoWithHandler (
   SXMLFile&           sxmlfile,
+  const char*         streamedFileName,
   std::ostream&       out,
   std::ostream&       err,
   const S_oahHandler& handler)
@@ -116,14 +117,40 @@ static mfMusicformatsErrorKind xmlFile2guidoWithHandler (
 
   mxsrEventsCollection eventsCollection;
 
+  // passes 2 and 3 can be fused, except in streaming mode
+  Bool
+    fusePasses2And3 =
+      gGlobalMxsr2msrOahGroup->getFuseMxsrToMsrPasses ()
+        &&
+      ! streamedFileName;
+
   try {
-    firstMsrScore =
-      translateMxsrToMsrSkeleton (
-        originalMxsr,
-        eventsCollection,
-        gMsrOahGroup,
-        mfPassIDKind::kMfPassID_2,
-        "Create the skeleton of the first MSR from the originalMxsr");
+    if (fusePasses2And3) {
+      firstMsrScore =
+        buildAndPopulateMsrFromMxsr (
+          originalMxsr,
+          eventsCollection,
+          mfPassIDKind::kMfPassID_2,
+          gLanguage->convertTheMXSRIntoAPopulatedMSR ());
+    }
+    else if (streamedFileName) {
+      firstMsrScore =
+        translateMusicXMLFileToMsrSkeleton (
+          streamedFileName,
+          eventsCollection,
+          gMsrOahGroup,
+          mfPassIDKind::kMfPassID_2,
+          "Create the skeleton of the first MSR from the originalMxsr");
+    }
+    else {
+      firstMsrScore =
+        translateMxsrToMsrSkeleton (
+          originalMxsr,
+          eventsCollection,
+          gMsrOahGroup,
+          mfPassIDKind::kMfPassID_2,
+          "Create the skeleton of the first MSR from the originalMxsr");
+    }
   } // try
 
   catch (mxsr2msrException& e) {
@@ -154,12 +181,22 @@ static mfMusicformatsErrorKind xmlFile2guidoWithHandler (
   // ------------------------------------------------------
 
   try {
-    populateMsrSkeletonFromMxsr (
-      originalMxsr,
-      firstMsrScore,
-      eventsCollection,
-      mfPassIDKind::kMfPassID_3,
-      gLanguage->populateTheMSRSkeletonFromMusicXMLData ());
+    if (streamedFileName) {
+      populateMsrSkeletonFromMusicXMLFile (
+        streamedFileName,
+        firstMsrScore,
+        eventsCollection,
+        mfPassIDKind::kMfPassID_3,
+        gLanguage->populateTheMSRSkeletonFromMusicXMLData ());
+    }
+    else if (! fusePasses2And3) { // otherwise populated in pass 2
+      populateMsrSkeletonFromMxsr (
+        originalMxsr,
+        firstMsrScore,
+        eventsCollection,
+        mfPassIDKind::kMfPassID_3,
+        gLanguage->populateTheMSRSkeletonFromMusicXMLData ());
+    }
   } // try
 
   catch (mxsr2msrException& e) {
@@ -442,6 +479,7 @@ static mfMusicformatsErrorKind xmlFile2guidoWithOptionsAndArguments (
 
   xmlFile2guidoWithHandler (
     sxmlfile,
+    nullptr,
     out,
     err,
     handler);
@@ -489,9 +527,17 @@ mfMusicformatsErrorKind convertMusicxmlFile2guidoWithHandler (
         gLanguage->convertAMusicXMLStreamIntoAnMXSR ());
 
   if (sxmlfile) {
+    // in streaming mode, the file is read again in passes 2 and 3
+    const char*
+      streamedFileName =
+        gGlobalMxsr2msrOahGroup->getStreamMusicXMLInput ()
+          ? fileName
+          : nullptr;
+
     return
       xmlFile2guidoWithHandler (
         sxmlfile,
+        streamedFileName,
         out,
         err,
         handler);
@@ -543,6 +589,7 @@ mfMusicformatsErrorKind convertMusicxmlFd2guidoWithHandler (
     return
       xmlFile2guidoWithHandler (
         sxmlfile,
+        nullptr,
         out,
         err,
         handler);
@@ -595,6 +642,7 @@ mfMusicformatsErrorKind convertMusicxmlString2guidoWithHandler (
   return
     xmlFile2guidoWithHandler (
       sxmlfile,
+      nullptr,
       out,
       err,
       handler);
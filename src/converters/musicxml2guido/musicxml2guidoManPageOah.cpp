@@ -95,7 +95,7 @@ void xml2gmnManPageGenerateAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_xml2gmnManPageGenerateAtom>*
     p =
-      dynamic_cast<visitor<S_xml2gmnManPageGenerateAtom>*> (v)) {
+      visitor<S_xml2gmnManPageGenerateAtom>::cast (v)) {
         S_xml2gmnManPageGenerateAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -131,7 +131,7 @@ void xml2gmnManPageGenerateAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_xml2gmnManPageGenerateAtom>*
     p =
-      dynamic_cast<visitor<S_xml2gmnManPageGenerateAtom>*> (v)) {
+      visitor<S_xml2gmnManPageGenerateAtom>::cast (v)) {
         S_xml2gmnManPageGenerateAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -345,7 +345,7 @@ void xml2gmnManPageOahGroup::acceptIn (basevisitor* v)
 
   if (visitor<S_xml2gmnManPageOahGroup>*
     p =
-      dynamic_cast<visitor<S_xml2gmnManPageOahGroup>*> (v)) {
+      visitor<S_xml2gmnManPageOahGroup>::cast (v)) {
         S_xml2gmnManPageOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -381,7 +381,7 @@ void xml2gmnManPageOahGroup::acceptOut (basevisitor* v)
 
   if (visitor<S_xml2gmnManPageOahGroup>*
     p =
-      dynamic_cast<visitor<S_xml2gmnManPageOahGroup>*> (v)) {
+      visitor<S_xml2gmnManPageOahGroup>::cast (v)) {
         S_xml2gmnManPageOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -830,6 +830,8 @@ void xml2gmnRegularHandler::createNotesRegularGroup ()
   // atoms
 
   registerAtomInRegularSubgroup ("msr-pitches-language", subGroup);
+
+  registerAtomInRegularSubgroup ("share-msr-notes", subGroup);
 }
 
 void xml2gmnRegularHandler::creatBeamsRegularGroup ()
@@ -1313,6 +1315,7 @@ void xml2gmnRegularHandler::createOutputRegularGroup ()
   registerAtomInRegularSubgroup ("generate-guido-comments", subGroup);
   registerAtomInRegularSubgroup ("generate-guido-stem", subGroup);
   registerAtomInRegularSubgroup ("generate-guido-bars", subGroup);
+  registerAtomInRegularSubgroup ("generate-guido-parts-in-parallel", subGroup);
 }
 
 //______________________________________________________________________________
@@ -560,7 +560,7 @@ void xml2lyInsiderOahGroup::acceptIn (basevisitor* v)
 
   if (visitor<S_xml2lyInsiderOahGroup>*
     p =
-      dynamic_cast<visitor<S_xml2lyInsiderOahGroup>*> (v)) {
+      visitor<S_xml2lyInsiderOahGroup>::cast (v)) {
         S_xml2lyInsiderOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -596,7 +596,7 @@ void xml2lyInsiderOahGroup::acceptOut (basevisitor* v)
 
   if (visitor<S_xml2lyInsiderOahGroup>*
     p =
-      dynamic_cast<visitor<S_xml2lyInsiderOahGroup>*> (v)) {
+      visitor<S_xml2lyInsiderOahGroup>::cast (v)) {
         S_xml2lyInsiderOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -71,6 +71,7 @@ namespace MusicFormats
 //_______________________________________________________________________________
 static mfMusicformatsErrorKind sxmlFile2lilypondWithHandler (
   SXMLFile&           sxmlfile,
+  const char*         streamedFileName,
   std::ostream&       out,
   std::ostream&       err,
   const S_oahHandler& handler)
@@ -123,14 +124,40 @@ static mfMusicformatsErrorKind sxmlFile2lilypondWithHandler (
 
   mxsrEventsCollection eventsCollection;
 
+  // passes 2 and 3 can be fused, except in streaming mode
+  Bool
+    fusePasses2And3 =
+      gGlobalMxsr2msrOahGroup->getFuseMxsrToMsrPasses ()
+        &&
+      ! streamedFileName;
+
   try {
-    firstMsrScore =
-      translateMxsrToMsrSkeleton (
-        theMxsr,
-        eventsCollection,
-        gMsrOahGroup,
-        mfPassIDKind::kMfPassID_2,
-        gLanguage->convertTheMXSRIntoAnMSRSkeleton ());
+    if (fusePasses2And3) {
+      firstMsrScore =
+        buildAndPopulateMsrFromMxsr (
+          theMxsr,
+          eventsCollection,
+          mfPassIDKind::kMfPassID_2,
+          gLanguage->convertTheMXSRIntoAPopulatedMSR ());
+    }
+    else if (streamedFileName) {
+      firstMsrScore =
+        translateMusicXMLFileToMsrSkeleton (
+          streamedFileName,
+          eventsCollection,
+          gMsrOahGroup,
+          mfPassIDKind::kMfPassID_2,
+          gLanguage->convertTheMXSRIntoAnMSRSkeleton ());
+    }
+    else {
+      firstMsrScore =
+        translateMxsrToMsrSkeleton (
+          theMxsr,
+          eventsCollection,
+          gMsrOahGroup,
+          mfPassIDKind::kMfPassID_2,
+          gLanguage->convertTheMXSRIntoAnMSRSkeleton ());
+    }
   } // try
 
   catch (mxsr2msrException& e) {
@@ -160,12 +187,22 @@ static mfMusicformatsErrorKind sxmlFile2lilypondWithHandler (
   // ------------------------------------------------------
 
   try {
-    populateMsrSkeletonFromMxsr (
-      theMxsr,
-      firstMsrScore,
-      eventsCollection,
-      mfPassIDKind::kMfPassID_3,
-      gLanguage->populateTheMSRSkeletonFromMusicXMLData ());
+    if (streamedFileName) {
+      populateMsrSkeletonFromMusicXMLFile (
+        streamedFileName,
+        firstMsrScore,
+        eventsCollection,
+        mfPassIDKind::kMfPassID_3,
+        gLanguage->populateTheMSRSkeletonFromMusicXMLData ());
+    }
+    else if (! fusePasses2And3) { // otherwise populated in pass 2
+      populateMsrSkeletonFromMxsr (
+        theMxsr,
+        firstMsrScore,
+        eventsCollection,
+        mfPassIDKind::kMfPassID_3,
+        gLanguage->populateTheMSRSkeletonFromMusicXMLData ());
+    }
   } // try
 
   catch (mxsr2msrException& e) {
@@ -469,6 +506,9 @@ static mfMusicformatsErrorKind sxmlFile2lilypondWithHandler (
     }
 #endif // MF_TRACE_IS_ENABLED
 
+    // write the buffered LilyPond code before closing the file
+    lilypondFileOutputStream.flush ();
+
     outputFileStream.close ();
   }
 
@@ -642,6 +682,7 @@ static mfMusicformatsErrorKind xmlFile2lilypondWithOptionsAndArguments (
 
   sxmlFile2lilypondWithHandler (
     sxmlfile,
+    nullptr,
     out,
     err,
     handler);
@@ -689,9 +730,17 @@ mfMusicformatsErrorKind convertMusicxmlFile2lilypondWithHandler (
         gLanguage->convertAMusicXMLStreamIntoAnMXSR ());
 
   if (sxmlfile) {
+    // in streaming mode, the file is read again in passes 2 and 3
+    const char*
+      streamedFileName =
+        gGlobalMxsr2msrOahGroup->getStreamMusicXMLInput ()
+          ? fileName
+          : nullptr;
+
     return
       sxmlFile2lilypondWithHandler (
         sxmlfile,
+        streamedFileName,
         out,
         err,
         handler);
@@ -743,6 +792,7 @@ mfMusicformatsErrorKind convertMusicxmlFd2lilypondWithHandler (
     return
       sxmlFile2lilypondWithHandler (
         sxmlfile,
+        nullptr,
         out,
         err,
         handler);
@@ -795,6 +845,7 @@ mfMusicformatsErrorKind convertMusicxmlString2lilypondWithHandler (
   return
     sxmlFile2lilypondWithHandler (
       sxmlfile,
+      nullptr,
       out,
       err,
       handler);
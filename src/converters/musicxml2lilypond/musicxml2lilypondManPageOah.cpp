@@ -97,7 +97,7 @@ void xml2lyManPageGenerateAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_xml2lyManPageGenerateAtom>*
     p =
-      dynamic_cast<visitor<S_xml2lyManPageGenerateAtom>*> (v)) {
+      visitor<S_xml2lyManPageGenerateAtom>::cast (v)) {
         S_xml2lyManPageGenerateAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -133,7 +133,7 @@ void xml2lyManPageGenerateAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_xml2lyManPageGenerateAtom>*
     p =
-      dynamic_cast<visitor<S_xml2lyManPageGenerateAtom>*> (v)) {
+      visitor<S_xml2lyManPageGenerateAtom>::cast (v)) {
         S_xml2lyManPageGenerateAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -347,7 +347,7 @@ void xml2lyManPageOahGroup::acceptIn (basevisitor* v)
 
   if (visitor<S_xml2lyManPageOahGroup>*
     p =
-      dynamic_cast<visitor<S_xml2lyManPageOahGroup>*> (v)) {
+      visitor<S_xml2lyManPageOahGroup>::cast (v)) {
         S_xml2lyManPageOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -383,7 +383,7 @@ void xml2lyManPageOahGroup::acceptOut (basevisitor* v)
 
   if (visitor<S_xml2lyManPageOahGroup>*
     p =
-      dynamic_cast<visitor<S_xml2lyManPageOahGroup>*> (v)) {
+      visitor<S_xml2lyManPageOahGroup>::cast (v)) {
         S_xml2lyManPageOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -890,6 +890,7 @@ void xml2lyRegularHandler::createRestsRegularGroup ()
   // atoms
 
   registerAtomInRegularSubgroup ("avoid-msr2msr", subGroup); // for TESTS
+  registerAtomInRegularSubgroup ("share-msr-notes", subGroup);
 
   registerAtomInRegularSubgroup ("delay-rests-slashes", subGroup);
 
@@ -490,7 +490,7 @@ void xml2xmlInsiderOahGroup::acceptIn (basevisitor* v)
 
   if (visitor<S_xml2xmlInsiderOahGroup>*
     p =
-      dynamic_cast<visitor<S_xml2xmlInsiderOahGroup>*> (v)) {
+      visitor<S_xml2xmlInsiderOahGroup>::cast (v)) {
         S_xml2xmlInsiderOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -526,7 +526,7 @@ void xml2xmlInsiderOahGroup::acceptOut (basevisitor* v)
 
   if (visitor<S_xml2xmlInsiderOahGroup>*
     p =
-      dynamic_cast<visitor<S_xml2xmlInsiderOahGroup>*> (v)) {
+      visitor<S_xml2xmlInsiderOahGroup>::cast (v)) {
         S_xml2xmlInsiderOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -68,6 +68,7 @@ namespace MusicFormats
 //_______________________________________________________________________________
 static mfMusicformatsErrorKind xmlFile2musicxmlWithHandler (
   SXMLFile&           sxmlfile,
+  const char*         streamedFileName,
   std::ostream&       out,
   std::ostream&       err,
   const S_oahHandler& handler)
@@ -126,14 +127,40 @@ static mfMusicformatsErrorKind xmlFile2musicxmlWithHandler (
 
   mxsrEventsCollection eventsCollection;
 
+  // passes 2 and 3 can be fused, except in streaming mode
+  Bool
+    fusePasses2And3 =
+      gGlobalMxsr2msrOahGroup->getFuseMxsrToMsrPasses ()
+        &&
+      ! streamedFileName;
+
   try {
-    firstMsrScore =
-      translateMxsrToMsrSkeleton (
-        originalMxsr,
-        eventsCollection,
-        gMsrOahGroup,
-        mfPassIDKind::kMfPassID_2,
-        gLanguage->convertTheMXSRIntoAnMSRSkeleton ());
+    if (fusePasses2And3) {
+      firstMsrScore =
+        buildAndPopulateMsrFromMxsr (
+          originalMxsr,
+          eventsCollection,
+          mfPassIDKind::kMfPassID_2,
+          gLanguage->convertTheMXSRIntoAPopulatedMSR ());
+    }
+    else if (streamedFileName) {
+      firstMsrScore =
+        translateMusicXMLFileToMsrSkeleton (
+          streamedFileName,
+          eventsCollection,
+          gMsrOahGroup,
+          mfPassIDKind::kMfPassID_2,
+          gLanguage->convertTheMXSRIntoAnMSRSkeleton ());
+    }
+    else {
+      firstMsrScore =
+        translateMxsrToMsrSkeleton (
+          originalMxsr,
+          eventsCollection,
+          gMsrOahGroup,
+          mfPassIDKind::kMfPassID_2,
+          gLanguage->convertTheMXSRIntoAnMSRSkeleton ());
+    }
   } // try
 
   catch (mxsr2msrException& e) {
@@ -163,12 +190,22 @@ static mfMusicformatsErrorKind xmlFile2musicxmlWithHandler (
   // ------------------------------------------------------
 
   try {
-    populateMsrSkeletonFromMxsr (
-      originalMxsr,
-      firstMsrScore,
-      eventsCollection,
-      mfPassIDKind::kMfPassID_3,
-      "Populate the MSR skeletonfrom MusicXML data");
+    if (streamedFileName) {
+      populateMsrSkeletonFromMusicXMLFile (
+        streamedFileName,
+        firstMsrScore,
+        eventsCollection,
+        mfPassIDKind::kMfPassID_3,
+        "Populate the MSR skeletonfrom MusicXML data");
+    }
+    else if (! fusePasses2And3) { // otherwise populated in pass 2
+      populateMsrSkeletonFromMxsr (
+        originalMxsr,
+        firstMsrScore,
+        eventsCollection,
+        mfPassIDKind::kMfPassID_3,
+        "Populate the MSR skeletonfrom MusicXML data");
+    }
   } // try
 
   catch (mxsr2msrException& e) {
@@ -451,6 +488,7 @@ static mfMusicformatsErrorKind xmlFile2musicxmlWithOptionsAndArguments (
 
   xmlFile2musicxmlWithHandler (
     sxmlfile,
+    nullptr,
     out,
     err,
     handler);
@@ -498,9 +536,17 @@ mfMusicformatsErrorKind convertMusicxmlFile2musicxmlWithHandler (
         gLanguage->convertAMusicXMLStreamIntoAnMXSR ());
 
   if (sxmlfile) {
+    // in streaming mode, the file is read again in passes 2 and 3
+    const char*
+      streamedFileName =
+        gGlobalMxsr2msrOahGroup->getStreamMusicXMLInput ()
+          ? fileName
+          : nullptr;
+
     return
       xmlFile2musicxmlWithHandler (
         sxmlfile,
+        streamedFileName,
         out,
         err,
         handler);
@@ -552,6 +598,7 @@ mfMusicformatsErrorKind convertMusicxmlFd2musicxmlWithHandler (
     return
       xmlFile2musicxmlWithHandler (
         sxmlfile,
+        nullptr,
         out,
         err,
         handler);
@@ -604,6 +651,7 @@ mfMusicformatsErrorKind convertMusicxmlString2musicxmlWithHandler (
   return
     xmlFile2musicxmlWithHandler (
       sxmlfile,
+      nullptr,
       out,
       err,
       handler);
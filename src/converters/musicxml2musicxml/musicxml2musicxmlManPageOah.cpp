@@ -95,7 +95,7 @@ void xml2xmlManPageGenerateAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_xml2xmlManPageGenerateAtom>*
     p =
-      dynamic_cast<visitor<S_xml2xmlManPageGenerateAtom>*> (v)) {
+      visitor<S_xml2xmlManPageGenerateAtom>::cast (v)) {
         S_xml2xmlManPageGenerateAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -131,7 +131,7 @@ void xml2xmlManPageGenerateAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_xml2xmlManPageGenerateAtom>*
     p =
-      dynamic_cast<visitor<S_xml2xmlManPageGenerateAtom>*> (v)) {
+      visitor<S_xml2xmlManPageGenerateAtom>::cast (v)) {
         S_xml2xmlManPageGenerateAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -345,7 +345,7 @@ void xml2xmlManPageOahGroup::acceptIn (basevisitor* v)
 
   if (visitor<S_xml2xmlManPageOahGroup>*
     p =
-      dynamic_cast<visitor<S_xml2xmlManPageOahGroup>*> (v)) {
+      visitor<S_xml2xmlManPageOahGroup>::cast (v)) {
         S_xml2xmlManPageOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -381,7 +381,7 @@ void xml2xmlManPageOahGroup::acceptOut (basevisitor* v)
 
   if (visitor<S_xml2xmlManPageOahGroup>*
     p =
-      dynamic_cast<visitor<S_xml2xmlManPageOahGroup>*> (v)) {
+      visitor<S_xml2xmlManPageOahGroup>::cast (v)) {
         S_xml2xmlManPageOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
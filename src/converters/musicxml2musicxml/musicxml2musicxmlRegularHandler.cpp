@@ -831,6 +831,8 @@ void xml2xmlRegularHandler::createNotesRegularGroup ()
   // atoms
 
   registerAtomInRegularSubgroup ("msr-pitches-language", subGroup);
+
+  registerAtomInRegularSubgroup ("share-msr-notes", subGroup);
 }
 
 void xml2xmlRegularHandler::creatBeamsRegularGroup ()
@@ -1313,6 +1315,7 @@ void xml2xmlRegularHandler::createOutputRegularGroup ()
 
   registerAtomInRegularSubgroup ("musicxml-generation-infos", subGroup);
   registerAtomInRegularSubgroup ("musicxml-comments", subGroup);
+  registerAtomInRegularSubgroup ("compact-musicxml", subGroup);
 
   registerAtomInRegularSubgroup ("work-title", subGroup);
   registerAtomInRegularSubgroup ("work-number", subGroup);
@@ -784,7 +784,7 @@ void LilyPondIssue34InsiderOahGroup::acceptIn (basevisitor* v)
 
   if (visitor<S_LilyPondIssue34InsiderOahGroup>*
     p =
-      dynamic_cast<visitor<S_LilyPondIssue34InsiderOahGroup>*> (v)) {
+      visitor<S_LilyPondIssue34InsiderOahGroup>::cast (v)) {
         S_LilyPondIssue34InsiderOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -820,7 +820,7 @@ void LilyPondIssue34InsiderOahGroup::acceptOut (basevisitor* v)
 
   if (visitor<S_LilyPondIssue34InsiderOahGroup>*
     p =
-      dynamic_cast<visitor<S_LilyPondIssue34InsiderOahGroup>*> (v)) {
+      visitor<S_LilyPondIssue34InsiderOahGroup>::cast (v)) {
         S_LilyPondIssue34InsiderOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -218,7 +218,7 @@ void LilyPondIssue34OahGroup::acceptIn (basevisitor* v)
 
   if (visitor<S_LilyPondIssue34OahGroup>*
     p =
-      dynamic_cast<visitor<S_LilyPondIssue34OahGroup>*> (v)) {
+      visitor<S_LilyPondIssue34OahGroup>::cast (v)) {
         S_LilyPondIssue34OahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -254,7 +254,7 @@ void LilyPondIssue34OahGroup::acceptOut (basevisitor* v)
 
   if (visitor<S_LilyPondIssue34OahGroup>*
     p =
-      dynamic_cast<visitor<S_LilyPondIssue34OahGroup>*> (v)) {
+      visitor<S_LilyPondIssue34OahGroup>::cast (v)) {
         S_LilyPondIssue34OahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -377,6 +377,7 @@ void LilyPondIssue34RegularHandler::createGuidoRegularGroup ()
   registerAtomInRegularSubgroup ("generate-guido-comments", subGroup);
   registerAtomInRegularSubgroup ("generate-guido-stem", subGroup);
   registerAtomInRegularSubgroup ("generate-guido-bars", subGroup);
+  registerAtomInRegularSubgroup ("generate-guido-parts-in-parallel", subGroup);
 }
 
 void LilyPondIssue34RegularHandler::createBrailleRegularGroup ()
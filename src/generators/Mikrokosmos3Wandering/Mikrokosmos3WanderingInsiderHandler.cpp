@@ -782,7 +782,7 @@ void Mikrokosmos3WanderingInsiderOahGroup::acceptIn (basevisitor* v)
 
   if (visitor<S_Mikrokosmos3WanderingInsiderOahGroup>*
     p =
-      dynamic_cast<visitor<S_Mikrokosmos3WanderingInsiderOahGroup>*> (v)) {
+      visitor<S_Mikrokosmos3WanderingInsiderOahGroup>::cast (v)) {
         S_Mikrokosmos3WanderingInsiderOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -818,7 +818,7 @@ void Mikrokosmos3WanderingInsiderOahGroup::acceptOut (basevisitor* v)
 
   if (visitor<S_Mikrokosmos3WanderingInsiderOahGroup>*
     p =
-      dynamic_cast<visitor<S_Mikrokosmos3WanderingInsiderOahGroup>*> (v)) {
+      visitor<S_Mikrokosmos3WanderingInsiderOahGroup>::cast (v)) {
         S_Mikrokosmos3WanderingInsiderOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
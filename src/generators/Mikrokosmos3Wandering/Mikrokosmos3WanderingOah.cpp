@@ -218,7 +218,7 @@ void Mikrokosmos3WanderingOahGroup::acceptIn (basevisitor* v)
 
   if (visitor<S_Mikrokosmos3WanderingOahGroup>*
     p =
-      dynamic_cast<visitor<S_Mikrokosmos3WanderingOahGroup>*> (v)) {
+      visitor<S_Mikrokosmos3WanderingOahGroup>::cast (v)) {
         S_Mikrokosmos3WanderingOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -254,7 +254,7 @@ void Mikrokosmos3WanderingOahGroup::acceptOut (basevisitor* v)
 
   if (visitor<S_Mikrokosmos3WanderingOahGroup>*
     p =
-      dynamic_cast<visitor<S_Mikrokosmos3WanderingOahGroup>*> (v)) {
+      visitor<S_Mikrokosmos3WanderingOahGroup>::cast (v)) {
         S_Mikrokosmos3WanderingOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -375,6 +375,7 @@ void Mikrokosmos3WanderingRegularHandler::createGuidoRegularGroup ()
   registerAtomInRegularSubgroup ("generate-guido-comments", subGroup);
   registerAtomInRegularSubgroup ("generate-guido-stem", subGroup);
   registerAtomInRegularSubgroup ("generate-guido-bars", subGroup);
+  registerAtomInRegularSubgroup ("generate-guido-parts-in-parallel", subGroup);
 }
 
 void Mikrokosmos3WanderingRegularHandler::createBrailleRegularGroup ()
@@ -307,7 +307,7 @@ void ischemeInterpreterInsiderOahGroup::acceptIn (basevisitor* v)
 
   if (visitor<S_ischemeInterpreterInsiderOahGroup>*
     p =
-      dynamic_cast<visitor<S_ischemeInterpreterInsiderOahGroup>*> (v)) {
+      visitor<S_ischemeInterpreterInsiderOahGroup>::cast (v)) {
         S_ischemeInterpreterInsiderOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -333,7 +333,7 @@ void ischemeInterpreterInsiderOahGroup::acceptOut (basevisitor* v)
 
   if (visitor<S_ischemeInterpreterInsiderOahGroup>*
     p =
-      dynamic_cast<visitor<S_ischemeInterpreterInsiderOahGroup>*> (v)) {
+      visitor<S_ischemeInterpreterInsiderOahGroup>::cast (v)) {
         S_ischemeInterpreterInsiderOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
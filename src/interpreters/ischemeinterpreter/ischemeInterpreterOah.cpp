@@ -266,7 +266,7 @@ void ischemeInterpreterOahGroup::acceptIn (basevisitor* v)
 
   if (visitor<S_ischemeInterpreterOahGroup>*
     p =
-      dynamic_cast<visitor<S_ischemeInterpreterOahGroup>*> (v)) {
+      visitor<S_ischemeInterpreterOahGroup>::cast (v)) {
         S_ischemeInterpreterOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -292,7 +292,7 @@ void ischemeInterpreterOahGroup::acceptOut (basevisitor* v)
 
   if (visitor<S_ischemeInterpreterOahGroup>*
     p =
-      dynamic_cast<visitor<S_ischemeInterpreterOahGroup>*> (v)) {
+      visitor<S_ischemeInterpreterOahGroup>::cast (v)) {
         S_ischemeInterpreterOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -305,7 +305,7 @@ void mfslInterpreterInsiderOahGroup::acceptIn (basevisitor* v)
 
   if (visitor<S_mfslInterpreterInsiderOahGroup>*
     p =
-      dynamic_cast<visitor<S_mfslInterpreterInsiderOahGroup>*> (v)) {
+      visitor<S_mfslInterpreterInsiderOahGroup>::cast (v)) {
         S_mfslInterpreterInsiderOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -331,7 +331,7 @@ void mfslInterpreterInsiderOahGroup::acceptOut (basevisitor* v)
 
   if (visitor<S_mfslInterpreterInsiderOahGroup>*
     p =
-      dynamic_cast<visitor<S_mfslInterpreterInsiderOahGroup>*> (v)) {
+      visitor<S_mfslInterpreterInsiderOahGroup>::cast (v)) {
         S_mfslInterpreterInsiderOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -266,7 +266,7 @@ void mfslInterpreterOahGroup::acceptIn (basevisitor* v)
 
   if (visitor<S_mfslInterpreterOahGroup>*
     p =
-      dynamic_cast<visitor<S_mfslInterpreterOahGroup>*> (v)) {
+      visitor<S_mfslInterpreterOahGroup>::cast (v)) {
         S_mfslInterpreterOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -292,7 +292,7 @@ void mfslInterpreterOahGroup::acceptOut (basevisitor* v)
 
   if (visitor<S_mfslInterpreterOahGroup>*
     p =
-      dynamic_cast<visitor<S_mfslInterpreterOahGroup>*> (v)) {
+      visitor<S_mfslInterpreterOahGroup>::cast (v)) {
         S_mfslInterpreterOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -303,7 +303,7 @@ void mnx2mnxsrInterpreterInsiderOahGroup::acceptIn (basevisitor* v)
 
   if (visitor<S_mnx2mnxsrInterpreterInsiderOahGroup>*
     p =
-      dynamic_cast<visitor<S_mnx2mnxsrInterpreterInsiderOahGroup>*> (v)) {
+      visitor<S_mnx2mnxsrInterpreterInsiderOahGroup>::cast (v)) {
         S_mnx2mnxsrInterpreterInsiderOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -329,7 +329,7 @@ void mnx2mnxsrInterpreterInsiderOahGroup::acceptOut (basevisitor* v)
 
   if (visitor<S_mnx2mnxsrInterpreterInsiderOahGroup>*
     p =
-      dynamic_cast<visitor<S_mnx2mnxsrInterpreterInsiderOahGroup>*> (v)) {
+      visitor<S_mnx2mnxsrInterpreterInsiderOahGroup>::cast (v)) {
         S_mnx2mnxsrInterpreterInsiderOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
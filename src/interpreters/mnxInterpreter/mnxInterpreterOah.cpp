@@ -264,7 +264,7 @@ void mnx2mnxsrInterpreterOahGroup::acceptIn (basevisitor* v)
 
   if (visitor<S_mnx2mnxsrInterpreterOahGroup>*
     p =
-      dynamic_cast<visitor<S_mnx2mnxsrInterpreterOahGroup>*> (v)) {
+      visitor<S_mnx2mnxsrInterpreterOahGroup>::cast (v)) {
         S_mnx2mnxsrInterpreterOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -290,7 +290,7 @@ void mnx2mnxsrInterpreterOahGroup::acceptOut (basevisitor* v)
 
   if (visitor<S_mnx2mnxsrInterpreterOahGroup>*
     p =
-      dynamic_cast<visitor<S_mnx2mnxsrInterpreterOahGroup>*> (v)) {
+      visitor<S_mnx2mnxsrInterpreterOahGroup>::cast (v)) {
         S_mnx2mnxsrInterpreterOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -305,7 +305,7 @@ void stringMatcherInterpreterInsiderOahGroup::acceptIn (basevisitor* v)
 
   if (visitor<S_stringMatcherInterpreterInsiderOahGroup>*
     p =
-      dynamic_cast<visitor<S_stringMatcherInterpreterInsiderOahGroup>*> (v)) {
+      visitor<S_stringMatcherInterpreterInsiderOahGroup>::cast (v)) {
         S_stringMatcherInterpreterInsiderOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -331,7 +331,7 @@ void stringMatcherInterpreterInsiderOahGroup::acceptOut (basevisitor* v)
 
   if (visitor<S_stringMatcherInterpreterInsiderOahGroup>*
     p =
-      dynamic_cast<visitor<S_stringMatcherInterpreterInsiderOahGroup>*> (v)) {
+      visitor<S_stringMatcherInterpreterInsiderOahGroup>::cast (v)) {
         S_stringMatcherInterpreterInsiderOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
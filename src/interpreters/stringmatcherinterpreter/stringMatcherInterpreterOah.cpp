@@ -266,7 +266,7 @@ void stringMatcherInterpreterOahGroup::acceptIn (basevisitor* v)
 
   if (visitor<S_stringMatcherInterpreterOahGroup>*
     p =
-      dynamic_cast<visitor<S_stringMatcherInterpreterOahGroup>*> (v)) {
+      visitor<S_stringMatcherInterpreterOahGroup>::cast (v)) {
         S_stringMatcherInterpreterOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -292,7 +292,7 @@ void stringMatcherInterpreterOahGroup::acceptOut (basevisitor* v)
 
   if (visitor<S_stringMatcherInterpreterOahGroup>*
     p =
-      dynamic_cast<visitor<S_stringMatcherInterpreterOahGroup>*> (v)) {
+      visitor<S_stringMatcherInterpreterOahGroup>::cast (v)) {
         S_stringMatcherInterpreterOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
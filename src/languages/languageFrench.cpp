@@ -185,6 +185,11 @@ std::string languageFrench::populateTheMSRSkeletonFromMusicXMLData () const
   return "Garnissage du squelette de MSR avec les données MusicXML";
 }
 
+std::string languageFrench::convertTheMXSRIntoAPopulatedMSR () const
+{
+  return "Conversion du MXSR en un squelette de MSR garni partie après partie";
+}
+
 std::string languageFrench::convertTheFirstMSRIntoASecondMSR () const
 {
   return "Conversion du premier MSR en un second MSR";
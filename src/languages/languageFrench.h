@@ -76,6 +76,8 @@ class EXP languageFrench : public language
 
     std::string           populateTheMSRSkeletonFromMusicXMLData () const override;
 
+    std::string           convertTheMXSRIntoAPopulatedMSR () const override;
+
     std::string           convertTheFirstMSRIntoASecondMSR () const override;
 
     std::string           convertTheSecondMSRIntoAnLPSR () const override;
@@ -400,6 +400,11 @@ std::string language::populateTheMSRSkeletonFromMusicXMLData () const
   return "Populate the MSR skeleton from the MXSR";
 }
 
+std::string language::convertTheMXSRIntoAPopulatedMSR () const
+{
+  return "Convert the MXSR into an MSR skeleton and populate it part by part";
+}
+
 std::string language::convertTheFirstMSRIntoASecondMSR () const
 {
   return "Convert the first MSR into a second MSR";
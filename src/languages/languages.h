@@ -117,6 +117,8 @@ class EXP language : public smartable
 
     virtual std::string   populateTheMSRSkeletonFromMusicXMLData () const;
 
+    virtual std::string   convertTheMXSRIntoAPopulatedMSR () const;
+
     virtual std::string   convertTheFirstMSRIntoASecondMSR () const;
 
     virtual std::string   convertTheSecondMSRIntoAnLPSR () const;
@@ -39,39 +39,14 @@ namespace MusicFormats
 {
 
 //______________________________________________________________________________
-mfWholeNotes::mfWholeNotes ()
+void mfDenominatorIsNotPositive (
+  const std::string& typeName,
+  int                denominator)
 {
-  fNumerator = 0;
-  fDenominator = 1;
-}
-
-mfWholeNotes::mfWholeNotes (
-  int numerator,
-  int denominator)
-{
-#ifdef MF_SANITY_CHECKS_ARE_ENABLED
-  // sanity check
-//   mfAssert (
-//     __FILE__, mfInputLineNumber (__LINE__),
-//     numerator >= 0,
-//     "mfWholeNotes numerator '" + std::to_string (numerator) + "' should be positive or null");
-
-  mfAssert (
+  mfAssertFalse (
     __FILE__, mfInputLineNumber (__LINE__),
-    denominator > 0,
-    "mfWholeNotes denominator '" + std::to_string (denominator) + "' should be positive");
-#endif // MF_SANITY_CHECKS_ARE_ENABLED
-
-  fNumerator = numerator;
-  fDenominator = denominator;
-
-  rationalise ();
-}
-
-mfWholeNotes::mfWholeNotes (const mfWholeNotes& wholeNotes)
-{
-  fNumerator = wholeNotes.fNumerator;
-  fDenominator = wholeNotes.fDenominator;
+    typeName +
+      " denominator '" + std::to_string (denominator) + "' should be positive");
 }
 
 mfWholeNotes::mfWholeNotes (const std::string& theString)
@@ -152,238 +127,6 @@ mfWholeNotes::mfWholeNotes (const std::string& theString)
   rationalise ();
 }
 
-mfWholeNotes::~mfWholeNotes ()
-{}
-
-mfWholeNotes mfWholeNotes::inverse () const
-{
-  mfWholeNotes
-    result (
-      fDenominator, fNumerator);
-
-  result.rationalise ();
-
-  return result;
-}
-
-mfWholeNotes mfWholeNotes::opposite () const
-{
-  mfWholeNotes
-    result (
-      -fNumerator, fDenominator);
-
-  result.rationalise ();
-
-  return result;
-}
-
-mfWholeNotes mfWholeNotes::operator + (const mfWholeNotes &wholeNotes) const
-{
-  mfWholeNotes
-    result (
-      fNumerator * wholeNotes.fDenominator + wholeNotes.fNumerator * fDenominator,
-      fDenominator * wholeNotes.fDenominator);
-
-  result.rationalise ();
-
-  return result;
-}
-
-mfWholeNotes mfWholeNotes::operator - (const mfWholeNotes &wholeNotes) const
-{
-  mfWholeNotes
-    result (
-      fNumerator * wholeNotes.fDenominator - wholeNotes.fNumerator * fDenominator,
-      fDenominator * wholeNotes.fDenominator);
-
-  result.rationalise ();
-
-  return result;
-}
-
-mfWholeNotes mfWholeNotes::operator * (const mfRational &rat) const
-{
-  mfWholeNotes
-    result (
-      fNumerator * rat.getNumerator (),
-      fDenominator * rat.getDenominator ());
-
-  result.rationalise ();
-
-  return result;
-}
-
-mfWholeNotes mfWholeNotes::operator / (const mfRational &rat) const
-{
-  mfWholeNotes
-    result (
-      fNumerator * rat.getDenominator (),
-      fDenominator * rat.getNumerator ());
-
-  result.rationalise ();
-
-  return result;
-}
-
-mfWholeNotes mfWholeNotes::operator * (int num) const
-{
-  mfWholeNotes
-    result (
-      fNumerator * num,
-      fDenominator);
-
-  result.rationalise ();
-
-  return result;
-}
-
-mfWholeNotes mfWholeNotes::operator / (int num) const
-{
-  mfWholeNotes
-    result (
-      fNumerator,
-      fDenominator * num);
-
-  result.rationalise ();
-
-  return result;
-}
-
-mfRational mfWholeNotes::operator / (const mfWholeNotes &wholeNotes) const
-{
-  mfRational
-    result (
-      fNumerator * wholeNotes.fDenominator,
-      fDenominator * wholeNotes.fNumerator);
-
-  return result;
-}
-
-mfWholeNotes& mfWholeNotes::operator += (const mfWholeNotes &wholeNotes)
-{
-  if (fDenominator == wholeNotes.fDenominator) {
-    fNumerator += wholeNotes.fNumerator;
-  }
-  else {
-    fNumerator =
-      fNumerator * wholeNotes.fDenominator + wholeNotes.fNumerator * fDenominator;
-    fDenominator *=
-      wholeNotes.fDenominator;
-  }
-
-  rationalise ();
-
-  return (*this);
-}
-
-mfWholeNotes& mfWholeNotes::operator -= (const mfWholeNotes &wholeNotes)
-{
-  if (fDenominator == wholeNotes.fDenominator) {
-    fNumerator -= wholeNotes.fNumerator;
-  }
-  else {
-    fNumerator =
-      fNumerator * wholeNotes.fDenominator
-        -
-      wholeNotes.fNumerator * fDenominator;
-    fDenominator *= wholeNotes.fDenominator;
-  }
-
-  rationalise ();
-
-  return (*this);
-}
-
-mfWholeNotes& mfWholeNotes::operator *= (const mfRational &rat)
-{
-  fNumerator   *= rat.getNumerator ();
-  fDenominator *= rat.getDenominator ();
-
-  rationalise ();
-
-  return (*this);
-}
-
-mfWholeNotes& mfWholeNotes::operator /= (const mfRational &rat)
-{
-  fNumerator   /= rat.getDenominator (); // JMI 0.9.67
-  fDenominator /= rat.getNumerator ();
-
-  rationalise ();
-
-  return (*this);
-}
-
-mfWholeNotes& mfWholeNotes::operator = (const mfWholeNotes& wholeNotes) {
-  fNumerator = wholeNotes.fNumerator;
-  fDenominator = wholeNotes.fDenominator;
-
-  return (*this);
-}
-
-Bool mfWholeNotes::operator > (const mfWholeNotes &wholeNotes) const
-{
-  // a/b > c/d if and only if a * d > b * c.
-  return
-    ((fNumerator * wholeNotes.fDenominator) > (fDenominator * wholeNotes.fNumerator));
-}
-
-Bool mfWholeNotes::operator < (const mfWholeNotes &wholeNotes) const
-{
-  // a/b < c/d if and only if a * d < b * c.
-  return
-    ((fNumerator * wholeNotes.fDenominator) < (fDenominator * wholeNotes.fNumerator));
-}
-
-Bool mfWholeNotes::operator == (const mfWholeNotes &wholeNotes) const
-{
-  // a/b == c/d if and only if a * d == b * c.
-  return
-    ((fNumerator * wholeNotes.fDenominator) == (fDenominator * wholeNotes.fNumerator));
-}
-
-Bool mfWholeNotes::operator > (double num) const
-{
-  return (toDouble() > num);
-}
-Bool mfWholeNotes::operator >= (double num) const
-{
-  return (toDouble() >= num);
-}
-Bool mfWholeNotes::operator < (double num) const
-{
-  return (toDouble() < num);
-}
-Bool mfWholeNotes::operator <= (double num) const
-{
-  return (toDouble() <= num);
-}
-Bool mfWholeNotes::operator == (double num) const
-{
-  return (toDouble() == num); }
-
-void mfWholeNotes::rationalise ()
-{
-  int g = std::gcd (fNumerator, fDenominator);
-
-  fNumerator   /= g;
-  fDenominator /= g;
-
-  if (fNumerator == 0) {
-    fDenominator = 1;
-  }
-  else if (fDenominator < 0) {
-    fNumerator = -fNumerator;
-    fDenominator = -fDenominator;
-  }
-}
-
-double mfWholeNotes::toDouble () const
-{
-  return
-    (fDenominator != 0) ? ((double)fNumerator/(double)fDenominator) : 0;
-}
-
 float mfWholeNotes::toFloat () const
 {
   return
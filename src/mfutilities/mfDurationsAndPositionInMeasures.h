@@ -16,6 +16,7 @@
 #include <ostream>
 
 #include "mfBasicTypes.h"
+#include "mfPreprocessorSettings.h"
 
 #include "mfIndentedTextOutput.h"
 #include "mfRational.h"
@@ -94,34 +95,35 @@ class EXP mfWholeNotes
   can lead to nasty, hard to locate bugs (this occurrend once...),
   so there is no constructor with 1 'int' argument
 */
-                          mfWholeNotes ();
+    constexpr             mfWholeNotes ()
+                              : fNumerator (0),
+                                fDenominator (1)
+                              {}
 
-                          mfWholeNotes (
+    constexpr             mfWholeNotes (
                             int numerator,
                             int denominator);
 
-                          mfWholeNotes (const mfWholeNotes& wholeNotes);
+    constexpr             mfWholeNotes (const mfWholeNotes& wholeNotes) = default;
 
                           mfWholeNotes (const std::string& theString);
 
-    virtual               ~mfWholeNotes ();
-
   public:
 
     // set and get
     // ------------------------------------------------------
 
-    void                  setNumerator (int num)
+    constexpr void        setNumerator (int num)
                               { fNumerator = num; }
-    int                   getNumerator ()  const
+    constexpr int         getNumerator ()  const
                               { return fNumerator; }
 
-    void                  setDenominator (int denom)
+    constexpr void        setDenominator (int denom)
                               { fDenominator = denom; }
-    int                   getDenominator () const
+    constexpr int         getDenominator () const
                               { return fDenominator; }
 
-    void                  set (int num, int denom)
+    constexpr void        set (int num, int denom)
                               { fNumerator = num; fDenominator = denom; }
 
   public:
@@ -131,60 +133,84 @@ class EXP mfWholeNotes
 
     // 'rationalise' mfWholeNotes values
 
-    void                  rationalise ();
+    constexpr void        rationalise ()
+                              { assign (mfRationalise (fNumerator, fDenominator)); }
 
     // arithmetic
 
-    mfWholeNotes          inverse () const;
-    mfWholeNotes          opposite () const;
+    constexpr mfWholeNotes
+                          inverse () const;
+    constexpr mfWholeNotes
+                          opposite () const;
 
-    mfWholeNotes          operator + (const mfWholeNotes &wholeNotes) const;
-    mfWholeNotes          operator - (const mfWholeNotes &wholeNotes) const;
+    constexpr mfWholeNotes
+                          operator + (const mfWholeNotes &wholeNotes) const;
+    constexpr mfWholeNotes
+                          operator - (const mfWholeNotes &wholeNotes) const;
 
     //! Useful for notes with dots.
-    mfWholeNotes          operator * (const mfRational &rat) const;
-    mfWholeNotes          operator / (const mfRational &rat) const;
+    constexpr mfWholeNotes
+                          operator * (const mfRational &rat) const;
+    constexpr mfWholeNotes
+                          operator / (const mfRational &rat) const;
     // (i.e. wholeNotes * 3/2 or wholeNotes * 7/4)
 
-    mfWholeNotes          operator * (int num) const;
-    mfWholeNotes          operator / (int num) const;
+    constexpr mfWholeNotes
+                          operator * (int num) const;
+    constexpr mfWholeNotes
+                          operator / (int num) const;
 
-    mfRational            operator / (const mfWholeNotes &wholeNotes) const;
+    constexpr mfRational  operator / (const mfWholeNotes &wholeNotes) const;
 
-    mfWholeNotes&         operator += (const mfWholeNotes &wholeNotes);
-    mfWholeNotes&         operator -= (const mfWholeNotes &wholeNotes);
+    constexpr mfWholeNotes&
+                          operator += (const mfWholeNotes &wholeNotes);
+    constexpr mfWholeNotes&
+                          operator -= (const mfWholeNotes &wholeNotes);
 
     //! Useful for notes with dots.
-    mfWholeNotes&         operator *= (const mfRational &rat);
-    mfWholeNotes&         operator /= (const mfRational &rat);
+    constexpr mfWholeNotes&
+                          operator *= (const mfRational &rat);
+    constexpr mfWholeNotes&
+                          operator /= (const mfRational &rat);
     // (i.e. wholeNotes * 3/2 or wholeNotes * 7/4)
 
-    mfWholeNotes&         operator *= (int num)
+    constexpr mfWholeNotes&
+                          operator *= (int num)
                               { fNumerator *= num; return *this; }
-    mfWholeNotes&         operator /= (int num)
+    constexpr mfWholeNotes&
+                          operator /= (int num)
                               { fDenominator *= num; return *this; }
 
     // assignment
 
-    mfWholeNotes&         operator = (const mfWholeNotes& wholeNotes);
+    constexpr mfWholeNotes&
+                          operator = (const mfWholeNotes& wholeNotes) = default;
 
     // comparisons
-    Bool                  operator >  (const mfWholeNotes &wholeNotes) const;
-    Bool                  operator >= (const mfWholeNotes &wholeNotes) const
-                              {return !(*this < wholeNotes);}
-    Bool                  operator <  (const mfWholeNotes &wholeNotes) const;
-    Bool                  operator <= (const mfWholeNotes &wholeNotes) const
-                              {return !(*this > wholeNotes);}
-
-    Bool                  operator == (const mfWholeNotes &wholeNotes) const;
-    Bool                  operator != (const mfWholeNotes &wholeNotes) const
-                              {return !(*this == wholeNotes);}
-
-    Bool                  operator >  (double num) const;
-    Bool                  operator >= (double num) const;
-    Bool                  operator <  (double num) const;
-    Bool                  operator <= (double num) const;
-    Bool                  operator == (double) const;
+    constexpr bool        operator >  (const mfWholeNotes &wholeNotes) const
+                              { return compare (wholeNotes) > 0; }
+    constexpr bool        operator >= (const mfWholeNotes &wholeNotes) const
+                              { return compare (wholeNotes) >= 0; }
+    constexpr bool        operator <  (const mfWholeNotes &wholeNotes) const
+                              { return compare (wholeNotes) < 0; }
+    constexpr bool        operator <= (const mfWholeNotes &wholeNotes) const
+                              { return compare (wholeNotes) <= 0; }
+
+    constexpr bool        operator == (const mfWholeNotes &wholeNotes) const
+                              { return compare (wholeNotes) == 0; }
+    constexpr bool        operator != (const mfWholeNotes &wholeNotes) const
+                              { return compare (wholeNotes) != 0; }
+
+    bool                  operator >  (double num) const
+                              { return toDouble () > num; }
+    bool                  operator >= (double num) const
+                              { return toDouble () >= num; }
+    bool                  operator <  (double num) const
+                              { return toDouble () < num; }
+    bool                  operator <= (double num) const
+                              { return toDouble () <= num; }
+    bool                  operator == (double num) const
+                              { return toDouble () == num; }
 
     // conversions
 
@@ -194,7 +220,13 @@ class EXP mfWholeNotes
                           operator int () const;
 
     std::string           toString () const;
-    double                toDouble () const;
+    double                toDouble () const
+                              {
+                                return
+                                  fDenominator != 0
+                                    ? (double) fNumerator / (double) fDenominator
+                                    : 0;
+                              }
     float                 toFloat () const;
     int                   toInt () const;
 
@@ -216,6 +248,20 @@ class EXP mfWholeNotes
     // private methods
     // ------------------------------------------------------
 
+    constexpr void        assign (mfRationalParts parts)
+                              {
+                                fNumerator = parts.fNumerator;
+                                fDenominator = parts.fDenominator;
+                              }
+
+    constexpr int         compare (const mfWholeNotes& wholeNotes) const
+                              {
+                                return
+                                  mfRationalCompare (
+                                    fNumerator, fDenominator,
+                                    wholeNotes.fNumerator, wholeNotes.fDenominator);
+                              }
+
   private:
 
     // private fields
@@ -225,6 +271,140 @@ class EXP mfWholeNotes
     int                   fDenominator;
 };
 
+static_assert (std::is_trivially_copyable_v<mfWholeNotes>);
+
+// called only when a constructor is supplied a denominator that is not positive
+EXP void mfDenominatorIsNotPositive (
+  const std::string& typeName,
+  int                denominator);
+
+constexpr mfWholeNotes::mfWholeNotes (
+  int numerator,
+  int denominator)
+{
+#ifdef MF_SANITY_CHECKS_ARE_ENABLED
+  // sanity check
+  if (denominator <= 0) {
+    mfDenominatorIsNotPositive ("mfWholeNotes", denominator);
+  }
+#endif // MF_SANITY_CHECKS_ARE_ENABLED
+
+  assign (mfRationalise (numerator, denominator));
+}
+
+constexpr mfWholeNotes mfWholeNotes::inverse () const
+{
+  mfWholeNotes result;
+
+  result.assign (mfRationalise (fDenominator, fNumerator));
+
+  return result;
+}
+
+constexpr mfWholeNotes mfWholeNotes::opposite () const
+{
+  mfWholeNotes result;
+
+  result.assign (mfRationalise (- (long long) fNumerator, fDenominator));
+
+  return result;
+}
+
+constexpr mfWholeNotes mfWholeNotes::operator + (
+  const mfWholeNotes &wholeNotes) const
+{
+  mfWholeNotes result (*this);
+
+  return result += wholeNotes;
+}
+
+constexpr mfWholeNotes mfWholeNotes::operator - (
+  const mfWholeNotes &wholeNotes) const
+{
+  mfWholeNotes result (*this);
+
+  return result -= wholeNotes;
+}
+
+constexpr mfWholeNotes mfWholeNotes::operator * (const mfRational &rat) const
+{
+  mfWholeNotes result (*this);
+
+  return result *= rat;
+}
+
+constexpr mfWholeNotes mfWholeNotes::operator / (const mfRational &rat) const
+{
+  mfWholeNotes result (*this);
+
+  return result /= rat;
+}
+
+constexpr mfWholeNotes mfWholeNotes::operator * (int num) const
+{
+  return (*this) * mfRational (num, 1);
+}
+
+constexpr mfWholeNotes mfWholeNotes::operator / (int num) const
+{
+  return (*this) / mfRational (num, 1);
+}
+
+constexpr mfRational mfWholeNotes::operator / (
+  const mfWholeNotes &wholeNotes) const
+{
+  mfRationalParts
+    parts =
+      mfRationalProduct (
+        fNumerator, fDenominator,
+        wholeNotes.fDenominator, wholeNotes.fNumerator);
+
+  return
+    mfRational (parts.fNumerator, parts.fDenominator);
+}
+
+constexpr mfWholeNotes& mfWholeNotes::operator += (
+  const mfWholeNotes &wholeNotes)
+{
+  assign (
+    mfRationalSum (
+      fNumerator, fDenominator,
+      wholeNotes.fNumerator, wholeNotes.fDenominator));
+
+  return (*this);
+}
+
+constexpr mfWholeNotes& mfWholeNotes::operator -= (
+  const mfWholeNotes &wholeNotes)
+{
+  assign (
+    mfRationalSum (
+      fNumerator, fDenominator,
+      - (long long) wholeNotes.fNumerator, wholeNotes.fDenominator));
+
+  return (*this);
+}
+
+constexpr mfWholeNotes& mfWholeNotes::operator *= (const mfRational &rat)
+{
+  assign (
+    mfRationalProduct (
+      fNumerator, fDenominator,
+      rat.getNumerator (), rat.getDenominator ()));
+
+  return (*this);
+}
+
+constexpr mfWholeNotes& mfWholeNotes::operator /= (const mfRational &rat)
+{
+  assign (
+    mfRationalProduct (
+      fNumerator, fDenominator,
+      rat.getDenominator (), rat.getNumerator ()));
+
+  return (*this);
+}
+
 EXP std::ostream& operator << (std::ostream& os, const mfWholeNotes& wholeNotes);
 EXP mfIndentedStringStream& operator << (
   mfIndentedStringStream& iss, const mfWholeNotes& wholeNotes);
@@ -462,9 +642,15 @@ class EXP mfPositionInMeasure
 {
   public:
 
-    static mfPositionInMeasure
+    static constexpr mfPositionInMeasure
                           createFromWholeNotes (
-                            const mfWholeNotes& wholeNotes);
+                            const mfWholeNotes& wholeNotes)
+                              {
+                                return
+                                  mfPositionInMeasure (
+                                    wholeNotes.getNumerator (),
+                                    wholeNotes.getDenominator ());
+                              }
 
   public:
 
@@ -476,35 +662,36 @@ class EXP mfPositionInMeasure
   can lead to nasty, hard to locate bugs (this occurrend once...),
   so there is no constructor with 1 'int' argument
 */
-                          mfPositionInMeasure ();
+    constexpr             mfPositionInMeasure ()
+                              : fNumerator (0),
+                                fDenominator (1)
+                              {}
 
-                          mfPositionInMeasure (
+    constexpr             mfPositionInMeasure (
                             int numerator,
                             int denominator);
 
-                          mfPositionInMeasure (
-                            const mfPositionInMeasure& positionInMeasure);
+    constexpr             mfPositionInMeasure (
+                            const mfPositionInMeasure& positionInMeasure) = default;
 
                           mfPositionInMeasure (const std::string& theString);
 
-    virtual               ~mfPositionInMeasure ();
-
   public:
 
     // set and get
     // ------------------------------------------------------
 
-    void                  setNumerator (int num)
+    constexpr void        setNumerator (int num)
                               { fNumerator = num; }
-    int                   getNumerator ()  const
+    constexpr int         getNumerator ()  const
                               { return fNumerator; }
 
-    void                  setDenominator (int denom)
+    constexpr void        setDenominator (int denom)
                               { fDenominator = denom; }
-    int                   getDenominator () const
+    constexpr int         getDenominator () const
                               { return fDenominator; }
 
-    void                  set (int num, int denom)
+    constexpr void        set (int num, int denom)
                               { fNumerator = num; fDenominator = denom; }
 
   public:
@@ -514,52 +701,94 @@ class EXP mfPositionInMeasure
 
     // 'rationalise' mfPositionInMeasure values
 
-    void                  rationalise ();
+    constexpr void        rationalise ()
+                              { assign (mfRationalise (fNumerator, fDenominator)); }
 
     // arithmetic
 
-    mfPositionInMeasure   inverse () const;
-    mfPositionInMeasure   opposite () const;
-
-    mfPositionInMeasure   operator + (const mfWholeNotes &wholeNotes) const;
-    mfPositionInMeasure   operator - (const mfWholeNotes &wholeNotes) const;
-
-    mfPositionInMeasure&  operator += (const mfWholeNotes &wholeNotes);
-    mfPositionInMeasure&  operator -= (const mfWholeNotes &wholeNotes);
-
-    mfWholeNotes          operator - (
-                            const mfPositionInMeasure &positionInMeasure) const;
+    constexpr mfPositionInMeasure
+                          operator + (const mfWholeNotes &wholeNotes) const
+                              {
+                                mfPositionInMeasure result (*this);
+                                return result += wholeNotes;
+                              }
+    constexpr mfPositionInMeasure
+                          operator - (const mfWholeNotes &wholeNotes) const
+                              {
+                                mfPositionInMeasure result (*this);
+                                return result -= wholeNotes;
+                              }
+
+    constexpr mfPositionInMeasure&
+                          operator += (const mfWholeNotes &wholeNotes)
+                              {
+                                assign (
+                                  mfRationalSum (
+                                    fNumerator, fDenominator,
+                                    wholeNotes.getNumerator (),
+                                    wholeNotes.getDenominator ()));
+                                return *this;
+                              }
+    constexpr mfPositionInMeasure&
+                          operator -= (const mfWholeNotes &wholeNotes)
+                              {
+                                assign (
+                                  mfRationalSum (
+                                    fNumerator, fDenominator,
+                                    - (long long) wholeNotes.getNumerator (),
+                                    wholeNotes.getDenominator ()));
+                                return *this;
+                              }
+
+    constexpr mfWholeNotes
+                          operator - (
+                            const mfPositionInMeasure &positionInMeasure) const
+                              {
+                                return
+                                  asWholeNotes ()
+                                    -
+                                  positionInMeasure.asWholeNotes ();
+                              }
 
     // assignment
 
-    mfPositionInMeasure&  operator = (
-                            const mfPositionInMeasure& positionInMeasure);
+    constexpr mfPositionInMeasure&
+                          operator = (
+                            const mfPositionInMeasure& positionInMeasure) = default;
 
     // comparisons
 
-    Bool                  operator >  (
-                            const mfPositionInMeasure& positionInMeasure) const;
-    Bool                  operator >= (
+    constexpr bool        operator >  (
                             const mfPositionInMeasure& positionInMeasure) const
-                              { return !(*this < positionInMeasure);}
-
-    Bool                  operator <  (
-                            const mfPositionInMeasure& positionInMeasure) const;
-    Bool                  operator <= (
+                              { return compare (positionInMeasure) > 0; }
+    constexpr bool        operator >= (
                             const mfPositionInMeasure& positionInMeasure) const
-                              { return !(*this > positionInMeasure);}
+                              { return compare (positionInMeasure) >= 0; }
 
-    Bool                  operator == (
-                            const mfPositionInMeasure& positionInMeasure) const;
-    Bool                  operator != (
+    constexpr bool        operator <  (
                             const mfPositionInMeasure& positionInMeasure) const
-                              { return !(*this == positionInMeasure);}
+                              { return compare (positionInMeasure) < 0; }
+    constexpr bool        operator <= (
+                            const mfPositionInMeasure& positionInMeasure) const
+                              { return compare (positionInMeasure) <= 0; }
 
-    Bool                  operator >  (double num) const;
-    Bool                  operator >= (double num) const;
-    Bool                  operator <  (double num) const;
-    Bool                  operator <= (double num) const;
-    Bool                  operator == (double) const;
+    constexpr bool        operator == (
+                            const mfPositionInMeasure& positionInMeasure) const
+                              { return compare (positionInMeasure) == 0; }
+    constexpr bool        operator != (
+                            const mfPositionInMeasure& positionInMeasure) const
+                              { return compare (positionInMeasure) != 0; }
+
+    bool                  operator >  (double num) const
+                              { return toDouble () > num; }
+    bool                  operator >= (double num) const
+                              { return toDouble () >= num; }
+    bool                  operator <  (double num) const
+                              { return toDouble () < num; }
+    bool                  operator <= (double num) const
+                              { return toDouble () <= num; }
+    bool                  operator == (double num) const
+                              { return toDouble () == num; }
 
     // conversions
 
@@ -569,11 +798,19 @@ class EXP mfPositionInMeasure
                           operator int () const;
 
     std::string           toString () const;
-    double                toDouble () const;
+    double                toDouble () const
+                              {
+                                return
+                                  fDenominator != 0
+                                    ? (double) fNumerator / (double) fDenominator
+                                    : 0;
+                              }
     float                 toFloat () const;
     int                   toInt () const;
 
-    mfWholeNotes          asWholeNotes () const;
+    constexpr mfWholeNotes
+                          asWholeNotes () const
+                              { return mfWholeNotes (fNumerator, fDenominator); }
 
   public:
 
@@ -593,6 +830,20 @@ class EXP mfPositionInMeasure
     // private methods
     // ------------------------------------------------------
 
+    constexpr void        assign (mfRationalParts parts)
+                              {
+                                fNumerator = parts.fNumerator;
+                                fDenominator = parts.fDenominator;
+                              }
+
+    constexpr int         compare (const mfPositionInMeasure& positionInMeasure) const
+                              {
+                                return
+                                  mfRationalCompare (
+                                    fNumerator, fDenominator,
+                                    positionInMeasure.fNumerator, positionInMeasure.fDenominator);
+                              }
+
   private:
 
     // private fields
@@ -602,6 +853,22 @@ class EXP mfPositionInMeasure
     int                   fDenominator;
 };
 
+static_assert (std::is_trivially_copyable_v<mfPositionInMeasure>);
+
+constexpr mfPositionInMeasure::mfPositionInMeasure (
+  int numerator,
+  int denominator)
+{
+#ifdef MF_SANITY_CHECKS_ARE_ENABLED
+  // sanity check
+  if (denominator <= 0) {
+    mfDenominatorIsNotPositive ("mfPositionInMeasure", denominator);
+  }
+#endif // MF_SANITY_CHECKS_ARE_ENABLED
+
+  assign (mfRationalise (numerator, denominator));
+}
+
 EXP std::ostream& operator << (
   std::ostream&              os,
   const mfPositionInMeasure& positionInMeasure);
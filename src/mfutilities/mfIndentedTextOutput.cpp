@@ -9,6 +9,7 @@
   https://github.com/jacques-menu/musicformats
 */
 
+#include <cstring>      // std::memcpy, std::memmove
 #include <iomanip>      // std::setw, std::setprecision, ...
 
 #include "mfAssert.h"
@@ -314,12 +315,14 @@ std::ostream& operator << (std::ostream& os, const mfOutputIndenter& theIndenter
 //______________________________________________________________________________
 S_mfIndentedOstream mfIndentedOstream::create (
   std::ostream&     theOStream,
-  mfOutputIndenter& theIndenter)
+  mfOutputIndenter& theIndenter,
+  Bool              flushAtEachEndOfLine)
 {
   mfIndentedOstream* obj =
     new mfIndentedOstream (
       theOStream,
-      theIndenter);
+      theIndenter,
+      flushAtEachEndOfLine);
   assert (obj != nullptr);
 
   return obj;
@@ -327,62 +330,182 @@ S_mfIndentedOstream mfIndentedOstream::create (
 
 mfIndentedOstream::mfIndentedOstream (
   std::ostream&     theOStream,
-  mfOutputIndenter& theIndenter)
+  mfOutputIndenter& theIndenter,
+  Bool              flushAtEachEndOfLine)
     : std::ostream (
         & fIndentedOStreamBuf),
       fIndentedOStreamBuf (
         theOStream,
-        theIndenter)
+        theIndenter,
+        flushAtEachEndOfLine)
 {}
 
+//______________________________________________________________________________
+// the block buffer is written to the actual output stream
+// when it contains at least that many characters
+const size_t K_MF_INDENTED_OSTREAM_BUF_THRESHOLD = 64 * 1024;
+
 mfIndentedOStreamBuf::mfIndentedOStreamBuf (
   std::ostream&     outputStream,
-  mfOutputIndenter& theIndenter)
+  mfOutputIndenter& theIndenter,
+  Bool              flushAtEachEndOfLine)
     : fOutputOStream (
         outputStream),
       fOutputIndenter (
-        theIndenter)
-{}
+        theIndenter),
+      fFlushAtEachEndOfLine (
+        flushAtEachEndOfLine)
+{
+  fBlockBuffer.resize (
+    fFlushAtEachEndOfLine
+      ? 256
+      : 2 * K_MF_INDENTED_OSTREAM_BUF_THRESHOLD);
+
+  setp (
+    fBlockBuffer.data (),
+    fBlockBuffer.data () + fBlockBuffer.size ());
+
+  fCurrentLineStart = 0;
+}
+
+mfIndentedOStreamBuf::~mfIndentedOStreamBuf ()
+{
+  // don't lose a last line not terminated by std::endl
+  if (pptr () - pbase () > (std::ptrdiff_t) fCurrentLineStart) {
+    sync ();
+  }
+
+  flush ();
+}
+
+std::streambuf::int_type mfIndentedOStreamBuf::overflow (int_type theChar)
+{
+  // the put area is full: grow the block buffer,
+  // keeping its contents and the current put position
+  size_t usedSize = pptr () - pbase ();
+
+  fBlockBuffer.resize (2 * fBlockBuffer.size ());
+
+  setp (
+    fBlockBuffer.data (),
+    fBlockBuffer.data () + fBlockBuffer.size ());
+  pbump ((int) usedSize);
+
+  if (! traits_type::eq_int_type (theChar, traits_type::eof ())) {
+    *pptr () = traits_type::to_char_type (theChar);
+    pbump (1);
+  }
+
+  return traits_type::not_eof (theChar);
+}
 
-//______________________________________________________________________________
 int mfIndentedOStreamBuf::sync ()
 {
-  // When we sync the stream with fOutputOStream:
-  // 1) output the indentation then the buffer
-  // 2) reset the buffer
-  // 3) flush the actual output stream we are using.
+  // When std::endl syncs the stream, the current line,
+  // i.e. the end of the block buffer from fCurrentLineStart on:
+  // 1) is prefixed with the indentation
+  // 2) has a single trailing space before the end of line removed
+  // 3) becomes part of the complete lines to be written
 
-  size_t strSize = str ().size ();
+  size_t usedSize = pptr () - pbase ();
+  size_t lineSize = usedSize - fCurrentLineStart;
 
-  // fetch the last non-space character in the buffer
-  // caution: the std::endl is present as the last character!
-  size_t found = str ().find_last_not_of (' ', strSize - 2);
+  // compute the indentation
+  const std::string& spacer = fOutputIndenter.getSpacer ();
+
+  int    indentation = fOutputIndenter.getIndentation ();
+  size_t spacersSize =
+    indentation > 0
+      ? spacer.size () * indentation
+      : 0;
 
-  // this can be uncommented to see low level informations
-  // fOutputOStream << "% strSize: " << strSize << ", found: " << found << std::endl;
+  // make room for the spacers if needed
+  while (usedSize + spacersSize > fBlockBuffer.size ()) {
+    overflow (traits_type::eof ());
+  } // while
+
+  char* lineStart = pbase () + fCurrentLineStart;
+
+  if (spacersSize) {
+    // shift the line contents to the right
+    std::memmove (
+      lineStart + spacersSize,
+      lineStart,
+      lineSize);
 
-  // output the spacers
-  fOutputIndenter.printSpacers (fOutputOStream);
+    // insert the spacers
+    char* spacersPosition = lineStart;
 
-  // output the buffer
-  if (found == strSize - 3) {
-    // don't output the trailing spaces, but output the end of line
-    fOutputOStream << str ().substr (0, found + 1) << std::endl;
+    for (int i = 0; i < indentation; ++i) {
+      std::memcpy (
+        spacersPosition,
+        spacer.data (),
+        spacer.size ());
+      spacersPosition += spacer.size ();
+    } // for
+
+    pbump ((int) spacersSize);
   }
-  else {
-    // output the whole buffer
-    fOutputOStream << str ();
+
+  // caution: the std::endl is present as the last character!
+  // don't output a single trailing space, but output the end of line
+  char* lineEnd = pptr ();
+
+  if (
+    lineSize >= 2
+      &&
+    lineEnd [-2] == ' '
+      &&
+    (lineSize == 2 || lineEnd [-3] != ' ')
+  ) {
+    lineEnd [-2] = '\n';
+    pbump (-1);
   }
 
-  // reset the buffer
-  str ("");
+  // the current line is now complete
+  fCurrentLineStart = pptr () - pbase ();
 
-  // flush the output stream
-  fOutputOStream.flush ();
+  if (fFlushAtEachEndOfLine) {
+    flush ();
+  }
+  else if (fCurrentLineStart >= K_MF_INDENTED_OSTREAM_BUF_THRESHOLD) {
+    writeCompleteLines ();
+  }
 
   return 0;
 }
 
+void mfIndentedOStreamBuf::writeCompleteLines ()
+{
+  // write the complete lines to the actual output stream
+  fOutputOStream.write (
+    pbase (),
+    fCurrentLineStart);
+
+  // move the current line contents if any to the start of the block buffer
+  size_t currentLineSize = (pptr () - pbase ()) - fCurrentLineStart;
+
+  std::memmove (
+    pbase (),
+    pbase () + fCurrentLineStart,
+    currentLineSize);
+
+  setp (
+    fBlockBuffer.data (),
+    fBlockBuffer.data () + fBlockBuffer.size ());
+  pbump ((int) currentLineSize);
+
+  fCurrentLineStart = 0;
+}
+
+void mfIndentedOStreamBuf::flush ()
+{
+  writeCompleteLines ();
+
+  // flush the output stream
+  fOutputOStream.flush ();
+}
+
 //______________________________________________________________________________
 S_mfIndentedStringStream mfIndentedStringStream::create ()
 {
@@ -543,15 +666,19 @@ void createTheGlobalIndentedOstreams (
   std::ostream& theOutputStream,
   std::ostream& theLogStream)
 {
+  // these two are flushed at each end of line,
+  // since direct writes to the same streams are interleaved with them
   pGlobalOutputIndentedOstream =
     mfIndentedOstream::create (
       theOutputStream,
-      pGlobalOutputIndenter);
+      pGlobalOutputIndenter,
+      true); // flushAtEachEndOfLine
 
   pGlobalLogIndentedOstream =
     mfIndentedOstream::create (
       theLogStream,
-      pGlobalOutputIndenter);
+      pGlobalOutputIndenter,
+      true); // flushAtEachEndOfLine
 }
 
 
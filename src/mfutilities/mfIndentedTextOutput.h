@@ -13,7 +13,8 @@
 #define ___mfIndentedTextOutput___
 
 #include <cassert>
-#include <sstream>   // for std::stringbuf
+#include <sstream>   // for std::stringstream
+#include <vector>
 
 #include "exports.h"
 #include "smartpointer.h"
@@ -147,24 +148,55 @@ Reference for this class:
   https://stackoverflow.com/questions/2212776/overload-handling-of-stdendl
 */
 
-class EXP mfIndentedOStreamBuf: public std::stringbuf
+/*
+  The indented lines are accumulated in a growable block buffer,
+  which is written to the actual output stream only when it is full,
+  when flush () is called or when the buffer is destroyed.
+
+  The indentation is that of fOutputIndenter when the line is terminated,
+  i.e. when std::endl calls sync (), since the translators often
+  change it after having written the start of a line.
+
+  When flushAtEachEndOfLine is true, the block buffer is written
+  and the actual output stream is flushed at each std::endl,
+  which is what the log and output streams need, since they are interleaved
+  with direct writes to std::cerr and std::cout
+*/
+
+class EXP mfIndentedOStreamBuf: public std::streambuf
 {
   public:
 
-    // constructor
+    // constructor/destructor
                           mfIndentedOStreamBuf (
                             std::ostream&     outputStream,
-                            mfOutputIndenter& theIndenter);
+                            mfOutputIndenter& theIndenter,
+                            Bool              flushAtEachEndOfLine = false);
+
+    virtual               ~mfIndentedOStreamBuf ();
 
     // indentation
     mfOutputIndenter&     getOutputIndenter () const
                               { return fOutputIndenter; }
 
     // flush
-    void                  flush ()
-                              { fOutputOStream.flush (); }
+    void                  flush ();
+
+  protected:
+
+    // std::streambuf overrides
+    // ------------------------------------------------------
 
-    virtual int           sync ();
+    int_type              overflow (int_type theChar) override;
+
+    int                   sync () override;
+
+  private:
+
+    // private services
+    // ------------------------------------------------------
+
+    void                  writeCompleteLines ();
 
   private:
 
@@ -174,6 +206,12 @@ class EXP mfIndentedOStreamBuf: public std::stringbuf
     std::ostream&         fOutputOStream;
     mfOutputIndenter&     fOutputIndenter;
 
+    Bool                  fFlushAtEachEndOfLine;
+
+    // the put area spans this whole block buffer,
+    // the current line starts at fCurrentLineStart in it
+    std::vector<char>     fBlockBuffer;
+    size_t                fCurrentLineStart;
 };
 
 //______________________________________________________________________________
@@ -199,14 +237,16 @@ Usage:
 
     static SMARTP<mfIndentedOstream> create (
                             std::ostream&     theOStream,
-                            mfOutputIndenter& theIndenter);
+                            mfOutputIndenter& theIndenter,
+                            Bool              flushAtEachEndOfLine = false);
 
     // constructors/destructor
     // ------------------------------------------------------
 
                           mfIndentedOstream (
                             std::ostream&     theOStream,
-                            mfOutputIndenter& theIndenter);
+                            mfOutputIndenter& theIndenter,
+                            Bool              flushAtEachEndOfLine = false);
 
     virtual               ~mfIndentedOstream () {};
 
@@ -215,7 +255,7 @@ Usage:
     // public services
     // ------------------------------------------------------
 
-    // flush
+    // flush, writing the buffered lines to the actual output stream
     void                  flush ()
                               { fIndentedOStreamBuf.flush (); }
 
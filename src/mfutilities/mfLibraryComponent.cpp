@@ -146,6 +146,10 @@ S_mfcLibraryComponent createLibraryComponent ()
       appendConverterToMultiComponent (
         createMusicxml2guidoConverterComponent ());
 
+    pLibraryComponent->
+      appendConverterToMultiComponent (
+        createMusicxml2allConverterComponent ());
+
 
     pLibraryComponent->
       appendConverterToMultiComponent (
@@ -45,55 +45,30 @@ mfMoment::mfMoment (
   fSoundingRelativeOffset = K_WHOLE_NOTES_ZERO;
 }
 
-mfMoment::~mfMoment ()
-{}
-
-Bool mfMoment::operator== (const mfMoment& other) const
+bool mfMoment::operator== (const mfMoment& other) const
 {
-  Bool result;
-
-  if (fWrittenPositionInMeseasure != other.fWrittenPositionInMeseasure) {
-    result = false;
-  }
-  else {
-    result = fSoundingRelativeOffset == other.fSoundingRelativeOffset;
-  }
-
-  return result;
+  return
+    fWrittenPositionInMeseasure == other.fWrittenPositionInMeseasure
+      &&
+    fSoundingRelativeOffset == other.fSoundingRelativeOffset;
 }
 
-Bool mfMoment::operator< (const mfMoment& other) const
+bool mfMoment::operator< (const mfMoment& other) const
 {
-  Bool result;
-
-  if (fWrittenPositionInMeseasure > other.fWrittenPositionInMeseasure) {
-    result = false;
-  }
-  else if (fWrittenPositionInMeseasure == other.fWrittenPositionInMeseasure) {
-    result = fSoundingRelativeOffset < other.fSoundingRelativeOffset;
-  }
-  else {
-    result = true;
+  if (fWrittenPositionInMeseasure != other.fWrittenPositionInMeseasure) {
+    return fWrittenPositionInMeseasure < other.fWrittenPositionInMeseasure;
   }
 
-  return result;
+  return fSoundingRelativeOffset < other.fSoundingRelativeOffset;
 }
 
-Bool mfMoment::operator> (const mfMoment& other) const
+bool mfMoment::operator> (const mfMoment& other) const
 {
-  Bool result;
-
-  if (fWrittenPositionInMeseasure < other.fWrittenPositionInMeseasure) {
-    result = false;
-  }
-  else if (fWrittenPositionInMeseasure == other.fWrittenPositionInMeseasure) {
-    result = fSoundingRelativeOffset > other.fSoundingRelativeOffset;
-  }
-  else {
-    result = true;
+  if (fWrittenPositionInMeseasure != other.fWrittenPositionInMeseasure) {
+    return fWrittenPositionInMeseasure > other.fWrittenPositionInMeseasure;
   }
 
-  return result;
+  return fSoundingRelativeOffset > other.fSoundingRelativeOffset;
 }
 
 std::string mfMoment::asString () const
@@ -50,8 +50,6 @@ class EXP mfMoment
                           mfMoment (
                             const mfPositionInMeasure& writtenPositionInMeasure);
 
-    virtual               ~mfMoment ();
-
   public:
 
     // set and get
@@ -74,19 +72,19 @@ class EXP mfMoment
     // public services
     // ------------------------------------------------------
 
-    Bool                  operator== (const mfMoment& other) const;
+    bool                  operator== (const mfMoment& other) const;
 
-    Bool                  operator!= (const mfMoment& other) const
+    bool                  operator!= (const mfMoment& other) const
                               { return ! ((*this) == other); }
 
-    Bool                  operator< (const mfMoment& other) const;
+    bool                  operator< (const mfMoment& other) const;
 
-    Bool                  operator>= (const mfMoment& other) const
+    bool                  operator>= (const mfMoment& other) const
                               { return ! ((*this) < other); }
 
-    Bool                  operator> (const mfMoment& other) const;
+    bool                  operator> (const mfMoment& other) const;
 
-    Bool                  operator<= (const mfMoment& other) const
+    bool                  operator<= (const mfMoment& other) const
                               { return ! ((*this) > other); }
 
   public:
@@ -107,7 +105,7 @@ class EXP mfMoment
 
     std::string           asString () const;
 
-    virtual void          print (std::ostream& os) const;
+    void                  print (std::ostream& os) const;
 
   private:
 
@@ -117,6 +115,9 @@ class EXP mfMoment
     mfPositionInMeasure   fWrittenPositionInMeseasure;
     mfWholeNotes          fSoundingRelativeOffset;
 };
+
+static_assert (std::is_trivially_copyable_v<mfMoment>);
+
 EXP std::ostream& operator << (std::ostream& os, const mfMoment& elt);
 
 //______________________________________________________________________________
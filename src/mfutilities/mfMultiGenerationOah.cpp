@@ -338,7 +338,7 @@ void mfMultiGenerationOutputKindAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_mfMultiGenerationOutputKindAtom>*
     p =
-      dynamic_cast<visitor<S_mfMultiGenerationOutputKindAtom>*> (v)) {
+      visitor<S_mfMultiGenerationOutputKindAtom>::cast (v)) {
         S_mfMultiGenerationOutputKindAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -374,7 +374,7 @@ void mfMultiGenerationOutputKindAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_mfMultiGenerationOutputKindAtom>*
     p =
-      dynamic_cast<visitor<S_mfMultiGenerationOutputKindAtom>*> (v)) {
+      visitor<S_mfMultiGenerationOutputKindAtom>::cast (v)) {
         S_mfMultiGenerationOutputKindAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -632,7 +632,7 @@ void mfMultiGenerationOahGroup::acceptIn (basevisitor* v)
 
   if (visitor<S_multiGenerationOahGroup>*
     p =
-      dynamic_cast<visitor<S_multiGenerationOahGroup>*> (v)) {
+      visitor<S_multiGenerationOahGroup>::cast (v)) {
         S_multiGenerationOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -668,7 +668,7 @@ void mfMultiGenerationOahGroup::acceptOut (basevisitor* v)
 
   if (visitor<S_multiGenerationOahGroup>*
     p =
-      dynamic_cast<visitor<S_multiGenerationOahGroup>*> (v)) {
+      visitor<S_multiGenerationOahGroup>::cast (v)) {
         S_multiGenerationOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
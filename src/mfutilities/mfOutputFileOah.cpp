@@ -145,7 +145,7 @@ void outputFileOahGroup::acceptIn (basevisitor* v)
 
   if (visitor<S_outputFileOahGroup>*
     p =
-      dynamic_cast<visitor<S_outputFileOahGroup>*> (v)) {
+      visitor<S_outputFileOahGroup>::cast (v)) {
         S_outputFileOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -181,7 +181,7 @@ void outputFileOahGroup::acceptOut (basevisitor* v)
 
   if (visitor<S_outputFileOahGroup>*
     p =
-      dynamic_cast<visitor<S_outputFileOahGroup>*> (v)) {
+      visitor<S_outputFileOahGroup>::cast (v)) {
         S_outputFileOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
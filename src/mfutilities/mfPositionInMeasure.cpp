@@ -38,51 +38,6 @@
 namespace MusicFormats
 {
 //______________________________________________________________________________
-mfPositionInMeasure mfPositionInMeasure::createFromWholeNotes (
-  const mfWholeNotes& wholeNotes)
-{
-  return
-    mfPositionInMeasure (
-      wholeNotes.getNumerator (),
-      wholeNotes.getDenominator ());
-}
-
-mfPositionInMeasure::mfPositionInMeasure ()
-{
-  fNumerator = 0;
-  fDenominator = 1;
-}
-
-mfPositionInMeasure::mfPositionInMeasure (
-  int numerator,
-  int denominator)
-{
-#ifdef MF_SANITY_CHECKS_ARE_ENABLED
-  // sanity check
-//   mfAssert (
-//     __FILE__, mfInputLineNumber (__LINE__),
-//     numerator >= 0,
-//     "mfPositionInMeasure numerator '" + std::to_string (numerator) + "' should be positive or null");
-
-  mfAssert (
-    __FILE__, mfInputLineNumber (__LINE__),
-    denominator > 0,
-    "mfPositionInMeasure denominator '" + std::to_string (denominator) + "' should be positive");
-#endif // MF_SANITY_CHECKS_ARE_ENABLED
-
-  fNumerator = numerator;
-  fDenominator = denominator;
-
-  rationalise ();
-}
-
-mfPositionInMeasure::mfPositionInMeasure (
-  const mfPositionInMeasure& positionInMeasure)
-{
-  fNumerator = positionInMeasure.getNumerator ();
-  fDenominator = positionInMeasure.getDenominator ();
-}
-
 mfPositionInMeasure::mfPositionInMeasure (const std::string& theString)
 {
   // decipher theString
@@ -161,181 +116,6 @@ mfPositionInMeasure::mfPositionInMeasure (const std::string& theString)
   rationalise ();
 }
 
-mfPositionInMeasure::~mfPositionInMeasure ()
-{}
-
-mfPositionInMeasure mfPositionInMeasure::operator + (
-  const mfWholeNotes &wholeNotes) const
-{
-  mfPositionInMeasure
-    result (
-      fNumerator * wholeNotes.getDenominator ()
-        +
-      wholeNotes.getNumerator () * fDenominator,
-      fDenominator * wholeNotes.getDenominator ());
-
-  result.rationalise ();
-
-  return result;
-}
-
-mfPositionInMeasure mfPositionInMeasure::operator - (
-  const mfWholeNotes &wholeNotes) const
-{
-  mfPositionInMeasure
-    result (
-      fNumerator * wholeNotes.getDenominator ()
-        -
-      wholeNotes.getNumerator () * fDenominator,
-      fDenominator * wholeNotes.getDenominator ());
-
-  result.rationalise ();
-
-  return result;
-}
-
-mfPositionInMeasure& mfPositionInMeasure::operator += (
-  const mfWholeNotes &wholeNotes)
-{
-  if (fDenominator == wholeNotes.getDenominator ()) {
-    fNumerator += wholeNotes.getNumerator ();
-  }
-  else {
-    fNumerator =
-      fNumerator * wholeNotes.getDenominator ()
-        +
-    wholeNotes.getNumerator () * fDenominator;
-
-    fDenominator *=
-      wholeNotes.getDenominator ();
-  }
-
-  rationalise ();
-
-  return (*this);
-}
-
-mfPositionInMeasure& mfPositionInMeasure::operator -= (
-  const mfWholeNotes &wholeNotes)
-{
-  if (fDenominator == wholeNotes.getDenominator ()) {
-    fNumerator -= wholeNotes.getNumerator ();
-  }
-  else {
-    fNumerator =
-      fNumerator * wholeNotes.getDenominator ()
-        -
-      wholeNotes.getNumerator () * fDenominator;
-    fDenominator *= wholeNotes.getDenominator ();
-  }
-
-  rationalise ();
-
-  return (*this);
-}
-
-mfWholeNotes mfPositionInMeasure::operator - (
-  const mfPositionInMeasure &positionInMeasure) const
-{
-  mfWholeNotes
-    result (
-      fNumerator * positionInMeasure.getDenominator ()
-        -
-      positionInMeasure.getNumerator () * fDenominator,
-      fDenominator * positionInMeasure.getDenominator ());
-
-  result.rationalise ();
-
-  return result;
-}
-
-mfPositionInMeasure& mfPositionInMeasure::operator = (
-  const mfPositionInMeasure& positionInMeasure)
-{
-  fNumerator = positionInMeasure.fNumerator;
-  fDenominator = positionInMeasure.fDenominator;
-
-  return (*this);
-}
-
-Bool mfPositionInMeasure::operator > (
-  const mfPositionInMeasure& positionInMeasure) const
-{
-  // a/b > c/d if and only if a * d > b * c.
-  return
-    (
-      (fNumerator * positionInMeasure.fDenominator)
-        >
-      (fDenominator * positionInMeasure.fNumerator)
-    );
-}
-
-Bool mfPositionInMeasure::operator < (
-  const mfPositionInMeasure& positionInMeasure) const
-{
-  // a/b < c/d if and only if a * d < b * c.
-  return
-    (
-      (fNumerator * positionInMeasure.fDenominator)
-        <
-      (fDenominator * positionInMeasure.fNumerator)
-    );
-}
-
-Bool mfPositionInMeasure::operator == (
-  const mfPositionInMeasure& positionInMeasure) const
-{
-  // a/b == c/d if and only if a * d == b * c.
-  return
-    (
-      (fNumerator * positionInMeasure.fDenominator)
-        ==
-      (fDenominator * positionInMeasure.fNumerator)
-    );
-}
-
-Bool mfPositionInMeasure::operator > (double num) const
-{
-  return (toDouble() > num);
-}
-Bool mfPositionInMeasure::operator >= (double num) const
-{
-  return (toDouble() >= num);
-}
-Bool mfPositionInMeasure::operator < (double num) const
-{
-  return (toDouble() < num);
-}
-Bool mfPositionInMeasure::operator <= (double num) const
-{
-  return (toDouble() <= num);
-}
-Bool mfPositionInMeasure::operator == (double num) const
-{
-  return (toDouble() == num); }
-
-void mfPositionInMeasure::rationalise ()
-{
-  int g = std::gcd (fNumerator, fDenominator);
-
-  fNumerator   /= g;
-  fDenominator /= g;
-
-  if (fNumerator == 0) {
-    fDenominator = 1;
-  }
-  else if (fDenominator < 0) {
-    fNumerator = -fNumerator;
-    fDenominator = -fDenominator;
-  }
-}
-
-double mfPositionInMeasure::toDouble () const
-{
-  return
-    (fDenominator != 0) ? ((double)fNumerator/(double)fDenominator) : 0;
-}
-
 float mfPositionInMeasure::toFloat () const
 {
   return
@@ -370,12 +150,6 @@ mfPositionInMeasure::operator int () const
   return ((int) floor (x + 0.5f));
 }
 
-mfWholeNotes mfPositionInMeasure::asWholeNotes () const
-{
-  return
-    mfWholeNotes (fNumerator, fDenominator);
-}
-
 std::string mfPositionInMeasure::asShortString () const
 {
   std::stringstream ss;
@@ -32,31 +32,24 @@ namespace MusicFormats
 {
 
 //______________________________________________________________________________
-mfRational::mfRational (
-  int num,
-  int denom)
+void mfRationalOverflow (
+  long long numerator,
+  long long denominator)
 {
-#ifdef MF_SANITY_CHECKS_ARE_ENABLED
-  // sanity check
-if (false) // JMI 0.9.70
-  mfAssert (
-    __FILE__, mfInputLineNumber (__LINE__),
-    denom > 0,
-    "denom '" + std::to_string (denom) + "' is not positive");
-#endif // MF_SANITY_CHECKS_ARE_ENABLED
-
-  fNumerator = num;
-  fDenominator = denom;
+  std::stringstream ss;
 
-  rationalise ();
-}
+  ss <<
+    "rational value " <<
+    numerator << '/' << denominator <<
+    " overflows 'int' numerator or denominator";
 
-mfRational::mfRational(const mfRational& rat)
-{
-  fNumerator = rat.fNumerator;
-  fDenominator = rat.fDenominator;
+  msrWarning (
+    gServiceRunData->getInputSourceName (),
+    0, // JMI inputLineNumber, ??? 0.9.66
+    ss.str ());
 }
 
+//______________________________________________________________________________
 mfRational::mfRational (const std::string& theString)
 {
   // decipher theString
@@ -135,223 +128,6 @@ mfRational::mfRational (const std::string& theString)
   rationalise ();
 }
 
-mfRational::~mfRational ()
-{}
-
-mfRational mfRational::inverse () const
-{
-  mfRational
-    result (
-      fDenominator, fNumerator);
-
-  result.rationalise ();
-
-  return result;
-}
-
-mfRational mfRational::opposite () const
-{
-  mfRational
-    result (
-      -fNumerator, fDenominator);
-
-  result.rationalise ();
-
-  return result;
-}
-
-mfRational mfRational::operator + (const mfRational &rat) const
-{
-  mfRational
-    result (
-      fNumerator * rat.fDenominator + rat.fNumerator * fDenominator,
-       fDenominator * rat.fDenominator);
-
-  result.rationalise ();
-
-  return result;
-}
-
-mfRational mfRational::operator - (const mfRational &rat) const
-{
-  mfRational
-    result (
-      fNumerator * rat.fDenominator - rat.fNumerator * fDenominator,
-      fDenominator * rat.fDenominator);
-
-  result.rationalise ();
-
-  return result;
-}
-
-mfRational mfRational::operator * (const mfRational &rat) const
-{
-  mfRational
-    result (
-      fNumerator * rat.fNumerator,
-      fDenominator * rat.fDenominator);
-
-  result.rationalise ();
-
-  return result;
-}
-
-mfRational mfRational::operator / (const mfRational &rat) const
-{
-  mfRational
-    result (
-      fNumerator * rat.fDenominator,
-      fDenominator * rat.fNumerator);
-
-  result.rationalise ();
-
-  return result;
-}
-
-mfRational mfRational::operator * (int num) const
-{
-  mfRational
-    result (
-      fNumerator * num,
-      fDenominator);
-
-  result.rationalise ();
-
-  return result;
-}
-
-mfRational mfRational::operator / (int num) const
-{
-  mfRational
-    result (
-      fNumerator,
-      fDenominator * num);
-
-  result.rationalise ();
-
-  return result;
-}
-
-mfRational& mfRational::operator += (const mfRational &rat)
-{
-  if (fDenominator == rat.fDenominator) {
-    fNumerator += rat.fNumerator;
-  }
-  else {
-    fNumerator = fNumerator * rat.fDenominator + rat.fNumerator * fDenominator;
-    fDenominator *= rat.fDenominator;
-  }
-
-  rationalise ();
-
-  return (*this);
-}
-
-mfRational& mfRational::operator -= (const mfRational &rat)
-{
-  if (fDenominator == rat.fDenominator) {
-    fNumerator -= rat.fNumerator;
-  }
-  else {
-    fNumerator = fNumerator * rat.fDenominator - rat.fNumerator * fDenominator;
-    fDenominator *= rat.fDenominator;
-  }
-
-  rationalise ();
-
-  return (*this);
-}
-
-mfRational& mfRational::operator *= (const mfRational &rat)
-{
-  fNumerator   *= rat.fNumerator;
-  fDenominator *= rat.fDenominator;
-
-  rationalise ();
-
-  return (*this);
-}
-
-mfRational& mfRational::operator /= (const mfRational &rat)
-{
-  fNumerator   *= rat.fDenominator;
-  fDenominator *= rat.fNumerator;
-
-  rationalise ();
-
-  return (*this);
-}
-
-mfRational& mfRational::operator = (const mfRational& rat) {
-  fNumerator = rat.fNumerator;
-  fDenominator = rat.fDenominator;
-
-  return (*this);
-}
-
-Bool mfRational::operator > (const mfRational &rat) const
-{
-  // a/b > c/d if and only if a * d > b * c.
-  return
-    ((fNumerator * rat.fDenominator) > (fDenominator * rat.fNumerator));
-}
-
-Bool mfRational::operator < (const mfRational &rat) const
-{
-  // a/b < c/d if and only if a * d < b * c.
-  return
-    ((fNumerator * rat.fDenominator) < (fDenominator * rat.fNumerator));
-}
-
-Bool mfRational::operator == (const mfRational &rat) const
-{
-  // a/b < c/d if and only if a * d < b * c.
-  return
-    ((fNumerator * rat.fDenominator) == (fDenominator * rat.fNumerator));
-}
-
-Bool mfRational::operator > (double num) const
-{
-  return (toDouble() > num);
-}
-Bool mfRational::operator >= (double num) const
-{
-  return (toDouble() >= num);
-}
-Bool mfRational::operator < (double num) const
-{
-  return (toDouble() < num);
-}
-Bool mfRational::operator <= (double num) const
-{
-  return (toDouble() <= num);
-}
-Bool mfRational::operator == (double num) const
-{
-  return (toDouble() == num); }
-
-void mfRational::rationalise ()
-{
-  int g = std::gcd (fNumerator, fDenominator);
-
-  fNumerator   /= g;
-  fDenominator /= g;
-
-  if (fNumerator == 0) {
-    fDenominator = 1;
-  }
-  else if (fDenominator < 0) {
-    fNumerator = -fNumerator;
-    fDenominator = -fDenominator;
-  }
-}
-
-double mfRational::toDouble () const
-{
-  return
-    (fDenominator != 0) ? ((double)fNumerator/(double)fDenominator) : 0;
-}
-
 float mfRational::toFloat () const
 {
   return
@@ -12,8 +12,11 @@
 #ifndef ___mfRational___
 #define ___mfRational___
 
+#include <climits>      // INT_MIN, INT_MAX
+#include <numeric>      // gcd()
 #include <string>
 #include <ostream>
+#include <type_traits>
 
 #include "exports.h"
 
@@ -23,6 +26,100 @@
 namespace MusicFormats
 {
 
+//______________________________________________________________________________
+/*
+  the arithmetic core shared by mfRational, mfWholeNotes and mfPositionInMeasure:
+  the computations are done with 64-bit intermediate values,
+  and the rationalised results are checked to fit in 'int' fields
+*/
+struct mfRationalParts
+{
+  int                     fNumerator;
+  int                     fDenominator;
+};
+
+// called only when a rationalised result doesn't fit in 'int' fields:
+// it issues a warning at run time,
+// and makes such a computation fail to compile in constant expressions
+EXP void mfRationalOverflow (
+  long long numerator,
+  long long denominator);
+
+constexpr mfRationalParts mfRationalise (
+  long long numerator,
+  long long denominator)
+{
+  long long g = std::gcd (numerator, denominator);
+
+  if (g > 1) { // g is 0 only if both numerator and denominator are
+    numerator   /= g;
+    denominator /= g;
+  }
+
+  if (numerator == 0) {
+    denominator = 1;
+  }
+  else if (denominator < 0) {
+    numerator = -numerator;
+    denominator = -denominator;
+  }
+
+  if (
+    numerator < INT_MIN || numerator > INT_MAX
+      ||
+    denominator > INT_MAX
+  ) {
+    mfRationalOverflow (numerator, denominator);
+  }
+
+  return
+    mfRationalParts {
+      static_cast<int> (numerator),
+      static_cast<int> (denominator) };
+}
+
+constexpr mfRationalParts mfRationalSum (
+  long long numerator1,
+  long long denominator1,
+  long long numerator2,
+  long long denominator2)
+{
+  return
+    denominator1 == denominator2
+      ? mfRationalise (
+          numerator1 + numerator2,
+          denominator1)
+      : mfRationalise (
+          numerator1 * denominator2 + numerator2 * denominator1,
+          denominator1 * denominator2);
+}
+
+constexpr mfRationalParts mfRationalProduct (
+  long long numerator1,
+  long long denominator1,
+  long long numerator2,
+  long long denominator2)
+{
+  return
+    mfRationalise (
+      numerator1 * numerator2,
+      denominator1 * denominator2);
+}
+
+// a/b compared to c/d is a * d compared to b * c: -1, 0 or 1
+constexpr int mfRationalCompare (
+  long long numerator1,
+  long long denominator1,
+  long long numerator2,
+  long long denominator2)
+{
+  long long
+    left  = numerator1 * denominator2,
+    right = numerator2 * denominator1;
+
+  return (left > right) - (left < right);
+}
+
 //______________________________________________________________________________
 class EXP mfRational
 /*
@@ -36,33 +133,32 @@ class EXP mfRational
     // constructors/destructor
     // ------------------------------------------------------
 
-                          mfRational (
+    constexpr             mfRational (
                             int num = 0,
-                            int denom = 1);
+                            int denom = 1)
+                              { assign (mfRationalise (num, denom)); }
 
-                          mfRational (const mfRational& rat);
+    constexpr             mfRational (const mfRational& rat) = default;
 
                           mfRational (const std::string& theString);
 
-    virtual               ~mfRational ();
-
 
   public:
 
     // set and get
     // ------------------------------------------------------
 
-    void                  setNumerator (int num)
+    constexpr void        setNumerator (int num)
                               { fNumerator = num; }
-    int                   getNumerator ()  const
+    constexpr int         getNumerator ()  const
                               { return fNumerator; }
 
-    void                  setDenominator (int denom)
+    constexpr void        setDenominator (int denom)
                               { fDenominator = denom; }
-    int                   getDenominator () const
+    constexpr int         getDenominator () const
                               { return fDenominator; }
 
-    void                  set (int num, int denom)
+    constexpr void        set (int num, int denom)
                               { fNumerator = num; fDenominator = denom; }
 
   public:
@@ -72,53 +168,97 @@ class EXP mfRational
 
     // arithmetic
 
-    mfRational            inverse () const;
-    mfRational            opposite () const;
+    constexpr mfRational  inverse () const
+                              { return mfRational (fDenominator, fNumerator); }
+    constexpr mfRational  opposite () const
+                              { return mfRational (-fNumerator, fDenominator); }
 
-    mfRational            operator + (const mfRational &rat) const;
-    mfRational            operator - (const mfRational &rat) const;
+    constexpr mfRational  operator + (const mfRational &rat) const
+                              { mfRational result (*this); return result += rat; }
+    constexpr mfRational  operator - (const mfRational &rat) const
+                              { mfRational result (*this); return result -= rat; }
     //! Useful for notes with dots.
-    mfRational            operator * (const mfRational &rat) const;
-    mfRational            operator / (const mfRational &rat) const;
+    constexpr mfRational  operator * (const mfRational &rat) const
+                              { mfRational result (*this); return result *= rat; }
+    constexpr mfRational  operator / (const mfRational &rat) const
+                              { mfRational result (*this); return result /= rat; }
     // (i.e. rat * 3/2 or rat * 7/4)
 
-    mfRational            operator * (int num) const;
-    mfRational            operator / (int num) const;
-
-    mfRational&           operator += (const mfRational &rat);
-    mfRational&             operator -= (const mfRational &rat);
+    constexpr mfRational  operator * (int num) const
+                              { return (*this) * mfRational (num, 1); }
+    constexpr mfRational  operator / (int num) const
+                              { return (*this) / mfRational (num, 1); }
+
+    constexpr mfRational& operator += (const mfRational &rat)
+                              {
+                                assign (
+                                  mfRationalSum (
+                                    fNumerator, fDenominator,
+                                    rat.fNumerator, rat.fDenominator));
+                                return *this;
+                              }
+    constexpr mfRational& operator -= (const mfRational &rat)
+                              {
+                                assign (
+                                  mfRationalSum (
+                                    fNumerator, fDenominator,
+                                    - (long long) rat.fNumerator, rat.fDenominator));
+                                return *this;
+                              }
     //! Useful for notes with dots.
-    mfRational&           operator *= (const mfRational &rat);
-    mfRational&           operator /= (const mfRational &rat);
+    constexpr mfRational& operator *= (const mfRational &rat)
+                              {
+                                assign (
+                                  mfRationalProduct (
+                                    fNumerator, fDenominator,
+                                    rat.fNumerator, rat.fDenominator));
+                                return *this;
+                              }
+    constexpr mfRational& operator /= (const mfRational &rat)
+                              {
+                                assign (
+                                  mfRationalProduct (
+                                    fNumerator, fDenominator,
+                                    rat.fDenominator, rat.fNumerator));
+                                return *this;
+                              }
     // (i.e. rat * 3/2 or rat * 7/4)
 
-    mfRational&           operator *= (int num)
+    constexpr mfRational& operator *= (int num)
                               { fNumerator *= num; return *this; }
-    mfRational&           operator /= (int num)
+    constexpr mfRational& operator /= (int num)
                               { fDenominator *= num; return *this; }
 
     // assignment
 
-    mfRational&           operator = (const mfRational& rat);
+    constexpr mfRational& operator = (const mfRational& rat) = default;
 
     // comparisons
 
-    Bool                  operator >  (const mfRational &rat) const;
-    Bool                  operator >= (const mfRational &rat) const
-                              {return !(*this < rat);}
-    Bool                  operator <  (const mfRational &rat) const;
-    Bool                  operator <= (const mfRational &rat) const
-                              {return !(*this > rat);}
-
-    Bool                  operator == (const mfRational &rat) const;
-    Bool                  operator != (const mfRational &rat) const
-                              {return !(*this == rat);}
-
-    Bool                  operator >  (double num) const;
-    Bool                  operator >= (double num) const;
-    Bool                  operator <  (double num) const;
-    Bool                  operator <= (double num) const;
-    Bool                  operator == (double) const;
+    constexpr bool        operator >  (const mfRational &rat) const
+                              { return compare (rat) > 0; }
+    constexpr bool        operator >= (const mfRational &rat) const
+                              { return compare (rat) >= 0; }
+    constexpr bool        operator <  (const mfRational &rat) const
+                              { return compare (rat) < 0; }
+    constexpr bool        operator <= (const mfRational &rat) const
+                              { return compare (rat) <= 0; }
+
+    constexpr bool        operator == (const mfRational &rat) const
+                              { return compare (rat) == 0; }
+    constexpr bool        operator != (const mfRational &rat) const
+                              { return compare (rat) != 0; }
+
+    bool                  operator >  (double num) const
+                              { return toDouble () > num; }
+    bool                  operator >= (double num) const
+                              { return toDouble () >= num; }
+    bool                  operator <  (double num) const
+                              { return toDouble () < num; }
+    bool                  operator <= (double num) const
+                              { return toDouble () <= num; }
+    bool                  operator == (double num) const
+                              { return toDouble () == num; }
 
     // conversions
 
@@ -128,7 +268,13 @@ class EXP mfRational
                           operator int () const;
 
     std::string           toString () const;
-    double                toDouble () const;
+    double                toDouble () const
+                              {
+                                return
+                                  fDenominator != 0
+                                    ? (double) fNumerator / (double) fDenominator
+                                    : 0;
+                              }
     float                 toFloat () const;
     int                   toInt () const;
 
@@ -149,7 +295,22 @@ class EXP mfRational
     // ------------------------------------------------------
 
     // 'rationalise' mfRational values
-    void                  rationalise ();
+    constexpr void        rationalise ()
+                              { assign (mfRationalise (fNumerator, fDenominator)); }
+
+    constexpr void        assign (mfRationalParts parts)
+                              {
+                                fNumerator = parts.fNumerator;
+                                fDenominator = parts.fDenominator;
+                              }
+
+    constexpr int         compare (const mfRational &rat) const
+                              {
+                                return
+                                  mfRationalCompare (
+                                    fNumerator, fDenominator,
+                                    rat.fNumerator, rat.fDenominator);
+                              }
 
   private:
 
@@ -160,6 +321,10 @@ class EXP mfRational
     int                   fDenominator;
 };
 
+static_assert (std::is_trivially_copyable_v<mfRational>);
+static_assert (mfRational (6, -8) == mfRational (-3, 4));
+static_assert (mfRational (1, 6) + mfRational (1, 3) == mfRational (1, 2));
+
 EXP std::ostream& operator << (std::ostream& os, const mfRational& rat);
 
 
@@ -62,6 +62,10 @@ std::string mfServiceKindAsString (
       result = "kMfService_xml2gmn";
       break;
 
+    case mfServiceKind::kMfService_xml2all:
+      result = "kMfService_xml2all";
+      break;
+
     case mfServiceKind::kMfService_stringMatcher:
       result = "kMfService_stringMatcher";
       break;
@@ -199,6 +203,9 @@ void initializeMusicFormatsServiceKindsMap ()
     gGlobalMusicFormatsServiceKindsMap ["xml2gmn"] =
       mfServiceKind::kMfService_xml2gmn;
 
+    gGlobalMusicFormatsServiceKindsMap ["xml2all"] =
+      mfServiceKind::kMfService_xml2all;
+
     gGlobalMusicFormatsServiceKindsMap ["filter"] =
       mfServiceKind::kMfService_stringMatcher;
 
@@ -920,6 +927,63 @@ EXP void initializeServices ()
     pGlobalServicesMap [mfServiceKind::kMfService_xml2gmn] = xml2gmnService;
   }
 
+  // xml2all
+  // ------------------------------
+
+  {
+    std::string serviceName = "xml2all";
+
+    S_mfService
+      xml2allService =
+        mfService::create (serviceName);
+
+    // passes 1 to 4 are run once, the other ones once per target
+
+    xml2allService->
+      appendPassToService (
+        mfPass::create (
+          mfPassIDKind::kMfPassID_1,
+          gLanguage->convertAMusicXMLStreamIntoAnMXSR ()));
+
+    xml2allService->
+      appendPassToService (
+        mfPass::create (
+          mfPassIDKind::kMfPassID_2,
+          gLanguage->convertTheMXSRIntoAnMSRSkeleton ()));
+
+    xml2allService->
+      appendPassToService (
+        mfPass::create (
+          mfPassIDKind::kMfPassID_3,
+          gLanguage->populateTheMSRSkeletonFromMusicXMLData ()));
+
+    xml2allService->
+      appendPassToService (
+        mfPass::create (
+          mfPassIDKind::kMfPassID_4,
+          gLanguage->convertTheFirstMSRIntoASecondMSR ()));
+
+    xml2allService->
+      appendPassToService (
+        mfPass::create (
+          mfPassIDKind::kMfPassID_5,
+          "Convert the second MSR into an LPSR, a BSR or an MXSR"));
+
+    xml2allService->
+      appendPassToService (
+        mfPass::create (
+          mfPassIDKind::kMfPassID_6,
+          "Convert the LPSR, the BSR or the MXSR into the target format"));
+
+    xml2allService->
+      appendPassToService (
+        mfPass::create (
+          mfPassIDKind::kMfPassID_7,
+          "Convert the finalized BSR into braille"));
+
+    pGlobalServicesMap [mfServiceKind::kMfService_xml2all] = xml2allService;
+  }
+
   // filter
   // ------------------------------
 
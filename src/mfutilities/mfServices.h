@@ -36,6 +36,7 @@ enum class mfServiceKind {
   kMfService_xml2brl,
   kMfService_xml2xml,
   kMfService_xml2gmn,
+  kMfService_xml2all,
 
   kMfService_stringMatcher,
 
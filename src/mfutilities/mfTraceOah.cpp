@@ -3241,7 +3241,7 @@ void traceOahGroup::acceptIn (basevisitor* v)
 
   if (visitor<S_traceOahGroup>*
     p =
-      dynamic_cast<visitor<S_traceOahGroup>*> (v)) {
+      visitor<S_traceOahGroup>::cast (v)) {
         S_traceOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -3277,7 +3277,7 @@ void traceOahGroup::acceptOut (basevisitor* v)
 
   if (visitor<S_traceOahGroup>*
     p =
-      dynamic_cast<visitor<S_traceOahGroup>*> (v)) {
+      visitor<S_traceOahGroup>::cast (v)) {
         S_traceOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -110,7 +110,7 @@ void oahValueLessAtomAlias::acceptIn (basevisitor* v)
 
   if (visitor<S_oahValueLessAtomAlias>*
     p =
-      dynamic_cast<visitor<S_oahValueLessAtomAlias>*> (v)) {
+      visitor<S_oahValueLessAtomAlias>::cast (v)) {
         S_oahValueLessAtomAlias elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -146,7 +146,7 @@ void oahValueLessAtomAlias::acceptOut (basevisitor* v)
 
   if (visitor<S_oahValueLessAtomAlias>*
     p =
-      dynamic_cast<visitor<S_oahValueLessAtomAlias>*> (v)) {
+      visitor<S_oahValueLessAtomAlias>::cast (v)) {
         S_oahValueLessAtomAlias elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -298,7 +298,7 @@ void oahValueFittedAtomAlias::acceptIn (basevisitor* v)
 
   if (visitor<S_oahValueFittedAtomAlias>*
     p =
-      dynamic_cast<visitor<S_oahValueFittedAtomAlias>*> (v)) {
+      visitor<S_oahValueFittedAtomAlias>::cast (v)) {
         S_oahValueFittedAtomAlias elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -334,7 +334,7 @@ void oahValueFittedAtomAlias::acceptOut (basevisitor* v)
 
   if (visitor<S_oahValueFittedAtomAlias>*
     p =
-      dynamic_cast<visitor<S_oahValueFittedAtomAlias>*> (v)) {
+      visitor<S_oahValueFittedAtomAlias>::cast (v)) {
         S_oahValueFittedAtomAlias elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -538,7 +538,7 @@ void oahMacroAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_oahMacroAtom>*
     p =
-      dynamic_cast<visitor<S_oahMacroAtom>*> (v)) {
+      visitor<S_oahMacroAtom>::cast (v)) {
         S_oahMacroAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -574,7 +574,7 @@ void oahMacroAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_oahMacroAtom>*
     p =
-      dynamic_cast<visitor<S_oahMacroAtom>*> (v)) {
+      visitor<S_oahMacroAtom>::cast (v)) {
         S_oahMacroAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -896,7 +896,7 @@ void oahOptionsUsageAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_oahOptionsUsageAtom>*
     p =
-      dynamic_cast<visitor<S_oahOptionsUsageAtom>*> (v)) {
+      visitor<S_oahOptionsUsageAtom>::cast (v)) {
         S_oahOptionsUsageAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -932,7 +932,7 @@ void oahOptionsUsageAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_oahOptionsUsageAtom>*
     p =
-      dynamic_cast<visitor<S_oahOptionsUsageAtom>*> (v)) {
+      visitor<S_oahOptionsUsageAtom>::cast (v)) {
         S_oahOptionsUsageAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -1094,7 +1094,7 @@ void oahMusicFormatsTestAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_oahMusicFormatsTestAtom>*
     p =
-      dynamic_cast<visitor<S_oahMusicFormatsTestAtom>*> (v)) {
+      visitor<S_oahMusicFormatsTestAtom>::cast (v)) {
         S_oahMusicFormatsTestAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -1130,7 +1130,7 @@ void oahMusicFormatsTestAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_oahMusicFormatsTestAtom>*
     p =
-      dynamic_cast<visitor<S_oahMusicFormatsTestAtom>*> (v)) {
+      visitor<S_oahMusicFormatsTestAtom>::cast (v)) {
         S_oahMusicFormatsTestAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -1271,7 +1271,7 @@ void oahHelpAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_oahHelpAtom>*
     p =
-      dynamic_cast<visitor<S_oahHelpAtom>*> (v)) {
+      visitor<S_oahHelpAtom>::cast (v)) {
         S_oahHelpAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -1307,7 +1307,7 @@ void oahHelpAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_oahHelpAtom>*
     p =
-      dynamic_cast<visitor<S_oahHelpAtom>*> (v)) {
+      visitor<S_oahHelpAtom>::cast (v)) {
         S_oahHelpAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -1455,7 +1455,7 @@ void oahHelpSummaryAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_oahHelpSummaryAtom>*
     p =
-      dynamic_cast<visitor<S_oahHelpSummaryAtom>*> (v)) {
+      visitor<S_oahHelpSummaryAtom>::cast (v)) {
         S_oahHelpSummaryAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -1491,7 +1491,7 @@ void oahHelpSummaryAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_oahHelpSummaryAtom>*
     p =
-      dynamic_cast<visitor<S_oahHelpSummaryAtom>*> (v)) {
+      visitor<S_oahHelpSummaryAtom>::cast (v)) {
         S_oahHelpSummaryAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -1636,7 +1636,7 @@ void oahAboutAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_oahAboutAtom>*
     p =
-      dynamic_cast<visitor<S_oahAboutAtom>*> (v)) {
+      visitor<S_oahAboutAtom>::cast (v)) {
         S_oahAboutAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -1672,7 +1672,7 @@ void oahAboutAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_oahAboutAtom>*
     p =
-      dynamic_cast<visitor<S_oahAboutAtom>*> (v)) {
+      visitor<S_oahAboutAtom>::cast (v)) {
         S_oahAboutAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -1854,7 +1854,7 @@ void oahVersionAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_oahVersionAtom>*
     p =
-      dynamic_cast<visitor<S_oahVersionAtom>*> (v)) {
+      visitor<S_oahVersionAtom>::cast (v)) {
         S_oahVersionAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -1890,7 +1890,7 @@ void oahVersionAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_oahVersionAtom>*
     p =
-      dynamic_cast<visitor<S_oahVersionAtom>*> (v)) {
+      visitor<S_oahVersionAtom>::cast (v)) {
         S_oahVersionAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -2068,7 +2068,7 @@ void oahLibraryVersionAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_oahLibraryVersionAtom>*
     p =
-      dynamic_cast<visitor<S_oahLibraryVersionAtom>*> (v)) {
+      visitor<S_oahLibraryVersionAtom>::cast (v)) {
         S_oahLibraryVersionAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -2104,7 +2104,7 @@ void oahLibraryVersionAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_oahLibraryVersionAtom>*
     p =
-      dynamic_cast<visitor<S_oahLibraryVersionAtom>*> (v)) {
+      visitor<S_oahLibraryVersionAtom>::cast (v)) {
         S_oahLibraryVersionAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -2262,7 +2262,7 @@ void oahHistoryAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_oahHistoryAtom>*
     p =
-      dynamic_cast<visitor<S_oahHistoryAtom>*> (v)) {
+      visitor<S_oahHistoryAtom>::cast (v)) {
         S_oahHistoryAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -2298,7 +2298,7 @@ void oahHistoryAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_oahHistoryAtom>*
     p =
-      dynamic_cast<visitor<S_oahHistoryAtom>*> (v)) {
+      visitor<S_oahHistoryAtom>::cast (v)) {
         S_oahHistoryAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -2456,7 +2456,7 @@ void oahLibraryHistoryAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_oahLibraryHistoryAtom>*
     p =
-      dynamic_cast<visitor<S_oahLibraryHistoryAtom>*> (v)) {
+      visitor<S_oahLibraryHistoryAtom>::cast (v)) {
         S_oahLibraryHistoryAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -2492,7 +2492,7 @@ void oahLibraryHistoryAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_oahLibraryHistoryAtom>*
     p =
-      dynamic_cast<visitor<S_oahLibraryHistoryAtom>*> (v)) {
+      visitor<S_oahLibraryHistoryAtom>::cast (v)) {
         S_oahLibraryHistoryAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -2651,7 +2651,7 @@ void oahContactAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_oahContactAtom>*
     p =
-      dynamic_cast<visitor<S_oahContactAtom>*> (v)) {
+      visitor<S_oahContactAtom>::cast (v)) {
         S_oahContactAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -2687,7 +2687,7 @@ void oahContactAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_oahContactAtom>*
     p =
-      dynamic_cast<visitor<S_oahContactAtom>*> (v)) {
+      visitor<S_oahContactAtom>::cast (v)) {
         S_oahContactAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -2839,7 +2839,7 @@ void oahDisplayPrefixes::acceptIn (basevisitor* v)
 
   if (visitor<S_oahDisplayPrefixes>*
     p =
-      dynamic_cast<visitor<S_oahDisplayPrefixes>*> (v)) {
+      visitor<S_oahDisplayPrefixes>::cast (v)) {
         S_oahDisplayPrefixes elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -2875,7 +2875,7 @@ void oahDisplayPrefixes::acceptOut (basevisitor* v)
 
   if (visitor<S_oahDisplayPrefixes>*
     p =
-      dynamic_cast<visitor<S_oahDisplayPrefixes>*> (v)) {
+      visitor<S_oahDisplayPrefixes>::cast (v)) {
         S_oahDisplayPrefixes elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -3025,7 +3025,7 @@ void oahDisplaySingleCharacterOptions::acceptIn (basevisitor* v)
 
   if (visitor<S_oahDisplaySingleCharacterOptions>*
     p =
-      dynamic_cast<visitor<S_oahDisplaySingleCharacterOptions>*> (v)) {
+      visitor<S_oahDisplaySingleCharacterOptions>::cast (v)) {
         S_oahDisplaySingleCharacterOptions elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -3061,7 +3061,7 @@ void oahDisplaySingleCharacterOptions::acceptOut (basevisitor* v)
 
   if (visitor<S_oahDisplaySingleCharacterOptions>*
     p =
-      dynamic_cast<visitor<S_oahDisplaySingleCharacterOptions>*> (v)) {
+      visitor<S_oahDisplaySingleCharacterOptions>::cast (v)) {
         S_oahDisplaySingleCharacterOptions elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -3264,7 +3264,7 @@ void oahOnOffAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_oahOnOffAtom>*
     p =
-      dynamic_cast<visitor<S_oahOnOffAtom>*> (v)) {
+      visitor<S_oahOnOffAtom>::cast (v)) {
         S_oahOnOffAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -3300,7 +3300,7 @@ void oahOnOffAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_oahOnOffAtom>*
     p =
-      dynamic_cast<visitor<S_oahOnOffAtom>*> (v)) {
+      visitor<S_oahOnOffAtom>::cast (v)) {
         S_oahOnOffAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -3509,7 +3509,7 @@ void oahBooleanAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_oahBooleanAtom>*
     p =
-      dynamic_cast<visitor<S_oahBooleanAtom>*> (v)) {
+      visitor<S_oahBooleanAtom>::cast (v)) {
         S_oahBooleanAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -3545,7 +3545,7 @@ void oahBooleanAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_oahBooleanAtom>*
     p =
-      dynamic_cast<visitor<S_oahBooleanAtom>*> (v)) {
+      visitor<S_oahBooleanAtom>::cast (v)) {
         S_oahBooleanAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -3751,7 +3751,7 @@ void oahTwoBooleansAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_oahTwoBooleansAtom>*
     p =
-      dynamic_cast<visitor<S_oahTwoBooleansAtom>*> (v)) {
+      visitor<S_oahTwoBooleansAtom>::cast (v)) {
         S_oahTwoBooleansAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -3787,7 +3787,7 @@ void oahTwoBooleansAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_oahTwoBooleansAtom>*
     p =
-      dynamic_cast<visitor<S_oahTwoBooleansAtom>*> (v)) {
+      visitor<S_oahTwoBooleansAtom>::cast (v)) {
         S_oahTwoBooleansAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -4005,7 +4005,7 @@ void oahThreeBooleansAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_oahThreeBooleansAtom>*
     p =
-      dynamic_cast<visitor<S_oahThreeBooleansAtom>*> (v)) {
+      visitor<S_oahThreeBooleansAtom>::cast (v)) {
         S_oahThreeBooleansAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -4041,7 +4041,7 @@ void oahThreeBooleansAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_oahThreeBooleansAtom>*
     p =
-      dynamic_cast<visitor<S_oahThreeBooleansAtom>*> (v)) {
+      visitor<S_oahThreeBooleansAtom>::cast (v)) {
         S_oahThreeBooleansAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -4265,7 +4265,7 @@ void oahFourBooleansAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_oahFourBooleansAtom>*
     p =
-      dynamic_cast<visitor<S_oahFourBooleansAtom>*> (v)) {
+      visitor<S_oahFourBooleansAtom>::cast (v)) {
         S_oahFourBooleansAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -4301,7 +4301,7 @@ void oahFourBooleansAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_oahFourBooleansAtom>*
     p =
-      dynamic_cast<visitor<S_oahFourBooleansAtom>*> (v)) {
+      visitor<S_oahFourBooleansAtom>::cast (v)) {
         S_oahFourBooleansAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -4531,7 +4531,7 @@ void oahFiveBooleansAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_oahFiveBooleansAtom>*
     p =
-      dynamic_cast<visitor<S_oahFiveBooleansAtom>*> (v)) {
+      visitor<S_oahFiveBooleansAtom>::cast (v)) {
         S_oahFiveBooleansAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -4567,7 +4567,7 @@ void oahFiveBooleansAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_oahFiveBooleansAtom>*
     p =
-      dynamic_cast<visitor<S_oahFiveBooleansAtom>*> (v)) {
+      visitor<S_oahFiveBooleansAtom>::cast (v)) {
         S_oahFiveBooleansAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -4906,7 +4906,7 @@ void oahCombinedBooleansAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_oahCombinedBooleansAtom>*
     p =
-      dynamic_cast<visitor<S_oahCombinedBooleansAtom>*> (v)) {
+      visitor<S_oahCombinedBooleansAtom>::cast (v)) {
         S_oahCombinedBooleansAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -4942,7 +4942,7 @@ void oahCombinedBooleansAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_oahCombinedBooleansAtom>*
     p =
-      dynamic_cast<visitor<S_oahCombinedBooleansAtom>*> (v)) {
+      visitor<S_oahCombinedBooleansAtom>::cast (v)) {
         S_oahCombinedBooleansAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -5345,7 +5345,7 @@ void oahIntegerAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_oahIntegerAtom>*
     p =
-      dynamic_cast<visitor<S_oahIntegerAtom>*> (v)) {
+      visitor<S_oahIntegerAtom>::cast (v)) {
         S_oahIntegerAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -5381,7 +5381,7 @@ void oahIntegerAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_oahIntegerAtom>*
     p =
-      dynamic_cast<visitor<S_oahIntegerAtom>*> (v)) {
+      visitor<S_oahIntegerAtom>::cast (v)) {
         S_oahIntegerAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -5654,7 +5654,7 @@ void oahTwoIntegersAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_oahTwoIntegersAtom>*
     p =
-      dynamic_cast<visitor<S_oahTwoIntegersAtom>*> (v)) {
+      visitor<S_oahTwoIntegersAtom>::cast (v)) {
         S_oahTwoIntegersAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -5690,7 +5690,7 @@ void oahTwoIntegersAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_oahTwoIntegersAtom>*
     p =
-      dynamic_cast<visitor<S_oahTwoIntegersAtom>*> (v)) {
+      visitor<S_oahTwoIntegersAtom>::cast (v)) {
         S_oahTwoIntegersAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -5968,7 +5968,7 @@ void oahFloatAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_oahFloatAtom>*
     p =
-      dynamic_cast<visitor<S_oahFloatAtom>*> (v)) {
+      visitor<S_oahFloatAtom>::cast (v)) {
         S_oahFloatAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -6004,7 +6004,7 @@ void oahFloatAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_oahFloatAtom>*
     p =
-      dynamic_cast<visitor<S_oahFloatAtom>*> (v)) {
+      visitor<S_oahFloatAtom>::cast (v)) {
         S_oahFloatAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -6208,7 +6208,7 @@ void oahStringAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_oahStringAtom>*
     p =
-      dynamic_cast<visitor<S_oahStringAtom>*> (v)) {
+      visitor<S_oahStringAtom>::cast (v)) {
         S_oahStringAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -6244,7 +6244,7 @@ void oahStringAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_oahStringAtom>*
     p =
-      dynamic_cast<visitor<S_oahStringAtom>*> (v)) {
+      visitor<S_oahStringAtom>::cast (v)) {
         S_oahStringAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -6563,7 +6563,7 @@ void oahFactorizedStringAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_oahFactorizedStringAtom>*
     p =
-      dynamic_cast<visitor<S_oahFactorizedStringAtom>*> (v)) {
+      visitor<S_oahFactorizedStringAtom>::cast (v)) {
         S_oahFactorizedStringAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -6599,7 +6599,7 @@ void oahFactorizedStringAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_oahFactorizedStringAtom>*
     p =
-      dynamic_cast<visitor<S_oahFactorizedStringAtom>*> (v)) {
+      visitor<S_oahFactorizedStringAtom>::cast (v)) {
         S_oahFactorizedStringAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -6882,7 +6882,7 @@ void oahDefaultedStringAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_oahDefaultedStringAtom>*
     p =
-      dynamic_cast<visitor<S_oahDefaultedStringAtom>*> (v)) {
+      visitor<S_oahDefaultedStringAtom>::cast (v)) {
         S_oahDefaultedStringAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -6942,7 +6942,7 @@ void oahDefaultedStringAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_oahDefaultedStringAtom>*
     p =
-      dynamic_cast<visitor<S_oahDefaultedStringAtom>*> (v)) {
+      visitor<S_oahDefaultedStringAtom>::cast (v)) {
         S_oahDefaultedStringAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -7449,7 +7449,7 @@ void oahCommonPrefixBooleansAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_oahCommonPrefixBooleansAtom>*
     p =
-      dynamic_cast<visitor<S_oahCommonPrefixBooleansAtom>*> (v)) {
+      visitor<S_oahCommonPrefixBooleansAtom>::cast (v)) {
         S_oahCommonPrefixBooleansAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -7485,7 +7485,7 @@ void oahCommonPrefixBooleansAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_oahCommonPrefixBooleansAtom>*
     p =
-      dynamic_cast<visitor<S_oahCommonPrefixBooleansAtom>*> (v)) {
+      visitor<S_oahCommonPrefixBooleansAtom>::cast (v)) {
         S_oahCommonPrefixBooleansAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -7892,7 +7892,7 @@ void oahRegexAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_oahRegexAtom>*
     p =
-      dynamic_cast<visitor<S_oahRegexAtom>*> (v)) {
+      visitor<S_oahRegexAtom>::cast (v)) {
         S_oahRegexAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -7952,7 +7952,7 @@ void oahRegexAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_oahRegexAtom>*
     p =
-      dynamic_cast<visitor<S_oahRegexAtom>*> (v)) {
+      visitor<S_oahRegexAtom>::cast (v)) {
         S_oahRegexAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -8222,7 +8222,7 @@ void oahRationalAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_oahRationalAtom>*
     p =
-      dynamic_cast<visitor<S_oahRationalAtom>*> (v)) {
+      visitor<S_oahRationalAtom>::cast (v)) {
         S_oahRationalAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -8258,7 +8258,7 @@ void oahRationalAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_oahRationalAtom>*
     p =
-      dynamic_cast<visitor<S_oahRationalAtom>*> (v)) {
+      visitor<S_oahRationalAtom>::cast (v)) {
         S_oahRationalAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -8443,7 +8443,7 @@ void oahNaturalNumbersSetAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_oahNaturalNumbersSetAtom>*
     p =
-      dynamic_cast<visitor<S_oahNaturalNumbersSetAtom>*> (v)) {
+      visitor<S_oahNaturalNumbersSetAtom>::cast (v)) {
         S_oahNaturalNumbersSetAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -8479,7 +8479,7 @@ void oahNaturalNumbersSetAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_oahNaturalNumbersSetAtom>*
     p =
-      dynamic_cast<visitor<S_oahNaturalNumbersSetAtom>*> (v)) {
+      visitor<S_oahNaturalNumbersSetAtom>::cast (v)) {
         S_oahNaturalNumbersSetAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -8737,7 +8737,7 @@ void oahColorRGBAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_oahColorRGBAtom>*
     p =
-      dynamic_cast<visitor<S_oahColorRGBAtom>*> (v)) {
+      visitor<S_oahColorRGBAtom>::cast (v)) {
         S_oahColorRGBAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -8773,7 +8773,7 @@ void oahColorRGBAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_oahColorRGBAtom>*
     p =
-      dynamic_cast<visitor<S_oahColorRGBAtom>*> (v)) {
+      visitor<S_oahColorRGBAtom>::cast (v)) {
         S_oahColorRGBAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -9047,7 +9047,7 @@ void oahIntSetAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_oahIntSetAtom>*
     p =
-      dynamic_cast<visitor<S_oahIntSetAtom>*> (v)) {
+      visitor<S_oahIntSetAtom>::cast (v)) {
         S_oahIntSetAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -9083,7 +9083,7 @@ void oahIntSetAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_oahIntSetAtom>*
     p =
-      dynamic_cast<visitor<S_oahIntSetAtom>*> (v)) {
+      visitor<S_oahIntSetAtom>::cast (v)) {
         S_oahIntSetAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -9366,7 +9366,7 @@ void oahStringSetAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_oahStringSetAtom>*
     p =
-      dynamic_cast<visitor<S_oahStringSetAtom>*> (v)) {
+      visitor<S_oahStringSetAtom>::cast (v)) {
         S_oahStringSetAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -9402,7 +9402,7 @@ void oahStringSetAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_oahStringSetAtom>*
     p =
-      dynamic_cast<visitor<S_oahStringSetAtom>*> (v)) {
+      visitor<S_oahStringSetAtom>::cast (v)) {
         S_oahStringSetAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -9723,7 +9723,7 @@ void oahMeasureNumberSetAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_oahMeasureNumberSetAtom>*
     p =
-      dynamic_cast<visitor<S_oahMeasureNumberSetAtom>*> (v)) {
+      visitor<S_oahMeasureNumberSetAtom>::cast (v)) {
         S_oahMeasureNumberSetAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -9759,7 +9759,7 @@ void oahMeasureNumberSetAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_oahMeasureNumberSetAtom>*
     p =
-      dynamic_cast<visitor<S_oahMeasureNumberSetAtom>*> (v)) {
+      visitor<S_oahMeasureNumberSetAtom>::cast (v)) {
         S_oahMeasureNumberSetAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -10104,7 +10104,7 @@ void oahStringToIntMapAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_oahStringToIntMapAtom>*
     p =
-      dynamic_cast<visitor<S_oahStringToIntMapAtom>*> (v)) {
+      visitor<S_oahStringToIntMapAtom>::cast (v)) {
         S_oahStringToIntMapAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -10140,7 +10140,7 @@ void oahStringToIntMapAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_oahStringToIntMapAtom>*
     p =
-      dynamic_cast<visitor<S_oahStringToIntMapAtom>*> (v)) {
+      visitor<S_oahStringToIntMapAtom>::cast (v)) {
         S_oahStringToIntMapAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -10494,7 +10494,7 @@ void oahMeasureNumberToIntMapAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_oahMeasureNumberToIntMapAtom>*
     p =
-      dynamic_cast<visitor<S_oahMeasureNumberToIntMapAtom>*> (v)) {
+      visitor<S_oahMeasureNumberToIntMapAtom>::cast (v)) {
         S_oahMeasureNumberToIntMapAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -10530,7 +10530,7 @@ void oahMeasureNumberToIntMapAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_oahMeasureNumberToIntMapAtom>*
     p =
-      dynamic_cast<visitor<S_oahMeasureNumberToIntMapAtom>*> (v)) {
+      visitor<S_oahMeasureNumberToIntMapAtom>::cast (v)) {
         S_oahMeasureNumberToIntMapAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -10884,7 +10884,7 @@ void oahMeasureNumberToMeasureNumberMapAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_oahMeasureNumberToMeasureNumberMapAtom>*
     p =
-      dynamic_cast<visitor<S_oahMeasureNumberToMeasureNumberMapAtom>*> (v)) {
+      visitor<S_oahMeasureNumberToMeasureNumberMapAtom>::cast (v)) {
         S_oahMeasureNumberToMeasureNumberMapAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -10920,7 +10920,7 @@ void oahMeasureNumberToMeasureNumberMapAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_oahMeasureNumberToMeasureNumberMapAtom>*
     p =
-      dynamic_cast<visitor<S_oahMeasureNumberToMeasureNumberMapAtom>*> (v)) {
+      visitor<S_oahMeasureNumberToMeasureNumberMapAtom>::cast (v)) {
         S_oahMeasureNumberToMeasureNumberMapAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -11266,7 +11266,7 @@ void oahStringToStringMapAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_oahStringToStringMapAtom>*
     p =
-      dynamic_cast<visitor<S_oahStringToStringMapAtom>*> (v)) {
+      visitor<S_oahStringToStringMapAtom>::cast (v)) {
         S_oahStringToStringMapAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -11302,7 +11302,7 @@ void oahStringToStringMapAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_oahStringToStringMapAtom>*
     p =
-      dynamic_cast<visitor<S_oahStringToStringMapAtom>*> (v)) {
+      visitor<S_oahStringToStringMapAtom>::cast (v)) {
         S_oahStringToStringMapAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -11647,7 +11647,7 @@ void oahStringToStringMultiMapAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_oahStringToStringMultiMapAtom>*
     p =
-      dynamic_cast<visitor<S_oahStringToStringMultiMapAtom>*> (v)) {
+      visitor<S_oahStringToStringMultiMapAtom>::cast (v)) {
         S_oahStringToStringMultiMapAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -11683,7 +11683,7 @@ void oahStringToStringMultiMapAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_oahStringToStringMultiMapAtom>*
     p =
-      dynamic_cast<visitor<S_oahStringToStringMultiMapAtom>*> (v)) {
+      visitor<S_oahStringToStringMultiMapAtom>::cast (v)) {
         S_oahStringToStringMultiMapAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -12043,7 +12043,7 @@ void oahStringAndIntegerAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_oahStringAndIntegerAtom>*
     p =
-      dynamic_cast<visitor<S_oahStringAndIntegerAtom>*> (v)) {
+      visitor<S_oahStringAndIntegerAtom>::cast (v)) {
         S_oahStringAndIntegerAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -12079,7 +12079,7 @@ void oahStringAndIntegerAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_oahStringAndIntegerAtom>*
     p =
-      dynamic_cast<visitor<S_oahStringAndIntegerAtom>*> (v)) {
+      visitor<S_oahStringAndIntegerAtom>::cast (v)) {
         S_oahStringAndIntegerAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -12412,7 +12412,7 @@ void oahMeasureNumberAndIntegerAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_oahMeasureNumberAndIntegerAtom>*
     p =
-      dynamic_cast<visitor<S_oahMeasureNumberAndIntegerAtom>*> (v)) {
+      visitor<S_oahMeasureNumberAndIntegerAtom>::cast (v)) {
         S_oahMeasureNumberAndIntegerAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -12448,7 +12448,7 @@ void oahMeasureNumberAndIntegerAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_oahMeasureNumberAndIntegerAtom>*
     p =
-      dynamic_cast<visitor<S_oahMeasureNumberAndIntegerAtom>*> (v)) {
+      visitor<S_oahMeasureNumberAndIntegerAtom>::cast (v)) {
         S_oahMeasureNumberAndIntegerAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -12808,7 +12808,7 @@ void oahStringAndTwoIntegersAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_oahStringAndTwoIntegersAtom>*
     p =
-      dynamic_cast<visitor<S_oahStringAndTwoIntegersAtom>*> (v)) {
+      visitor<S_oahStringAndTwoIntegersAtom>::cast (v)) {
         S_oahStringAndTwoIntegersAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -12844,7 +12844,7 @@ void oahStringAndTwoIntegersAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_oahStringAndTwoIntegersAtom>*
     p =
-      dynamic_cast<visitor<S_oahStringAndTwoIntegersAtom>*> (v)) {
+      visitor<S_oahStringAndTwoIntegersAtom>::cast (v)) {
         S_oahStringAndTwoIntegersAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -13116,7 +13116,7 @@ void oahLengthUnitKindAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_oahLengthUnitKindAtom>*
     p =
-      dynamic_cast<visitor<S_oahLengthUnitKindAtom>*> (v)) {
+      visitor<S_oahLengthUnitKindAtom>::cast (v)) {
         S_oahLengthUnitKindAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -13152,7 +13152,7 @@ void oahLengthUnitKindAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_oahLengthUnitKindAtom>*
     p =
-      dynamic_cast<visitor<S_oahLengthUnitKindAtom>*> (v)) {
+      visitor<S_oahLengthUnitKindAtom>::cast (v)) {
         S_oahLengthUnitKindAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -13445,7 +13445,7 @@ void oahLengthAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_oahLengthAtom>*
     p =
-      dynamic_cast<visitor<S_oahLengthAtom>*> (v)) {
+      visitor<S_oahLengthAtom>::cast (v)) {
         S_oahLengthAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -13481,7 +13481,7 @@ void oahLengthAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_oahLengthAtom>*
     p =
-      dynamic_cast<visitor<S_oahLengthAtom>*> (v)) {
+      visitor<S_oahLengthAtom>::cast (v)) {
         S_oahLengthAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -13797,7 +13797,7 @@ void oahMidiTempoAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_oahMidiTempoAtom>*
     p =
-      dynamic_cast<visitor<S_oahMidiTempoAtom>*> (v)) {
+      visitor<S_oahMidiTempoAtom>::cast (v)) {
         S_oahMidiTempoAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -13833,7 +13833,7 @@ void oahMidiTempoAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_oahMidiTempoAtom>*
     p =
-      dynamic_cast<visitor<S_oahMidiTempoAtom>*> (v)) {
+      visitor<S_oahMidiTempoAtom>::cast (v)) {
         S_oahMidiTempoAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -14043,7 +14043,7 @@ void oahHelpAboutOptionName::acceptIn (basevisitor* v)
 
   if (visitor<S_oahHelpAboutOptionName>*
     p =
-      dynamic_cast<visitor<S_oahHelpAboutOptionName>*> (v)) {
+      visitor<S_oahHelpAboutOptionName>::cast (v)) {
         S_oahHelpAboutOptionName elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -14079,7 +14079,7 @@ void oahHelpAboutOptionName::acceptOut (basevisitor* v)
 
   if (visitor<S_oahHelpAboutOptionName>*
     p =
-      dynamic_cast<visitor<S_oahHelpAboutOptionName>*> (v)) {
+      visitor<S_oahHelpAboutOptionName>::cast (v)) {
         S_oahHelpAboutOptionName elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -14250,7 +14250,7 @@ void oahQueryOptionNameAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_oahQueryOptionNameAtom>*
     p =
-      dynamic_cast<visitor<S_oahQueryOptionNameAtom>*> (v)) {
+      visitor<S_oahQueryOptionNameAtom>::cast (v)) {
         S_oahQueryOptionNameAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -14286,7 +14286,7 @@ void oahQueryOptionNameAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_oahQueryOptionNameAtom>*
     p =
-      dynamic_cast<visitor<S_oahQueryOptionNameAtom>*> (v)) {
+      visitor<S_oahQueryOptionNameAtom>::cast (v)) {
         S_oahQueryOptionNameAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -14622,7 +14622,7 @@ void oahFindStringInHelpAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_oahFindStringInHelpAtom>*
     p =
-      dynamic_cast<visitor<S_oahFindStringInHelpAtom>*> (v)) {
+      visitor<S_oahFindStringInHelpAtom>::cast (v)) {
         S_oahFindStringInHelpAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -14658,7 +14658,7 @@ void oahFindStringInHelpAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_oahFindStringInHelpAtom>*
     p =
-      dynamic_cast<visitor<S_oahFindStringInHelpAtom>*> (v)) {
+      visitor<S_oahFindStringInHelpAtom>::cast (v)) {
         S_oahFindStringInHelpAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -14924,7 +14924,7 @@ void oahMatchHelpWithPatternAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_oahMatchHelpWithPatternAtom>*
     p =
-      dynamic_cast<visitor<S_oahMatchHelpWithPatternAtom>*> (v)) {
+      visitor<S_oahMatchHelpWithPatternAtom>::cast (v)) {
         S_oahMatchHelpWithPatternAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -14960,7 +14960,7 @@ void oahMatchHelpWithPatternAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_oahMatchHelpWithPatternAtom>*
     p =
-      dynamic_cast<visitor<S_oahMatchHelpWithPatternAtom>*> (v)) {
+      visitor<S_oahMatchHelpWithPatternAtom>::cast (v)) {
         S_oahMatchHelpWithPatternAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -15133,7 +15133,7 @@ void oahIncludeOptionsAndArgumentsFileAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_oahIncludeOptionsAndArgumentsFileAtom>*
     p =
-      dynamic_cast<visitor<S_oahIncludeOptionsAndArgumentsFileAtom>*> (v)) {
+      visitor<S_oahIncludeOptionsAndArgumentsFileAtom>::cast (v)) {
         S_oahIncludeOptionsAndArgumentsFileAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -15169,7 +15169,7 @@ void oahIncludeOptionsAndArgumentsFileAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_oahIncludeOptionsAndArgumentsFileAtom>*
     p =
-      dynamic_cast<visitor<S_oahIncludeOptionsAndArgumentsFileAtom>*> (v)) {
+      visitor<S_oahIncludeOptionsAndArgumentsFileAtom>::cast (v)) {
         S_oahIncludeOptionsAndArgumentsFileAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
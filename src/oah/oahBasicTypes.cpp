@@ -1064,7 +1064,7 @@ void oahPrefix::acceptIn (basevisitor* v)
 
   if (visitor<S_oahPrefix>*
     p =
-      dynamic_cast<visitor<S_oahPrefix>*> (v)) {
+      visitor<S_oahPrefix>::cast (v)) {
         S_oahPrefix elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -1100,7 +1100,7 @@ void oahPrefix::acceptOut (basevisitor* v)
 
   if (visitor<S_oahPrefix>*
     p =
-      dynamic_cast<visitor<S_oahPrefix>*> (v)) {
+      visitor<S_oahPrefix>::cast (v)) {
         S_oahPrefix elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -1481,7 +1481,7 @@ void oahAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_oahAtom>*
     p =
-      dynamic_cast<visitor<S_oahAtom>*> (v)) {
+      visitor<S_oahAtom>::cast (v)) {
         S_oahAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -1517,7 +1517,7 @@ void oahAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_oahAtom>*
     p =
-      dynamic_cast<visitor<S_oahAtom>*> (v)) {
+      visitor<S_oahAtom>::cast (v)) {
         S_oahAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -1715,7 +1715,7 @@ void oahValueLessAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_oahValueLessAtom>*
     p =
-      dynamic_cast<visitor<S_oahValueLessAtom>*> (v)) {
+      visitor<S_oahValueLessAtom>::cast (v)) {
         S_oahValueLessAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -1751,7 +1751,7 @@ void oahValueLessAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_oahValueLessAtom>*
     p =
-      dynamic_cast<visitor<S_oahValueLessAtom>*> (v)) {
+      visitor<S_oahValueLessAtom>::cast (v)) {
         S_oahValueLessAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -1877,7 +1877,7 @@ void oahValueFittedAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_oahValueFittedAtom>*
     p =
-      dynamic_cast<visitor<S_oahValueFittedAtom>*> (v)) {
+      visitor<S_oahValueFittedAtom>::cast (v)) {
         S_oahValueFittedAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -1913,7 +1913,7 @@ void oahValueFittedAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_oahValueFittedAtom>*
     p =
-      dynamic_cast<visitor<S_oahValueFittedAtom>*> (v)) {
+      visitor<S_oahValueFittedAtom>::cast (v)) {
         S_oahValueFittedAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -2055,7 +2055,7 @@ void oahAtomImplicitlySettingAVariable::acceptIn (basevisitor* v)
 
   if (visitor<S_oahAtomImplicitlySettingAVariable>*
     p =
-      dynamic_cast<visitor<S_oahAtomImplicitlySettingAVariable>*> (v)) {
+      visitor<S_oahAtomImplicitlySettingAVariable>::cast (v)) {
         S_oahAtomImplicitlySettingAVariable elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -2091,7 +2091,7 @@ void oahAtomImplicitlySettingAVariable::acceptOut (basevisitor* v)
 
   if (visitor<S_oahAtomImplicitlySettingAVariable>*
     p =
-      dynamic_cast<visitor<S_oahAtomImplicitlySettingAVariable>*> (v)) {
+      visitor<S_oahAtomImplicitlySettingAVariable>::cast (v)) {
         S_oahAtomImplicitlySettingAVariable elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -2308,7 +2308,7 @@ oahValueDefaultedAtom::~oahValueDefaultedAtom ()
 //
 //   if (visitor<S_oahValueDefaultedAtom>*
 //     p =
-//       dynamic_cast<visitor<S_oahValueDefaultedAtom>*> (v)) {
+//       visitor<S_oahValueDefaultedAtom>::cast (v)) {
 //         S_oahValueDefaultedAtom elem = this;
 //
 // #ifdef MF_TRACE_IS_ENABLED
@@ -2352,7 +2352,7 @@ oahValueDefaultedAtom::~oahValueDefaultedAtom ()
 //
 //   if (visitor<S_oahValueDefaultedAtom>*
 //     p =
-//       dynamic_cast<visitor<S_oahValueDefaultedAtom>*> (v)) {
+//       visitor<S_oahValueDefaultedAtom>::cast (v)) {
 //         S_oahValueDefaultedAtom elem = this;
 //
 // #ifdef MF_TRACE_IS_ENABLED
@@ -2513,7 +2513,7 @@ void oahAtomStoringAValue::acceptIn (basevisitor* v)
 
   if (visitor<S_oahAtomStoringAValue>*
     p =
-      dynamic_cast<visitor<S_oahAtomStoringAValue>*> (v)) {
+      visitor<S_oahAtomStoringAValue>::cast (v)) {
         S_oahAtomStoringAValue elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -2549,7 +2549,7 @@ void oahAtomStoringAValue::acceptOut (basevisitor* v)
 
   if (visitor<S_oahAtomStoringAValue>*
     p =
-      dynamic_cast<visitor<S_oahAtomStoringAValue>*> (v)) {
+      visitor<S_oahAtomStoringAValue>::cast (v)) {
         S_oahAtomStoringAValue elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -2754,7 +2754,7 @@ void oahPureHelpValueLessAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_oahPureHelpValueLessAtom>*
     p =
-      dynamic_cast<visitor<S_oahPureHelpValueLessAtom>*> (v)) {
+      visitor<S_oahPureHelpValueLessAtom>::cast (v)) {
         S_oahPureHelpValueLessAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -2790,7 +2790,7 @@ void oahPureHelpValueLessAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_oahPureHelpValueLessAtom>*
     p =
-      dynamic_cast<visitor<S_oahPureHelpValueLessAtom>*> (v)) {
+      visitor<S_oahPureHelpValueLessAtom>::cast (v)) {
         S_oahPureHelpValueLessAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -2919,7 +2919,7 @@ void oahPureHelpValueFittedAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_oahPureHelpValueFittedAtom>*
     p =
-      dynamic_cast<visitor<S_oahPureHelpValueFittedAtom>*> (v)) {
+      visitor<S_oahPureHelpValueFittedAtom>::cast (v)) {
         S_oahPureHelpValueFittedAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -2955,7 +2955,7 @@ void oahPureHelpValueFittedAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_oahPureHelpValueFittedAtom>*
     p =
-      dynamic_cast<visitor<S_oahPureHelpValueFittedAtom>*> (v)) {
+      visitor<S_oahPureHelpValueFittedAtom>::cast (v)) {
         S_oahPureHelpValueFittedAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -3387,7 +3387,7 @@ void oahSubGroup::acceptIn (basevisitor* v)
 
   if (visitor<S_oahSubGroup>*
     p =
-      dynamic_cast<visitor<S_oahSubGroup>*> (v)) {
+      visitor<S_oahSubGroup>::cast (v)) {
         S_oahSubGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -3423,7 +3423,7 @@ void oahSubGroup::acceptOut (basevisitor* v)
 
   if (visitor<S_oahSubGroup>*
     p =
-      dynamic_cast<visitor<S_oahSubGroup>*> (v)) {
+      visitor<S_oahSubGroup>::cast (v)) {
         S_oahSubGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -4454,7 +4454,7 @@ void oahGroup::acceptIn (basevisitor* v)
 
   if (visitor<S_oahGroup>*
     p =
-      dynamic_cast<visitor<S_oahGroup>*> (v)) {
+      visitor<S_oahGroup>::cast (v)) {
         S_oahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -4490,7 +4490,7 @@ void oahGroup::acceptOut (basevisitor* v)
 
   if (visitor<S_oahGroup>*
     p =
-      dynamic_cast<visitor<S_oahGroup>*> (v)) {
+      visitor<S_oahGroup>::cast (v)) {
         S_oahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -6379,7 +6379,7 @@ void oahHandler::acceptIn (basevisitor* v)
 
   if (visitor<S_oahHandler>*
     p =
-      dynamic_cast<visitor<S_oahHandler>*> (v)) {
+      visitor<S_oahHandler>::cast (v)) {
         S_oahHandler elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -6415,7 +6415,7 @@ void oahHandler::acceptOut (basevisitor* v)
 
   if (visitor<S_oahHandler>*
     p =
-      dynamic_cast<visitor<S_oahHandler>*> (v)) {
+      visitor<S_oahHandler>::cast (v)) {
         S_oahHandler elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -185,7 +185,7 @@ void displayOahGroup::acceptIn (basevisitor* v)
 
   if (visitor<S_displayOahGroup>*
     p =
-      dynamic_cast<visitor<S_displayOahGroup>*> (v)) {
+      visitor<S_displayOahGroup>::cast (v)) {
         S_displayOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -221,7 +221,7 @@ void displayOahGroup::acceptOut (basevisitor* v)
 
   if (visitor<S_displayOahGroup>*
     p =
-      dynamic_cast<visitor<S_displayOahGroup>*> (v)) {
+      visitor<S_displayOahGroup>::cast (v)) {
         S_displayOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
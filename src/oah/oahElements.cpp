@@ -487,7 +487,7 @@ Bool oahElement::findStringInFindableElement (
 //
 //   if (visitor<S_oahElement>*
 //     p =
-//       dynamic_cast<visitor<S_oahElement>*> (v)) {
+//       visitor<S_oahElement>::cast (v)) {
 //         S_oahElement elem = this;
 //
 // #ifdef MF_TRACE_IS_ENABLED
@@ -513,7 +513,7 @@ Bool oahElement::findStringInFindableElement (
 //
 //   if (visitor<S_oahElement>*
 //     p =
-//       dynamic_cast<visitor<S_oahElement>*> (v)) {
+//       visitor<S_oahElement>::cast (v)) {
 //         S_oahElement elem = this;
 //
 // #ifdef MF_TRACE_IS_ENABLED
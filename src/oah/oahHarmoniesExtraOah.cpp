@@ -113,7 +113,7 @@ void extraDisplayAllHarmoniesStructuresAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_extraDisplayAllHarmoniesStructuresAtom>*
     p =
-      dynamic_cast<visitor<S_extraDisplayAllHarmoniesStructuresAtom>*> (v)) {
+      visitor<S_extraDisplayAllHarmoniesStructuresAtom>::cast (v)) {
         S_extraDisplayAllHarmoniesStructuresAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -149,7 +149,7 @@ void extraDisplayAllHarmoniesStructuresAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_extraDisplayAllHarmoniesStructuresAtom>*
     p =
-      dynamic_cast<visitor<S_extraDisplayAllHarmoniesStructuresAtom>*> (v)) {
+      visitor<S_extraDisplayAllHarmoniesStructuresAtom>::cast (v)) {
         S_extraDisplayAllHarmoniesStructuresAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -391,7 +391,7 @@ void extraDisplayAllHarmoniesContentsAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_extraDisplayAllHarmoniesContentsAtom>*
     p =
-      dynamic_cast<visitor<S_extraDisplayAllHarmoniesContentsAtom>*> (v)) {
+      visitor<S_extraDisplayAllHarmoniesContentsAtom>::cast (v)) {
         S_extraDisplayAllHarmoniesContentsAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -427,7 +427,7 @@ void extraDisplayAllHarmoniesContentsAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_extraDisplayAllHarmoniesContentsAtom>*
     p =
-      dynamic_cast<visitor<S_extraDisplayAllHarmoniesContentsAtom>*> (v)) {
+      visitor<S_extraDisplayAllHarmoniesContentsAtom>::cast (v)) {
         S_extraDisplayAllHarmoniesContentsAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -754,7 +754,7 @@ void extraDisplayHarmonyDetailsAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_extraDisplayHarmonyDetailsAtom>*
     p =
-      dynamic_cast<visitor<S_extraDisplayHarmonyDetailsAtom>*> (v)) {
+      visitor<S_extraDisplayHarmonyDetailsAtom>::cast (v)) {
         S_extraDisplayHarmonyDetailsAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -790,7 +790,7 @@ void extraDisplayHarmonyDetailsAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_extraDisplayHarmonyDetailsAtom>*
     p =
-      dynamic_cast<visitor<S_extraDisplayHarmonyDetailsAtom>*> (v)) {
+      visitor<S_extraDisplayHarmonyDetailsAtom>::cast (v)) {
         S_extraDisplayHarmonyDetailsAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -1132,7 +1132,7 @@ void extraDisplayHarmonyAnalysisAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_extraDisplayHarmonyAnalysisAtom>*
     p =
-      dynamic_cast<visitor<S_extraDisplayHarmonyAnalysisAtom>*> (v)) {
+      visitor<S_extraDisplayHarmonyAnalysisAtom>::cast (v)) {
         S_extraDisplayHarmonyAnalysisAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -1168,7 +1168,7 @@ void extraDisplayHarmonyAnalysisAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_extraDisplayHarmonyAnalysisAtom>*
     p =
-      dynamic_cast<visitor<S_extraDisplayHarmonyAnalysisAtom>*> (v)) {
+      visitor<S_extraDisplayHarmonyAnalysisAtom>::cast (v)) {
         S_extraDisplayHarmonyAnalysisAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -1416,7 +1416,7 @@ void harmoniesExtraOahGroup::acceptIn (basevisitor* v)
 
   if (visitor<S_harmoniesExtraOahGroup>*
     p =
-      dynamic_cast<visitor<S_harmoniesExtraOahGroup>*> (v)) {
+      visitor<S_harmoniesExtraOahGroup>::cast (v)) {
         S_harmoniesExtraOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -1452,7 +1452,7 @@ void harmoniesExtraOahGroup::acceptOut (basevisitor* v)
 
   if (visitor<S_harmoniesExtraOahGroup>*
     p =
-      dynamic_cast<visitor<S_harmoniesExtraOahGroup>*> (v)) {
+      visitor<S_harmoniesExtraOahGroup>::cast (v)) {
         S_harmoniesExtraOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
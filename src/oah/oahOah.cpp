@@ -112,7 +112,7 @@ void languageOahAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_languageOahAtom>*
     p =
-      dynamic_cast<visitor<S_languageOahAtom>*> (v)) {
+      visitor<S_languageOahAtom>::cast (v)) {
         S_languageOahAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -148,7 +148,7 @@ void languageOahAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_languageOahAtom>*
     p =
-      dynamic_cast<visitor<S_languageOahAtom>*> (v)) {
+      visitor<S_languageOahAtom>::cast (v)) {
         S_languageOahAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -306,7 +306,7 @@ void insiderOahAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_insiderOahAtom>*
     p =
-      dynamic_cast<visitor<S_insiderOahAtom>*> (v)) {
+      visitor<S_insiderOahAtom>::cast (v)) {
         S_insiderOahAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -342,7 +342,7 @@ void insiderOahAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_insiderOahAtom>*
     p =
-      dynamic_cast<visitor<S_insiderOahAtom>*> (v)) {
+      visitor<S_insiderOahAtom>::cast (v)) {
         S_insiderOahAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -493,7 +493,7 @@ void regularOahAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_regularOahAtom>*
     p =
-      dynamic_cast<visitor<S_regularOahAtom>*> (v)) {
+      visitor<S_regularOahAtom>::cast (v)) {
         S_regularOahAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -529,7 +529,7 @@ void regularOahAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_regularOahAtom>*
     p =
-      dynamic_cast<visitor<S_regularOahAtom>*> (v)) {
+      visitor<S_regularOahAtom>::cast (v)) {
         S_regularOahAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -697,7 +697,7 @@ void passIDOahAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_passIDOahAtom>*
     p =
-      dynamic_cast<visitor<S_passIDOahAtom>*> (v)) {
+      visitor<S_passIDOahAtom>::cast (v)) {
         S_passIDOahAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -733,7 +733,7 @@ void passIDOahAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_passIDOahAtom>*
     p =
-      dynamic_cast<visitor<S_passIDOahAtom>*> (v)) {
+      visitor<S_passIDOahAtom>::cast (v)) {
         S_passIDOahAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -1310,7 +1310,7 @@ void oahOahGroup::acceptIn (basevisitor* v)
 
   if (visitor<S_oahOahGroup>*
     p =
-      dynamic_cast<visitor<S_oahOahGroup>*> (v)) {
+      visitor<S_oahOahGroup>::cast (v)) {
         S_oahOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -1346,7 +1346,7 @@ void oahOahGroup::acceptOut (basevisitor* v)
 
   if (visitor<S_oahOahGroup>*
     p =
-      dynamic_cast<visitor<S_oahOahGroup>*> (v)) {
+      visitor<S_oahOahGroup>::cast (v)) {
         S_oahOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
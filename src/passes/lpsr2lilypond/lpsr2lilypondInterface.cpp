@@ -270,6 +270,9 @@ EXP void translateLpsrToLilypondWithHandler (
     }
 #endif // MF_TRACE_IS_ENABLED
 
+    // write the buffered LilyPond code before closing the file
+    lilypondFileOutputStream.flush ();
+
     outputFileStream.close ();
   }
 }
@@ -142,7 +142,7 @@ void lilypondScoreOutputKindAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_lilypondScoreOutputKindAtom>*
     p =
-      dynamic_cast<visitor<S_lilypondScoreOutputKindAtom>*> (v)) {
+      visitor<S_lilypondScoreOutputKindAtom>::cast (v)) {
         S_lilypondScoreOutputKindAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -178,7 +178,7 @@ void lilypondScoreOutputKindAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_lilypondScoreOutputKindAtom>*
     p =
-      dynamic_cast<visitor<S_lilypondScoreOutputKindAtom>*> (v)) {
+      visitor<S_lilypondScoreOutputKindAtom>::cast (v)) {
         S_lilypondScoreOutputKindAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -491,7 +491,7 @@ void lilypondTransposePartNameAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_lilypondTransposePartNameAtom>*
     p =
-      dynamic_cast<visitor<S_lilypondTransposePartNameAtom>*> (v)) {
+      visitor<S_lilypondTransposePartNameAtom>::cast (v)) {
         S_lilypondTransposePartNameAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -527,7 +527,7 @@ void lilypondTransposePartNameAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_lilypondTransposePartNameAtom>*
     p =
-      dynamic_cast<visitor<S_lilypondTransposePartNameAtom>*> (v)) {
+      visitor<S_lilypondTransposePartNameAtom>::cast (v)) {
         S_lilypondTransposePartNameAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -896,7 +896,7 @@ void lilypondTransposePartIDAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_lilypondTransposePartIDAtom>*
     p =
-      dynamic_cast<visitor<S_lilypondTransposePartIDAtom>*> (v)) {
+      visitor<S_lilypondTransposePartIDAtom>::cast (v)) {
         S_lilypondTransposePartIDAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -932,7 +932,7 @@ void lilypondTransposePartIDAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_lilypondTransposePartIDAtom>*
     p =
-      dynamic_cast<visitor<S_lilypondTransposePartIDAtom>*> (v)) {
+      visitor<S_lilypondTransposePartIDAtom>::cast (v)) {
         S_lilypondTransposePartIDAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -1271,7 +1271,7 @@ void lilypondAbsoluteOctaveEntryAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_lilypondAbsoluteOctaveEntryAtom>*
     p =
-      dynamic_cast<visitor<S_lilypondAbsoluteOctaveEntryAtom>*> (v)) {
+      visitor<S_lilypondAbsoluteOctaveEntryAtom>::cast (v)) {
         S_lilypondAbsoluteOctaveEntryAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -1307,7 +1307,7 @@ void lilypondAbsoluteOctaveEntryAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_lilypondAbsoluteOctaveEntryAtom>*
     p =
-      dynamic_cast<visitor<S_lilypondAbsoluteOctaveEntryAtom>*> (v)) {
+      visitor<S_lilypondAbsoluteOctaveEntryAtom>::cast (v)) {
         S_lilypondAbsoluteOctaveEntryAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -1528,7 +1528,7 @@ void lilypondRelativeOctaveEntryAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_lilypondRelativeOctaveEntryAtom>*
     p =
-      dynamic_cast<visitor<S_lilypondRelativeOctaveEntryAtom>*> (v)) {
+      visitor<S_lilypondRelativeOctaveEntryAtom>::cast (v)) {
         S_lilypondRelativeOctaveEntryAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -1564,7 +1564,7 @@ void lilypondRelativeOctaveEntryAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_lilypondRelativeOctaveEntryAtom>*
     p =
-      dynamic_cast<visitor<S_lilypondRelativeOctaveEntryAtom>*> (v)) {
+      visitor<S_lilypondRelativeOctaveEntryAtom>::cast (v)) {
         S_lilypondRelativeOctaveEntryAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -1777,7 +1777,7 @@ void lilypondFixedOctaveEntryAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_lilypondFixedOctaveEntryAtom>*
     p =
-      dynamic_cast<visitor<S_lilypondFixedOctaveEntryAtom>*> (v)) {
+      visitor<S_lilypondFixedOctaveEntryAtom>::cast (v)) {
         S_lilypondFixedOctaveEntryAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -1813,7 +1813,7 @@ void lilypondFixedOctaveEntryAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_lilypondFixedOctaveEntryAtom>*
     p =
-      dynamic_cast<visitor<S_lilypondFixedOctaveEntryAtom>*> (v)) {
+      visitor<S_lilypondFixedOctaveEntryAtom>::cast (v)) {
         S_lilypondFixedOctaveEntryAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -2027,7 +2027,7 @@ void lilypondDurationsGenerationKindAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_lilypondDurationsGenerationKindAtom>*
     p =
-      dynamic_cast<visitor<S_lilypondDurationsGenerationKindAtom>*> (v)) {
+      visitor<S_lilypondDurationsGenerationKindAtom>::cast (v)) {
         S_lilypondDurationsGenerationKindAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -2063,7 +2063,7 @@ void lilypondDurationsGenerationKindAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_lilypondDurationsGenerationKindAtom>*
     p =
-      dynamic_cast<visitor<S_lilypondDurationsGenerationKindAtom>*> (v)) {
+      visitor<S_lilypondDurationsGenerationKindAtom>::cast (v)) {
         S_lilypondDurationsGenerationKindAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -2316,7 +2316,7 @@ void lilypondAccidentalStyleKindAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_lilypondAccidentalStyleKindAtom>*
     p =
-      dynamic_cast<visitor<S_lilypondAccidentalStyleKindAtom>*> (v)) {
+      visitor<S_lilypondAccidentalStyleKindAtom>::cast (v)) {
         S_lilypondAccidentalStyleKindAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -2352,7 +2352,7 @@ void lilypondAccidentalStyleKindAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_lilypondAccidentalStyleKindAtom>*
     p =
-      dynamic_cast<visitor<S_lilypondAccidentalStyleKindAtom>*> (v)) {
+      visitor<S_lilypondAccidentalStyleKindAtom>::cast (v)) {
         S_lilypondAccidentalStyleKindAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -2673,7 +2673,7 @@ void lilypondChordsDisplayAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_lilypondChordsDisplayAtom>*
     p =
-      dynamic_cast<visitor<S_lilypondChordsDisplayAtom>*> (v)) {
+      visitor<S_lilypondChordsDisplayAtom>::cast (v)) {
         S_lilypondChordsDisplayAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -2709,7 +2709,7 @@ void lilypondChordsDisplayAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_lilypondChordsDisplayAtom>*
     p =
-      dynamic_cast<visitor<S_lilypondChordsDisplayAtom>*> (v)) {
+      visitor<S_lilypondChordsDisplayAtom>::cast (v)) {
         S_lilypondChordsDisplayAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -3016,7 +3016,7 @@ void lilypondLyricsNotesDurationsKindAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_lilypondLyricsNotesDurationsKindAtom>*
     p =
-      dynamic_cast<visitor<S_lilypondLyricsNotesDurationsKindAtom>*> (v)) {
+      visitor<S_lilypondLyricsNotesDurationsKindAtom>::cast (v)) {
         S_lilypondLyricsNotesDurationsKindAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -3052,7 +3052,7 @@ void lilypondLyricsNotesDurationsKindAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_lilypondLyricsNotesDurationsKindAtom>*
     p =
-      dynamic_cast<visitor<S_lilypondLyricsNotesDurationsKindAtom>*> (v)) {
+      visitor<S_lilypondLyricsNotesDurationsKindAtom>::cast (v)) {
         S_lilypondLyricsNotesDurationsKindAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -3304,7 +3304,7 @@ void lilypondDynamicsTextSpannersStyleKindAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_lilypondDynamicsTextSpannersStyleKindAtom>*
     p =
-      dynamic_cast<visitor<S_lilypondDynamicsTextSpannersStyleKindAtom>*> (v)) {
+      visitor<S_lilypondDynamicsTextSpannersStyleKindAtom>::cast (v)) {
         S_lilypondDynamicsTextSpannersStyleKindAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -3340,7 +3340,7 @@ void lilypondDynamicsTextSpannersStyleKindAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_lilypondDynamicsTextSpannersStyleKindAtom>*
     p =
-      dynamic_cast<visitor<S_lilypondDynamicsTextSpannersStyleKindAtom>*> (v)) {
+      visitor<S_lilypondDynamicsTextSpannersStyleKindAtom>::cast (v)) {
         S_lilypondDynamicsTextSpannersStyleKindAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -5836,7 +5836,7 @@ void lpsr2lilypondOahGroup::acceptIn (basevisitor* v)
 
   if (visitor<S_lpsr2lilypondOahGroup>*
     p =
-      dynamic_cast<visitor<S_lpsr2lilypondOahGroup>*> (v)) {
+      visitor<S_lpsr2lilypondOahGroup>::cast (v)) {
         S_lpsr2lilypondOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -5872,7 +5872,7 @@ void lpsr2lilypondOahGroup::acceptOut (basevisitor* v)
 
   if (visitor<S_lpsr2lilypondOahGroup>*
     p =
-      dynamic_cast<visitor<S_lpsr2lilypondOahGroup>*> (v)) {
+      visitor<S_lpsr2lilypondOahGroup>::cast (v)) {
         S_lpsr2lilypondOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
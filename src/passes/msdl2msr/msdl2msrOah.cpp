@@ -456,7 +456,7 @@ void msdl2msrOahGroup::acceptIn (basevisitor* v)
 
   if (visitor<S_msdl2msrOahGroup>*
     p =
-      dynamic_cast<visitor<S_msdl2msrOahGroup>*> (v)) {
+      visitor<S_msdl2msrOahGroup>::cast (v)) {
         S_msdl2msrOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -492,7 +492,7 @@ void msdl2msrOahGroup::acceptOut (basevisitor* v)
 
   if (visitor<S_msdl2msrOahGroup>*
     p =
-      dynamic_cast<visitor<S_msdl2msrOahGroup>*> (v)) {
+      visitor<S_msdl2msrOahGroup>::cast (v)) {
         S_msdl2msrOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
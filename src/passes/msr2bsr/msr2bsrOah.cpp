@@ -199,7 +199,7 @@ void msr2bsrOahGroup::acceptIn (basevisitor* v)
 
   if (visitor<S_msr2bsrOahGroup>*
     p =
-      dynamic_cast<visitor<S_msr2bsrOahGroup>*> (v)) {
+      visitor<S_msr2bsrOahGroup>::cast (v)) {
         S_msr2bsrOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -235,7 +235,7 @@ void msr2bsrOahGroup::acceptOut (basevisitor* v)
 
   if (visitor<S_msr2bsrOahGroup>*
     p =
-      dynamic_cast<visitor<S_msr2bsrOahGroup>*> (v)) {
+      visitor<S_msr2bsrOahGroup>::cast (v)) {
         S_msr2bsrOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -160,7 +160,7 @@ void msr2lpsrScoreOutputKindAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_msr2lpsrScoreOutputKindAtom>*
     p =
-      dynamic_cast<visitor<S_msr2lpsrScoreOutputKindAtom>*> (v)) {
+      visitor<S_msr2lpsrScoreOutputKindAtom>::cast (v)) {
         S_msr2lpsrScoreOutputKindAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -196,7 +196,7 @@ void msr2lpsrScoreOutputKindAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_msr2lpsrScoreOutputKindAtom>*
     p =
-      dynamic_cast<visitor<S_msr2lpsrScoreOutputKindAtom>*> (v)) {
+      visitor<S_msr2lpsrScoreOutputKindAtom>::cast (v)) {
         S_msr2lpsrScoreOutputKindAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -498,7 +498,7 @@ void msr2lpsrOahGroup::acceptIn (basevisitor* v)
 
   if (visitor<S_msr2lpsrOahGroup>*
     p =
-      dynamic_cast<visitor<S_msr2lpsrOahGroup>*> (v)) {
+      visitor<S_msr2lpsrOahGroup>::cast (v)) {
         S_msr2lpsrOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -534,7 +534,7 @@ void msr2lpsrOahGroup::acceptOut (basevisitor* v)
 
   if (visitor<S_msr2lpsrOahGroup>*
     p =
-      dynamic_cast<visitor<S_msr2lpsrOahGroup>*> (v)) {
+      visitor<S_msr2lpsrOahGroup>::cast (v)) {
         S_msr2lpsrOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
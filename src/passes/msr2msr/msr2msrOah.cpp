@@ -152,7 +152,7 @@ void msrIgnorePartAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_msrIgnorePartAtom>*
     p =
-      dynamic_cast<visitor<S_msrIgnorePartAtom>*> (v)) {
+      visitor<S_msrIgnorePartAtom>::cast (v)) {
         S_msrIgnorePartAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -188,7 +188,7 @@ void msrIgnorePartAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_msrIgnorePartAtom>*
     p =
-      dynamic_cast<visitor<S_msrIgnorePartAtom>*> (v)) {
+      visitor<S_msrIgnorePartAtom>::cast (v)) {
         S_msrIgnorePartAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -482,7 +482,7 @@ void msrKeepPartAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_msrKeepPartAtom>*
     p =
-      dynamic_cast<visitor<S_msrKeepPartAtom>*> (v)) {
+      visitor<S_msrKeepPartAtom>::cast (v)) {
         S_msrKeepPartAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -518,7 +518,7 @@ void msrKeepPartAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_msrKeepPartAtom>*
     p =
-      dynamic_cast<visitor<S_msrKeepPartAtom>*> (v)) {
+      visitor<S_msrKeepPartAtom>::cast (v)) {
         S_msrKeepPartAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -747,6 +747,20 @@ R"(Avoid the msr2msr pass, for TESTS.)",
         "fAvoidMsr2msr",
         fAvoidMsr2msr));
 
+  // share MSR notes
+  // --------------------------------------
+
+  subGroup->
+    appendAtomToSubGroup (
+      oahBooleanAtom::create (
+        "share-msr-notes", "smn",
+R"(Let the second MSR share the notes of the first one
+instead of cloning them, when msr2msr doesn't change them.
+This saves time and memory on large scores,
+but the first MSR should not be used after msr2msr.)",
+        "fShareMsrNotes",
+        fShareMsrNotes));
+
   // expand to harmony band
   // --------------------------------------
 
@@ -1067,7 +1081,7 @@ void msr2msrOahGroup::acceptIn (basevisitor* v)
 
   if (visitor<S_msr2msrOahGroup>*
     p =
-      dynamic_cast<visitor<S_msr2msrOahGroup>*> (v)) {
+      visitor<S_msr2msrOahGroup>::cast (v)) {
         S_msr2msrOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -1103,7 +1117,7 @@ void msr2msrOahGroup::acceptOut (basevisitor* v)
 
   if (visitor<S_msr2msrOahGroup>*
     p =
-      dynamic_cast<visitor<S_msr2msrOahGroup>*> (v)) {
+      visitor<S_msr2msrOahGroup>::cast (v)) {
         S_msr2msrOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -1160,6 +1174,11 @@ void msr2msrOahGroup::displayMsr2msrOahValues (int valueFieldWidth)
     std::setw (valueFieldWidth) <<
     "fAvoidMsr2msr" << ": " <<
     fAvoidMsr2msr <<
+    std::endl <<
+
+    std::setw (valueFieldWidth) <<
+    "fShareMsrNotes" << ": " <<
+    fShareMsrNotes <<
     std::endl;
 
   --gIndenter;
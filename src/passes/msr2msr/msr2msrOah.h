@@ -243,6 +243,10 @@ class EXP msr2msrOahGroup : public oahGroup
     Bool                  getAvoidMsr2msr () const
                               { return fAvoidMsr2msr; }
 
+    // share the notes that msr2msr doesn't change?
+    Bool                  getShareMsrNotes () const
+                              { return fShareMsrNotes; }
+
     // book
     Bool                  getExpandToHarmonyBandBook () const
                               { return fExpandToHarmonyBandBook; }
@@ -346,6 +350,9 @@ class EXP msr2msrOahGroup : public oahGroup
     // avoid msr2msr? (for TESTS JMI ???)
     Bool                  fAvoidMsr2msr;
 
+    // share the notes that msr2msr doesn't change?
+    Bool                  fShareMsrNotes;
+
     // book
     Bool                  fExpandToHarmonyBandBook;
 
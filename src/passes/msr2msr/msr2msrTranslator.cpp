@@ -2843,8 +2843,10 @@ void msr2msrTranslator::visitStart (S_msrArticulation& elt)
 #endif // MF_TRACE_IS_ENABLED
 
   if (fOnGoingNonGraceNote) {
-    fCurrentNonGraceNoteClone->
-      appendArticulationToNote (elt);
+    if (! fCurrentNoteIsShared) {
+      fCurrentNonGraceNoteClone->
+        appendArticulationToNote (elt);
+    }
   }
   else if (fOnGoingChord) {
     fCurrentChordClone->
@@ -2902,8 +2904,10 @@ void msr2msrTranslator::visitStart (S_msrFermata& elt)
   // a fermata is an articulation
 
   if (fOnGoingNonGraceNote) {
-    fCurrentNonGraceNoteClone->
-      appendArticulationToNote (elt);
+    if (! fCurrentNoteIsShared) {
+      fCurrentNonGraceNoteClone->
+        appendArticulationToNote (elt);
+    }
   }
   else if (fOnGoingChord) {
     fCurrentChordClone->
@@ -2944,8 +2948,10 @@ void msr2msrTranslator::visitStart (S_msrArpeggiato& elt)
   // an arpeggiato is an articulation
 
   if (fOnGoingNonGraceNote) {
-    fCurrentNonGraceNoteClone->
-      appendArticulationToNote (elt); // addArpeggiatoToNote ??? JMI
+    if (! fCurrentNoteIsShared) {
+      fCurrentNonGraceNoteClone->
+        appendArticulationToNote (elt); // addArpeggiatoToNote ??? JMI
+    }
   }
   else if (fOnGoingChord) {
     fCurrentChordClone->
@@ -2986,8 +2992,10 @@ void msr2msrTranslator::visitStart (S_msrNonArpeggiato& elt)
   // an nonArpeggiato is an articulation
 
   if (fOnGoingNonGraceNote) {
-    fCurrentNonGraceNoteClone->
-      appendArticulationToNote (elt); // addArpeggiatoToNote ??? JMI
+    if (! fCurrentNoteIsShared) {
+      fCurrentNonGraceNoteClone->
+        appendArticulationToNote (elt); // addArpeggiatoToNote ??? JMI
+    }
   }
   else if (fOnGoingChord) {
     fCurrentChordClone->
@@ -3026,8 +3034,10 @@ void msr2msrTranslator::visitStart (S_msrTechnical& elt)
 #endif // MF_TRACE_IS_ENABLED
 
   if (fOnGoingNonGraceNote) {
-    fCurrentNonGraceNoteClone->
-      appendTechnicalToNote (elt);
+    if (! fCurrentNoteIsShared) {
+      fCurrentNonGraceNoteClone->
+        appendTechnicalToNote (elt);
+    }
   }
   else if (fOnGoingChord) {
     fCurrentChordClone->
@@ -3083,8 +3093,10 @@ void msr2msrTranslator::visitStart (S_msrTechnicalWithInteger& elt)
 #endif // MF_TRACE_IS_ENABLED
 
   if (fOnGoingNonGraceNote) {
-    fCurrentNonGraceNoteClone->
-      appendTechnicalWithIntegerToNote (elt);
+    if (! fCurrentNoteIsShared) {
+      fCurrentNonGraceNoteClone->
+        appendTechnicalWithIntegerToNote (elt);
+    }
   }
   else if (fOnGoingChord) {
     fCurrentChordClone->
@@ -3140,8 +3152,10 @@ void msr2msrTranslator::visitStart (S_msrTechnicalWithFloat& elt)
 #endif // MF_TRACE_IS_ENABLED
 
   if (fOnGoingNonGraceNote) {
-    fCurrentNonGraceNoteClone->
-      appendTechnicalWithFloatToNote (elt);
+    if (! fCurrentNoteIsShared) {
+      fCurrentNonGraceNoteClone->
+        appendTechnicalWithFloatToNote (elt);
+    }
   }
   else if (fOnGoingChord) {
     fCurrentChordClone->
@@ -3197,8 +3211,10 @@ void msr2msrTranslator::visitStart (S_msrTechnicalWithString& elt)
 #endif // MF_TRACE_IS_ENABLED
 
   if (fOnGoingNonGraceNote) {
-    fCurrentNonGraceNoteClone->
-      appendTechnicalWithStringToNote (elt);
+    if (! fCurrentNoteIsShared) {
+      fCurrentNonGraceNoteClone->
+        appendTechnicalWithStringToNote (elt);
+    }
   }
   else if (fOnGoingChord) {
     fCurrentChordClone->
@@ -3261,8 +3277,10 @@ void msr2msrTranslator::visitStart (S_msrOrnament& elt)
 #endif // MF_TRACE_IS_ENABLED
 
   if (fOnGoingNonGraceNote) {
-    fCurrentNonGraceNoteClone->
-      appendOrnamentToNote (elt);
+    if (! fCurrentNoteIsShared) {
+      fCurrentNonGraceNoteClone->
+        appendOrnamentToNote (elt);
+    }
   }
   else if (fOnGoingChord) {
     fCurrentChordClone->
@@ -3330,8 +3348,10 @@ void msr2msrTranslator::visitStart (S_msrSpanner& elt)
   } // switch
 
   if (fOnGoingNonGraceNote) {
-    fCurrentNonGraceNoteClone->
-      appendSpannerToNote (elt);
+    if (! fCurrentNoteIsShared) {
+      fCurrentNonGraceNoteClone->
+        appendSpannerToNote (elt);
+    }
   }
 
   else if (fOnGoingChord) {
@@ -3616,8 +3636,10 @@ void msr2msrTranslator::visitStart (S_msrDynamic& elt)
 #endif // MF_TRACE_IS_ENABLED
 
   if (fOnGoingNonGraceNote) {
-    fCurrentNonGraceNoteClone->
-      appendDynamicToNote (elt);
+    if (! fCurrentNoteIsShared) {
+      fCurrentNonGraceNoteClone->
+        appendDynamicToNote (elt);
+    }
   }
 
   else if (fOnGoingChord) {
@@ -3675,8 +3697,10 @@ void msr2msrTranslator::visitStart (S_msrOtherDynamic& elt)
 #endif // MF_TRACE_IS_ENABLED
 
   if (fOnGoingNonGraceNote) {
-    fCurrentNonGraceNoteClone->
-      appendOtherDynamicToNote (elt);
+    if (! fCurrentNoteIsShared) {
+      fCurrentNonGraceNoteClone->
+        appendOtherDynamicToNote (elt);
+    }
   }
   else if (fOnGoingChord) {
     fCurrentChordClone->
@@ -3734,8 +3758,10 @@ void msr2msrTranslator::visitStart (S_msrWords& elt)
   if (fOnGoingNonGraceNote || fOnGoingChord) {
     if (fOnGoingNonGraceNote) {
       // append the words to the current non-grace note clone
-      fCurrentNonGraceNoteClone->
-        appendWordsToNote (elt);
+      if (! fCurrentNoteIsShared) {
+        fCurrentNonGraceNoteClone->
+          appendWordsToNote (elt);
+      }
     }
     else if (fOnGoingChord) {
       // append the words to the current chord clone
@@ -3877,8 +3903,10 @@ void msr2msrTranslator::visitStart (S_msrSlur& elt)
 
   if (! fOnGoingNotesStack.empty ()) {
 //    if (fOnGoingNonGraceNote) {
-      fOnGoingNotesStack.front ()->
-        appendSlurToNote (elt);
+      if (! fCurrentNoteIsShared) {
+        fOnGoingNotesStack.front ()->
+          appendSlurToNote (elt);
+      }
 //    }
   }
 
@@ -4134,8 +4162,10 @@ void msr2msrTranslator::visitStart (S_msrCrescDecresc& elt)
 #endif // MF_TRACE_IS_ENABLED
 
   if (fOnGoingNonGraceNote) {
-    fCurrentNonGraceNoteClone->
-      appendCrescDecrescToNote (elt);
+    if (! fCurrentNoteIsShared) {
+      fCurrentNonGraceNoteClone->
+        appendCrescDecrescToNote (elt);
+    }
   }
   else if (fOnGoingChord) {
     fCurrentChordClone->
@@ -4191,8 +4221,10 @@ void msr2msrTranslator::visitStart (S_msrWedge& elt)
 #endif // MF_TRACE_IS_ENABLED
 
   if (fOnGoingNonGraceNote) {
-    fCurrentNonGraceNoteClone->
-      appendWedgeToNote (elt);
+    if (! fCurrentNoteIsShared) {
+      fCurrentNonGraceNoteClone->
+        appendWedgeToNote (elt);
+    }
   }
   else if (fOnGoingChord) {
     fCurrentChordClone->
@@ -4531,6 +4563,82 @@ void msr2msrTranslator::visitEnd (S_msrChordGraceNotesGroupLink& elt)
   fOnGoingChordGraceNotesGroupLink = false;
 }
 
+//________________________________________________________________________
+Bool msr2msrTranslator::noteCanBeShared (const S_msrNote& note) const
+{
+  if (! gGlobalMsr2msrOahGroup->getShareMsrNotes ()) {
+    return false;
+  }
+
+  // grace notes and double tremolos notes are handled with their group
+  switch (note->getNoteKind ()) {
+    case msrNoteKind::kNoteRestInMeasure:
+    case msrNoteKind::kNoteSkipInMeasure:
+    case msrNoteKind::kNoteUnpitchedInMeasure:
+    case msrNoteKind::kNoteRegularInMeasure:
+    case msrNoteKind::kNoteRegularInChord:
+    case msrNoteKind::kNoteRegularInTuplet:
+    case msrNoteKind::kNoteRestInTuplet:
+    case msrNoteKind::kNoteUnpitchedInTuplet:
+      break;
+
+    default:
+      return false;
+  } // switch
+
+  // the clones of pitched rests get their display pitch and octave
+  // as pitch and octave, see msrNote::initializeNote()
+  if (
+    note->fetchNoteIsARest ()
+      &&
+    note->getNoteDisplayOctaveKind () != msrOctaveKind::kOctave_UNKNOWN_
+  ) {
+    return false;
+  }
+
+  // the elements that msr2msr handles otherwise than by attaching them
+  // to the note clone, as well as the less frequent ones,
+  // lead to a clone of the note
+  return
+    ! note->getGraceNotesGroupBeforeNote ()
+      &&
+    ! note->getGraceNotesGroupAfterNote ()
+      &&
+    ! note->getNoteOctaveShift ()
+      &&
+    ! note->getNoteSingleTremolo ()
+      &&
+    note->getNoteHarmoniesList ().empty ()
+      &&
+    note->getNoteFiguredBassesList ().empty ()
+      &&
+    note->getNoteSyllablesList ().empty ()
+      &&
+    note->getNoteGlissandosList ().empty ()
+      &&
+    note->getNoteSlidesList ().empty ()
+      &&
+    note->getNoteLigaturesList ().empty ()
+      &&
+    note->getNoteSlashesList ().empty ()
+      &&
+    note->getNoteSegnosList ().empty ()
+      &&
+    note->getNoteDalSegnosList ().empty ()
+      &&
+    note->getNoteCodasList ().empty ()
+      &&
+    note->getNoteEyeGlassesList ().empty ()
+      &&
+    note->getNoteDampsList ().empty ()
+      &&
+    note->getNoteDampAllsList ().empty ()
+      &&
+    note->getNoteScordaturasList ().empty ()
+      &&
+    note->getNotePedalsList ().empty ();
+}
+
 //________________________________________________________________________
 void msr2msrTranslator::visitStart (S_msrNote& elt)
 {
@@ -4551,11 +4659,18 @@ void msr2msrTranslator::visitStart (S_msrNote& elt)
 
 //  displayCurrentOnGoingValues (); // JMI
 
-  // create the note clone
-  fCurrentNoteClone =
-    elt->
-      createNoteNewbornClone (
-        fCurrentPartClone);
+  // create the note clone, unless the note can be shared
+  fCurrentNoteIsShared = noteCanBeShared (elt);
+
+  if (fCurrentNoteIsShared) {
+    fCurrentNoteClone = elt;
+  }
+  else {
+    fCurrentNoteClone =
+      elt->
+        createNoteNewbornClone (
+          fCurrentPartClone);
+  }
 
   // register clone in this tranlastors' voice notes map and ongoing notes stack
   fVoiceNotesMap [elt] = fCurrentNoteClone; // JMI XXL
@@ -5227,6 +5342,8 @@ void msr2msrTranslator::visitEnd (S_msrNote& elt)
 
   // forget about current note
   fOnGoingNotesStack.pop_front ();
+
+  fCurrentNoteIsShared = false;
 }
 
 //________________________________________________________________________
@@ -5366,8 +5483,10 @@ void msr2msrTranslator::visitStart (S_msrStem& elt)
 #endif // MF_TRACE_IS_ENABLED
 
   if (fOnGoingNonGraceNote) {
-    fCurrentNonGraceNoteClone->
-      setNoteStem (elt);
+    if (! fCurrentNoteIsShared) {
+      fCurrentNonGraceNoteClone->
+        setNoteStem (elt);
+    }
   }
   else if (fOnGoingChord) {
     fCurrentChordClone->
@@ -5434,8 +5553,10 @@ void msr2msrTranslator::visitStart (S_msrBeam& elt)
       appendBeamToNote (elt);
   }
   else if (fOnGoingNonGraceNote) {
-    fCurrentNonGraceNoteClone->
-      appendBeamToNote (elt);
+    if (! fCurrentNoteIsShared) {
+      fCurrentNonGraceNoteClone->
+        appendBeamToNote (elt);
+    }
   }
 
 //   if (fOnGoingChord) { // else ??? JMI
@@ -5837,8 +5958,10 @@ void msr2msrTranslator::visitStart (S_msrTie& elt)
 #endif // MF_TRACE_IS_ENABLED
 
   if (fOnGoingNonGraceNote) {
-    fCurrentNonGraceNoteClone->
-      appendTieToNote (elt);
+    if (! fCurrentNoteIsShared) {
+      fCurrentNonGraceNoteClone->
+        appendTieToNote (elt);
+    }
   }
   else if (fOnGoingChord) {
     fCurrentChordClone->
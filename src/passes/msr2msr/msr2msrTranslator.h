@@ -762,6 +762,13 @@ class EXP msr2msrTranslator :
     // is being visited too
     S_msrNote                 fCurrentNonGraceNoteClone;
 
+    // with option '-share-msr-notes', the notes that msr2msr doesn't change
+    // are shared with the first MSR instead of being cloned:
+    // fCurrentNonGraceNoteClone is then the note being visited itself,
+    // which already contains the elements attached to it
+    Bool                      fCurrentNoteIsShared;
+    Bool                      noteCanBeShared (const S_msrNote& note) const;
+
     // to help workaround LilyPond_Issue_34 JMI ??? 0.9.70
     S_msrNote                 fFirstNoteCloneInVoice;
 
@@ -103,6 +103,20 @@ R"(Generate initial comments showing the MusicXML generation informations.)",
 R"(Generate comments showing the structure of the score.)",
         "fMusicXMLComments",
         fMusicXMLComments));
+
+  // compact output
+  // --------------------------------------
+
+  fCompactMusicXML = false;
+
+  subGroup->
+    appendAtomToSubGroup (
+      oahBooleanAtom::create (
+        "compact-musicxml", "cmxml",
+R"(Generate MusicXML without line breaks nor indentation between the elements.
+This produces smaller files that are faster to write.)",
+        "fCompactMusicXML",
+        fCompactMusicXML));
 }
 
 void msr2mxsr2msrOahGroup::initializeWorkAndMovementOptions ()
@@ -205,7 +219,7 @@ void msr2mxsr2msrOahGroup::acceptIn (basevisitor* v)
 
   if (visitor<S_msr2mxsr2msrOahGroup>*
     p =
-      dynamic_cast<visitor<S_msr2mxsr2msrOahGroup>*> (v)) {
+      visitor<S_msr2mxsr2msrOahGroup>::cast (v)) {
         S_msr2mxsr2msrOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -241,7 +255,7 @@ void msr2mxsr2msrOahGroup::acceptOut (basevisitor* v)
 
   if (visitor<S_msr2mxsr2msrOahGroup>*
     p =
-      dynamic_cast<visitor<S_msr2mxsr2msrOahGroup>*> (v)) {
+      visitor<S_msr2mxsr2msrOahGroup>::cast (v)) {
         S_msr2mxsr2msrOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -74,6 +74,9 @@ class EXP msr2mxsr2msrOahGroup : public oahGroup
     Bool                  getMusicXMLComments () const
                               { return fMusicXMLComments; }
 
+    Bool                  getCompactMusicXML () const
+                              { return fCompactMusicXML; }
+
     // work and movement
     std::string           getWorkCreditTypeTitle () const
                               { return fWorkCreditTypeTitle; }
@@ -133,6 +136,8 @@ class EXP msr2mxsr2msrOahGroup : public oahGroup
 
     Bool                  fMusicXMLComments;
 
+    Bool                  fCompactMusicXML;
+
     // work and movement
     std::string           fWorkCreditTypeTitle;
     std::string           fWorkNumber;
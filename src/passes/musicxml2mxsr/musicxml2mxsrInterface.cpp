@@ -11,7 +11,6 @@
 
 #include <string.h> // for strlen()
 #include <fstream>      // std::ofstream, std::ofstream::open(), std::ofstream::close()
-#include <regex>
 
 #include <iomanip> // for setw()
 
@@ -108,294 +107,6 @@ void displayMusicXMLDocumentType (
   --gIndenter;
 }
 
-//_______________________________________________________________________________
-std::string uncompressMXLFile (
-  std::string mxlFileName)
-{
-  std::string fileBaseName = mfBaseName (mxlFileName);
-
-  gLog <<
-    "The compressed file name is '" <<
-    mxlFileName <<
-    '\'' <<
-    std::endl << std::endl;
-
-  std::string uncompressedFileName;
-
-#ifdef WIN32
-  // JMI
-#else
-  {
-    // build shell command to list the contents of the uncompress file
-    std::stringstream s1;
-
-    s1 <<
-      "unzip -l " <<
-      mxlFileName;
-
-    std::string listContentsShellCommand = s1.str ();
-
-    if (true) { // JMI
-      gLog <<
-        "Listing the contents of the compressed file '" <<
-        mxlFileName <<
-        "' with command:" <<
-        std::endl;
-
-      ++gIndenter;
-
-      gLog <<
-        listContentsShellCommand <<
-        std::endl << std::endl;
-
-      --gIndenter;
-    }
-
-      // create a stream to receive the result of listContentsShellCommand
-    FILE* inputStream =
-      popen (
-        listContentsShellCommand.c_str (),
-        "r");
-
-    if (inputStream == nullptr) {
-      std::stringstream ss;
-
-      ss <<
-        "Cannot list the contents of compressed file '" <<
-        mxlFileName <<
-        "' with 'popen ()'";
-
-      musicxml2mxsrInternalError (
-        gServiceRunData->getInputSourceName (),
-        0, // inputLineNumber
-        __FILE__, mfInputLineNumber (__LINE__),
-        ss.str ());
-    }
-
-    else {
-      std::string contentsList;
-
-      // read the list from inputStream
-      char tampon [1024];
-
-      while (
-        ! feof (inputStream)
-          &&
-        ! ferror (inputStream)
-          &&
-        fgets (tampon, sizeof (tampon), inputStream) != NULL
-        ) {
-        // append the contents of tampon to contentsList
-        contentsList += tampon;
-      } // while
-      // terminate the std::string in tampon
-      tampon [strlen (tampon) -1] = '\0';
-
-      // close the stream
-      if (pclose (inputStream) < 0) {
-        musicxml2mxsrInternalError (
-          gServiceRunData->getInputSourceName (),
-          0, // inputLineNumber
-          __FILE__, mfInputLineNumber (__LINE__),
-          "Cannot close the input stream after 'popen ()'");
-      }
-
-      gLog <<
-        "The contents of the compressed file '" <<
-        mxlFileName <<
-        "' is:" <<
-        std::endl;
-
-      ++gIndenter;
-
-      gLog <<
-        contentsList <<
-        std::endl;
-
-      --gIndenter;
-
-      // analyze the contents list
-      std::list <std::string> linesList;
-
-      std::istringstream inputStream (contentsList);
-      std::string        currentLine;
-
-      while (getline (inputStream, currentLine)) {
-
-        if (inputStream.eof ()) break;
-
-#ifdef MF_TRACE_IS_ENABLED
-        {
-          gLog <<
-            "*** currentLine:" <<
-            std::endl;
-
-          ++gIndenter;
-
-          gLog <<
-            currentLine <<
-            std::endl;
-
-          --gIndenter;
-        }
-#endif // MF_TRACE_IS_ENABLED
-
-        /*
-        user@lilydev: ~/libmusicxml-git/musicxml > unzip -l UnofficialTestSuite/90a-Compressed-MusicXML.mxl
-        Archive:  UnofficialTestSuite/90a-Compressed-MusicXML.mxl
-          Length      Date    Time    Name
-        ---------  ---------- -----   ----
-                0  2007-11-14 16:04   META-INF/
-              246  2007-11-14 16:02   META-INF/container.xml
-             2494  2008-11-14 23:03   20a-Compressed-MusicXML.xml
-            30903  2007-11-14 15:51   20a-Compressed-MusicXML.pdf
-        ---------                     -------
-            33643                     4 files
-        */
-
-        std::string regularExpression (
-          "[[:space:]]*"
-          ".*"            // length
-          "[[:space:]]+"
-          ".*"            // date
-          "[[:space:]]+"
-          ".*"            // time
-          "[[:space:]]+"
-          "(.*)"          // name
-          );
-
-        std::regex  e (regularExpression);
-        std::smatch sm;
-
-        regex_match (currentLine, sm, e);
-
-        if (sm.size ()) {
-#ifdef MF_TRACE_IS_ENABLED
-          if (gEarlyOptions.getEarlyTracePasses ()) { // JMI ???
-            gLog <<
-              "There are " << sm.size () - 1 << " match(es) " <<
-              "with std::regex '" << regularExpression <<
-              "':" <<
-              std::endl;
-
-            for (unsigned i = 1; i < sm.size (); ++i) {
-              gLog <<
-                '[' << sm [i] << "] " <<
-                std::endl;
-            } // for
-
-            gLog <<
-              std::endl << std::endl;
-          }
-#endif // MF_TRACE_IS_ENABLED
-
-          std::string stringFromLine = sm [1];
-
-          // has stringFromLine a ".xml" suffix?
-          size_t
-            posInString =
-              stringFromLine.rfind (".xml");
-
-          // JMI if (posInString == stringFromLine.size () - 4) {
-          if (posInString != stringFromLine.npos) {  // JMI STRANGISSIMO!!!
-    //      if (posInString != stringFromLine.npos && stringFromLine != "files") {  // JMI STRANGISSIMO!!!
-            // yes, this is a MusicXML file
-
-            // is this file part of META-INF?
-            size_t
-              posInString =
-                stringFromLine.find ("META-INF");
-
-            if (posInString == stringFromLine.npos) {
-              // no, this is an actual MusicXML file
-
-              if (uncompressedFileName.size ()) {
-                std::stringstream ss;
-
-                ss <<
-                  "Compressed file '" << mxlFileName <<
-                  "' contains multiple MusicMXL files" <<
-                  ", found '" << uncompressedFileName <<
-                  "' and then '" << stringFromLine << "'";
-
-                musicxml2mxsrInternalError (
-                  gServiceRunData->getInputSourceName (),
-                  0, // inputLineNumber
-                  __FILE__, mfInputLineNumber (__LINE__),
-                  ss.str ());
-              }
-
-              else {
-                // we've got the uncompressed file name
-                uncompressedFileName = stringFromLine;
-
-                gLog <<
-                  "The uncompressed file name is '" <<
-                  uncompressedFileName <<
-                  '\'' <<
-                  std::endl << std::endl;
-              }
-            }
-          }
-        }
-      } // while
-    }
-  }
-
-  {
-    // build shell command to uncompress the file
-    std::stringstream s2;
-
-    s2 <<
-      "unzip -u -d /tmp " <<
-      mxlFileName;
-
-    std::string uncompressShellCommand = s2.str ();
-
-    if (true) { // JMI
-      gLog <<
-        "Uncompressing '" <<
-        mxlFileName <<
-        "' into '/tmp/" <<
-        uncompressedFileName <<
-        "' with command:" <<
-        std::endl;
-
-      ++gIndenter;
-
-      gLog <<
-        uncompressShellCommand <<
-        std::endl << std::endl;
-
-      --gIndenter;
-    }
-
-    // create a stream to receive the result of uncompressShellCommand
-    FILE* inputStream =
-      popen (
-        uncompressShellCommand.c_str (),
-        "r");
-
-    if (inputStream == nullptr) {
-      std::stringstream ss;
-
-      ss <<
-        "Cannot uncompress the file '" <<
-        mxlFileName <<
-        "' with 'popen ()'";
-
-      musicxml2mxsrInternalError (
-        gServiceRunData->getInputSourceName (),
-        0, // inputLineNumber
-        __FILE__, mfInputLineNumber (__LINE__),
-        ss.str ());
-    }
-  }
-#endif // WIN32
-
-  return uncompressedFileName;
-}
-
 //_______________________________________________________________________________
 void checkDesiredEncoding (
   const std::string& encoding,
@@ -470,7 +181,7 @@ void checkSXMLFile (
   TXMLDecl * xmlDecl = sxmlfile->getXMLDecl ();
 
 #ifdef MF_TRACE_IS_ENABLED
-  if (gGlobalMxsr2msrOahGroup->getTraceEncoding ()) {
+  if (xmlDecl && gGlobalMxsr2msrOahGroup->getTraceEncoding ()) {
     gLog <<
       std::endl <<
       "!!!!! xmlDecl contents from file:" <<
@@ -486,7 +197,7 @@ void checkSXMLFile (
   // get the docType
   TDocType * docType = sxmlfile->getDocType ();
 
-  if (gGlobalMxsr2msrOahGroup->getTraceEncoding ()) {
+  if (docType && gGlobalMxsr2msrOahGroup->getTraceEncoding ()) {
     gLog <<
       std::endl <<
       "!!!!! docType from file:" <<
@@ -499,7 +210,12 @@ void checkSXMLFile (
 #endif // MF_TRACE_IS_ENABLED
 
   // get the encoding type
-  std::string encoding = xmlDecl->getEncoding ();
+  // the XML declaration is optional for the in place scanner
+  std::string encoding;
+
+  if (xmlDecl) {
+    encoding = xmlDecl->getEncoding ();
+  }
 
 #ifdef MF_TRACE_IS_ENABLED
   if (gGlobalMxsr2msrOahGroup->getTraceEncoding ()) {
@@ -522,6 +238,40 @@ void checkSXMLFile (
     "UTF-8");
 }
 
+//_______________________________________________________________________________
+static SXMLFile readSXMLFileFromFile (
+  xmlreader&  r,
+  const char* fileName)
+{
+  // has the input file name a ".mxl" suffix?
+  std::string fileNameAsString = fileName;
+
+  size_t
+    posInString =
+      fileNameAsString.rfind (".mxl");
+
+  if (
+    posInString != fileNameAsString.npos
+      &&
+    posInString == fileNameAsString.size () - 4
+  ) {
+    // yes, this is a compressed file, inflate its root file in memory
+    return r.readmxl (fileName);
+  }
+  else if (
+    gGlobalMxsr2msrOahGroup
+      &&
+    gGlobalMxsr2msrOahGroup->getFlexMusicXMLReader ()
+  ) {
+    // read the file byte after byte with the flex/bison parser
+    return r.read (fileName);
+  }
+  else {
+    // map the file in memory and scan it in place
+    return r.readmapped (fileName);
+  }
+}
+
 //_______________________________________________________________________________
 SXMLFile createSXMLFileFromFile (
   const char*        fileName,
@@ -576,7 +326,29 @@ SXMLFile createSXMLFileFromFile (
 
   xmlreader r;
 
-  sxmlfile = r.read (fileName);
+  if (
+    gGlobalMxsr2msrOahGroup
+      &&
+    gGlobalMxsr2msrOahGroup->getStreamMusicXMLInput ()
+  ) {
+    // a lightweight scan only, the MXSR is reduced to its root element:
+    // the measures are visited while reading the file again in passes 2 and 3
+    r.stream (nullptr, 1);
+  }
+
+  else if (
+    gGlobalMxsr2msrOahGroup
+      &&
+    gGlobalMxsr2msrOahGroup->getArenaMusicXMLTrees ()
+  ) {
+    // allocate the MXSR in an arena
+    r.useArena (true);
+  }
+
+  sxmlfile =
+    readSXMLFileFromFile (
+      r,
+      fileName);
 
   // has there been a problem?
   if (! sxmlfile) {
@@ -601,6 +373,45 @@ SXMLFile createSXMLFileFromFile (
   return sxmlfile;
 }
 
+//_______________________________________________________________________________
+SXMLFile streamSXMLFileFromFile (
+  const char*  fileName,
+  basevisitor* visitor)
+{
+  xmlreader r;
+
+  // the measures are browsed by visitor as soon as they are read,
+  // and then released
+  r.stream (visitor, 2);
+
+  SXMLFile
+    sxmlfile =
+      readSXMLFileFromFile (
+        r,
+        fileName);
+
+  if (! sxmlfile) {
+    std::stringstream ss;
+
+    ss <<
+      "cannot read MusicXML file \"" <<
+      fileName <<
+      "\" in streaming mode";
+
+    std::string message = ss.str ();
+
+    musicxml2mxsrError (
+      gServiceRunData->getInputSourceName (),
+      1, // inputLineNumber,
+      __FILE__, mfInputLineNumber (__LINE__),
+      message);
+
+    throw musicxml2mxsrException (message);
+  }
+
+  return sxmlfile;
+}
+
 //_______________________________________________________________________________
 SXMLFile createSXMLFileFromFd (
   FILE*              fd,
@@ -774,51 +585,27 @@ EXP Sxmlelement musicxmlFile2mxsr (
   }
 #endif // MF_TRACE_IS_ENABLED
 
+  // read the input MusicXML data from the file
+  xmlreader r;
+
+  SXMLFile sxmlfile;
+
   // has the input file name a ".mxl" suffix?
   size_t
     posInString =
       fileNameAsString.rfind (".mxl");
 
-  if (posInString == fileNameAsString.size () - 4) {
- // JMI  if (posInString != fileNameAsString.npos) {
-    // yes, this is a compressed file
-
-    /* JMI OS dependent
-    std::string uncompressedFileName =
-      uncompressMXLFile (
-        fileNameAsString);
-
-    // the incompressed file in /tmp will be handled
-    // instead of the compressed one
-    fileName = uncompressedFileName.c_str ();
-    */
-
-    std::stringstream ss;
-
-    ss <<
-      "you should uncompress file " <<
-      fileNameAsString <<
-      " prior to running xml2ly";
-
-    std::string message = ss.str ();
-
-    musicxml2mxsrError (
-      gServiceRunData->getInputSourceName (),
-      1, // inputLineNumber,
-      __FILE__, mfInputLineNumber (__LINE__),
-      message);
-
-    gLog <<
-      message <<
-      std::endl;
-
-    throw musicxml2mxsrException (message);
+  if (
+    posInString != fileNameAsString.npos
+      &&
+    posInString == fileNameAsString.size () - 4
+  ) {
+    // yes, this is a compressed file, inflate its root file in memory
+    sxmlfile = r.readmxl (fileName);
+  }
+  else {
+    sxmlfile = r.read (fileName);
   }
-
-  // read the input MusicXML data from the file
-  xmlreader r;
-
-  SXMLFile sxmlfile = r.read (fileName);
 
   // has there been a problem?
   if (! sxmlfile) {
@@ -1092,24 +879,6 @@ Sxmlelement convertMusicXMLToMxsr ( // JMI UNUSED SAX ???
   else {
     // input comes from a file
 
-    // has the input file name a ".mxl" suffix?
-    size_t
-      posInString =
-        inputSourceName.rfind (".mxl");
-
-    if (posInString == inputSourceName.size () - 4) {
-      std::stringstream ss;
-
-      ss <<
-        "compressed MusicXML files are not handled by xml2ly currently - quitting";
-
-      musicxml2mxsrError (
-        inputSourceName,
-        0, // inputLineNumber
-        __FILE__, mfInputLineNumber (__LINE__),
-        ss.str ());
-    }
-
     // OK, let's go ahead
     theMxsr =
       musicxmlFile2mxsr (
@@ -13,6 +13,7 @@
 #define ___musicxml2mxsrInterface___
 
 #include "typedefs.h"
+#include "xmlfile.h"
 
 #include "mxsr2msrOah.h"
 
@@ -76,6 +77,20 @@ EXP SXMLFile createSXMLFileFromFile (
   mfPassIDKind       passIDKind,
   const std::string& passDescription);
 
+//_______________________________________________________________________________
+/*!
+  \brief Reads a MusicXML file in streaming mode.
+  \param fileName a file name
+  \param visitor the visitor that browses the measures as soon as they are read
+  \return the MXSR file, reduced to its root element
+
+  Each measure is released once browsed, and the other elements
+  are visited in and out around the measures, as when browsing the whole MXSR.
+*/
+EXP SXMLFile streamSXMLFileFromFile (
+  const char*  fileName,
+  basevisitor* visitor);
+
 //_______________________________________________________________________________
 EXP SXMLFile createSXMLFileFromFd (
   FILE*              fd,
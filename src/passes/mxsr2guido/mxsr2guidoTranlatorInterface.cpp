@@ -89,6 +89,10 @@ void translateMxsrToGuido (
       getGenerateGuidoBars ().getBareValue (),
     0); // partNum, i.e. all parts
 
+  v.generatePartsInParallel (
+    gGlobalGuidoGenerationOahGroup->
+      getGenerateGuidoPartsInParallel ().getBareValue ());
+
   Sguidoelement
     guidoData = v.convert (theMxsr);
 
@@ -235,7 +235,7 @@ void msrReplaceClefAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_msrReplaceClefAtom>*
     p =
-      dynamic_cast<visitor<S_msrReplaceClefAtom>*> (v)) {
+      visitor<S_msrReplaceClefAtom>::cast (v)) {
         S_msrReplaceClefAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -271,7 +271,7 @@ void msrReplaceClefAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_msrReplaceClefAtom>*
     p =
-      dynamic_cast<visitor<S_msrReplaceClefAtom>*> (v)) {
+      visitor<S_msrReplaceClefAtom>::cast (v)) {
         S_msrReplaceClefAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -535,6 +535,10 @@ void mxsr2msrOahGroup::initializeMxsr2msrOahGroup ()
   initializeMxsr2msrTraceOptions ();
 #endif // MF_TRACE_IS_ENABLED
 
+  // MusicXML input
+  // --------------------------------------
+  initializeMxsr2msrMusicXMLInputOptions ();
+
   // parts
   // --------------------------------------
   initializeMxsr2msrEventsOptions ();
@@ -737,6 +741,73 @@ R"(Write a trace of the MXSR visiting activity to standard error.)",
 }
 #endif // MF_TRACE_IS_ENABLED
 
+void mxsr2msrOahGroup::initializeMxsr2msrMusicXMLInputOptions ()
+{
+  S_oahSubGroup subGroup =
+    oahSubGroup::create (
+      "MusicXML input",
+      "help-mxsr-to-msr-musicxml-input", "hmx2minput",
+R"()",
+    oahElementVisibilityKind::kElementVisibilityWhole,
+    this);
+
+  appendSubGroupToGroup (subGroup);
+
+  // flex MusicXML reader
+  // --------------------------------------
+
+  subGroup->
+    appendAtomToSubGroup (
+      oahBooleanAtom::create (
+        "flex-musicxml-reader", "flexmr",
+R"(MusicXML files are memory mapped and scanned in place by default.
+This option causes them to be read byte after byte by the flex/bison parser instead.)",
+        "fFlexMusicXMLReader",
+        fFlexMusicXMLReader));
+
+  // arena MusicXML trees
+  // --------------------------------------
+
+  subGroup->
+    appendAtomToSubGroup (
+      oahBooleanAtom::create (
+        "arena-musicxml-trees", "arenamt",
+R"(Allocate the MXSR elements and attributes in a memory arena,
+released at once with the MXSR instead of element after element.)",
+        "fArenaMusicXMLTrees",
+        fArenaMusicXMLTrees));
+
+  // stream MusicXML input
+  // --------------------------------------
+
+  subGroup->
+    appendAtomToSubGroup (
+      oahBooleanAtom::create (
+        "stream-musicxml-input", "streammi",
+R"(Read MusicXML files measure after measure, each measure being
+converted to MSR as soon as it is read and released afterwards,
+instead of building the whole MXSR first.
+This lowers the memory needed for very large scores.
+Option '-arena-musicxml-trees, -arenamt' is then ignored.)",
+        "fStreamMusicXMLInput",
+        fStreamMusicXMLInput));
+
+  // fuse MXSR to MSR passes
+  // --------------------------------------
+
+  subGroup->
+    appendAtomToSubGroup (
+      oahBooleanAtom::create (
+        "fuse-mxsr-to-msr-passes", "fusemmp",
+R"(Build the MSR skeleton and populate it in a single browsing of the MXSR,
+each part being populated right after its skeleton has been built,
+instead of browsing the whole MXSR twice.
+The MSR skeleton cannot be displayed then.
+This option is ignored with option '-stream-musicxml-input, -streammi'.)",
+        "fFuseMxsrToMsrPasses",
+        fFuseMxsrToMsrPasses));
+}
+
 void mxsr2msrOahGroup::initializeMxsr2msrEventsOptions ()
 {
   S_oahSubGroup subGroup =
@@ -2195,7 +2266,7 @@ void mxsr2msrOahGroup::acceptIn (basevisitor* v)
 
   if (visitor<S_mxsr2msrOahGroup>*
     p =
-      dynamic_cast<visitor<S_mxsr2msrOahGroup>*> (v)) {
+      visitor<S_mxsr2msrOahGroup>::cast (v)) {
         S_mxsr2msrOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -2231,7 +2302,7 @@ void mxsr2msrOahGroup::acceptOut (basevisitor* v)
 
   if (visitor<S_mxsr2msrOahGroup>*
     p =
-      dynamic_cast<visitor<S_mxsr2msrOahGroup>*> (v)) {
+      visitor<S_mxsr2msrOahGroup>::cast (v)) {
         S_mxsr2msrOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -2275,6 +2346,34 @@ void mxsr2msrOahGroup::printMxsr2msrValues (int valueFieldWidth)
 
   ++gIndenter;
 
+  // MusicXML input
+  // --------------------------------------
+
+  gLog <<
+    "MusicXML input:" <<
+    std::endl;
+
+  ++gIndenter;
+
+  gLog << std::left <<
+    std::setw (valueFieldWidth) << "fFlexMusicXMLReader" << ": " <<
+    fFlexMusicXMLReader <<
+    std::endl <<
+
+    std::setw (valueFieldWidth) << "fArenaMusicXMLTrees" << ": " <<
+    fArenaMusicXMLTrees <<
+    std::endl <<
+
+    std::setw (valueFieldWidth) << "fStreamMusicXMLInput" << ": " <<
+    fStreamMusicXMLInput <<
+    std::endl <<
+
+    std::setw (valueFieldWidth) << "fFuseMxsrToMsrPasses" << ": " <<
+    fFuseMxsrToMsrPasses <<
+    std::endl;
+
+  --gIndenter;
+
   // parts
   // --------------------------------------
 
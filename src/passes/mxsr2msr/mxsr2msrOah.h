@@ -167,6 +167,21 @@ class EXP mxsr2msrOahGroup : public oahGroup
 //     Bool                  getUseMxsrEvents () const
 //                               { return fUseMxsrEvents; }
 
+    // MusicXML input
+    // --------------------------------------
+
+    Bool                  getFlexMusicXMLReader () const
+                              { return fFlexMusicXMLReader; }
+
+    Bool                  getArenaMusicXMLTrees () const
+                              { return fArenaMusicXMLTrees; }
+
+    Bool                  getStreamMusicXMLInput () const
+                              { return fStreamMusicXMLInput; }
+
+    Bool                  getFuseMxsrToMsrPasses () const
+                              { return fFuseMxsrToMsrPasses; }
+
     // prefix options
     // --------------------------------------
 
@@ -571,6 +586,8 @@ class EXP mxsr2msrOahGroup : public oahGroup
     void                  initializeMxsr2msrTraceOptions ();
 #endif // MF_TRACE_IS_ENABLED
 
+    void                  initializeMxsr2msrMusicXMLInputOptions ();
+
     void                  initializeMxsr2msrEventsOptions (); // (temporary from 0.9.72)
 
     void                  initializeMxsr2msrPartsOptions ();
@@ -626,6 +643,17 @@ class EXP mxsr2msrOahGroup : public oahGroup
 //
 //     Bool                  fUseMxsrEvents;
 
+    // MusicXML input
+    // --------------------------------------
+
+    Bool                  fFlexMusicXMLReader;
+
+    Bool                  fArenaMusicXMLTrees;
+
+    Bool                  fStreamMusicXMLInput;
+
+    Bool                  fFuseMxsrToMsrPasses;
+
     // prefix options
     // --------------------------------------
 
@@ -32,6 +32,8 @@
 
 #include "mxsr2msrSkeletonBuilder.h"
 
+#include "musicxml2mxsrInterface.h"
+
 #include "waeHandlers.h"
 
 
@@ -131,22 +133,38 @@ void mxsr2msrSkeletonBuilder::browseMxsr (
     // browse the MXSR
     browser.browse (*theMxsr);
 
-		// sort the fResultingEventsCollection MXSR events lists
-		fResultingEventsCollection.sortTheMxsrEventsLists ();
+    finalizeBrowsing ();
+  }
+}
+
+void mxsr2msrSkeletonBuilder::browseMusicXMLFile (
+  const char* fileName)
+{
+  // browse the measures while reading the file
+  streamSXMLFileFromFile (
+    fileName,
+    this);
+
+  finalizeBrowsing ();
+}
+
+void mxsr2msrSkeletonBuilder::finalizeBrowsing ()
+{
+  // sort the fResultingEventsCollection MXSR events lists
+  fResultingEventsCollection.sortTheMxsrEventsLists ();
 
 #ifdef MF_TRACE_IS_ENABLED
-    if (gTraceOahGroup->getDisplayMxsrEvents ()) {
-      gLog <<
-        std::endl <<
-        "The MSR skeleton builder collected the following MXSR events:" <<
-        std::endl;
+  if (gTraceOahGroup->getDisplayMxsrEvents ()) {
+    gLog <<
+      std::endl <<
+      "The MSR skeleton builder collected the following MXSR events:" <<
+      std::endl;
 
-      ++gIndenter;
-      fResultingEventsCollection.print (gLog);
-      --gIndenter;
-    }
-#endif // MF_TRACE_IS_ENABLED
+    ++gIndenter;
+    fResultingEventsCollection.print (gLog);
+    --gIndenter;
   }
+#endif // MF_TRACE_IS_ENABLED
 }
 
 //______________________________________________________________________________
@@ -2215,6 +2233,18 @@ void mxsr2msrSkeletonBuilder::visitEnd (S_score_partwise& elt)
   }
 #endif // MF_TRACE_IS_ENABLED
 
+  registerScoreMeasureNumbers ();
+
+/* JMI ??? THROW AWAY ??? 0.9.69
+  // fetch the identification from the credits if any
+  fMsrScore ->
+    fetchIdentificationFromCreditsIfAny (
+      elt->getInputLineNumber ());
+      */
+}
+
+void mxsr2msrSkeletonBuilder::registerScoreMeasureNumbers ()
+{
   // register the first and last measure numbers and measures number in the score JMI 0.9.68
   fMsrScore->
     setScoreFirstMeasureNumber (
@@ -2243,13 +2273,6 @@ void mxsr2msrSkeletonBuilder::visitEnd (S_score_partwise& elt)
   serviceRunData->
     setScoreMeasuresNumber (
       fScoreMeasuresNumber);
-
-/* JMI ??? THROW AWAY ??? 0.9.69
-  // fetch the identification from the credits if any
-  fMsrScore ->
-    fetchIdentificationFromCreditsIfAny (
-      elt->getInputLineNumber ());
-      */
 }
 
 //______________________________________________________________________________
@@ -234,6 +234,16 @@ class EXP mxsr2msrSkeletonBuilder :
     void                      browseMxsr (
                                 const Sxmlelement& xmlTree);
 
+    void                      browseMusicXMLFile (
+                                const char* fileName);
+
+    // fused building and population, see buildAndPopulateMsrFromMxsr():
+    // the parts are browsed one at a time,
+    // the score measure numbers being known after the first one
+    void                      registerScoreMeasureNumbers ();
+
+    void                      finalizeBrowsing ();
+
   protected:
 
     // score partwise
@@ -42,21 +42,14 @@ namespace MusicFormats
 {
 
 //_______________________________________________________________________________
-S_msrScore translateMxsrToMsrSkeleton (
+// the MXSR is browsed if present, otherwise the file is read in streaming mode
+static S_msrScore translateToMsrSkeleton (
   const Sxmlelement&    theMxsr,
+  const char*           fileName,
   mxsrEventsCollection& theResultingEventsCollection,
-  const S_msrOahGroup&  msrOpts,
   mfPassIDKind          passIDKind,
   const std::string&    passDescription)
 {
-#ifdef MF_SANITY_CHECKS_ARE_ENABLED
-  // sanity check
-  mfAssert (
-    __FILE__, mfInputLineNumber (__LINE__),
-    theMxsr != nullptr,
-    "translateMxsrToMsrSkeleton(): theMxsr is NULL");
-#endif // MF_SANITY_CHECKS_ARE_ENABLED
-
   // start the clock
   clock_t startClock = clock ();
 
@@ -93,8 +86,14 @@ S_msrScore translateMxsrToMsrSkeleton (
       theResultingEventsCollection);
 
   // build the MSR score
-  skeletonBuilder.browseMxsr (
-    theMxsr);
+  if (theMxsr) {
+    skeletonBuilder.browseMxsr (
+      theMxsr);
+  }
+  else {
+    skeletonBuilder.browseMusicXMLFile (
+      fileName);
+  }
 
   // fetch the score skeleton
   scoreSkeleton =
@@ -155,6 +154,46 @@ S_msrScore translateMxsrToMsrSkeleton (
   return scoreSkeleton;
 }
 
+S_msrScore translateMxsrToMsrSkeleton (
+  const Sxmlelement&    theMxsr,
+  mxsrEventsCollection& theResultingEventsCollection,
+  const S_msrOahGroup&  msrOpts,
+  mfPassIDKind          passIDKind,
+  const std::string&    passDescription)
+{
+#ifdef MF_SANITY_CHECKS_ARE_ENABLED
+  // sanity check
+  mfAssert (
+    __FILE__, mfInputLineNumber (__LINE__),
+    theMxsr != nullptr,
+    "translateMxsrToMsrSkeleton(): theMxsr is NULL");
+#endif // MF_SANITY_CHECKS_ARE_ENABLED
+
+  return
+    translateToMsrSkeleton (
+      theMxsr,
+      nullptr,
+      theResultingEventsCollection,
+      passIDKind,
+      passDescription);
+}
+
+S_msrScore translateMusicXMLFileToMsrSkeleton (
+  const char*           fileName,
+  mxsrEventsCollection& theResultingEventsCollection,
+  const S_msrOahGroup&  msrOpts,
+  mfPassIDKind          passIDKind,
+  const std::string&    passDescription)
+{
+  return
+    translateToMsrSkeleton (
+      Sxmlelement (nullptr),
+      fileName,
+      theResultingEventsCollection,
+      passIDKind,
+      passDescription);
+}
+
 // //_______________________________________________________________________________
 // void displayMsrScoreSkeleton ( // UNUSED JMI 0.9.66
 //   S_msrOahGroup&     msrOpts,
@@ -26,6 +26,15 @@ EXP S_msrScore translateMxsrToMsrSkeleton (
   mfPassIDKind          passIDKind,
   const std::string&    passDescription);
 
+//_______________________________________________________________________________
+// the measures are converted while reading the file, see streamSXMLFileFromFile()
+EXP S_msrScore translateMusicXMLFileToMsrSkeleton (
+  const char*           fileName,
+  mxsrEventsCollection& theResultingEventsCollection,
+  const S_msrOahGroup&  msrOpts,
+  mfPassIDKind          passIDKind,
+  const std::string&    passDescription);
+
 //_______________________________________________________________________________
 // EXP void displayMsrScoreSkeleton ( // UNUSED JMI 0.9.66
 //   S_msrOahGroup&     msrOpts,
@@ -28,6 +28,8 @@
 
 #include "mxsr2msrSkeletonPopulator.h"
 
+#include "musicxml2mxsrInterface.h"
+
 #include "waeHandlers.h"
 
 #include "mxsr2msrWae.h"
@@ -375,6 +377,15 @@ void mxsr2msrSkeletonPopulator::browseMxsr (
   }
 }
 
+void mxsr2msrSkeletonPopulator::browseMusicXMLFile (
+  const char* fileName)
+{
+  // browse the measures while reading the file
+  streamSXMLFileFromFile (
+    fileName,
+    this);
+}
+
 //________________________________________________________________________
 void mxsr2msrSkeletonPopulator::initializeNoteData ()
 {
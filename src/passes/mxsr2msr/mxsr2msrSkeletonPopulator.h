@@ -579,6 +579,9 @@ class EXP mxsr2msrSkeletonPopulator :
     void                      browseMxsr (
                                 const Sxmlelement& theMxsr);
 
+    void                      browseMusicXMLFile (
+                                const char* fileName);
+
   protected:
 
     // scaling
@@ -10,7 +10,10 @@
 */
 
 #include <iostream>
+#include <algorithm>
 
+#include "elements.h"
+#include "tree_browser.h"
 #include "xml.h"
 #include "xmlfile.h"
 #include "xmlreader.h"
@@ -27,6 +30,7 @@
 
 #include "msrInterface.h"
 
+#include "mxsr2msrSkeletonBuilder.h"
 #include "mxsr2msrSkeletonPopulatorInterface.h"
 
 #include "displayMsrSummaryVisitor.h"
@@ -39,8 +43,98 @@ namespace MusicFormats
 {
 
 //_______________________________________________________________________________
-void populateMsrSkeletonFromMxsr (
+static void displayThePopulatedMsrScoreIfRequested (
+  const S_msrScore& thePopulatedMsrScore)
+{
+  // display the populated MSR score if requested
+  // ------------------------------------------------------
+
+  if (gMsrOahGroup->getDisplayFirstMsr ()) {
+    displayMsrScore (
+      thePopulatedMsrScore,
+      gLanguage->displayTheFirstMSRAsText ());
+  }
+
+  if (gMsrOahGroup->getDisplayFirstMsrFull ()) {
+    displayMsrScoreFull (
+      thePopulatedMsrScore,
+      gLanguage->displayTheFirstMSRAsText ());
+  }
+
+  // display the populated MSR score summary if requested
+  // ------------------------------------------------------
+
+  if (gMsrOahGroup->getDisplayFirstMsrSummary ()) {
+    // display the score summary
+    displayMsrScoreSummary (
+      thePopulatedMsrScore,
+      gMsrOahGroup,
+      gLanguage->displayASummaryOfTheFirstMSR ());
+  }
+
+  // display the populated MSR score names if requested
+  // ------------------------------------------------------
+
+  if (gMsrOahGroup->getDisplayFirstMsrNames ()) {
+    // display the score name
+    displayMsrScoreNames (
+      thePopulatedMsrScore,
+      gMsrOahGroup,
+      gLanguage->displayTheNamesInTheFirstMSR ());
+  }
+
+  // display the populated MSR score flat view if requested
+  // ------------------------------------------------------
+
+  if (gMsrOahGroup->getDisplayFirstMsrFlatView ()) {
+    // display the score name
+    displayMsrScoreVoicesFlatView (
+      thePopulatedMsrScore,
+      gMsrOahGroup,
+      gLanguage->displayAFlatViewOfTheFirstMSR (),
+      msrVoicesFlatViewDetailedKind::kVoicesFlatViewDetailedKindNo);
+  }
+
+  // display the populated MSR score flat view details if requested
+  // ------------------------------------------------------
+
+  if (gMsrOahGroup->getDisplayFirstMsrFlatViewDetails ()) {
+    // display the score name
+    displayMsrScoreVoicesFlatView (
+      thePopulatedMsrScore,
+      gMsrOahGroup,
+      gLanguage->displayAFlatViewOfTheFirstMSR (),
+      msrVoicesFlatViewDetailedKind::kVoicesFlatViewDetailedKindYes);
+  }
+
+  // display the populated MSR score slices if requested
+  // ------------------------------------------------------
+
+  if (gMsrOahGroup->getDisplayFirstMsrMeasuresSlices ()) {
+    // display the score name
+    displayMsrScoreMeasuresSlices (
+      thePopulatedMsrScore,
+      gMsrOahGroup,
+      gLanguage->displayTheSlicesOfTheFirstMSR ());
+  }
+
+//   // display the populated MSR score slices details if requested
+//   // ------------------------------------------------------
+
+  if (gMsrOahGroup->getDisplayFirstMsrMeasuresSlicesDetails()) {
+    // display the score name
+    displayMsrScoreMeasuresSlices (
+      thePopulatedMsrScore,
+      gMsrOahGroup,
+      gLanguage->displayTheSlicesOfTheFirstMSR ());
+  }
+}
+
+//_______________________________________________________________________________
+// the MXSR is browsed if present, otherwise the file is read in streaming mode
+static void populateMsrSkeleton (
   const Sxmlelement&    theMxsr,
+  const char*           fileName,
   S_msrScore            scoreSkeletonToBePopulated,
   mxsrEventsCollection& theKnownEventsCollection,
   mfPassIDKind          passIDKind,
@@ -48,11 +142,6 @@ void populateMsrSkeletonFromMxsr (
 {
 #ifdef MF_SANITY_CHECKS_ARE_ENABLED
   // sanity check
-  mfAssert (
-    __FILE__, mfInputLineNumber (__LINE__),
-    theMxsr != nullptr,
-    "populateMsrSkeletonFromMxsr(): theMxsr is NULL");
-
   mfAssert (
     __FILE__, mfInputLineNumber (__LINE__),
     scoreSkeletonToBePopulated != nullptr,
@@ -94,8 +183,14 @@ void populateMsrSkeletonFromMxsr (
       theKnownEventsCollection);
 
   // browse the MXSR
-  skeletonPopulator.browseMxsr (
-    theMxsr);
+  if (theMxsr) {
+    skeletonPopulator.browseMxsr (
+      theMxsr);
+  }
+  else {
+    skeletonPopulator.browseMusicXMLFile (
+      fileName);
+  }
 
   // register time spent
   clock_t endClock = clock ();
@@ -118,88 +213,182 @@ void populateMsrSkeletonFromMxsr (
     gIndenter.resetToZero ();
   }
 
-  // display the populated MSR score if requested
-  // ------------------------------------------------------
+  displayThePopulatedMsrScoreIfRequested (
+    scoreSkeletonToBePopulated);
+}
 
-  if (gMsrOahGroup->getDisplayFirstMsr ()) {
-    displayMsrScore (
-      scoreSkeletonToBePopulated,
-      gLanguage->displayTheFirstMSRAsText ());
-  }
+void populateMsrSkeletonFromMxsr (
+  const Sxmlelement&    theMxsr,
+  S_msrScore            scoreSkeletonToBePopulated,
+  mxsrEventsCollection& theKnownEventsCollection,
+  mfPassIDKind          passIDKind,
+  const std::string&    passDescription)
+{
+#ifdef MF_SANITY_CHECKS_ARE_ENABLED
+  // sanity check
+  mfAssert (
+    __FILE__, mfInputLineNumber (__LINE__),
+    theMxsr != nullptr,
+    "populateMsrSkeletonFromMxsr(): theMxsr is NULL");
+#endif // MF_SANITY_CHECKS_ARE_ENABLED
 
-  if (gMsrOahGroup->getDisplayFirstMsrFull ()) {
-    displayMsrScoreFull (
-      scoreSkeletonToBePopulated,
-      gLanguage->displayTheFirstMSRAsText ());
-  }
+  populateMsrSkeleton (
+    theMxsr,
+    nullptr,
+    scoreSkeletonToBePopulated,
+    theKnownEventsCollection,
+    passIDKind,
+    passDescription);
+}
 
-  // display the populated MSR score summary if requested
-  // ------------------------------------------------------
+void populateMsrSkeletonFromMusicXMLFile (
+  const char*           fileName,
+  S_msrScore            scoreSkeletonToBePopulated,
+  mxsrEventsCollection& theKnownEventsCollection,
+  mfPassIDKind          passIDKind,
+  const std::string&    passDescription)
+{
+  populateMsrSkeleton (
+    Sxmlelement (nullptr),
+    fileName,
+    scoreSkeletonToBePopulated,
+    theKnownEventsCollection,
+    passIDKind,
+    passDescription);
+}
 
-  if (gMsrOahGroup->getDisplayFirstMsrSummary ()) {
-    // display the score summary
-    displayMsrScoreSummary (
-      scoreSkeletonToBePopulated,
-      gMsrOahGroup,
-      gLanguage->displayASummaryOfTheFirstMSR ());
-  }
+//_______________________________________________________________________________
+S_msrScore buildAndPopulateMsrFromMxsr (
+  const Sxmlelement&    theMxsr,
+  mxsrEventsCollection& theEventsCollection,
+  mfPassIDKind          passIDKind,
+  const std::string&    passDescription)
+{
+#ifdef MF_SANITY_CHECKS_ARE_ENABLED
+  // sanity check
+  mfAssert (
+    __FILE__, mfInputLineNumber (__LINE__),
+    theMxsr != nullptr,
+    "buildAndPopulateMsrFromMxsr(): theMxsr is NULL");
+#endif // MF_SANITY_CHECKS_ARE_ENABLED
 
-  // display the populated MSR score names if requested
-  // ------------------------------------------------------
+  // start the clock
+  clock_t startClock = clock ();
 
-  if (gMsrOahGroup->getDisplayFirstMsrNames ()) {
-    // display the score name
-    displayMsrScoreNames (
-      scoreSkeletonToBePopulated,
-      gMsrOahGroup,
-      gLanguage->displayTheNamesInTheFirstMSR ());
-  }
+  // set the global current passID
+  setGlobalCurrentPassIDKind (passIDKind);
 
-  // display the populated MSR score flat view if requested
-  // ------------------------------------------------------
+#ifdef MF_TRACE_IS_ENABLED
+  if (gEarlyOptions.getEarlyTracePasses ()) {
+    std::string separator =
+      "%--------------------------------------------------------------";
 
-  if (gMsrOahGroup->getDisplayFirstMsrFlatView ()) {
-    // display the score name
-    displayMsrScoreVoicesFlatView (
-      scoreSkeletonToBePopulated,
-      gMsrOahGroup,
-      gLanguage->displayAFlatViewOfTheFirstMSR (),
-      msrVoicesFlatViewDetailedKind::kVoicesFlatViewDetailedKindNo);
-  }
+    std::stringstream ss;
 
-  // display the populated MSR score flat view details if requested
-  // ------------------------------------------------------
+    ss <<
+      std::endl <<
+      separator <<
+      std::endl <<
+      gTab <<
+      gLanguage->passIDKindAsString (passIDKind) << ": " << passDescription <<
+      std::endl <<
+      separator;
 
-  if (gMsrOahGroup->getDisplayFirstMsrFlatViewDetails ()) {
-    // display the score name
-    displayMsrScoreVoicesFlatView (
-      scoreSkeletonToBePopulated,
-      gMsrOahGroup,
-      gLanguage->displayAFlatViewOfTheFirstMSR (),
-      msrVoicesFlatViewDetailedKind::kVoicesFlatViewDetailedKindYes);
+    gWaeHandler->waeTraceWithoutInputLocation (
+      __FILE__, mfInputLineNumber (__LINE__),
+      ss.str ());
   }
+#endif // MF_TRACE_IS_ENABLED
 
-  // display the populated MSR score slices if requested
-  // ------------------------------------------------------
+  /*
+    The skeleton of a part only depends on the part list and on that part,
+    and the populator only needs the skeleton and the events of the part it populates:
+    each <part /> is thus browsed by the skeleton builder and then by the populator,
+    while its elements are still in the caches
+  */
 
-  if (gMsrOahGroup->getDisplayFirstMsrMeasuresSlices ()) {
-    // display the score name
-    displayMsrScoreMeasuresSlices (
-      scoreSkeletonToBePopulated,
-      gMsrOahGroup,
-      gLanguage->displayTheSlicesOfTheFirstMSR ());
-  }
+  const std::vector<Sxmlelement>&
+    scoreElements =
+      theMxsr->elements ();
 
-//   // display the populated MSR score slices details if requested
-//   // ------------------------------------------------------
+  std::vector<Sxmlelement>::const_iterator
+    firstPartIterator =
+      std::find_if (
+        scoreElements.begin (),
+        scoreElements.end (),
+        [] (const Sxmlelement& elt) { return elt->getType () == k_part; });
 
-  if (gMsrOahGroup->getDisplayFirstMsrMeasuresSlicesDetails()) {
-    // display the score name
-    displayMsrScoreMeasuresSlices (
-      scoreSkeletonToBePopulated,
-      gMsrOahGroup,
-      gLanguage->displayTheSlicesOfTheFirstMSR ());
+  // create an mxsr2msrSkeletonBuilder
+  mxsr2msrSkeletonBuilder
+    skeletonBuilder (
+      theEventsCollection);
+
+  tree_browser<xmlelement> builderBrowser (&skeletonBuilder);
+
+  // build the parts from the part list
+  theMxsr->acceptIn (skeletonBuilder);
+
+  for (auto i = scoreElements.begin (); i != firstPartIterator; ++i) {
+    builderBrowser.browse (**i);
+  } // for
+
+  S_msrScore
+    theMsrScore =
+      skeletonBuilder.getMsrScore ();
+
+  // create an mxsr2msrSkeletonPopulator, now that the parts are known
+  mxsr2msrSkeletonPopulator
+    skeletonPopulator (
+      theMsrScore,
+      theEventsCollection);
+
+  tree_browser<xmlelement> populatorBrowser (&skeletonPopulator);
+
+  theMxsr->acceptIn (skeletonPopulator);
+
+  for (auto i = scoreElements.begin (); i != firstPartIterator; ++i) {
+    populatorBrowser.browse (**i);
+  } // for
+
+  // build and populate the parts one at a time
+  for (auto i = firstPartIterator; i != scoreElements.end (); ++i) {
+    builderBrowser.browse (**i);
+
+    skeletonBuilder.registerScoreMeasureNumbers ();
+
+    populatorBrowser.browse (**i);
+  } // for
+
+  theMxsr->acceptOut (skeletonBuilder);
+  skeletonBuilder.finalizeBrowsing ();
+
+  theMxsr->acceptOut (skeletonPopulator);
+
+  // register time spent
+  clock_t endClock = clock ();
+
+  gGlobalTimingItemsList.appendTimingItem (
+    passIDKind,
+    passDescription,
+    mfTimingItemKind::kMandatory,
+    startClock,
+    endClock);
+
+  // check indentation
+  if (gIndenter != 0) {
+    gLog <<
+      "### buildAndPopulateMsrFromMxsr gIndenter final value: " <<
+      gIndenter.getIndentation () <<
+      " ###" <<
+      std::endl;
+
+    gIndenter.resetToZero ();
   }
+
+  displayThePopulatedMsrScoreIfRequested (
+    theMsrScore);
+
+  return theMsrScore;
 }
 
 
@@ -32,6 +32,24 @@ EXP void populateMsrSkeletonFromMxsr (
   mfPassIDKind          passIDKind,
   const std::string&    passDescription);
 
+//______________________________________________________________________________
+// the measures are converted while reading the file, see streamSXMLFileFromFile()
+EXP void populateMsrSkeletonFromMusicXMLFile (
+  const char*           fileName,
+  S_msrScore            scoreSkeletonToBePopulated,
+  mxsrEventsCollection& theKnownEventsCollection,
+  mfPassIDKind          passIDKind,
+  const std::string&    passDescription);
+
+//______________________________________________________________________________
+// the skeleton building and population passes fused,
+// the parts being populated as soon as their skeleton is built
+EXP S_msrScore buildAndPopulateMsrFromMxsr (
+  const Sxmlelement&    theMxsr,
+  mxsrEventsCollection& theEventsCollection,
+  mfPassIDKind          passIDKind,
+  const std::string&    passDescription);
+
 
 }
 
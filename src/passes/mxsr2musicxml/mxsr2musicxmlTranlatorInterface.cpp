@@ -27,6 +27,8 @@
 
 #include "mxsrGeneration.h"
 
+#include "msr2mxsrOah.h"
+
 #include "mxsr2musicxmlTranlatorInterface.h"
 
 #include "waeHandlers.h"
@@ -96,6 +98,11 @@ EXP void translateMxsrToMusicXML (
   // insert the MXSR into it
   sxmlfile->set (theMxsr);
 
+  // should the MusicXML data be written without indentation?
+  Bool
+    compactMusicXML =
+      gGlobalMsr2mxsr2msrOahGroup->getCompactMusicXML ();
+
 #ifdef MF_TRACE_IS_ENABLED
   if (gEarlyOptions.getTraceEarlyOptions ()) {
     err <<
@@ -124,7 +131,7 @@ EXP void translateMxsrToMusicXML (
 #endif // MF_TRACE_IS_ENABLED
 
     // write the MusicXML data to the output file stream
-    sxmlfile->print (gOutput);
+    sxmlfile->print (gOutput, compactMusicXML.getBareValue ());
     gOutput << std::endl;
   }
 
@@ -181,7 +188,7 @@ EXP void translateMxsrToMusicXML (
 
     // write the MusicXML data to the output file stream
   if (sxmlfile->elements ()) {
-    sxmlfile->print (musicxmlFileOutputStream);
+    sxmlfile->print (musicxmlFileOutputStream, compactMusicXML.getBareValue ());
     musicxmlFileOutputStream << std::endl;
   }
   else {
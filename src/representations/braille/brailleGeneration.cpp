@@ -9,6 +9,7 @@
   https://github.com/jacques-menu/musicformats
 */
 
+#include <cstring>
 #include <iostream>
 #include <sstream>
 
@@ -105,6 +106,84 @@ std::ostream& operator << (std::ostream& os, const bsrCellKind cell)
   return os;
 }
 
+//______________________________________________________________________________
+// the cell codes tables, computed at compile time
+// and indexed by the bsrCellKind numerical values
+constexpr bsrCellCodesTable createAsciiCellCodesTable ()
+{
+  // North American Braille ASCII, in the order of kDotsNone .. kDots123456
+  constexpr char kAsciiDotsCells [] =
+    " A1B'K2L@CIF/MSP\"E3H9O6R^DJG>NTQ,*5<-U8V.%[$+X!&;:4\\0Z7(_?W]#Y)=";
+
+  bsrCellCodesTable result {}; // kCellUnknown has no code
+
+  result [size_t (bsrCellKind::kCellEOL)] = { { '\x0a' }, 1 };
+  result [size_t (bsrCellKind::kCellEOP)] = { { '\x0c' }, 1 };
+
+  for (size_t i = 0; i < 64; ++i) {
+    result [size_t (bsrCellKind::kDotsNone) + i] =
+      { { kAsciiDotsCells [i] }, 1 };
+  } // for
+
+  return result;
+}
+
+constexpr bsrCellCodesTable createUTF8CellCodesTable ()
+{
+  bsrCellCodesTable result {};
+
+  result [size_t (bsrCellKind::kCellEOL)] = { { '\x0a' }, 1 }; // U+000A
+  result [size_t (bsrCellKind::kCellEOP)] = { { '\x0c' }, 1 }; // U+000C
+
+  // U+2800 .. U+283F are e2 a0 80 .. e2 a0 bf
+  for (size_t i = 0; i < 64; ++i) {
+    result [size_t (bsrCellKind::kDotsNone) + i] =
+      { { '\xe2', '\xa0', char (0x80 + i) }, 3 };
+  } // for
+
+  return result;
+}
+
+constexpr bsrCellCodesTable createUTF16CellCodesTable (
+  bool bigEndian)
+{
+  bsrCellCodesTable result {};
+
+  auto codeUnit =
+    [bigEndian] (char high, char low) -> bsrCellCode
+      {
+        return
+          bigEndian
+            ? bsrCellCode { { high, low }, 2 }
+            : bsrCellCode { { low, high }, 2 };
+      };
+
+  result [size_t (bsrCellKind::kCellEOL)] = codeUnit ('\x00', '\x0a'); // U+000A
+  result [size_t (bsrCellKind::kCellEOP)] = codeUnit ('\x00', '\x0c'); // U+000C
+
+  // U+2800 .. U+283F
+  for (size_t i = 0; i < 64; ++i) {
+    result [size_t (bsrCellKind::kDotsNone) + i] =
+      codeUnit ('\x28', char (i));
+  } // for
+
+  return result;
+}
+
+constexpr bsrCellCodesTable
+  kAsciiCellCodesTable =
+    createAsciiCellCodesTable (),
+  kUTF8CellCodesTable =
+    createUTF8CellCodesTable (),
+  kUTF16BigEndianCellCodesTable =
+    createUTF16CellCodesTable (true),
+  kUTF16SmallEndianCellCodesTable =
+    createUTF16CellCodesTable (false);
+
+static_assert (
+  kUTF8CellCodesTable [size_t (bsrCellKind::kDots123456)].fBytes [2] == '\xbf',
+  "the braille cells should be contiguous in bsrCellKind");
+
 //______________________________________________________________________________
 /* this class is purely virtual
 S_bsrBrailleGenerator bsrBrailleGenerator::create (
@@ -121,32 +200,87 @@ S_bsrBrailleGenerator bsrBrailleGenerator::create (
 */
 
 bsrBrailleGenerator::bsrBrailleGenerator (
-  std::ostream& brailleOutputStream)
+  std::ostream&            brailleOutputStream,
+  const bsrCellCodesTable& cellCodesTable)
   : fBrailleOutputStream (
-      brailleOutputStream)
+      brailleOutputStream),
+    fCellCodesTable (
+      cellCodesTable)
 {}
 
 bsrBrailleGenerator::~bsrBrailleGenerator ()
 {}
 
+void bsrBrailleGenerator::appendCodeForCells (
+  const bsrCellKind* cells,
+  size_t             cellsNumber,
+  std::string&       codeBuffer) const
+{
+  // make room for the longest possible code, and shrink it at the end
+  size_t initialSize = codeBuffer.size ();
+
+  codeBuffer.resize (
+    initialSize + cellsNumber * K_BSR_CELL_CODE_MAX_BYTES_NUMBER);
+
+  char* code = codeBuffer.data () + initialSize;
+
+  for (size_t i = 0; i < cellsNumber; ++i) {
+    const bsrCellCode&
+      cellCode =
+        fCellCodesTable [size_t (cells [i])];
+
+    if (cellCode.fBytesNumber == 0) {
+      std::stringstream ss;
+
+      ss <<
+        "cannot generate code for braille cell '" <<
+        bsrCellKindAsString (cells [i]) <<
+        "'";
+
+      bsr2brailleInternalError (
+        gServiceRunData->getInputSourceName (),
+        -901, // inputLineNumber, TICINO JMI
+        __FILE__, mfInputLineNumber (__LINE__),
+        ss.str ());
+    }
+
+    // copying all the bytes is cheaper than testing their number
+    std::memcpy (code, cellCode.fBytes, K_BSR_CELL_CODE_MAX_BYTES_NUMBER);
+    code += cellCode.fBytesNumber;
+  } // for
+
+  codeBuffer.resize (code - codeBuffer.data ());
+}
+
+void bsrBrailleGenerator::generateCodeForBrailleCell (
+  bsrCellKind cellKind)
+{
+  fCodeBuffer.clear ();
+
+  appendCodeForCells (
+    &cellKind, 1, fCodeBuffer);
+
+  fBrailleOutputStream.write (
+    fCodeBuffer.data (), fCodeBuffer.size ());
+}
+
 void bsrBrailleGenerator::generateCodeForCellsList (
   const S_bsrCellsList& cellsList)
 {
-  const std::list <bsrCellKind>&
+  const std::vector <bsrCellKind>&
     cellsListElements =
       cellsList->getCellsListElements ();
 
-  if (cellsListElements.size ()) {
-    std::list <bsrCellKind>::const_iterator
-      iBegin = cellsListElements.begin (),
-      iEnd   = cellsListElements.end (),
-      i      = iBegin;
-    for ( ; ; ) {
-      generateCodeForBrailleCell ((*i));
-      if (++i == iEnd) break;
-      // JMI ss << ' ';
-    } // for
-  }
+  // encode the whole cells list at once, then write it in one go
+  fCodeBuffer.clear ();
+
+  appendCodeForCells (
+    cellsListElements.data (),
+    cellsListElements.size (),
+    fCodeBuffer);
+
+  fBrailleOutputStream.write (
+    fCodeBuffer.data (), fCodeBuffer.size ());
 }
 
 void bsrBrailleGenerator::generateCodeForMusicHeading (
@@ -208,7 +342,8 @@ S_bsrAsciiBrailleGenerator bsrAsciiBrailleGenerator::create (
 bsrAsciiBrailleGenerator::bsrAsciiBrailleGenerator (
   std::ostream& brailleOutputStream)
     : bsrBrailleGenerator (
-        brailleOutputStream)
+        brailleOutputStream,
+        kAsciiCellCodesTable)
 {
 //  writeTestData (brailleOutputStream);
 }
@@ -216,105 +351,6 @@ bsrAsciiBrailleGenerator::bsrAsciiBrailleGenerator (
 bsrAsciiBrailleGenerator::~bsrAsciiBrailleGenerator ()
 {}
 
-void bsrAsciiBrailleGenerator::generateCodeForBrailleCell (
-  bsrCellKind cellKind)
-{
-  std::string stringForCell;
-
-  switch (cellKind) {
-    case bsrCellKind::kCellUnknown:
-      {
-        std::stringstream ss;
-
-        ss <<
-          "cannot generate code for braille cell '" <<
-          bsrCellKindAsString (cellKind) <<
-          "'";
-        bsr2brailleInternalError (
-          gServiceRunData->getInputSourceName (),
-          -901, // inputLineNumber, TICINO JMI
-          __FILE__, mfInputLineNumber (__LINE__),
-          ss.str ());
-      }
-      break;
-
-    case bsrCellKind::kCellEOL:    stringForCell = "\x0a"; break;
-    case bsrCellKind::kCellEOP:    stringForCell = "\x0c"; break;
-
-    case bsrCellKind::kDotsNone:   stringForCell = "\x20"; break;
-
-    case bsrCellKind::kDots1:      stringForCell = "\x41"; break;
-    case bsrCellKind::kDots2:      stringForCell = "\x31"; break;
-    case bsrCellKind::kDots12:     stringForCell = "\x42"; break;
-    case bsrCellKind::kDots3:      stringForCell = "\x27"; break;
-    case bsrCellKind::kDots13:     stringForCell = "\x4b"; break;
-    case bsrCellKind::kDots23:     stringForCell = "\x32"; break;
-    case bsrCellKind::kDots123:    stringForCell = "\x4c"; break;
-    case bsrCellKind::kDots4:      stringForCell = "\x40"; break;
-    case bsrCellKind::kDots14:     stringForCell = "\x43"; break;
-    case bsrCellKind::kDots24:     stringForCell = "\x49"; break;
-    case bsrCellKind::kDots124:    stringForCell = "\x46"; break;
-    case bsrCellKind::kDots34:     stringForCell = "\x2f"; break;
-    case bsrCellKind::kDots134:    stringForCell = "\x4d"; break;
-    case bsrCellKind::kDots234:    stringForCell = "\x53"; break;
-    case bsrCellKind::kDots1234:   stringForCell = "\x50"; break;
-
-    case bsrCellKind::kDots5:      stringForCell = "\x22"; break;
-    case bsrCellKind::kDots15:     stringForCell = "\x45"; break;
-    case bsrCellKind::kDots25:     stringForCell = "\x33"; break;
-    case bsrCellKind::kDots125:    stringForCell = "\x48"; break;
-    case bsrCellKind::kDots35:     stringForCell = "\x39"; break;
-    case bsrCellKind::kDots135:    stringForCell = "\x4f"; break;
-    case bsrCellKind::kDots235:    stringForCell = "\x37"; break;
-    case bsrCellKind::kDots1235:   stringForCell = "\x52"; break;
-    case bsrCellKind::kDots45:     stringForCell = "\x5e"; break;
-    case bsrCellKind::kDots145:    stringForCell = "\x44"; break;
-    case bsrCellKind::kDots245:    stringForCell = "\x4a"; break;
-    case bsrCellKind::kDots1245:   stringForCell = "\x47"; break;
-    case bsrCellKind::kDots345:    stringForCell = "\x3e"; break;
-    case bsrCellKind::kDots1345:   stringForCell = "\x4e"; break;
-    case bsrCellKind::kDots2345:   stringForCell = "\x54"; break;
-    case bsrCellKind::kDots12345:  stringForCell = "\x51"; break;
-
-    case bsrCellKind::kDots6:      stringForCell = "\x2c"; break;
-    case bsrCellKind::kDots16:     stringForCell = "\x2a"; break;
-    case bsrCellKind::kDots26:     stringForCell = "\x35"; break;
-    case bsrCellKind::kDots126:    stringForCell = "\x3c"; break;
-    case bsrCellKind::kDots36:     stringForCell = "\x2d"; break;
-    case bsrCellKind::kDots136:    stringForCell = "\x55"; break;
-    case bsrCellKind::kDots236:    stringForCell = "\x38"; break;
-    case bsrCellKind::kDots1236:   stringForCell = "\x56"; break;
-    case bsrCellKind::kDots46:     stringForCell = "\x2e"; break;
-    case bsrCellKind::kDots146:    stringForCell = "\x25"; break;
-    case bsrCellKind::kDots246:    stringForCell = "\x5b"; break;
-    case bsrCellKind::kDots1246:   stringForCell = "\x24"; break;
-    case bsrCellKind::kDots346:    stringForCell = "\x2b"; break;
-    case bsrCellKind::kDots1346:   stringForCell = "\x58"; break;
-    case bsrCellKind::kDots2346:   stringForCell = "\x21"; break;
-    case bsrCellKind::kDots12346:  stringForCell = "\x26"; break;
-
-    case bsrCellKind::kDots56:     stringForCell = "\x3b"; break;
-    case bsrCellKind::kDots156:    stringForCell = "\x3a"; break;
-    case bsrCellKind::kDots256:    stringForCell = "\x34"; break;
-    case bsrCellKind::kDots1256:   stringForCell = "\x5c"; break;
-    case bsrCellKind::kDots356:    stringForCell = "\x30"; break;
-    case bsrCellKind::kDots1356:   stringForCell = "\x5a"; break;
-    case bsrCellKind::kDots2356:   stringForCell = "\x37"; break;
-    case bsrCellKind::kDots12356:  stringForCell = "\x28"; break;
-    case bsrCellKind::kDots456:    stringForCell = "\x5f"; break;
-    case bsrCellKind::kDots1456:   stringForCell = "\x3f"; break;
-    case bsrCellKind::kDots2456:   stringForCell = "\x57"; break;
-    case bsrCellKind::kDots12456:  stringForCell = "\x5d"; break;
-    case bsrCellKind::kDots3456:   stringForCell = "\x23"; break;
-    case bsrCellKind::kDots13456:  stringForCell = "\x59"; break;
-    case bsrCellKind::kDots23456:  stringForCell = "\x29"; break;
-    case bsrCellKind::kDots123456: stringForCell = "\x3d"; break;
-  } // switch
-
-  fBrailleOutputStream <<
-    stringForCell;
-}
-
 void bsrAsciiBrailleGenerator::writeTestData (std::ostream& os)
 {
   gLog <<
@@ -379,7 +415,8 @@ bsrUTF8BrailleGenerator::bsrUTF8BrailleGenerator (
   bsrByteOrderingKind byteOrderingKind,
   std::ostream&            brailleOutputStream)
     : bsrBrailleGenerator (
-        brailleOutputStream)
+        brailleOutputStream,
+        kUTF8CellCodesTable)
 {
   fByteOrderingKind = byteOrderingKind;
 
@@ -402,105 +439,6 @@ bsrUTF8BrailleGenerator::bsrUTF8BrailleGenerator (
 bsrUTF8BrailleGenerator::~bsrUTF8BrailleGenerator ()
 {}
 
-void bsrUTF8BrailleGenerator::generateCodeForBrailleCell (
-  bsrCellKind cellKind)
-{
-  std::string stringForCell;
-
-  switch (cellKind) {
-    case bsrCellKind::kCellUnknown:
-      {
-        std::stringstream ss;
-
-        ss <<
-          "cannot generate code for braille cell '" <<
-          bsrCellKindAsString (cellKind) <<
-          "'";
-        bsr2brailleInternalError (
-          gServiceRunData->getInputSourceName (),
-          -901, // TICINO inputLineNumber,
-          __FILE__, mfInputLineNumber (__LINE__),
-          ss.str ());
-      }
-      break;
-
-    case bsrCellKind::kCellEOL:    stringForCell = "\x0a"; break; // U+000A
-    case bsrCellKind::kCellEOP:    stringForCell = "\x0c"; break; // U+000C
-
-    case bsrCellKind::kDotsNone:   stringForCell = "\xe2\xa0\x80"; break; // U+2800 ⠀ e2 a0 80 BLANK
-
-    case bsrCellKind::kDots1:      stringForCell = "\xe2\xa0\x81"; break; // U+2801 ⠀ e2 a0 81 DOTS-1
-    case bsrCellKind::kDots2:      stringForCell = "\xe2\xa0\x82"; break; // U+2802 ⠀ e2 a0 82 DOTS-2
-    case bsrCellKind::kDots12:     stringForCell = "\xe2\xa0\x83"; break; // U+2803 ⠀ e2 a0 83 DOTS-12
-    case bsrCellKind::kDots3:      stringForCell = "\xe2\xa0\x84"; break; // U+2804  ⠄ e2 a0 84 DOTS-3
-    case bsrCellKind::kDots13:     stringForCell = "\xe2\xa0\x85"; break; // U+2805  ⠅ e2 a0 85 DOTS-13
-    case bsrCellKind::kDots23:     stringForCell = "\xe2\xa0\x86"; break; // U+2806  ⠆ e2 a0 86 DOTS-23
-    case bsrCellKind::kDots123:    stringForCell = "\xe2\xa0\x87"; break; // U+2807  ⠇ e2 a0 87 DOTS-123
-    case bsrCellKind::kDots4:      stringForCell = "\xe2\xa0\x88"; break; // U+2808  ⠈ e2 a0 88 DOTS-4
-    case bsrCellKind::kDots14:     stringForCell = "\xe2\xa0\x89"; break; // U+2809  ⠉ e2 a0 89 DOTS-14
-    case bsrCellKind::kDots24:     stringForCell = "\xe2\xa0\x8a"; break; // U+280A  ⠊ e2 a0 8a DOTS-24
-    case bsrCellKind::kDots124:    stringForCell = "\xe2\xa0\x8b"; break; // U+280B  ⠋ e2 a0 8b DOTS-124
-    case bsrCellKind::kDots34:     stringForCell = "\xe2\xa0\x8c"; break; // U+280C  ⠌ e2 a0 8c DOTS-34
-    case bsrCellKind::kDots134:    stringForCell = "\xe2\xa0\x8d"; break; // U+280D  ⠍ e2 a0 8d DOTS-134
-    case bsrCellKind::kDots234:    stringForCell = "\xe2\xa0\x8e"; break; // U+280E  ⠎ e2 a0 8e DOTS-234
-    case bsrCellKind::kDots1234:   stringForCell = "\xe2\xa0\x8f"; break; // U+280F  ⠏ e2 a0 8f DOTS-1234
-
-    case bsrCellKind::kDots5:      stringForCell = "\xe2\xa0\x90"; break; // U+2810  ⠐ e2 a0 90 DOTS-5
-    case bsrCellKind::kDots15:     stringForCell = "\xe2\xa0\x91"; break; // U+2811  ⠑ e2 a0 91 DOTS-15
-    case bsrCellKind::kDots25:     stringForCell = "\xe2\xa0\x92"; break; // U+2812  ⠒ e2 a0 92 DOTS-25
-    case bsrCellKind::kDots125:    stringForCell = "\xe2\xa0\x93"; break; // U+2813  ⠓ e2 a0 93 DOTS-125
-    case bsrCellKind::kDots35:     stringForCell = "\xe2\xa0\x94"; break; // U+2814  ⠔ e2 a0 94 DOTS-35
-    case bsrCellKind::kDots135:    stringForCell = "\xe2\xa0\x95"; break; // U+2815  ⠕ e2 a0 95 DOTS-135
-    case bsrCellKind::kDots235:    stringForCell = "\xe2\xa0\x96"; break; // U+2816  ⠖ e2 a0 96 DOTS-235
-    case bsrCellKind::kDots1235:   stringForCell = "\xe2\xa0\x97"; break; // U+2817  ⠗ e2 a0 97 DOTS-1235
-    case bsrCellKind::kDots45:     stringForCell = "\xe2\xa0\x98"; break; // U+2818  ⠘ e2 a0 98 DOTS-45
-    case bsrCellKind::kDots145:    stringForCell = "\xe2\xa0\x99"; break; // U+2819  ⠙ e2 a0 99 DOTS-145
-    case bsrCellKind::kDots245:    stringForCell = "\xe2\xa0\x9a"; break; // U+281A  ⠚ e2 a0 9a DOTS-245
-    case bsrCellKind::kDots1245:   stringForCell = "\xe2\xa0\x9b"; break; // U+281B  ⠛ e2 a0 9b DOTS-1245
-    case bsrCellKind::kDots345:    stringForCell = "\xe2\xa0\x9c"; break; // U+281C  ⠜ e2 a0 9c DOTS-345
-    case bsrCellKind::kDots1345:   stringForCell = "\xe2\xa0\x9d"; break; // U+281D  ⠝ e2 a0 9d DOTS-1345
-    case bsrCellKind::kDots2345:   stringForCell = "\xe2\xa0\x9e"; break; // U+281E  ⠞ e2 a0 9e DOTS-2345
-    case bsrCellKind::kDots12345:  stringForCell = "\xe2\xa0\x9f"; break; // U+281F  ⠟ e2 a0 9f DOTS-12345
-
-    case bsrCellKind::kDots6:      stringForCell = "\xe2\xa0\xa0"; break; // U+2820  ⠠ e2 a0 a0 DOTS-6
-    case bsrCellKind::kDots16:     stringForCell = "\xe2\xa0\xa1"; break; // U+2821  ⠡ e2 a0 a1 DOTS-16
-    case bsrCellKind::kDots26:     stringForCell = "\xe2\xa0\xa2"; break; // U+2822  ⠢ e2 a0 a2 DOTS-26
-    case bsrCellKind::kDots126:    stringForCell = "\xe2\xa0\xa3"; break; // U+2823  ⠣ e2 a0 a3 DOTS-126
-    case bsrCellKind::kDots36:     stringForCell = "\xe2\xa0\xa4"; break; // U+2824  ⠤ e2 a0 a4 DOTS-36
-    case bsrCellKind::kDots136:    stringForCell = "\xe2\xa0\xa5"; break; // U+2825  ⠥ e2 a0 a5 DOTS-136
-    case bsrCellKind::kDots236:    stringForCell = "\xe2\xa0\xa6"; break; // U+2826  ⠦ e2 a0 a6 DOTS-236
-    case bsrCellKind::kDots1236:   stringForCell = "\xe2\xa0\xa7"; break; // U+2827  ⠧ e2 a0 a7 DOTS-1236
-    case bsrCellKind::kDots46:     stringForCell = "\xe2\xa0\xa8"; break; // U+2828  ⠨ e2 a0 a8 DOTS-46
-    case bsrCellKind::kDots146:    stringForCell = "\xe2\xa0\xa9"; break; // U+2829  ⠩ e2 a0 a9 DOTS-146
-    case bsrCellKind::kDots246:    stringForCell = "\xe2\xa0\xaa"; break; // U+282A  ⠪ e2 a0 aa DOTS-246
-    case bsrCellKind::kDots1246:   stringForCell = "\xe2\xa0\xab"; break; // U+282b  ⠫ e2 a0 ab DOTS-1246
-    case bsrCellKind::kDots346:    stringForCell = "\xe2\xa0\xac"; break; // U+282C  ⠬ e2 a0 ac DOTS-346
-    case bsrCellKind::kDots1346:   stringForCell = "\xe2\xa0\xad"; break; // U+282D  ⠭ e2 a0 ad DOTS-1346
-    case bsrCellKind::kDots2346:   stringForCell = "\xe2\xa0\xae"; break; // U+282E  ⠮ e2 a0 ae DOTS-2346
-    case bsrCellKind::kDots12346:  stringForCell = "\xe2\xa0\xaf"; break; // U+282F  ⠯ e2 a0 af DOTS-12346
-
-    case bsrCellKind::kDots56:     stringForCell = "\xe2\xa0\xb0"; break; // U+2830  ⠰ e2 a0 b0 DOTS-56
-    case bsrCellKind::kDots156:    stringForCell = "\xe2\xa0\xb1"; break; // U+2831  ⠱ e2 a0 b1 DOTS-156
-    case bsrCellKind::kDots256:    stringForCell = "\xe2\xa0\xb2"; break; // U+2832  ⠲ e2 a0 b2 DOTS-256
-    case bsrCellKind::kDots1256:   stringForCell = "\xe2\xa0\xb3"; break; // U+2833  ⠳ e2 a0 b3 DOTS-1256
-    case bsrCellKind::kDots356:    stringForCell = "\xe2\xa0\xb4"; break; // U+2834  ⠴ e2 a0 b4 DOTS-356
-    case bsrCellKind::kDots1356:   stringForCell = "\xe2\xa0\xb5"; break; // U+2835  ⠵ e2 a0 b5 DOTS-1356
-    case bsrCellKind::kDots2356:   stringForCell = "\xe2\xa0\xb6"; break; // U+2836  ⠶ e2 a0 b6 DOTS-2356
-    case bsrCellKind::kDots12356:  stringForCell = "\xe2\xa0\xb7"; break; // U+2837  ⠷ e2 a0 b7 DOTS-12356
-    case bsrCellKind::kDots456:    stringForCell = "\xe2\xa0\xb8"; break; // U+2838  ⠸ e2 a0 b8 DOTS-456
-    case bsrCellKind::kDots1456:   stringForCell = "\xe2\xa0\xb9"; break; // U+2839  ⠹ e2 a0 b9 DOTS-1456
-    case bsrCellKind::kDots2456:   stringForCell = "\xe2\xa0\xba"; break; // U+283A  ⠺ e2 a0 ba DOTS-2456
-    case bsrCellKind::kDots12456:  stringForCell = "\xe2\xa0\xbb"; break; // U+283B  ⠻ e2 a0 bb DOTS-12456
-    case bsrCellKind::kDots3456:   stringForCell = "\xe2\xa0\xbc"; break; // U+283C  ⠼ e2 a0 bc DOTS-3456
-    case bsrCellKind::kDots13456:  stringForCell = "\xe2\xa0\xbd"; break; // U+283D  ⠽ e2 a0 bd DOTS-13456
-    case bsrCellKind::kDots23456:  stringForCell = "\xe2\xa0\xbe"; break; // U+283E  ⠾ e2 a0 be DOTS-23456
-    case bsrCellKind::kDots123456: stringForCell = "\xe2\xa0\xbf"; break; // U+283F ⠿ e2 a0 bf DOTS-123456
-  } // switch
-
-  fBrailleOutputStream <<
-    stringForCell;
-}
-
 void bsrUTF8BrailleGenerator::writeTestData (std::ostream& os)
 {
   gLog <<
@@ -701,7 +639,8 @@ bsrUTF16BigEndianBrailleGenerator::bsrUTF16BigEndianBrailleGenerator (
   bsrByteOrderingKind byteOrderingKind,
   std::ostream&            brailleOutputStream)
     : bsrBrailleGenerator (
-        brailleOutputStream)
+        brailleOutputStream,
+        kUTF16BigEndianCellCodesTable)
 {
   fByteOrderingKind = byteOrderingKind;
 
@@ -711,141 +650,6 @@ bsrUTF16BigEndianBrailleGenerator::bsrUTF16BigEndianBrailleGenerator (
 bsrUTF16BigEndianBrailleGenerator::~bsrUTF16BigEndianBrailleGenerator ()
 {}
 
-void bsrUTF16BigEndianBrailleGenerator::generateCodeForBrailleCell (
-  bsrCellKind cellKind)
-{
-// to be fixed JMI
-/*
-
-HTML Entity (Decimal)  &#10241;
-HTML Entity (Hexadecimal)  &#x2801;
-URL Escape Code  %E2%A0%81
-UTF-8 (hex)  0xE2 0xA0 0x81 (e2a081)
-UTF-8 (binary)  11100010:10100000:10000001
-UTF-16/UTF-16BE (hex)  0x2801 (2801)
-UTF-16LE (hex)  0x0128 (0128)
-UTF-32/UTF-32bE (hex)  0x00002801 (00002801)
-UTF-32lE (hex)  0x01280000 (01280000)
-Octal Escape Sequence  \342\240\201
-
-HTML Entity (Decimal)  &#10242;
-HTML Entity (Hexadecimal)  &#x2802;
-URL Escape Code  %E2%A0%82
-UTF-8 (hex)  0xE2 0xA0 0x82 (e2a082)
-UTF-8 (binary)  11100010:10100000:10000010
-UTF-16/UTF-16BE (hex)  0x2802 (2802)
-UTF-16LE (hex)  0x0228 (0228)
-UTF-32/UTF-32bE (hex)  0x00002802 (00002802)
-UTF-32lE (hex)  0x02280000 (02280000)
-Octal Escape Sequence  \342\240\202
-
-HTML Entity (Decimal)  &#10243;
-HTML Entity (Hexadecimal)  &#x2803;
-URL Escape Code  %E2%A0%83
-UTF-8 (hex)  0xE2 0xA0 0x83 (e2a083)
-UTF-8 (binary)  11100010:10100000:10000011
-UTF-16/UTF-16BE (hex)  0x2803 (2803)
-UTF-16LE (hex)  0x0328 (0328)
-UTF-32/UTF-32bE (hex)  0x00002803 (00002803)
-UTF-32lE (hex)  0x03280000 (03280000)
-Octal Escape Sequence  \342\240\203*/
-
-  std::string stringForCell;
-
-  switch (cellKind) {
-    case bsrCellKind::kCellUnknown:
-      {
-        std::stringstream ss;
-
-        ss <<
-          "cannot generate code for braille cell '" <<
-          bsrCellKindAsString (cellKind) <<
-          "'";
-        bsr2brailleInternalError (
-          gServiceRunData->getInputSourceName (),
-          -902, // TICINO inputLineNumber,
-          __FILE__, mfInputLineNumber (__LINE__),
-          ss.str ());
-      }
-      break;
-
-    case bsrCellKind::kCellEOL:    stringForCell = "\x0a"; break; // U+000A
-    case bsrCellKind::kCellEOP:    stringForCell = "\x0c"; break; // U+000C
-
-    case bsrCellKind::kDotsNone:   stringForCell = "\xe2\xa0\x80"; break; // U+2800 ⠀ e2 a0 80 BLANK
-
-    case bsrCellKind::kDots1:      stringForCell = "\xe2\xa0\x81"; break; // U+2801 ⠀ e2 a0 81 DOTS-1
-    case bsrCellKind::kDots2:      stringForCell = "\xe2\xa0\x82"; break; // U+2802 ⠀ e2 a0 82 DOTS-2
-    case bsrCellKind::kDots12:     stringForCell = "\xe2\xa0\x83"; break; // U+2803 ⠀ e2 a0 83 DOTS-12
-    case bsrCellKind::kDots3:      stringForCell = "\xe2\xa0\x84"; break; // U+2804  ⠄ e2 a0 84 DOTS-3
-    case bsrCellKind::kDots13:     stringForCell = "\xe2\xa0\x85"; break; // U+2805  ⠅ e2 a0 85 DOTS-13
-    case bsrCellKind::kDots23:     stringForCell = "\xe2\xa0\x86"; break; // U+2806  ⠆ e2 a0 86 DOTS-23
-    case bsrCellKind::kDots123:    stringForCell = "\xe2\xa0\x87"; break; // U+2807  ⠇ e2 a0 87 DOTS-123
-    case bsrCellKind::kDots4:      stringForCell = "\xe2\xa0\x88"; break; // U+2808  ⠈ e2 a0 88 DOTS-4
-    case bsrCellKind::kDots14:     stringForCell = "\xe2\xa0\x89"; break; // U+2809  ⠉ e2 a0 89 DOTS-14
-    case bsrCellKind::kDots24:     stringForCell = "\xe2\xa0\x8a"; break; // U+280A  ⠊ e2 a0 8a DOTS-24
-    case bsrCellKind::kDots124:    stringForCell = "\xe2\xa0\x8b"; break; // U+280B  ⠋ e2 a0 8b DOTS-124
-    case bsrCellKind::kDots34:     stringForCell = "\xe2\xa0\x8c"; break; // U+280C  ⠌ e2 a0 8c DOTS-34
-    case bsrCellKind::kDots134:    stringForCell = "\xe2\xa0\x8d"; break; // U+280D  ⠍ e2 a0 8d DOTS-134
-    case bsrCellKind::kDots234:    stringForCell = "\xe2\xa0\x8e"; break; // U+280E  ⠎ e2 a0 8e DOTS-234
-    case bsrCellKind::kDots1234:   stringForCell = "\xe2\xa0\x8f"; break; // U+280F  ⠏ e2 a0 8f DOTS-1234
-
-    case bsrCellKind::kDots5:      stringForCell = "\xe2\xa0\x90"; break; // U+2810  ⠐ e2 a0 90 DOTS-5
-    case bsrCellKind::kDots15:     stringForCell = "\xe2\xa0\x91"; break; // U+2811  ⠑ e2 a0 91 DOTS-15
-    case bsrCellKind::kDots25:     stringForCell = "\xe2\xa0\x92"; break; // U+2812  ⠒ e2 a0 92 DOTS-25
-    case bsrCellKind::kDots125:    stringForCell = "\xe2\xa0\x93"; break; // U+2813  ⠓ e2 a0 93 DOTS-125
-    case bsrCellKind::kDots35:     stringForCell = "\xe2\xa0\x94"; break; // U+2814  ⠔ e2 a0 94 DOTS-35
-    case bsrCellKind::kDots135:    stringForCell = "\xe2\xa0\x95"; break; // U+2815  ⠕ e2 a0 95 DOTS-135
-    case bsrCellKind::kDots235:    stringForCell = "\xe2\xa0\x96"; break; // U+2816  ⠖ e2 a0 96 DOTS-235
-    case bsrCellKind::kDots1235:   stringForCell = "\xe2\xa0\x97"; break; // U+2817  ⠗ e2 a0 97 DOTS-1235
-    case bsrCellKind::kDots45:     stringForCell = "\xe2\xa0\x98"; break; // U+2818  ⠘ e2 a0 98 DOTS-45
-    case bsrCellKind::kDots145:    stringForCell = "\xe2\xa0\x99"; break; // U+2819  ⠙ e2 a0 99 DOTS-145
-    case bsrCellKind::kDots245:    stringForCell = "\xe2\xa0\x9a"; break; // U+281A  ⠚ e2 a0 9a DOTS-245
-    case bsrCellKind::kDots1245:   stringForCell = "\xe2\xa0\x9b"; break; // U+281B  ⠛ e2 a0 9b DOTS-1245
-    case bsrCellKind::kDots345:    stringForCell = "\xe2\xa0\x9c"; break; // U+281C  ⠜ e2 a0 9c DOTS-345
-    case bsrCellKind::kDots1345:   stringForCell = "\xe2\xa0\x9d"; break; // U+281D  ⠝ e2 a0 9d DOTS-1345
-    case bsrCellKind::kDots2345:   stringForCell = "\xe2\xa0\x9e"; break; // U+281E  ⠞ e2 a0 9e DOTS-2345
-    case bsrCellKind::kDots12345:  stringForCell = "\xe2\xa0\x9f"; break; // U+281F  ⠟ e2 a0 9f DOTS-12345
-
-    case bsrCellKind::kDots6:      stringForCell = "\xe2\xa0\xa0"; break; // U+2820  ⠠ e2 a0 a0 DOTS-6
-    case bsrCellKind::kDots16:     stringForCell = "\xe2\xa0\xa1"; break; // U+2821  ⠡ e2 a0 a1 DOTS-16
-    case bsrCellKind::kDots26:     stringForCell = "\xe2\xa0\xa2"; break; // U+2822  ⠢ e2 a0 a2 DOTS-26
-    case bsrCellKind::kDots126:    stringForCell = "\xe2\xa0\xa3"; break; // U+2823  ⠣ e2 a0 a3 DOTS-126
-    case bsrCellKind::kDots36:     stringForCell = "\xe2\xa0\xa4"; break; // U+2824  ⠤ e2 a0 a4 DOTS-36
-    case bsrCellKind::kDots136:    stringForCell = "\xe2\xa0\xa5"; break; // U+2825  ⠥ e2 a0 a5 DOTS-136
-    case bsrCellKind::kDots236:    stringForCell = "\xe2\xa0\xa6"; break; // U+2826  ⠦ e2 a0 a6 DOTS-236
-    case bsrCellKind::kDots1236:   stringForCell = "\xe2\xa0\xa7"; break; // U+2827  ⠧ e2 a0 a7 DOTS-1236
-    case bsrCellKind::kDots46:     stringForCell = "\xe2\xa0\xa8"; break; // U+2828  ⠨ e2 a0 a8 DOTS-46
-    case bsrCellKind::kDots146:    stringForCell = "\xe2\xa0\xa9"; break; // U+2829  ⠩ e2 a0 a9 DOTS-146
-    case bsrCellKind::kDots246:    stringForCell = "\xe2\xa0\xaa"; break; // U+282A  ⠪ e2 a0 aa DOTS-246
-    case bsrCellKind::kDots1246:   stringForCell = "\xe2\xa0\xab"; break; // U+282b  ⠫ e2 a0 ab DOTS-1246
-    case bsrCellKind::kDots346:    stringForCell = "\xe2\xa0\xac"; break; // U+282C  ⠬ e2 a0 ac DOTS-346
-    case bsrCellKind::kDots1346:   stringForCell = "\xe2\xa0\xad"; break; // U+282D  ⠭ e2 a0 ad DOTS-1346
-    case bsrCellKind::kDots2346:   stringForCell = "\xe2\xa0\xae"; break; // U+282E  ⠮ e2 a0 ae DOTS-2346
-    case bsrCellKind::kDots12346:  stringForCell = "\xe2\xa0\xaf"; break; // U+282F  ⠯ e2 a0 af DOTS-12346
-
-    case bsrCellKind::kDots56:     stringForCell = "\xe2\xa0\xb0"; break; // U+2830  ⠰ e2 a0 b0 DOTS-56
-    case bsrCellKind::kDots156:    stringForCell = "\xe2\xa0\xb1"; break; // U+2831  ⠱ e2 a0 b1 DOTS-156
-    case bsrCellKind::kDots256:    stringForCell = "\xe2\xa0\xb2"; break; // U+2832  ⠲ e2 a0 b2 DOTS-256
-    case bsrCellKind::kDots1256:   stringForCell = "\xe2\xa0\xb3"; break; // U+2833  ⠳ e2 a0 b3 DOTS-1256
-    case bsrCellKind::kDots356:    stringForCell = "\xe2\xa0\xb4"; break; // U+2834  ⠴ e2 a0 b4 DOTS-356
-    case bsrCellKind::kDots1356:   stringForCell = "\xe2\xa0\xb5"; break; // U+2835  ⠵ e2 a0 b5 DOTS-1356
-    case bsrCellKind::kDots2356:   stringForCell = "\xe2\xa0\xb6"; break; // U+2836  ⠶ e2 a0 b6 DOTS-2356
-    case bsrCellKind::kDots12356:  stringForCell = "\xe2\xa0\xb7"; break; // U+2837  ⠷ e2 a0 b7 DOTS-12356
-    case bsrCellKind::kDots456:    stringForCell = "\xe2\xa0\xb8"; break; // U+2838  ⠸ e2 a0 b8 DOTS-456
-    case bsrCellKind::kDots1456:   stringForCell = "\xe2\xa0\xb9"; break; // U+2839  ⠹ e2 a0 b9 DOTS-1456
-    case bsrCellKind::kDots2456:   stringForCell = "\xe2\xa0\xba"; break; // U+283A  ⠺ e2 a0 ba DOTS-2456
-    case bsrCellKind::kDots12456:  stringForCell = "\xe2\xa0\xbb"; break; // U+283B  ⠻ e2 a0 bb DOTS-12456
-    case bsrCellKind::kDots3456:   stringForCell = "\xe2\xa0\xbc"; break; // U+283C  ⠼ e2 a0 bc DOTS-3456
-    case bsrCellKind::kDots13456:  stringForCell = "\xe2\xa0\xbd"; break; // U+283D  ⠽ e2 a0 bd DOTS-13456
-    case bsrCellKind::kDots23456:  stringForCell = "\xe2\xa0\xbe"; break; // U+283E  ⠾ e2 a0 be DOTS-23456
-    case bsrCellKind::kDots123456: stringForCell = "\xe2\xa0\xbf"; break; // U+283F ⠿ e2 a0 bf DOTS-123456
-  } // switch
-
-  fBrailleOutputStream <<
-    stringForCell;
-}
-
 void bsrUTF16BigEndianBrailleGenerator::writeTestData (std::ostream& os)
 {
   gLog <<
@@ -923,7 +727,8 @@ bsrUTF16SmallEndianBrailleGenerator::bsrUTF16SmallEndianBrailleGenerator (
   bsrByteOrderingKind byteOrderingKind,
   std::ostream&            brailleOutputStream)
     : bsrBrailleGenerator (
-        brailleOutputStream)
+        brailleOutputStream,
+        kUTF16SmallEndianCellCodesTable)
 {
   fByteOrderingKind = byteOrderingKind;
 
@@ -933,143 +738,6 @@ bsrUTF16SmallEndianBrailleGenerator::bsrUTF16SmallEndianBrailleGenerator (
 bsrUTF16SmallEndianBrailleGenerator::~bsrUTF16SmallEndianBrailleGenerator ()
 {}
 
-void bsrUTF16SmallEndianBrailleGenerator::generateCodeForBrailleCell (
-  bsrCellKind cellKind)
-{
-
-// to be fixed JMI
-/*
-
-HTML Entity (Decimal)  &#10241;
-HTML Entity (Hexadecimal)  &#x2801;
-URL Escape Code  %E2%A0%81
-UTF-8 (hex)  0xE2 0xA0 0x81 (e2a081)
-UTF-8 (binary)  11100010:10100000:10000001
-UTF-16/UTF-16BE (hex)  0x2801 (2801)
-UTF-16LE (hex)  0x0128 (0128)
-UTF-32/UTF-32bE (hex)  0x00002801 (00002801)
-UTF-32lE (hex)  0x01280000 (01280000)
-Octal Escape Sequence  \342\240\201
-
-HTML Entity (Decimal)  &#10242;
-HTML Entity (Hexadecimal)  &#x2802;
-URL Escape Code  %E2%A0%82
-UTF-8 (hex)  0xE2 0xA0 0x82 (e2a082)
-UTF-8 (binary)  11100010:10100000:10000010
-UTF-16/UTF-16BE (hex)  0x2802 (2802)
-UTF-16LE (hex)  0x0228 (0228)
-UTF-32/UTF-32bE (hex)  0x00002802 (00002802)
-UTF-32lE (hex)  0x02280000 (02280000)
-Octal Escape Sequence  \342\240\202
-
-HTML Entity (Decimal)  &#10243;
-HTML Entity (Hexadecimal)  &#x2803;
-URL Escape Code  %E2%A0%83
-UTF-8 (hex)  0xE2 0xA0 0x83 (e2a083)
-UTF-8 (binary)  11100010:10100000:10000011
-UTF-16/UTF-16BE (hex)  0x2803 (2803)
-UTF-16LE (hex)  0x0328 (0328)
-UTF-32/UTF-32bE (hex)  0x00002803 (00002803)
-UTF-32lE (hex)  0x03280000 (03280000)
-Octal Escape Sequence  \342\240\203
-*/
-
-  std::string stringForCell;
-
-  switch (cellKind) {
-    case bsrCellKind::kCellUnknown:
-      {
-        std::stringstream ss;
-
-        ss <<
-          "cannot generate code for braille cell '" <<
-          bsrCellKindAsString (cellKind) <<
-          "'";
-        bsr2brailleInternalError (
-          gServiceRunData->getInputSourceName (),
-          -903, // TICINO inputLineNumber,
-          __FILE__, mfInputLineNumber (__LINE__),
-          ss.str ());
-      }
-      break;
-
-    case bsrCellKind::kCellEOL:    stringForCell = "\x0a"; break; // U+000A
-    case bsrCellKind::kCellEOP:    stringForCell = "\x0c"; break; // U+000C
-
-    case bsrCellKind::kDotsNone:   stringForCell = "\xe2\xa0\x80"; break; // U+2800 ⠀ e2 a0 80 BLANK
-
-    case bsrCellKind::kDots1:      stringForCell = "\xe2\xa0\x81"; break; // U+2801 ⠀ e2 a0 81 DOTS-1
-    case bsrCellKind::kDots2:      stringForCell = "\xe2\xa0\x82"; break; // U+2802 ⠀ e2 a0 82 DOTS-2
-    case bsrCellKind::kDots12:     stringForCell = "\xe2\xa0\x83"; break; // U+2803 ⠀ e2 a0 83 DOTS-12
-    case bsrCellKind::kDots3:      stringForCell = "\xe2\xa0\x84"; break; // U+2804  ⠄ e2 a0 84 DOTS-3
-    case bsrCellKind::kDots13:     stringForCell = "\xe2\xa0\x85"; break; // U+2805  ⠅ e2 a0 85 DOTS-13
-    case bsrCellKind::kDots23:     stringForCell = "\xe2\xa0\x86"; break; // U+2806  ⠆ e2 a0 86 DOTS-23
-    case bsrCellKind::kDots123:    stringForCell = "\xe2\xa0\x87"; break; // U+2807  ⠇ e2 a0 87 DOTS-123
-    case bsrCellKind::kDots4:      stringForCell = "\xe2\xa0\x88"; break; // U+2808  ⠈ e2 a0 88 DOTS-4
-    case bsrCellKind::kDots14:     stringForCell = "\xe2\xa0\x89"; break; // U+2809  ⠉ e2 a0 89 DOTS-14
-    case bsrCellKind::kDots24:     stringForCell = "\xe2\xa0\x8a"; break; // U+280A  ⠊ e2 a0 8a DOTS-24
-    case bsrCellKind::kDots124:    stringForCell = "\xe2\xa0\x8b"; break; // U+280B  ⠋ e2 a0 8b DOTS-124
-    case bsrCellKind::kDots34:     stringForCell = "\xe2\xa0\x8c"; break; // U+280C  ⠌ e2 a0 8c DOTS-34
-    case bsrCellKind::kDots134:    stringForCell = "\xe2\xa0\x8d"; break; // U+280D  ⠍ e2 a0 8d DOTS-134
-    case bsrCellKind::kDots234:    stringForCell = "\xe2\xa0\x8e"; break; // U+280E  ⠎ e2 a0 8e DOTS-234
-    case bsrCellKind::kDots1234:   stringForCell = "\xe2\xa0\x8f"; break; // U+280F  ⠏ e2 a0 8f DOTS-1234
-
-    case bsrCellKind::kDots5:      stringForCell = "\xe2\xa0\x90"; break; // U+2810  ⠐ e2 a0 90 DOTS-5
-    case bsrCellKind::kDots15:     stringForCell = "\xe2\xa0\x91"; break; // U+2811  ⠑ e2 a0 91 DOTS-15
-    case bsrCellKind::kDots25:     stringForCell = "\xe2\xa0\x92"; break; // U+2812  ⠒ e2 a0 92 DOTS-25
-    case bsrCellKind::kDots125:    stringForCell = "\xe2\xa0\x93"; break; // U+2813  ⠓ e2 a0 93 DOTS-125
-    case bsrCellKind::kDots35:     stringForCell = "\xe2\xa0\x94"; break; // U+2814  ⠔ e2 a0 94 DOTS-35
-    case bsrCellKind::kDots135:    stringForCell = "\xe2\xa0\x95"; break; // U+2815  ⠕ e2 a0 95 DOTS-135
-    case bsrCellKind::kDots235:    stringForCell = "\xe2\xa0\x96"; break; // U+2816  ⠖ e2 a0 96 DOTS-235
-    case bsrCellKind::kDots1235:   stringForCell = "\xe2\xa0\x97"; break; // U+2817  ⠗ e2 a0 97 DOTS-1235
-    case bsrCellKind::kDots45:     stringForCell = "\xe2\xa0\x98"; break; // U+2818  ⠘ e2 a0 98 DOTS-45
-    case bsrCellKind::kDots145:    stringForCell = "\xe2\xa0\x99"; break; // U+2819  ⠙ e2 a0 99 DOTS-145
-    case bsrCellKind::kDots245:    stringForCell = "\xe2\xa0\x9a"; break; // U+281A  ⠚ e2 a0 9a DOTS-245
-    case bsrCellKind::kDots1245:   stringForCell = "\xe2\xa0\x9b"; break; // U+281B  ⠛ e2 a0 9b DOTS-1245
-    case bsrCellKind::kDots345:    stringForCell = "\xe2\xa0\x9c"; break; // U+281C  ⠜ e2 a0 9c DOTS-345
-    case bsrCellKind::kDots1345:   stringForCell = "\xe2\xa0\x9d"; break; // U+281D  ⠝ e2 a0 9d DOTS-1345
-    case bsrCellKind::kDots2345:   stringForCell = "\xe2\xa0\x9e"; break; // U+281E  ⠞ e2 a0 9e DOTS-2345
-    case bsrCellKind::kDots12345:  stringForCell = "\xe2\xa0\x9f"; break; // U+281F  ⠟ e2 a0 9f DOTS-12345
-
-    case bsrCellKind::kDots6:      stringForCell = "\xe2\xa0\xa0"; break; // U+2820  ⠠ e2 a0 a0 DOTS-6
-    case bsrCellKind::kDots16:     stringForCell = "\xe2\xa0\xa1"; break; // U+2821  ⠡ e2 a0 a1 DOTS-16
-    case bsrCellKind::kDots26:     stringForCell = "\xe2\xa0\xa2"; break; // U+2822  ⠢ e2 a0 a2 DOTS-26
-    case bsrCellKind::kDots126:    stringForCell = "\xe2\xa0\xa3"; break; // U+2823  ⠣ e2 a0 a3 DOTS-126
-    case bsrCellKind::kDots36:     stringForCell = "\xe2\xa0\xa4"; break; // U+2824  ⠤ e2 a0 a4 DOTS-36
-    case bsrCellKind::kDots136:    stringForCell = "\xe2\xa0\xa5"; break; // U+2825  ⠥ e2 a0 a5 DOTS-136
-    case bsrCellKind::kDots236:    stringForCell = "\xe2\xa0\xa6"; break; // U+2826  ⠦ e2 a0 a6 DOTS-236
-    case bsrCellKind::kDots1236:   stringForCell = "\xe2\xa0\xa7"; break; // U+2827  ⠧ e2 a0 a7 DOTS-1236
-    case bsrCellKind::kDots46:     stringForCell = "\xe2\xa0\xa8"; break; // U+2828  ⠨ e2 a0 a8 DOTS-46
-    case bsrCellKind::kDots146:    stringForCell = "\xe2\xa0\xa9"; break; // U+2829  ⠩ e2 a0 a9 DOTS-146
-    case bsrCellKind::kDots246:    stringForCell = "\xe2\xa0\xaa"; break; // U+282A  ⠪ e2 a0 aa DOTS-246
-    case bsrCellKind::kDots1246:   stringForCell = "\xe2\xa0\xab"; break; // U+282b  ⠫ e2 a0 ab DOTS-1246
-    case bsrCellKind::kDots346:    stringForCell = "\xe2\xa0\xac"; break; // U+282C  ⠬ e2 a0 ac DOTS-346
-    case bsrCellKind::kDots1346:   stringForCell = "\xe2\xa0\xad"; break; // U+282D  ⠭ e2 a0 ad DOTS-1346
-    case bsrCellKind::kDots2346:   stringForCell = "\xe2\xa0\xae"; break; // U+282E  ⠮ e2 a0 ae DOTS-2346
-    case bsrCellKind::kDots12346:  stringForCell = "\xe2\xa0\xaf"; break; // U+282F  ⠯ e2 a0 af DOTS-12346
-
-    case bsrCellKind::kDots56:     stringForCell = "\xe2\xa0\xb0"; break; // U+2830  ⠰ e2 a0 b0 DOTS-56
-    case bsrCellKind::kDots156:    stringForCell = "\xe2\xa0\xb1"; break; // U+2831  ⠱ e2 a0 b1 DOTS-156
-    case bsrCellKind::kDots256:    stringForCell = "\xe2\xa0\xb2"; break; // U+2832  ⠲ e2 a0 b2 DOTS-256
-    case bsrCellKind::kDots1256:   stringForCell = "\xe2\xa0\xb3"; break; // U+2833  ⠳ e2 a0 b3 DOTS-1256
-    case bsrCellKind::kDots356:    stringForCell = "\xe2\xa0\xb4"; break; // U+2834  ⠴ e2 a0 b4 DOTS-356
-    case bsrCellKind::kDots1356:   stringForCell = "\xe2\xa0\xb5"; break; // U+2835  ⠵ e2 a0 b5 DOTS-1356
-    case bsrCellKind::kDots2356:   stringForCell = "\xe2\xa0\xb6"; break; // U+2836  ⠶ e2 a0 b6 DOTS-2356
-    case bsrCellKind::kDots12356:  stringForCell = "\xe2\xa0\xb7"; break; // U+2837  ⠷ e2 a0 b7 DOTS-12356
-    case bsrCellKind::kDots456:    stringForCell = "\xe2\xa0\xb8"; break; // U+2838  ⠸ e2 a0 b8 DOTS-456
-    case bsrCellKind::kDots1456:   stringForCell = "\xe2\xa0\xb9"; break; // U+2839  ⠹ e2 a0 b9 DOTS-1456
-    case bsrCellKind::kDots2456:   stringForCell = "\xe2\xa0\xba"; break; // U+283A  ⠺ e2 a0 ba DOTS-2456
-    case bsrCellKind::kDots12456:  stringForCell = "\xe2\xa0\xbb"; break; // U+283B  ⠻ e2 a0 bb DOTS-12456
-    case bsrCellKind::kDots3456:   stringForCell = "\xe2\xa0\xbc"; break; // U+283C  ⠼ e2 a0 bc DOTS-3456
-    case bsrCellKind::kDots13456:  stringForCell = "\xe2\xa0\xbd"; break; // U+283D  ⠽ e2 a0 bd DOTS-13456
-    case bsrCellKind::kDots23456:  stringForCell = "\xe2\xa0\xbe"; break; // U+283E  ⠾ e2 a0 be DOTS-23456
-    case bsrCellKind::kDots123456: stringForCell = "\xe2\xa0\xbf"; break; // U+283F ⠿ e2 a0 bf DOTS-123456
-  } // switch
-
-  fBrailleOutputStream <<
-    stringForCell;
-}
-
 void bsrUTF16SmallEndianBrailleGenerator::writeTestData (std::ostream& os)
 {
   gLog <<
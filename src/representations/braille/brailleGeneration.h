@@ -12,6 +12,8 @@
 #ifndef ___brailleGeneration___
 #define ___brailleGeneration___
 
+#include <array>
+
 #include "bsrCellsLists.h"
 
 #include "bsrMusicHeadings.h"
@@ -54,6 +56,20 @@ const std::string
   kBOM_UTF_8 =
     "\xEF\xBB\xBF";     // UTF-8
 
+//______________________________________________________________________________
+// the code of a braille cell in a given output encoding
+constexpr size_t K_BSR_CELL_CODE_MAX_BYTES_NUMBER = 3;
+
+struct bsrCellCode {
+  char                    fBytes [K_BSR_CELL_CODE_MAX_BYTES_NUMBER];
+  unsigned char           fBytesNumber; // 0 for kCellUnknown
+};
+
+constexpr size_t K_BSR_CELL_KINDS_NUMBER =
+  size_t (bsrCellKind::kDots123456) + 1;
+
+typedef std::array <bsrCellCode, K_BSR_CELL_KINDS_NUMBER> bsrCellCodesTable;
+
 //______________________________________________________________________________
 class EXP bsrBrailleGenerator : public smartable
 {
@@ -73,7 +89,8 @@ class EXP bsrBrailleGenerator : public smartable
     // ------------------------------------------------------
 
                           bsrBrailleGenerator (
-                            std::ostream& brailleOutputStream);
+                            std::ostream&            brailleOutputStream,
+                            const bsrCellCodesTable& cellCodesTable);
 
     virtual               ~bsrBrailleGenerator ();
 
@@ -87,12 +104,19 @@ class EXP bsrBrailleGenerator : public smartable
     // public services
     // ------------------------------------------------------
 
-    virtual void          generateCodeForBrailleCell (
-                            bsrCellKind cellKind) = 0;
+    void                  generateCodeForBrailleCell (
+                            bsrCellKind cellKind);
 
     void                  generateCodeForCellsList (
                             const S_bsrCellsList& cellsList);
 
+    // appends the code of the cells to codeBuffer,
+    // looking them up in the cell codes table
+    void                  appendCodeForCells (
+                            const bsrCellKind* cells,
+                            size_t             cellsNumber,
+                            std::string&       codeBuffer) const;
+
     virtual void          generateCodeForMusicHeading (
                             const S_bsrMusicHeading& musicHeading);
 
@@ -114,6 +138,11 @@ class EXP bsrBrailleGenerator : public smartable
     // ------------------------------------------------------
 
     std::ostream&              fBrailleOutputStream;
+
+    const bsrCellCodesTable&   fCellCodesTable;
+
+    // the code of a whole cells list is written at once
+    std::string                fCodeBuffer;
 };
 typedef SMARTP<bsrBrailleGenerator> S_bsrBrailleGenerator;
 EXP std::ostream& operator << (std::ostream& os, const S_bsrBrailleGenerator& elt);
@@ -149,9 +178,6 @@ class EXP bsrAsciiBrailleGenerator : public bsrBrailleGenerator
     // public services
     // ------------------------------------------------------
 
-    virtual void          generateCodeForBrailleCell (
-                            bsrCellKind cellKind) override;
-
     static void           writeTestData (std::ostream& os);
 
   public:
@@ -207,9 +233,6 @@ class EXP bsrUTF8BrailleGenerator : public bsrBrailleGenerator
     // public services
     // ------------------------------------------------------
 
-    virtual void          generateCodeForBrailleCell (
-                            bsrCellKind cellKind) override;
-
     static void           writeTestData (std::ostream& os);
 
   public:
@@ -323,9 +346,6 @@ class EXP bsrUTF16BigEndianBrailleGenerator : public bsrBrailleGenerator
     // public services
     // ------------------------------------------------------
 
-    virtual void          generateCodeForBrailleCell (
-                            bsrCellKind cellKind) override;
-
     static void           writeTestData (std::ostream& os);
 
   public:
@@ -383,9 +403,6 @@ class EXP bsrUTF16SmallEndianBrailleGenerator : public bsrBrailleGenerator
     // public services
     // ------------------------------------------------------
 
-    virtual void          generateCodeForBrailleCell (
-                            bsrCellKind cellKind) override;
-
     static void           writeTestData (std::ostream& os);
 
   public:
@@ -145,7 +145,7 @@ void brailleOutputKindAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_brailleOutputKindAtom>*
     p =
-      dynamic_cast<visitor<S_brailleOutputKindAtom>*> (v)) {
+      visitor<S_brailleOutputKindAtom>::cast (v)) {
         S_brailleOutputKindAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -181,7 +181,7 @@ void brailleOutputKindAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_brailleOutputKindAtom>*
     p =
-      dynamic_cast<visitor<S_brailleOutputKindAtom>*> (v)) {
+      visitor<S_brailleOutputKindAtom>::cast (v)) {
         S_brailleOutputKindAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -411,7 +411,7 @@ void brailleUTFKindAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_brailleUTFKindAtom>*
     p =
-      dynamic_cast<visitor<S_brailleUTFKindAtom>*> (v)) {
+      visitor<S_brailleUTFKindAtom>::cast (v)) {
         S_brailleUTFKindAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -447,7 +447,7 @@ void brailleUTFKindAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_brailleUTFKindAtom>*
     p =
-      dynamic_cast<visitor<S_brailleUTFKindAtom>*> (v)) {
+      visitor<S_brailleUTFKindAtom>::cast (v)) {
         S_brailleUTFKindAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -671,7 +671,7 @@ void brailleByteOrderingKindAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_brailleByteOrderingKindAtom>*
     p =
-      dynamic_cast<visitor<S_brailleByteOrderingKindAtom>*> (v)) {
+      visitor<S_brailleByteOrderingKindAtom>::cast (v)) {
         S_brailleByteOrderingKindAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -707,7 +707,7 @@ void brailleByteOrderingKindAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_brailleByteOrderingKindAtom>*
     p =
-      dynamic_cast<visitor<S_brailleByteOrderingKindAtom>*> (v)) {
+      visitor<S_brailleByteOrderingKindAtom>::cast (v)) {
         S_brailleByteOrderingKindAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -1165,7 +1165,7 @@ void brailleGenerationOahGroup::acceptIn (basevisitor* v)
 
   if (visitor<S_brailleGenerationOahGroup>*
     p =
-      dynamic_cast<visitor<S_brailleGenerationOahGroup>*> (v)) {
+      visitor<S_brailleGenerationOahGroup>::cast (v)) {
         S_brailleGenerationOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -1201,7 +1201,7 @@ void brailleGenerationOahGroup::acceptOut (basevisitor* v)
 
   if (visitor<S_brailleGenerationOahGroup>*
     p =
-      dynamic_cast<visitor<S_brailleGenerationOahGroup>*> (v)) {
+      visitor<S_brailleGenerationOahGroup>::cast (v)) {
         S_brailleGenerationOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
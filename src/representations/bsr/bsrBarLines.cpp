@@ -132,7 +132,7 @@ void bsrBarLine::acceptIn (basevisitor* v)
 
   if (visitor<S_bsrBarLine>*
     p =
-      dynamic_cast<visitor<S_bsrBarLine>*> (v)) {
+      visitor<S_bsrBarLine>::cast (v)) {
         S_bsrBarLine elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -169,7 +169,7 @@ void bsrBarLine::acceptOut (basevisitor* v)
 
   if (visitor<S_bsrBarLine>*
     p =
-      dynamic_cast<visitor<S_bsrBarLine>*> (v)) {
+      visitor<S_bsrBarLine>::cast (v)) {
         S_bsrBarLine elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
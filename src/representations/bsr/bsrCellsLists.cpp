@@ -213,17 +213,10 @@ void bsrCellsList::appendCellsListToCellsList (
   const S_bsrCellsList& otherCellsList)
 {
   if (otherCellsList) {
-    if (otherCellsList->fCellsListElements.size ()) {
-      std::list <bsrCellKind>::const_iterator
-        iBegin = otherCellsList->fCellsListElements.begin (),
-        iEnd   = otherCellsList->fCellsListElements.end (),
-        i      = iBegin;
-      for ( ; ; ) {
-        fCellsListElements.push_back ((*i));
-        if (++i == iEnd) break;
-   // JMI      os << ' ';
-      } // for
-    }
+    fCellsListElements.insert (
+      fCellsListElements.end (),
+      otherCellsList->fCellsListElements.begin (),
+      otherCellsList->fCellsListElements.end ());
   }
 }
 
@@ -231,17 +224,10 @@ void bsrCellsList::prependCellsListToCellsList (
   const S_bsrCellsList& otherCellsList)
 {
   if (otherCellsList) {
-    if (otherCellsList->fCellsListElements.size ()) {
-      std::list <bsrCellKind>::const_reverse_iterator
-        iBegin = otherCellsList->fCellsListElements.rbegin (),
-        iEnd   = otherCellsList->fCellsListElements.rend (),
-        i      = iBegin;
-      for ( ; ; ) {
-        fCellsListElements.push_front ((*i));
-        if (++i == iEnd) break;
-   // JMI      os << ' ';
-      } // for
-    }
+    fCellsListElements.insert (
+      fCellsListElements.begin (),
+      otherCellsList->fCellsListElements.begin (),
+      otherCellsList->fCellsListElements.end ());
   }
 }
 
@@ -249,7 +235,7 @@ void bsrCellsList::prependCellsListToCellsList (
 void bsrCellsList::generateBrailleCode (std::ostream& os)
 {
   if (fCellsListElements.size ()) {
-    std::list <bsrCellKind>::const_iterator
+    std::vector <bsrCellKind>::const_iterator
       iBegin = fCellsListElements.begin (),
       iEnd   = fCellsListElements.end (),
       i      = iBegin;
@@ -281,7 +267,7 @@ void bsrCellsList::acceptIn (basevisitor* v)
 
   if (visitor<S_bsrCellsList>*
     p =
-      dynamic_cast<visitor<S_bsrCellsList>*> (v)) {
+      visitor<S_bsrCellsList>::cast (v)) {
         S_bsrCellsList elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -318,7 +304,7 @@ void bsrCellsList::acceptOut (basevisitor* v)
 
   if (visitor<S_bsrCellsList>*
     p =
-      dynamic_cast<visitor<S_bsrCellsList>*> (v)) {
+      visitor<S_bsrCellsList>::cast (v)) {
         S_bsrCellsList elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -349,7 +335,7 @@ std::string bsrCellsList::asString () const
     "cellsListElements [";
 
   if (fCellsListElements.size ()) {
-    std::list <bsrCellKind>::const_iterator
+    std::vector <bsrCellKind>::const_iterator
       iBegin = fCellsListElements.begin (),
       iEnd   = fCellsListElements.end (),
       i      = iBegin;
@@ -378,7 +364,7 @@ void bsrCellsList::print (std::ostream& os) const
     "cellsListElements [";
 
   if (fCellsListElements.size ()) {
-    std::list <bsrCellKind>::const_iterator
+    std::vector <bsrCellKind>::const_iterator
       iBegin = fCellsListElements.begin (),
       iEnd   = fCellsListElements.end (),
       i      = iBegin;
@@ -412,5 +398,10 @@ bsrCellsList& operator << (bsrCellsList& cellsList, const bsrCellKind cellKind)
   return cellsList;
 }
 
+//______________________________________________________________________________
+// 0 is the generation of the caches that have never been filled
+std::atomic <unsigned int>
+  bsrCellsListCache::sCellsListsGeneration (1);
+
 
 }
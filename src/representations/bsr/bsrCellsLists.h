@@ -12,6 +12,7 @@
 #ifndef ___bsrCellsLists___
 #define ___bsrCellsLists___
 
+#include <atomic>
 #include <list>
 #include <vector>
 
@@ -138,7 +139,7 @@ class EXP bsrCellsList : public smartable
     // set and get
     // ------------------------------------------------------
 
-    const std::list <bsrCellKind>&
+    const std::vector <bsrCellKind>&
                           getCellsListElements () const
                               { return fCellsListElements; }
 
@@ -187,11 +188,69 @@ class EXP bsrCellsList : public smartable
     // protected fields
     // ------------------------------------------------------
 
-    std::list <bsrCellKind>     fCellsListElements;
+    // contiguous, for the braille generators to encode it in bulk
+    std::vector <bsrCellKind>   fCellsListElements;
 };
 typedef SMARTP<bsrCellsList> S_bsrCellsList;
 EXP std::ostream& operator << (std::ostream& os, const S_bsrCellsList& elt);
 
+//______________________________________________________________________________
+/*
+  The BSR elements whose cells depend on their contents or on setters
+  build their cells list lazily and keep it in a bsrCellsListCache.
+
+  Any change to the cells of a BSR element calls invalidateAllCellsListsCaches (),
+  which makes all the caches stale, those of the element's ancestors included.
+  The BSR is complete before its cells are needed, so the caches
+  are filled once and reused by the line contents, the line widths and braille generation.
+*/
+class EXP bsrCellsListCache
+{
+  public:
+
+    // constructor
+    // ------------------------------------------------------
+
+                          bsrCellsListCache ()
+                              : fCachedGeneration (0)
+                              {}
+
+  public:
+
+    // public services
+    // ------------------------------------------------------
+
+    // returns nullptr if the cells list has not been cached since the last change
+    S_bsrCellsList        fetchCachedCellsList () const
+                              {
+                                return
+                                  fCachedGeneration == sCellsListsGeneration
+                                    ? fCachedCellsList
+                                    : nullptr;
+                              }
+
+    void                  cacheCellsList (
+                            const S_bsrCellsList& cellsList)
+                              {
+                                fCachedCellsList = cellsList;
+                                fCachedGeneration = sCellsListsGeneration;
+                              }
+
+    static void           invalidateAllCellsListsCaches ()
+                              { ++sCellsListsGeneration; }
+
+  private:
+
+    // private fields
+    // ------------------------------------------------------
+
+    S_bsrCellsList        fCachedCellsList;
+    unsigned int          fCachedGeneration;
+
+    static std::atomic <unsigned int>
+                          sCellsListsGeneration;
+};
+
 
 }
 
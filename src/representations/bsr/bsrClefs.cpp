@@ -175,7 +175,7 @@ void bsrClef::acceptIn (basevisitor* v)
 
   if (visitor<S_bsrClef>*
     p =
-      dynamic_cast<visitor<S_bsrClef>*> (v)) {
+      visitor<S_bsrClef>::cast (v)) {
         S_bsrClef elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -212,7 +212,7 @@ void bsrClef::acceptOut (basevisitor* v)
 
   if (visitor<S_bsrClef>*
     p =
-      dynamic_cast<visitor<S_bsrClef>*> (v)) {
+      visitor<S_bsrClef>::cast (v)) {
         S_bsrClef elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
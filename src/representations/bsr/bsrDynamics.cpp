@@ -250,7 +250,7 @@ void bsrDynamic::acceptIn (basevisitor* v)
 
   if (visitor<S_bsrDynamic>*
     p =
-      dynamic_cast<visitor<S_bsrDynamic>*> (v)) {
+      visitor<S_bsrDynamic>::cast (v)) {
         S_bsrDynamic elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -287,7 +287,7 @@ void bsrDynamic::acceptOut (basevisitor* v)
 
   if (visitor<S_bsrDynamic>*
     p =
-      dynamic_cast<visitor<S_bsrDynamic>*> (v)) {
+      visitor<S_bsrDynamic>::cast (v)) {
         S_bsrDynamic elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
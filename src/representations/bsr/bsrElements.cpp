@@ -60,7 +60,7 @@ void bsrElement::acceptIn (basevisitor* v)
 
   if (visitor<S_bsrElement>*
     p =
-      dynamic_cast<visitor<S_bsrElement>*> (v)) {
+      visitor<S_bsrElement>::cast (v)) {
         S_bsrElement elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -97,7 +97,7 @@ void bsrElement::acceptOut (basevisitor* v)
 
   if (visitor<S_bsrElement>*
     p =
-      dynamic_cast<visitor<S_bsrElement>*> (v)) {
+      visitor<S_bsrElement>::cast (v)) {
         S_bsrElement elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
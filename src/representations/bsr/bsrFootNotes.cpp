@@ -69,7 +69,7 @@ void bsrFootNotes::acceptIn (basevisitor* v)
 
   if (visitor<S_bsrFootNotes>*
     p =
-      dynamic_cast<visitor<S_bsrFootNotes>*> (v)) {
+      visitor<S_bsrFootNotes>::cast (v)) {
         S_bsrFootNotes elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -106,7 +106,7 @@ void bsrFootNotes::acceptOut (basevisitor* v)
 
   if (visitor<S_bsrFootNotes>*
     p =
-      dynamic_cast<visitor<S_bsrFootNotes>*> (v)) {
+      visitor<S_bsrFootNotes>::cast (v)) {
         S_bsrFootNotes elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
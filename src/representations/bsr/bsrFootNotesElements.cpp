@@ -73,7 +73,7 @@ void bsrFootNotesElement::acceptIn (basevisitor* v)
 
   if (visitor<S_bsrFootNotesElement>*
     p =
-      dynamic_cast<visitor<S_bsrFootNotesElement>*> (v)) {
+      visitor<S_bsrFootNotesElement>::cast (v)) {
         S_bsrFootNotesElement elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -110,7 +110,7 @@ void bsrFootNotesElement::acceptOut (basevisitor* v)
 
   if (visitor<S_bsrFootNotesElement>*
     p =
-      dynamic_cast<visitor<S_bsrFootNotesElement>*> (v)) {
+      visitor<S_bsrFootNotesElement>::cast (v)) {
         S_bsrFootNotesElement elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
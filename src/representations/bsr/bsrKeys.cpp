@@ -227,7 +227,7 @@ void bsrKey::acceptIn (basevisitor* v)
 
   if (visitor<S_bsrKey>*
     p =
-      dynamic_cast<visitor<S_bsrKey>*> (v)) {
+      visitor<S_bsrKey>::cast (v)) {
         S_bsrKey elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -264,7 +264,7 @@ void bsrKey::acceptOut (basevisitor* v)
 
   if (visitor<S_bsrKey>*
     p =
-      dynamic_cast<visitor<S_bsrKey>*> (v)) {
+      visitor<S_bsrKey>::cast (v)) {
         S_bsrKey elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
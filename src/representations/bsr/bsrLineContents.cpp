@@ -116,6 +116,8 @@ void bsrLineContents::appendLineElementToLineContents (
   const S_bsrLineContentsElement& lineElement)
 {
   fLineContentsLineElementsList.push_back (lineElement);
+
+  bsrCellsListCache::invalidateAllCellsListsCaches ();
 }
 
 void bsrLineContents::insertLineElementBeforeLastElementOfLineContents (
@@ -147,6 +149,8 @@ void bsrLineContents::insertLineElementBeforeLastElementOfLineContents (
 
     fLineContentsLineElementsList.insert (
       it, lineElement);
+
+    bsrCellsListCache::invalidateAllCellsListsCaches ();
   }
   else {
     std::stringstream ss;
@@ -187,24 +191,26 @@ S_bsrCellsList bsrLineContents::buildLineContentsElementsList () const
   return result;
 }
 
-int bsrLineContents::fetchCellsNumber () const
+S_bsrCellsList bsrLineContents::fetchCellsList () const
 {
-  int result = 0;
+  S_bsrCellsList
+    result =
+      fCellsListCache.fetchCachedCellsList ();
 
-  for (
-    std::list <S_bsrLineContentsElement>::const_iterator i =
-      fLineContentsLineElementsList.begin ();
-    i != fLineContentsLineElementsList.end ();
-    ++i
-  ) {
-    S_bsrLineContentsElement lineElement = (*i);
+  if (! result) {
+    result = buildLineContentsElementsList ();
 
-    result += lineElement->fetchCellsNumber ();
-  } // for
+    fCellsListCache.cacheCellsList (result);
+  }
 
   return result;
 }
 
+int bsrLineContents::fetchCellsNumber () const
+{
+  return fetchCellsList ()->fetchCellsNumber ();
+}
+
 void bsrLineContents::acceptIn (basevisitor* v)
 {
 #ifdef MF_TRACE_IS_ENABLED
@@ -223,7 +229,7 @@ void bsrLineContents::acceptIn (basevisitor* v)
 
   if (visitor<S_bsrLineContents>*
     p =
-      dynamic_cast<visitor<S_bsrLineContents>*> (v)) {
+      visitor<S_bsrLineContents>::cast (v)) {
         S_bsrLineContents elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -260,7 +266,7 @@ void bsrLineContents::acceptOut (basevisitor* v)
 
   if (visitor<S_bsrLineContents>*
     p =
-      dynamic_cast<visitor<S_bsrLineContents>*> (v)) {
+      visitor<S_bsrLineContents>::cast (v)) {
         S_bsrLineContents elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
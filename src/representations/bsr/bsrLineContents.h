@@ -93,8 +93,7 @@ class EXP bsrLineContents : public bsrElement
     void                  insertLineElementBeforeLastElementOfLineContents (
                             const S_bsrLineContentsElement& lineElement);
 
-    S_bsrCellsList        fetchCellsList () const
-                              { return buildLineContentsElementsList (); } // JMI ???
+    S_bsrCellsList        fetchCellsList () const;
 
     int                   fetchCellsNumber () const;
 
@@ -139,6 +138,10 @@ class EXP bsrLineContents : public bsrElement
 
     std::list <S_bsrLineContentsElement>
                           fLineContentsLineElementsList;
+
+    // built lazily, see bsrCellsListCache
+    mutable bsrCellsListCache
+                          fCellsListCache;
 };
 typedef SMARTP<bsrLineContents> S_bsrLineContents;
 EXP std::ostream& operator << (std::ostream& os, const S_bsrLineContents& elt);
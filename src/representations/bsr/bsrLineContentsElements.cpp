@@ -86,7 +86,7 @@ void bsrLineContentsElement::acceptIn (basevisitor* v)
 
   if (visitor<S_bsrLineContentsElement>*
     p =
-      dynamic_cast<visitor<S_bsrLineContentsElement>*> (v)) {
+      visitor<S_bsrLineContentsElement>::cast (v)) {
         S_bsrLineContentsElement elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -123,7 +123,7 @@ void bsrLineContentsElement::acceptOut (basevisitor* v)
 
   if (visitor<S_bsrLineContentsElement>*
     p =
-      dynamic_cast<visitor<S_bsrLineContentsElement>*> (v)) {
+      visitor<S_bsrLineContentsElement>::cast (v)) {
         S_bsrLineContentsElement elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
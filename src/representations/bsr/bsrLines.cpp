@@ -432,7 +432,7 @@ void bsrLine::acceptIn (basevisitor* v)
 
   if (visitor<S_bsrLine>*
     p =
-      dynamic_cast<visitor<S_bsrLine>*> (v)) {
+      visitor<S_bsrLine>::cast (v)) {
         S_bsrLine elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -469,7 +469,7 @@ void bsrLine::acceptOut (basevisitor* v)
 
   if (visitor<S_bsrLine>*
     p =
-      dynamic_cast<visitor<S_bsrLine>*> (v)) {
+      visitor<S_bsrLine>::cast (v)) {
         S_bsrLine elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
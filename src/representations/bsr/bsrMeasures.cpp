@@ -106,6 +106,8 @@ void bsrMeasure::appendLineElementToMeasure (
   const S_bsrLineContentsElement& lineElement)
 {
   fMeasureLineElementsList.push_back (lineElement);
+
+  bsrCellsListCache::invalidateAllCellsListsCaches ();
 }
 
 void bsrMeasure::appendClefToMeasure (S_bsrClef clef)
@@ -239,9 +241,24 @@ S_bsrCellsList bsrMeasure::buildCellsList () const
   return result;
 }
 
+S_bsrCellsList bsrMeasure::fetchCellsList () const
+{
+  S_bsrCellsList
+    result =
+      fCellsListCache.fetchCachedCellsList ();
+
+  if (! result) {
+    result = buildCellsList ();
+
+    fCellsListCache.cacheCellsList (result);
+  }
+
+  return result;
+}
+
 int bsrMeasure::fetchCellsNumber () const
 {
-  return buildCellsList ()->fetchCellsNumber ();
+  return fetchCellsList ()->fetchCellsNumber ();
 }
 
 void bsrMeasure::acceptIn (basevisitor* v)
@@ -262,7 +279,7 @@ void bsrMeasure::acceptIn (basevisitor* v)
 
   if (visitor<S_bsrMeasure>*
     p =
-      dynamic_cast<visitor<S_bsrMeasure>*> (v)) {
+      visitor<S_bsrMeasure>::cast (v)) {
         S_bsrMeasure elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -299,7 +316,7 @@ void bsrMeasure::acceptOut (basevisitor* v)
 
   if (visitor<S_bsrMeasure>*
     p =
-      dynamic_cast<visitor<S_bsrMeasure>*> (v)) {
+      visitor<S_bsrMeasure>::cast (v)) {
         S_bsrMeasure elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
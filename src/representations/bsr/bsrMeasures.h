@@ -81,8 +81,7 @@ class EXP bsrMeasure : public bsrLineContentsElement
 
     void                  appendDynamicToMeasure (S_bsrDynamic dynamic);
 
-    S_bsrCellsList        fetchCellsList () const override
-                              { return buildCellsList (); }
+    S_bsrCellsList        fetchCellsList () const override;
 
     int                   fetchCellsNumber () const override;
 
@@ -127,6 +126,10 @@ class EXP bsrMeasure : public bsrLineContentsElement
 
     std::list <S_bsrLineContentsElement>
                           fMeasureLineElementsList;
+
+    // built lazily, see bsrCellsListCache
+    mutable bsrCellsListCache
+                          fCellsListCache;
 };
 typedef SMARTP<bsrMeasure> S_bsrMeasure;
 EXP std::ostream& operator << (std::ostream& os, const S_bsrMeasure& elt);
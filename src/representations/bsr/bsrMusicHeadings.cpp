@@ -103,7 +103,7 @@ void bsrMusicHeading::acceptIn (basevisitor* v)
 
   if (visitor<S_bsrMusicHeading>*
     p =
-      dynamic_cast<visitor<S_bsrMusicHeading>*> (v)) {
+      visitor<S_bsrMusicHeading>::cast (v)) {
         S_bsrMusicHeading elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -140,7 +140,7 @@ void bsrMusicHeading::acceptOut (basevisitor* v)
 
   if (visitor<S_bsrMusicHeading>*
     p =
-      dynamic_cast<visitor<S_bsrMusicHeading>*> (v)) {
+      visitor<S_bsrMusicHeading>::cast (v)) {
         S_bsrMusicHeading elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
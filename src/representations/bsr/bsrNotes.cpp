@@ -859,9 +859,24 @@ S_bsrCellsList bsrNote::buildCellsList () const
   return result;
 }
 
+S_bsrCellsList bsrNote::fetchCellsList () const
+{
+  S_bsrCellsList
+    result =
+      fCellsListCache.fetchCachedCellsList ();
+
+  if (! result) {
+    result = buildCellsList ();
+
+    fCellsListCache.cacheCellsList (result);
+  }
+
+  return result;
+}
+
 int bsrNote::fetchCellsNumber() const
 {
-  return buildCellsList ()->fetchCellsNumber();
+  return fetchCellsList ()->fetchCellsNumber();
 }
 
 void bsrNote::acceptIn (basevisitor* v)
@@ -882,7 +897,7 @@ void bsrNote::acceptIn (basevisitor* v)
 
   if (visitor<S_bsrNote>*
     p =
-      dynamic_cast<visitor<S_bsrNote>*> (v)) {
+      visitor<S_bsrNote>::cast (v)) {
         S_bsrNote elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -919,7 +934,7 @@ void bsrNote::acceptOut (basevisitor* v)
 
   if (visitor<S_bsrNote>*
     p =
-      dynamic_cast<visitor<S_bsrNote>*> (v)) {
+      visitor<S_bsrNote>::cast (v)) {
         S_bsrNote elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -246,14 +246,20 @@ class EXP bsrNote : public bsrLineContentsElement
                               { return fNoteDotsNumber; }
 
     void                  setNoteValueSizeIsNeeded ()
-                              { fNoteValueSizeIsNeeded = true; }
+                              {
+                                fNoteValueSizeIsNeeded = true;
+                                bsrCellsListCache::invalidateAllCellsListsCaches ();
+                              }
 
     Bool                  getNoteValueSizeIsNeeded () const
                               { return fNoteValueSizeIsNeeded; }
 
     void                  setNoteOctaveIsNeeded (
                             bsrNoteOctaveIsNeeded value)
-                              { fNoteOctaveIsNeeded = value; }
+                              {
+                                fNoteOctaveIsNeeded = value;
+                                bsrCellsListCache::invalidateAllCellsListsCaches ();
+                              }
 
     bsrNoteOctaveIsNeeded getNoteOctaveIsNeeded () const
                               { return fNoteOctaveIsNeeded; }
@@ -266,8 +272,7 @@ class EXP bsrNote : public bsrLineContentsElement
     // public services
     // ------------------------------------------------------
 
-    S_bsrCellsList        fetchCellsList () const override
-                              { return buildCellsList (); }
+    S_bsrCellsList        fetchCellsList () const override;
 
     int                   fetchCellsNumber () const override;
 
@@ -318,6 +323,10 @@ class EXP bsrNote : public bsrLineContentsElement
     bsrNoteOctaveIsNeeded fNoteOctaveIsNeeded;
 
     bsrAccidentalKind     fAccidentalKind;
+
+    // built lazily, see bsrCellsListCache
+    mutable bsrCellsListCache
+                          fCellsListCache;
 };
 typedef SMARTP<bsrNote> S_bsrNote;
 EXP std::ostream& operator << (std::ostream& os, const S_bsrNote& elt);
@@ -169,7 +169,7 @@ void bsrNumber::acceptIn (basevisitor* v)
 
   if (visitor<S_bsrNumber>*
     p =
-      dynamic_cast<visitor<S_bsrNumber>*> (v)) {
+      visitor<S_bsrNumber>::cast (v)) {
         S_bsrNumber elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -206,7 +206,7 @@ void bsrNumber::acceptOut (basevisitor* v)
 
   if (visitor<S_bsrNumber>*
     p =
-      dynamic_cast<visitor<S_bsrNumber>*> (v)) {
+      visitor<S_bsrNumber>::cast (v)) {
         S_bsrNumber elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
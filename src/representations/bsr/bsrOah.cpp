@@ -139,7 +139,7 @@ void bsrFacSimileKindAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_bsrFacSimileKindAtom>*
     p =
-      dynamic_cast<visitor<S_bsrFacSimileKindAtom>*> (v)) {
+      visitor<S_bsrFacSimileKindAtom>::cast (v)) {
         S_bsrFacSimileKindAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -175,7 +175,7 @@ void bsrFacSimileKindAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_bsrFacSimileKindAtom>*
     p =
-      dynamic_cast<visitor<S_bsrFacSimileKindAtom>*> (v)) {
+      visitor<S_bsrFacSimileKindAtom>::cast (v)) {
         S_bsrFacSimileKindAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -377,7 +377,7 @@ void bsrTextsLanguageAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_bsrTextsLanguageAtom>*
     p =
-      dynamic_cast<visitor<S_bsrTextsLanguageAtom>*> (v)) {
+      visitor<S_bsrTextsLanguageAtom>::cast (v)) {
         S_bsrTextsLanguageAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -413,7 +413,7 @@ void bsrTextsLanguageAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_bsrTextsLanguageAtom>*
     p =
-      dynamic_cast<visitor<S_bsrTextsLanguageAtom>*> (v)) {
+      visitor<S_bsrTextsLanguageAtom>::cast (v)) {
         S_bsrTextsLanguageAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -832,7 +832,7 @@ void bsrOahGroup::acceptIn (basevisitor* v)
 
   if (visitor<S_bsrOahGroup>*
     p =
-      dynamic_cast<visitor<S_bsrOahGroup>*> (v)) {
+      visitor<S_bsrOahGroup>::cast (v)) {
         S_bsrOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -868,7 +868,7 @@ void bsrOahGroup::acceptOut (basevisitor* v)
 
   if (visitor<S_bsrOahGroup>*
     p =
-      dynamic_cast<visitor<S_bsrOahGroup>*> (v)) {
+      visitor<S_bsrOahGroup>::cast (v)) {
         S_bsrOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
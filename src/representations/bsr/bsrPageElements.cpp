@@ -87,7 +87,7 @@ void bsrPageElement::acceptIn (basevisitor* v)
 
   if (visitor<S_bsrPageElement>*
     p =
-      dynamic_cast<visitor<S_bsrPageElement>*> (v)) {
+      visitor<S_bsrPageElement>::cast (v)) {
         S_bsrPageElement elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -124,7 +124,7 @@ void bsrPageElement::acceptOut (basevisitor* v)
 
   if (visitor<S_bsrPageElement>*
     p =
-      dynamic_cast<visitor<S_bsrPageElement>*> (v)) {
+      visitor<S_bsrPageElement>::cast (v)) {
         S_bsrPageElement elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -125,7 +125,7 @@ void bsrPageHeading::acceptIn (basevisitor* v)
 
   if (visitor<S_bsrPageHeading>*
     p =
-      dynamic_cast<visitor<S_bsrPageHeading>*> (v)) {
+      visitor<S_bsrPageHeading>::cast (v)) {
         S_bsrPageHeading elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -162,7 +162,7 @@ void bsrPageHeading::acceptOut (basevisitor* v)
 
   if (visitor<S_bsrPageHeading>*
     p =
-      dynamic_cast<visitor<S_bsrPageHeading>*> (v)) {
+      visitor<S_bsrPageHeading>::cast (v)) {
         S_bsrPageHeading elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
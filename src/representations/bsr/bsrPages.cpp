@@ -136,7 +136,7 @@ void bsrPage::acceptIn (basevisitor* v)
 
   if (visitor<S_bsrPage>*
     p =
-      dynamic_cast<visitor<S_bsrPage>*> (v)) {
+      visitor<S_bsrPage>::cast (v)) {
         S_bsrPage elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -173,7 +173,7 @@ void bsrPage::acceptOut (basevisitor* v)
 
   if (visitor<S_bsrPage>*
     p =
-      dynamic_cast<visitor<S_bsrPage>*> (v)) {
+      visitor<S_bsrPage>::cast (v)) {
         S_bsrPage elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
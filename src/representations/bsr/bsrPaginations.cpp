@@ -123,7 +123,7 @@ void bsrPagination::acceptIn (basevisitor* v)
 
   if (visitor<S_bsrPagination>*
     p =
-      dynamic_cast<visitor<S_bsrPagination>*> (v)) {
+      visitor<S_bsrPagination>::cast (v)) {
         S_bsrPagination elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -160,7 +160,7 @@ void bsrPagination::acceptOut (basevisitor* v)
 
   if (visitor<S_bsrPagination>*
     p =
-      dynamic_cast<visitor<S_bsrPagination>*> (v)) {
+      visitor<S_bsrPagination>::cast (v)) {
         S_bsrPagination elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
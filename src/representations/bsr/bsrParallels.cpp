@@ -80,7 +80,7 @@ void bsrParallel::acceptIn (basevisitor* v)
 
   if (visitor<S_bsrParallel>*
     p =
-      dynamic_cast<visitor<S_bsrParallel>*> (v)) {
+      visitor<S_bsrParallel>::cast (v)) {
         S_bsrParallel elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -117,7 +117,7 @@ void bsrParallel::acceptOut (basevisitor* v)
 
   if (visitor<S_bsrParallel>*
     p =
-      dynamic_cast<visitor<S_bsrParallel>*> (v)) {
+      visitor<S_bsrParallel>::cast (v)) {
         S_bsrParallel elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -78,7 +78,7 @@ void bsrScore::acceptIn (basevisitor* v)
 
   if (visitor<S_bsrScore>*
     p =
-      dynamic_cast<visitor<S_bsrScore>*> (v)) {
+      visitor<S_bsrScore>::cast (v)) {
         S_bsrScore elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -115,7 +115,7 @@ void bsrScore::acceptOut (basevisitor* v)
 
   if (visitor<S_bsrScore>*
     p =
-      dynamic_cast<visitor<S_bsrScore>*> (v)) {
+      visitor<S_bsrScore>::cast (v)) {
         S_bsrScore elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -76,7 +76,7 @@ void bsrSpaces::acceptIn (basevisitor* v)
 
   if (visitor<S_bsrSpaces>*
     p =
-      dynamic_cast<visitor<S_bsrSpaces>*> (v)) {
+      visitor<S_bsrSpaces>::cast (v)) {
         S_bsrSpaces elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -118,7 +118,7 @@ void bsrSpaces::acceptOut (basevisitor* v)
 
   if (visitor<S_bsrSpaces>*
     p =
-      dynamic_cast<visitor<S_bsrSpaces>*> (v)) {
+      visitor<S_bsrSpaces>::cast (v)) {
         S_bsrSpaces elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
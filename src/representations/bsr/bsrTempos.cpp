@@ -402,7 +402,7 @@ void bsrTempo::acceptIn (basevisitor* v)
 
   if (visitor<S_bsrTempo>*
     p =
-      dynamic_cast<visitor<S_bsrTempo>*> (v)) {
+      visitor<S_bsrTempo>::cast (v)) {
         S_bsrTempo elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -439,7 +439,7 @@ void bsrTempo::acceptOut (basevisitor* v)
 
   if (visitor<S_bsrTempo>*
     p =
-      dynamic_cast<visitor<S_bsrTempo>*> (v)) {
+      visitor<S_bsrTempo>::cast (v)) {
         S_bsrTempo elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -203,6 +203,8 @@ void bsrTimeSignatureItem::appendBeatsNumber (int beatsNumber)
   fTimeSignatureBeatsNumbersVector.insert (
     fTimeSignatureBeatsNumbersVector.end (),
     beatsNumber);
+
+  bsrCellsListCache::invalidateAllCellsListsCaches ();
 }
 
 void bsrTimeSignatureItem::setTimeSignatureBeatValue (int timeSignatureBeatValue)
@@ -222,6 +224,8 @@ void bsrTimeSignatureItem::setTimeSignatureBeatValue (int timeSignatureBeatValue
 #endif // MF_TRACE_IS_ENABLED
 
   fTimeSignatureBeatValue = timeSignatureBeatValue;
+
+  bsrCellsListCache::invalidateAllCellsListsCaches ();
 }
 
 int bsrTimeSignatureItem::getTimeSignatureBeatsNumber () const
@@ -254,7 +258,7 @@ void bsrTimeSignatureItem::acceptIn (basevisitor* v)
 
   if (visitor<S_bsrTimeSignatureItem>*
     p =
-      dynamic_cast<visitor<S_bsrTimeSignatureItem>*> (v)) {
+      visitor<S_bsrTimeSignatureItem>::cast (v)) {
         S_bsrTimeSignatureItem elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -291,7 +295,7 @@ void bsrTimeSignatureItem::acceptOut (basevisitor* v)
 
   if (visitor<S_bsrTimeSignatureItem>*
     p =
-      dynamic_cast<visitor<S_bsrTimeSignatureItem>*> (v)) {
+      visitor<S_bsrTimeSignatureItem>::cast (v)) {
         S_bsrTimeSignatureItem elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -446,6 +450,8 @@ void bsrTimeSignature::appendTimeSignatureItem (S_bsrTimeSignatureItem timeSigna
 #endif // MF_TRACE_IS_ENABLED
 
   fTimeSignatureItemsVector.push_back (timeSignatureItem);
+
+  bsrCellsListCache::invalidateAllCellsListsCaches ();
 }
 
 S_bsrCellsList bsrTimeSignature::buildCellsList () const
@@ -788,6 +794,21 @@ S_bsrCellsList bsrTimeSignature::buildCellsList () const
   return result;
 }
 
+S_bsrCellsList bsrTimeSignature::fetchCellsList () const
+{
+  S_bsrCellsList
+    result =
+      fCellsListCache.fetchCachedCellsList ();
+
+  if (! result) {
+    result = buildCellsList ();
+
+    fCellsListCache.cacheCellsList (result);
+  }
+
+  return result;
+}
+
 int bsrTimeSignature::fetchCellsNumber() const
 {
   // time signature items may have been appended after construction
@@ -812,7 +833,7 @@ void bsrTimeSignature::acceptIn (basevisitor* v)
 
   if (visitor<S_bsrTimeSignature>*
     p =
-      dynamic_cast<visitor<S_bsrTimeSignature>*> (v)) {
+      visitor<S_bsrTimeSignature>::cast (v)) {
         S_bsrTimeSignature elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -849,7 +870,7 @@ void bsrTimeSignature::acceptOut (basevisitor* v)
 
   if (visitor<S_bsrTimeSignature>*
     p =
-      dynamic_cast<visitor<S_bsrTimeSignature>*> (v)) {
+      visitor<S_bsrTimeSignature>::cast (v)) {
         S_bsrTimeSignature elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -175,8 +175,7 @@ class EXP bsrTimeSignature : public bsrLineContentsElement
 
     void                  appendTimeSignatureItem (S_bsrTimeSignatureItem timeSignatureItem);
 
-    S_bsrCellsList        fetchCellsList () const override
-                              { return buildCellsList (); }
+    S_bsrCellsList        fetchCellsList () const override;
 
     int                   fetchCellsNumber () const override;
 
@@ -216,6 +215,10 @@ class EXP bsrTimeSignature : public bsrLineContentsElement
     bsrTimeSignatureKind           fTimeKind;
 
     std::vector <S_bsrTimeSignatureItem> fTimeSignatureItemsVector;
+
+    // built lazily, see bsrCellsListCache
+    mutable bsrCellsListCache
+                          fCellsListCache;
 };
 typedef SMARTP<bsrTimeSignature> S_bsrTimeSignature;
 EXP std::ostream& operator << (std::ostream& os, const S_bsrTimeSignature& elt);
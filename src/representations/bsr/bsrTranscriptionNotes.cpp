@@ -81,7 +81,7 @@ void bsrTranscriptionNotesElement::acceptIn (basevisitor* v)
 
   if (visitor<S_bsrTranscriptionNotesElement>*
     p =
-      dynamic_cast<visitor<S_bsrTranscriptionNotesElement>*> (v)) {
+      visitor<S_bsrTranscriptionNotesElement>::cast (v)) {
         S_bsrTranscriptionNotesElement elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -118,7 +118,7 @@ void bsrTranscriptionNotesElement::acceptOut (basevisitor* v)
 
   if (visitor<S_bsrTranscriptionNotesElement>*
     p =
-      dynamic_cast<visitor<S_bsrTranscriptionNotesElement>*> (v)) {
+      visitor<S_bsrTranscriptionNotesElement>::cast (v)) {
         S_bsrTranscriptionNotesElement elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -221,7 +221,7 @@ void bsrTranscriptionNotes::acceptIn (basevisitor* v)
 
   if (visitor<S_bsrTranscriptionNotes>*
     p =
-      dynamic_cast<visitor<S_bsrTranscriptionNotes>*> (v)) {
+      visitor<S_bsrTranscriptionNotes>::cast (v)) {
         S_bsrTranscriptionNotes elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -258,7 +258,7 @@ void bsrTranscriptionNotes::acceptOut (basevisitor* v)
 
   if (visitor<S_bsrTranscriptionNotes>*
     p =
-      dynamic_cast<visitor<S_bsrTranscriptionNotes>*> (v)) {
+      visitor<S_bsrTranscriptionNotes>::cast (v)) {
         S_bsrTranscriptionNotes elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -235,7 +235,7 @@ void bsrWords::acceptIn (basevisitor* v)
 
   if (visitor<S_bsrWords>*
     p =
-      dynamic_cast<visitor<S_bsrWords>*> (v)) {
+      visitor<S_bsrWords>::cast (v)) {
         S_bsrWords elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -277,7 +277,7 @@ void bsrWords::acceptOut (basevisitor* v)
 
   if (visitor<S_bsrWords>*
     p =
-      dynamic_cast<visitor<S_bsrWords>*> (v)) {
+      visitor<S_bsrWords>::cast (v)) {
         S_bsrWords elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -55,6 +55,8 @@ R"(Options that are used by generators are grouped here.)",
   fGenerateGuidoStem = false;
   fGenerateGuidoBars = false;
 
+  fGenerateGuidoPartsInParallel = false;
+
   initializeGuidoGenerationOahGroup ();
 }
 
@@ -132,6 +134,17 @@ R"(Generate stem in the Guido output.)",
 R"(Generate barLines in the Guido output.)",
         "generateGuidoBars",
         fGenerateGuidoBars));
+
+  // generate guido parts in parallel
+
+  subGroup->
+    appendAtomToSubGroup (
+      oahBooleanAtom::create (
+        "generate-guido-parts-in-parallel", "ggpip",
+R"(Generate the parts of the Guido output concurrently, one thread per part
+up to the number of processors. The output is the same as without this option.)",
+        "generateGuidoPartsInParallel",
+        fGenerateGuidoPartsInParallel));
 }
 
 //______________________________________________________________________________
@@ -152,7 +165,7 @@ void guidoGenerationOahGroup::acceptIn (basevisitor* v)
 
   if (visitor<S_guidoGenerationOahGroup>*
     p =
-      dynamic_cast<visitor<S_guidoGenerationOahGroup>*> (v)) {
+      visitor<S_guidoGenerationOahGroup>::cast (v)) {
         S_guidoGenerationOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -188,7 +201,7 @@ void guidoGenerationOahGroup::acceptOut (basevisitor* v)
 
   if (visitor<S_guidoGenerationOahGroup>*
     p =
-      dynamic_cast<visitor<S_guidoGenerationOahGroup>*> (v)) {
+      visitor<S_guidoGenerationOahGroup>::cast (v)) {
         S_guidoGenerationOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -262,6 +275,10 @@ void guidoGenerationOahGroup::displayGuidoGenerationOahGroupValues (
     std::setw (fieldWidth) <<
     "fGenerateGuidoBars" << ": " <<
     fGenerateGuidoBars <<
+    std::endl <<
+    std::setw (fieldWidth) <<
+    "fGenerateGuidoPartsInParallel" << ": " <<
+    fGenerateGuidoPartsInParallel <<
     std::endl;
 
   --gIndenter;
@@ -297,6 +314,11 @@ S_guidoGenerationOahGroup createGlobalGuidoGenerationOahGroup ()
       guidoGenerationOahGroup::create ();
     assert (gGlobalGuidoGenerationOahGroup != 0);
 
+    // create the generator component
+    pGeneratorComponent =
+      mfcPassComponent::create (
+        "guidoGeneration");
+
     pGeneratorComponent->
       appendVersionToComponent (
         mfcVersion::create (
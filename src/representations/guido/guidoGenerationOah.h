@@ -61,6 +61,11 @@ class EXP guidoGenerationOahGroup : public oahGroup
     Bool                  getGenerateGuidoBars () const
                               { return fGenerateGuidoBars; }
 
+    void                  setGenerateGuidoPartsInParallel ()
+                              { fGenerateGuidoPartsInParallel = true; }
+    Bool                  getGenerateGuidoPartsInParallel () const
+                              { return fGenerateGuidoPartsInParallel; }
+
   public:
 
     // public services
@@ -109,6 +114,8 @@ class EXP guidoGenerationOahGroup : public oahGroup
     Bool                  fGenerateGuidoComments;
     Bool                  fGenerateGuidoStem;
     Bool                  fGenerateGuidoBars;
+
+    Bool                  fGenerateGuidoPartsInParallel;
 };
 typedef SMARTP<guidoGenerationOahGroup> S_guidoGenerationOahGroup;
 EXP std::ostream& operator << (std::ostream& os, const S_guidoGenerationOahGroup& elt);
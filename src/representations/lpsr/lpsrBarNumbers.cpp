@@ -63,7 +63,7 @@ void lpsrBarNumberCheck::acceptIn (basevisitor* v)
 
   if (visitor<S_lpsrBarNumberCheck>*
     p =
-      dynamic_cast<visitor<S_lpsrBarNumberCheck>*> (v)) {
+      visitor<S_lpsrBarNumberCheck>::cast (v)) {
         S_lpsrBarNumberCheck elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -99,7 +99,7 @@ void lpsrBarNumberCheck::acceptOut (basevisitor* v)
 
   if (visitor<S_lpsrBarNumberCheck>*
     p =
-      dynamic_cast<visitor<S_lpsrBarNumberCheck>*> (v)) {
+      visitor<S_lpsrBarNumberCheck>::cast (v)) {
         S_lpsrBarNumberCheck elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -176,7 +176,7 @@ void lpsrBarCommand::acceptIn (basevisitor* v)
 
   if (visitor<S_lpsrBarCommand>*
     p =
-      dynamic_cast<visitor<S_lpsrBarCommand>*> (v)) {
+      visitor<S_lpsrBarCommand>::cast (v)) {
         S_lpsrBarCommand elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -212,7 +212,7 @@ void lpsrBarCommand::acceptOut (basevisitor* v)
 
   if (visitor<S_lpsrBarCommand>*
     p =
-      dynamic_cast<visitor<S_lpsrBarCommand>*> (v)) {
+      visitor<S_lpsrBarCommand>::cast (v)) {
         S_lpsrBarCommand elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
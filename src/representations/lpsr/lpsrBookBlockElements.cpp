@@ -69,7 +69,7 @@ void lpsrBookBlockElement::acceptIn (basevisitor* v)
 
   if (visitor<S_lpsrBookBlockElement>*
     p =
-      dynamic_cast<visitor<S_lpsrBookBlockElement>*> (v)) {
+      visitor<S_lpsrBookBlockElement>::cast (v)) {
         S_lpsrBookBlockElement elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -105,7 +105,7 @@ void lpsrBookBlockElement::acceptOut (basevisitor* v)
 
   if (visitor<S_lpsrBookBlockElement>*
     p =
-      dynamic_cast<visitor<S_lpsrBookBlockElement>*> (v)) {
+      visitor<S_lpsrBookBlockElement>::cast (v)) {
         S_lpsrBookBlockElement elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -338,7 +338,7 @@ void lpsrScoreBlock::acceptIn (basevisitor* v)
 
   if (visitor<S_lpsrScoreBlock>*
     p =
-      dynamic_cast<visitor<S_lpsrScoreBlock>*> (v)) {
+      visitor<S_lpsrScoreBlock>::cast (v)) {
         S_lpsrScoreBlock elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -374,7 +374,7 @@ void lpsrScoreBlock::acceptOut (basevisitor* v)
 
   if (visitor<S_lpsrScoreBlock>*
     p =
-      dynamic_cast<visitor<S_lpsrScoreBlock>*> (v)) {
+      visitor<S_lpsrScoreBlock>::cast (v)) {
         S_lpsrScoreBlock elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -597,7 +597,7 @@ void lpsrBookPartBlock::acceptIn (basevisitor* v)
 
   if (visitor<S_lpsrBookPartBlock>*
     p =
-      dynamic_cast<visitor<S_lpsrBookPartBlock>*> (v)) {
+      visitor<S_lpsrBookPartBlock>::cast (v)) {
         S_lpsrBookPartBlock elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -633,7 +633,7 @@ void lpsrBookPartBlock::acceptOut (basevisitor* v)
 
   if (visitor<S_lpsrBookPartBlock>*
     p =
-      dynamic_cast<visitor<S_lpsrBookPartBlock>*> (v)) {
+      visitor<S_lpsrBookPartBlock>::cast (v)) {
         S_lpsrBookPartBlock elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -906,7 +906,7 @@ void lpsrBookBlock::acceptIn (basevisitor* v)
 
   if (visitor<S_lpsrBookBlock>*
     p =
-      dynamic_cast<visitor<S_lpsrBookBlock>*> (v)) {
+      visitor<S_lpsrBookBlock>::cast (v)) {
         S_lpsrBookBlock elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -942,7 +942,7 @@ void lpsrBookBlock::acceptOut (basevisitor* v)
 
   if (visitor<S_lpsrBookBlock>*
     p =
-      dynamic_cast<visitor<S_lpsrBookBlock>*> (v)) {
+      visitor<S_lpsrBookBlock>::cast (v)) {
         S_lpsrBookBlock elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
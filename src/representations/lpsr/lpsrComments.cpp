@@ -67,7 +67,7 @@ void lpsrComment::acceptIn (basevisitor* v)
 
   if (visitor<S_lpsrComment>*
     p =
-      dynamic_cast<visitor<S_lpsrComment>*> (v)) {
+      visitor<S_lpsrComment>::cast (v)) {
         S_lpsrComment elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -103,7 +103,7 @@ void lpsrComment::acceptOut (basevisitor* v)
 
   if (visitor<S_lpsrComment>*
     p =
-      dynamic_cast<visitor<S_lpsrComment>*> (v)) {
+      visitor<S_lpsrComment>::cast (v)) {
         S_lpsrComment elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
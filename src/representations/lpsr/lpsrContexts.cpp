@@ -117,7 +117,7 @@ void lpsrContext::acceptIn (basevisitor* v)
 
   if (visitor<S_lpsrContext>*
     p =
-      dynamic_cast<visitor<S_lpsrContext>*> (v)) {
+      visitor<S_lpsrContext>::cast (v)) {
         S_lpsrContext elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -153,7 +153,7 @@ void lpsrContext::acceptOut (basevisitor* v)
 
   if (visitor<S_lpsrContext>*
     p =
-      dynamic_cast<visitor<S_lpsrContext>*> (v)) {
+      visitor<S_lpsrContext>::cast (v)) {
         S_lpsrContext elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -266,7 +266,7 @@ void lpsrChordNamesContext::acceptIn (basevisitor* v)
 
   if (visitor<S_lpsrChordNamesContext>*
     p =
-      dynamic_cast<visitor<S_lpsrChordNamesContext>*> (v)) {
+      visitor<S_lpsrChordNamesContext>::cast (v)) {
         S_lpsrChordNamesContext elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -302,7 +302,7 @@ void lpsrChordNamesContext::acceptOut (basevisitor* v)
 
   if (visitor<S_lpsrChordNamesContext>*
     p =
-      dynamic_cast<visitor<S_lpsrChordNamesContext>*> (v)) {
+      visitor<S_lpsrChordNamesContext>::cast (v)) {
         S_lpsrChordNamesContext elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -443,7 +443,7 @@ void lpsrFiguredBassContext::acceptIn (basevisitor* v)
 
   if (visitor<S_lpsrFiguredBassContext>*
     p =
-      dynamic_cast<visitor<S_lpsrFiguredBassContext>*> (v)) {
+      visitor<S_lpsrFiguredBassContext>::cast (v)) {
         S_lpsrFiguredBassContext elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -479,7 +479,7 @@ void lpsrFiguredBassContext::acceptOut (basevisitor* v)
 
   if (visitor<S_lpsrFiguredBassContext>*
     p =
-      dynamic_cast<visitor<S_lpsrFiguredBassContext>*> (v)) {
+      visitor<S_lpsrFiguredBassContext>::cast (v)) {
         S_lpsrFiguredBassContext elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
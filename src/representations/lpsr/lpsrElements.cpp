@@ -59,7 +59,7 @@ void lpsrElement::acceptIn (basevisitor* v)
 
   if (visitor<S_lpsrElement>*
     p =
-      dynamic_cast<visitor<S_lpsrElement>*> (v)) {
+      visitor<S_lpsrElement>::cast (v)) {
         S_lpsrElement elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -95,7 +95,7 @@ void lpsrElement::acceptOut (basevisitor* v)
 
   if (visitor<S_lpsrElement>*
     p =
-      dynamic_cast<visitor<S_lpsrElement>*> (v)) {
+      visitor<S_lpsrElement>::cast (v)) {
         S_lpsrElement elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -113,7 +113,7 @@ void lpsrHeader::acceptIn (basevisitor* v)
 
   if (visitor<S_lpsrHeader>*
     p =
-      dynamic_cast<visitor<S_lpsrHeader>*> (v)) {
+      visitor<S_lpsrHeader>::cast (v)) {
         S_lpsrHeader elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -149,7 +149,7 @@ void lpsrHeader::acceptOut (basevisitor* v)
 
   if (visitor<S_lpsrHeader>*
     p =
-      dynamic_cast<visitor<S_lpsrHeader>*> (v)) {
+      visitor<S_lpsrHeader>::cast (v)) {
         S_lpsrHeader elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -65,7 +65,7 @@ void lpsrLayout::acceptIn (basevisitor* v)
 
   if (visitor<S_lpsrLayout>*
     p =
-      dynamic_cast<visitor<S_lpsrLayout>*> (v)) {
+      visitor<S_lpsrLayout>::cast (v)) {
         S_lpsrLayout elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -101,7 +101,7 @@ void lpsrLayout::acceptOut (basevisitor* v)
 
   if (visitor<S_lpsrLayout>*
     p =
-      dynamic_cast<visitor<S_lpsrLayout>*> (v)) {
+      visitor<S_lpsrLayout>::cast (v)) {
         S_lpsrLayout elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -67,7 +67,7 @@ void lpsrNewLyricsBlock::acceptIn (basevisitor* v)
 
   if (visitor<S_lpsrNewLyricsBlock>*
     p =
-      dynamic_cast<visitor<S_lpsrNewLyricsBlock>*> (v)) {
+      visitor<S_lpsrNewLyricsBlock>::cast (v)) {
         S_lpsrNewLyricsBlock elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -103,7 +103,7 @@ void lpsrNewLyricsBlock::acceptOut (basevisitor* v)
 
   if (visitor<S_lpsrNewLyricsBlock>*
     p =
-      dynamic_cast<visitor<S_lpsrNewLyricsBlock>*> (v)) {
+      visitor<S_lpsrNewLyricsBlock>::cast (v)) {
         S_lpsrNewLyricsBlock elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
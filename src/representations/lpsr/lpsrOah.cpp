@@ -167,7 +167,7 @@ void lpsrPitchesLanguageAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_lpsrPitchesLanguageAtom>*
     p =
-      dynamic_cast<visitor<S_lpsrPitchesLanguageAtom>*> (v)) {
+      visitor<S_lpsrPitchesLanguageAtom>::cast (v)) {
         S_lpsrPitchesLanguageAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -203,7 +203,7 @@ void lpsrPitchesLanguageAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_lpsrPitchesLanguageAtom>*
     p =
-      dynamic_cast<visitor<S_lpsrPitchesLanguageAtom>*> (v)) {
+      visitor<S_lpsrPitchesLanguageAtom>::cast (v)) {
         S_lpsrPitchesLanguageAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -447,7 +447,7 @@ void lpsrChordsLanguageAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_lpsrChordsLanguageAtom>*
     p =
-      dynamic_cast<visitor<S_lpsrChordsLanguageAtom>*> (v)) {
+      visitor<S_lpsrChordsLanguageAtom>::cast (v)) {
         S_lpsrChordsLanguageAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -483,7 +483,7 @@ void lpsrChordsLanguageAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_lpsrChordsLanguageAtom>*
     p =
-      dynamic_cast<visitor<S_lpsrChordsLanguageAtom>*> (v)) {
+      visitor<S_lpsrChordsLanguageAtom>::cast (v)) {
         S_lpsrChordsLanguageAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -791,7 +791,7 @@ void lpsrStaffInstrumentNameAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_lpsrStaffInstrumentNameAtom>*
     p =
-      dynamic_cast<visitor<S_lpsrStaffInstrumentNameAtom>*> (v)) {
+      visitor<S_lpsrStaffInstrumentNameAtom>::cast (v)) {
         S_lpsrStaffInstrumentNameAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -827,7 +827,7 @@ void lpsrStaffInstrumentNameAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_lpsrStaffInstrumentNameAtom>*
     p =
-      dynamic_cast<visitor<S_lpsrStaffInstrumentNameAtom>*> (v)) {
+      visitor<S_lpsrStaffInstrumentNameAtom>::cast (v)) {
         S_lpsrStaffInstrumentNameAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -1126,7 +1126,7 @@ void lpsrTransposeAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_lpsrTransposeAtom>*
     p =
-      dynamic_cast<visitor<S_lpsrTransposeAtom>*> (v)) {
+      visitor<S_lpsrTransposeAtom>::cast (v)) {
         S_lpsrTransposeAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -1162,7 +1162,7 @@ void lpsrTransposeAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_lpsrTransposeAtom>*
     p =
-      dynamic_cast<visitor<S_lpsrTransposeAtom>*> (v)) {
+      visitor<S_lpsrTransposeAtom>::cast (v)) {
         S_lpsrTransposeAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -2289,7 +2289,7 @@ void lpsrOahGroup::acceptIn (basevisitor* v)
 
   if (visitor<S_lpsrOahGroup>*
     p =
-      dynamic_cast<visitor<S_lpsrOahGroup>*> (v)) {
+      visitor<S_lpsrOahGroup>::cast (v)) {
         S_lpsrOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -2325,7 +2325,7 @@ void lpsrOahGroup::acceptOut (basevisitor* v)
 
   if (visitor<S_lpsrOahGroup>*
     p =
-      dynamic_cast<visitor<S_lpsrOahGroup>*> (v)) {
+      visitor<S_lpsrOahGroup>::cast (v)) {
         S_lpsrOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -137,7 +137,7 @@ void lpsrPaper::acceptIn (basevisitor* v)
 
   if (visitor<S_lpsrPaper>*
     p =
-      dynamic_cast<visitor<S_lpsrPaper>*> (v)) {
+      visitor<S_lpsrPaper>::cast (v)) {
         S_lpsrPaper elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -173,7 +173,7 @@ void lpsrPaper::acceptOut (basevisitor* v)
 
   if (visitor<S_lpsrPaper>*
     p =
-      dynamic_cast<visitor<S_lpsrPaper>*> (v)) {
+      visitor<S_lpsrPaper>::cast (v)) {
         S_lpsrPaper elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
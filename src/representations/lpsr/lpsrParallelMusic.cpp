@@ -103,7 +103,7 @@ void lpsrParallelMusicBLock::acceptIn (basevisitor* v)
 
   if (visitor<S_lpsrParallelMusicBLock>*
     p =
-      dynamic_cast<visitor<S_lpsrParallelMusicBLock>*> (v)) {
+      visitor<S_lpsrParallelMusicBLock>::cast (v)) {
         S_lpsrParallelMusicBLock elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -139,7 +139,7 @@ void lpsrParallelMusicBLock::acceptOut (basevisitor* v)
 
   if (visitor<S_lpsrParallelMusicBLock>*
     p =
-      dynamic_cast<visitor<S_lpsrParallelMusicBLock>*> (v)) {
+      visitor<S_lpsrParallelMusicBLock>::cast (v)) {
         S_lpsrParallelMusicBLock elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
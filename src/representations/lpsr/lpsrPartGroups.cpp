@@ -64,7 +64,7 @@ void lpsrPartGroupBlock::acceptIn (basevisitor* v)
 
   if (visitor<S_lpsrPartGroupBlock>*
     p =
-      dynamic_cast<visitor<S_lpsrPartGroupBlock>*> (v)) {
+      visitor<S_lpsrPartGroupBlock>::cast (v)) {
         S_lpsrPartGroupBlock elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -100,7 +100,7 @@ void lpsrPartGroupBlock::acceptOut (basevisitor* v)
 
   if (visitor<S_lpsrPartGroupBlock>*
     p =
-      dynamic_cast<visitor<S_lpsrPartGroupBlock>*> (v)) {
+      visitor<S_lpsrPartGroupBlock>::cast (v)) {
         S_lpsrPartGroupBlock elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -419,7 +419,7 @@ void lpsrPartBlock::acceptIn (basevisitor* v)
 
   if (visitor<S_lpsrPartBlock>*
     p =
-      dynamic_cast<visitor<S_lpsrPartBlock>*> (v)) {
+      visitor<S_lpsrPartBlock>::cast (v)) {
         S_lpsrPartBlock elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -455,7 +455,7 @@ void lpsrPartBlock::acceptOut (basevisitor* v)
 
   if (visitor<S_lpsrPartBlock>*
     p =
-      dynamic_cast<visitor<S_lpsrPartBlock>*> (v)) {
+      visitor<S_lpsrPartBlock>::cast (v)) {
         S_lpsrPartBlock elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -132,7 +132,7 @@ void lpsrSchemeVariable::acceptIn (basevisitor* v)
 
   if (visitor<S_lpsrSchemeVariable>*
     p =
-      dynamic_cast<visitor<S_lpsrSchemeVariable>*> (v)) {
+      visitor<S_lpsrSchemeVariable>::cast (v)) {
         S_lpsrSchemeVariable elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -168,7 +168,7 @@ void lpsrSchemeVariable::acceptOut (basevisitor* v)
 
   if (visitor<S_lpsrSchemeVariable>*
     p =
-      dynamic_cast<visitor<S_lpsrSchemeVariable>*> (v)) {
+      visitor<S_lpsrSchemeVariable>::cast (v)) {
         S_lpsrSchemeVariable elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -295,7 +295,7 @@ void lpsrSchemeFunction::acceptIn (basevisitor* v)
 
   if (visitor<S_lpsrSchemeFunction>*
     p =
-      dynamic_cast<visitor<S_lpsrSchemeFunction>*> (v)) {
+      visitor<S_lpsrSchemeFunction>::cast (v)) {
         S_lpsrSchemeFunction elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -331,7 +331,7 @@ void lpsrSchemeFunction::acceptOut (basevisitor* v)
 
   if (visitor<S_lpsrSchemeFunction>*
     p =
-      dynamic_cast<visitor<S_lpsrSchemeFunction>*> (v)) {
+      visitor<S_lpsrSchemeFunction>::cast (v)) {
         S_lpsrSchemeFunction elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
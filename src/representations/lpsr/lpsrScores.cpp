@@ -2970,7 +2970,7 @@ void lpsrScore::acceptIn (basevisitor* v)
 
   if (visitor<S_lpsrScore>*
     p =
-      dynamic_cast<visitor<S_lpsrScore>*> (v)) {
+      visitor<S_lpsrScore>::cast (v)) {
         S_lpsrScore elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -3006,7 +3006,7 @@ void lpsrScore::acceptOut (basevisitor* v)
 
   if (visitor<S_lpsrScore>*
     p =
-      dynamic_cast<visitor<S_lpsrScore>*> (v)) {
+      visitor<S_lpsrScore>::cast (v)) {
         S_lpsrScore elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -69,7 +69,7 @@ void lpsrNewStaffGroupBlock::acceptIn (basevisitor* v)
 
   if (visitor<S_lpsrNewStaffGroupBlock>*
     p =
-      dynamic_cast<visitor<S_lpsrNewStaffGroupBlock>*> (v)) {
+      visitor<S_lpsrNewStaffGroupBlock>::cast (v)) {
         S_lpsrNewStaffGroupBlock elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -105,7 +105,7 @@ void lpsrNewStaffGroupBlock::acceptOut (basevisitor* v)
 
   if (visitor<S_lpsrNewStaffGroupBlock>*
     p =
-      dynamic_cast<visitor<S_lpsrNewStaffGroupBlock>*> (v)) {
+      visitor<S_lpsrNewStaffGroupBlock>::cast (v)) {
         S_lpsrNewStaffGroupBlock elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -188,7 +188,7 @@ void lpsrNewStaffTuningBlock::acceptIn (basevisitor* v)
 
   if (visitor<S_lpsrNewStaffTuningBlock>*
     p =
-      dynamic_cast<visitor<S_lpsrNewStaffTuningBlock>*> (v)) {
+      visitor<S_lpsrNewStaffTuningBlock>::cast (v)) {
         S_lpsrNewStaffTuningBlock elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -224,7 +224,7 @@ void lpsrNewStaffTuningBlock::acceptOut (basevisitor* v)
 
   if (visitor<S_lpsrNewStaffTuningBlock>*
     p =
-      dynamic_cast<visitor<S_lpsrNewStaffTuningBlock>*> (v)) {
+      visitor<S_lpsrNewStaffTuningBlock>::cast (v)) {
         S_lpsrNewStaffTuningBlock elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -300,7 +300,7 @@ void lpsrNewStaffBlock::acceptIn (basevisitor* v)
 
   if (visitor<S_lpsrNewStaffBlock>*
     p =
-      dynamic_cast<visitor<S_lpsrNewStaffBlock>*> (v)) {
+      visitor<S_lpsrNewStaffBlock>::cast (v)) {
         S_lpsrNewStaffBlock elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -336,7 +336,7 @@ void lpsrNewStaffBlock::acceptOut (basevisitor* v)
 
   if (visitor<S_lpsrNewStaffBlock>*
     p =
-      dynamic_cast<visitor<S_lpsrNewStaffBlock>*> (v)) {
+      visitor<S_lpsrNewStaffBlock>::cast (v)) {
         S_lpsrNewStaffBlock elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -455,7 +455,7 @@ void lpsrStaffBlock::acceptIn (basevisitor* v)
 
   if (visitor<S_lpsrStaffBlock>*
     p =
-      dynamic_cast<visitor<S_lpsrStaffBlock>*> (v)) {
+      visitor<S_lpsrStaffBlock>::cast (v)) {
         S_lpsrStaffBlock elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -491,7 +491,7 @@ void lpsrStaffBlock::acceptOut (basevisitor* v)
 
   if (visitor<S_lpsrStaffBlock>*
     p =
-      dynamic_cast<visitor<S_lpsrStaffBlock>*> (v)) {
+      visitor<S_lpsrStaffBlock>::cast (v)) {
         S_lpsrStaffBlock elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
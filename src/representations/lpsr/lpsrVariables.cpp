@@ -63,7 +63,7 @@ void lpsrVariableUseCommand::acceptIn (basevisitor* v)
 
   if (visitor<S_lpsrVariableUseCommand>*
     p =
-      dynamic_cast<visitor<S_lpsrVariableUseCommand>*> (v)) {
+      visitor<S_lpsrVariableUseCommand>::cast (v)) {
         S_lpsrVariableUseCommand elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -99,7 +99,7 @@ void lpsrVariableUseCommand::acceptOut (basevisitor* v)
 
   if (visitor<S_lpsrVariableUseCommand>*
     p =
-      dynamic_cast<visitor<S_lpsrVariableUseCommand>*> (v)) {
+      visitor<S_lpsrVariableUseCommand>::cast (v)) {
         S_lpsrVariableUseCommand elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
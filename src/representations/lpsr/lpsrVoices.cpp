@@ -66,7 +66,7 @@ void lpsrUseVoiceCommand::acceptIn (basevisitor* v)
 
   if (visitor<S_lpsrUseVoiceCommand>*
     p =
-      dynamic_cast<visitor<S_lpsrUseVoiceCommand>*> (v)) {
+      visitor<S_lpsrUseVoiceCommand>::cast (v)) {
         S_lpsrUseVoiceCommand elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -102,7 +102,7 @@ void lpsrUseVoiceCommand::acceptOut (basevisitor* v)
 
   if (visitor<S_lpsrUseVoiceCommand>*
     p =
-      dynamic_cast<visitor<S_lpsrUseVoiceCommand>*> (v)) {
+      visitor<S_lpsrUseVoiceCommand>::cast (v)) {
         S_lpsrUseVoiceCommand elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -167,7 +167,7 @@ void msdlKeywordsLanguageAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_msdlKeywordsLanguageAtom>*
     p =
-      dynamic_cast<visitor<S_msdlKeywordsLanguageAtom>*> (v)) {
+      visitor<S_msdlKeywordsLanguageAtom>::cast (v)) {
         S_msdlKeywordsLanguageAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -203,7 +203,7 @@ void msdlKeywordsLanguageAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_msdlKeywordsLanguageAtom>*
     p =
-      dynamic_cast<visitor<S_msdlKeywordsLanguageAtom>*> (v)) {
+      visitor<S_msdlKeywordsLanguageAtom>::cast (v)) {
         S_msdlKeywordsLanguageAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -438,7 +438,7 @@ void oahDisplayMsdlKeywordsInLanguageAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_oahDisplayMsdlKeywordsInLanguageAtom>*
     p =
-      dynamic_cast<visitor<S_oahDisplayMsdlKeywordsInLanguageAtom>*> (v)) {
+      visitor<S_oahDisplayMsdlKeywordsInLanguageAtom>::cast (v)) {
         S_oahDisplayMsdlKeywordsInLanguageAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -474,7 +474,7 @@ void oahDisplayMsdlKeywordsInLanguageAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_oahDisplayMsdlKeywordsInLanguageAtom>*
     p =
-      dynamic_cast<visitor<S_oahDisplayMsdlKeywordsInLanguageAtom>*> (v)) {
+      visitor<S_oahDisplayMsdlKeywordsInLanguageAtom>::cast (v)) {
         S_oahDisplayMsdlKeywordsInLanguageAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -671,7 +671,7 @@ void oahDisplayMsdlTokensInLanguageAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_oahDisplayMsdlTokensInLanguageAtom>*
     p =
-      dynamic_cast<visitor<S_oahDisplayMsdlTokensInLanguageAtom>*> (v)) {
+      visitor<S_oahDisplayMsdlTokensInLanguageAtom>::cast (v)) {
         S_oahDisplayMsdlTokensInLanguageAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -707,7 +707,7 @@ void oahDisplayMsdlTokensInLanguageAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_oahDisplayMsdlTokensInLanguageAtom>*
     p =
-      dynamic_cast<visitor<S_oahDisplayMsdlTokensInLanguageAtom>*> (v)) {
+      visitor<S_oahDisplayMsdlTokensInLanguageAtom>::cast (v)) {
         S_oahDisplayMsdlTokensInLanguageAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -916,7 +916,7 @@ void msdlCommentsTypeAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_msdlCommentsTypeAtom>*
     p =
-      dynamic_cast<visitor<S_msdlCommentsTypeAtom>*> (v)) {
+      visitor<S_msdlCommentsTypeAtom>::cast (v)) {
         S_msdlCommentsTypeAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -952,7 +952,7 @@ void msdlCommentsTypeAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_msdlCommentsTypeAtom>*
     p =
-      dynamic_cast<visitor<S_msdlCommentsTypeAtom>*> (v)) {
+      visitor<S_msdlCommentsTypeAtom>::cast (v)) {
         S_msdlCommentsTypeAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -1202,7 +1202,7 @@ void msdlUserLanguageAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_msdlUserLanguageAtom>*
     p =
-      dynamic_cast<visitor<S_msdlUserLanguageAtom>*> (v)) {
+      visitor<S_msdlUserLanguageAtom>::cast (v)) {
         S_msdlUserLanguageAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -1238,7 +1238,7 @@ void msdlUserLanguageAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_msdlUserLanguageAtom>*
     p =
-      dynamic_cast<visitor<S_msdlUserLanguageAtom>*> (v)) {
+      visitor<S_msdlUserLanguageAtom>::cast (v)) {
         S_msdlUserLanguageAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -1491,7 +1491,7 @@ void msdlPitchesLanguageAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_msdlPitchesLanguageAtom>*
     p =
-      dynamic_cast<visitor<S_msdlPitchesLanguageAtom>*> (v)) {
+      visitor<S_msdlPitchesLanguageAtom>::cast (v)) {
         S_msdlPitchesLanguageAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -1527,7 +1527,7 @@ void msdlPitchesLanguageAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_msdlPitchesLanguageAtom>*
     p =
-      dynamic_cast<visitor<S_msdlPitchesLanguageAtom>*> (v)) {
+      visitor<S_msdlPitchesLanguageAtom>::cast (v)) {
         S_msdlPitchesLanguageAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -1922,7 +1922,7 @@ void msdlInputOahGroup::acceptIn (basevisitor* v)
 
   if (visitor<S_msdlInputOahGroup>*
     p =
-      dynamic_cast<visitor<S_msdlInputOahGroup>*> (v)) {
+      visitor<S_msdlInputOahGroup>::cast (v)) {
         S_msdlInputOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -1958,7 +1958,7 @@ void msdlInputOahGroup::acceptOut (basevisitor* v)
 
   if (visitor<S_msdlInputOahGroup>*
     p =
-      dynamic_cast<visitor<S_msdlInputOahGroup>*> (v)) {
+      visitor<S_msdlInputOahGroup>::cast (v)) {
         S_msdlInputOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -117,7 +117,7 @@ void msdrLayer::acceptIn (basevisitor* v)
 
   if (visitor<S_msdrLayer>*
     p =
-      dynamic_cast<visitor<S_msdrLayer>*> (v)) {
+      visitor<S_msdrLayer>::cast (v)) {
         S_msdrLayer elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -153,7 +153,7 @@ void msdrLayer::acceptOut (basevisitor* v)
 
   if (visitor<S_msdrLayer>*
     p =
-      dynamic_cast<visitor<S_msdrLayer>*> (v)) {
+      visitor<S_msdrLayer>::cast (v)) {
         S_msdrLayer elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
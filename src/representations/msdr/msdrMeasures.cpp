@@ -96,7 +96,7 @@ void msdrMeasure::acceptIn (basevisitor* v)
 
   if (visitor<S_msdrMeasure>*
     p =
-      dynamic_cast<visitor<S_msdrMeasure>*> (v)) {
+      visitor<S_msdrMeasure>::cast (v)) {
         S_msdrMeasure elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -132,7 +132,7 @@ void msdrMeasure::acceptOut (basevisitor* v)
 
   if (visitor<S_msdrMeasure>*
     p =
-      dynamic_cast<visitor<S_msdrMeasure>*> (v)) {
+      visitor<S_msdrMeasure>::cast (v)) {
         S_msdrMeasure elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -95,7 +95,7 @@ void msdrMusic::acceptIn (basevisitor* v)
 
   if (visitor<S_msdrMusic>*
     p =
-      dynamic_cast<visitor<S_msdrMusic>*> (v)) {
+      visitor<S_msdrMusic>::cast (v)) {
         S_msdrMusic elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -131,7 +131,7 @@ void msdrMusic::acceptOut (basevisitor* v)
 
   if (visitor<S_msdrMusic>*
     p =
-      dynamic_cast<visitor<S_msdrMusic>*> (v)) {
+      visitor<S_msdrMusic>::cast (v)) {
         S_msdrMusic elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -139,7 +139,7 @@ void msrAfterGraceNotesGroupContents::acceptIn (basevisitor* v)
 
   if (visitor<S_msrAfterGraceNotesGroupContents>*
     p =
-      dynamic_cast<visitor<S_msrAfterGraceNotesGroupContents>*> (v)) {
+      visitor<S_msrAfterGraceNotesGroupContents>::cast (v)) {
         S_msrAfterGraceNotesGroupContents elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -175,7 +175,7 @@ void msrAfterGraceNotesGroupContents::acceptOut (basevisitor* v)
 
   if (visitor<S_msrAfterGraceNotesGroupContents>*
     p =
-      dynamic_cast<visitor<S_msrAfterGraceNotesGroupContents>*> (v)) {
+      visitor<S_msrAfterGraceNotesGroupContents>::cast (v)) {
         S_msrAfterGraceNotesGroupContents elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -412,7 +412,7 @@ void msrAfterGraceNotesGroup::acceptIn (basevisitor* v)
 
   if (visitor<S_msrAfterGraceNotesGroup>*
     p =
-      dynamic_cast<visitor<S_msrAfterGraceNotesGroup>*> (v)) {
+      visitor<S_msrAfterGraceNotesGroup>::cast (v)) {
         S_msrAfterGraceNotesGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -448,7 +448,7 @@ void msrAfterGraceNotesGroup::acceptOut (basevisitor* v)
 
   if (visitor<S_msrAfterGraceNotesGroup>*
     p =
-      dynamic_cast<visitor<S_msrAfterGraceNotesGroup>*> (v)) {
+      visitor<S_msrAfterGraceNotesGroup>::cast (v)) {
         S_msrAfterGraceNotesGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -147,7 +147,7 @@ void msrArticulation::acceptIn (basevisitor* v)
 
   if (visitor<S_msrArticulation>*
     p =
-      dynamic_cast<visitor<S_msrArticulation>*> (v)) {
+      visitor<S_msrArticulation>::cast (v)) {
         S_msrArticulation elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -183,7 +183,7 @@ void msrArticulation::acceptOut (basevisitor* v)
 
   if (visitor<S_msrArticulation>*
     p =
-      dynamic_cast<visitor<S_msrArticulation>*> (v)) {
+      visitor<S_msrArticulation>::cast (v)) {
         S_msrArticulation elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -284,7 +284,7 @@ void msrFermata::acceptIn (basevisitor* v)
 
   if (visitor<S_msrFermata>*
     p =
-      dynamic_cast<visitor<S_msrFermata>*> (v)) {
+      visitor<S_msrFermata>::cast (v)) {
         S_msrFermata elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -320,7 +320,7 @@ void msrFermata::acceptOut (basevisitor* v)
 
   if (visitor<S_msrFermata>*
     p =
-      dynamic_cast<visitor<S_msrFermata>*> (v)) {
+      visitor<S_msrFermata>::cast (v)) {
         S_msrFermata elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -483,7 +483,7 @@ void msrArpeggiato::acceptIn (basevisitor* v)
 
   if (visitor<S_msrArpeggiato>*
     p =
-      dynamic_cast<visitor<S_msrArpeggiato>*> (v)) {
+      visitor<S_msrArpeggiato>::cast (v)) {
         S_msrArpeggiato elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -519,7 +519,7 @@ void msrArpeggiato::acceptOut (basevisitor* v)
 
   if (visitor<S_msrArpeggiato>*
     p =
-      dynamic_cast<visitor<S_msrArpeggiato>*> (v)) {
+      visitor<S_msrArpeggiato>::cast (v)) {
         S_msrArpeggiato elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -651,7 +651,7 @@ void msrNonArpeggiato::acceptIn (basevisitor* v)
 
   if (visitor<S_msrNonArpeggiato>*
     p =
-      dynamic_cast<visitor<S_msrNonArpeggiato>*> (v)) {
+      visitor<S_msrNonArpeggiato>::cast (v)) {
         S_msrNonArpeggiato elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -686,7 +686,7 @@ void msrNonArpeggiato::acceptOut (basevisitor* v)
 #endif // MF_TRACE_IS_ENABLED
   if (visitor<S_msrNonArpeggiato>*
     p =
-      dynamic_cast<visitor<S_msrNonArpeggiato>*> (v)) {
+      visitor<S_msrNonArpeggiato>::cast (v)) {
         S_msrNonArpeggiato elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -219,7 +219,7 @@ void msrBarCheck::acceptIn (basevisitor* v)
 
   if (visitor<S_msrBarCheck>*
     p =
-      dynamic_cast<visitor<S_msrBarCheck>*> (v)) {
+      visitor<S_msrBarCheck>::cast (v)) {
         S_msrBarCheck elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -255,7 +255,7 @@ void msrBarCheck::acceptOut (basevisitor* v)
 
   if (visitor<S_msrBarCheck>*
     p =
-      dynamic_cast<visitor<S_msrBarCheck>*> (v)) {
+      visitor<S_msrBarCheck>::cast (v)) {
         S_msrBarCheck elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -276,7 +276,7 @@ void msrBarLine::acceptIn (basevisitor* v)
 
   if (visitor<S_msrBarLine>*
     p =
-      dynamic_cast<visitor<S_msrBarLine>*> (v)) {
+      visitor<S_msrBarLine>::cast (v)) {
         S_msrBarLine elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -312,7 +312,7 @@ void msrBarLine::acceptOut (basevisitor* v)
 
   if (visitor<S_msrBarLine>*
     p =
-      dynamic_cast<visitor<S_msrBarLine>*> (v)) {
+      visitor<S_msrBarLine>::cast (v)) {
         S_msrBarLine elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -142,7 +142,7 @@ void msrBarNumberCheck::acceptIn (basevisitor* v)
 
   if (visitor<S_msrBarNumberCheck>*
     p =
-      dynamic_cast<visitor<S_msrBarNumberCheck>*> (v)) {
+      visitor<S_msrBarNumberCheck>::cast (v)) {
         S_msrBarNumberCheck elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -178,7 +178,7 @@ void msrBarNumberCheck::acceptOut (basevisitor* v)
 
   if (visitor<S_msrBarNumberCheck>*
     p =
-      dynamic_cast<visitor<S_msrBarNumberCheck>*> (v)) {
+      visitor<S_msrBarNumberCheck>::cast (v)) {
         S_msrBarNumberCheck elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
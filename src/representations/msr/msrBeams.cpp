@@ -122,7 +122,7 @@ void msrBeam::acceptIn (basevisitor* v)
 
   if (visitor<S_msrBeam>*
     p =
-      dynamic_cast<visitor<S_msrBeam>*> (v)) {
+      visitor<S_msrBeam>::cast (v)) {
         S_msrBeam elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -158,7 +158,7 @@ void msrBeam::acceptOut (basevisitor* v)
 
   if (visitor<S_msrBeam>*
     p =
-      dynamic_cast<visitor<S_msrBeam>*> (v)) {
+      visitor<S_msrBeam>::cast (v)) {
         S_msrBeam elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
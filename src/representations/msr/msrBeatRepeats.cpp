@@ -262,7 +262,7 @@ void msrBeatRepeatElement::acceptIn (basevisitor* v)
 
   if (visitor<S_msrBeatRepeatElement>*
     p =
-      dynamic_cast<visitor<S_msrBeatRepeatElement>*> (v)) {
+      visitor<S_msrBeatRepeatElement>::cast (v)) {
         S_msrBeatRepeatElement elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -298,7 +298,7 @@ void msrBeatRepeatElement::acceptOut (basevisitor* v)
 
   if (visitor<S_msrBeatRepeatElement>*
     p =
-      dynamic_cast<visitor<S_msrBeatRepeatElement>*> (v)) {
+      visitor<S_msrBeatRepeatElement>::cast (v)) {
         S_msrBeatRepeatElement elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -574,7 +574,7 @@ void msrBeatRepeatPattern::acceptIn (basevisitor* v)
 
   if (visitor<S_msrBeatRepeatPattern>*
     p =
-      dynamic_cast<visitor<S_msrBeatRepeatPattern>*> (v)) {
+      visitor<S_msrBeatRepeatPattern>::cast (v)) {
         S_msrBeatRepeatPattern elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -610,7 +610,7 @@ void msrBeatRepeatPattern::acceptOut (basevisitor* v)
 
   if (visitor<S_msrBeatRepeatPattern>*
     p =
-      dynamic_cast<visitor<S_msrBeatRepeatPattern>*> (v)) {
+      visitor<S_msrBeatRepeatPattern>::cast (v)) {
         S_msrBeatRepeatPattern elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -813,7 +813,7 @@ void msrBeatRepeatReplicas::acceptIn (basevisitor* v)
 
   if (visitor<S_msrBeatRepeatReplicas>*
     p =
-      dynamic_cast<visitor<S_msrBeatRepeatReplicas>*> (v)) {
+      visitor<S_msrBeatRepeatReplicas>::cast (v)) {
         S_msrBeatRepeatReplicas elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -849,7 +849,7 @@ void msrBeatRepeatReplicas::acceptOut (basevisitor* v)
 
   if (visitor<S_msrBeatRepeatReplicas>*
     p =
-      dynamic_cast<visitor<S_msrBeatRepeatReplicas>*> (v)) {
+      visitor<S_msrBeatRepeatReplicas>::cast (v)) {
         S_msrBeatRepeatReplicas elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -1184,7 +1184,7 @@ void msrBeatRepeat::acceptIn (basevisitor* v)
 
   if (visitor<S_msrBeatRepeat>*
     p =
-      dynamic_cast<visitor<S_msrBeatRepeat>*> (v)) {
+      visitor<S_msrBeatRepeat>::cast (v)) {
         S_msrBeatRepeat elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -1220,7 +1220,7 @@ void msrBeatRepeat::acceptOut (basevisitor* v)
 
   if (visitor<S_msrBeatRepeat>*
     p =
-      dynamic_cast<visitor<S_msrBeatRepeat>*> (v)) {
+      visitor<S_msrBeatRepeat>::cast (v)) {
         S_msrBeatRepeat elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
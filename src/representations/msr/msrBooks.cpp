@@ -409,7 +409,7 @@ void msrBook::acceptIn (basevisitor* v)
 
   if (visitor<S_msrBook>*
     p =
-      dynamic_cast<visitor<S_msrBook>*> (v)) {
+      visitor<S_msrBook>::cast (v)) {
         S_msrBook elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -445,7 +445,7 @@ void msrBook::acceptOut (basevisitor* v)
 
   if (visitor<S_msrBook>*
     p =
-      dynamic_cast<visitor<S_msrBook>*> (v)) {
+      visitor<S_msrBook>::cast (v)) {
         S_msrBook elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -2579,7 +2579,7 @@ void msrChord::acceptIn (basevisitor* v)
 
   if (visitor<S_msrChord>*
     p =
-      dynamic_cast<visitor<S_msrChord>*> (v)) {
+      visitor<S_msrChord>::cast (v)) {
         S_msrChord elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -2615,7 +2615,7 @@ void msrChord::acceptOut (basevisitor* v)
 
   if (visitor<S_msrChord>*
     p =
-      dynamic_cast<visitor<S_msrChord>*> (v)) {
+      visitor<S_msrChord>::cast (v)) {
         S_msrChord elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -4705,7 +4705,7 @@ void msrChordBeamLink::acceptIn (basevisitor* v)
 
   if (visitor<S_msrChordBeamLink>*
     p =
-      dynamic_cast<visitor<S_msrChordBeamLink>*> (v)) {
+      visitor<S_msrChordBeamLink>::cast (v)) {
         S_msrChordBeamLink elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -4741,7 +4741,7 @@ void msrChordBeamLink::acceptOut (basevisitor* v)
 
   if (visitor<S_msrChordBeamLink>*
     p =
-      dynamic_cast<visitor<S_msrChordBeamLink>*> (v)) {
+      visitor<S_msrChordBeamLink>::cast (v)) {
         S_msrChordBeamLink elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -4962,7 +4962,7 @@ void msrChordSlurLink::acceptIn (basevisitor* v)
 
   if (visitor<S_msrChordSlurLink>*
     p =
-      dynamic_cast<visitor<S_msrChordSlurLink>*> (v)) {
+      visitor<S_msrChordSlurLink>::cast (v)) {
         S_msrChordSlurLink elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -4998,7 +4998,7 @@ void msrChordSlurLink::acceptOut (basevisitor* v)
 
   if (visitor<S_msrChordSlurLink>*
     p =
-      dynamic_cast<visitor<S_msrChordSlurLink>*> (v)) {
+      visitor<S_msrChordSlurLink>::cast (v)) {
         S_msrChordSlurLink elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -5190,7 +5190,7 @@ void msrChordGraceNotesGroupLink::acceptIn (basevisitor* v)
 
   if (visitor<S_msrChordGraceNotesGroupLink>*
     p =
-      dynamic_cast<visitor<S_msrChordGraceNotesGroupLink>*> (v)) {
+      visitor<S_msrChordGraceNotesGroupLink>::cast (v)) {
         S_msrChordGraceNotesGroupLink elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -5226,7 +5226,7 @@ void msrChordGraceNotesGroupLink::acceptOut (basevisitor* v)
 
   if (visitor<S_msrChordGraceNotesGroupLink>*
     p =
-      dynamic_cast<visitor<S_msrChordGraceNotesGroupLink>*> (v)) {
+      visitor<S_msrChordGraceNotesGroupLink>::cast (v)) {
         S_msrChordGraceNotesGroupLink elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
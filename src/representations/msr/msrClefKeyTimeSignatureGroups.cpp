@@ -484,7 +484,7 @@ void msrClefKeyTimeSignatureGroup::acceptIn (basevisitor* v)
 
   if (visitor<S_msrClefKeyTimeSignatureGroup>*
     p =
-      dynamic_cast<visitor<S_msrClefKeyTimeSignatureGroup>*> (v)) {
+      visitor<S_msrClefKeyTimeSignatureGroup>::cast (v)) {
         S_msrClefKeyTimeSignatureGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -520,7 +520,7 @@ void msrClefKeyTimeSignatureGroup::acceptOut (basevisitor* v)
 
   if (visitor<S_msrClefKeyTimeSignatureGroup>*
     p =
-      dynamic_cast<visitor<S_msrClefKeyTimeSignatureGroup>*> (v)) {
+      visitor<S_msrClefKeyTimeSignatureGroup>::cast (v)) {
         S_msrClefKeyTimeSignatureGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -617,7 +617,7 @@ void msrClef::acceptIn (basevisitor* v)
 
   if (visitor<S_msrClef>*
     p =
-      dynamic_cast<visitor<S_msrClef>*> (v)) {
+      visitor<S_msrClef>::cast (v)) {
         S_msrClef elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -653,7 +653,7 @@ void msrClef::acceptOut (basevisitor* v)
 
   if (visitor<S_msrClef>*
     p =
-      dynamic_cast<visitor<S_msrClef>*> (v)) {
+      visitor<S_msrClef>::cast (v)) {
         S_msrClef elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -150,7 +150,7 @@ void msrCoda::acceptIn (basevisitor* v)
 
   if (visitor<S_msrCoda>*
     p =
-      dynamic_cast<visitor<S_msrCoda>*> (v)) {
+      visitor<S_msrCoda>::cast (v)) {
         S_msrCoda elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -186,7 +186,7 @@ void msrCoda::acceptOut (basevisitor* v)
 
   if (visitor<S_msrCoda>*
     p =
-      dynamic_cast<visitor<S_msrCoda>*> (v)) {
+      visitor<S_msrCoda>::cast (v)) {
         S_msrCoda elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -163,7 +163,7 @@ void msrCreditWords::acceptIn (basevisitor* v)
 
   if (visitor<S_msrCreditWords>*
     p =
-      dynamic_cast<visitor<S_msrCreditWords>*> (v)) {
+      visitor<S_msrCreditWords>::cast (v)) {
         S_msrCreditWords elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -199,7 +199,7 @@ void msrCreditWords::acceptOut (basevisitor* v)
 
   if (visitor<S_msrCreditWords>*
     p =
-      dynamic_cast<visitor<S_msrCreditWords>*> (v)) {
+      visitor<S_msrCreditWords>::cast (v)) {
         S_msrCreditWords elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -353,7 +353,7 @@ void msrCredit::acceptIn (basevisitor* v)
 
   if (visitor<S_msrCredit>*
     p =
-      dynamic_cast<visitor<S_msrCredit>*> (v)) {
+      visitor<S_msrCredit>::cast (v)) {
         S_msrCredit elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -389,7 +389,7 @@ void msrCredit::acceptOut (basevisitor* v)
 
   if (visitor<S_msrCredit>*
     p =
-      dynamic_cast<visitor<S_msrCredit>*> (v)) {
+      visitor<S_msrCredit>::cast (v)) {
         S_msrCredit elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
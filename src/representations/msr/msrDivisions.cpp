@@ -555,7 +555,7 @@ void msrDivisions::acceptIn (basevisitor* v)
 
   if (visitor<S_msrDivisions>*
     p =
-      dynamic_cast<visitor<S_msrDivisions>*> (v)) {
+      visitor<S_msrDivisions>::cast (v)) {
         S_msrDivisions elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -591,7 +591,7 @@ void msrDivisions::acceptOut (basevisitor* v)
 
   if (visitor<S_msrDivisions>*
     p =
-      dynamic_cast<visitor<S_msrDivisions>*> (v)) {
+      visitor<S_msrDivisions>::cast (v)) {
         S_msrDivisions elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
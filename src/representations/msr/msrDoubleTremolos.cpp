@@ -721,7 +721,7 @@ void msrDoubleTremolo::acceptIn (basevisitor* v)
 
   if (visitor<S_msrDoubleTremolo>*
     p =
-      dynamic_cast<visitor<S_msrDoubleTremolo>*> (v)) {
+      visitor<S_msrDoubleTremolo>::cast (v)) {
         S_msrDoubleTremolo elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -757,7 +757,7 @@ void msrDoubleTremolo::acceptOut (basevisitor* v)
 
   if (visitor<S_msrDoubleTremolo>*
     p =
-      dynamic_cast<visitor<S_msrDoubleTremolo>*> (v)) {
+      visitor<S_msrDoubleTremolo>::cast (v)) {
         S_msrDoubleTremolo elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
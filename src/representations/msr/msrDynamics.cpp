@@ -322,7 +322,7 @@ void msrDynamic::acceptIn (basevisitor* v)
 
   if (visitor<S_msrDynamic>*
     p =
-      dynamic_cast<visitor<S_msrDynamic>*> (v)) {
+      visitor<S_msrDynamic>::cast (v)) {
         S_msrDynamic elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -358,7 +358,7 @@ void msrDynamic::acceptOut (basevisitor* v)
 
   if (visitor<S_msrDynamic>*
     p =
-      dynamic_cast<visitor<S_msrDynamic>*> (v)) {
+      visitor<S_msrDynamic>::cast (v)) {
         S_msrDynamic elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -450,7 +450,7 @@ void msrOtherDynamic::acceptIn (basevisitor* v)
 
   if (visitor<S_msrOtherDynamic>*
     p =
-      dynamic_cast<visitor<S_msrOtherDynamic>*> (v)) {
+      visitor<S_msrOtherDynamic>::cast (v)) {
         S_msrOtherDynamic elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -486,7 +486,7 @@ void msrOtherDynamic::acceptOut (basevisitor* v)
 
   if (visitor<S_msrOtherDynamic>*
     p =
-      dynamic_cast<visitor<S_msrOtherDynamic>*> (v)) {
+      visitor<S_msrOtherDynamic>::cast (v)) {
         S_msrOtherDynamic elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -606,7 +606,7 @@ void msrCrescDecresc::acceptIn (basevisitor* v)
 
   if (visitor<S_msrCrescDecresc>*
     p =
-      dynamic_cast<visitor<S_msrCrescDecresc>*> (v)) {
+      visitor<S_msrCrescDecresc>::cast (v)) {
         S_msrCrescDecresc elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -642,7 +642,7 @@ void msrCrescDecresc::acceptOut (basevisitor* v)
 
   if (visitor<S_msrCrescDecresc>*
     p =
-      dynamic_cast<visitor<S_msrCrescDecresc>*> (v)) {
+      visitor<S_msrCrescDecresc>::cast (v)) {
         S_msrCrescDecresc elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -803,7 +803,7 @@ void msrWedge::acceptIn (basevisitor* v)
 
   if (visitor<S_msrWedge>*
     p =
-      dynamic_cast<visitor<S_msrWedge>*> (v)) {
+      visitor<S_msrWedge>::cast (v)) {
         S_msrWedge elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -839,7 +839,7 @@ void msrWedge::acceptOut (basevisitor* v)
 
   if (visitor<S_msrWedge>*
     p =
-      dynamic_cast<visitor<S_msrWedge>*> (v)) {
+      visitor<S_msrWedge>::cast (v)) {
         S_msrWedge elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
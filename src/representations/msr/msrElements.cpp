@@ -76,7 +76,7 @@ void msrElement::acceptIn (basevisitor* v)
 
   if (visitor<S_msrElement>*
     p =
-      dynamic_cast<visitor<S_msrElement>*> (v)) {
+      visitor<S_msrElement>::cast (v)) {
         S_msrElement elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -112,7 +112,7 @@ void msrElement::acceptOut (basevisitor* v)
 
   if (visitor<S_msrElement>*
     p =
-      dynamic_cast<visitor<S_msrElement>*> (v)) {
+      visitor<S_msrElement>::cast (v)) {
         S_msrElement elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
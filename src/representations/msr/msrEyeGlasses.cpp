@@ -175,7 +175,7 @@ void msrEyeGlasses::acceptIn (basevisitor* v)
 
   if (visitor<S_msrEyeGlasses>*
     p =
-      dynamic_cast<visitor<S_msrEyeGlasses>*> (v)) {
+      visitor<S_msrEyeGlasses>::cast (v)) {
         S_msrEyeGlasses elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -211,7 +211,7 @@ void msrEyeGlasses::acceptOut (basevisitor* v)
 
   if (visitor<S_msrEyeGlasses>*
     p =
-      dynamic_cast<visitor<S_msrEyeGlasses>*> (v)) {
+      visitor<S_msrEyeGlasses>::cast (v)) {
         S_msrEyeGlasses elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -306,7 +306,7 @@ void msrBassFigure::acceptIn (basevisitor* v)
 
   if (visitor<S_msrBassFigure>*
     p =
-      dynamic_cast<visitor<S_msrBassFigure>*> (v)) {
+      visitor<S_msrBassFigure>::cast (v)) {
         S_msrBassFigure elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -342,7 +342,7 @@ void msrBassFigure::acceptOut (basevisitor* v)
 
   if (visitor<S_msrBassFigure>*
     p =
-      dynamic_cast<visitor<S_msrBassFigure>*> (v)) {
+      visitor<S_msrBassFigure>::cast (v)) {
         S_msrBassFigure elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -725,7 +725,7 @@ void msrFiguredBass::acceptIn (basevisitor* v)
 
   if (visitor<S_msrFiguredBass>*
     p =
-      dynamic_cast<visitor<S_msrFiguredBass>*> (v)) {
+      visitor<S_msrFiguredBass>::cast (v)) {
         S_msrFiguredBass elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -761,7 +761,7 @@ void msrFiguredBass::acceptOut (basevisitor* v)
 
   if (visitor<S_msrFiguredBass>*
     p =
-      dynamic_cast<visitor<S_msrFiguredBass>*> (v)) {
+      visitor<S_msrFiguredBass>::cast (v)) {
         S_msrFiguredBass elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -245,7 +245,7 @@ void msrGenerationAPIKindAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_msrGenerationAPIKindAtom>*
     p =
-      dynamic_cast<visitor<S_msrGenerationAPIKindAtom>*> (v)) {
+      visitor<S_msrGenerationAPIKindAtom>::cast (v)) {
         S_msrGenerationAPIKindAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -281,7 +281,7 @@ void msrGenerationAPIKindAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_msrGenerationAPIKindAtom>*
     p =
-      dynamic_cast<visitor<S_msrGenerationAPIKindAtom>*> (v)) {
+      visitor<S_msrGenerationAPIKindAtom>::cast (v)) {
         S_msrGenerationAPIKindAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -141,7 +141,7 @@ void msrGeneratorsOahGroup::acceptIn (basevisitor* v)
 
   if (visitor<S_msrGeneratorsOahGroup>*
     p =
-      dynamic_cast<visitor<S_msrGeneratorsOahGroup>*> (v)) {
+      visitor<S_msrGeneratorsOahGroup>::cast (v)) {
         S_msrGeneratorsOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -177,7 +177,7 @@ void msrGeneratorsOahGroup::acceptOut (basevisitor* v)
 
   if (visitor<S_msrGeneratorsOahGroup>*
     p =
-      dynamic_cast<visitor<S_msrGeneratorsOahGroup>*> (v)) {
+      visitor<S_msrGeneratorsOahGroup>::cast (v)) {
         S_msrGeneratorsOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -138,7 +138,7 @@ void msrGlissando::acceptIn (basevisitor* v)
 
   if (visitor<S_msrGlissando>*
     p =
-      dynamic_cast<visitor<S_msrGlissando>*> (v)) {
+      visitor<S_msrGlissando>::cast (v)) {
         S_msrGlissando elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -174,7 +174,7 @@ void msrGlissando::acceptOut (basevisitor* v)
 
   if (visitor<S_msrGlissando>*
     p =
-      dynamic_cast<visitor<S_msrGlissando>*> (v)) {
+      visitor<S_msrGlissando>::cast (v)) {
         S_msrGlissando elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -559,7 +559,7 @@ void msrGraceNotesGroup::acceptIn (basevisitor* v)
 
   if (visitor<S_msrGraceNotesGroup>*
     p =
-      dynamic_cast<visitor<S_msrGraceNotesGroup>*> (v)) {
+      visitor<S_msrGraceNotesGroup>::cast (v)) {
         S_msrGraceNotesGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -595,7 +595,7 @@ void msrGraceNotesGroup::acceptOut (basevisitor* v)
 
   if (visitor<S_msrGraceNotesGroup>*
     p =
-      dynamic_cast<visitor<S_msrGraceNotesGroup>*> (v)) {
+      visitor<S_msrGraceNotesGroup>::cast (v)) {
         S_msrGraceNotesGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -2645,7 +2645,7 @@ void msrHarmonyInterval::acceptIn (basevisitor* v) {
 
   if (visitor<S_msrHarmonyInterval>*
     p =
-      dynamic_cast<visitor<S_msrHarmonyInterval>*> (v)) {
+      visitor<S_msrHarmonyInterval>::cast (v)) {
         S_msrHarmonyInterval elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -2675,7 +2675,7 @@ void msrHarmonyInterval::acceptOut (basevisitor* v) {
 
   if (visitor<S_msrHarmonyInterval>*
     p =
-      dynamic_cast<visitor<S_msrHarmonyInterval>*> (v)) {
+      visitor<S_msrHarmonyInterval>::cast (v)) {
         S_msrHarmonyInterval elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -3760,7 +3760,7 @@ void msrHarmonyDegree::acceptIn (basevisitor* v)
 
   if (visitor<S_msrHarmonyDegree>*
     p =
-      dynamic_cast<visitor<S_msrHarmonyDegree>*> (v)) {
+      visitor<S_msrHarmonyDegree>::cast (v)) {
         S_msrHarmonyDegree elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -3796,7 +3796,7 @@ void msrHarmonyDegree::acceptOut (basevisitor* v)
 
   if (visitor<S_msrHarmonyDegree>*
     p =
-      dynamic_cast<visitor<S_msrHarmonyDegree>*> (v)) {
+      visitor<S_msrHarmonyDegree>::cast (v)) {
         S_msrHarmonyDegree elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -4154,7 +4154,7 @@ void msrHarmonyContents::acceptIn (basevisitor* v) {
 
   if (visitor<S_msrHarmonyContents>*
     p =
-      dynamic_cast<visitor<S_msrHarmonyContents>*> (v)) {
+      visitor<S_msrHarmonyContents>::cast (v)) {
         S_msrHarmonyContents elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -4184,7 +4184,7 @@ void msrHarmonyContents::acceptOut (basevisitor* v) {
 
   if (visitor<S_msrHarmonyContents>*
     p =
-      dynamic_cast<visitor<S_msrHarmonyContents>*> (v)) {
+      visitor<S_msrHarmonyContents>::cast (v)) {
         S_msrHarmonyContents elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -4836,7 +4836,7 @@ void msrHarmony::acceptIn (basevisitor* v)
 
   if (visitor<S_msrHarmony>*
     p =
-      dynamic_cast<visitor<S_msrHarmony>*> (v)) {
+      visitor<S_msrHarmony>::cast (v)) {
         S_msrHarmony elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -4872,7 +4872,7 @@ void msrHarmony::acceptOut (basevisitor* v)
 
   if (visitor<S_msrHarmony>*
     p =
-      dynamic_cast<visitor<S_msrHarmony>*> (v)) {
+      visitor<S_msrHarmony>::cast (v)) {
         S_msrHarmony elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -6944,7 +6944,7 @@ void msrHarmonyStructure::acceptIn (basevisitor* v) {
 
   if (visitor<S_msrHarmonyStructure>*
     p =
-      dynamic_cast<visitor<S_msrHarmonyStructure>*> (v)) {
+      visitor<S_msrHarmonyStructure>::cast (v)) {
         S_msrHarmonyStructure elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -6974,7 +6974,7 @@ void msrHarmonyStructure::acceptOut (basevisitor* v) {
 
   if (visitor<S_msrHarmonyStructure>*
     p =
-      dynamic_cast<visitor<S_msrHarmonyStructure>*> (v)) {
+      visitor<S_msrHarmonyStructure>::cast (v)) {
         S_msrHarmonyStructure elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -126,7 +126,7 @@ void msrHiddenMeasureAndBarLine::acceptIn (basevisitor* v)
 
   if (visitor<S_msrHiddenMeasureAndBarLine>*
     p =
-      dynamic_cast<visitor<S_msrHiddenMeasureAndBarLine>*> (v)) {
+      visitor<S_msrHiddenMeasureAndBarLine>::cast (v)) {
         S_msrHiddenMeasureAndBarLine elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -162,7 +162,7 @@ void msrHiddenMeasureAndBarLine::acceptOut (basevisitor* v)
 
   if (visitor<S_msrHiddenMeasureAndBarLine>*
     p =
-      dynamic_cast<visitor<S_msrHiddenMeasureAndBarLine>*> (v)) {
+      visitor<S_msrHiddenMeasureAndBarLine>::cast (v)) {
         S_msrHiddenMeasureAndBarLine elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -574,7 +574,7 @@ void msrIdentification::acceptIn (basevisitor* v)
 
   if (visitor<S_msrIdentification>*
     p =
-      dynamic_cast<visitor<S_msrIdentification>*> (v)) {
+      visitor<S_msrIdentification>::cast (v)) {
         S_msrIdentification elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -610,7 +610,7 @@ void msrIdentification::acceptOut (basevisitor* v)
 
   if (visitor<S_msrIdentification>*
     p =
-      dynamic_cast<visitor<S_msrIdentification>*> (v)) {
+      visitor<S_msrIdentification>::cast (v)) {
         S_msrIdentification elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -121,7 +121,7 @@ void msrStringTuning::acceptIn (basevisitor* v)
 
   if (visitor<S_msrStringTuning>*
     p =
-      dynamic_cast<visitor<S_msrStringTuning>*> (v)) {
+      visitor<S_msrStringTuning>::cast (v)) {
         S_msrStringTuning elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -157,7 +157,7 @@ void msrStringTuning::acceptOut (basevisitor* v)
 
   if (visitor<S_msrStringTuning>*
     p =
-      dynamic_cast<visitor<S_msrStringTuning>*> (v)) {
+      visitor<S_msrStringTuning>::cast (v)) {
         S_msrStringTuning elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -305,7 +305,7 @@ void msrScordatura::acceptIn (basevisitor* v)
 
   if (visitor<S_msrScordatura>*
     p =
-      dynamic_cast<visitor<S_msrScordatura>*> (v)) {
+      visitor<S_msrScordatura>::cast (v)) {
         S_msrScordatura elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -341,7 +341,7 @@ void msrScordatura::acceptOut (basevisitor* v)
 
   if (visitor<S_msrScordatura>*
     p =
-      dynamic_cast<visitor<S_msrScordatura>*> (v)) {
+      visitor<S_msrScordatura>::cast (v)) {
         S_msrScordatura elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -504,7 +504,7 @@ void msrAccordionRegistration::acceptIn (basevisitor* v)
 
   if (visitor<S_msrAccordionRegistration>*
     p =
-      dynamic_cast<visitor<S_msrAccordionRegistration>*> (v)) {
+      visitor<S_msrAccordionRegistration>::cast (v)) {
         S_msrAccordionRegistration elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -540,7 +540,7 @@ void msrAccordionRegistration::acceptOut (basevisitor* v)
 
   if (visitor<S_msrAccordionRegistration>*
     p =
-      dynamic_cast<visitor<S_msrAccordionRegistration>*> (v)) {
+      visitor<S_msrAccordionRegistration>::cast (v)) {
         S_msrAccordionRegistration elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -751,7 +751,7 @@ void msrHarpPedalsTuning::acceptIn (basevisitor* v)
 
   if (visitor<S_msrHarpPedalsTuning>*
     p =
-      dynamic_cast<visitor<S_msrHarpPedalsTuning>*> (v)) {
+      visitor<S_msrHarpPedalsTuning>::cast (v)) {
         S_msrHarpPedalsTuning elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -787,7 +787,7 @@ void msrHarpPedalsTuning::acceptOut (basevisitor* v)
 
   if (visitor<S_msrHarpPedalsTuning>*
     p =
-      dynamic_cast<visitor<S_msrHarpPedalsTuning>*> (v)) {
+      visitor<S_msrHarpPedalsTuning>::cast (v)) {
         S_msrHarpPedalsTuning elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -999,7 +999,7 @@ void msrPedal::acceptIn (basevisitor* v)
 
   if (visitor<S_msrPedal>*
     p =
-      dynamic_cast<visitor<S_msrPedal>*> (v)) {
+      visitor<S_msrPedal>::cast (v)) {
         S_msrPedal elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -1035,7 +1035,7 @@ void msrPedal::acceptOut (basevisitor* v)
 
   if (visitor<S_msrPedal>*
     p =
-      dynamic_cast<visitor<S_msrPedal>*> (v)) {
+      visitor<S_msrPedal>::cast (v)) {
         S_msrPedal elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -1238,7 +1238,7 @@ void msrDamp::acceptIn (basevisitor* v)
 
   if (visitor<S_msrDamp>*
     p =
-      dynamic_cast<visitor<S_msrDamp>*> (v)) {
+      visitor<S_msrDamp>::cast (v)) {
         S_msrDamp elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -1274,7 +1274,7 @@ void msrDamp::acceptOut (basevisitor* v)
 
   if (visitor<S_msrDamp>*
     p =
-      dynamic_cast<visitor<S_msrDamp>*> (v)) {
+      visitor<S_msrDamp>::cast (v)) {
         S_msrDamp elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -1395,7 +1395,7 @@ void msrDampAll::acceptIn (basevisitor* v)
 
   if (visitor<S_msrDampAll>*
     p =
-      dynamic_cast<visitor<S_msrDampAll>*> (v)) {
+      visitor<S_msrDampAll>::cast (v)) {
         S_msrDampAll elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -1431,7 +1431,7 @@ void msrDampAll::acceptOut (basevisitor* v)
 
   if (visitor<S_msrDampAll>*
     p =
-      dynamic_cast<visitor<S_msrDampAll>*> (v)) {
+      visitor<S_msrDampAll>::cast (v)) {
         S_msrDampAll elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
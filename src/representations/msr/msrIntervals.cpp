@@ -9,6 +9,7 @@
   https://github.com/jacques-menu/musicformats
 */
 
+#include <array>
 #include <climits>      // INT_MIN, INT_MAX
 #include <sstream>
 
@@ -1076,6804 +1077,906 @@ msrSemiTonesPitchKind noteAtIntervalKindFromNote (
 }
 */
 
-msrSemiTonesPitchKind noteAtIntervalFromSemiTonesPitch (
-  const mfInputLineNumber& inputLineNumber,
-  msrIntervalKind       intervalKind,
-  msrSemiTonesPitchKind semiTonesPitchKind)
+// notes at intervals
+//______________________________________________________________________________
+// the notes at the intervals from the flat, natural and sharp pitches
+// are lookup tables computed at compile time,
+// with a row per pitch from C flat to B sharp, and a column per interval
+// from kIntervalDiminishedUnisson to kIntervalAugmentedThirteenth;
+// computing intervals on double or triple flats/sharps
+// is not considered useful, hence not supported
+
+constexpr size_t
+  K_MSR_INTERVAL_KINDS_NUMBER =
+    size_t (msrIntervalKind::kIntervalAugmentedThirteenth), // no kInterval_UNKNOWN_
+  K_MSR_INTERVALS_PITCHES_NUMBER =
+    7 * 3; // flat, natural and sharp
+
+typedef
+  std::array <
+    std::array <msrSemiTonesPitchKind, K_MSR_INTERVAL_KINDS_NUMBER>,
+    K_MSR_INTERVALS_PITCHES_NUMBER>
+  msrSemiTonesPitchesAtIntervalsTable;
+
+typedef
+  std::array <
+    std::array <msrQuarterTonesPitchKind, K_MSR_INTERVAL_KINDS_NUMBER>,
+    K_MSR_INTERVALS_PITCHES_NUMBER>
+  msrQuarterTonesPitchesAtIntervalsTable;
+
+constexpr msrSemiTonesPitchesAtIntervalsTable createSemiTonesPitchesAtIntervalsTable ()
 {
-  msrSemiTonesPitchKind result = msrSemiTonesPitchKind::kSTP_NoSemiTonesPitch;
-
-  switch (semiTonesPitchKind) {
-    case msrSemiTonesPitchKind::kSTP_NoSemiTonesPitch:
-      result = msrSemiTonesPitchKind::kSTP_NoSemiTonesPitch;
-      break;
-
-    case msrSemiTonesPitchKind::kSTP_C_Flat:
-      switch (intervalKind) {
-        case msrIntervalKind::kInterval_UNKNOWN_:
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedUnisson:
-          result = msrSemiTonesPitchKind::kSTP_C_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalPerfectUnisson:
-          result = msrSemiTonesPitchKind::kSTP_C_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedUnisson:
-          result = msrSemiTonesPitchKind::kSTP_C_Natural;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSecond:
-          result = msrSemiTonesPitchKind::kSTP_D_TripleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorSecond:
-          result = msrSemiTonesPitchKind::kSTP_D_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMajorSecond:
-          result = msrSemiTonesPitchKind::kSTP_D_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSecond:
-          result = msrSemiTonesPitchKind::kSTP_D_Natural;
-          break;
+  using enum msrSemiTonesPitchKind;
+
+  return {{
+    // C flat
+    {{
+      kSTP_C_DoubleFlat, kSTP_C_Flat, kSTP_C_Natural,
+      kSTP_D_TripleFlat, kSTP_D_DoubleFlat, kSTP_D_Flat, kSTP_D_Natural,
+      kSTP_E_DoubleFlat, kSTP_E_TripleFlat, kSTP_E_Flat, kSTP_E_Natural,
+      kSTP_F_DoubleleFlat, kSTP_F_Flat, kSTP_F_Natural,
+      kSTP_G_DoubleFlat, kSTP_G_Flat, kSTP_G_Natural,
+      kSTP_A_TripleFlat, kSTP_A_DoubleFlat, kSTP_A_Flat, kSTP_A_Natural,
+      kSTP_B_TripleFlat, kSTP_B_DoubleFlat, kSTP_B_Flat, kSTP_B_Natural,
+      kSTP_C_DoubleFlat, kSTP_C_Flat, kSTP_C_Natural,
+      kSTP_D_TripleFlat, kSTP_D_DoubleFlat, kSTP_D_Flat, kSTP_D_Natural,
+      kSTP_E_TripleFlat, kSTP_E_DoubleFlat, kSTP_E_Flat, kSTP_E_Natural,
+      kSTP_F_DoubleleFlat, kSTP_F_Flat, kSTP_F_Natural,
+      kSTP_G_DoubleFlat, kSTP_G_Flat, kSTP_G_Natural,
+      kSTP_A_TripleFlat, kSTP_A_DoubleFlat, kSTP_A_Flat, kSTP_A_Natural
+    }},
+    // C natural
+    {{
+      kSTP_C_Flat, kSTP_C_Natural, kSTP_C_Sharp,
+      kSTP_D_DoubleFlat, kSTP_D_Flat, kSTP_D_Natural, kSTP_D_Sharp,
+      kSTP_E_DoubleFlat, kSTP_E_Flat, kSTP_E_Natural, kSTP_E_Sharp,
+      kSTP_F_Flat, kSTP_F_Natural, kSTP_F_Sharp,
+      kSTP_G_Flat, kSTP_G_Natural, kSTP_G_Sharp,
+      kSTP_A_DoubleFlat, kSTP_A_Flat, kSTP_A_Natural, kSTP_A_Sharp,
+      kSTP_B_DoubleFlat, kSTP_B_Flat, kSTP_B_Natural, kSTP_B_Sharp,
+      kSTP_C_Flat, kSTP_C_Natural, kSTP_C_Sharp,
+      kSTP_D_DoubleFlat, kSTP_D_Flat, kSTP_D_Natural, kSTP_D_Sharp,
+      kSTP_E_DoubleFlat, kSTP_E_Flat, kSTP_E_Natural, kSTP_E_Sharp,
+      kSTP_F_Flat, kSTP_F_Natural, kSTP_F_Sharp,
+      kSTP_G_Flat, kSTP_G_Natural, kSTP_G_Sharp,
+      kSTP_A_DoubleFlat, kSTP_A_Flat, kSTP_A_Natural, kSTP_G_Sharp
+    }},
+    // C sharp
+    {{
+      kSTP_C_Natural, kSTP_C_Sharp, kSTP_C_DoubleSharp,
+      kSTP_D_Flat, kSTP_D_Natural, kSTP_D_Sharp, kSTP_D_DoubleSharp,
+      kSTP_E_Flat, kSTP_E_Natural, kSTP_E_Sharp, kSTP_E_DoubleSharp,
+      kSTP_F_Natural, kSTP_F_Sharp, kSTP_F_DoubleSharp,
+      kSTP_G_Natural, kSTP_G_Sharp, kSTP_G_DoubleSharp,
+      kSTP_A_Flat, kSTP_A_Natural, kSTP_A_Sharp, kSTP_A_DoubleSharp,
+      kSTP_B_Flat, kSTP_B_Natural, kSTP_B_Sharp, kSTP_B_DoubleSharp,
+      kSTP_C_Natural, kSTP_C_Sharp, kSTP_C_DoubleSharp,
+      kSTP_D_Flat, kSTP_D_Natural, kSTP_D_Sharp, kSTP_D_DoubleSharp,
+      kSTP_E_Flat, kSTP_E_Natural, kSTP_E_Sharp, kSTP_E_DoubleSharp,
+      kSTP_F_Natural, kSTP_F_Sharp, kSTP_F_DoubleSharp,
+      kSTP_G_Natural, kSTP_G_Sharp, kSTP_G_DoubleSharp,
+      kSTP_A_Flat, kSTP_A_Natural, kSTP_A_Sharp, kSTP_A_DoubleSharp
+    }},
+    // D flat
+    {{
+      kSTP_D_DoubleFlat, kSTP_D_Flat, kSTP_D_Natural,
+      kSTP_E_TripleFlat, kSTP_E_DoubleFlat, kSTP_E_Flat, kSTP_E_Natural,
+      kSTP_F_DoubleleFlat, kSTP_F_Flat, kSTP_F_Natural, kSTP_F_Sharp,
+      kSTP_G_DoubleFlat, kSTP_G_Flat, kSTP_G_Natural,
+      kSTP_A_DoubleFlat, kSTP_A_Flat, kSTP_A_Natural,
+      kSTP_B_TripleFlat, kSTP_B_DoubleFlat, kSTP_B_Flat, kSTP_B_Natural,
+      kSTP_C_DoubleFlat, kSTP_C_Flat, kSTP_C_Natural, kSTP_C_Sharp,
+      kSTP_D_DoubleFlat, kSTP_D_Flat, kSTP_D_Natural,
+      kSTP_E_TripleFlat, kSTP_E_DoubleFlat, kSTP_E_Flat, kSTP_E_Natural,
+      kSTP_F_DoubleleFlat, kSTP_F_Flat, kSTP_F_Natural, kSTP_F_Sharp,
+      kSTP_G_DoubleFlat, kSTP_G_Flat, kSTP_G_Natural,
+      kSTP_A_DoubleFlat, kSTP_A_Flat, kSTP_A_Natural,
+      kSTP_B_TripleFlat, kSTP_B_DoubleFlat, kSTP_B_Flat, kSTP_B_Natural
+    }},
+    // D natural
+    {{
+      kSTP_D_Flat, kSTP_D_Natural, kSTP_D_Sharp,
+      kSTP_E_DoubleFlat, kSTP_E_Flat, kSTP_E_Natural, kSTP_E_Sharp,
+      kSTP_F_Flat, kSTP_F_Natural, kSTP_F_Sharp, kSTP_F_DoubleSharp,
+      kSTP_G_Flat, kSTP_G_Natural, kSTP_G_Sharp,
+      kSTP_A_Flat, kSTP_A_Natural, kSTP_A_Sharp,
+      kSTP_B_DoubleFlat, kSTP_B_Flat, kSTP_B_Natural, kSTP_B_Sharp,
+      kSTP_C_Flat, kSTP_C_Natural, kSTP_C_Sharp, kSTP_C_DoubleSharp,
+      kSTP_D_Flat, kSTP_D_Natural, kSTP_D_Sharp,
+      kSTP_E_DoubleFlat, kSTP_E_Flat, kSTP_E_Natural, kSTP_E_Sharp,
+      kSTP_F_Flat, kSTP_F_Natural, kSTP_F_Sharp, kSTP_F_DoubleSharp,
+      kSTP_G_Flat, kSTP_G_Natural, kSTP_G_Sharp,
+      kSTP_A_Flat, kSTP_A_Natural, kSTP_A_Sharp,
+      kSTP_B_DoubleFlat, kSTP_B_Flat, kSTP_B_Natural, kSTP_B_Sharp
+    }},
+    // D sharp
+    {{
+      kSTP_D_Natural, kSTP_D_Sharp, kSTP_D_DoubleSharp,
+      kSTP_E_Flat, kSTP_E_Natural, kSTP_E_Sharp, kSTP_E_DoubleSharp,
+      kSTP_F_Flat, kSTP_F_Natural, kSTP_F_Sharp, kSTP_F_DoubleSharp,
+      kSTP_G_Natural, kSTP_G_Sharp, kSTP_G_DoubleSharp,
+      kSTP_A_Natural, kSTP_A_Sharp, kSTP_A_DoubleSharp,
+      kSTP_B_Flat, kSTP_B_Natural, kSTP_B_Sharp, kSTP_B_DoubleSharp,
+      kSTP_C_Natural, kSTP_C_Sharp, kSTP_C_DoubleSharp, kSTP_C_TripleSharp,
+      kSTP_D_Natural, kSTP_D_Sharp, kSTP_D_DoubleSharp,
+      kSTP_E_Flat, kSTP_E_Natural, kSTP_E_Sharp, kSTP_E_DoubleSharp,
+      kSTP_F_Natural, kSTP_F_Sharp, kSTP_F_DoubleSharp, kSTP_F_DoubleSharp,
+      kSTP_G_Natural, kSTP_G_Sharp, kSTP_G_DoubleSharp,
+      kSTP_A_Natural, kSTP_A_Sharp, kSTP_A_DoubleSharp,
+      kSTP_B_Flat, kSTP_B_Natural, kSTP_B_Sharp, kSTP_B_DoubleSharp
+    }},
+    // E flat
+    {{
+      kSTP_E_DoubleFlat, kSTP_E_Flat, kSTP_E_Natural,
+      kSTP_F_DoubleleFlat, kSTP_F_Flat, kSTP_F_Natural, kSTP_F_Sharp,
+      kSTP_G_DoubleFlat, kSTP_G_Flat, kSTP_G_Natural, kSTP_G_Sharp,
+      kSTP_A_DoubleFlat, kSTP_A_Flat, kSTP_A_Natural,
+      kSTP_B_DoubleFlat, kSTP_B_Flat, kSTP_B_Natural,
+      kSTP_C_DoubleFlat, kSTP_C_Flat, kSTP_C_Natural, kSTP_C_Sharp,
+      kSTP_D_DoubleFlat, kSTP_D_Flat, kSTP_D_Natural, kSTP_D_Sharp,
+      kSTP_E_DoubleFlat, kSTP_E_Flat, kSTP_E_Natural,
+      kSTP_F_DoubleleFlat, kSTP_F_Flat, kSTP_F_Natural, kSTP_F_Sharp,
+      kSTP_G_DoubleFlat, kSTP_G_Flat, kSTP_G_Natural, kSTP_G_Sharp,
+      kSTP_A_DoubleFlat, kSTP_A_Flat, kSTP_A_Natural,
+      kSTP_B_DoubleFlat, kSTP_B_Flat, kSTP_B_Natural,
+      kSTP_C_DoubleFlat, kSTP_C_Flat, kSTP_C_Natural, kSTP_C_Sharp
+    }},
+    // E natural
+    {{
+      kSTP_E_Flat, kSTP_E_Natural, kSTP_E_Sharp,
+      kSTP_F_Flat, kSTP_F_Natural, kSTP_F_Sharp, kSTP_F_DoubleSharp,
+      kSTP_G_Flat, kSTP_G_Natural, kSTP_G_Sharp, kSTP_G_DoubleSharp,
+      kSTP_A_Flat, kSTP_A_Natural, kSTP_A_Sharp,
+      kSTP_B_Natural, kSTP_B_Sharp, kSTP_B_DoubleSharp,
+      kSTP_C_Flat, kSTP_C_Natural, kSTP_C_Sharp, kSTP_C_DoubleSharp,
+      kSTP_D_Flat, kSTP_D_Natural, kSTP_D_Sharp, kSTP_D_DoubleSharp,
+      kSTP_E_Flat, kSTP_E_Natural, kSTP_E_Sharp,
+      kSTP_F_Flat, kSTP_F_Natural, kSTP_F_Sharp, kSTP_F_DoubleSharp,
+      kSTP_G_Flat, kSTP_G_Natural, kSTP_G_Sharp, kSTP_G_DoubleSharp,
+      kSTP_A_Flat, kSTP_A_Natural, kSTP_A_Sharp,
+      kSTP_B_Natural, kSTP_B_Sharp, kSTP_B_DoubleSharp,
+      kSTP_C_Flat, kSTP_C_Natural, kSTP_C_Sharp, kSTP_C_DoubleSharp
+    }},
+    // E sharp
+    {{
+      kSTP_E_Natural, kSTP_E_Sharp, kSTP_E_DoubleSharp,
+      kSTP_F_Natural, kSTP_F_Sharp, kSTP_F_DoubleSharp, kSTP_F_TripleSharp,
+      kSTP_G_Natural, kSTP_G_Sharp, kSTP_G_DoubleSharp, kSTP_G_TripleSharp,
+      kSTP_A_Natural, kSTP_A_Sharp, kSTP_A_DoubleSharp,
+      kSTP_B_Natural, kSTP_B_Sharp, kSTP_B_DoubleSharp,
+      kSTP_C_Natural, kSTP_C_Sharp, kSTP_C_DoubleSharp, kSTP_C_TripleSharp,
+      kSTP_D_Natural, kSTP_D_Sharp, kSTP_D_DoubleSharp, kSTP_D_TripleSharp,
+      kSTP_E_Natural, kSTP_E_Sharp, kSTP_E_DoubleSharp,
+      kSTP_F_Natural, kSTP_F_Sharp, kSTP_F_DoubleSharp, kSTP_F_TripleSharp,
+      kSTP_G_Natural, kSTP_G_Sharp, kSTP_G_DoubleSharp, kSTP_G_TripleSharp,
+      kSTP_A_Natural, kSTP_A_Sharp, kSTP_A_DoubleSharp,
+      kSTP_B_Natural, kSTP_B_Sharp, kSTP_B_DoubleSharp,
+      kSTP_C_Natural, kSTP_C_Sharp, kSTP_C_DoubleSharp, kSTP_C_TripleSharp
+    }},
+    // F flat
+    {{
+      kSTP_F_DoubleleFlat, kSTP_F_Flat, kSTP_F_Natural,
+      kSTP_G_TripleFlat, kSTP_G_DoubleFlat, kSTP_G_Flat, kSTP_G_Natural,
+      kSTP_A_TripleFlat, kSTP_A_DoubleFlat, kSTP_A_Flat, kSTP_A_Natural,
+      kSTP_B_TripleFlat, kSTP_B_DoubleFlat, kSTP_B_Flat,
+      kSTP_C_DoubleFlat, kSTP_C_Flat, kSTP_C_Natural,
+      kSTP_D_TripleFlat, kSTP_D_DoubleFlat, kSTP_D_Flat, kSTP_D_Natural,
+      kSTP_E_TripleFlat, kSTP_E_DoubleFlat, kSTP_E_Flat, kSTP_E_Natural,
+      kSTP_F_DoubleleFlat, kSTP_F_Flat, kSTP_F_Natural,
+      kSTP_G_TripleFlat, kSTP_G_DoubleFlat, kSTP_G_Flat, kSTP_G_Natural,
+      kSTP_A_TripleFlat, kSTP_A_DoubleFlat, kSTP_A_Flat, kSTP_A_Natural,
+      kSTP_B_TripleFlat, kSTP_B_DoubleFlat, kSTP_B_Flat,
+      kSTP_C_DoubleFlat, kSTP_C_Flat, kSTP_C_Natural,
+      kSTP_D_TripleFlat, kSTP_D_DoubleFlat, kSTP_D_Flat, kSTP_D_Natural
+    }},
+    // F natural
+    {{
+      kSTP_F_Flat, kSTP_F_Natural, kSTP_F_Sharp,
+      kSTP_G_DoubleFlat, kSTP_G_Flat, kSTP_G_Natural, kSTP_G_Sharp,
+      kSTP_A_DoubleFlat, kSTP_A_Flat, kSTP_A_Natural, kSTP_A_Sharp,
+      kSTP_B_DoubleFlat, kSTP_B_Flat, kSTP_B_Natural,
+      kSTP_C_Flat, kSTP_C_Natural, kSTP_C_Sharp,
+      kSTP_D_DoubleFlat, kSTP_D_Flat, kSTP_D_Natural, kSTP_D_Sharp,
+      kSTP_E_DoubleFlat, kSTP_E_Flat, kSTP_E_Natural, kSTP_E_Sharp,
+      kSTP_F_Flat, kSTP_F_Natural, kSTP_F_Sharp,
+      kSTP_G_DoubleFlat, kSTP_G_Flat, kSTP_G_Natural, kSTP_G_Sharp,
+      kSTP_A_DoubleFlat, kSTP_A_Flat, kSTP_A_Natural, kSTP_A_Sharp,
+      kSTP_B_DoubleFlat, kSTP_B_Flat, kSTP_B_Natural,
+      kSTP_C_Flat, kSTP_C_Natural, kSTP_C_Sharp,
+      kSTP_D_DoubleFlat, kSTP_D_Flat, kSTP_D_Natural, kSTP_D_Sharp
+    }},
+    // F sharp
+    {{
+      kSTP_F_Natural, kSTP_F_Sharp, kSTP_F_DoubleSharp,
+      kSTP_G_Flat, kSTP_G_Natural, kSTP_G_Sharp, kSTP_G_DoubleSharp,
+      kSTP_A_Flat, kSTP_A_Natural, kSTP_A_Sharp, kSTP_A_DoubleSharp,
+      kSTP_B_Sharp, kSTP_B_DoubleSharp, kSTP_B_TripleSharp,
+      kSTP_C_Natural, kSTP_C_Sharp, kSTP_C_DoubleSharp,
+      kSTP_D_Flat, kSTP_D_Natural, kSTP_D_Sharp, kSTP_D_DoubleSharp,
+      kSTP_E_Flat, kSTP_E_Natural, kSTP_E_Sharp, kSTP_E_DoubleSharp,
+      kSTP_F_Natural, kSTP_F_Sharp, kSTP_F_DoubleSharp,
+      kSTP_G_Flat, kSTP_G_Natural, kSTP_G_Sharp, kSTP_G_DoubleSharp,
+      kSTP_A_Natural, kSTP_A_Natural, kSTP_A_Sharp, kSTP_A_DoubleSharp,
+      kSTP_B_Sharp, kSTP_B_DoubleSharp, kSTP_B_TripleSharp,
+      kSTP_C_Natural, kSTP_C_Sharp, kSTP_C_DoubleSharp,
+      kSTP_E_Flat, kSTP_D_Natural, kSTP_D_Sharp, kSTP_D_DoubleSharp
+    }},
+    // G flat
+    {{
+      kSTP_G_DoubleFlat, kSTP_G_Flat, kSTP_G_Natural,
+      kSTP_A_TripleFlat, kSTP_A_DoubleFlat, kSTP_A_Flat, kSTP_A_Natural,
+      kSTP_B_TripleFlat, kSTP_B_DoubleFlat, kSTP_B_Flat, kSTP_B_Natural,
+      kSTP_C_DoubleFlat, kSTP_C_Flat, kSTP_C_Natural,
+      kSTP_D_DoubleFlat, kSTP_D_Flat, kSTP_D_Natural,
+      kSTP_E_TripleFlat, kSTP_E_DoubleFlat, kSTP_E_Flat, kSTP_E_Natural,
+      kSTP_F_DoubleleFlat, kSTP_F_Flat, kSTP_F_Natural, kSTP_F_Sharp,
+      kSTP_G_DoubleFlat, kSTP_G_Flat, kSTP_G_Natural,
+      kSTP_A_TripleFlat, kSTP_A_DoubleFlat, kSTP_A_Flat, kSTP_A_Natural,
+      kSTP_B_TripleFlat, kSTP_B_DoubleFlat, kSTP_B_Flat, kSTP_B_Natural,
+      kSTP_C_DoubleFlat, kSTP_C_Flat, kSTP_C_Natural,
+      kSTP_D_DoubleFlat, kSTP_D_Flat, kSTP_D_Natural,
+      kSTP_E_TripleFlat, kSTP_E_DoubleFlat, kSTP_E_Flat, kSTP_E_Natural
+    }},
+    // G natural
+    {{
+      kSTP_G_Flat, kSTP_G_Natural, kSTP_G_Sharp,
+      kSTP_A_DoubleFlat, kSTP_A_Flat, kSTP_A_Natural, kSTP_A_Sharp,
+      kSTP_B_DoubleFlat, kSTP_B_Flat, kSTP_B_Natural, kSTP_B_Sharp,
+      kSTP_C_Flat, kSTP_C_Natural, kSTP_C_Sharp,
+      kSTP_D_Flat, kSTP_D_Natural, kSTP_D_Sharp,
+      kSTP_E_DoubleFlat, kSTP_E_Flat, kSTP_E_Natural, kSTP_E_Sharp,
+      kSTP_F_Flat, kSTP_F_Natural, kSTP_F_Sharp, kSTP_F_DoubleSharp,
+      kSTP_G_Flat, kSTP_G_Natural, kSTP_G_Sharp,
+      kSTP_A_DoubleFlat, kSTP_A_Flat, kSTP_A_Natural, kSTP_A_Sharp,
+      kSTP_B_DoubleFlat, kSTP_B_Flat, kSTP_B_Natural, kSTP_B_Sharp,
+      kSTP_C_Flat, kSTP_C_Natural, kSTP_C_Sharp,
+      kSTP_D_Flat, kSTP_D_Natural, kSTP_D_Sharp,
+      kSTP_E_DoubleFlat, kSTP_E_Flat, kSTP_E_Natural, kSTP_E_Sharp
+    }},
+    // G sharp
+    {{
+      kSTP_G_Natural, kSTP_G_Sharp, kSTP_G_DoubleSharp,
+      kSTP_A_Flat, kSTP_A_Natural, kSTP_A_Sharp, kSTP_A_DoubleSharp,
+      kSTP_B_Flat, kSTP_B_Natural, kSTP_B_Sharp, kSTP_B_DoubleSharp,
+      kSTP_C_Natural, kSTP_C_Sharp, kSTP_C_DoubleSharp,
+      kSTP_D_Natural, kSTP_D_Sharp, kSTP_D_DoubleSharp,
+      kSTP_E_Flat, kSTP_E_Natural, kSTP_E_Sharp, kSTP_E_DoubleSharp,
+      kSTP_F_Natural, kSTP_F_Sharp, kSTP_F_DoubleSharp, kSTP_F_TripleSharp,
+      kSTP_G_Natural, kSTP_G_Sharp, kSTP_G_DoubleSharp,
+      kSTP_A_Flat, kSTP_A_Natural, kSTP_A_Sharp, kSTP_A_DoubleSharp,
+      kSTP_B_Flat, kSTP_B_Natural, kSTP_B_Sharp, kSTP_B_DoubleSharp,
+      kSTP_C_Natural, kSTP_C_Sharp, kSTP_C_DoubleSharp,
+      kSTP_D_Natural, kSTP_D_Sharp, kSTP_D_DoubleSharp,
+      kSTP_E_Flat, kSTP_E_Natural, kSTP_E_Sharp, kSTP_E_DoubleSharp
+    }},
+    // A flat
+    {{
+      kSTP_A_DoubleFlat, kSTP_A_Flat, kSTP_A_Natural,
+      kSTP_B_TripleFlat, kSTP_B_DoubleFlat, kSTP_B_Flat, kSTP_B_Natural,
+      kSTP_C_DoubleFlat, kSTP_C_Flat, kSTP_C_Natural, kSTP_C_Sharp,
+      kSTP_D_DoubleFlat, kSTP_D_Flat, kSTP_D_Natural,
+      kSTP_E_DoubleFlat, kSTP_E_Flat, kSTP_E_Natural,
+      kSTP_F_DoubleleFlat, kSTP_F_Flat, kSTP_F_Natural, kSTP_F_Sharp,
+      kSTP_G_DoubleFlat, kSTP_G_Flat, kSTP_G_Natural, kSTP_G_Sharp,
+      kSTP_A_DoubleFlat, kSTP_A_Flat, kSTP_A_Natural,
+      kSTP_B_TripleFlat, kSTP_B_DoubleFlat, kSTP_B_Flat, kSTP_B_Natural,
+      kSTP_C_DoubleFlat, kSTP_C_Flat, kSTP_C_Natural, kSTP_C_Sharp,
+      kSTP_D_DoubleFlat, kSTP_D_Flat, kSTP_D_Natural,
+      kSTP_E_DoubleFlat, kSTP_E_Flat, kSTP_E_Natural,
+      kSTP_F_TripleFlat, kSTP_F_DoubleleFlat, kSTP_F_Flat, kSTP_F_Natural
+    }},
+    // A natural
+    {{
+      kSTP_A_Flat, kSTP_A_Natural, kSTP_A_Sharp,
+      kSTP_B_DoubleFlat, kSTP_B_Flat, kSTP_B_Natural, kSTP_B_Sharp,
+      kSTP_C_Flat, kSTP_C_Natural, kSTP_C_Sharp, kSTP_C_DoubleSharp,
+      kSTP_D_Flat, kSTP_D_Natural, kSTP_D_Sharp,
+      kSTP_E_Flat, kSTP_E_Natural, kSTP_E_Sharp,
+      kSTP_F_Flat, kSTP_F_Natural, kSTP_F_Sharp, kSTP_F_DoubleSharp,
+      kSTP_G_Flat, kSTP_G_Natural, kSTP_G_Sharp, kSTP_G_DoubleSharp,
+      kSTP_A_Flat, kSTP_A_Natural, kSTP_A_Sharp,
+      kSTP_B_DoubleFlat, kSTP_B_Flat, kSTP_B_Natural, kSTP_B_Sharp,
+      kSTP_C_Flat, kSTP_C_Natural, kSTP_C_Sharp, kSTP_C_DoubleSharp,
+      kSTP_D_Flat, kSTP_D_Natural, kSTP_D_Sharp,
+      kSTP_E_Flat, kSTP_E_Natural, kSTP_E_Sharp,
+      kSTP_F_Flat, kSTP_F_Natural, kSTP_F_Sharp, kSTP_F_DoubleSharp
+    }},
+    // A sharp
+    {{
+      kSTP_A_Natural, kSTP_A_Sharp, kSTP_A_DoubleSharp,
+      kSTP_B_Flat, kSTP_B_Natural, kSTP_B_Sharp, kSTP_B_DoubleSharp,
+      kSTP_C_Natural, kSTP_C_Sharp, kSTP_C_DoubleSharp, kSTP_C_TripleSharp,
+      kSTP_D_Natural, kSTP_D_Sharp, kSTP_D_DoubleSharp,
+      kSTP_E_Natural, kSTP_E_Sharp, kSTP_E_DoubleSharp,
+      kSTP_F_Natural, kSTP_F_Sharp, kSTP_F_DoubleSharp, kSTP_F_TripleSharp,
+      kSTP_G_Natural, kSTP_G_Sharp, kSTP_G_DoubleSharp, kSTP_G_TripleSharp,
+      kSTP_A_Natural, kSTP_A_Sharp, kSTP_A_DoubleSharp,
+      kSTP_B_Flat, kSTP_B_Natural, kSTP_B_Sharp, kSTP_B_DoubleSharp,
+      kSTP_C_Natural, kSTP_C_Sharp, kSTP_C_DoubleSharp, kSTP_C_TripleSharp,
+      kSTP_D_Natural, kSTP_D_Sharp, kSTP_D_DoubleSharp,
+      kSTP_E_Natural, kSTP_E_Sharp, kSTP_E_DoubleSharp,
+      kSTP_F_Natural, kSTP_F_Sharp, kSTP_F_DoubleSharp, kSTP_F_TripleSharp
+    }},
+    // B flat
+    {{
+      kSTP_B_DoubleFlat, kSTP_B_Flat, kSTP_B_Natural,
+      kSTP_C_DoubleFlat, kSTP_C_Flat, kSTP_C_Natural, kSTP_C_Sharp,
+      kSTP_D_DoubleFlat, kSTP_D_Flat, kSTP_D_Natural, kSTP_D_Sharp,
+      kSTP_E_DoubleFlat, kSTP_E_Flat, kSTP_E_Natural,
+      kSTP_F_Flat, kSTP_F_Natural, kSTP_F_Sharp,
+      kSTP_G_DoubleFlat, kSTP_G_Flat, kSTP_G_Natural, kSTP_G_Sharp,
+      kSTP_A_DoubleFlat, kSTP_A_Flat, kSTP_A_Natural, kSTP_A_Sharp,
+      kSTP_B_DoubleFlat, kSTP_B_Flat, kSTP_B_Natural,
+      kSTP_C_DoubleFlat, kSTP_C_Flat, kSTP_C_Natural, kSTP_C_Sharp,
+      kSTP_D_DoubleFlat, kSTP_D_Flat, kSTP_D_Natural, kSTP_D_Sharp,
+      kSTP_E_DoubleFlat, kSTP_E_Flat, kSTP_E_Natural,
+      kSTP_F_Flat, kSTP_F_Natural, kSTP_F_Sharp,
+      kSTP_G_DoubleFlat, kSTP_G_Flat, kSTP_G_Natural, kSTP_G_Sharp
+    }},
+    // B natural
+    {{
+      kSTP_B_Flat, kSTP_B_Natural, kSTP_B_Sharp,
+      kSTP_C_Flat, kSTP_C_Natural, kSTP_C_Sharp, kSTP_C_DoubleSharp,
+      kSTP_D_Flat, kSTP_D_Natural, kSTP_D_Sharp, kSTP_D_DoubleSharp,
+      kSTP_E_Flat, kSTP_E_Natural, kSTP_E_Sharp,
+      kSTP_F_Natural, kSTP_F_Sharp, kSTP_F_DoubleSharp,
+      kSTP_G_Flat, kSTP_G_Natural, kSTP_G_Sharp, kSTP_G_DoubleSharp,
+      kSTP_A_Flat, kSTP_A_Natural, kSTP_A_Sharp, kSTP_A_DoubleSharp,
+      kSTP_B_Flat, kSTP_B_Natural, kSTP_B_Sharp,
+      kSTP_C_Flat, kSTP_C_Natural, kSTP_C_Sharp, kSTP_C_DoubleSharp,
+      kSTP_D_Flat, kSTP_D_Natural, kSTP_D_Sharp, kSTP_D_DoubleSharp,
+      kSTP_E_Flat, kSTP_E_Natural, kSTP_E_Sharp,
+      kSTP_F_Natural, kSTP_F_Sharp, kSTP_F_DoubleSharp,
+      kSTP_G_Flat, kSTP_G_Natural, kSTP_G_Sharp, kSTP_G_DoubleSharp
+    }},
+    // B sharp
+    {{
+      kSTP_B_Natural, kSTP_B_Sharp, kSTP_B_DoubleSharp,
+      kSTP_C_Natural, kSTP_C_Sharp, kSTP_C_DoubleSharp, kSTP_C_TripleSharp,
+      kSTP_D_Natural, kSTP_D_Sharp, kSTP_D_DoubleSharp, kSTP_D_TripleSharp,
+      kSTP_E_Natural, kSTP_E_Sharp, kSTP_E_DoubleSharp,
+      kSTP_F_Sharp, kSTP_F_DoubleSharp, kSTP_F_TripleSharp,
+      kSTP_G_Natural, kSTP_G_Sharp, kSTP_G_DoubleSharp, kSTP_G_TripleSharp,
+      kSTP_A_Natural, kSTP_A_Sharp, kSTP_A_DoubleSharp, kSTP_A_TripleSharp,
+      kSTP_B_Natural, kSTP_B_Sharp, kSTP_B_DoubleSharp,
+      kSTP_C_Natural, kSTP_C_Sharp, kSTP_C_DoubleSharp, kSTP_C_TripleSharp,
+      kSTP_D_Natural, kSTP_D_Sharp, kSTP_D_DoubleSharp, kSTP_D_TripleSharp,
+      kSTP_E_Natural, kSTP_E_Sharp, kSTP_E_DoubleSharp,
+      kSTP_F_Sharp, kSTP_F_DoubleSharp, kSTP_F_TripleSharp,
+      kSTP_G_Natural, kSTP_G_Sharp, kSTP_G_DoubleSharp, kSTP_G_TripleSharp
+    }}
+  }};
+}
 
-        case msrIntervalKind::kIntervalDiminishedThird:
-          result = msrSemiTonesPitchKind::kSTP_E_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorThird:
-          result = msrSemiTonesPitchKind::kSTP_E_TripleFlat;
-          break;
-        case msrIntervalKind::kIntervalMajorThird:
-          result = msrSemiTonesPitchKind::kSTP_E_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedThird:
-          result = msrSemiTonesPitchKind::kSTP_E_Natural;
-          break;
+constexpr msrQuarterTonesPitchesAtIntervalsTable createQuarterTonesPitchesAtIntervalsTable ()
+{
+  using enum msrQuarterTonesPitchKind;
+
+  return {{
+    // C flat
+    {{
+      kQTP_UNKNOWN_, kQTP_UNKNOWN_, kQTP_UNKNOWN_,
+      kQTP_UNKNOWN_, kQTP_UNKNOWN_, kQTP_UNKNOWN_, kQTP_UNKNOWN_,
+      kQTP_UNKNOWN_, kQTP_UNKNOWN_, kQTP_UNKNOWN_, kQTP_UNKNOWN_,
+      kQTP_UNKNOWN_, kQTP_UNKNOWN_, kQTP_UNKNOWN_,
+      kQTP_UNKNOWN_, kQTP_UNKNOWN_, kQTP_UNKNOWN_,
+      kQTP_UNKNOWN_, kQTP_UNKNOWN_, kQTP_UNKNOWN_, kQTP_UNKNOWN_,
+      kQTP_UNKNOWN_, kQTP_UNKNOWN_, kQTP_UNKNOWN_, kQTP_UNKNOWN_,
+      kQTP_UNKNOWN_, kQTP_UNKNOWN_, kQTP_UNKNOWN_,
+      kQTP_UNKNOWN_, kQTP_UNKNOWN_, kQTP_UNKNOWN_, kQTP_UNKNOWN_,
+      kQTP_UNKNOWN_, kQTP_UNKNOWN_, kQTP_UNKNOWN_, kQTP_UNKNOWN_,
+      kQTP_UNKNOWN_, kQTP_UNKNOWN_, kQTP_UNKNOWN_,
+      kQTP_UNKNOWN_, kQTP_UNKNOWN_, kQTP_UNKNOWN_,
+      kQTP_UNKNOWN_, kQTP_UNKNOWN_, kQTP_UNKNOWN_, kQTP_UNKNOWN_
+    }},
+    // C natural
+    {{
+      kQTP_C_Flat, kQTP_C_Natural, kQTP_C_Sharp,
+      kQTP_D_DoubleFlat, kQTP_D_Flat, kQTP_D_Natural, kQTP_D_Sharp,
+      kQTP_E_DoubleFlat, kQTP_E_Flat, kQTP_E_Natural, kQTP_E_Sharp,
+      kQTP_F_Flat, kQTP_F_Natural, kQTP_F_Sharp,
+      kQTP_G_Flat, kQTP_G_Natural, kQTP_G_Sharp,
+      kQTP_A_DoubleFlat, kQTP_A_Flat, kQTP_A_Natural, kQTP_A_Sharp,
+      kQTP_B_DoubleFlat, kQTP_B_Flat, kQTP_B_Natural, kQTP_B_Sharp,
+      kQTP_C_Flat, kQTP_C_Natural, kQTP_C_Sharp,
+      kQTP_D_DoubleFlat, kQTP_D_Flat, kQTP_D_Natural, kQTP_D_Sharp,
+      kQTP_E_DoubleFlat, kQTP_E_Flat, kQTP_E_Natural, kQTP_E_Sharp,
+      kQTP_F_Flat, kQTP_F_Natural, kQTP_F_Sharp,
+      kQTP_G_Flat, kQTP_G_Natural, kQTP_G_Sharp,
+      kQTP_A_DoubleFlat, kQTP_A_Flat, kQTP_A_Natural, kQTP_G_Sharp
+    }},
+    // C sharp
+    {{
+      kQTP_C_Natural, kQTP_C_Sharp, kQTP_C_DoubleSharp,
+      kQTP_D_Flat, kQTP_D_Natural, kQTP_D_Sharp, kQTP_D_DoubleSharp,
+      kQTP_E_Flat, kQTP_E_Natural, kQTP_E_Sharp, kQTP_E_DoubleSharp,
+      kQTP_F_Natural, kQTP_F_Sharp, kQTP_F_DoubleSharp,
+      kQTP_G_Natural, kQTP_G_Sharp, kQTP_G_DoubleSharp,
+      kQTP_A_Flat, kQTP_A_Natural, kQTP_A_Sharp, kQTP_A_DoubleSharp,
+      kQTP_B_Flat, kQTP_B_Natural, kQTP_B_Sharp, kQTP_B_DoubleSharp,
+      kQTP_C_Natural, kQTP_C_Sharp, kQTP_C_DoubleSharp,
+      kQTP_D_Flat, kQTP_D_Natural, kQTP_D_Sharp, kQTP_D_DoubleSharp,
+      kQTP_E_Flat, kQTP_E_Natural, kQTP_E_Sharp, kQTP_E_DoubleSharp,
+      kQTP_F_Natural, kQTP_F_Sharp, kQTP_F_DoubleSharp,
+      kQTP_G_Natural, kQTP_G_Sharp, kQTP_G_DoubleSharp,
+      kQTP_A_Flat, kQTP_A_Natural, kQTP_A_Sharp, kQTP_A_DoubleSharp
+    }},
+    // D flat
+    {{
+      kQTP_D_DoubleFlat, kQTP_D_Flat, kQTP_D_Natural,
+      kQTP_E_TripleFlat, kQTP_E_DoubleFlat, kQTP_E_Flat, kQTP_E_Natural,
+      kQTP_F_DoubleFlat, kQTP_F_Flat, kQTP_F_Natural, kQTP_F_Sharp,
+      kQTP_G_DoubleFlat, kQTP_G_Flat, kQTP_G_Natural,
+      kQTP_A_DoubleFlat, kQTP_A_Flat, kQTP_A_Natural,
+      kQTP_B_TripleFlat, kQTP_B_DoubleFlat, kQTP_B_Flat, kQTP_B_Natural,
+      kQTP_C_DoubleFlat, kQTP_C_Flat, kQTP_C_Natural, kQTP_C_Sharp,
+      kQTP_D_DoubleFlat, kQTP_D_Flat, kQTP_D_Natural,
+      kQTP_E_TripleFlat, kQTP_E_DoubleFlat, kQTP_E_Flat, kQTP_E_Natural,
+      kQTP_F_DoubleFlat, kQTP_F_Flat, kQTP_F_Natural, kQTP_F_Sharp,
+      kQTP_G_DoubleFlat, kQTP_G_Flat, kQTP_G_Natural,
+      kQTP_A_DoubleFlat, kQTP_A_Flat, kQTP_A_Natural,
+      kQTP_B_TripleFlat, kQTP_B_DoubleFlat, kQTP_B_Flat, kQTP_B_Natural
+    }},
+    // D natural
+    {{
+      kQTP_D_Flat, kQTP_D_Natural, kQTP_D_Sharp,
+      kQTP_E_DoubleFlat, kQTP_E_Flat, kQTP_E_Natural, kQTP_E_Sharp,
+      kQTP_F_Flat, kQTP_F_Natural, kQTP_F_Sharp, kQTP_F_DoubleSharp,
+      kQTP_G_Flat, kQTP_G_Natural, kQTP_G_Sharp,
+      kQTP_A_Flat, kQTP_A_Natural, kQTP_A_Sharp,
+      kQTP_B_DoubleFlat, kQTP_B_Flat, kQTP_B_Natural, kQTP_B_Sharp,
+      kQTP_C_Flat, kQTP_C_Natural, kQTP_C_Sharp, kQTP_C_DoubleSharp,
+      kQTP_D_Flat, kQTP_D_Natural, kQTP_D_Sharp,
+      kQTP_E_DoubleFlat, kQTP_E_Flat, kQTP_E_Natural, kQTP_E_Sharp,
+      kQTP_F_Flat, kQTP_F_Natural, kQTP_F_Sharp, kQTP_F_DoubleSharp,
+      kQTP_G_Flat, kQTP_G_Natural, kQTP_G_Sharp,
+      kQTP_A_Flat, kQTP_A_Natural, kQTP_A_Sharp,
+      kQTP_B_DoubleFlat, kQTP_B_Flat, kQTP_B_Natural, kQTP_B_Sharp
+    }},
+    // D sharp
+    {{
+      kQTP_D_Natural, kQTP_D_Sharp, kQTP_D_DoubleSharp,
+      kQTP_E_Flat, kQTP_E_Natural, kQTP_E_Sharp, kQTP_E_DoubleSharp,
+      kQTP_F_Flat, kQTP_F_Natural, kQTP_F_Sharp, kQTP_F_DoubleSharp,
+      kQTP_G_Natural, kQTP_G_Sharp, kQTP_G_DoubleSharp,
+      kQTP_A_Natural, kQTP_A_Sharp, kQTP_A_DoubleSharp,
+      kQTP_B_Flat, kQTP_B_Natural, kQTP_B_Sharp, kQTP_B_DoubleSharp,
+      kQTP_C_Natural, kQTP_C_Sharp, kQTP_C_DoubleSharp, kQTP_C_TripleSharp,
+      kQTP_D_Natural, kQTP_D_Sharp, kQTP_D_DoubleSharp,
+      kQTP_E_Flat, kQTP_E_Natural, kQTP_E_Sharp, kQTP_E_DoubleSharp,
+      kQTP_F_Natural, kQTP_F_Sharp, kQTP_F_DoubleSharp, kQTP_F_DoubleSharp,
+      kQTP_G_Natural, kQTP_G_Sharp, kQTP_G_DoubleSharp,
+      kQTP_A_Natural, kQTP_A_Sharp, kQTP_A_DoubleSharp,
+      kQTP_B_Flat, kQTP_B_Natural, kQTP_B_Sharp, kQTP_B_DoubleSharp
+    }},
+    // E flat
+    {{
+      kQTP_E_DoubleFlat, kQTP_E_Flat, kQTP_E_Natural,
+      kQTP_F_DoubleFlat, kQTP_F_Flat, kQTP_F_Natural, kQTP_F_Sharp,
+      kQTP_G_DoubleFlat, kQTP_G_Flat, kQTP_G_Natural, kQTP_G_Sharp,
+      kQTP_A_DoubleFlat, kQTP_A_Flat, kQTP_A_Natural,
+      kQTP_B_DoubleFlat, kQTP_B_Flat, kQTP_B_Natural,
+      kQTP_C_DoubleFlat, kQTP_C_Flat, kQTP_C_Natural, kQTP_C_Sharp,
+      kQTP_D_DoubleFlat, kQTP_D_Flat, kQTP_D_Natural, kQTP_D_Sharp,
+      kQTP_E_DoubleFlat, kQTP_E_Flat, kQTP_E_Natural,
+      kQTP_F_DoubleFlat, kQTP_F_Flat, kQTP_F_Natural, kQTP_F_Sharp,
+      kQTP_G_DoubleFlat, kQTP_G_Flat, kQTP_G_Natural, kQTP_G_Sharp,
+      kQTP_A_DoubleFlat, kQTP_A_Flat, kQTP_A_Natural,
+      kQTP_B_DoubleFlat, kQTP_B_Flat, kQTP_B_Natural,
+      kQTP_C_DoubleFlat, kQTP_C_Flat, kQTP_C_Natural, kQTP_C_Sharp
+    }},
+    // E natural
+    {{
+      kQTP_E_Flat, kQTP_E_Natural, kQTP_E_Sharp,
+      kQTP_F_Flat, kQTP_F_Natural, kQTP_F_Sharp, kQTP_F_DoubleSharp,
+      kQTP_G_Flat, kQTP_G_Natural, kQTP_G_Sharp, kQTP_G_DoubleSharp,
+      kQTP_A_Flat, kQTP_A_Natural, kQTP_A_Sharp,
+      kQTP_B_Natural, kQTP_B_Sharp, kQTP_B_DoubleSharp,
+      kQTP_C_Flat, kQTP_C_Natural, kQTP_C_Sharp, kQTP_C_DoubleSharp,
+      kQTP_D_Flat, kQTP_D_Natural, kQTP_D_Sharp, kQTP_D_DoubleSharp,
+      kQTP_E_Flat, kQTP_E_Natural, kQTP_E_Sharp,
+      kQTP_F_Flat, kQTP_F_Natural, kQTP_F_Sharp, kQTP_F_DoubleSharp,
+      kQTP_G_Flat, kQTP_G_Natural, kQTP_G_Sharp, kQTP_G_DoubleSharp,
+      kQTP_A_Flat, kQTP_A_Natural, kQTP_A_Sharp,
+      kQTP_B_Natural, kQTP_B_Sharp, kQTP_B_DoubleSharp,
+      kQTP_C_Flat, kQTP_C_Natural, kQTP_C_Sharp, kQTP_C_DoubleSharp
+    }},
+    // E sharp
+    {{
+      kQTP_E_Natural, kQTP_E_Sharp, kQTP_E_DoubleSharp,
+      kQTP_F_Natural, kQTP_F_Sharp, kQTP_F_DoubleSharp, kQTP_F_TripleSharp,
+      kQTP_G_Natural, kQTP_G_Sharp, kQTP_G_DoubleSharp, kQTP_G_TripleSharp,
+      kQTP_A_Natural, kQTP_A_Sharp, kQTP_A_DoubleSharp,
+      kQTP_B_Natural, kQTP_B_Sharp, kQTP_B_DoubleSharp,
+      kQTP_C_Natural, kQTP_C_Sharp, kQTP_C_DoubleSharp, kQTP_C_TripleSharp,
+      kQTP_D_Natural, kQTP_D_Sharp, kQTP_D_DoubleSharp, kQTP_D_TripleSharp,
+      kQTP_E_Natural, kQTP_E_Sharp, kQTP_E_DoubleSharp,
+      kQTP_F_Natural, kQTP_F_Sharp, kQTP_F_DoubleSharp, kQTP_F_TripleSharp,
+      kQTP_G_Natural, kQTP_G_Sharp, kQTP_G_DoubleSharp, kQTP_G_TripleSharp,
+      kQTP_A_Natural, kQTP_A_Sharp, kQTP_A_DoubleSharp,
+      kQTP_B_Natural, kQTP_B_Sharp, kQTP_B_DoubleSharp,
+      kQTP_C_Natural, kQTP_C_Sharp, kQTP_C_DoubleSharp, kQTP_C_TripleSharp
+    }},
+    // F flat
+    {{
+      kQTP_UNKNOWN_, kQTP_UNKNOWN_, kQTP_UNKNOWN_,
+      kQTP_UNKNOWN_, kQTP_UNKNOWN_, kQTP_UNKNOWN_, kQTP_UNKNOWN_,
+      kQTP_UNKNOWN_, kQTP_UNKNOWN_, kQTP_UNKNOWN_, kQTP_UNKNOWN_,
+      kQTP_UNKNOWN_, kQTP_UNKNOWN_, kQTP_UNKNOWN_,
+      kQTP_UNKNOWN_, kQTP_UNKNOWN_, kQTP_UNKNOWN_,
+      kQTP_UNKNOWN_, kQTP_UNKNOWN_, kQTP_UNKNOWN_, kQTP_UNKNOWN_,
+      kQTP_UNKNOWN_, kQTP_UNKNOWN_, kQTP_UNKNOWN_, kQTP_UNKNOWN_,
+      kQTP_UNKNOWN_, kQTP_UNKNOWN_, kQTP_UNKNOWN_,
+      kQTP_UNKNOWN_, kQTP_UNKNOWN_, kQTP_UNKNOWN_, kQTP_UNKNOWN_,
+      kQTP_UNKNOWN_, kQTP_UNKNOWN_, kQTP_UNKNOWN_, kQTP_UNKNOWN_,
+      kQTP_UNKNOWN_, kQTP_UNKNOWN_, kQTP_UNKNOWN_,
+      kQTP_UNKNOWN_, kQTP_UNKNOWN_, kQTP_UNKNOWN_,
+      kQTP_UNKNOWN_, kQTP_UNKNOWN_, kQTP_UNKNOWN_, kQTP_UNKNOWN_
+    }},
+    // F natural
+    {{
+      kQTP_F_Flat, kQTP_F_Natural, kQTP_F_Sharp,
+      kQTP_G_DoubleFlat, kQTP_G_Flat, kQTP_G_Natural, kQTP_G_Sharp,
+      kQTP_A_DoubleFlat, kQTP_A_Flat, kQTP_A_Natural, kQTP_A_Sharp,
+      kQTP_B_DoubleFlat, kQTP_B_Flat, kQTP_B_Natural,
+      kQTP_C_Flat, kQTP_C_Natural, kQTP_C_Sharp,
+      kQTP_D_DoubleFlat, kQTP_D_Flat, kQTP_D_Natural, kQTP_D_Sharp,
+      kQTP_E_DoubleFlat, kQTP_E_Flat, kQTP_E_Natural, kQTP_E_Sharp,
+      kQTP_F_Flat, kQTP_F_Natural, kQTP_F_Sharp,
+      kQTP_G_DoubleFlat, kQTP_G_Flat, kQTP_G_Natural, kQTP_G_Sharp,
+      kQTP_A_DoubleFlat, kQTP_A_Flat, kQTP_A_Natural, kQTP_A_Sharp,
+      kQTP_B_DoubleFlat, kQTP_B_Flat, kQTP_B_Natural,
+      kQTP_C_Flat, kQTP_C_Natural, kQTP_C_Sharp,
+      kQTP_D_DoubleFlat, kQTP_D_Flat, kQTP_D_Natural, kQTP_D_Sharp
+    }},
+    // F sharp
+    {{
+      kQTP_F_Natural, kQTP_F_Sharp, kQTP_F_DoubleSharp,
+      kQTP_G_Flat, kQTP_G_Natural, kQTP_G_Sharp, kQTP_G_DoubleSharp,
+      kQTP_A_Flat, kQTP_A_Natural, kQTP_A_Sharp, kQTP_A_DoubleSharp,
+      kQTP_B_Sharp, kQTP_B_DoubleSharp, kQTP_B_TripleSharp,
+      kQTP_C_Natural, kQTP_C_Sharp, kQTP_C_DoubleSharp,
+      kQTP_D_Flat, kQTP_D_Natural, kQTP_D_Sharp, kQTP_D_DoubleSharp,
+      kQTP_E_Flat, kQTP_E_Natural, kQTP_E_Sharp, kQTP_E_DoubleSharp,
+      kQTP_F_Natural, kQTP_F_Sharp, kQTP_F_DoubleSharp,
+      kQTP_G_Flat, kQTP_G_Natural, kQTP_G_Sharp, kQTP_G_DoubleSharp,
+      kQTP_A_Natural, kQTP_A_Natural, kQTP_A_Sharp, kQTP_A_DoubleSharp,
+      kQTP_B_Sharp, kQTP_B_DoubleSharp, kQTP_B_TripleSharp,
+      kQTP_C_Natural, kQTP_C_Sharp, kQTP_C_DoubleSharp,
+      kQTP_E_Flat, kQTP_D_Natural, kQTP_D_Sharp, kQTP_D_DoubleSharp
+    }},
+    // G flat
+    {{
+      kQTP_G_DoubleFlat, kQTP_G_Flat, kQTP_G_Natural,
+      kQTP_A_TripleFlat, kQTP_A_DoubleFlat, kQTP_A_Flat, kQTP_A_Natural,
+      kQTP_B_TripleFlat, kQTP_B_DoubleFlat, kQTP_B_Flat, kQTP_B_Natural,
+      kQTP_C_DoubleFlat, kQTP_C_Flat, kQTP_C_Natural,
+      kQTP_D_DoubleFlat, kQTP_D_Flat, kQTP_D_Natural,
+      kQTP_E_TripleFlat, kQTP_E_DoubleFlat, kQTP_E_Flat, kQTP_E_Natural,
+      kQTP_F_DoubleFlat, kQTP_F_Flat, kQTP_F_Natural, kQTP_F_Sharp,
+      kQTP_G_DoubleFlat, kQTP_G_Flat, kQTP_G_Natural,
+      kQTP_A_TripleFlat, kQTP_A_DoubleFlat, kQTP_A_Flat, kQTP_A_Natural,
+      kQTP_B_TripleFlat, kQTP_B_DoubleFlat, kQTP_B_Flat, kQTP_B_Natural,
+      kQTP_C_DoubleFlat, kQTP_C_Flat, kQTP_C_Natural,
+      kQTP_D_DoubleFlat, kQTP_D_Flat, kQTP_D_Natural,
+      kQTP_E_TripleFlat, kQTP_E_DoubleFlat, kQTP_E_Flat, kQTP_E_Natural
+    }},
+    // G natural
+    {{
+      kQTP_G_Flat, kQTP_G_Natural, kQTP_G_Sharp,
+      kQTP_A_DoubleFlat, kQTP_A_Flat, kQTP_A_Natural, kQTP_A_Sharp,
+      kQTP_B_DoubleFlat, kQTP_B_Flat, kQTP_B_Natural, kQTP_B_Sharp,
+      kQTP_C_Flat, kQTP_C_Natural, kQTP_C_Sharp,
+      kQTP_D_Flat, kQTP_D_Natural, kQTP_D_Sharp,
+      kQTP_E_DoubleFlat, kQTP_E_Flat, kQTP_E_Natural, kQTP_E_Sharp,
+      kQTP_F_Flat, kQTP_F_Natural, kQTP_F_Sharp, kQTP_F_DoubleSharp,
+      kQTP_G_Flat, kQTP_G_Natural, kQTP_G_Sharp,
+      kQTP_A_DoubleFlat, kQTP_A_Flat, kQTP_A_Natural, kQTP_A_Sharp,
+      kQTP_B_DoubleFlat, kQTP_B_Flat, kQTP_B_Natural, kQTP_B_Sharp,
+      kQTP_C_Flat, kQTP_C_Natural, kQTP_C_Sharp,
+      kQTP_D_Flat, kQTP_D_Natural, kQTP_D_Sharp,
+      kQTP_E_DoubleFlat, kQTP_E_Flat, kQTP_E_Natural, kQTP_E_Sharp
+    }},
+    // G sharp
+    {{
+      kQTP_G_Natural, kQTP_G_Sharp, kQTP_G_DoubleSharp,
+      kQTP_A_Flat, kQTP_A_Natural, kQTP_A_Sharp, kQTP_A_DoubleSharp,
+      kQTP_B_Flat, kQTP_B_Natural, kQTP_B_Sharp, kQTP_B_DoubleSharp,
+      kQTP_C_Natural, kQTP_C_Sharp, kQTP_C_DoubleSharp,
+      kQTP_D_Natural, kQTP_D_Sharp, kQTP_D_DoubleSharp,
+      kQTP_E_Flat, kQTP_E_Natural, kQTP_E_Sharp, kQTP_E_DoubleSharp,
+      kQTP_F_Natural, kQTP_F_Sharp, kQTP_F_DoubleSharp, kQTP_F_TripleSharp,
+      kQTP_G_Natural, kQTP_G_Sharp, kQTP_G_DoubleSharp,
+      kQTP_A_Flat, kQTP_A_Natural, kQTP_A_Sharp, kQTP_A_DoubleSharp,
+      kQTP_B_Flat, kQTP_B_Natural, kQTP_B_Sharp, kQTP_B_DoubleSharp,
+      kQTP_C_Natural, kQTP_C_Sharp, kQTP_C_DoubleSharp,
+      kQTP_D_Natural, kQTP_D_Sharp, kQTP_D_DoubleSharp,
+      kQTP_E_Flat, kQTP_E_Natural, kQTP_E_Sharp, kQTP_E_DoubleSharp
+    }},
+    // A flat
+    {{
+      kQTP_A_DoubleFlat, kQTP_A_Flat, kQTP_A_Natural,
+      kQTP_B_TripleFlat, kQTP_B_DoubleFlat, kQTP_B_Flat, kQTP_B_Natural,
+      kQTP_C_DoubleFlat, kQTP_C_Flat, kQTP_C_Natural, kQTP_C_Sharp,
+      kQTP_D_DoubleFlat, kQTP_D_Flat, kQTP_D_Natural,
+      kQTP_E_DoubleFlat, kQTP_E_Flat, kQTP_E_Natural,
+      kQTP_F_DoubleFlat, kQTP_F_Flat, kQTP_F_Natural, kQTP_F_Sharp,
+      kQTP_G_DoubleFlat, kQTP_G_Flat, kQTP_G_Natural, kQTP_G_Sharp,
+      kQTP_A_DoubleFlat, kQTP_A_Flat, kQTP_A_Natural,
+      kQTP_B_TripleFlat, kQTP_B_DoubleFlat, kQTP_B_Flat, kQTP_B_Natural,
+      kQTP_C_DoubleFlat, kQTP_C_Flat, kQTP_C_Natural, kQTP_C_Sharp,
+      kQTP_D_DoubleFlat, kQTP_D_Flat, kQTP_D_Natural,
+      kQTP_E_DoubleFlat, kQTP_E_Flat, kQTP_E_Natural,
+      kQTP_F_TripleFlat, kQTP_F_DoubleFlat, kQTP_F_Flat, kQTP_F_Natural
+    }},
+    // A natural
+    {{
+      kQTP_A_Flat, kQTP_A_Natural, kQTP_A_Sharp,
+      kQTP_B_DoubleFlat, kQTP_B_Flat, kQTP_B_Natural, kQTP_B_Sharp,
+      kQTP_C_Flat, kQTP_C_Natural, kQTP_C_Sharp, kQTP_C_DoubleSharp,
+      kQTP_D_Flat, kQTP_D_Natural, kQTP_D_Sharp,
+      kQTP_E_Flat, kQTP_E_Natural, kQTP_E_Sharp,
+      kQTP_F_Flat, kQTP_F_Natural, kQTP_F_Sharp, kQTP_F_DoubleSharp,
+      kQTP_G_Flat, kQTP_G_Natural, kQTP_G_Sharp, kQTP_G_DoubleSharp,
+      kQTP_A_Flat, kQTP_A_Natural, kQTP_A_Sharp,
+      kQTP_B_DoubleFlat, kQTP_B_Flat, kQTP_B_Natural, kQTP_B_Sharp,
+      kQTP_C_Flat, kQTP_C_Natural, kQTP_C_Sharp, kQTP_C_DoubleSharp,
+      kQTP_D_Flat, kQTP_D_Natural, kQTP_D_Sharp,
+      kQTP_E_Flat, kQTP_E_Natural, kQTP_E_Sharp,
+      kQTP_F_Flat, kQTP_F_Natural, kQTP_F_Sharp, kQTP_F_DoubleSharp
+    }},
+    // A sharp
+    {{
+      kQTP_UNKNOWN_, kQTP_UNKNOWN_, kQTP_UNKNOWN_,
+      kQTP_UNKNOWN_, kQTP_UNKNOWN_, kQTP_UNKNOWN_, kQTP_UNKNOWN_,
+      kQTP_UNKNOWN_, kQTP_UNKNOWN_, kQTP_UNKNOWN_, kQTP_UNKNOWN_,
+      kQTP_UNKNOWN_, kQTP_UNKNOWN_, kQTP_UNKNOWN_,
+      kQTP_UNKNOWN_, kQTP_UNKNOWN_, kQTP_UNKNOWN_,
+      kQTP_UNKNOWN_, kQTP_UNKNOWN_, kQTP_UNKNOWN_, kQTP_UNKNOWN_,
+      kQTP_UNKNOWN_, kQTP_UNKNOWN_, kQTP_UNKNOWN_, kQTP_UNKNOWN_,
+      kQTP_UNKNOWN_, kQTP_UNKNOWN_, kQTP_UNKNOWN_,
+      kQTP_UNKNOWN_, kQTP_UNKNOWN_, kQTP_UNKNOWN_, kQTP_UNKNOWN_,
+      kQTP_UNKNOWN_, kQTP_UNKNOWN_, kQTP_UNKNOWN_, kQTP_UNKNOWN_,
+      kQTP_UNKNOWN_, kQTP_UNKNOWN_, kQTP_UNKNOWN_,
+      kQTP_UNKNOWN_, kQTP_UNKNOWN_, kQTP_UNKNOWN_,
+      kQTP_UNKNOWN_, kQTP_UNKNOWN_, kQTP_UNKNOWN_, kQTP_UNKNOWN_
+    }},
+    // B flat
+    {{
+      kQTP_B_DoubleFlat, kQTP_B_Flat, kQTP_B_Natural,
+      kQTP_C_DoubleFlat, kQTP_C_Flat, kQTP_C_Natural, kQTP_C_Sharp,
+      kQTP_D_DoubleFlat, kQTP_D_Flat, kQTP_D_Natural, kQTP_D_Sharp,
+      kQTP_E_DoubleFlat, kQTP_E_Flat, kQTP_E_Natural,
+      kQTP_F_Flat, kQTP_F_Natural, kQTP_F_Sharp,
+      kQTP_G_DoubleFlat, kQTP_G_Flat, kQTP_G_Natural, kQTP_G_Sharp,
+      kQTP_A_DoubleFlat, kQTP_A_Flat, kQTP_A_Natural, kQTP_A_Sharp,
+      kQTP_B_DoubleFlat, kQTP_B_Flat, kQTP_B_Natural,
+      kQTP_C_DoubleFlat, kQTP_C_Flat, kQTP_C_Natural, kQTP_C_Sharp,
+      kQTP_D_DoubleFlat, kQTP_D_Flat, kQTP_D_Natural, kQTP_D_Sharp,
+      kQTP_E_DoubleFlat, kQTP_E_Flat, kQTP_E_Natural,
+      kQTP_F_Flat, kQTP_F_Natural, kQTP_F_Sharp,
+      kQTP_G_DoubleFlat, kQTP_G_Flat, kQTP_G_Natural, kQTP_G_Sharp
+    }},
+    // B natural
+    {{
+      kQTP_B_Flat, kQTP_B_Natural, kQTP_B_Sharp,
+      kQTP_C_Flat, kQTP_C_Natural, kQTP_C_Sharp, kQTP_C_DoubleSharp,
+      kQTP_D_Flat, kQTP_D_Natural, kQTP_D_Sharp, kQTP_D_DoubleSharp,
+      kQTP_E_Flat, kQTP_E_Natural, kQTP_E_Sharp,
+      kQTP_F_Natural, kQTP_F_Sharp, kQTP_F_DoubleSharp,
+      kQTP_G_Flat, kQTP_G_Natural, kQTP_G_Sharp, kQTP_G_DoubleSharp,
+      kQTP_A_Flat, kQTP_A_Natural, kQTP_A_Sharp, kQTP_A_DoubleSharp,
+      kQTP_B_Flat, kQTP_B_Natural, kQTP_B_Sharp,
+      kQTP_C_Flat, kQTP_C_Natural, kQTP_C_Sharp, kQTP_C_DoubleSharp,
+      kQTP_D_Flat, kQTP_D_Natural, kQTP_D_Sharp, kQTP_D_DoubleSharp,
+      kQTP_E_Flat, kQTP_E_Natural, kQTP_E_Sharp,
+      kQTP_F_Natural, kQTP_F_Sharp, kQTP_F_DoubleSharp,
+      kQTP_G_Flat, kQTP_G_Natural, kQTP_G_Sharp, kQTP_G_DoubleSharp
+    }},
+    // B sharp
+    {{
+      kQTP_B_Natural, kQTP_B_Sharp, kQTP_B_DoubleSharp,
+      kQTP_C_Natural, kQTP_C_Sharp, kQTP_C_DoubleSharp, kQTP_C_TripleSharp,
+      kQTP_D_Natural, kQTP_D_Sharp, kQTP_D_DoubleSharp, kQTP_D_TripleSharp,
+      kQTP_E_Natural, kQTP_E_Sharp, kQTP_E_DoubleSharp,
+      kQTP_F_Sharp, kQTP_F_DoubleSharp, kQTP_F_TripleSharp,
+      kQTP_G_Natural, kQTP_G_Sharp, kQTP_G_DoubleSharp, kQTP_G_TripleSharp,
+      kQTP_A_Natural, kQTP_A_Sharp, kQTP_A_DoubleSharp, kQTP_A_TripleSharp,
+      kQTP_B_Natural, kQTP_B_Sharp, kQTP_B_DoubleSharp,
+      kQTP_C_Natural, kQTP_C_Sharp, kQTP_C_DoubleSharp, kQTP_C_TripleSharp,
+      kQTP_D_Natural, kQTP_D_Sharp, kQTP_D_DoubleSharp, kQTP_D_TripleSharp,
+      kQTP_E_Natural, kQTP_E_Sharp, kQTP_E_DoubleSharp,
+      kQTP_F_Sharp, kQTP_F_DoubleSharp, kQTP_F_TripleSharp,
+      kQTP_G_Natural, kQTP_G_Sharp, kQTP_G_DoubleSharp, kQTP_G_TripleSharp
+    }}
+  }};
+}
 
-        case msrIntervalKind::kIntervalDiminishedFourth:
-          result = msrSemiTonesPitchKind::kSTP_F_DoubleleFlat;
-          break;
-        case msrIntervalKind::kIntervalPerfectFourth:
-          result = msrSemiTonesPitchKind::kSTP_F_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedFourth:
-          result = msrSemiTonesPitchKind::kSTP_F_Natural;
-          break;
+constexpr msrSemiTonesPitchesAtIntervalsTable
+  kSemiTonesPitchesAtIntervalsTable =
+    createSemiTonesPitchesAtIntervalsTable ();
 
-        case msrIntervalKind::kIntervalDiminishedFifth:
-          result = msrSemiTonesPitchKind::kSTP_G_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalPerfectFifth:
-          result = msrSemiTonesPitchKind::kSTP_G_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedFifth:
-          result = msrSemiTonesPitchKind::kSTP_G_Natural;
-          break;
+constexpr msrQuarterTonesPitchesAtIntervalsTable
+  kQuarterTonesPitchesAtIntervalsTable =
+    createQuarterTonesPitchesAtIntervalsTable ();
 
-        case msrIntervalKind::kIntervalDiminishedSixth:
-          result = msrSemiTonesPitchKind::kSTP_A_TripleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorSixth:
-          result = msrSemiTonesPitchKind::kSTP_A_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMajorSixth:
-          result = msrSemiTonesPitchKind::kSTP_A_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSixth:
-          result = msrSemiTonesPitchKind::kSTP_A_Natural;
-          break;
+// the row of a pitch in the tables above, -1 if it is not supported
+constexpr int semiTonesPitchAtIntervalsRow (
+  msrSemiTonesPitchKind semiTonesPitchKind)
+{
+  // 7 semitones pitches per diatonic pitch, from C to B
+  int
+    offset =
+      int (semiTonesPitchKind) - int (msrSemiTonesPitchKind::kSTP_C_TripleFlat),
+    alteration =
+      offset % 7 - 2; // from flat to sharp
 
-        case msrIntervalKind::kIntervalDiminishedSeventh:
-          result = msrSemiTonesPitchKind::kSTP_B_TripleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorSeventh:
-          result = msrSemiTonesPitchKind::kSTP_B_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMajorSeventh:
-          result = msrSemiTonesPitchKind::kSTP_B_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSeventh:
-          result = msrSemiTonesPitchKind::kSTP_B_Natural;
-          break;
+  return
+    offset >= 0 && alteration >= 0 && alteration <= 2
+      ? (offset / 7) * 3 + alteration
+      : -1;
+}
 
-        case msrIntervalKind::kIntervalDiminishedOctave:
-          result = msrSemiTonesPitchKind::kSTP_C_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalPerfectOctave:
-          result = msrSemiTonesPitchKind::kSTP_C_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedOctave:
-          result = msrSemiTonesPitchKind::kSTP_C_Natural;
-          break;
+constexpr int quarterTonesPitchAtIntervalsRow (
+  msrQuarterTonesPitchKind quarterTonesPitchKind)
+{
+  // 11 quarter tones pitches per diatonic pitch, from A to G
+  int
+    offset =
+      int (quarterTonesPitchKind) - int (msrQuarterTonesPitchKind::kQTP_A_TripleFlat),
+    alteration =
+      offset % 11 - 3; // flat, semi flat, natural, semi sharp, sharp
 
-        case msrIntervalKind::kIntervalDiminishedNinth:
-          result = msrSemiTonesPitchKind::kSTP_D_TripleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorNinth:
-          result = msrSemiTonesPitchKind::kSTP_D_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMajorNinth:
-          result = msrSemiTonesPitchKind::kSTP_D_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedNinth:
-          result = msrSemiTonesPitchKind::kSTP_D_Natural;
-          break;
+  return
+    offset >= 0 && alteration >= 0 && alteration <= 4 && alteration % 2 == 0
+      ? ((offset / 11 + 5) % 7) * 3 + alteration / 2 // C comes first
+      : -1;
+}
 
-        case msrIntervalKind::kIntervalDiminishedTenth:
-          result = msrSemiTonesPitchKind::kSTP_E_TripleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorTenth:
-          result = msrSemiTonesPitchKind::kSTP_E_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMajorTenth:
-          result = msrSemiTonesPitchKind::kSTP_E_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedTenth:
-          result = msrSemiTonesPitchKind::kSTP_E_Natural;
-          break;
+static_assert (
+  kSemiTonesPitchesAtIntervalsTable
+    [semiTonesPitchAtIntervalsRow (msrSemiTonesPitchKind::kSTP_B_Sharp)]
+    [size_t (msrIntervalKind::kIntervalPerfectUnisson) - 1]
+    ==
+  msrSemiTonesPitchKind::kSTP_B_Sharp
+    &&
+  kQuarterTonesPitchesAtIntervalsTable
+    [quarterTonesPitchAtIntervalsRow (msrQuarterTonesPitchKind::kQTP_B_Sharp)]
+    [size_t (msrIntervalKind::kIntervalPerfectUnisson) - 1]
+    ==
+  msrQuarterTonesPitchKind::kQTP_B_Sharp,
+  "the notes at intervals tables rows should be in pitches order");
+
+static_assert (
+  semiTonesPitchAtIntervalsRow (msrSemiTonesPitchKind::kSTP_C_DoubleSharp) == -1
+    &&
+  quarterTonesPitchAtIntervalsRow (msrQuarterTonesPitchKind::kQTP_C_SemiSharp) == -1
+    &&
+  quarterTonesPitchAtIntervalsRow (msrQuarterTonesPitchKind::kQTP_Skip) == -1,
+  "the notes at intervals tables should only have rows for flat, natural and sharp pitches");
 
-        case msrIntervalKind::kIntervalDiminishedEleventh:
-          result = msrSemiTonesPitchKind::kSTP_F_DoubleleFlat;
-          break;
-        case msrIntervalKind::kIntervalPerfectEleventh:
-          result = msrSemiTonesPitchKind::kSTP_F_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedEleventh:
-          result = msrSemiTonesPitchKind::kSTP_F_Natural;
-          break;
+msrSemiTonesPitchKind noteAtIntervalFromSemiTonesPitch (
+  const mfInputLineNumber& inputLineNumber,
+  msrIntervalKind       intervalKind,
+  msrSemiTonesPitchKind semiTonesPitchKind)
+{
+  if (semiTonesPitchKind == msrSemiTonesPitchKind::kSTP_NoSemiTonesPitch) {
+    return msrSemiTonesPitchKind::kSTP_NoSemiTonesPitch;
+  }
 
-        case msrIntervalKind::kIntervalDiminishedTwelfth:
-          result = msrSemiTonesPitchKind::kSTP_G_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalPerfectTwelfth:
-          result = msrSemiTonesPitchKind::kSTP_G_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedTwelfth:
-          result = msrSemiTonesPitchKind::kSTP_G_Natural;
-          break;
+  int
+    row =
+      semiTonesPitchAtIntervalsRow (semiTonesPitchKind);
 
-        case msrIntervalKind::kIntervalDiminishedThirteenth:
-          result = msrSemiTonesPitchKind::kSTP_A_TripleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorThirteenth:
-          result = msrSemiTonesPitchKind::kSTP_A_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMajorThirteenth:
-          result = msrSemiTonesPitchKind::kSTP_A_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedThirteenth:
-          result = msrSemiTonesPitchKind::kSTP_A_Natural;
-          break;
-      } // switch
-      break;
+  if (row < 0) {
+    std::stringstream ss;
 
-    case msrSemiTonesPitchKind::kSTP_C_Natural:
-      switch (intervalKind) {
-        case msrIntervalKind::kInterval_UNKNOWN_:
-          break;
+    ss <<
+      "Sorry, computing intervals from semitones pitch '" <<
+      msrSemiTonesPitchKindAsString (semiTonesPitchKind) <<
+      '(' << msrSemiTonesPitchKindAsString (semiTonesPitchKind) << ")" <<
+      "' is not supported"
+      ", line: " << inputLineNumber;
 
-        case msrIntervalKind::kIntervalDiminishedUnisson:
-          result = msrSemiTonesPitchKind::kSTP_C_Flat;
-          break;
-        case msrIntervalKind::kIntervalPerfectUnisson:
-          result = msrSemiTonesPitchKind::kSTP_C_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedUnisson:
-          result = msrSemiTonesPitchKind::kSTP_C_Sharp;
-          break;
+    msrUnsupported (
+      gServiceRunData->getInputSourceName (),
+      inputLineNumber,
+      __FILE__, mfInputLineNumber (__LINE__),
+      ss.str ());
 
-        case msrIntervalKind::kIntervalDiminishedSecond:
-          result = msrSemiTonesPitchKind::kSTP_D_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorSecond:
-          result = msrSemiTonesPitchKind::kSTP_D_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorSecond:
-          result = msrSemiTonesPitchKind::kSTP_D_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSecond:
-          result = msrSemiTonesPitchKind::kSTP_D_Sharp;
-          break;
+    return msrSemiTonesPitchKind::kSTP_NoSemiTonesPitch;
+  }
 
-        case msrIntervalKind::kIntervalDiminishedThird:
-          result = msrSemiTonesPitchKind::kSTP_E_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorThird:
-          result = msrSemiTonesPitchKind::kSTP_E_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorThird:
-          result = msrSemiTonesPitchKind::kSTP_E_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedThird:
-          result = msrSemiTonesPitchKind::kSTP_E_Sharp;
-          break;
+  if (intervalKind == msrIntervalKind::kInterval_UNKNOWN_) {
+    return msrSemiTonesPitchKind::kSTP_NoSemiTonesPitch;
+  }
 
-        case msrIntervalKind::kIntervalDiminishedFourth:
-          result = msrSemiTonesPitchKind::kSTP_F_Flat;
-          break;
-        case msrIntervalKind::kIntervalPerfectFourth:
-          result = msrSemiTonesPitchKind::kSTP_F_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedFourth:
-          result = msrSemiTonesPitchKind::kSTP_F_Sharp;
-          break;
+  return
+    kSemiTonesPitchesAtIntervalsTable [row] [size_t (intervalKind) - 1];
+}
 
-        case msrIntervalKind::kIntervalDiminishedFifth:
-          result = msrSemiTonesPitchKind::kSTP_G_Flat;
-          break;
-        case msrIntervalKind::kIntervalPerfectFifth:
-          result = msrSemiTonesPitchKind::kSTP_G_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedFifth:
-          result = msrSemiTonesPitchKind::kSTP_G_Sharp;
-          break;
+msrQuarterTonesPitchKind noteAtIntervalFromQuarterTonesPitch (
+  const mfInputLineNumber& inputLineNumber,
+  msrIntervalKind          intervalKind,
+  msrQuarterTonesPitchKind quarterTonesPitchKind)
+{
+  if (quarterTonesPitchKind == msrQuarterTonesPitchKind::kQTP_UNKNOWN_) {
+    return msrQuarterTonesPitchKind::kQTP_UNKNOWN_;
+  }
 
-        case msrIntervalKind::kIntervalDiminishedSixth:
-          result = msrSemiTonesPitchKind::kSTP_A_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorSixth:
-          result = msrSemiTonesPitchKind::kSTP_A_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorSixth:
-          result = msrSemiTonesPitchKind::kSTP_A_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSixth:
-          result = msrSemiTonesPitchKind::kSTP_A_Sharp;
-          break;
+  int
+    row =
+      quarterTonesPitchAtIntervalsRow (quarterTonesPitchKind);
+
+  if (row < 0) {
+    std::stringstream ss;
+
+    ss <<
+      "Sorry, computing intervals from quartertones pitch '" <<
+      msrQuarterTonesPitchKindAsStringInLanguage (
+        quarterTonesPitchKind,
+        gMsrOahGroup->
+          getMsrQuarterTonesPitchesLanguageKind ()) <<
+      '(' << msrQuarterTonesPitchKindAsString (quarterTonesPitchKind) << ")" <<
+      "' is not supported"
+      ", line: " << inputLineNumber;
+
+    msrUnsupported (
+      gServiceRunData->getInputSourceName (),
+      inputLineNumber,
+      __FILE__, mfInputLineNumber (__LINE__),
+      ss.str ());
+
+    return msrQuarterTonesPitchKind::kQTP_UNKNOWN_;
+  }
 
-        case msrIntervalKind::kIntervalDiminishedSeventh:
-          result = msrSemiTonesPitchKind::kSTP_B_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorSeventh:
-          result = msrSemiTonesPitchKind::kSTP_B_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorSeventh:
-          result = msrSemiTonesPitchKind::kSTP_B_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSeventh:
-          result = msrSemiTonesPitchKind::kSTP_B_Sharp;
-          break;
+  if (intervalKind == msrIntervalKind::kInterval_UNKNOWN_) {
+    return msrQuarterTonesPitchKind::kQTP_UNKNOWN_;
+  }
 
-        case msrIntervalKind::kIntervalDiminishedOctave:
-          result = msrSemiTonesPitchKind::kSTP_C_Flat;
-          break;
-        case msrIntervalKind::kIntervalPerfectOctave:
-          result = msrSemiTonesPitchKind::kSTP_C_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedOctave:
-          result = msrSemiTonesPitchKind::kSTP_C_Sharp;
-          break;
+  return
+    kQuarterTonesPitchesAtIntervalsTable [row] [size_t (intervalKind) - 1];
+}
 
-        case msrIntervalKind::kIntervalDiminishedNinth:
-          result = msrSemiTonesPitchKind::kSTP_D_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorNinth:
-          result = msrSemiTonesPitchKind::kSTP_D_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorNinth:
-          result = msrSemiTonesPitchKind::kSTP_D_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedNinth:
-          result = msrSemiTonesPitchKind::kSTP_D_Sharp;
-          break;
+msrIntervalKind intervalBetweenSemiTonesPitches (
+  msrSemiTonesPitchKind semiTonesPitch1,
+  msrSemiTonesPitchKind semiTonesPitch2)
+{
+  msrIntervalKind result = msrIntervalKind::kInterval_UNKNOWN_;
 
-        case msrIntervalKind::kIntervalDiminishedTenth:
-          result = msrSemiTonesPitchKind::kSTP_E_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorTenth:
-          result = msrSemiTonesPitchKind::kSTP_E_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorTenth:
-          result = msrSemiTonesPitchKind::kSTP_E_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedTenth:
-          result = msrSemiTonesPitchKind::kSTP_E_Sharp;
-          break;
+  // order the semitones pitches so that
+  // workSemiTonesPitch1 is less or equal to workSemiTonesPitch2
+  // according to the enum class type, i.e. from C to B
+  msrSemiTonesPitchKind
+    workSemiTonesPitch1 = semiTonesPitch1,
+    workSemiTonesPitch2 = semiTonesPitch2;
 
-        case msrIntervalKind::kIntervalDiminishedEleventh:
-          result = msrSemiTonesPitchKind::kSTP_F_Flat;
-          break;
-        case msrIntervalKind::kIntervalPerfectEleventh:
-          result = msrSemiTonesPitchKind::kSTP_F_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedEleventh:
-          result = msrSemiTonesPitchKind::kSTP_F_Sharp;
-          break;
+  Bool invertInterval (false);
 
-        case msrIntervalKind::kIntervalDiminishedTwelfth:
-          result = msrSemiTonesPitchKind::kSTP_G_Flat;
-          break;
-        case msrIntervalKind::kIntervalPerfectTwelfth:
-          result = msrSemiTonesPitchKind::kSTP_G_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedTwelfth:
-          result = msrSemiTonesPitchKind::kSTP_G_Sharp;
-          break;
+  if (semiTonesPitch1 > semiTonesPitch2) {
+    workSemiTonesPitch1 = semiTonesPitch2;
+    workSemiTonesPitch2 = semiTonesPitch1;
 
-        case msrIntervalKind::kIntervalDiminishedThirteenth:
-          result = msrSemiTonesPitchKind::kSTP_A_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorThirteenth:
-          result = msrSemiTonesPitchKind::kSTP_A_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorThirteenth:
-          result = msrSemiTonesPitchKind::kSTP_A_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedThirteenth:
-          result = msrSemiTonesPitchKind::kSTP_G_Sharp;
-          break;
-      } // switch
-      break;
+    invertInterval = true;
+  }
 
-    case msrSemiTonesPitchKind::kSTP_C_Sharp:
-      switch (intervalKind) {
-        case msrIntervalKind::kInterval_UNKNOWN_:
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedUnisson:
-          result = msrSemiTonesPitchKind::kSTP_C_Natural;
-          break;
-        case msrIntervalKind::kIntervalPerfectUnisson:
-          result = msrSemiTonesPitchKind::kSTP_C_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedUnisson:
-          result = msrSemiTonesPitchKind::kSTP_C_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSecond:
-          result = msrSemiTonesPitchKind::kSTP_D_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorSecond:
-          result = msrSemiTonesPitchKind::kSTP_D_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorSecond:
-          result = msrSemiTonesPitchKind::kSTP_D_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSecond:
-          result = msrSemiTonesPitchKind::kSTP_D_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedThird:
-          result = msrSemiTonesPitchKind::kSTP_E_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorThird:
-          result = msrSemiTonesPitchKind::kSTP_E_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorThird:
-          result = msrSemiTonesPitchKind::kSTP_E_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedThird:
-          result = msrSemiTonesPitchKind::kSTP_E_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedFourth:
-          result = msrSemiTonesPitchKind::kSTP_F_Natural;
-          break;
-        case msrIntervalKind::kIntervalPerfectFourth:
-          result = msrSemiTonesPitchKind::kSTP_F_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedFourth:
-          result = msrSemiTonesPitchKind::kSTP_F_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedFifth:
-          result = msrSemiTonesPitchKind::kSTP_G_Natural;
-          break;
-        case msrIntervalKind::kIntervalPerfectFifth:
-          result = msrSemiTonesPitchKind::kSTP_G_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedFifth:
-          result = msrSemiTonesPitchKind::kSTP_G_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSixth:
-          result = msrSemiTonesPitchKind::kSTP_A_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorSixth:
-          result = msrSemiTonesPitchKind::kSTP_A_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorSixth:
-          result = msrSemiTonesPitchKind::kSTP_A_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSixth:
-          result = msrSemiTonesPitchKind::kSTP_A_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSeventh:
-          result = msrSemiTonesPitchKind::kSTP_B_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorSeventh:
-          result = msrSemiTonesPitchKind::kSTP_B_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorSeventh:
-          result = msrSemiTonesPitchKind::kSTP_B_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSeventh:
-          result = msrSemiTonesPitchKind::kSTP_B_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedOctave:
-          result = msrSemiTonesPitchKind::kSTP_C_Natural;
-          break;
-        case msrIntervalKind::kIntervalPerfectOctave:
-          result = msrSemiTonesPitchKind::kSTP_C_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedOctave:
-          result = msrSemiTonesPitchKind::kSTP_C_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedNinth:
-          result = msrSemiTonesPitchKind::kSTP_D_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorNinth:
-          result = msrSemiTonesPitchKind::kSTP_D_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorNinth:
-          result = msrSemiTonesPitchKind::kSTP_D_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedNinth:
-          result = msrSemiTonesPitchKind::kSTP_D_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedTenth:
-          result = msrSemiTonesPitchKind::kSTP_E_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorTenth:
-          result = msrSemiTonesPitchKind::kSTP_E_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorTenth:
-          result = msrSemiTonesPitchKind::kSTP_E_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedTenth:
-          result = msrSemiTonesPitchKind::kSTP_E_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedEleventh:
-          result = msrSemiTonesPitchKind::kSTP_F_Natural;
-          break;
-        case msrIntervalKind::kIntervalPerfectEleventh:
-          result = msrSemiTonesPitchKind::kSTP_F_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedEleventh:
-          result = msrSemiTonesPitchKind::kSTP_F_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedTwelfth:
-          result = msrSemiTonesPitchKind::kSTP_G_Natural;
-          break;
-        case msrIntervalKind::kIntervalPerfectTwelfth:
-          result = msrSemiTonesPitchKind::kSTP_G_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedTwelfth:
-          result = msrSemiTonesPitchKind::kSTP_G_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedThirteenth:
-          result = msrSemiTonesPitchKind::kSTP_A_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorThirteenth:
-          result = msrSemiTonesPitchKind::kSTP_A_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorThirteenth:
-          result = msrSemiTonesPitchKind::kSTP_A_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedThirteenth:
-          result = msrSemiTonesPitchKind::kSTP_A_DoubleSharp;
-          break;
-      } // switch
-      break;
-
-    case msrSemiTonesPitchKind::kSTP_D_Flat:
-      switch (intervalKind) {
-        case msrIntervalKind::kInterval_UNKNOWN_:
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedUnisson:
-          result = msrSemiTonesPitchKind::kSTP_D_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalPerfectUnisson:
-          result = msrSemiTonesPitchKind::kSTP_D_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedUnisson:
-          result = msrSemiTonesPitchKind::kSTP_D_Natural;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSecond:
-          result = msrSemiTonesPitchKind::kSTP_E_TripleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorSecond:
-          result = msrSemiTonesPitchKind::kSTP_E_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMajorSecond:
-          result = msrSemiTonesPitchKind::kSTP_E_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSecond:
-          result = msrSemiTonesPitchKind::kSTP_E_Natural;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedThird:
-          result = msrSemiTonesPitchKind::kSTP_F_DoubleleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorThird:
-          result = msrSemiTonesPitchKind::kSTP_F_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorThird:
-          result = msrSemiTonesPitchKind::kSTP_F_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedThird:
-          result = msrSemiTonesPitchKind::kSTP_F_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedFourth:
-          result = msrSemiTonesPitchKind::kSTP_G_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalPerfectFourth:
-          result = msrSemiTonesPitchKind::kSTP_G_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedFourth:
-          result = msrSemiTonesPitchKind::kSTP_G_Natural;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedFifth:
-          result = msrSemiTonesPitchKind::kSTP_A_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalPerfectFifth:
-          result = msrSemiTonesPitchKind::kSTP_A_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedFifth:
-          result = msrSemiTonesPitchKind::kSTP_A_Natural;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSixth:
-          result = msrSemiTonesPitchKind::kSTP_B_TripleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorSixth:
-          result = msrSemiTonesPitchKind::kSTP_B_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMajorSixth:
-          result = msrSemiTonesPitchKind::kSTP_B_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSixth:
-          result = msrSemiTonesPitchKind::kSTP_B_Natural;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSeventh:
-          result = msrSemiTonesPitchKind::kSTP_C_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorSeventh:
-          result = msrSemiTonesPitchKind::kSTP_C_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorSeventh:
-          result = msrSemiTonesPitchKind::kSTP_C_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSeventh:
-          result = msrSemiTonesPitchKind::kSTP_C_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedOctave:
-          result = msrSemiTonesPitchKind::kSTP_D_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalPerfectOctave:
-          result = msrSemiTonesPitchKind::kSTP_D_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedOctave:
-          result = msrSemiTonesPitchKind::kSTP_D_Natural;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedNinth:
-          result = msrSemiTonesPitchKind::kSTP_E_TripleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorNinth:
-          result = msrSemiTonesPitchKind::kSTP_E_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMajorNinth:
-          result = msrSemiTonesPitchKind::kSTP_E_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedNinth:
-          result = msrSemiTonesPitchKind::kSTP_E_Natural;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedTenth:
-          result = msrSemiTonesPitchKind::kSTP_F_DoubleleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorTenth:
-          result = msrSemiTonesPitchKind::kSTP_F_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorTenth:
-          result = msrSemiTonesPitchKind::kSTP_F_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedTenth:
-          result = msrSemiTonesPitchKind::kSTP_F_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedEleventh:
-          result = msrSemiTonesPitchKind::kSTP_G_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalPerfectEleventh:
-          result = msrSemiTonesPitchKind::kSTP_G_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedEleventh:
-          result = msrSemiTonesPitchKind::kSTP_G_Natural;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedTwelfth:
-          result = msrSemiTonesPitchKind::kSTP_A_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalPerfectTwelfth:
-          result = msrSemiTonesPitchKind::kSTP_A_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedTwelfth:
-          result = msrSemiTonesPitchKind::kSTP_A_Natural;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedThirteenth:
-          result = msrSemiTonesPitchKind::kSTP_B_TripleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorThirteenth:
-          result = msrSemiTonesPitchKind::kSTP_B_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMajorThirteenth:
-          result = msrSemiTonesPitchKind::kSTP_B_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedThirteenth:
-          result = msrSemiTonesPitchKind::kSTP_B_Natural;
-          break;
-      } // switch
-      break;
-
-    case msrSemiTonesPitchKind::kSTP_D_Natural:
-      switch (intervalKind) {
-        case msrIntervalKind::kInterval_UNKNOWN_:
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedUnisson:
-          result = msrSemiTonesPitchKind::kSTP_D_Flat;
-          break;
-        case msrIntervalKind::kIntervalPerfectUnisson:
-          result = msrSemiTonesPitchKind::kSTP_D_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedUnisson:
-          result = msrSemiTonesPitchKind::kSTP_D_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSecond:
-          result = msrSemiTonesPitchKind::kSTP_E_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorSecond:
-          result = msrSemiTonesPitchKind::kSTP_E_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorSecond:
-          result = msrSemiTonesPitchKind::kSTP_E_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSecond:
-          result = msrSemiTonesPitchKind::kSTP_E_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedThird:
-          result = msrSemiTonesPitchKind::kSTP_F_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorThird:
-          result = msrSemiTonesPitchKind::kSTP_F_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorThird:
-          result = msrSemiTonesPitchKind::kSTP_F_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedThird:
-          result = msrSemiTonesPitchKind::kSTP_F_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedFourth:
-          result = msrSemiTonesPitchKind::kSTP_G_Flat;
-          break;
-        case msrIntervalKind::kIntervalPerfectFourth:
-          result = msrSemiTonesPitchKind::kSTP_G_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedFourth:
-          result = msrSemiTonesPitchKind::kSTP_G_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedFifth:
-          result = msrSemiTonesPitchKind::kSTP_A_Flat;
-          break;
-        case msrIntervalKind::kIntervalPerfectFifth:
-          result = msrSemiTonesPitchKind::kSTP_A_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedFifth:
-          result = msrSemiTonesPitchKind::kSTP_A_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSixth:
-          result = msrSemiTonesPitchKind::kSTP_B_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorSixth:
-          result = msrSemiTonesPitchKind::kSTP_B_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorSixth:
-          result = msrSemiTonesPitchKind::kSTP_B_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSixth:
-          result = msrSemiTonesPitchKind::kSTP_B_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSeventh:
-          result = msrSemiTonesPitchKind::kSTP_C_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorSeventh:
-          result = msrSemiTonesPitchKind::kSTP_C_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorSeventh:
-          result = msrSemiTonesPitchKind::kSTP_C_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSeventh:
-          result = msrSemiTonesPitchKind::kSTP_C_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedOctave:
-          result = msrSemiTonesPitchKind::kSTP_D_Flat;
-          break;
-        case msrIntervalKind::kIntervalPerfectOctave:
-          result = msrSemiTonesPitchKind::kSTP_D_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedOctave:
-          result = msrSemiTonesPitchKind::kSTP_D_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedNinth:
-          result = msrSemiTonesPitchKind::kSTP_E_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorNinth:
-          result = msrSemiTonesPitchKind::kSTP_E_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorNinth:
-          result = msrSemiTonesPitchKind::kSTP_E_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedNinth:
-          result = msrSemiTonesPitchKind::kSTP_E_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedTenth:
-          result = msrSemiTonesPitchKind::kSTP_F_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorTenth:
-          result = msrSemiTonesPitchKind::kSTP_F_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorTenth:
-          result = msrSemiTonesPitchKind::kSTP_F_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedTenth:
-          result = msrSemiTonesPitchKind::kSTP_F_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedEleventh:
-          result = msrSemiTonesPitchKind::kSTP_G_Flat;
-          break;
-        case msrIntervalKind::kIntervalPerfectEleventh:
-          result = msrSemiTonesPitchKind::kSTP_G_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedEleventh:
-          result = msrSemiTonesPitchKind::kSTP_G_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedTwelfth:
-          result = msrSemiTonesPitchKind::kSTP_A_Flat;
-          break;
-        case msrIntervalKind::kIntervalPerfectTwelfth:
-          result = msrSemiTonesPitchKind::kSTP_A_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedTwelfth:
-          result = msrSemiTonesPitchKind::kSTP_A_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedThirteenth:
-          result = msrSemiTonesPitchKind::kSTP_B_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorThirteenth:
-          result = msrSemiTonesPitchKind::kSTP_B_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorThirteenth:
-          result = msrSemiTonesPitchKind::kSTP_B_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedThirteenth:
-          result = msrSemiTonesPitchKind::kSTP_B_Sharp;
-          break;
-      } // switch
-      break;
-
-    case msrSemiTonesPitchKind::kSTP_D_Sharp:
-      switch (intervalKind) {
-        case msrIntervalKind::kInterval_UNKNOWN_:
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedUnisson:
-          result = msrSemiTonesPitchKind::kSTP_D_Natural;
-          break;
-        case msrIntervalKind::kIntervalPerfectUnisson:
-          result = msrSemiTonesPitchKind::kSTP_D_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedUnisson:
-          result = msrSemiTonesPitchKind::kSTP_D_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSecond:
-          result = msrSemiTonesPitchKind::kSTP_E_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorSecond:
-          result = msrSemiTonesPitchKind::kSTP_E_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorSecond:
-          result = msrSemiTonesPitchKind::kSTP_E_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSecond:
-          result = msrSemiTonesPitchKind::kSTP_E_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedThird:
-          result = msrSemiTonesPitchKind::kSTP_F_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorThird:
-          result = msrSemiTonesPitchKind::kSTP_F_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorThird:
-          result = msrSemiTonesPitchKind::kSTP_F_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedThird:
-          result = msrSemiTonesPitchKind::kSTP_F_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedFourth:
-          result = msrSemiTonesPitchKind::kSTP_G_Natural;
-          break;
-        case msrIntervalKind::kIntervalPerfectFourth:
-          result = msrSemiTonesPitchKind::kSTP_G_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedFourth:
-          result = msrSemiTonesPitchKind::kSTP_G_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedFifth:
-          result = msrSemiTonesPitchKind::kSTP_A_Natural;
-          break;
-        case msrIntervalKind::kIntervalPerfectFifth:
-          result = msrSemiTonesPitchKind::kSTP_A_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedFifth:
-          result = msrSemiTonesPitchKind::kSTP_A_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSixth:
-          result = msrSemiTonesPitchKind::kSTP_B_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorSixth:
-          result = msrSemiTonesPitchKind::kSTP_B_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorSixth:
-          result = msrSemiTonesPitchKind::kSTP_B_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSixth:
-          result = msrSemiTonesPitchKind::kSTP_B_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSeventh:
-          result = msrSemiTonesPitchKind::kSTP_C_Natural;
-          break;
-        case msrIntervalKind::kIntervalMinorSeventh:
-          result = msrSemiTonesPitchKind::kSTP_C_Sharp;
-          break;
-        case msrIntervalKind::kIntervalMajorSeventh:
-          result = msrSemiTonesPitchKind::kSTP_C_DoubleSharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSeventh:
-          result = msrSemiTonesPitchKind::kSTP_C_TripleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedOctave:
-          result = msrSemiTonesPitchKind::kSTP_D_Natural;
-          break;
-        case msrIntervalKind::kIntervalPerfectOctave:
-          result = msrSemiTonesPitchKind::kSTP_D_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedOctave:
-          result = msrSemiTonesPitchKind::kSTP_D_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedNinth:
-          result = msrSemiTonesPitchKind::kSTP_E_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorNinth:
-          result = msrSemiTonesPitchKind::kSTP_E_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorNinth:
-          result = msrSemiTonesPitchKind::kSTP_E_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedNinth:
-          result = msrSemiTonesPitchKind::kSTP_E_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedTenth:
-          result = msrSemiTonesPitchKind::kSTP_F_Natural;
-          break;
-        case msrIntervalKind::kIntervalMinorTenth:
-          result = msrSemiTonesPitchKind::kSTP_F_Sharp;
-          break;
-        case msrIntervalKind::kIntervalMajorTenth:
-          result = msrSemiTonesPitchKind::kSTP_F_DoubleSharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedTenth:
-          result = msrSemiTonesPitchKind::kSTP_F_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedEleventh:
-          result = msrSemiTonesPitchKind::kSTP_G_Natural;
-          break;
-        case msrIntervalKind::kIntervalPerfectEleventh:
-          result = msrSemiTonesPitchKind::kSTP_G_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedEleventh:
-          result = msrSemiTonesPitchKind::kSTP_G_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedTwelfth:
-          result = msrSemiTonesPitchKind::kSTP_A_Natural;
-          break;
-        case msrIntervalKind::kIntervalPerfectTwelfth:
-          result = msrSemiTonesPitchKind::kSTP_A_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedTwelfth:
-          result = msrSemiTonesPitchKind::kSTP_A_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedThirteenth:
-          result = msrSemiTonesPitchKind::kSTP_B_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorThirteenth:
-          result = msrSemiTonesPitchKind::kSTP_B_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorThirteenth:
-          result = msrSemiTonesPitchKind::kSTP_B_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedThirteenth:
-          result = msrSemiTonesPitchKind::kSTP_B_DoubleSharp;
-          break;
-      } // switch
-      break;
-
-    case msrSemiTonesPitchKind::kSTP_E_Flat:
-      switch (intervalKind) {
-        case msrIntervalKind::kInterval_UNKNOWN_:
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedUnisson:
-          result = msrSemiTonesPitchKind::kSTP_E_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalPerfectUnisson:
-          result = msrSemiTonesPitchKind::kSTP_E_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedUnisson:
-          result = msrSemiTonesPitchKind::kSTP_E_Natural;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSecond:
-          result = msrSemiTonesPitchKind::kSTP_F_DoubleleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorSecond:
-          result = msrSemiTonesPitchKind::kSTP_F_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorSecond:
-          result = msrSemiTonesPitchKind::kSTP_F_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSecond:
-          result = msrSemiTonesPitchKind::kSTP_F_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedThird:
-          result = msrSemiTonesPitchKind::kSTP_G_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorThird:
-          result = msrSemiTonesPitchKind::kSTP_G_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorThird:
-          result = msrSemiTonesPitchKind::kSTP_G_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedThird:
-          result = msrSemiTonesPitchKind::kSTP_G_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedFourth:
-          result = msrSemiTonesPitchKind::kSTP_A_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalPerfectFourth:
-          result = msrSemiTonesPitchKind::kSTP_A_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedFourth:
-          result = msrSemiTonesPitchKind::kSTP_A_Natural;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedFifth:
-          result = msrSemiTonesPitchKind::kSTP_B_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalPerfectFifth:
-          result = msrSemiTonesPitchKind::kSTP_B_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedFifth:
-          result = msrSemiTonesPitchKind::kSTP_B_Natural;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSixth:
-          result = msrSemiTonesPitchKind::kSTP_C_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorSixth:
-          result = msrSemiTonesPitchKind::kSTP_C_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorSixth:
-          result = msrSemiTonesPitchKind::kSTP_C_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSixth:
-          result = msrSemiTonesPitchKind::kSTP_C_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSeventh:
-          result = msrSemiTonesPitchKind::kSTP_D_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorSeventh:
-          result = msrSemiTonesPitchKind::kSTP_D_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorSeventh:
-          result = msrSemiTonesPitchKind::kSTP_D_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSeventh:
-          result = msrSemiTonesPitchKind::kSTP_D_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedOctave:
-          result = msrSemiTonesPitchKind::kSTP_E_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalPerfectOctave:
-          result = msrSemiTonesPitchKind::kSTP_E_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedOctave:
-          result = msrSemiTonesPitchKind::kSTP_E_Natural;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedNinth:
-          result = msrSemiTonesPitchKind::kSTP_F_DoubleleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorNinth:
-          result = msrSemiTonesPitchKind::kSTP_F_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorNinth:
-          result = msrSemiTonesPitchKind::kSTP_F_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedNinth:
-          result = msrSemiTonesPitchKind::kSTP_F_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedTenth:
-          result = msrSemiTonesPitchKind::kSTP_G_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorTenth:
-          result = msrSemiTonesPitchKind::kSTP_G_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorTenth:
-          result = msrSemiTonesPitchKind::kSTP_G_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedTenth:
-          result = msrSemiTonesPitchKind::kSTP_G_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedEleventh:
-          result = msrSemiTonesPitchKind::kSTP_A_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalPerfectEleventh:
-          result = msrSemiTonesPitchKind::kSTP_A_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedEleventh:
-          result = msrSemiTonesPitchKind::kSTP_A_Natural;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedTwelfth:
-          result = msrSemiTonesPitchKind::kSTP_B_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalPerfectTwelfth:
-          result = msrSemiTonesPitchKind::kSTP_B_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedTwelfth:
-          result = msrSemiTonesPitchKind::kSTP_B_Natural;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedThirteenth:
-          result = msrSemiTonesPitchKind::kSTP_C_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorThirteenth:
-          result = msrSemiTonesPitchKind::kSTP_C_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorThirteenth:
-          result = msrSemiTonesPitchKind::kSTP_C_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedThirteenth:
-          result = msrSemiTonesPitchKind::kSTP_C_Sharp;
-          break;
-      } // switch
-      break;
-
-    case msrSemiTonesPitchKind::kSTP_E_Natural:
-      switch (intervalKind) {
-        case msrIntervalKind::kInterval_UNKNOWN_:
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedUnisson:
-          result = msrSemiTonesPitchKind::kSTP_E_Flat;
-          break;
-        case msrIntervalKind::kIntervalPerfectUnisson:
-          result = msrSemiTonesPitchKind::kSTP_E_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedUnisson:
-          result = msrSemiTonesPitchKind::kSTP_E_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSecond:
-          result = msrSemiTonesPitchKind::kSTP_F_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorSecond:
-          result = msrSemiTonesPitchKind::kSTP_F_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorSecond:
-          result = msrSemiTonesPitchKind::kSTP_F_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSecond:
-          result = msrSemiTonesPitchKind::kSTP_F_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedThird:
-          result = msrSemiTonesPitchKind::kSTP_G_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorThird:
-          result = msrSemiTonesPitchKind::kSTP_G_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorThird:
-          result = msrSemiTonesPitchKind::kSTP_G_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedThird:
-          result = msrSemiTonesPitchKind::kSTP_G_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedFourth:
-          result = msrSemiTonesPitchKind::kSTP_A_Flat;
-          break;
-        case msrIntervalKind::kIntervalPerfectFourth:
-          result = msrSemiTonesPitchKind::kSTP_A_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedFourth:
-          result = msrSemiTonesPitchKind::kSTP_A_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedFifth:
-          result = msrSemiTonesPitchKind::kSTP_B_Natural;
-          break;
-        case msrIntervalKind::kIntervalPerfectFifth:
-          result = msrSemiTonesPitchKind::kSTP_B_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedFifth:
-          result = msrSemiTonesPitchKind::kSTP_B_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSixth:
-          result = msrSemiTonesPitchKind::kSTP_C_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorSixth:
-          result = msrSemiTonesPitchKind::kSTP_C_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorSixth:
-          result = msrSemiTonesPitchKind::kSTP_C_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSixth:
-          result = msrSemiTonesPitchKind::kSTP_C_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSeventh:
-          result = msrSemiTonesPitchKind::kSTP_D_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorSeventh:
-          result = msrSemiTonesPitchKind::kSTP_D_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorSeventh:
-          result = msrSemiTonesPitchKind::kSTP_D_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSeventh:
-          result = msrSemiTonesPitchKind::kSTP_D_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedOctave:
-          result = msrSemiTonesPitchKind::kSTP_E_Flat;
-          break;
-        case msrIntervalKind::kIntervalPerfectOctave:
-          result = msrSemiTonesPitchKind::kSTP_E_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedOctave:
-          result = msrSemiTonesPitchKind::kSTP_E_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedNinth:
-          result = msrSemiTonesPitchKind::kSTP_F_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorNinth:
-          result = msrSemiTonesPitchKind::kSTP_F_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorNinth:
-          result = msrSemiTonesPitchKind::kSTP_F_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedNinth:
-          result = msrSemiTonesPitchKind::kSTP_F_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedTenth:
-          result = msrSemiTonesPitchKind::kSTP_G_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorTenth:
-          result = msrSemiTonesPitchKind::kSTP_G_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorTenth:
-          result = msrSemiTonesPitchKind::kSTP_G_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedTenth:
-          result = msrSemiTonesPitchKind::kSTP_G_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedEleventh:
-          result = msrSemiTonesPitchKind::kSTP_A_Flat;
-          break;
-        case msrIntervalKind::kIntervalPerfectEleventh:
-          result = msrSemiTonesPitchKind::kSTP_A_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedEleventh:
-          result = msrSemiTonesPitchKind::kSTP_A_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedTwelfth:
-          result = msrSemiTonesPitchKind::kSTP_B_Natural;
-          break;
-        case msrIntervalKind::kIntervalPerfectTwelfth:
-          result = msrSemiTonesPitchKind::kSTP_B_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedTwelfth:
-          result = msrSemiTonesPitchKind::kSTP_B_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedThirteenth:
-          result = msrSemiTonesPitchKind::kSTP_C_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorThirteenth:
-          result = msrSemiTonesPitchKind::kSTP_C_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorThirteenth:
-          result = msrSemiTonesPitchKind::kSTP_C_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedThirteenth:
-          result = msrSemiTonesPitchKind::kSTP_C_DoubleSharp;
-          break;
-      } // switch
-      break;
-
-    case msrSemiTonesPitchKind::kSTP_E_Sharp:
-      switch (intervalKind) {
-        case msrIntervalKind::kInterval_UNKNOWN_:
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedUnisson:
-          result = msrSemiTonesPitchKind::kSTP_E_Natural;
-          break;
-        case msrIntervalKind::kIntervalPerfectUnisson:
-          result = msrSemiTonesPitchKind::kSTP_E_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedUnisson:
-          result = msrSemiTonesPitchKind::kSTP_E_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSecond:
-          result = msrSemiTonesPitchKind::kSTP_F_Natural;
-          break;
-        case msrIntervalKind::kIntervalMinorSecond:
-          result = msrSemiTonesPitchKind::kSTP_F_Sharp;
-          break;
-        case msrIntervalKind::kIntervalMajorSecond:
-          result = msrSemiTonesPitchKind::kSTP_F_DoubleSharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSecond:
-          result = msrSemiTonesPitchKind::kSTP_F_TripleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedThird:
-          result = msrSemiTonesPitchKind::kSTP_G_Natural;
-          break;
-        case msrIntervalKind::kIntervalMinorThird:
-          result = msrSemiTonesPitchKind::kSTP_G_Sharp;
-          break;
-        case msrIntervalKind::kIntervalMajorThird:
-          result = msrSemiTonesPitchKind::kSTP_G_DoubleSharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedThird:
-          result = msrSemiTonesPitchKind::kSTP_G_TripleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedFourth:
-          result = msrSemiTonesPitchKind::kSTP_A_Natural;
-          break;
-        case msrIntervalKind::kIntervalPerfectFourth:
-          result = msrSemiTonesPitchKind::kSTP_A_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedFourth:
-          result = msrSemiTonesPitchKind::kSTP_A_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedFifth:
-          result = msrSemiTonesPitchKind::kSTP_B_Natural;
-          break;
-        case msrIntervalKind::kIntervalPerfectFifth:
-          result = msrSemiTonesPitchKind::kSTP_B_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedFifth:
-          result = msrSemiTonesPitchKind::kSTP_B_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSixth:
-          result = msrSemiTonesPitchKind::kSTP_C_Natural;
-          break;
-        case msrIntervalKind::kIntervalMinorSixth:
-          result = msrSemiTonesPitchKind::kSTP_C_Sharp;
-          break;
-        case msrIntervalKind::kIntervalMajorSixth:
-          result = msrSemiTonesPitchKind::kSTP_C_DoubleSharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSixth:
-          result = msrSemiTonesPitchKind::kSTP_C_TripleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSeventh:
-          result = msrSemiTonesPitchKind::kSTP_D_Natural;
-          break;
-        case msrIntervalKind::kIntervalMinorSeventh:
-          result = msrSemiTonesPitchKind::kSTP_D_Sharp;
-          break;
-        case msrIntervalKind::kIntervalMajorSeventh:
-          result = msrSemiTonesPitchKind::kSTP_D_DoubleSharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSeventh:
-          result = msrSemiTonesPitchKind::kSTP_D_TripleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedOctave:
-          result = msrSemiTonesPitchKind::kSTP_E_Natural;
-          break;
-        case msrIntervalKind::kIntervalPerfectOctave:
-          result = msrSemiTonesPitchKind::kSTP_E_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedOctave:
-          result = msrSemiTonesPitchKind::kSTP_E_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedNinth:
-          result = msrSemiTonesPitchKind::kSTP_F_Natural;
-          break;
-        case msrIntervalKind::kIntervalMinorNinth:
-          result = msrSemiTonesPitchKind::kSTP_F_Sharp;
-          break;
-        case msrIntervalKind::kIntervalMajorNinth:
-          result = msrSemiTonesPitchKind::kSTP_F_DoubleSharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedNinth:
-          result = msrSemiTonesPitchKind::kSTP_F_TripleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedTenth:
-          result = msrSemiTonesPitchKind::kSTP_G_Natural;
-          break;
-        case msrIntervalKind::kIntervalMinorTenth:
-          result = msrSemiTonesPitchKind::kSTP_G_Sharp;
-          break;
-        case msrIntervalKind::kIntervalMajorTenth:
-          result = msrSemiTonesPitchKind::kSTP_G_DoubleSharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedTenth:
-          result = msrSemiTonesPitchKind::kSTP_G_TripleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedEleventh:
-          result = msrSemiTonesPitchKind::kSTP_A_Natural;
-          break;
-        case msrIntervalKind::kIntervalPerfectEleventh:
-          result = msrSemiTonesPitchKind::kSTP_A_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedEleventh:
-          result = msrSemiTonesPitchKind::kSTP_A_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedTwelfth:
-          result = msrSemiTonesPitchKind::kSTP_B_Natural;
-          break;
-        case msrIntervalKind::kIntervalPerfectTwelfth:
-          result = msrSemiTonesPitchKind::kSTP_B_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedTwelfth:
-          result = msrSemiTonesPitchKind::kSTP_B_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedThirteenth:
-          result = msrSemiTonesPitchKind::kSTP_C_Natural;
-          break;
-        case msrIntervalKind::kIntervalMinorThirteenth:
-          result = msrSemiTonesPitchKind::kSTP_C_Sharp;
-          break;
-        case msrIntervalKind::kIntervalMajorThirteenth:
-          result = msrSemiTonesPitchKind::kSTP_C_DoubleSharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedThirteenth:
-          result = msrSemiTonesPitchKind::kSTP_C_TripleSharp;
-          break;
-      } // switch
-      break;
-
-    case msrSemiTonesPitchKind::kSTP_F_Flat:
-      switch (intervalKind) {
-        case msrIntervalKind::kInterval_UNKNOWN_:
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedUnisson:
-          result = msrSemiTonesPitchKind::kSTP_F_DoubleleFlat;
-          break;
-        case msrIntervalKind::kIntervalPerfectUnisson:
-          result = msrSemiTonesPitchKind::kSTP_F_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedUnisson:
-          result = msrSemiTonesPitchKind::kSTP_F_Natural;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSecond:
-          result = msrSemiTonesPitchKind::kSTP_G_TripleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorSecond:
-          result = msrSemiTonesPitchKind::kSTP_G_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMajorSecond:
-          result = msrSemiTonesPitchKind::kSTP_G_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSecond:
-          result = msrSemiTonesPitchKind::kSTP_G_Natural;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedThird:
-          result = msrSemiTonesPitchKind::kSTP_A_TripleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorThird:
-          result = msrSemiTonesPitchKind::kSTP_A_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMajorThird:
-          result = msrSemiTonesPitchKind::kSTP_A_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedThird:
-          result = msrSemiTonesPitchKind::kSTP_A_Natural;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedFourth:
-          result = msrSemiTonesPitchKind::kSTP_B_TripleFlat;
-          break;
-        case msrIntervalKind::kIntervalPerfectFourth:
-          result = msrSemiTonesPitchKind::kSTP_B_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedFourth:
-          result = msrSemiTonesPitchKind::kSTP_B_Flat;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedFifth:
-          result = msrSemiTonesPitchKind::kSTP_C_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalPerfectFifth:
-          result = msrSemiTonesPitchKind::kSTP_C_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedFifth:
-          result = msrSemiTonesPitchKind::kSTP_C_Natural;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSixth:
-          result = msrSemiTonesPitchKind::kSTP_D_TripleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorSixth:
-          result = msrSemiTonesPitchKind::kSTP_D_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMajorSixth:
-          result = msrSemiTonesPitchKind::kSTP_D_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSixth:
-          result = msrSemiTonesPitchKind::kSTP_D_Natural;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSeventh:
-          result = msrSemiTonesPitchKind::kSTP_E_TripleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorSeventh:
-          result = msrSemiTonesPitchKind::kSTP_E_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMajorSeventh:
-          result = msrSemiTonesPitchKind::kSTP_E_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSeventh:
-          result = msrSemiTonesPitchKind::kSTP_E_Natural;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedOctave:
-          result = msrSemiTonesPitchKind::kSTP_F_DoubleleFlat;
-          break;
-        case msrIntervalKind::kIntervalPerfectOctave:
-          result = msrSemiTonesPitchKind::kSTP_F_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedOctave:
-          result = msrSemiTonesPitchKind::kSTP_F_Natural;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedNinth:
-          result = msrSemiTonesPitchKind::kSTP_G_TripleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorNinth:
-          result = msrSemiTonesPitchKind::kSTP_G_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMajorNinth:
-          result = msrSemiTonesPitchKind::kSTP_G_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedNinth:
-          result = msrSemiTonesPitchKind::kSTP_G_Natural;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedTenth:
-          result = msrSemiTonesPitchKind::kSTP_A_TripleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorTenth:
-          result = msrSemiTonesPitchKind::kSTP_A_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMajorTenth:
-          result = msrSemiTonesPitchKind::kSTP_A_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedTenth:
-          result = msrSemiTonesPitchKind::kSTP_A_Natural;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedEleventh:
-          result = msrSemiTonesPitchKind::kSTP_B_TripleFlat;
-          break;
-        case msrIntervalKind::kIntervalPerfectEleventh:
-          result = msrSemiTonesPitchKind::kSTP_B_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedEleventh:
-          result = msrSemiTonesPitchKind::kSTP_B_Flat;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedTwelfth:
-          result = msrSemiTonesPitchKind::kSTP_C_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalPerfectTwelfth:
-          result = msrSemiTonesPitchKind::kSTP_C_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedTwelfth:
-          result = msrSemiTonesPitchKind::kSTP_C_Natural;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedThirteenth:
-          result = msrSemiTonesPitchKind::kSTP_D_TripleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorThirteenth:
-          result = msrSemiTonesPitchKind::kSTP_D_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMajorThirteenth:
-          result = msrSemiTonesPitchKind::kSTP_D_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedThirteenth:
-          result = msrSemiTonesPitchKind::kSTP_D_Natural;
-          break;
-      } // switch
-      break;
-
-    case msrSemiTonesPitchKind::kSTP_F_Natural:
-      switch (intervalKind) {
-        case msrIntervalKind::kInterval_UNKNOWN_:
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedUnisson:
-          result = msrSemiTonesPitchKind::kSTP_F_Flat;
-          break;
-        case msrIntervalKind::kIntervalPerfectUnisson:
-          result = msrSemiTonesPitchKind::kSTP_F_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedUnisson:
-          result = msrSemiTonesPitchKind::kSTP_F_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSecond:
-          result = msrSemiTonesPitchKind::kSTP_G_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorSecond:
-          result = msrSemiTonesPitchKind::kSTP_G_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorSecond:
-          result = msrSemiTonesPitchKind::kSTP_G_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSecond:
-          result = msrSemiTonesPitchKind::kSTP_G_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedThird:
-          result = msrSemiTonesPitchKind::kSTP_A_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorThird:
-          result = msrSemiTonesPitchKind::kSTP_A_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorThird:
-          result = msrSemiTonesPitchKind::kSTP_A_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedThird:
-          result = msrSemiTonesPitchKind::kSTP_A_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedFourth:
-          result = msrSemiTonesPitchKind::kSTP_B_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalPerfectFourth:
-          result = msrSemiTonesPitchKind::kSTP_B_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedFourth:
-          result = msrSemiTonesPitchKind::kSTP_B_Natural;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedFifth:
-          result = msrSemiTonesPitchKind::kSTP_C_Flat;
-          break;
-        case msrIntervalKind::kIntervalPerfectFifth:
-          result = msrSemiTonesPitchKind::kSTP_C_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedFifth:
-          result = msrSemiTonesPitchKind::kSTP_C_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSixth:
-          result = msrSemiTonesPitchKind::kSTP_D_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorSixth:
-          result = msrSemiTonesPitchKind::kSTP_D_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorSixth:
-          result = msrSemiTonesPitchKind::kSTP_D_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSixth:
-          result = msrSemiTonesPitchKind::kSTP_D_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSeventh:
-          result = msrSemiTonesPitchKind::kSTP_E_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorSeventh:
-          result = msrSemiTonesPitchKind::kSTP_E_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorSeventh:
-          result = msrSemiTonesPitchKind::kSTP_E_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSeventh:
-          result = msrSemiTonesPitchKind::kSTP_E_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedOctave:
-          result = msrSemiTonesPitchKind::kSTP_F_Flat;
-          break;
-        case msrIntervalKind::kIntervalPerfectOctave:
-          result = msrSemiTonesPitchKind::kSTP_F_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedOctave:
-          result = msrSemiTonesPitchKind::kSTP_F_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedNinth:
-          result = msrSemiTonesPitchKind::kSTP_G_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorNinth:
-          result = msrSemiTonesPitchKind::kSTP_G_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorNinth:
-          result = msrSemiTonesPitchKind::kSTP_G_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedNinth:
-          result = msrSemiTonesPitchKind::kSTP_G_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedTenth:
-          result = msrSemiTonesPitchKind::kSTP_A_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorTenth:
-          result = msrSemiTonesPitchKind::kSTP_A_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorTenth:
-          result = msrSemiTonesPitchKind::kSTP_A_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedTenth:
-          result = msrSemiTonesPitchKind::kSTP_A_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedEleventh:
-          result = msrSemiTonesPitchKind::kSTP_B_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalPerfectEleventh:
-          result = msrSemiTonesPitchKind::kSTP_B_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedEleventh:
-          result = msrSemiTonesPitchKind::kSTP_B_Natural;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedTwelfth:
-          result = msrSemiTonesPitchKind::kSTP_C_Flat;
-          break;
-        case msrIntervalKind::kIntervalPerfectTwelfth:
-          result = msrSemiTonesPitchKind::kSTP_C_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedTwelfth:
-          result = msrSemiTonesPitchKind::kSTP_C_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedThirteenth:
-          result = msrSemiTonesPitchKind::kSTP_D_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorThirteenth:
-          result = msrSemiTonesPitchKind::kSTP_D_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorThirteenth:
-          result = msrSemiTonesPitchKind::kSTP_D_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedThirteenth:
-          result = msrSemiTonesPitchKind::kSTP_D_Sharp;
-          break;
-      } // switch
-      break;
-
-    case msrSemiTonesPitchKind::kSTP_F_Sharp:
-      switch (intervalKind) {
-        case msrIntervalKind::kInterval_UNKNOWN_:
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedUnisson:
-          result = msrSemiTonesPitchKind::kSTP_F_Natural;
-          break;
-        case msrIntervalKind::kIntervalPerfectUnisson:
-          result = msrSemiTonesPitchKind::kSTP_F_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedUnisson:
-          result = msrSemiTonesPitchKind::kSTP_F_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSecond:
-          result = msrSemiTonesPitchKind::kSTP_G_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorSecond:
-          result = msrSemiTonesPitchKind::kSTP_G_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorSecond:
-          result = msrSemiTonesPitchKind::kSTP_G_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSecond:
-          result = msrSemiTonesPitchKind::kSTP_G_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedThird:
-          result = msrSemiTonesPitchKind::kSTP_A_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorThird:
-          result = msrSemiTonesPitchKind::kSTP_A_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorThird:
-          result = msrSemiTonesPitchKind::kSTP_A_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedThird:
-          result = msrSemiTonesPitchKind::kSTP_A_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedFourth:
-          result = msrSemiTonesPitchKind::kSTP_B_Sharp;
-          break;
-        case msrIntervalKind::kIntervalPerfectFourth:
-          result = msrSemiTonesPitchKind::kSTP_B_DoubleSharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedFourth:
-          result = msrSemiTonesPitchKind::kSTP_B_TripleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedFifth:
-          result = msrSemiTonesPitchKind::kSTP_C_Natural;
-          break;
-        case msrIntervalKind::kIntervalPerfectFifth:
-          result = msrSemiTonesPitchKind::kSTP_C_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedFifth:
-          result = msrSemiTonesPitchKind::kSTP_C_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSixth:
-          result = msrSemiTonesPitchKind::kSTP_D_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorSixth:
-          result = msrSemiTonesPitchKind::kSTP_D_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorSixth:
-          result = msrSemiTonesPitchKind::kSTP_D_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSixth:
-          result = msrSemiTonesPitchKind::kSTP_D_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSeventh:
-          result = msrSemiTonesPitchKind::kSTP_E_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorSeventh:
-          result = msrSemiTonesPitchKind::kSTP_E_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorSeventh:
-          result = msrSemiTonesPitchKind::kSTP_E_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSeventh:
-          result = msrSemiTonesPitchKind::kSTP_E_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedOctave:
-          result = msrSemiTonesPitchKind::kSTP_F_Natural;
-          break;
-        case msrIntervalKind::kIntervalPerfectOctave:
-          result = msrSemiTonesPitchKind::kSTP_F_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedOctave:
-          result = msrSemiTonesPitchKind::kSTP_F_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedNinth:
-          result = msrSemiTonesPitchKind::kSTP_G_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorNinth:
-          result = msrSemiTonesPitchKind::kSTP_G_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorNinth:
-          result = msrSemiTonesPitchKind::kSTP_G_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedNinth:
-          result = msrSemiTonesPitchKind::kSTP_G_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedTenth:
-          result = msrSemiTonesPitchKind::kSTP_A_Natural;
-          break;
-        case msrIntervalKind::kIntervalMinorTenth:
-          result = msrSemiTonesPitchKind::kSTP_A_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorTenth:
-          result = msrSemiTonesPitchKind::kSTP_A_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedTenth:
-          result = msrSemiTonesPitchKind::kSTP_A_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedEleventh:
-          result = msrSemiTonesPitchKind::kSTP_B_Sharp;
-          break;
-        case msrIntervalKind::kIntervalPerfectEleventh:
-          result = msrSemiTonesPitchKind::kSTP_B_DoubleSharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedEleventh:
-          result = msrSemiTonesPitchKind::kSTP_B_TripleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedTwelfth:
-          result = msrSemiTonesPitchKind::kSTP_C_Natural;
-          break;
-        case msrIntervalKind::kIntervalPerfectTwelfth:
-          result = msrSemiTonesPitchKind::kSTP_C_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedTwelfth:
-          result = msrSemiTonesPitchKind::kSTP_C_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedThirteenth:
-          result = msrSemiTonesPitchKind::kSTP_E_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorThirteenth:
-          result = msrSemiTonesPitchKind::kSTP_D_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorThirteenth:
-          result = msrSemiTonesPitchKind::kSTP_D_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedThirteenth:
-          result = msrSemiTonesPitchKind::kSTP_D_DoubleSharp;
-          break;
-      } // switch
-      break;
-
-    case msrSemiTonesPitchKind::kSTP_G_Flat:
-      switch (intervalKind) {
-        case msrIntervalKind::kInterval_UNKNOWN_:
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedUnisson:
-          result = msrSemiTonesPitchKind::kSTP_G_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalPerfectUnisson:
-          result = msrSemiTonesPitchKind::kSTP_G_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedUnisson:
-          result = msrSemiTonesPitchKind::kSTP_G_Natural;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSecond:
-          result = msrSemiTonesPitchKind::kSTP_A_TripleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorSecond:
-          result = msrSemiTonesPitchKind::kSTP_A_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMajorSecond:
-          result = msrSemiTonesPitchKind::kSTP_A_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSecond:
-          result = msrSemiTonesPitchKind::kSTP_A_Natural;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedThird:
-          result = msrSemiTonesPitchKind::kSTP_B_TripleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorThird:
-          result = msrSemiTonesPitchKind::kSTP_B_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMajorThird:
-          result = msrSemiTonesPitchKind::kSTP_B_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedThird:
-          result = msrSemiTonesPitchKind::kSTP_B_Natural;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedFourth:
-          result = msrSemiTonesPitchKind::kSTP_C_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalPerfectFourth:
-          result = msrSemiTonesPitchKind::kSTP_C_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedFourth:
-          result = msrSemiTonesPitchKind::kSTP_C_Natural;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedFifth:
-          result = msrSemiTonesPitchKind::kSTP_D_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalPerfectFifth:
-          result = msrSemiTonesPitchKind::kSTP_D_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedFifth:
-          result = msrSemiTonesPitchKind::kSTP_D_Natural;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSixth:
-          result = msrSemiTonesPitchKind::kSTP_E_TripleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorSixth:
-          result = msrSemiTonesPitchKind::kSTP_E_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMajorSixth:
-          result = msrSemiTonesPitchKind::kSTP_E_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSixth:
-          result = msrSemiTonesPitchKind::kSTP_E_Natural;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSeventh:
-          result = msrSemiTonesPitchKind::kSTP_F_DoubleleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorSeventh:
-          result = msrSemiTonesPitchKind::kSTP_F_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorSeventh:
-          result = msrSemiTonesPitchKind::kSTP_F_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSeventh:
-          result = msrSemiTonesPitchKind::kSTP_F_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedOctave:
-          result = msrSemiTonesPitchKind::kSTP_G_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalPerfectOctave:
-          result = msrSemiTonesPitchKind::kSTP_G_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedOctave:
-          result = msrSemiTonesPitchKind::kSTP_G_Natural;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedNinth:
-          result = msrSemiTonesPitchKind::kSTP_A_TripleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorNinth:
-          result = msrSemiTonesPitchKind::kSTP_A_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMajorNinth:
-          result = msrSemiTonesPitchKind::kSTP_A_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedNinth:
-          result = msrSemiTonesPitchKind::kSTP_A_Natural;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedTenth:
-          result = msrSemiTonesPitchKind::kSTP_B_TripleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorTenth:
-          result = msrSemiTonesPitchKind::kSTP_B_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMajorTenth:
-          result = msrSemiTonesPitchKind::kSTP_B_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedTenth:
-          result = msrSemiTonesPitchKind::kSTP_B_Natural;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedEleventh:
-          result = msrSemiTonesPitchKind::kSTP_C_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalPerfectEleventh:
-          result = msrSemiTonesPitchKind::kSTP_C_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedEleventh:
-          result = msrSemiTonesPitchKind::kSTP_C_Natural;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedTwelfth:
-          result = msrSemiTonesPitchKind::kSTP_D_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalPerfectTwelfth:
-          result = msrSemiTonesPitchKind::kSTP_D_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedTwelfth:
-          result = msrSemiTonesPitchKind::kSTP_D_Natural;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedThirteenth:
-          result = msrSemiTonesPitchKind::kSTP_E_TripleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorThirteenth:
-          result = msrSemiTonesPitchKind::kSTP_E_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMajorThirteenth:
-          result = msrSemiTonesPitchKind::kSTP_E_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedThirteenth:
-          result = msrSemiTonesPitchKind::kSTP_E_Natural;
-          break;
-      } // switch
-      break;
-
-    case msrSemiTonesPitchKind::kSTP_G_Natural:
-      switch (intervalKind) {
-        case msrIntervalKind::kInterval_UNKNOWN_:
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedUnisson:
-          result = msrSemiTonesPitchKind::kSTP_G_Flat;
-          break;
-        case msrIntervalKind::kIntervalPerfectUnisson:
-          result = msrSemiTonesPitchKind::kSTP_G_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedUnisson:
-          result = msrSemiTonesPitchKind::kSTP_G_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSecond:
-          result = msrSemiTonesPitchKind::kSTP_A_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorSecond:
-          result = msrSemiTonesPitchKind::kSTP_A_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorSecond:
-          result = msrSemiTonesPitchKind::kSTP_A_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSecond:
-          result = msrSemiTonesPitchKind::kSTP_A_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedThird:
-          result = msrSemiTonesPitchKind::kSTP_B_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorThird:
-          result = msrSemiTonesPitchKind::kSTP_B_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorThird:
-          result = msrSemiTonesPitchKind::kSTP_B_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedThird:
-          result = msrSemiTonesPitchKind::kSTP_B_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedFourth:
-          result = msrSemiTonesPitchKind::kSTP_C_Flat;
-          break;
-        case msrIntervalKind::kIntervalPerfectFourth:
-          result = msrSemiTonesPitchKind::kSTP_C_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedFourth:
-          result = msrSemiTonesPitchKind::kSTP_C_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedFifth:
-          result = msrSemiTonesPitchKind::kSTP_D_Flat;
-          break;
-        case msrIntervalKind::kIntervalPerfectFifth:
-          result = msrSemiTonesPitchKind::kSTP_D_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedFifth:
-          result = msrSemiTonesPitchKind::kSTP_D_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSixth:
-          result = msrSemiTonesPitchKind::kSTP_E_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorSixth:
-          result = msrSemiTonesPitchKind::kSTP_E_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorSixth:
-          result = msrSemiTonesPitchKind::kSTP_E_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSixth:
-          result = msrSemiTonesPitchKind::kSTP_E_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSeventh:
-          result = msrSemiTonesPitchKind::kSTP_F_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorSeventh:
-          result = msrSemiTonesPitchKind::kSTP_F_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorSeventh:
-          result = msrSemiTonesPitchKind::kSTP_F_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSeventh:
-          result = msrSemiTonesPitchKind::kSTP_F_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedOctave:
-          result = msrSemiTonesPitchKind::kSTP_G_Flat;
-          break;
-        case msrIntervalKind::kIntervalPerfectOctave:
-          result = msrSemiTonesPitchKind::kSTP_G_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedOctave:
-          result = msrSemiTonesPitchKind::kSTP_G_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedNinth:
-          result = msrSemiTonesPitchKind::kSTP_A_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorNinth:
-          result = msrSemiTonesPitchKind::kSTP_A_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorNinth:
-          result = msrSemiTonesPitchKind::kSTP_A_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedNinth:
-          result = msrSemiTonesPitchKind::kSTP_A_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedTenth:
-          result = msrSemiTonesPitchKind::kSTP_B_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorTenth:
-          result = msrSemiTonesPitchKind::kSTP_B_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorTenth:
-          result = msrSemiTonesPitchKind::kSTP_B_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedTenth:
-          result = msrSemiTonesPitchKind::kSTP_B_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedEleventh:
-          result = msrSemiTonesPitchKind::kSTP_C_Flat;
-          break;
-        case msrIntervalKind::kIntervalPerfectEleventh:
-          result = msrSemiTonesPitchKind::kSTP_C_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedEleventh:
-          result = msrSemiTonesPitchKind::kSTP_C_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedTwelfth:
-          result = msrSemiTonesPitchKind::kSTP_D_Flat;
-          break;
-        case msrIntervalKind::kIntervalPerfectTwelfth:
-          result = msrSemiTonesPitchKind::kSTP_D_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedTwelfth:
-          result = msrSemiTonesPitchKind::kSTP_D_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedThirteenth:
-          result = msrSemiTonesPitchKind::kSTP_E_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorThirteenth:
-          result = msrSemiTonesPitchKind::kSTP_E_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorThirteenth:
-          result = msrSemiTonesPitchKind::kSTP_E_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedThirteenth:
-          result = msrSemiTonesPitchKind::kSTP_E_Sharp;
-          break;
-      } // switch
-      break;
-
-    case msrSemiTonesPitchKind::kSTP_G_Sharp:
-      switch (intervalKind) {
-        case msrIntervalKind::kInterval_UNKNOWN_:
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedUnisson:
-          result = msrSemiTonesPitchKind::kSTP_G_Natural;
-          break;
-        case msrIntervalKind::kIntervalPerfectUnisson:
-          result = msrSemiTonesPitchKind::kSTP_G_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedUnisson:
-          result = msrSemiTonesPitchKind::kSTP_G_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSecond:
-          result = msrSemiTonesPitchKind::kSTP_A_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorSecond:
-          result = msrSemiTonesPitchKind::kSTP_A_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorSecond:
-          result = msrSemiTonesPitchKind::kSTP_A_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSecond:
-          result = msrSemiTonesPitchKind::kSTP_A_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedThird:
-          result = msrSemiTonesPitchKind::kSTP_B_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorThird:
-          result = msrSemiTonesPitchKind::kSTP_B_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorThird:
-          result = msrSemiTonesPitchKind::kSTP_B_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedThird:
-          result = msrSemiTonesPitchKind::kSTP_B_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedFourth:
-          result = msrSemiTonesPitchKind::kSTP_C_Natural;
-          break;
-        case msrIntervalKind::kIntervalPerfectFourth:
-          result = msrSemiTonesPitchKind::kSTP_C_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedFourth:
-          result = msrSemiTonesPitchKind::kSTP_C_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedFifth:
-          result = msrSemiTonesPitchKind::kSTP_D_Natural;
-          break;
-        case msrIntervalKind::kIntervalPerfectFifth:
-          result = msrSemiTonesPitchKind::kSTP_D_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedFifth:
-          result = msrSemiTonesPitchKind::kSTP_D_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSixth:
-          result = msrSemiTonesPitchKind::kSTP_E_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorSixth:
-          result = msrSemiTonesPitchKind::kSTP_E_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorSixth:
-          result = msrSemiTonesPitchKind::kSTP_E_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSixth:
-          result = msrSemiTonesPitchKind::kSTP_E_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSeventh:
-          result = msrSemiTonesPitchKind::kSTP_F_Natural;
-          break;
-        case msrIntervalKind::kIntervalMinorSeventh:
-          result = msrSemiTonesPitchKind::kSTP_F_Sharp;
-          break;
-        case msrIntervalKind::kIntervalMajorSeventh:
-          result = msrSemiTonesPitchKind::kSTP_F_DoubleSharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSeventh:
-          result = msrSemiTonesPitchKind::kSTP_F_TripleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedOctave:
-          result = msrSemiTonesPitchKind::kSTP_G_Natural;
-          break;
-        case msrIntervalKind::kIntervalPerfectOctave:
-          result = msrSemiTonesPitchKind::kSTP_G_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedOctave:
-          result = msrSemiTonesPitchKind::kSTP_G_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedNinth:
-          result = msrSemiTonesPitchKind::kSTP_A_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorNinth:
-          result = msrSemiTonesPitchKind::kSTP_A_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorNinth:
-          result = msrSemiTonesPitchKind::kSTP_A_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedNinth:
-          result = msrSemiTonesPitchKind::kSTP_A_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedTenth:
-          result = msrSemiTonesPitchKind::kSTP_B_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorTenth:
-          result = msrSemiTonesPitchKind::kSTP_B_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorTenth:
-          result = msrSemiTonesPitchKind::kSTP_B_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedTenth:
-          result = msrSemiTonesPitchKind::kSTP_B_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedEleventh:
-          result = msrSemiTonesPitchKind::kSTP_C_Natural;
-          break;
-        case msrIntervalKind::kIntervalPerfectEleventh:
-          result = msrSemiTonesPitchKind::kSTP_C_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedEleventh:
-          result = msrSemiTonesPitchKind::kSTP_C_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedTwelfth:
-          result = msrSemiTonesPitchKind::kSTP_D_Natural;
-          break;
-        case msrIntervalKind::kIntervalPerfectTwelfth:
-          result = msrSemiTonesPitchKind::kSTP_D_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedTwelfth:
-          result = msrSemiTonesPitchKind::kSTP_D_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedThirteenth:
-          result = msrSemiTonesPitchKind::kSTP_E_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorThirteenth:
-          result = msrSemiTonesPitchKind::kSTP_E_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorThirteenth:
-          result = msrSemiTonesPitchKind::kSTP_E_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedThirteenth:
-          result = msrSemiTonesPitchKind::kSTP_E_DoubleSharp;
-          break;
-      } // switch
-      break;
-
-    case msrSemiTonesPitchKind::kSTP_A_Flat:
-      switch (intervalKind) {
-        case msrIntervalKind::kInterval_UNKNOWN_:
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedUnisson:
-          result = msrSemiTonesPitchKind::kSTP_A_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalPerfectUnisson:
-          result = msrSemiTonesPitchKind::kSTP_A_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedUnisson:
-          result = msrSemiTonesPitchKind::kSTP_A_Natural;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSecond:
-          result = msrSemiTonesPitchKind::kSTP_B_TripleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorSecond:
-          result = msrSemiTonesPitchKind::kSTP_B_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMajorSecond:
-          result = msrSemiTonesPitchKind::kSTP_B_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSecond:
-          result = msrSemiTonesPitchKind::kSTP_B_Natural;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedThird:
-          result = msrSemiTonesPitchKind::kSTP_C_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorThird:
-          result = msrSemiTonesPitchKind::kSTP_C_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorThird:
-          result = msrSemiTonesPitchKind::kSTP_C_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedThird:
-          result = msrSemiTonesPitchKind::kSTP_C_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedFourth:
-          result = msrSemiTonesPitchKind::kSTP_D_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalPerfectFourth:
-          result = msrSemiTonesPitchKind::kSTP_D_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedFourth:
-          result = msrSemiTonesPitchKind::kSTP_D_Natural;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedFifth:
-          result = msrSemiTonesPitchKind::kSTP_E_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalPerfectFifth:
-          result = msrSemiTonesPitchKind::kSTP_E_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedFifth:
-          result = msrSemiTonesPitchKind::kSTP_E_Natural;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSixth:
-          result = msrSemiTonesPitchKind::kSTP_F_DoubleleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorSixth:
-          result = msrSemiTonesPitchKind::kSTP_F_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorSixth:
-          result = msrSemiTonesPitchKind::kSTP_F_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSixth:
-          result = msrSemiTonesPitchKind::kSTP_F_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSeventh:
-          result = msrSemiTonesPitchKind::kSTP_G_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorSeventh:
-          result = msrSemiTonesPitchKind::kSTP_G_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorSeventh:
-          result = msrSemiTonesPitchKind::kSTP_G_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSeventh:
-          result = msrSemiTonesPitchKind::kSTP_G_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedOctave:
-          result = msrSemiTonesPitchKind::kSTP_A_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalPerfectOctave:
-          result = msrSemiTonesPitchKind::kSTP_A_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedOctave:
-          result = msrSemiTonesPitchKind::kSTP_A_Natural;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedNinth:
-          result = msrSemiTonesPitchKind::kSTP_B_TripleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorNinth:
-          result = msrSemiTonesPitchKind::kSTP_B_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMajorNinth:
-          result = msrSemiTonesPitchKind::kSTP_B_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedNinth:
-          result = msrSemiTonesPitchKind::kSTP_B_Natural;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedTenth:
-          result = msrSemiTonesPitchKind::kSTP_C_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorTenth:
-          result = msrSemiTonesPitchKind::kSTP_C_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorTenth:
-          result = msrSemiTonesPitchKind::kSTP_C_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedTenth:
-          result = msrSemiTonesPitchKind::kSTP_C_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedEleventh:
-          result = msrSemiTonesPitchKind::kSTP_D_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalPerfectEleventh:
-          result = msrSemiTonesPitchKind::kSTP_D_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedEleventh:
-          result = msrSemiTonesPitchKind::kSTP_D_Natural;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedTwelfth:
-          result = msrSemiTonesPitchKind::kSTP_E_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalPerfectTwelfth:
-          result = msrSemiTonesPitchKind::kSTP_E_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedTwelfth:
-          result = msrSemiTonesPitchKind::kSTP_E_Natural;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedThirteenth:
-          result = msrSemiTonesPitchKind::kSTP_F_TripleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorThirteenth:
-          result = msrSemiTonesPitchKind::kSTP_F_DoubleleFlat;
-          break;
-        case msrIntervalKind::kIntervalMajorThirteenth:
-          result = msrSemiTonesPitchKind::kSTP_F_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedThirteenth:
-          result = msrSemiTonesPitchKind::kSTP_F_Natural;
-          break;
-      } // switch
-      break;
-
-    case msrSemiTonesPitchKind::kSTP_A_Natural:
-      switch (intervalKind) {
-        case msrIntervalKind::kInterval_UNKNOWN_:
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedUnisson:
-          result = msrSemiTonesPitchKind::kSTP_A_Flat;
-          break;
-        case msrIntervalKind::kIntervalPerfectUnisson:
-          result = msrSemiTonesPitchKind::kSTP_A_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedUnisson:
-          result = msrSemiTonesPitchKind::kSTP_A_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSecond:
-          result = msrSemiTonesPitchKind::kSTP_B_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorSecond:
-          result = msrSemiTonesPitchKind::kSTP_B_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorSecond:
-          result = msrSemiTonesPitchKind::kSTP_B_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSecond:
-          result = msrSemiTonesPitchKind::kSTP_B_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedThird:
-          result = msrSemiTonesPitchKind::kSTP_C_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorThird:
-          result = msrSemiTonesPitchKind::kSTP_C_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorThird:
-          result = msrSemiTonesPitchKind::kSTP_C_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedThird:
-          result = msrSemiTonesPitchKind::kSTP_C_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedFourth:
-          result = msrSemiTonesPitchKind::kSTP_D_Flat;
-          break;
-        case msrIntervalKind::kIntervalPerfectFourth:
-          result = msrSemiTonesPitchKind::kSTP_D_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedFourth:
-          result = msrSemiTonesPitchKind::kSTP_D_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedFifth:
-          result = msrSemiTonesPitchKind::kSTP_E_Flat;
-          break;
-        case msrIntervalKind::kIntervalPerfectFifth:
-          result = msrSemiTonesPitchKind::kSTP_E_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedFifth:
-          result = msrSemiTonesPitchKind::kSTP_E_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSixth:
-          result = msrSemiTonesPitchKind::kSTP_F_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorSixth:
-          result = msrSemiTonesPitchKind::kSTP_F_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorSixth:
-          result = msrSemiTonesPitchKind::kSTP_F_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSixth:
-          result = msrSemiTonesPitchKind::kSTP_F_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSeventh:
-          result = msrSemiTonesPitchKind::kSTP_G_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorSeventh:
-          result = msrSemiTonesPitchKind::kSTP_G_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorSeventh:
-          result = msrSemiTonesPitchKind::kSTP_G_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSeventh:
-          result = msrSemiTonesPitchKind::kSTP_G_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedOctave:
-          result = msrSemiTonesPitchKind::kSTP_A_Flat;
-          break;
-        case msrIntervalKind::kIntervalPerfectOctave:
-          result = msrSemiTonesPitchKind::kSTP_A_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedOctave:
-          result = msrSemiTonesPitchKind::kSTP_A_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedNinth:
-          result = msrSemiTonesPitchKind::kSTP_B_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorNinth:
-          result = msrSemiTonesPitchKind::kSTP_B_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorNinth:
-          result = msrSemiTonesPitchKind::kSTP_B_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedNinth:
-          result = msrSemiTonesPitchKind::kSTP_B_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedTenth:
-          result = msrSemiTonesPitchKind::kSTP_C_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorTenth:
-          result = msrSemiTonesPitchKind::kSTP_C_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorTenth:
-          result = msrSemiTonesPitchKind::kSTP_C_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedTenth:
-          result = msrSemiTonesPitchKind::kSTP_C_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedEleventh:
-          result = msrSemiTonesPitchKind::kSTP_D_Flat;
-          break;
-        case msrIntervalKind::kIntervalPerfectEleventh:
-          result = msrSemiTonesPitchKind::kSTP_D_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedEleventh:
-          result = msrSemiTonesPitchKind::kSTP_D_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedTwelfth:
-          result = msrSemiTonesPitchKind::kSTP_E_Flat;
-          break;
-        case msrIntervalKind::kIntervalPerfectTwelfth:
-          result = msrSemiTonesPitchKind::kSTP_E_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedTwelfth:
-          result = msrSemiTonesPitchKind::kSTP_E_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedThirteenth:
-          result = msrSemiTonesPitchKind::kSTP_F_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorThirteenth:
-          result = msrSemiTonesPitchKind::kSTP_F_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorThirteenth:
-          result = msrSemiTonesPitchKind::kSTP_F_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedThirteenth:
-          result = msrSemiTonesPitchKind::kSTP_F_DoubleSharp;
-          break;
-      } // switch
-      break;
-
-    case msrSemiTonesPitchKind::kSTP_A_Sharp:
-      switch (intervalKind) {
-        case msrIntervalKind::kInterval_UNKNOWN_:
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedUnisson:
-          result = msrSemiTonesPitchKind::kSTP_A_Natural;
-          break;
-        case msrIntervalKind::kIntervalPerfectUnisson:
-          result = msrSemiTonesPitchKind::kSTP_A_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedUnisson:
-          result = msrSemiTonesPitchKind::kSTP_A_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSecond:
-          result = msrSemiTonesPitchKind::kSTP_B_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorSecond:
-          result = msrSemiTonesPitchKind::kSTP_B_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorSecond:
-          result = msrSemiTonesPitchKind::kSTP_B_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSecond:
-          result = msrSemiTonesPitchKind::kSTP_B_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedThird:
-          result = msrSemiTonesPitchKind::kSTP_C_Natural;
-          break;
-        case msrIntervalKind::kIntervalMinorThird:
-          result = msrSemiTonesPitchKind::kSTP_C_Sharp;
-          break;
-        case msrIntervalKind::kIntervalMajorThird:
-          result = msrSemiTonesPitchKind::kSTP_C_DoubleSharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedThird:
-          result = msrSemiTonesPitchKind::kSTP_C_TripleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedFourth:
-          result = msrSemiTonesPitchKind::kSTP_D_Natural;
-          break;
-        case msrIntervalKind::kIntervalPerfectFourth:
-          result = msrSemiTonesPitchKind::kSTP_D_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedFourth:
-          result = msrSemiTonesPitchKind::kSTP_D_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedFifth:
-          result = msrSemiTonesPitchKind::kSTP_E_Natural;
-          break;
-        case msrIntervalKind::kIntervalPerfectFifth:
-          result = msrSemiTonesPitchKind::kSTP_E_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedFifth:
-          result = msrSemiTonesPitchKind::kSTP_E_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSixth:
-          result = msrSemiTonesPitchKind::kSTP_F_Natural;
-          break;
-        case msrIntervalKind::kIntervalMinorSixth:
-          result = msrSemiTonesPitchKind::kSTP_F_Sharp;
-          break;
-        case msrIntervalKind::kIntervalMajorSixth:
-          result = msrSemiTonesPitchKind::kSTP_F_DoubleSharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSixth:
-          result = msrSemiTonesPitchKind::kSTP_F_TripleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSeventh:
-          result = msrSemiTonesPitchKind::kSTP_G_Natural;
-          break;
-        case msrIntervalKind::kIntervalMinorSeventh:
-          result = msrSemiTonesPitchKind::kSTP_G_Sharp;
-          break;
-        case msrIntervalKind::kIntervalMajorSeventh:
-          result = msrSemiTonesPitchKind::kSTP_G_DoubleSharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSeventh:
-          result = msrSemiTonesPitchKind::kSTP_G_TripleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedOctave:
-          result = msrSemiTonesPitchKind::kSTP_A_Natural;
-          break;
-        case msrIntervalKind::kIntervalPerfectOctave:
-          result = msrSemiTonesPitchKind::kSTP_A_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedOctave:
-          result = msrSemiTonesPitchKind::kSTP_A_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedNinth:
-          result = msrSemiTonesPitchKind::kSTP_B_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorNinth:
-          result = msrSemiTonesPitchKind::kSTP_B_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorNinth:
-          result = msrSemiTonesPitchKind::kSTP_B_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedNinth:
-          result = msrSemiTonesPitchKind::kSTP_B_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedTenth:
-          result = msrSemiTonesPitchKind::kSTP_C_Natural;
-          break;
-        case msrIntervalKind::kIntervalMinorTenth:
-          result = msrSemiTonesPitchKind::kSTP_C_Sharp;
-          break;
-        case msrIntervalKind::kIntervalMajorTenth:
-          result = msrSemiTonesPitchKind::kSTP_C_DoubleSharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedTenth:
-          result = msrSemiTonesPitchKind::kSTP_C_TripleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedEleventh:
-          result = msrSemiTonesPitchKind::kSTP_D_Natural;
-          break;
-        case msrIntervalKind::kIntervalPerfectEleventh:
-          result = msrSemiTonesPitchKind::kSTP_D_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedEleventh:
-          result = msrSemiTonesPitchKind::kSTP_D_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedTwelfth:
-          result = msrSemiTonesPitchKind::kSTP_E_Natural;
-          break;
-        case msrIntervalKind::kIntervalPerfectTwelfth:
-          result = msrSemiTonesPitchKind::kSTP_E_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedTwelfth:
-          result = msrSemiTonesPitchKind::kSTP_E_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedThirteenth:
-          result = msrSemiTonesPitchKind::kSTP_F_Natural;
-          break;
-        case msrIntervalKind::kIntervalMinorThirteenth:
-          result = msrSemiTonesPitchKind::kSTP_F_Sharp;
-          break;
-        case msrIntervalKind::kIntervalMajorThirteenth:
-          result = msrSemiTonesPitchKind::kSTP_F_DoubleSharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedThirteenth:
-          result = msrSemiTonesPitchKind::kSTP_F_TripleSharp;
-          break;
-      } // switch
-      break;
-
-    case msrSemiTonesPitchKind::kSTP_B_Flat:
-      switch (intervalKind) {
-        case msrIntervalKind::kInterval_UNKNOWN_:
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedUnisson:
-          result = msrSemiTonesPitchKind::kSTP_B_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalPerfectUnisson:
-          result = msrSemiTonesPitchKind::kSTP_B_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedUnisson:
-          result = msrSemiTonesPitchKind::kSTP_B_Natural;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSecond:
-          result = msrSemiTonesPitchKind::kSTP_C_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorSecond:
-          result = msrSemiTonesPitchKind::kSTP_C_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorSecond:
-          result = msrSemiTonesPitchKind::kSTP_C_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSecond:
-          result = msrSemiTonesPitchKind::kSTP_C_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedThird:
-          result = msrSemiTonesPitchKind::kSTP_D_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorThird:
-          result = msrSemiTonesPitchKind::kSTP_D_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorThird:
-          result = msrSemiTonesPitchKind::kSTP_D_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedThird:
-          result = msrSemiTonesPitchKind::kSTP_D_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedFourth:
-          result = msrSemiTonesPitchKind::kSTP_E_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalPerfectFourth:
-          result = msrSemiTonesPitchKind::kSTP_E_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedFourth:
-          result = msrSemiTonesPitchKind::kSTP_E_Natural;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedFifth:
-          result = msrSemiTonesPitchKind::kSTP_F_Flat;
-          break;
-        case msrIntervalKind::kIntervalPerfectFifth:
-          result = msrSemiTonesPitchKind::kSTP_F_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedFifth:
-          result = msrSemiTonesPitchKind::kSTP_F_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSixth:
-          result = msrSemiTonesPitchKind::kSTP_G_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorSixth:
-          result = msrSemiTonesPitchKind::kSTP_G_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorSixth:
-          result = msrSemiTonesPitchKind::kSTP_G_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSixth:
-          result = msrSemiTonesPitchKind::kSTP_G_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSeventh:
-          result = msrSemiTonesPitchKind::kSTP_A_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorSeventh:
-          result = msrSemiTonesPitchKind::kSTP_A_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorSeventh:
-          result = msrSemiTonesPitchKind::kSTP_A_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSeventh:
-          result = msrSemiTonesPitchKind::kSTP_A_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedOctave:
-          result = msrSemiTonesPitchKind::kSTP_B_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalPerfectOctave:
-          result = msrSemiTonesPitchKind::kSTP_B_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedOctave:
-          result = msrSemiTonesPitchKind::kSTP_B_Natural;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedNinth:
-          result = msrSemiTonesPitchKind::kSTP_C_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorNinth:
-          result = msrSemiTonesPitchKind::kSTP_C_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorNinth:
-          result = msrSemiTonesPitchKind::kSTP_C_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedNinth:
-          result = msrSemiTonesPitchKind::kSTP_C_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedTenth:
-          result = msrSemiTonesPitchKind::kSTP_D_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorTenth:
-          result = msrSemiTonesPitchKind::kSTP_D_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorTenth:
-          result = msrSemiTonesPitchKind::kSTP_D_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedTenth:
-          result = msrSemiTonesPitchKind::kSTP_D_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedEleventh:
-          result = msrSemiTonesPitchKind::kSTP_E_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalPerfectEleventh:
-          result = msrSemiTonesPitchKind::kSTP_E_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedEleventh:
-          result = msrSemiTonesPitchKind::kSTP_E_Natural;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedTwelfth:
-          result = msrSemiTonesPitchKind::kSTP_F_Flat;
-          break;
-        case msrIntervalKind::kIntervalPerfectTwelfth:
-          result = msrSemiTonesPitchKind::kSTP_F_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedTwelfth:
-          result = msrSemiTonesPitchKind::kSTP_F_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedThirteenth:
-          result = msrSemiTonesPitchKind::kSTP_G_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorThirteenth:
-          result = msrSemiTonesPitchKind::kSTP_G_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorThirteenth:
-          result = msrSemiTonesPitchKind::kSTP_G_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedThirteenth:
-          result = msrSemiTonesPitchKind::kSTP_G_Sharp;
-          break;
-      } // switch
-      break;
-
-    case msrSemiTonesPitchKind::kSTP_B_Natural:
-      switch (intervalKind) {
-        case msrIntervalKind::kInterval_UNKNOWN_:
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedUnisson:
-          result = msrSemiTonesPitchKind::kSTP_B_Flat;
-          break;
-        case msrIntervalKind::kIntervalPerfectUnisson:
-          result = msrSemiTonesPitchKind::kSTP_B_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedUnisson:
-          result = msrSemiTonesPitchKind::kSTP_B_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSecond:
-          result = msrSemiTonesPitchKind::kSTP_C_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorSecond:
-          result = msrSemiTonesPitchKind::kSTP_C_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorSecond:
-          result = msrSemiTonesPitchKind::kSTP_C_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSecond:
-          result = msrSemiTonesPitchKind::kSTP_C_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedThird:
-          result = msrSemiTonesPitchKind::kSTP_D_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorThird:
-          result = msrSemiTonesPitchKind::kSTP_D_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorThird:
-          result = msrSemiTonesPitchKind::kSTP_D_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedThird:
-          result = msrSemiTonesPitchKind::kSTP_D_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedFourth:
-          result = msrSemiTonesPitchKind::kSTP_E_Flat;
-          break;
-        case msrIntervalKind::kIntervalPerfectFourth:
-          result = msrSemiTonesPitchKind::kSTP_E_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedFourth:
-          result = msrSemiTonesPitchKind::kSTP_E_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedFifth:
-          result = msrSemiTonesPitchKind::kSTP_F_Natural;
-          break;
-        case msrIntervalKind::kIntervalPerfectFifth:
-          result = msrSemiTonesPitchKind::kSTP_F_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedFifth:
-          result = msrSemiTonesPitchKind::kSTP_F_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSixth:
-          result = msrSemiTonesPitchKind::kSTP_G_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorSixth:
-          result = msrSemiTonesPitchKind::kSTP_G_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorSixth:
-          result = msrSemiTonesPitchKind::kSTP_G_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSixth:
-          result = msrSemiTonesPitchKind::kSTP_G_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSeventh:
-          result = msrSemiTonesPitchKind::kSTP_A_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorSeventh:
-          result = msrSemiTonesPitchKind::kSTP_A_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorSeventh:
-          result = msrSemiTonesPitchKind::kSTP_A_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSeventh:
-          result = msrSemiTonesPitchKind::kSTP_A_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedOctave:
-          result = msrSemiTonesPitchKind::kSTP_B_Flat;
-          break;
-        case msrIntervalKind::kIntervalPerfectOctave:
-          result = msrSemiTonesPitchKind::kSTP_B_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedOctave:
-          result = msrSemiTonesPitchKind::kSTP_B_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedNinth:
-          result = msrSemiTonesPitchKind::kSTP_C_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorNinth:
-          result = msrSemiTonesPitchKind::kSTP_C_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorNinth:
-          result = msrSemiTonesPitchKind::kSTP_C_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedNinth:
-          result = msrSemiTonesPitchKind::kSTP_C_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedTenth:
-          result = msrSemiTonesPitchKind::kSTP_D_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorTenth:
-          result = msrSemiTonesPitchKind::kSTP_D_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorTenth:
-          result = msrSemiTonesPitchKind::kSTP_D_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedTenth:
-          result = msrSemiTonesPitchKind::kSTP_D_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedEleventh:
-          result = msrSemiTonesPitchKind::kSTP_E_Flat;
-          break;
-        case msrIntervalKind::kIntervalPerfectEleventh:
-          result = msrSemiTonesPitchKind::kSTP_E_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedEleventh:
-          result = msrSemiTonesPitchKind::kSTP_E_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedTwelfth:
-          result = msrSemiTonesPitchKind::kSTP_F_Natural;
-          break;
-        case msrIntervalKind::kIntervalPerfectTwelfth:
-          result = msrSemiTonesPitchKind::kSTP_F_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedTwelfth:
-          result = msrSemiTonesPitchKind::kSTP_F_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedThirteenth:
-          result = msrSemiTonesPitchKind::kSTP_G_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorThirteenth:
-          result = msrSemiTonesPitchKind::kSTP_G_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorThirteenth:
-          result = msrSemiTonesPitchKind::kSTP_G_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedThirteenth:
-          result = msrSemiTonesPitchKind::kSTP_G_DoubleSharp;
-          break;
-      } // switch
-      break;
-
-    case msrSemiTonesPitchKind::kSTP_B_Sharp:
-      switch (intervalKind) {
-        case msrIntervalKind::kInterval_UNKNOWN_:
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedUnisson:
-          result = msrSemiTonesPitchKind::kSTP_B_Natural;
-          break;
-        case msrIntervalKind::kIntervalPerfectUnisson:
-          result = msrSemiTonesPitchKind::kSTP_B_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedUnisson:
-          result = msrSemiTonesPitchKind::kSTP_B_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSecond:
-          result = msrSemiTonesPitchKind::kSTP_C_Natural;
-          break;
-        case msrIntervalKind::kIntervalMinorSecond:
-          result = msrSemiTonesPitchKind::kSTP_C_Sharp;
-          break;
-        case msrIntervalKind::kIntervalMajorSecond:
-          result = msrSemiTonesPitchKind::kSTP_C_DoubleSharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSecond:
-          result = msrSemiTonesPitchKind::kSTP_C_TripleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedThird:
-          result = msrSemiTonesPitchKind::kSTP_D_Natural;
-          break;
-        case msrIntervalKind::kIntervalMinorThird:
-          result = msrSemiTonesPitchKind::kSTP_D_Sharp;
-          break;
-        case msrIntervalKind::kIntervalMajorThird:
-          result = msrSemiTonesPitchKind::kSTP_D_DoubleSharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedThird:
-          result = msrSemiTonesPitchKind::kSTP_D_TripleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedFourth:
-          result = msrSemiTonesPitchKind::kSTP_E_Natural;
-          break;
-        case msrIntervalKind::kIntervalPerfectFourth:
-          result = msrSemiTonesPitchKind::kSTP_E_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedFourth:
-          result = msrSemiTonesPitchKind::kSTP_E_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedFifth:
-          result = msrSemiTonesPitchKind::kSTP_F_Sharp;
-          break;
-        case msrIntervalKind::kIntervalPerfectFifth:
-          result = msrSemiTonesPitchKind::kSTP_F_DoubleSharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedFifth:
-          result = msrSemiTonesPitchKind::kSTP_F_TripleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSixth:
-          result = msrSemiTonesPitchKind::kSTP_G_Natural;
-          break;
-        case msrIntervalKind::kIntervalMinorSixth:
-          result = msrSemiTonesPitchKind::kSTP_G_Sharp;
-          break;
-        case msrIntervalKind::kIntervalMajorSixth:
-          result = msrSemiTonesPitchKind::kSTP_G_DoubleSharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSixth:
-          result = msrSemiTonesPitchKind::kSTP_G_TripleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSeventh:
-          result = msrSemiTonesPitchKind::kSTP_A_Natural;
-          break;
-        case msrIntervalKind::kIntervalMinorSeventh:
-          result = msrSemiTonesPitchKind::kSTP_A_Sharp;
-          break;
-        case msrIntervalKind::kIntervalMajorSeventh:
-          result = msrSemiTonesPitchKind::kSTP_A_DoubleSharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSeventh:
-          result = msrSemiTonesPitchKind::kSTP_A_TripleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedOctave:
-          result = msrSemiTonesPitchKind::kSTP_B_Natural;
-          break;
-        case msrIntervalKind::kIntervalPerfectOctave:
-          result = msrSemiTonesPitchKind::kSTP_B_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedOctave:
-          result = msrSemiTonesPitchKind::kSTP_B_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedNinth:
-          result = msrSemiTonesPitchKind::kSTP_C_Natural;
-          break;
-        case msrIntervalKind::kIntervalMinorNinth:
-          result = msrSemiTonesPitchKind::kSTP_C_Sharp;
-          break;
-        case msrIntervalKind::kIntervalMajorNinth:
-          result = msrSemiTonesPitchKind::kSTP_C_DoubleSharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedNinth:
-          result = msrSemiTonesPitchKind::kSTP_C_TripleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedTenth:
-          result = msrSemiTonesPitchKind::kSTP_D_Natural;
-          break;
-        case msrIntervalKind::kIntervalMinorTenth:
-          result = msrSemiTonesPitchKind::kSTP_D_Sharp;
-          break;
-        case msrIntervalKind::kIntervalMajorTenth:
-          result = msrSemiTonesPitchKind::kSTP_D_DoubleSharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedTenth:
-          result = msrSemiTonesPitchKind::kSTP_D_TripleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedEleventh:
-          result = msrSemiTonesPitchKind::kSTP_E_Natural;
-          break;
-        case msrIntervalKind::kIntervalPerfectEleventh:
-          result = msrSemiTonesPitchKind::kSTP_E_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedEleventh:
-          result = msrSemiTonesPitchKind::kSTP_E_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedTwelfth:
-          result = msrSemiTonesPitchKind::kSTP_F_Sharp;
-          break;
-        case msrIntervalKind::kIntervalPerfectTwelfth:
-          result = msrSemiTonesPitchKind::kSTP_F_DoubleSharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedTwelfth:
-          result = msrSemiTonesPitchKind::kSTP_F_TripleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedThirteenth:
-          result = msrSemiTonesPitchKind::kSTP_G_Natural;
-          break;
-        case msrIntervalKind::kIntervalMinorThirteenth:
-          result = msrSemiTonesPitchKind::kSTP_G_Sharp;
-          break;
-        case msrIntervalKind::kIntervalMajorThirteenth:
-          result = msrSemiTonesPitchKind::kSTP_G_DoubleSharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedThirteenth:
-          result = msrSemiTonesPitchKind::kSTP_G_TripleSharp;
-          break;
-      } // switch
-      break;
-
-      default:
-      {
-        // computing intervals on double or triple flats/sharps
-        // is not considered useful, hence not supported
-        std::stringstream ss;
-
-        ss <<
-          "Sorry, computing intervals from semitones pitch '" <<
-          msrSemiTonesPitchKindAsString (semiTonesPitchKind) <<
-          '(' << msrSemiTonesPitchKindAsString (semiTonesPitchKind) << ")" <<
-          "' is not supported"
-          ", line: " << inputLineNumber;
-
-        msrUnsupported (
-          gServiceRunData->getInputSourceName (),
-          inputLineNumber,
-          __FILE__, mfInputLineNumber (__LINE__),
-          ss.str ());
-      }
-  } // switch
-
-  return result;
-}
-
-msrQuarterTonesPitchKind noteAtIntervalFromQuarterTonesPitch (
-  const mfInputLineNumber& inputLineNumber,
-  msrIntervalKind          intervalKind,
-  msrQuarterTonesPitchKind quarterTonesPitchKind)
-{
-  msrQuarterTonesPitchKind result = msrQuarterTonesPitchKind::kQTP_UNKNOWN_;
-
-  switch (quarterTonesPitchKind) {
-    case msrQuarterTonesPitchKind::kQTP_UNKNOWN_:
-      result = msrQuarterTonesPitchKind::kQTP_UNKNOWN_;
-      break;
-
-    case msrQuarterTonesPitchKind::kQTP_C_Flat:
-      break;
-
-    case msrQuarterTonesPitchKind::kQTP_C_Natural:
-      switch (intervalKind) {
-        case msrIntervalKind::kInterval_UNKNOWN_:
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedUnisson:
-          result = msrQuarterTonesPitchKind::kQTP_C_Flat;
-          break;
-        case msrIntervalKind::kIntervalPerfectUnisson:
-          result = msrQuarterTonesPitchKind::kQTP_C_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedUnisson:
-          result = msrQuarterTonesPitchKind::kQTP_C_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSecond:
-          result = msrQuarterTonesPitchKind::kQTP_D_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorSecond:
-          result = msrQuarterTonesPitchKind::kQTP_D_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorSecond:
-          result = msrQuarterTonesPitchKind::kQTP_D_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSecond:
-          result = msrQuarterTonesPitchKind::kQTP_D_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedThird:
-          result = msrQuarterTonesPitchKind::kQTP_E_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorThird:
-          result = msrQuarterTonesPitchKind::kQTP_E_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorThird:
-          result = msrQuarterTonesPitchKind::kQTP_E_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedThird:
-          result = msrQuarterTonesPitchKind::kQTP_E_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedFourth:
-          result = msrQuarterTonesPitchKind::kQTP_F_Flat;
-          break;
-        case msrIntervalKind::kIntervalPerfectFourth:
-          result = msrQuarterTonesPitchKind::kQTP_F_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedFourth:
-          result = msrQuarterTonesPitchKind::kQTP_F_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedFifth:
-          result = msrQuarterTonesPitchKind::kQTP_G_Flat;
-          break;
-        case msrIntervalKind::kIntervalPerfectFifth:
-          result = msrQuarterTonesPitchKind::kQTP_G_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedFifth:
-          result = msrQuarterTonesPitchKind::kQTP_G_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSixth:
-          result = msrQuarterTonesPitchKind::kQTP_A_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorSixth:
-          result = msrQuarterTonesPitchKind::kQTP_A_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorSixth:
-          result = msrQuarterTonesPitchKind::kQTP_A_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSixth:
-          result = msrQuarterTonesPitchKind::kQTP_A_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSeventh:
-          result = msrQuarterTonesPitchKind::kQTP_B_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorSeventh:
-          result = msrQuarterTonesPitchKind::kQTP_B_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorSeventh:
-          result = msrQuarterTonesPitchKind::kQTP_B_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSeventh:
-          result = msrQuarterTonesPitchKind::kQTP_B_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedOctave:
-          result = msrQuarterTonesPitchKind::kQTP_C_Flat;
-          break;
-        case msrIntervalKind::kIntervalPerfectOctave:
-          result = msrQuarterTonesPitchKind::kQTP_C_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedOctave:
-          result = msrQuarterTonesPitchKind::kQTP_C_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedNinth:
-          result = msrQuarterTonesPitchKind::kQTP_D_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorNinth:
-          result = msrQuarterTonesPitchKind::kQTP_D_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorNinth:
-          result = msrQuarterTonesPitchKind::kQTP_D_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedNinth:
-          result = msrQuarterTonesPitchKind::kQTP_D_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedTenth:
-          result = msrQuarterTonesPitchKind::kQTP_E_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorTenth:
-          result = msrQuarterTonesPitchKind::kQTP_E_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorTenth:
-          result = msrQuarterTonesPitchKind::kQTP_E_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedTenth:
-          result = msrQuarterTonesPitchKind::kQTP_E_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedEleventh:
-          result = msrQuarterTonesPitchKind::kQTP_F_Flat;
-          break;
-        case msrIntervalKind::kIntervalPerfectEleventh:
-          result = msrQuarterTonesPitchKind::kQTP_F_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedEleventh:
-          result = msrQuarterTonesPitchKind::kQTP_F_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedTwelfth:
-          result = msrQuarterTonesPitchKind::kQTP_G_Flat;
-          break;
-        case msrIntervalKind::kIntervalPerfectTwelfth:
-          result = msrQuarterTonesPitchKind::kQTP_G_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedTwelfth:
-          result = msrQuarterTonesPitchKind::kQTP_G_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedThirteenth:
-          result = msrQuarterTonesPitchKind::kQTP_A_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorThirteenth:
-          result = msrQuarterTonesPitchKind::kQTP_A_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorThirteenth:
-          result = msrQuarterTonesPitchKind::kQTP_A_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedThirteenth:
-          result = msrQuarterTonesPitchKind::kQTP_G_Sharp;
-          break;
-      } // switch
-      break;
-
-    case msrQuarterTonesPitchKind::kQTP_C_Sharp:
-      switch (intervalKind) {
-        case msrIntervalKind::kInterval_UNKNOWN_:
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedUnisson:
-          result = msrQuarterTonesPitchKind::kQTP_C_Natural;
-          break;
-        case msrIntervalKind::kIntervalPerfectUnisson:
-          result = msrQuarterTonesPitchKind::kQTP_C_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedUnisson:
-          result = msrQuarterTonesPitchKind::kQTP_C_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSecond:
-          result = msrQuarterTonesPitchKind::kQTP_D_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorSecond:
-          result = msrQuarterTonesPitchKind::kQTP_D_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorSecond:
-          result = msrQuarterTonesPitchKind::kQTP_D_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSecond:
-          result = msrQuarterTonesPitchKind::kQTP_D_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedThird:
-          result = msrQuarterTonesPitchKind::kQTP_E_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorThird:
-          result = msrQuarterTonesPitchKind::kQTP_E_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorThird:
-          result = msrQuarterTonesPitchKind::kQTP_E_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedThird:
-          result = msrQuarterTonesPitchKind::kQTP_E_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedFourth:
-          result = msrQuarterTonesPitchKind::kQTP_F_Natural;
-          break;
-        case msrIntervalKind::kIntervalPerfectFourth:
-          result = msrQuarterTonesPitchKind::kQTP_F_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedFourth:
-          result = msrQuarterTonesPitchKind::kQTP_F_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedFifth:
-          result = msrQuarterTonesPitchKind::kQTP_G_Natural;
-          break;
-        case msrIntervalKind::kIntervalPerfectFifth:
-          result = msrQuarterTonesPitchKind::kQTP_G_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedFifth:
-          result = msrQuarterTonesPitchKind::kQTP_G_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSixth:
-          result = msrQuarterTonesPitchKind::kQTP_A_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorSixth:
-          result = msrQuarterTonesPitchKind::kQTP_A_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorSixth:
-          result = msrQuarterTonesPitchKind::kQTP_A_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSixth:
-          result = msrQuarterTonesPitchKind::kQTP_A_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSeventh:
-          result = msrQuarterTonesPitchKind::kQTP_B_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorSeventh:
-          result = msrQuarterTonesPitchKind::kQTP_B_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorSeventh:
-          result = msrQuarterTonesPitchKind::kQTP_B_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSeventh:
-          result = msrQuarterTonesPitchKind::kQTP_B_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedOctave:
-          result = msrQuarterTonesPitchKind::kQTP_C_Natural;
-          break;
-        case msrIntervalKind::kIntervalPerfectOctave:
-          result = msrQuarterTonesPitchKind::kQTP_C_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedOctave:
-          result = msrQuarterTonesPitchKind::kQTP_C_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedNinth:
-          result = msrQuarterTonesPitchKind::kQTP_D_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorNinth:
-          result = msrQuarterTonesPitchKind::kQTP_D_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorNinth:
-          result = msrQuarterTonesPitchKind::kQTP_D_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedNinth:
-          result = msrQuarterTonesPitchKind::kQTP_D_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedTenth:
-          result = msrQuarterTonesPitchKind::kQTP_E_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorTenth:
-          result = msrQuarterTonesPitchKind::kQTP_E_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorTenth:
-          result = msrQuarterTonesPitchKind::kQTP_E_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedTenth:
-          result = msrQuarterTonesPitchKind::kQTP_E_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedEleventh:
-          result = msrQuarterTonesPitchKind::kQTP_F_Natural;
-          break;
-        case msrIntervalKind::kIntervalPerfectEleventh:
-          result = msrQuarterTonesPitchKind::kQTP_F_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedEleventh:
-          result = msrQuarterTonesPitchKind::kQTP_F_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedTwelfth:
-          result = msrQuarterTonesPitchKind::kQTP_G_Natural;
-          break;
-        case msrIntervalKind::kIntervalPerfectTwelfth:
-          result = msrQuarterTonesPitchKind::kQTP_G_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedTwelfth:
-          result = msrQuarterTonesPitchKind::kQTP_G_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedThirteenth:
-          result = msrQuarterTonesPitchKind::kQTP_A_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorThirteenth:
-          result = msrQuarterTonesPitchKind::kQTP_A_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorThirteenth:
-          result = msrQuarterTonesPitchKind::kQTP_A_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedThirteenth:
-          result = msrQuarterTonesPitchKind::kQTP_A_DoubleSharp;
-          break;
-      } // switch
-      break;
-
-    case msrQuarterTonesPitchKind::kQTP_D_Flat:
-      switch (intervalKind) {
-        case msrIntervalKind::kInterval_UNKNOWN_:
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedUnisson:
-          result = msrQuarterTonesPitchKind::kQTP_D_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalPerfectUnisson:
-          result = msrQuarterTonesPitchKind::kQTP_D_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedUnisson:
-          result = msrQuarterTonesPitchKind::kQTP_D_Natural;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSecond:
-          result = msrQuarterTonesPitchKind::kQTP_E_TripleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorSecond:
-          result = msrQuarterTonesPitchKind::kQTP_E_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMajorSecond:
-          result = msrQuarterTonesPitchKind::kQTP_E_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSecond:
-          result = msrQuarterTonesPitchKind::kQTP_E_Natural;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedThird:
-          result = msrQuarterTonesPitchKind::kQTP_F_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorThird:
-          result = msrQuarterTonesPitchKind::kQTP_F_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorThird:
-          result = msrQuarterTonesPitchKind::kQTP_F_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedThird:
-          result = msrQuarterTonesPitchKind::kQTP_F_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedFourth:
-          result = msrQuarterTonesPitchKind::kQTP_G_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalPerfectFourth:
-          result = msrQuarterTonesPitchKind::kQTP_G_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedFourth:
-          result = msrQuarterTonesPitchKind::kQTP_G_Natural;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedFifth:
-          result = msrQuarterTonesPitchKind::kQTP_A_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalPerfectFifth:
-          result = msrQuarterTonesPitchKind::kQTP_A_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedFifth:
-          result = msrQuarterTonesPitchKind::kQTP_A_Natural;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSixth:
-          result = msrQuarterTonesPitchKind::kQTP_B_TripleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorSixth:
-          result = msrQuarterTonesPitchKind::kQTP_B_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMajorSixth:
-          result = msrQuarterTonesPitchKind::kQTP_B_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSixth:
-          result = msrQuarterTonesPitchKind::kQTP_B_Natural;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSeventh:
-          result = msrQuarterTonesPitchKind::kQTP_C_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorSeventh:
-          result = msrQuarterTonesPitchKind::kQTP_C_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorSeventh:
-          result = msrQuarterTonesPitchKind::kQTP_C_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSeventh:
-          result = msrQuarterTonesPitchKind::kQTP_C_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedOctave:
-          result = msrQuarterTonesPitchKind::kQTP_D_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalPerfectOctave:
-          result = msrQuarterTonesPitchKind::kQTP_D_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedOctave:
-          result = msrQuarterTonesPitchKind::kQTP_D_Natural;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedNinth:
-          result = msrQuarterTonesPitchKind::kQTP_E_TripleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorNinth:
-          result = msrQuarterTonesPitchKind::kQTP_E_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMajorNinth:
-          result = msrQuarterTonesPitchKind::kQTP_E_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedNinth:
-          result = msrQuarterTonesPitchKind::kQTP_E_Natural;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedTenth:
-          result = msrQuarterTonesPitchKind::kQTP_F_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorTenth:
-          result = msrQuarterTonesPitchKind::kQTP_F_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorTenth:
-          result = msrQuarterTonesPitchKind::kQTP_F_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedTenth:
-          result = msrQuarterTonesPitchKind::kQTP_F_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedEleventh:
-          result = msrQuarterTonesPitchKind::kQTP_G_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalPerfectEleventh:
-          result = msrQuarterTonesPitchKind::kQTP_G_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedEleventh:
-          result = msrQuarterTonesPitchKind::kQTP_G_Natural;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedTwelfth:
-          result = msrQuarterTonesPitchKind::kQTP_A_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalPerfectTwelfth:
-          result = msrQuarterTonesPitchKind::kQTP_A_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedTwelfth:
-          result = msrQuarterTonesPitchKind::kQTP_A_Natural;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedThirteenth:
-          result = msrQuarterTonesPitchKind::kQTP_B_TripleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorThirteenth:
-          result = msrQuarterTonesPitchKind::kQTP_B_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMajorThirteenth:
-          result = msrQuarterTonesPitchKind::kQTP_B_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedThirteenth:
-          result = msrQuarterTonesPitchKind::kQTP_B_Natural;
-          break;
-      } // switch
-      break;
-
-    case msrQuarterTonesPitchKind::kQTP_D_Natural:
-      switch (intervalKind) {
-        case msrIntervalKind::kInterval_UNKNOWN_:
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedUnisson:
-          result = msrQuarterTonesPitchKind::kQTP_D_Flat;
-          break;
-        case msrIntervalKind::kIntervalPerfectUnisson:
-          result = msrQuarterTonesPitchKind::kQTP_D_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedUnisson:
-          result = msrQuarterTonesPitchKind::kQTP_D_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSecond:
-          result = msrQuarterTonesPitchKind::kQTP_E_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorSecond:
-          result = msrQuarterTonesPitchKind::kQTP_E_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorSecond:
-          result = msrQuarterTonesPitchKind::kQTP_E_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSecond:
-          result = msrQuarterTonesPitchKind::kQTP_E_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedThird:
-          result = msrQuarterTonesPitchKind::kQTP_F_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorThird:
-          result = msrQuarterTonesPitchKind::kQTP_F_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorThird:
-          result = msrQuarterTonesPitchKind::kQTP_F_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedThird:
-          result = msrQuarterTonesPitchKind::kQTP_F_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedFourth:
-          result = msrQuarterTonesPitchKind::kQTP_G_Flat;
-          break;
-        case msrIntervalKind::kIntervalPerfectFourth:
-          result = msrQuarterTonesPitchKind::kQTP_G_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedFourth:
-          result = msrQuarterTonesPitchKind::kQTP_G_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedFifth:
-          result = msrQuarterTonesPitchKind::kQTP_A_Flat;
-          break;
-        case msrIntervalKind::kIntervalPerfectFifth:
-          result = msrQuarterTonesPitchKind::kQTP_A_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedFifth:
-          result = msrQuarterTonesPitchKind::kQTP_A_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSixth:
-          result = msrQuarterTonesPitchKind::kQTP_B_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorSixth:
-          result = msrQuarterTonesPitchKind::kQTP_B_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorSixth:
-          result = msrQuarterTonesPitchKind::kQTP_B_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSixth:
-          result = msrQuarterTonesPitchKind::kQTP_B_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSeventh:
-          result = msrQuarterTonesPitchKind::kQTP_C_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorSeventh:
-          result = msrQuarterTonesPitchKind::kQTP_C_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorSeventh:
-          result = msrQuarterTonesPitchKind::kQTP_C_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSeventh:
-          result = msrQuarterTonesPitchKind::kQTP_C_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedOctave:
-          result = msrQuarterTonesPitchKind::kQTP_D_Flat;
-          break;
-        case msrIntervalKind::kIntervalPerfectOctave:
-          result = msrQuarterTonesPitchKind::kQTP_D_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedOctave:
-          result = msrQuarterTonesPitchKind::kQTP_D_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedNinth:
-          result = msrQuarterTonesPitchKind::kQTP_E_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorNinth:
-          result = msrQuarterTonesPitchKind::kQTP_E_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorNinth:
-          result = msrQuarterTonesPitchKind::kQTP_E_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedNinth:
-          result = msrQuarterTonesPitchKind::kQTP_E_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedTenth:
-          result = msrQuarterTonesPitchKind::kQTP_F_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorTenth:
-          result = msrQuarterTonesPitchKind::kQTP_F_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorTenth:
-          result = msrQuarterTonesPitchKind::kQTP_F_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedTenth:
-          result = msrQuarterTonesPitchKind::kQTP_F_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedEleventh:
-          result = msrQuarterTonesPitchKind::kQTP_G_Flat;
-          break;
-        case msrIntervalKind::kIntervalPerfectEleventh:
-          result = msrQuarterTonesPitchKind::kQTP_G_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedEleventh:
-          result = msrQuarterTonesPitchKind::kQTP_G_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedTwelfth:
-          result = msrQuarterTonesPitchKind::kQTP_A_Flat;
-          break;
-        case msrIntervalKind::kIntervalPerfectTwelfth:
-          result = msrQuarterTonesPitchKind::kQTP_A_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedTwelfth:
-          result = msrQuarterTonesPitchKind::kQTP_A_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedThirteenth:
-          result = msrQuarterTonesPitchKind::kQTP_B_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorThirteenth:
-          result = msrQuarterTonesPitchKind::kQTP_B_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorThirteenth:
-          result = msrQuarterTonesPitchKind::kQTP_B_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedThirteenth:
-          result = msrQuarterTonesPitchKind::kQTP_B_Sharp;
-          break;
-      } // switch
-      break;
-
-    case msrQuarterTonesPitchKind::kQTP_D_Sharp:
-      switch (intervalKind) {
-        case msrIntervalKind::kInterval_UNKNOWN_:
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedUnisson:
-          result = msrQuarterTonesPitchKind::kQTP_D_Natural;
-          break;
-        case msrIntervalKind::kIntervalPerfectUnisson:
-          result = msrQuarterTonesPitchKind::kQTP_D_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedUnisson:
-          result = msrQuarterTonesPitchKind::kQTP_D_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSecond:
-          result = msrQuarterTonesPitchKind::kQTP_E_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorSecond:
-          result = msrQuarterTonesPitchKind::kQTP_E_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorSecond:
-          result = msrQuarterTonesPitchKind::kQTP_E_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSecond:
-          result = msrQuarterTonesPitchKind::kQTP_E_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedThird:
-          result = msrQuarterTonesPitchKind::kQTP_F_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorThird:
-          result = msrQuarterTonesPitchKind::kQTP_F_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorThird:
-          result = msrQuarterTonesPitchKind::kQTP_F_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedThird:
-          result = msrQuarterTonesPitchKind::kQTP_F_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedFourth:
-          result = msrQuarterTonesPitchKind::kQTP_G_Natural;
-          break;
-        case msrIntervalKind::kIntervalPerfectFourth:
-          result = msrQuarterTonesPitchKind::kQTP_G_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedFourth:
-          result = msrQuarterTonesPitchKind::kQTP_G_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedFifth:
-          result = msrQuarterTonesPitchKind::kQTP_A_Natural;
-          break;
-        case msrIntervalKind::kIntervalPerfectFifth:
-          result = msrQuarterTonesPitchKind::kQTP_A_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedFifth:
-          result = msrQuarterTonesPitchKind::kQTP_A_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSixth:
-          result = msrQuarterTonesPitchKind::kQTP_B_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorSixth:
-          result = msrQuarterTonesPitchKind::kQTP_B_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorSixth:
-          result = msrQuarterTonesPitchKind::kQTP_B_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSixth:
-          result = msrQuarterTonesPitchKind::kQTP_B_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSeventh:
-          result = msrQuarterTonesPitchKind::kQTP_C_Natural;
-          break;
-        case msrIntervalKind::kIntervalMinorSeventh:
-          result = msrQuarterTonesPitchKind::kQTP_C_Sharp;
-          break;
-        case msrIntervalKind::kIntervalMajorSeventh:
-          result = msrQuarterTonesPitchKind::kQTP_C_DoubleSharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSeventh:
-          result = msrQuarterTonesPitchKind::kQTP_C_TripleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedOctave:
-          result = msrQuarterTonesPitchKind::kQTP_D_Natural;
-          break;
-        case msrIntervalKind::kIntervalPerfectOctave:
-          result = msrQuarterTonesPitchKind::kQTP_D_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedOctave:
-          result = msrQuarterTonesPitchKind::kQTP_D_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedNinth:
-          result = msrQuarterTonesPitchKind::kQTP_E_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorNinth:
-          result = msrQuarterTonesPitchKind::kQTP_E_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorNinth:
-          result = msrQuarterTonesPitchKind::kQTP_E_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedNinth:
-          result = msrQuarterTonesPitchKind::kQTP_E_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedTenth:
-          result = msrQuarterTonesPitchKind::kQTP_F_Natural;
-          break;
-        case msrIntervalKind::kIntervalMinorTenth:
-          result = msrQuarterTonesPitchKind::kQTP_F_Sharp;
-          break;
-        case msrIntervalKind::kIntervalMajorTenth:
-          result = msrQuarterTonesPitchKind::kQTP_F_DoubleSharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedTenth:
-          result = msrQuarterTonesPitchKind::kQTP_F_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedEleventh:
-          result = msrQuarterTonesPitchKind::kQTP_G_Natural;
-          break;
-        case msrIntervalKind::kIntervalPerfectEleventh:
-          result = msrQuarterTonesPitchKind::kQTP_G_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedEleventh:
-          result = msrQuarterTonesPitchKind::kQTP_G_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedTwelfth:
-          result = msrQuarterTonesPitchKind::kQTP_A_Natural;
-          break;
-        case msrIntervalKind::kIntervalPerfectTwelfth:
-          result = msrQuarterTonesPitchKind::kQTP_A_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedTwelfth:
-          result = msrQuarterTonesPitchKind::kQTP_A_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedThirteenth:
-          result = msrQuarterTonesPitchKind::kQTP_B_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorThirteenth:
-          result = msrQuarterTonesPitchKind::kQTP_B_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorThirteenth:
-          result = msrQuarterTonesPitchKind::kQTP_B_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedThirteenth:
-          result = msrQuarterTonesPitchKind::kQTP_B_DoubleSharp;
-          break;
-      } // switch
-      break;
-
-    case msrQuarterTonesPitchKind::kQTP_E_Flat:
-      switch (intervalKind) {
-        case msrIntervalKind::kInterval_UNKNOWN_:
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedUnisson:
-          result = msrQuarterTonesPitchKind::kQTP_E_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalPerfectUnisson:
-          result = msrQuarterTonesPitchKind::kQTP_E_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedUnisson:
-          result = msrQuarterTonesPitchKind::kQTP_E_Natural;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSecond:
-          result = msrQuarterTonesPitchKind::kQTP_F_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorSecond:
-          result = msrQuarterTonesPitchKind::kQTP_F_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorSecond:
-          result = msrQuarterTonesPitchKind::kQTP_F_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSecond:
-          result = msrQuarterTonesPitchKind::kQTP_F_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedThird:
-          result = msrQuarterTonesPitchKind::kQTP_G_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorThird:
-          result = msrQuarterTonesPitchKind::kQTP_G_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorThird:
-          result = msrQuarterTonesPitchKind::kQTP_G_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedThird:
-          result = msrQuarterTonesPitchKind::kQTP_G_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedFourth:
-          result = msrQuarterTonesPitchKind::kQTP_A_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalPerfectFourth:
-          result = msrQuarterTonesPitchKind::kQTP_A_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedFourth:
-          result = msrQuarterTonesPitchKind::kQTP_A_Natural;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedFifth:
-          result = msrQuarterTonesPitchKind::kQTP_B_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalPerfectFifth:
-          result = msrQuarterTonesPitchKind::kQTP_B_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedFifth:
-          result = msrQuarterTonesPitchKind::kQTP_B_Natural;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSixth:
-          result = msrQuarterTonesPitchKind::kQTP_C_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorSixth:
-          result = msrQuarterTonesPitchKind::kQTP_C_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorSixth:
-          result = msrQuarterTonesPitchKind::kQTP_C_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSixth:
-          result = msrQuarterTonesPitchKind::kQTP_C_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSeventh:
-          result = msrQuarterTonesPitchKind::kQTP_D_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorSeventh:
-          result = msrQuarterTonesPitchKind::kQTP_D_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorSeventh:
-          result = msrQuarterTonesPitchKind::kQTP_D_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSeventh:
-          result = msrQuarterTonesPitchKind::kQTP_D_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedOctave:
-          result = msrQuarterTonesPitchKind::kQTP_E_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalPerfectOctave:
-          result = msrQuarterTonesPitchKind::kQTP_E_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedOctave:
-          result = msrQuarterTonesPitchKind::kQTP_E_Natural;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedNinth:
-          result = msrQuarterTonesPitchKind::kQTP_F_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorNinth:
-          result = msrQuarterTonesPitchKind::kQTP_F_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorNinth:
-          result = msrQuarterTonesPitchKind::kQTP_F_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedNinth:
-          result = msrQuarterTonesPitchKind::kQTP_F_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedTenth:
-          result = msrQuarterTonesPitchKind::kQTP_G_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorTenth:
-          result = msrQuarterTonesPitchKind::kQTP_G_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorTenth:
-          result = msrQuarterTonesPitchKind::kQTP_G_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedTenth:
-          result = msrQuarterTonesPitchKind::kQTP_G_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedEleventh:
-          result = msrQuarterTonesPitchKind::kQTP_A_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalPerfectEleventh:
-          result = msrQuarterTonesPitchKind::kQTP_A_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedEleventh:
-          result = msrQuarterTonesPitchKind::kQTP_A_Natural;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedTwelfth:
-          result = msrQuarterTonesPitchKind::kQTP_B_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalPerfectTwelfth:
-          result = msrQuarterTonesPitchKind::kQTP_B_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedTwelfth:
-          result = msrQuarterTonesPitchKind::kQTP_B_Natural;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedThirteenth:
-          result = msrQuarterTonesPitchKind::kQTP_C_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorThirteenth:
-          result = msrQuarterTonesPitchKind::kQTP_C_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorThirteenth:
-          result = msrQuarterTonesPitchKind::kQTP_C_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedThirteenth:
-          result = msrQuarterTonesPitchKind::kQTP_C_Sharp;
-          break;
-      } // switch
-      break;
-
-    case msrQuarterTonesPitchKind::kQTP_E_Natural:
-      switch (intervalKind) {
-        case msrIntervalKind::kInterval_UNKNOWN_:
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedUnisson:
-          result = msrQuarterTonesPitchKind::kQTP_E_Flat;
-          break;
-        case msrIntervalKind::kIntervalPerfectUnisson:
-          result = msrQuarterTonesPitchKind::kQTP_E_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedUnisson:
-          result = msrQuarterTonesPitchKind::kQTP_E_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSecond:
-          result = msrQuarterTonesPitchKind::kQTP_F_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorSecond:
-          result = msrQuarterTonesPitchKind::kQTP_F_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorSecond:
-          result = msrQuarterTonesPitchKind::kQTP_F_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSecond:
-          result = msrQuarterTonesPitchKind::kQTP_F_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedThird:
-          result = msrQuarterTonesPitchKind::kQTP_G_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorThird:
-          result = msrQuarterTonesPitchKind::kQTP_G_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorThird:
-          result = msrQuarterTonesPitchKind::kQTP_G_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedThird:
-          result = msrQuarterTonesPitchKind::kQTP_G_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedFourth:
-          result = msrQuarterTonesPitchKind::kQTP_A_Flat;
-          break;
-        case msrIntervalKind::kIntervalPerfectFourth:
-          result = msrQuarterTonesPitchKind::kQTP_A_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedFourth:
-          result = msrQuarterTonesPitchKind::kQTP_A_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedFifth:
-          result = msrQuarterTonesPitchKind::kQTP_B_Natural;
-          break;
-        case msrIntervalKind::kIntervalPerfectFifth:
-          result = msrQuarterTonesPitchKind::kQTP_B_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedFifth:
-          result = msrQuarterTonesPitchKind::kQTP_B_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSixth:
-          result = msrQuarterTonesPitchKind::kQTP_C_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorSixth:
-          result = msrQuarterTonesPitchKind::kQTP_C_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorSixth:
-          result = msrQuarterTonesPitchKind::kQTP_C_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSixth:
-          result = msrQuarterTonesPitchKind::kQTP_C_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSeventh:
-          result = msrQuarterTonesPitchKind::kQTP_D_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorSeventh:
-          result = msrQuarterTonesPitchKind::kQTP_D_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorSeventh:
-          result = msrQuarterTonesPitchKind::kQTP_D_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSeventh:
-          result = msrQuarterTonesPitchKind::kQTP_D_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedOctave:
-          result = msrQuarterTonesPitchKind::kQTP_E_Flat;
-          break;
-        case msrIntervalKind::kIntervalPerfectOctave:
-          result = msrQuarterTonesPitchKind::kQTP_E_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedOctave:
-          result = msrQuarterTonesPitchKind::kQTP_E_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedNinth:
-          result = msrQuarterTonesPitchKind::kQTP_F_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorNinth:
-          result = msrQuarterTonesPitchKind::kQTP_F_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorNinth:
-          result = msrQuarterTonesPitchKind::kQTP_F_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedNinth:
-          result = msrQuarterTonesPitchKind::kQTP_F_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedTenth:
-          result = msrQuarterTonesPitchKind::kQTP_G_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorTenth:
-          result = msrQuarterTonesPitchKind::kQTP_G_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorTenth:
-          result = msrQuarterTonesPitchKind::kQTP_G_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedTenth:
-          result = msrQuarterTonesPitchKind::kQTP_G_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedEleventh:
-          result = msrQuarterTonesPitchKind::kQTP_A_Flat;
-          break;
-        case msrIntervalKind::kIntervalPerfectEleventh:
-          result = msrQuarterTonesPitchKind::kQTP_A_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedEleventh:
-          result = msrQuarterTonesPitchKind::kQTP_A_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedTwelfth:
-          result = msrQuarterTonesPitchKind::kQTP_B_Natural;
-          break;
-        case msrIntervalKind::kIntervalPerfectTwelfth:
-          result = msrQuarterTonesPitchKind::kQTP_B_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedTwelfth:
-          result = msrQuarterTonesPitchKind::kQTP_B_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedThirteenth:
-          result = msrQuarterTonesPitchKind::kQTP_C_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorThirteenth:
-          result = msrQuarterTonesPitchKind::kQTP_C_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorThirteenth:
-          result = msrQuarterTonesPitchKind::kQTP_C_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedThirteenth:
-          result = msrQuarterTonesPitchKind::kQTP_C_DoubleSharp;
-          break;
-      } // switch
-      break;
-
-    case msrQuarterTonesPitchKind::kQTP_E_Sharp:
-      switch (intervalKind) {
-        case msrIntervalKind::kInterval_UNKNOWN_:
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedUnisson:
-          result = msrQuarterTonesPitchKind::kQTP_E_Natural;
-          break;
-        case msrIntervalKind::kIntervalPerfectUnisson:
-          result = msrQuarterTonesPitchKind::kQTP_E_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedUnisson:
-          result = msrQuarterTonesPitchKind::kQTP_E_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSecond:
-          result = msrQuarterTonesPitchKind::kQTP_F_Natural;
-          break;
-        case msrIntervalKind::kIntervalMinorSecond:
-          result = msrQuarterTonesPitchKind::kQTP_F_Sharp;
-          break;
-        case msrIntervalKind::kIntervalMajorSecond:
-          result = msrQuarterTonesPitchKind::kQTP_F_DoubleSharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSecond:
-          result = msrQuarterTonesPitchKind::kQTP_F_TripleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedThird:
-          result = msrQuarterTonesPitchKind::kQTP_G_Natural;
-          break;
-        case msrIntervalKind::kIntervalMinorThird:
-          result = msrQuarterTonesPitchKind::kQTP_G_Sharp;
-          break;
-        case msrIntervalKind::kIntervalMajorThird:
-          result = msrQuarterTonesPitchKind::kQTP_G_DoubleSharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedThird:
-          result = msrQuarterTonesPitchKind::kQTP_G_TripleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedFourth:
-          result = msrQuarterTonesPitchKind::kQTP_A_Natural;
-          break;
-        case msrIntervalKind::kIntervalPerfectFourth:
-          result = msrQuarterTonesPitchKind::kQTP_A_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedFourth:
-          result = msrQuarterTonesPitchKind::kQTP_A_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedFifth:
-          result = msrQuarterTonesPitchKind::kQTP_B_Natural;
-          break;
-        case msrIntervalKind::kIntervalPerfectFifth:
-          result = msrQuarterTonesPitchKind::kQTP_B_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedFifth:
-          result = msrQuarterTonesPitchKind::kQTP_B_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSixth:
-          result = msrQuarterTonesPitchKind::kQTP_C_Natural;
-          break;
-        case msrIntervalKind::kIntervalMinorSixth:
-          result = msrQuarterTonesPitchKind::kQTP_C_Sharp;
-          break;
-        case msrIntervalKind::kIntervalMajorSixth:
-          result = msrQuarterTonesPitchKind::kQTP_C_DoubleSharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSixth:
-          result = msrQuarterTonesPitchKind::kQTP_C_TripleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSeventh:
-          result = msrQuarterTonesPitchKind::kQTP_D_Natural;
-          break;
-        case msrIntervalKind::kIntervalMinorSeventh:
-          result = msrQuarterTonesPitchKind::kQTP_D_Sharp;
-          break;
-        case msrIntervalKind::kIntervalMajorSeventh:
-          result = msrQuarterTonesPitchKind::kQTP_D_DoubleSharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSeventh:
-          result = msrQuarterTonesPitchKind::kQTP_D_TripleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedOctave:
-          result = msrQuarterTonesPitchKind::kQTP_E_Natural;
-          break;
-        case msrIntervalKind::kIntervalPerfectOctave:
-          result = msrQuarterTonesPitchKind::kQTP_E_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedOctave:
-          result = msrQuarterTonesPitchKind::kQTP_E_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedNinth:
-          result = msrQuarterTonesPitchKind::kQTP_F_Natural;
-          break;
-        case msrIntervalKind::kIntervalMinorNinth:
-          result = msrQuarterTonesPitchKind::kQTP_F_Sharp;
-          break;
-        case msrIntervalKind::kIntervalMajorNinth:
-          result = msrQuarterTonesPitchKind::kQTP_F_DoubleSharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedNinth:
-          result = msrQuarterTonesPitchKind::kQTP_F_TripleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedTenth:
-          result = msrQuarterTonesPitchKind::kQTP_G_Natural;
-          break;
-        case msrIntervalKind::kIntervalMinorTenth:
-          result = msrQuarterTonesPitchKind::kQTP_G_Sharp;
-          break;
-        case msrIntervalKind::kIntervalMajorTenth:
-          result = msrQuarterTonesPitchKind::kQTP_G_DoubleSharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedTenth:
-          result = msrQuarterTonesPitchKind::kQTP_G_TripleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedEleventh:
-          result = msrQuarterTonesPitchKind::kQTP_A_Natural;
-          break;
-        case msrIntervalKind::kIntervalPerfectEleventh:
-          result = msrQuarterTonesPitchKind::kQTP_A_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedEleventh:
-          result = msrQuarterTonesPitchKind::kQTP_A_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedTwelfth:
-          result = msrQuarterTonesPitchKind::kQTP_B_Natural;
-          break;
-        case msrIntervalKind::kIntervalPerfectTwelfth:
-          result = msrQuarterTonesPitchKind::kQTP_B_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedTwelfth:
-          result = msrQuarterTonesPitchKind::kQTP_B_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedThirteenth:
-          result = msrQuarterTonesPitchKind::kQTP_C_Natural;
-          break;
-        case msrIntervalKind::kIntervalMinorThirteenth:
-          result = msrQuarterTonesPitchKind::kQTP_C_Sharp;
-          break;
-        case msrIntervalKind::kIntervalMajorThirteenth:
-          result = msrQuarterTonesPitchKind::kQTP_C_DoubleSharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedThirteenth:
-          result = msrQuarterTonesPitchKind::kQTP_C_TripleSharp;
-          break;
-      } // switch
-      break;
-
-    case msrQuarterTonesPitchKind::kQTP_F_Flat:
-      break;
-
-    case msrQuarterTonesPitchKind::kQTP_F_Natural:
-      switch (intervalKind) {
-        case msrIntervalKind::kInterval_UNKNOWN_:
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedUnisson:
-          result = msrQuarterTonesPitchKind::kQTP_F_Flat;
-          break;
-        case msrIntervalKind::kIntervalPerfectUnisson:
-          result = msrQuarterTonesPitchKind::kQTP_F_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedUnisson:
-          result = msrQuarterTonesPitchKind::kQTP_F_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSecond:
-          result = msrQuarterTonesPitchKind::kQTP_G_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorSecond:
-          result = msrQuarterTonesPitchKind::kQTP_G_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorSecond:
-          result = msrQuarterTonesPitchKind::kQTP_G_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSecond:
-          result = msrQuarterTonesPitchKind::kQTP_G_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedThird:
-          result = msrQuarterTonesPitchKind::kQTP_A_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorThird:
-          result = msrQuarterTonesPitchKind::kQTP_A_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorThird:
-          result = msrQuarterTonesPitchKind::kQTP_A_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedThird:
-          result = msrQuarterTonesPitchKind::kQTP_A_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedFourth:
-          result = msrQuarterTonesPitchKind::kQTP_B_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalPerfectFourth:
-          result = msrQuarterTonesPitchKind::kQTP_B_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedFourth:
-          result = msrQuarterTonesPitchKind::kQTP_B_Natural;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedFifth:
-          result = msrQuarterTonesPitchKind::kQTP_C_Flat;
-          break;
-        case msrIntervalKind::kIntervalPerfectFifth:
-          result = msrQuarterTonesPitchKind::kQTP_C_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedFifth:
-          result = msrQuarterTonesPitchKind::kQTP_C_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSixth:
-          result = msrQuarterTonesPitchKind::kQTP_D_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorSixth:
-          result = msrQuarterTonesPitchKind::kQTP_D_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorSixth:
-          result = msrQuarterTonesPitchKind::kQTP_D_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSixth:
-          result = msrQuarterTonesPitchKind::kQTP_D_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSeventh:
-          result = msrQuarterTonesPitchKind::kQTP_E_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorSeventh:
-          result = msrQuarterTonesPitchKind::kQTP_E_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorSeventh:
-          result = msrQuarterTonesPitchKind::kQTP_E_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSeventh:
-          result = msrQuarterTonesPitchKind::kQTP_E_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedOctave:
-          result = msrQuarterTonesPitchKind::kQTP_F_Flat;
-          break;
-        case msrIntervalKind::kIntervalPerfectOctave:
-          result = msrQuarterTonesPitchKind::kQTP_F_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedOctave:
-          result = msrQuarterTonesPitchKind::kQTP_F_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedNinth:
-          result = msrQuarterTonesPitchKind::kQTP_G_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorNinth:
-          result = msrQuarterTonesPitchKind::kQTP_G_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorNinth:
-          result = msrQuarterTonesPitchKind::kQTP_G_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedNinth:
-          result = msrQuarterTonesPitchKind::kQTP_G_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedTenth:
-          result = msrQuarterTonesPitchKind::kQTP_A_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorTenth:
-          result = msrQuarterTonesPitchKind::kQTP_A_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorTenth:
-          result = msrQuarterTonesPitchKind::kQTP_A_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedTenth:
-          result = msrQuarterTonesPitchKind::kQTP_A_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedEleventh:
-          result = msrQuarterTonesPitchKind::kQTP_B_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalPerfectEleventh:
-          result = msrQuarterTonesPitchKind::kQTP_B_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedEleventh:
-          result = msrQuarterTonesPitchKind::kQTP_B_Natural;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedTwelfth:
-          result = msrQuarterTonesPitchKind::kQTP_C_Flat;
-          break;
-        case msrIntervalKind::kIntervalPerfectTwelfth:
-          result = msrQuarterTonesPitchKind::kQTP_C_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedTwelfth:
-          result = msrQuarterTonesPitchKind::kQTP_C_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedThirteenth:
-          result = msrQuarterTonesPitchKind::kQTP_D_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorThirteenth:
-          result = msrQuarterTonesPitchKind::kQTP_D_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorThirteenth:
-          result = msrQuarterTonesPitchKind::kQTP_D_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedThirteenth:
-          result = msrQuarterTonesPitchKind::kQTP_D_Sharp;
-          break;
-      } // switch
-      break;
-
-    case msrQuarterTonesPitchKind::kQTP_F_Sharp:
-      switch (intervalKind) {
-        case msrIntervalKind::kInterval_UNKNOWN_:
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedUnisson:
-          result = msrQuarterTonesPitchKind::kQTP_F_Natural;
-          break;
-        case msrIntervalKind::kIntervalPerfectUnisson:
-          result = msrQuarterTonesPitchKind::kQTP_F_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedUnisson:
-          result = msrQuarterTonesPitchKind::kQTP_F_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSecond:
-          result = msrQuarterTonesPitchKind::kQTP_G_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorSecond:
-          result = msrQuarterTonesPitchKind::kQTP_G_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorSecond:
-          result = msrQuarterTonesPitchKind::kQTP_G_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSecond:
-          result = msrQuarterTonesPitchKind::kQTP_G_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedThird:
-          result = msrQuarterTonesPitchKind::kQTP_A_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorThird:
-          result = msrQuarterTonesPitchKind::kQTP_A_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorThird:
-          result = msrQuarterTonesPitchKind::kQTP_A_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedThird:
-          result = msrQuarterTonesPitchKind::kQTP_A_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedFourth:
-          result = msrQuarterTonesPitchKind::kQTP_B_Sharp;
-          break;
-        case msrIntervalKind::kIntervalPerfectFourth:
-          result = msrQuarterTonesPitchKind::kQTP_B_DoubleSharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedFourth:
-          result = msrQuarterTonesPitchKind::kQTP_B_TripleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedFifth:
-          result = msrQuarterTonesPitchKind::kQTP_C_Natural;
-          break;
-        case msrIntervalKind::kIntervalPerfectFifth:
-          result = msrQuarterTonesPitchKind::kQTP_C_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedFifth:
-          result = msrQuarterTonesPitchKind::kQTP_C_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSixth:
-          result = msrQuarterTonesPitchKind::kQTP_D_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorSixth:
-          result = msrQuarterTonesPitchKind::kQTP_D_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorSixth:
-          result = msrQuarterTonesPitchKind::kQTP_D_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSixth:
-          result = msrQuarterTonesPitchKind::kQTP_D_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSeventh:
-          result = msrQuarterTonesPitchKind::kQTP_E_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorSeventh:
-          result = msrQuarterTonesPitchKind::kQTP_E_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorSeventh:
-          result = msrQuarterTonesPitchKind::kQTP_E_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSeventh:
-          result = msrQuarterTonesPitchKind::kQTP_E_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedOctave:
-          result = msrQuarterTonesPitchKind::kQTP_F_Natural;
-          break;
-        case msrIntervalKind::kIntervalPerfectOctave:
-          result = msrQuarterTonesPitchKind::kQTP_F_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedOctave:
-          result = msrQuarterTonesPitchKind::kQTP_F_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedNinth:
-          result = msrQuarterTonesPitchKind::kQTP_G_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorNinth:
-          result = msrQuarterTonesPitchKind::kQTP_G_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorNinth:
-          result = msrQuarterTonesPitchKind::kQTP_G_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedNinth:
-          result = msrQuarterTonesPitchKind::kQTP_G_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedTenth:
-          result = msrQuarterTonesPitchKind::kQTP_A_Natural;
-          break;
-        case msrIntervalKind::kIntervalMinorTenth:
-          result = msrQuarterTonesPitchKind::kQTP_A_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorTenth:
-          result = msrQuarterTonesPitchKind::kQTP_A_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedTenth:
-          result = msrQuarterTonesPitchKind::kQTP_A_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedEleventh:
-          result = msrQuarterTonesPitchKind::kQTP_B_Sharp;
-          break;
-        case msrIntervalKind::kIntervalPerfectEleventh:
-          result = msrQuarterTonesPitchKind::kQTP_B_DoubleSharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedEleventh:
-          result = msrQuarterTonesPitchKind::kQTP_B_TripleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedTwelfth:
-          result = msrQuarterTonesPitchKind::kQTP_C_Natural;
-          break;
-        case msrIntervalKind::kIntervalPerfectTwelfth:
-          result = msrQuarterTonesPitchKind::kQTP_C_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedTwelfth:
-          result = msrQuarterTonesPitchKind::kQTP_C_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedThirteenth:
-          result = msrQuarterTonesPitchKind::kQTP_E_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorThirteenth:
-          result = msrQuarterTonesPitchKind::kQTP_D_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorThirteenth:
-          result = msrQuarterTonesPitchKind::kQTP_D_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedThirteenth:
-          result = msrQuarterTonesPitchKind::kQTP_D_DoubleSharp;
-          break;
-      } // switch
-      break;
-
-    case msrQuarterTonesPitchKind::kQTP_G_Flat:
-      switch (intervalKind) {
-        case msrIntervalKind::kInterval_UNKNOWN_:
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedUnisson:
-          result = msrQuarterTonesPitchKind::kQTP_G_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalPerfectUnisson:
-          result = msrQuarterTonesPitchKind::kQTP_G_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedUnisson:
-          result = msrQuarterTonesPitchKind::kQTP_G_Natural;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSecond:
-          result = msrQuarterTonesPitchKind::kQTP_A_TripleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorSecond:
-          result = msrQuarterTonesPitchKind::kQTP_A_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMajorSecond:
-          result = msrQuarterTonesPitchKind::kQTP_A_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSecond:
-          result = msrQuarterTonesPitchKind::kQTP_A_Natural;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedThird:
-          result = msrQuarterTonesPitchKind::kQTP_B_TripleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorThird:
-          result = msrQuarterTonesPitchKind::kQTP_B_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMajorThird:
-          result = msrQuarterTonesPitchKind::kQTP_B_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedThird:
-          result = msrQuarterTonesPitchKind::kQTP_B_Natural;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedFourth:
-          result = msrQuarterTonesPitchKind::kQTP_C_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalPerfectFourth:
-          result = msrQuarterTonesPitchKind::kQTP_C_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedFourth:
-          result = msrQuarterTonesPitchKind::kQTP_C_Natural;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedFifth:
-          result = msrQuarterTonesPitchKind::kQTP_D_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalPerfectFifth:
-          result = msrQuarterTonesPitchKind::kQTP_D_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedFifth:
-          result = msrQuarterTonesPitchKind::kQTP_D_Natural;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSixth:
-          result = msrQuarterTonesPitchKind::kQTP_E_TripleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorSixth:
-          result = msrQuarterTonesPitchKind::kQTP_E_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMajorSixth:
-          result = msrQuarterTonesPitchKind::kQTP_E_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSixth:
-          result = msrQuarterTonesPitchKind::kQTP_E_Natural;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSeventh:
-          result = msrQuarterTonesPitchKind::kQTP_F_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorSeventh:
-          result = msrQuarterTonesPitchKind::kQTP_F_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorSeventh:
-          result = msrQuarterTonesPitchKind::kQTP_F_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSeventh:
-          result = msrQuarterTonesPitchKind::kQTP_F_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedOctave:
-          result = msrQuarterTonesPitchKind::kQTP_G_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalPerfectOctave:
-          result = msrQuarterTonesPitchKind::kQTP_G_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedOctave:
-          result = msrQuarterTonesPitchKind::kQTP_G_Natural;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedNinth:
-          result = msrQuarterTonesPitchKind::kQTP_A_TripleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorNinth:
-          result = msrQuarterTonesPitchKind::kQTP_A_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMajorNinth:
-          result = msrQuarterTonesPitchKind::kQTP_A_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedNinth:
-          result = msrQuarterTonesPitchKind::kQTP_A_Natural;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedTenth:
-          result = msrQuarterTonesPitchKind::kQTP_B_TripleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorTenth:
-          result = msrQuarterTonesPitchKind::kQTP_B_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMajorTenth:
-          result = msrQuarterTonesPitchKind::kQTP_B_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedTenth:
-          result = msrQuarterTonesPitchKind::kQTP_B_Natural;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedEleventh:
-          result = msrQuarterTonesPitchKind::kQTP_C_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalPerfectEleventh:
-          result = msrQuarterTonesPitchKind::kQTP_C_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedEleventh:
-          result = msrQuarterTonesPitchKind::kQTP_C_Natural;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedTwelfth:
-          result = msrQuarterTonesPitchKind::kQTP_D_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalPerfectTwelfth:
-          result = msrQuarterTonesPitchKind::kQTP_D_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedTwelfth:
-          result = msrQuarterTonesPitchKind::kQTP_D_Natural;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedThirteenth:
-          result = msrQuarterTonesPitchKind::kQTP_E_TripleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorThirteenth:
-          result = msrQuarterTonesPitchKind::kQTP_E_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMajorThirteenth:
-          result = msrQuarterTonesPitchKind::kQTP_E_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedThirteenth:
-          result = msrQuarterTonesPitchKind::kQTP_E_Natural;
-          break;
-      } // switch
-      break;
-
-    case msrQuarterTonesPitchKind::kQTP_G_Natural:
-      switch (intervalKind) {
-        case msrIntervalKind::kInterval_UNKNOWN_:
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedUnisson:
-          result = msrQuarterTonesPitchKind::kQTP_G_Flat;
-          break;
-        case msrIntervalKind::kIntervalPerfectUnisson:
-          result = msrQuarterTonesPitchKind::kQTP_G_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedUnisson:
-          result = msrQuarterTonesPitchKind::kQTP_G_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSecond:
-          result = msrQuarterTonesPitchKind::kQTP_A_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorSecond:
-          result = msrQuarterTonesPitchKind::kQTP_A_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorSecond:
-          result = msrQuarterTonesPitchKind::kQTP_A_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSecond:
-          result = msrQuarterTonesPitchKind::kQTP_A_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedThird:
-          result = msrQuarterTonesPitchKind::kQTP_B_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorThird:
-          result = msrQuarterTonesPitchKind::kQTP_B_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorThird:
-          result = msrQuarterTonesPitchKind::kQTP_B_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedThird:
-          result = msrQuarterTonesPitchKind::kQTP_B_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedFourth:
-          result = msrQuarterTonesPitchKind::kQTP_C_Flat;
-          break;
-        case msrIntervalKind::kIntervalPerfectFourth:
-          result = msrQuarterTonesPitchKind::kQTP_C_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedFourth:
-          result = msrQuarterTonesPitchKind::kQTP_C_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedFifth:
-          result = msrQuarterTonesPitchKind::kQTP_D_Flat;
-          break;
-        case msrIntervalKind::kIntervalPerfectFifth:
-          result = msrQuarterTonesPitchKind::kQTP_D_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedFifth:
-          result = msrQuarterTonesPitchKind::kQTP_D_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSixth:
-          result = msrQuarterTonesPitchKind::kQTP_E_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorSixth:
-          result = msrQuarterTonesPitchKind::kQTP_E_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorSixth:
-          result = msrQuarterTonesPitchKind::kQTP_E_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSixth:
-          result = msrQuarterTonesPitchKind::kQTP_E_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSeventh:
-          result = msrQuarterTonesPitchKind::kQTP_F_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorSeventh:
-          result = msrQuarterTonesPitchKind::kQTP_F_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorSeventh:
-          result = msrQuarterTonesPitchKind::kQTP_F_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSeventh:
-          result = msrQuarterTonesPitchKind::kQTP_F_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedOctave:
-          result = msrQuarterTonesPitchKind::kQTP_G_Flat;
-          break;
-        case msrIntervalKind::kIntervalPerfectOctave:
-          result = msrQuarterTonesPitchKind::kQTP_G_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedOctave:
-          result = msrQuarterTonesPitchKind::kQTP_G_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedNinth:
-          result = msrQuarterTonesPitchKind::kQTP_A_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorNinth:
-          result = msrQuarterTonesPitchKind::kQTP_A_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorNinth:
-          result = msrQuarterTonesPitchKind::kQTP_A_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedNinth:
-          result = msrQuarterTonesPitchKind::kQTP_A_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedTenth:
-          result = msrQuarterTonesPitchKind::kQTP_B_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorTenth:
-          result = msrQuarterTonesPitchKind::kQTP_B_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorTenth:
-          result = msrQuarterTonesPitchKind::kQTP_B_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedTenth:
-          result = msrQuarterTonesPitchKind::kQTP_B_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedEleventh:
-          result = msrQuarterTonesPitchKind::kQTP_C_Flat;
-          break;
-        case msrIntervalKind::kIntervalPerfectEleventh:
-          result = msrQuarterTonesPitchKind::kQTP_C_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedEleventh:
-          result = msrQuarterTonesPitchKind::kQTP_C_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedTwelfth:
-          result = msrQuarterTonesPitchKind::kQTP_D_Flat;
-          break;
-        case msrIntervalKind::kIntervalPerfectTwelfth:
-          result = msrQuarterTonesPitchKind::kQTP_D_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedTwelfth:
-          result = msrQuarterTonesPitchKind::kQTP_D_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedThirteenth:
-          result = msrQuarterTonesPitchKind::kQTP_E_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorThirteenth:
-          result = msrQuarterTonesPitchKind::kQTP_E_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorThirteenth:
-          result = msrQuarterTonesPitchKind::kQTP_E_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedThirteenth:
-          result = msrQuarterTonesPitchKind::kQTP_E_Sharp;
-          break;
-      } // switch
-      break;
-
-    case msrQuarterTonesPitchKind::kQTP_G_Sharp:
-      switch (intervalKind) {
-        case msrIntervalKind::kInterval_UNKNOWN_:
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedUnisson:
-          result = msrQuarterTonesPitchKind::kQTP_G_Natural;
-          break;
-        case msrIntervalKind::kIntervalPerfectUnisson:
-          result = msrQuarterTonesPitchKind::kQTP_G_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedUnisson:
-          result = msrQuarterTonesPitchKind::kQTP_G_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSecond:
-          result = msrQuarterTonesPitchKind::kQTP_A_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorSecond:
-          result = msrQuarterTonesPitchKind::kQTP_A_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorSecond:
-          result = msrQuarterTonesPitchKind::kQTP_A_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSecond:
-          result = msrQuarterTonesPitchKind::kQTP_A_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedThird:
-          result = msrQuarterTonesPitchKind::kQTP_B_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorThird:
-          result = msrQuarterTonesPitchKind::kQTP_B_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorThird:
-          result = msrQuarterTonesPitchKind::kQTP_B_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedThird:
-          result = msrQuarterTonesPitchKind::kQTP_B_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedFourth:
-          result = msrQuarterTonesPitchKind::kQTP_C_Natural;
-          break;
-        case msrIntervalKind::kIntervalPerfectFourth:
-          result = msrQuarterTonesPitchKind::kQTP_C_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedFourth:
-          result = msrQuarterTonesPitchKind::kQTP_C_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedFifth:
-          result = msrQuarterTonesPitchKind::kQTP_D_Natural;
-          break;
-        case msrIntervalKind::kIntervalPerfectFifth:
-          result = msrQuarterTonesPitchKind::kQTP_D_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedFifth:
-          result = msrQuarterTonesPitchKind::kQTP_D_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSixth:
-          result = msrQuarterTonesPitchKind::kQTP_E_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorSixth:
-          result = msrQuarterTonesPitchKind::kQTP_E_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorSixth:
-          result = msrQuarterTonesPitchKind::kQTP_E_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSixth:
-          result = msrQuarterTonesPitchKind::kQTP_E_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSeventh:
-          result = msrQuarterTonesPitchKind::kQTP_F_Natural;
-          break;
-        case msrIntervalKind::kIntervalMinorSeventh:
-          result = msrQuarterTonesPitchKind::kQTP_F_Sharp;
-          break;
-        case msrIntervalKind::kIntervalMajorSeventh:
-          result = msrQuarterTonesPitchKind::kQTP_F_DoubleSharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSeventh:
-          result = msrQuarterTonesPitchKind::kQTP_F_TripleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedOctave:
-          result = msrQuarterTonesPitchKind::kQTP_G_Natural;
-          break;
-        case msrIntervalKind::kIntervalPerfectOctave:
-          result = msrQuarterTonesPitchKind::kQTP_G_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedOctave:
-          result = msrQuarterTonesPitchKind::kQTP_G_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedNinth:
-          result = msrQuarterTonesPitchKind::kQTP_A_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorNinth:
-          result = msrQuarterTonesPitchKind::kQTP_A_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorNinth:
-          result = msrQuarterTonesPitchKind::kQTP_A_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedNinth:
-          result = msrQuarterTonesPitchKind::kQTP_A_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedTenth:
-          result = msrQuarterTonesPitchKind::kQTP_B_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorTenth:
-          result = msrQuarterTonesPitchKind::kQTP_B_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorTenth:
-          result = msrQuarterTonesPitchKind::kQTP_B_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedTenth:
-          result = msrQuarterTonesPitchKind::kQTP_B_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedEleventh:
-          result = msrQuarterTonesPitchKind::kQTP_C_Natural;
-          break;
-        case msrIntervalKind::kIntervalPerfectEleventh:
-          result = msrQuarterTonesPitchKind::kQTP_C_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedEleventh:
-          result = msrQuarterTonesPitchKind::kQTP_C_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedTwelfth:
-          result = msrQuarterTonesPitchKind::kQTP_D_Natural;
-          break;
-        case msrIntervalKind::kIntervalPerfectTwelfth:
-          result = msrQuarterTonesPitchKind::kQTP_D_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedTwelfth:
-          result = msrQuarterTonesPitchKind::kQTP_D_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedThirteenth:
-          result = msrQuarterTonesPitchKind::kQTP_E_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorThirteenth:
-          result = msrQuarterTonesPitchKind::kQTP_E_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorThirteenth:
-          result = msrQuarterTonesPitchKind::kQTP_E_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedThirteenth:
-          result = msrQuarterTonesPitchKind::kQTP_E_DoubleSharp;
-          break;
-      } // switch
-      break;
-
-    case msrQuarterTonesPitchKind::kQTP_A_Flat:
-      switch (intervalKind) {
-        case msrIntervalKind::kInterval_UNKNOWN_:
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedUnisson:
-          result = msrQuarterTonesPitchKind::kQTP_A_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalPerfectUnisson:
-          result = msrQuarterTonesPitchKind::kQTP_A_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedUnisson:
-          result = msrQuarterTonesPitchKind::kQTP_A_Natural;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSecond:
-          result = msrQuarterTonesPitchKind::kQTP_B_TripleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorSecond:
-          result = msrQuarterTonesPitchKind::kQTP_B_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMajorSecond:
-          result = msrQuarterTonesPitchKind::kQTP_B_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSecond:
-          result = msrQuarterTonesPitchKind::kQTP_B_Natural;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedThird:
-          result = msrQuarterTonesPitchKind::kQTP_C_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorThird:
-          result = msrQuarterTonesPitchKind::kQTP_C_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorThird:
-          result = msrQuarterTonesPitchKind::kQTP_C_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedThird:
-          result = msrQuarterTonesPitchKind::kQTP_C_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedFourth:
-          result = msrQuarterTonesPitchKind::kQTP_D_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalPerfectFourth:
-          result = msrQuarterTonesPitchKind::kQTP_D_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedFourth:
-          result = msrQuarterTonesPitchKind::kQTP_D_Natural;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedFifth:
-          result = msrQuarterTonesPitchKind::kQTP_E_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalPerfectFifth:
-          result = msrQuarterTonesPitchKind::kQTP_E_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedFifth:
-          result = msrQuarterTonesPitchKind::kQTP_E_Natural;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSixth:
-          result = msrQuarterTonesPitchKind::kQTP_F_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorSixth:
-          result = msrQuarterTonesPitchKind::kQTP_F_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorSixth:
-          result = msrQuarterTonesPitchKind::kQTP_F_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSixth:
-          result = msrQuarterTonesPitchKind::kQTP_F_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSeventh:
-          result = msrQuarterTonesPitchKind::kQTP_G_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorSeventh:
-          result = msrQuarterTonesPitchKind::kQTP_G_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorSeventh:
-          result = msrQuarterTonesPitchKind::kQTP_G_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSeventh:
-          result = msrQuarterTonesPitchKind::kQTP_G_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedOctave:
-          result = msrQuarterTonesPitchKind::kQTP_A_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalPerfectOctave:
-          result = msrQuarterTonesPitchKind::kQTP_A_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedOctave:
-          result = msrQuarterTonesPitchKind::kQTP_A_Natural;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedNinth:
-          result = msrQuarterTonesPitchKind::kQTP_B_TripleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorNinth:
-          result = msrQuarterTonesPitchKind::kQTP_B_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMajorNinth:
-          result = msrQuarterTonesPitchKind::kQTP_B_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedNinth:
-          result = msrQuarterTonesPitchKind::kQTP_B_Natural;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedTenth:
-          result = msrQuarterTonesPitchKind::kQTP_C_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorTenth:
-          result = msrQuarterTonesPitchKind::kQTP_C_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorTenth:
-          result = msrQuarterTonesPitchKind::kQTP_C_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedTenth:
-          result = msrQuarterTonesPitchKind::kQTP_C_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedEleventh:
-          result = msrQuarterTonesPitchKind::kQTP_D_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalPerfectEleventh:
-          result = msrQuarterTonesPitchKind::kQTP_D_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedEleventh:
-          result = msrQuarterTonesPitchKind::kQTP_D_Natural;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedTwelfth:
-          result = msrQuarterTonesPitchKind::kQTP_E_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalPerfectTwelfth:
-          result = msrQuarterTonesPitchKind::kQTP_E_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedTwelfth:
-          result = msrQuarterTonesPitchKind::kQTP_E_Natural;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedThirteenth:
-          result = msrQuarterTonesPitchKind::kQTP_F_TripleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorThirteenth:
-          result = msrQuarterTonesPitchKind::kQTP_F_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMajorThirteenth:
-          result = msrQuarterTonesPitchKind::kQTP_F_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedThirteenth:
-          result = msrQuarterTonesPitchKind::kQTP_F_Natural;
-          break;
-      } // switch
-      break;
-
-    case msrQuarterTonesPitchKind::kQTP_A_Natural:
-      switch (intervalKind) {
-        case msrIntervalKind::kInterval_UNKNOWN_:
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedUnisson:
-          result = msrQuarterTonesPitchKind::kQTP_A_Flat;
-          break;
-        case msrIntervalKind::kIntervalPerfectUnisson:
-          result = msrQuarterTonesPitchKind::kQTP_A_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedUnisson:
-          result = msrQuarterTonesPitchKind::kQTP_A_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSecond:
-          result = msrQuarterTonesPitchKind::kQTP_B_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorSecond:
-          result = msrQuarterTonesPitchKind::kQTP_B_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorSecond:
-          result = msrQuarterTonesPitchKind::kQTP_B_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSecond:
-          result = msrQuarterTonesPitchKind::kQTP_B_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedThird:
-          result = msrQuarterTonesPitchKind::kQTP_C_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorThird:
-          result = msrQuarterTonesPitchKind::kQTP_C_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorThird:
-          result = msrQuarterTonesPitchKind::kQTP_C_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedThird:
-          result = msrQuarterTonesPitchKind::kQTP_C_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedFourth:
-          result = msrQuarterTonesPitchKind::kQTP_D_Flat;
-          break;
-        case msrIntervalKind::kIntervalPerfectFourth:
-          result = msrQuarterTonesPitchKind::kQTP_D_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedFourth:
-          result = msrQuarterTonesPitchKind::kQTP_D_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedFifth:
-          result = msrQuarterTonesPitchKind::kQTP_E_Flat;
-          break;
-        case msrIntervalKind::kIntervalPerfectFifth:
-          result = msrQuarterTonesPitchKind::kQTP_E_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedFifth:
-          result = msrQuarterTonesPitchKind::kQTP_E_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSixth:
-          result = msrQuarterTonesPitchKind::kQTP_F_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorSixth:
-          result = msrQuarterTonesPitchKind::kQTP_F_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorSixth:
-          result = msrQuarterTonesPitchKind::kQTP_F_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSixth:
-          result = msrQuarterTonesPitchKind::kQTP_F_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSeventh:
-          result = msrQuarterTonesPitchKind::kQTP_G_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorSeventh:
-          result = msrQuarterTonesPitchKind::kQTP_G_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorSeventh:
-          result = msrQuarterTonesPitchKind::kQTP_G_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSeventh:
-          result = msrQuarterTonesPitchKind::kQTP_G_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedOctave:
-          result = msrQuarterTonesPitchKind::kQTP_A_Flat;
-          break;
-        case msrIntervalKind::kIntervalPerfectOctave:
-          result = msrQuarterTonesPitchKind::kQTP_A_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedOctave:
-          result = msrQuarterTonesPitchKind::kQTP_A_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedNinth:
-          result = msrQuarterTonesPitchKind::kQTP_B_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorNinth:
-          result = msrQuarterTonesPitchKind::kQTP_B_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorNinth:
-          result = msrQuarterTonesPitchKind::kQTP_B_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedNinth:
-          result = msrQuarterTonesPitchKind::kQTP_B_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedTenth:
-          result = msrQuarterTonesPitchKind::kQTP_C_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorTenth:
-          result = msrQuarterTonesPitchKind::kQTP_C_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorTenth:
-          result = msrQuarterTonesPitchKind::kQTP_C_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedTenth:
-          result = msrQuarterTonesPitchKind::kQTP_C_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedEleventh:
-          result = msrQuarterTonesPitchKind::kQTP_D_Flat;
-          break;
-        case msrIntervalKind::kIntervalPerfectEleventh:
-          result = msrQuarterTonesPitchKind::kQTP_D_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedEleventh:
-          result = msrQuarterTonesPitchKind::kQTP_D_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedTwelfth:
-          result = msrQuarterTonesPitchKind::kQTP_E_Flat;
-          break;
-        case msrIntervalKind::kIntervalPerfectTwelfth:
-          result = msrQuarterTonesPitchKind::kQTP_E_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedTwelfth:
-          result = msrQuarterTonesPitchKind::kQTP_E_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedThirteenth:
-          result = msrQuarterTonesPitchKind::kQTP_F_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorThirteenth:
-          result = msrQuarterTonesPitchKind::kQTP_F_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorThirteenth:
-          result = msrQuarterTonesPitchKind::kQTP_F_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedThirteenth:
-          result = msrQuarterTonesPitchKind::kQTP_F_DoubleSharp;
-          break;
-      } // switch
-      break;
-
-    case msrQuarterTonesPitchKind::kQTP_A_Sharp:
-      break;
-
-    case msrQuarterTonesPitchKind::kQTP_B_Flat:
-      switch (intervalKind) {
-        case msrIntervalKind::kInterval_UNKNOWN_:
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedUnisson:
-          result = msrQuarterTonesPitchKind::kQTP_B_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalPerfectUnisson:
-          result = msrQuarterTonesPitchKind::kQTP_B_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedUnisson:
-          result = msrQuarterTonesPitchKind::kQTP_B_Natural;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSecond:
-          result = msrQuarterTonesPitchKind::kQTP_C_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorSecond:
-          result = msrQuarterTonesPitchKind::kQTP_C_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorSecond:
-          result = msrQuarterTonesPitchKind::kQTP_C_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSecond:
-          result = msrQuarterTonesPitchKind::kQTP_C_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedThird:
-          result = msrQuarterTonesPitchKind::kQTP_D_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorThird:
-          result = msrQuarterTonesPitchKind::kQTP_D_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorThird:
-          result = msrQuarterTonesPitchKind::kQTP_D_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedThird:
-          result = msrQuarterTonesPitchKind::kQTP_D_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedFourth:
-          result = msrQuarterTonesPitchKind::kQTP_E_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalPerfectFourth:
-          result = msrQuarterTonesPitchKind::kQTP_E_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedFourth:
-          result = msrQuarterTonesPitchKind::kQTP_E_Natural;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedFifth:
-          result = msrQuarterTonesPitchKind::kQTP_F_Flat;
-          break;
-        case msrIntervalKind::kIntervalPerfectFifth:
-          result = msrQuarterTonesPitchKind::kQTP_F_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedFifth:
-          result = msrQuarterTonesPitchKind::kQTP_F_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSixth:
-          result = msrQuarterTonesPitchKind::kQTP_G_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorSixth:
-          result = msrQuarterTonesPitchKind::kQTP_G_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorSixth:
-          result = msrQuarterTonesPitchKind::kQTP_G_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSixth:
-          result = msrQuarterTonesPitchKind::kQTP_G_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSeventh:
-          result = msrQuarterTonesPitchKind::kQTP_A_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorSeventh:
-          result = msrQuarterTonesPitchKind::kQTP_A_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorSeventh:
-          result = msrQuarterTonesPitchKind::kQTP_A_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSeventh:
-          result = msrQuarterTonesPitchKind::kQTP_A_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedOctave:
-          result = msrQuarterTonesPitchKind::kQTP_B_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalPerfectOctave:
-          result = msrQuarterTonesPitchKind::kQTP_B_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedOctave:
-          result = msrQuarterTonesPitchKind::kQTP_B_Natural;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedNinth:
-          result = msrQuarterTonesPitchKind::kQTP_C_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorNinth:
-          result = msrQuarterTonesPitchKind::kQTP_C_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorNinth:
-          result = msrQuarterTonesPitchKind::kQTP_C_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedNinth:
-          result = msrQuarterTonesPitchKind::kQTP_C_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedTenth:
-          result = msrQuarterTonesPitchKind::kQTP_D_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorTenth:
-          result = msrQuarterTonesPitchKind::kQTP_D_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorTenth:
-          result = msrQuarterTonesPitchKind::kQTP_D_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedTenth:
-          result = msrQuarterTonesPitchKind::kQTP_D_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedEleventh:
-          result = msrQuarterTonesPitchKind::kQTP_E_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalPerfectEleventh:
-          result = msrQuarterTonesPitchKind::kQTP_E_Flat;
-          break;
-        case msrIntervalKind::kIntervalAugmentedEleventh:
-          result = msrQuarterTonesPitchKind::kQTP_E_Natural;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedTwelfth:
-          result = msrQuarterTonesPitchKind::kQTP_F_Flat;
-          break;
-        case msrIntervalKind::kIntervalPerfectTwelfth:
-          result = msrQuarterTonesPitchKind::kQTP_F_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedTwelfth:
-          result = msrQuarterTonesPitchKind::kQTP_F_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedThirteenth:
-          result = msrQuarterTonesPitchKind::kQTP_G_DoubleFlat;
-          break;
-        case msrIntervalKind::kIntervalMinorThirteenth:
-          result = msrQuarterTonesPitchKind::kQTP_G_Flat;
-          break;
-        case msrIntervalKind::kIntervalMajorThirteenth:
-          result = msrQuarterTonesPitchKind::kQTP_G_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedThirteenth:
-          result = msrQuarterTonesPitchKind::kQTP_G_Sharp;
-          break;
-      } // switch
-      break;
-
-    case msrQuarterTonesPitchKind::kQTP_B_Natural:
-      switch (intervalKind) {
-        case msrIntervalKind::kInterval_UNKNOWN_:
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedUnisson:
-          result = msrQuarterTonesPitchKind::kQTP_B_Flat;
-          break;
-        case msrIntervalKind::kIntervalPerfectUnisson:
-          result = msrQuarterTonesPitchKind::kQTP_B_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedUnisson:
-          result = msrQuarterTonesPitchKind::kQTP_B_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSecond:
-          result = msrQuarterTonesPitchKind::kQTP_C_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorSecond:
-          result = msrQuarterTonesPitchKind::kQTP_C_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorSecond:
-          result = msrQuarterTonesPitchKind::kQTP_C_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSecond:
-          result = msrQuarterTonesPitchKind::kQTP_C_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedThird:
-          result = msrQuarterTonesPitchKind::kQTP_D_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorThird:
-          result = msrQuarterTonesPitchKind::kQTP_D_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorThird:
-          result = msrQuarterTonesPitchKind::kQTP_D_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedThird:
-          result = msrQuarterTonesPitchKind::kQTP_D_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedFourth:
-          result = msrQuarterTonesPitchKind::kQTP_E_Flat;
-          break;
-        case msrIntervalKind::kIntervalPerfectFourth:
-          result = msrQuarterTonesPitchKind::kQTP_E_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedFourth:
-          result = msrQuarterTonesPitchKind::kQTP_E_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedFifth:
-          result = msrQuarterTonesPitchKind::kQTP_F_Natural;
-          break;
-        case msrIntervalKind::kIntervalPerfectFifth:
-          result = msrQuarterTonesPitchKind::kQTP_F_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedFifth:
-          result = msrQuarterTonesPitchKind::kQTP_F_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSixth:
-          result = msrQuarterTonesPitchKind::kQTP_G_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorSixth:
-          result = msrQuarterTonesPitchKind::kQTP_G_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorSixth:
-          result = msrQuarterTonesPitchKind::kQTP_G_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSixth:
-          result = msrQuarterTonesPitchKind::kQTP_G_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSeventh:
-          result = msrQuarterTonesPitchKind::kQTP_A_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorSeventh:
-          result = msrQuarterTonesPitchKind::kQTP_A_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorSeventh:
-          result = msrQuarterTonesPitchKind::kQTP_A_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSeventh:
-          result = msrQuarterTonesPitchKind::kQTP_A_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedOctave:
-          result = msrQuarterTonesPitchKind::kQTP_B_Flat;
-          break;
-        case msrIntervalKind::kIntervalPerfectOctave:
-          result = msrQuarterTonesPitchKind::kQTP_B_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedOctave:
-          result = msrQuarterTonesPitchKind::kQTP_B_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedNinth:
-          result = msrQuarterTonesPitchKind::kQTP_C_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorNinth:
-          result = msrQuarterTonesPitchKind::kQTP_C_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorNinth:
-          result = msrQuarterTonesPitchKind::kQTP_C_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedNinth:
-          result = msrQuarterTonesPitchKind::kQTP_C_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedTenth:
-          result = msrQuarterTonesPitchKind::kQTP_D_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorTenth:
-          result = msrQuarterTonesPitchKind::kQTP_D_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorTenth:
-          result = msrQuarterTonesPitchKind::kQTP_D_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedTenth:
-          result = msrQuarterTonesPitchKind::kQTP_D_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedEleventh:
-          result = msrQuarterTonesPitchKind::kQTP_E_Flat;
-          break;
-        case msrIntervalKind::kIntervalPerfectEleventh:
-          result = msrQuarterTonesPitchKind::kQTP_E_Natural;
-          break;
-        case msrIntervalKind::kIntervalAugmentedEleventh:
-          result = msrQuarterTonesPitchKind::kQTP_E_Sharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedTwelfth:
-          result = msrQuarterTonesPitchKind::kQTP_F_Natural;
-          break;
-        case msrIntervalKind::kIntervalPerfectTwelfth:
-          result = msrQuarterTonesPitchKind::kQTP_F_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedTwelfth:
-          result = msrQuarterTonesPitchKind::kQTP_F_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedThirteenth:
-          result = msrQuarterTonesPitchKind::kQTP_G_Flat;
-          break;
-        case msrIntervalKind::kIntervalMinorThirteenth:
-          result = msrQuarterTonesPitchKind::kQTP_G_Natural;
-          break;
-        case msrIntervalKind::kIntervalMajorThirteenth:
-          result = msrQuarterTonesPitchKind::kQTP_G_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedThirteenth:
-          result = msrQuarterTonesPitchKind::kQTP_G_DoubleSharp;
-          break;
-      } // switch
-      break;
-
-    case msrQuarterTonesPitchKind::kQTP_B_Sharp:
-      switch (intervalKind) {
-        case msrIntervalKind::kInterval_UNKNOWN_:
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedUnisson:
-          result = msrQuarterTonesPitchKind::kQTP_B_Natural;
-          break;
-        case msrIntervalKind::kIntervalPerfectUnisson:
-          result = msrQuarterTonesPitchKind::kQTP_B_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedUnisson:
-          result = msrQuarterTonesPitchKind::kQTP_B_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSecond:
-          result = msrQuarterTonesPitchKind::kQTP_C_Natural;
-          break;
-        case msrIntervalKind::kIntervalMinorSecond:
-          result = msrQuarterTonesPitchKind::kQTP_C_Sharp;
-          break;
-        case msrIntervalKind::kIntervalMajorSecond:
-          result = msrQuarterTonesPitchKind::kQTP_C_DoubleSharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSecond:
-          result = msrQuarterTonesPitchKind::kQTP_C_TripleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedThird:
-          result = msrQuarterTonesPitchKind::kQTP_D_Natural;
-          break;
-        case msrIntervalKind::kIntervalMinorThird:
-          result = msrQuarterTonesPitchKind::kQTP_D_Sharp;
-          break;
-        case msrIntervalKind::kIntervalMajorThird:
-          result = msrQuarterTonesPitchKind::kQTP_D_DoubleSharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedThird:
-          result = msrQuarterTonesPitchKind::kQTP_D_TripleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedFourth:
-          result = msrQuarterTonesPitchKind::kQTP_E_Natural;
-          break;
-        case msrIntervalKind::kIntervalPerfectFourth:
-          result = msrQuarterTonesPitchKind::kQTP_E_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedFourth:
-          result = msrQuarterTonesPitchKind::kQTP_E_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedFifth:
-          result = msrQuarterTonesPitchKind::kQTP_F_Sharp;
-          break;
-        case msrIntervalKind::kIntervalPerfectFifth:
-          result = msrQuarterTonesPitchKind::kQTP_F_DoubleSharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedFifth:
-          result = msrQuarterTonesPitchKind::kQTP_F_TripleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSixth:
-          result = msrQuarterTonesPitchKind::kQTP_G_Natural;
-          break;
-        case msrIntervalKind::kIntervalMinorSixth:
-          result = msrQuarterTonesPitchKind::kQTP_G_Sharp;
-          break;
-        case msrIntervalKind::kIntervalMajorSixth:
-          result = msrQuarterTonesPitchKind::kQTP_G_DoubleSharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSixth:
-          result = msrQuarterTonesPitchKind::kQTP_G_TripleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedSeventh:
-          result = msrQuarterTonesPitchKind::kQTP_A_Natural;
-          break;
-        case msrIntervalKind::kIntervalMinorSeventh:
-          result = msrQuarterTonesPitchKind::kQTP_A_Sharp;
-          break;
-        case msrIntervalKind::kIntervalMajorSeventh:
-          result = msrQuarterTonesPitchKind::kQTP_A_DoubleSharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedSeventh:
-          result = msrQuarterTonesPitchKind::kQTP_A_TripleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedOctave:
-          result = msrQuarterTonesPitchKind::kQTP_B_Natural;
-          break;
-        case msrIntervalKind::kIntervalPerfectOctave:
-          result = msrQuarterTonesPitchKind::kQTP_B_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedOctave:
-          result = msrQuarterTonesPitchKind::kQTP_B_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedNinth:
-          result = msrQuarterTonesPitchKind::kQTP_C_Natural;
-          break;
-        case msrIntervalKind::kIntervalMinorNinth:
-          result = msrQuarterTonesPitchKind::kQTP_C_Sharp;
-          break;
-        case msrIntervalKind::kIntervalMajorNinth:
-          result = msrQuarterTonesPitchKind::kQTP_C_DoubleSharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedNinth:
-          result = msrQuarterTonesPitchKind::kQTP_C_TripleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedTenth:
-          result = msrQuarterTonesPitchKind::kQTP_D_Natural;
-          break;
-        case msrIntervalKind::kIntervalMinorTenth:
-          result = msrQuarterTonesPitchKind::kQTP_D_Sharp;
-          break;
-        case msrIntervalKind::kIntervalMajorTenth:
-          result = msrQuarterTonesPitchKind::kQTP_D_DoubleSharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedTenth:
-          result = msrQuarterTonesPitchKind::kQTP_D_TripleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedEleventh:
-          result = msrQuarterTonesPitchKind::kQTP_E_Natural;
-          break;
-        case msrIntervalKind::kIntervalPerfectEleventh:
-          result = msrQuarterTonesPitchKind::kQTP_E_Sharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedEleventh:
-          result = msrQuarterTonesPitchKind::kQTP_E_DoubleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedTwelfth:
-          result = msrQuarterTonesPitchKind::kQTP_F_Sharp;
-          break;
-        case msrIntervalKind::kIntervalPerfectTwelfth:
-          result = msrQuarterTonesPitchKind::kQTP_F_DoubleSharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedTwelfth:
-          result = msrQuarterTonesPitchKind::kQTP_F_TripleSharp;
-          break;
-
-        case msrIntervalKind::kIntervalDiminishedThirteenth:
-          result = msrQuarterTonesPitchKind::kQTP_G_Natural;
-          break;
-        case msrIntervalKind::kIntervalMinorThirteenth:
-          result = msrQuarterTonesPitchKind::kQTP_G_Sharp;
-          break;
-        case msrIntervalKind::kIntervalMajorThirteenth:
-          result = msrQuarterTonesPitchKind::kQTP_G_DoubleSharp;
-          break;
-        case msrIntervalKind::kIntervalAugmentedThirteenth:
-          result = msrQuarterTonesPitchKind::kQTP_G_TripleSharp;
-          break;
-      } // switch
-      break;
-
-      default:
-      {
-        // computing intervals on double or triple flats/sharps
-        // is not considered useful, hence not supported
-        std::stringstream ss;
-
-        ss <<
-          "Sorry, computing intervals from quartertones pitch '" <<
-          msrQuarterTonesPitchKindAsStringInLanguage (
-            quarterTonesPitchKind,
-            gMsrOahGroup->
-              getMsrQuarterTonesPitchesLanguageKind ()) <<
-          '(' << msrQuarterTonesPitchKindAsString (quarterTonesPitchKind) << ")" <<
-          "' is not supported"
-          ", line: " << inputLineNumber;
-
-        msrUnsupported (
-          gServiceRunData->getInputSourceName (),
-          inputLineNumber,
-          __FILE__, mfInputLineNumber (__LINE__),
-          ss.str ());
-      }
-  } // switch
-
-  return result;
-}
-
-msrIntervalKind intervalBetweenSemiTonesPitches (
-  msrSemiTonesPitchKind semiTonesPitch1,
-  msrSemiTonesPitchKind semiTonesPitch2)
-{
-  msrIntervalKind result = msrIntervalKind::kInterval_UNKNOWN_;
-
-  msrSemiTonesPitchKind
-    workSemiTonesPitch1 = semiTonesPitch1,
-    workSemiTonesPitch2 = semiTonesPitch2;
-
-  // order the semitones pitches so that
-  // workSemiTonesPitch1 is greater or equal to workSemiTonesPitch2
-  // according to the enum class type
-  Bool invertInterval (false);
-
-  if (semiTonesPitch1 < semiTonesPitch2) {
-    workSemiTonesPitch1 = semiTonesPitch2;
-    workSemiTonesPitch2 = semiTonesPitch1;
-    invertInterval = true;
-  }
-
-  switch (workSemiTonesPitch1) {
-    case msrSemiTonesPitchKind::kSTP_NoSemiTonesPitch:
-      break;
-
-    case msrSemiTonesPitchKind::kSTP_C_TripleFlat:
-      switch (workSemiTonesPitch2) {
-        case msrSemiTonesPitchKind::kSTP_NoSemiTonesPitch:
-          break;
-
- /*
-     msrIntervalKind::kIntervalDiminishedUnisson, msrIntervalKind::kIntervalPerfectUnisson, msrIntervalKind::kIntervalAugmentedUnisson,
-
-  msrIntervalKind::kIntervalDiminishedSecond, msrIntervalKind::kIntervalMinorSecond, msrIntervalKind::kIntervalMajorSecond, msrIntervalKind::kIntervalAugmentedSecond,
-
-  msrIntervalKind::kIntervalDiminishedThird, msrIntervalKind::kIntervalMinorThird, msrIntervalKind::kIntervalMajorThird, msrIntervalKind::kIntervalAugmentedThird,
-
-  msrIntervalKind::kIntervalDiminishedFourth, msrIntervalKind::kIntervalPerfectFourth, msrIntervalKind::kIntervalAugmentedFourth,
-
-  msrIntervalKind::kIntervalDiminishedFifth, msrIntervalKind::kIntervalPerfectFifth, msrIntervalKind::kIntervalAugmentedFifth,
-
-  msrIntervalKind::kIntervalDiminishedSixth, msrIntervalKind::kIntervalMinorSixth, msrIntervalKind::kIntervalMajorSixth, msrIntervalKind::kIntervalAugmentedSixth,
-
-  msrIntervalKind::kIntervalDiminishedSeventh, msrIntervalKind::kIntervalMinorSeventh, msrIntervalKind::kIntervalMajorSeventh, msrIntervalKind::kIntervalAugmentedSeventh,
-
-  msrIntervalKind::kIntervalDiminishedOctave, msrIntervalKind::kIntervalPerfectOctave, msrIntervalKind::kIntervalAugmentedOctave,
-
-  msrIntervalKind::kIntervalDiminishedNinth, msrIntervalKind::kIntervalMinorNinth, msrIntervalKind::kIntervalMajorNinth, msrIntervalKind::kIntervalAugmentedNinth,
-
-  msrIntervalKind::kIntervalDiminishedTenth, msrIntervalKind::kIntervalMinorTenth, msrIntervalKind::kIntervalMajorTenth, msrIntervalKind::kIntervalAugmentedTenth,
-
-  msrIntervalKind::kIntervalDiminishedEleventh, msrIntervalKind::kIntervalPerfectEleventh, msrIntervalKind::kIntervalAugmentedEleventh,
-
-  msrIntervalKind::kIntervalDiminishedTwelfth, msrIntervalKind::kIntervalPerfectTwelfth, msrIntervalKind::kIntervalAugmentedTwelfth,
-
-  msrIntervalKind::kIntervalDiminishedThirteenth, msrIntervalKind::kIntervalMinorThirteenth, msrIntervalKind::kIntervalMajorThirteenth, msrIntervalKind::kIntervalAugmentedThirteenth };
-
-*/
-
-        case msrSemiTonesPitchKind::kSTP_C_TripleFlat:
-          break;
-        case msrSemiTonesPitchKind::kSTP_C_DoubleFlat:
-          break;
-        case msrSemiTonesPitchKind::kSTP_C_Flat:
-          break;
-        case msrSemiTonesPitchKind::kSTP_C_Natural:
-          break;
-        case msrSemiTonesPitchKind::kSTP_C_Sharp:
-          break;
-        case msrSemiTonesPitchKind::kSTP_C_DoubleSharp:
-          break;
-        case msrSemiTonesPitchKind::kSTP_C_TripleSharp:
-          break;
-
-        case msrSemiTonesPitchKind::kSTP_D_TripleFlat:
-          break;
-        case msrSemiTonesPitchKind::kSTP_D_DoubleFlat:
-          break;
-        case msrSemiTonesPitchKind::kSTP_D_Flat:
-          break;
-        case msrSemiTonesPitchKind::kSTP_D_Natural:
-          break;
-        case msrSemiTonesPitchKind::kSTP_D_Sharp:
-          break;
-        case msrSemiTonesPitchKind::kSTP_D_DoubleSharp:
-          break;
-        case msrSemiTonesPitchKind::kSTP_D_TripleSharp:
-          break;
-
-        case msrSemiTonesPitchKind::kSTP_E_TripleFlat:
-          break;
-        case msrSemiTonesPitchKind::kSTP_E_DoubleFlat:
-          break;
-        case msrSemiTonesPitchKind::kSTP_E_Flat:
-          break;
-        case msrSemiTonesPitchKind::kSTP_E_Natural:
-          break;
-        case msrSemiTonesPitchKind::kSTP_E_Sharp:
-          break;
-        case msrSemiTonesPitchKind::kSTP_E_DoubleSharp:
-          break;
-        case msrSemiTonesPitchKind::kSTP_E_TripleSharp:
-          break;
-
-        case msrSemiTonesPitchKind::kSTP_F_TripleFlat:
-          break;
-        case msrSemiTonesPitchKind::kSTP_F_DoubleleFlat:
-          break;
-        case msrSemiTonesPitchKind::kSTP_F_Flat:
-          break;
-        case msrSemiTonesPitchKind::kSTP_F_Natural:
-          break;
-        case msrSemiTonesPitchKind::kSTP_F_Sharp:
-          break;
-        case msrSemiTonesPitchKind::kSTP_F_DoubleSharp:
-          break;
-        case msrSemiTonesPitchKind::kSTP_F_TripleSharp:
-          break;
-
-        case msrSemiTonesPitchKind::kSTP_G_TripleFlat:
-          break;
-        case msrSemiTonesPitchKind::kSTP_G_DoubleFlat:
-          break;
-        case msrSemiTonesPitchKind::kSTP_G_Flat:
-          break;
-        case msrSemiTonesPitchKind::kSTP_G_Natural:
-          break;
-        case msrSemiTonesPitchKind::kSTP_G_Sharp:
-          break;
-        case msrSemiTonesPitchKind::kSTP_G_DoubleSharp:
-          break;
-        case msrSemiTonesPitchKind::kSTP_G_TripleSharp:
-          break;
-
-        case msrSemiTonesPitchKind::kSTP_A_TripleFlat:
-          break;
-        case msrSemiTonesPitchKind::kSTP_A_DoubleFlat:
-          break;
-        case msrSemiTonesPitchKind::kSTP_A_Flat:
-          break;
-        case msrSemiTonesPitchKind::kSTP_A_Natural:
-          break;
-        case msrSemiTonesPitchKind::kSTP_A_Sharp:
-          break;
-        case msrSemiTonesPitchKind::kSTP_A_DoubleSharp:
-          break;
-        case msrSemiTonesPitchKind::kSTP_A_TripleSharp:
-          break;
-
-        case msrSemiTonesPitchKind::kSTP_B_TripleFlat:
-          break;
-        case msrSemiTonesPitchKind::kSTP_B_DoubleFlat:
-          break;
-        case msrSemiTonesPitchKind::kSTP_B_Flat:
-          break;
-        case msrSemiTonesPitchKind::kSTP_B_Natural:
-          break;
-        case msrSemiTonesPitchKind::kSTP_B_Sharp:
-          break;
-        case msrSemiTonesPitchKind::kSTP_B_DoubleSharp:
-          break;
-        case msrSemiTonesPitchKind::kSTP_B_TripleSharp:
-          break;
-      } // switch
-      break;
-
-    case msrSemiTonesPitchKind::kSTP_C_DoubleFlat:
-      break;
-    case msrSemiTonesPitchKind::kSTP_C_Flat:
-      break;
-    case msrSemiTonesPitchKind::kSTP_C_Natural:
-      break;
-    case msrSemiTonesPitchKind::kSTP_C_Sharp:
-      break;
-    case msrSemiTonesPitchKind::kSTP_C_DoubleSharp:
-      break;
-    case msrSemiTonesPitchKind::kSTP_C_TripleSharp:
-      break;
-
-    case msrSemiTonesPitchKind::kSTP_D_TripleFlat:
-      break;
-    case msrSemiTonesPitchKind::kSTP_D_DoubleFlat:
-      break;
-    case msrSemiTonesPitchKind::kSTP_D_Flat:
-      break;
-    case msrSemiTonesPitchKind::kSTP_D_Natural:
-      break;
-    case msrSemiTonesPitchKind::kSTP_D_Sharp:
-      break;
-    case msrSemiTonesPitchKind::kSTP_D_DoubleSharp:
-      break;
-    case msrSemiTonesPitchKind::kSTP_D_TripleSharp:
-      break;
-
-    case msrSemiTonesPitchKind::kSTP_E_TripleFlat:
-      break;
-    case msrSemiTonesPitchKind::kSTP_E_DoubleFlat:
-      break;
-    case msrSemiTonesPitchKind::kSTP_E_Flat:
-      break;
-    case msrSemiTonesPitchKind::kSTP_E_Natural:
-      break;
-    case msrSemiTonesPitchKind::kSTP_E_Sharp:
-      break;
-    case msrSemiTonesPitchKind::kSTP_E_DoubleSharp:
-      break;
-    case msrSemiTonesPitchKind::kSTP_E_TripleSharp:
-      break;
-
-    case msrSemiTonesPitchKind::kSTP_F_TripleFlat:
-      break;
-    case msrSemiTonesPitchKind::kSTP_F_DoubleleFlat:
-      break;
-    case msrSemiTonesPitchKind::kSTP_F_Flat:
-      break;
-    case msrSemiTonesPitchKind::kSTP_F_Natural:
-      break;
-    case msrSemiTonesPitchKind::kSTP_F_Sharp:
-      break;
-    case msrSemiTonesPitchKind::kSTP_F_DoubleSharp:
-      break;
-    case msrSemiTonesPitchKind::kSTP_F_TripleSharp:
-      break;
-
-    case msrSemiTonesPitchKind::kSTP_G_TripleFlat:
-      break;
-    case msrSemiTonesPitchKind::kSTP_G_DoubleFlat:
-      break;
-    case msrSemiTonesPitchKind::kSTP_G_Flat:
-      break;
-    case msrSemiTonesPitchKind::kSTP_G_Natural:
-      break;
-    case msrSemiTonesPitchKind::kSTP_G_Sharp:
-      break;
-    case msrSemiTonesPitchKind::kSTP_G_DoubleSharp:
-      break;
-    case msrSemiTonesPitchKind::kSTP_G_TripleSharp:
-      break;
-
-    case msrSemiTonesPitchKind::kSTP_A_TripleFlat:
-      break;
-    case msrSemiTonesPitchKind::kSTP_A_DoubleFlat:
-      break;
-    case msrSemiTonesPitchKind::kSTP_A_Flat:
-      break;
-    case msrSemiTonesPitchKind::kSTP_A_Natural:
-      break;
-    case msrSemiTonesPitchKind::kSTP_A_Sharp:
-      break;
-    case msrSemiTonesPitchKind::kSTP_A_DoubleSharp:
-      break;
-    case msrSemiTonesPitchKind::kSTP_A_TripleSharp:
-      break;
-
-    case msrSemiTonesPitchKind::kSTP_B_TripleFlat:
-      break;
-    case msrSemiTonesPitchKind::kSTP_B_DoubleFlat:
-      break;
-    case msrSemiTonesPitchKind::kSTP_B_Flat:
-      break;
-    case msrSemiTonesPitchKind::kSTP_B_Natural:
-      break;
-    case msrSemiTonesPitchKind::kSTP_B_Sharp:
-      break;
-
-    case msrSemiTonesPitchKind::kSTP_B_DoubleSharp:
-      switch (workSemiTonesPitch2) {
-        case msrSemiTonesPitchKind::kSTP_NoSemiTonesPitch:
-          break;
-
- /*
-     msrIntervalKind::kIntervalDiminishedUnisson, msrIntervalKind::kIntervalPerfectUnisson, msrIntervalKind::kIntervalAugmentedUnisson,
-
-  msrIntervalKind::kIntervalDiminishedSecond, msrIntervalKind::kIntervalMinorSecond, msrIntervalKind::kIntervalMajorSecond, msrIntervalKind::kIntervalAugmentedSecond,
-
-  msrIntervalKind::kIntervalDiminishedThird, msrIntervalKind::kIntervalMinorThird, msrIntervalKind::kIntervalMajorThird, msrIntervalKind::kIntervalAugmentedThird,
-
-  msrIntervalKind::kIntervalDiminishedFourth, msrIntervalKind::kIntervalPerfectFourth, msrIntervalKind::kIntervalAugmentedFourth,
-
-  msrIntervalKind::kIntervalDiminishedFifth, msrIntervalKind::kIntervalPerfectFifth, msrIntervalKind::kIntervalAugmentedFifth,
-
-  msrIntervalKind::kIntervalDiminishedSixth, msrIntervalKind::kIntervalMinorSixth, msrIntervalKind::kIntervalMajorSixth, msrIntervalKind::kIntervalAugmentedSixth,
-
-  msrIntervalKind::kIntervalDiminishedSeventh, msrIntervalKind::kIntervalMinorSeventh, msrIntervalKind::kIntervalMajorSeventh, msrIntervalKind::kIntervalAugmentedSeventh,
-
-  msrIntervalKind::kIntervalDiminishedOctave, msrIntervalKind::kIntervalPerfectOctave, msrIntervalKind::kIntervalAugmentedOctave,
-
-  msrIntervalKind::kIntervalDiminishedNinth, msrIntervalKind::kIntervalMinorNinth, msrIntervalKind::kIntervalMajorNinth, msrIntervalKind::kIntervalAugmentedNinth,
-
-  msrIntervalKind::kIntervalDiminishedTenth, msrIntervalKind::kIntervalMinorTenth, msrIntervalKind::kIntervalMajorTenth, msrIntervalKind::kIntervalAugmentedTenth,
-
-  msrIntervalKind::kIntervalDiminishedEleventh, msrIntervalKind::kIntervalPerfectEleventh, msrIntervalKind::kIntervalAugmentedEleventh,
-
-  msrIntervalKind::kIntervalDiminishedTwelfth, msrIntervalKind::kIntervalPerfectTwelfth, msrIntervalKind::kIntervalAugmentedTwelfth,
-
-  msrIntervalKind::kIntervalDiminishedThirteenth, msrIntervalKind::kIntervalMinorThirteenth, msrIntervalKind::kIntervalMajorThirteenth, msrIntervalKind::kIntervalAugmentedThirteenth };
-
-*/
-
-        case msrSemiTonesPitchKind::kSTP_C_TripleFlat:
-          break;
-        case msrSemiTonesPitchKind::kSTP_C_DoubleFlat:
-          break;
-        case msrSemiTonesPitchKind::kSTP_C_Flat:
-          break;
-        case msrSemiTonesPitchKind::kSTP_C_Natural:
-          break;
-        case msrSemiTonesPitchKind::kSTP_C_Sharp:
-          break;
-        case msrSemiTonesPitchKind::kSTP_C_DoubleSharp:
-          break;
-        case msrSemiTonesPitchKind::kSTP_C_TripleSharp:
-          break;
-
-        case msrSemiTonesPitchKind::kSTP_D_TripleFlat:
-          break;
-        case msrSemiTonesPitchKind::kSTP_D_DoubleFlat:
-          break;
-        case msrSemiTonesPitchKind::kSTP_D_Flat:
-          break;
-        case msrSemiTonesPitchKind::kSTP_D_Natural:
-          break;
-        case msrSemiTonesPitchKind::kSTP_D_Sharp:
-          break;
-        case msrSemiTonesPitchKind::kSTP_D_DoubleSharp:
-          break;
-        case msrSemiTonesPitchKind::kSTP_D_TripleSharp:
-          break;
-
-        case msrSemiTonesPitchKind::kSTP_E_TripleFlat:
-          break;
-        case msrSemiTonesPitchKind::kSTP_E_DoubleFlat:
-          break;
-        case msrSemiTonesPitchKind::kSTP_E_Flat:
-          break;
-        case msrSemiTonesPitchKind::kSTP_E_Natural:
-          break;
-        case msrSemiTonesPitchKind::kSTP_E_Sharp:
-          break;
-        case msrSemiTonesPitchKind::kSTP_E_DoubleSharp:
-          break;
-        case msrSemiTonesPitchKind::kSTP_E_TripleSharp:
-          break;
-
-        case msrSemiTonesPitchKind::kSTP_F_TripleFlat:
-          break;
-        case msrSemiTonesPitchKind::kSTP_F_DoubleleFlat:
-          break;
-        case msrSemiTonesPitchKind::kSTP_F_Flat:
-          break;
-        case msrSemiTonesPitchKind::kSTP_F_Natural:
-          break;
-        case msrSemiTonesPitchKind::kSTP_F_Sharp:
-          break;
-        case msrSemiTonesPitchKind::kSTP_F_DoubleSharp:
-          break;
-        case msrSemiTonesPitchKind::kSTP_F_TripleSharp:
-          break;
-
-        case msrSemiTonesPitchKind::kSTP_G_TripleFlat:
-          break;
-        case msrSemiTonesPitchKind::kSTP_G_DoubleFlat:
-          break;
-        case msrSemiTonesPitchKind::kSTP_G_Flat:
-          break;
-        case msrSemiTonesPitchKind::kSTP_G_Natural:
-          break;
-        case msrSemiTonesPitchKind::kSTP_G_Sharp:
-          break;
-        case msrSemiTonesPitchKind::kSTP_G_DoubleSharp:
-          break;
-        case msrSemiTonesPitchKind::kSTP_G_TripleSharp:
-          break;
-
-        case msrSemiTonesPitchKind::kSTP_A_TripleFlat:
-          break;
-        case msrSemiTonesPitchKind::kSTP_A_DoubleFlat:
-          break;
-        case msrSemiTonesPitchKind::kSTP_A_Flat:
-          break;
-        case msrSemiTonesPitchKind::kSTP_A_Natural:
-          break;
-        case msrSemiTonesPitchKind::kSTP_A_Sharp:
-          break;
-        case msrSemiTonesPitchKind::kSTP_A_DoubleSharp:
-          break;
-        case msrSemiTonesPitchKind::kSTP_A_TripleSharp:
-          break;
-
-        case msrSemiTonesPitchKind::kSTP_B_TripleFlat:
-          break;
-        case msrSemiTonesPitchKind::kSTP_B_DoubleFlat:
-          break;
-        case msrSemiTonesPitchKind::kSTP_B_Flat:
-          break;
-        case msrSemiTonesPitchKind::kSTP_B_Natural:
-          break;
-        case msrSemiTonesPitchKind::kSTP_B_Sharp:
-          result = msrIntervalKind::kIntervalAugmentedUnisson;
-          break;
-        case msrSemiTonesPitchKind::kSTP_B_DoubleSharp:
-          result = msrIntervalKind::kIntervalPerfectUnisson;
-          break;
-        case msrSemiTonesPitchKind::kSTP_B_TripleSharp:
-          result = msrIntervalKind::kIntervalPerfectUnisson;
-          break;
-      } // switch
-      break;
-
-    case msrSemiTonesPitchKind::kSTP_B_TripleSharp:
-      switch (workSemiTonesPitch2) {
-        case msrSemiTonesPitchKind::kSTP_NoSemiTonesPitch:
-          break;
-
- /*
-     msrIntervalKind::kIntervalDiminishedUnisson, msrIntervalKind::kIntervalPerfectUnisson, msrIntervalKind::kIntervalAugmentedUnisson,
-
-  msrIntervalKind::kIntervalDiminishedSecond, msrIntervalKind::kIntervalMinorSecond, msrIntervalKind::kIntervalMajorSecond, msrIntervalKind::kIntervalAugmentedSecond,
-
-  msrIntervalKind::kIntervalDiminishedThird, msrIntervalKind::kIntervalMinorThird, msrIntervalKind::kIntervalMajorThird, msrIntervalKind::kIntervalAugmentedThird,
-
-  msrIntervalKind::kIntervalDiminishedFourth, msrIntervalKind::kIntervalPerfectFourth, msrIntervalKind::kIntervalAugmentedFourth,
-
-  msrIntervalKind::kIntervalDiminishedFifth, msrIntervalKind::kIntervalPerfectFifth, msrIntervalKind::kIntervalAugmentedFifth,
-
-  msrIntervalKind::kIntervalDiminishedSixth, msrIntervalKind::kIntervalMinorSixth, msrIntervalKind::kIntervalMajorSixth, msrIntervalKind::kIntervalAugmentedSixth,
-
-  msrIntervalKind::kIntervalDiminishedSeventh, msrIntervalKind::kIntervalMinorSeventh, msrIntervalKind::kIntervalMajorSeventh, msrIntervalKind::kIntervalAugmentedSeventh,
-
-  msrIntervalKind::kIntervalDiminishedOctave, msrIntervalKind::kIntervalPerfectOctave, msrIntervalKind::kIntervalAugmentedOctave,
-
-  msrIntervalKind::kIntervalDiminishedNinth, msrIntervalKind::kIntervalMinorNinth, msrIntervalKind::kIntervalMajorNinth, msrIntervalKind::kIntervalAugmentedNinth,
-
-  msrIntervalKind::kIntervalDiminishedTenth, msrIntervalKind::kIntervalMinorTenth, msrIntervalKind::kIntervalMajorTenth, msrIntervalKind::kIntervalAugmentedTenth,
-
-  msrIntervalKind::kIntervalDiminishedEleventh, msrIntervalKind::kIntervalPerfectEleventh, msrIntervalKind::kIntervalAugmentedEleventh,
-
-  msrIntervalKind::kIntervalDiminishedTwelfth, msrIntervalKind::kIntervalPerfectTwelfth, msrIntervalKind::kIntervalAugmentedTwelfth,
-
-  msrIntervalKind::kIntervalDiminishedThirteenth, msrIntervalKind::kIntervalMinorThirteenth, msrIntervalKind::kIntervalMajorThirteenth, msrIntervalKind::kIntervalAugmentedThirteenth };
-
-*/
-
-        case msrSemiTonesPitchKind::kSTP_C_TripleFlat:
-          break;
-        case msrSemiTonesPitchKind::kSTP_C_DoubleFlat:
-          break;
-        case msrSemiTonesPitchKind::kSTP_C_Flat:
-          break;
-        case msrSemiTonesPitchKind::kSTP_C_Natural:
-          break;
-        case msrSemiTonesPitchKind::kSTP_C_Sharp:
-          break;
-        case msrSemiTonesPitchKind::kSTP_C_DoubleSharp:
-          break;
-        case msrSemiTonesPitchKind::kSTP_C_TripleSharp:
-          break;
-
-        case msrSemiTonesPitchKind::kSTP_D_TripleFlat:
-          break;
-        case msrSemiTonesPitchKind::kSTP_D_DoubleFlat:
-          break;
-        case msrSemiTonesPitchKind::kSTP_D_Flat:
-          break;
-        case msrSemiTonesPitchKind::kSTP_D_Natural:
-          break;
-        case msrSemiTonesPitchKind::kSTP_D_Sharp:
-          break;
-        case msrSemiTonesPitchKind::kSTP_D_DoubleSharp:
-          break;
-        case msrSemiTonesPitchKind::kSTP_D_TripleSharp:
-          break;
-
-        case msrSemiTonesPitchKind::kSTP_E_TripleFlat:
-          break;
-        case msrSemiTonesPitchKind::kSTP_E_DoubleFlat:
-          break;
-        case msrSemiTonesPitchKind::kSTP_E_Flat:
-          break;
-        case msrSemiTonesPitchKind::kSTP_E_Natural:
-          break;
-        case msrSemiTonesPitchKind::kSTP_E_Sharp:
-          break;
-        case msrSemiTonesPitchKind::kSTP_E_DoubleSharp:
-          break;
-        case msrSemiTonesPitchKind::kSTP_E_TripleSharp:
-          break;
-
-        case msrSemiTonesPitchKind::kSTP_F_TripleFlat:
-          break;
-        case msrSemiTonesPitchKind::kSTP_F_DoubleleFlat:
-          break;
-        case msrSemiTonesPitchKind::kSTP_F_Flat:
-          break;
-        case msrSemiTonesPitchKind::kSTP_F_Natural:
-          break;
-        case msrSemiTonesPitchKind::kSTP_F_Sharp:
-          break;
-        case msrSemiTonesPitchKind::kSTP_F_DoubleSharp:
-          break;
-        case msrSemiTonesPitchKind::kSTP_F_TripleSharp:
-          break;
-
-        case msrSemiTonesPitchKind::kSTP_G_TripleFlat:
-          break;
-        case msrSemiTonesPitchKind::kSTP_G_DoubleFlat:
-          break;
-        case msrSemiTonesPitchKind::kSTP_G_Flat:
-          break;
-        case msrSemiTonesPitchKind::kSTP_G_Natural:
-          break;
-        case msrSemiTonesPitchKind::kSTP_G_Sharp:
-          break;
-        case msrSemiTonesPitchKind::kSTP_G_DoubleSharp:
-          break;
-        case msrSemiTonesPitchKind::kSTP_G_TripleSharp:
-          break;
-
-        case msrSemiTonesPitchKind::kSTP_A_TripleFlat:
-          break;
-        case msrSemiTonesPitchKind::kSTP_A_DoubleFlat:
-          break;
-        case msrSemiTonesPitchKind::kSTP_A_Flat:
-          break;
-        case msrSemiTonesPitchKind::kSTP_A_Natural:
-          break;
-        case msrSemiTonesPitchKind::kSTP_A_Sharp:
-          break;
-        case msrSemiTonesPitchKind::kSTP_A_DoubleSharp:
-          break;
-        case msrSemiTonesPitchKind::kSTP_A_TripleSharp:
-          break;
-
-        case msrSemiTonesPitchKind::kSTP_B_TripleFlat:
-          break;
-        case msrSemiTonesPitchKind::kSTP_B_DoubleFlat:
-          break;
-        case msrSemiTonesPitchKind::kSTP_B_Flat:
-          break;
-        case msrSemiTonesPitchKind::kSTP_B_Natural:
-          break;
-        case msrSemiTonesPitchKind::kSTP_B_Sharp:
-          break;
-        case msrSemiTonesPitchKind::kSTP_B_DoubleSharp:
-          result = msrIntervalKind::kIntervalAugmentedUnisson;
-          break;
-        case msrSemiTonesPitchKind::kSTP_B_TripleSharp:
-          result = msrIntervalKind::kIntervalPerfectUnisson;
-          break;
-      } // switch
-      break;
-  } // switch
+  int
+    row =
+      semiTonesPitchAtIntervalsRow (workSemiTonesPitch1);
+
+  if (row >= 0) {
+    // look for workSemiTonesPitch2 within the octave above workSemiTonesPitch1
+    for (
+      size_t i = 0;
+      i < size_t (msrIntervalKind::kIntervalAugmentedOctave);
+      ++i
+    ) {
+      if (kSemiTonesPitchesAtIntervalsTable [row] [i] == workSemiTonesPitch2) {
+        result = msrIntervalKind (i + 1);
+        break;
+      }
+    } // for
+  }
 
   if (invertInterval) {
     result = invertIntervalKind (result);
@@ -200,7 +200,7 @@ void msrHumdrumScotKeyItem::acceptIn (basevisitor* v)
 
   if (visitor<S_msrHumdrumScotKeyItem>*
     p =
-      dynamic_cast<visitor<S_msrHumdrumScotKeyItem>*> (v)) {
+      visitor<S_msrHumdrumScotKeyItem>::cast (v)) {
         S_msrHumdrumScotKeyItem elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -236,7 +236,7 @@ void msrHumdrumScotKeyItem::acceptOut (basevisitor* v)
 
   if (visitor<S_msrHumdrumScotKeyItem>*
     p =
-      dynamic_cast<visitor<S_msrHumdrumScotKeyItem>*> (v)) {
+      visitor<S_msrHumdrumScotKeyItem>::cast (v)) {
         S_msrHumdrumScotKeyItem elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -747,7 +747,7 @@ void msrKey::acceptIn (basevisitor* v)
 
   if (visitor<S_msrKey>*
     p =
-      dynamic_cast<visitor<S_msrKey>*> (v)) {
+      visitor<S_msrKey>::cast (v)) {
         S_msrKey elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -783,7 +783,7 @@ void msrKey::acceptOut (basevisitor* v)
 
   if (visitor<S_msrKey>*
     p =
-      dynamic_cast<visitor<S_msrKey>*> (v)) {
+      visitor<S_msrKey>::cast (v)) {
         S_msrKey elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -107,7 +107,7 @@ void msrLigature::acceptIn (basevisitor* v)
 
   if (visitor<S_msrLigature>*
     p =
-      dynamic_cast<visitor<S_msrLigature>*> (v)) {
+      visitor<S_msrLigature>::cast (v)) {
         S_msrLigature elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -143,7 +143,7 @@ void msrLigature::acceptOut (basevisitor* v)
 
   if (visitor<S_msrLigature>*
     p =
-      dynamic_cast<visitor<S_msrLigature>*> (v)) {
+      visitor<S_msrLigature>::cast (v)) {
         S_msrLigature elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
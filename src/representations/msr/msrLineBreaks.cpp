@@ -177,7 +177,7 @@ void msrLineBreak::acceptIn (basevisitor* v)
 
   if (visitor<S_msrLineBreak>*
     p =
-      dynamic_cast<visitor<S_msrLineBreak>*> (v)) {
+      visitor<S_msrLineBreak>::cast (v)) {
         S_msrLineBreak elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -213,7 +213,7 @@ void msrLineBreak::acceptOut (basevisitor* v)
 
   if (visitor<S_msrLineBreak>*
     p =
-      dynamic_cast<visitor<S_msrLineBreak>*> (v)) {
+      visitor<S_msrLineBreak>::cast (v)) {
         S_msrLineBreak elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
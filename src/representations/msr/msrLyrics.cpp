@@ -779,7 +779,7 @@ void msrSyllable::acceptIn (basevisitor* v)
 
   if (visitor<S_msrSyllable>*
     p =
-      dynamic_cast<visitor<S_msrSyllable>*> (v)) {
+      visitor<S_msrSyllable>::cast (v)) {
         S_msrSyllable elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -815,7 +815,7 @@ void msrSyllable::acceptOut (basevisitor* v)
 
   if (visitor<S_msrSyllable>*
     p =
-      dynamic_cast<visitor<S_msrSyllable>*> (v)) {
+      visitor<S_msrSyllable>::cast (v)) {
         S_msrSyllable elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -1844,7 +1844,7 @@ void msrStanza::acceptIn (basevisitor* v)
 
   if (visitor<S_msrStanza>*
     p =
-      dynamic_cast<visitor<S_msrStanza>*> (v)) {
+      visitor<S_msrStanza>::cast (v)) {
         S_msrStanza elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -1880,7 +1880,7 @@ void msrStanza::acceptOut (basevisitor* v)
 
   if (visitor<S_msrStanza>*
     p =
-      dynamic_cast<visitor<S_msrStanza>*> (v)) {
+      visitor<S_msrStanza>::cast (v)) {
         S_msrStanza elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
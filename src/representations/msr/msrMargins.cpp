@@ -323,7 +323,7 @@ void msrMarginsGroup::acceptIn (basevisitor* v) {
 
   if (visitor<S_msrMarginsGroup>*
     p =
-      dynamic_cast<visitor<S_msrMarginsGroup>*> (v)) {
+      visitor<S_msrMarginsGroup>::cast (v)) {
         S_msrMarginsGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -353,7 +353,7 @@ void msrMarginsGroup::acceptOut (basevisitor* v) {
 
   if (visitor<S_msrMarginsGroup>*
     p =
-      dynamic_cast<visitor<S_msrMarginsGroup>*> (v)) {
+      visitor<S_msrMarginsGroup>::cast (v)) {
         S_msrMarginsGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -442,7 +442,7 @@ void msrMeasureElement::acceptIn (basevisitor* v)
 
   if (visitor<S_msrMeasureElement>*
     p =
-      dynamic_cast<visitor<S_msrMeasureElement>*> (v)) {
+      visitor<S_msrMeasureElement>::cast (v)) {
         S_msrMeasureElement elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -478,7 +478,7 @@ void msrMeasureElement::acceptOut (basevisitor* v)
 
   if (visitor<S_msrMeasureElement>*
     p =
-      dynamic_cast<visitor<S_msrMeasureElement>*> (v)) {
+      visitor<S_msrMeasureElement>::cast (v)) {
         S_msrMeasureElement elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -261,7 +261,7 @@ void msrMeasureRepeatElement::acceptIn (basevisitor* v)
 
   if (visitor<S_msrMeasureRepeatElement>*
     p =
-      dynamic_cast<visitor<S_msrMeasureRepeatElement>*> (v)) {
+      visitor<S_msrMeasureRepeatElement>::cast (v)) {
         S_msrMeasureRepeatElement elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -297,7 +297,7 @@ void msrMeasureRepeatElement::acceptOut (basevisitor* v)
 
   if (visitor<S_msrMeasureRepeatElement>*
     p =
-      dynamic_cast<visitor<S_msrMeasureRepeatElement>*> (v)) {
+      visitor<S_msrMeasureRepeatElement>::cast (v)) {
         S_msrMeasureRepeatElement elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -573,7 +573,7 @@ void msrMeasureRepeatPattern::acceptIn (basevisitor* v)
 
   if (visitor<S_msrMeasureRepeatPattern>*
     p =
-      dynamic_cast<visitor<S_msrMeasureRepeatPattern>*> (v)) {
+      visitor<S_msrMeasureRepeatPattern>::cast (v)) {
         S_msrMeasureRepeatPattern elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -609,7 +609,7 @@ void msrMeasureRepeatPattern::acceptOut (basevisitor* v)
 
   if (visitor<S_msrMeasureRepeatPattern>*
     p =
-      dynamic_cast<visitor<S_msrMeasureRepeatPattern>*> (v)) {
+      visitor<S_msrMeasureRepeatPattern>::cast (v)) {
         S_msrMeasureRepeatPattern elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -812,7 +812,7 @@ void msrMeasureRepeatReplicas::acceptIn (basevisitor* v)
 
   if (visitor<S_msrMeasureRepeatReplicas>*
     p =
-      dynamic_cast<visitor<S_msrMeasureRepeatReplicas>*> (v)) {
+      visitor<S_msrMeasureRepeatReplicas>::cast (v)) {
         S_msrMeasureRepeatReplicas elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -848,7 +848,7 @@ void msrMeasureRepeatReplicas::acceptOut (basevisitor* v)
 
   if (visitor<S_msrMeasureRepeatReplicas>*
     p =
-      dynamic_cast<visitor<S_msrMeasureRepeatReplicas>*> (v)) {
+      visitor<S_msrMeasureRepeatReplicas>::cast (v)) {
         S_msrMeasureRepeatReplicas elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -1167,7 +1167,7 @@ void msrMeasureRepeat::acceptIn (basevisitor* v)
 
   if (visitor<S_msrMeasureRepeat>*
     p =
-      dynamic_cast<visitor<S_msrMeasureRepeat>*> (v)) {
+      visitor<S_msrMeasureRepeat>::cast (v)) {
         S_msrMeasureRepeat elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -1203,7 +1203,7 @@ void msrMeasureRepeat::acceptOut (basevisitor* v)
 
   if (visitor<S_msrMeasureRepeat>*
     p =
-      dynamic_cast<visitor<S_msrMeasureRepeat>*> (v)) {
+      visitor<S_msrMeasureRepeat>::cast (v)) {
         S_msrMeasureRepeat elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -7761,7 +7761,7 @@ void msrMeasure::acceptIn (basevisitor* v)
 
   if (visitor<S_msrMeasure>*
     p =
-      dynamic_cast<visitor<S_msrMeasure>*> (v)) {
+      visitor<S_msrMeasure>::cast (v)) {
         S_msrMeasure elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -7797,7 +7797,7 @@ void msrMeasure::acceptOut (basevisitor* v)
 
   if (visitor<S_msrMeasure>*
     p =
-      dynamic_cast<visitor<S_msrMeasure>*> (v)) {
+      visitor<S_msrMeasure>::cast (v)) {
         S_msrMeasure elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
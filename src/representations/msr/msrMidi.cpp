@@ -91,7 +91,7 @@ void msrMidiTempo::acceptIn (basevisitor* v)
 
   if (visitor<S_msrMidiTempo>*
     p =
-      dynamic_cast<visitor<S_msrMidiTempo>*> (v)) {
+      visitor<S_msrMidiTempo>::cast (v)) {
         S_msrMidiTempo elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -127,7 +127,7 @@ void msrMidiTempo::acceptOut (basevisitor* v)
 
   if (visitor<S_msrMidiTempo>*
     p =
-      dynamic_cast<visitor<S_msrMidiTempo>*> (v)) {
+      visitor<S_msrMidiTempo>::cast (v)) {
         S_msrMidiTempo elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -261,7 +261,7 @@ void msrMultipleMeasureRest::acceptIn (basevisitor* v)
 
   if (visitor<S_msrMultipleMeasureRest>*
     p =
-      dynamic_cast<visitor<S_msrMultipleMeasureRest>*> (v)) {
+      visitor<S_msrMultipleMeasureRest>::cast (v)) {
         S_msrMultipleMeasureRest elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -297,7 +297,7 @@ void msrMultipleMeasureRest::acceptOut (basevisitor* v)
 
   if (visitor<S_msrMultipleMeasureRest>*
     p =
-      dynamic_cast<visitor<S_msrMultipleMeasureRest>*> (v)) {
+      visitor<S_msrMultipleMeasureRest>::cast (v)) {
         S_msrMultipleMeasureRest elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
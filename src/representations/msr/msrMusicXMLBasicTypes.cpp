@@ -502,7 +502,7 @@ void msrPageLayout::acceptIn (basevisitor* v)
 
   if (visitor<S_msrPageLayout>*
     p =
-      dynamic_cast<visitor<S_msrPageLayout>*> (v)) {
+      visitor<S_msrPageLayout>::cast (v)) {
         S_msrPageLayout elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -538,7 +538,7 @@ void msrPageLayout::acceptOut (basevisitor* v)
 
   if (visitor<S_msrPageLayout>*
     p =
-      dynamic_cast<visitor<S_msrPageLayout>*> (v)) {
+      visitor<S_msrPageLayout>::cast (v)) {
         S_msrPageLayout elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -707,7 +707,7 @@ void msrSystemLayout::acceptIn (basevisitor* v)
 
   if (visitor<S_msrSystemLayout>*
     p =
-      dynamic_cast<visitor<S_msrSystemLayout>*> (v)) {
+      visitor<S_msrSystemLayout>::cast (v)) {
         S_msrSystemLayout elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -743,7 +743,7 @@ void msrSystemLayout::acceptOut (basevisitor* v)
 
   if (visitor<S_msrSystemLayout>*
     p =
-      dynamic_cast<visitor<S_msrSystemLayout>*> (v)) {
+      visitor<S_msrSystemLayout>::cast (v)) {
         S_msrSystemLayout elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -897,7 +897,7 @@ void msrSystemDividers::acceptIn (basevisitor* v)
 
   if (visitor<S_msrSystemDividers>*
     p =
-      dynamic_cast<visitor<S_msrSystemDividers>*> (v)) {
+      visitor<S_msrSystemDividers>::cast (v)) {
         S_msrSystemDividers elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -933,7 +933,7 @@ void msrSystemDividers::acceptOut (basevisitor* v)
 
   if (visitor<S_msrSystemDividers>*
     p =
-      dynamic_cast<visitor<S_msrSystemDividers>*> (v)) {
+      visitor<S_msrSystemDividers>::cast (v)) {
         S_msrSystemDividers elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -1041,7 +1041,7 @@ void msrStaffLayout::acceptIn (basevisitor* v)
 
   if (visitor<S_msrStaffLayout>*
     p =
-      dynamic_cast<visitor<S_msrStaffLayout>*> (v)) {
+      visitor<S_msrStaffLayout>::cast (v)) {
         S_msrStaffLayout elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -1077,7 +1077,7 @@ void msrStaffLayout::acceptOut (basevisitor* v)
 
   if (visitor<S_msrStaffLayout>*
     p =
-      dynamic_cast<visitor<S_msrStaffLayout>*> (v)) {
+      visitor<S_msrStaffLayout>::cast (v)) {
         S_msrStaffLayout elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -1188,7 +1188,7 @@ void msrMeasureLayout::acceptIn (basevisitor* v)
 
   if (visitor<S_msrMeasureLayout>*
     p =
-      dynamic_cast<visitor<S_msrMeasureLayout>*> (v)) {
+      visitor<S_msrMeasureLayout>::cast (v)) {
         S_msrMeasureLayout elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -1224,7 +1224,7 @@ void msrMeasureLayout::acceptOut (basevisitor* v)
 
   if (visitor<S_msrMeasureLayout>*
     p =
-      dynamic_cast<visitor<S_msrMeasureLayout>*> (v)) {
+      visitor<S_msrMeasureLayout>::cast (v)) {
         S_msrMeasureLayout elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -1348,7 +1348,7 @@ void msrLineWidth::acceptIn (basevisitor* v)
 
   if (visitor<S_msrLineWidth>*
     p =
-      dynamic_cast<visitor<S_msrLineWidth>*> (v)) {
+      visitor<S_msrLineWidth>::cast (v)) {
         S_msrLineWidth elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -1384,7 +1384,7 @@ void msrLineWidth::acceptOut (basevisitor* v)
 
   if (visitor<S_msrLineWidth>*
     p =
-      dynamic_cast<visitor<S_msrLineWidth>*> (v)) {
+      visitor<S_msrLineWidth>::cast (v)) {
         S_msrLineWidth elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -1528,7 +1528,7 @@ void msrNoteSize::acceptIn (basevisitor* v)
 
   if (visitor<S_msrNoteSize>*
     p =
-      dynamic_cast<visitor<S_msrNoteSize>*> (v)) {
+      visitor<S_msrNoteSize>::cast (v)) {
         S_msrNoteSize elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -1564,7 +1564,7 @@ void msrNoteSize::acceptOut (basevisitor* v)
 
   if (visitor<S_msrNoteSize>*
     p =
-      dynamic_cast<visitor<S_msrNoteSize>*> (v)) {
+      visitor<S_msrNoteSize>::cast (v)) {
         S_msrNoteSize elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -1695,7 +1695,7 @@ void msrDistance::acceptIn (basevisitor* v)
 
   if (visitor<S_msrDistance>*
     p =
-      dynamic_cast<visitor<S_msrDistance>*> (v)) {
+      visitor<S_msrDistance>::cast (v)) {
         S_msrDistance elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -1731,7 +1731,7 @@ void msrDistance::acceptOut (basevisitor* v)
 
   if (visitor<S_msrDistance>*
     p =
-      dynamic_cast<visitor<S_msrDistance>*> (v)) {
+      visitor<S_msrDistance>::cast (v)) {
         S_msrDistance elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -1862,7 +1862,7 @@ void msrGlyph::acceptIn (basevisitor* v)
 
   if (visitor<S_msrGlyph>*
     p =
-      dynamic_cast<visitor<S_msrGlyph>*> (v)) {
+      visitor<S_msrGlyph>::cast (v)) {
         S_msrGlyph elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -1898,7 +1898,7 @@ void msrGlyph::acceptOut (basevisitor* v)
 
   if (visitor<S_msrGlyph>*
     p =
-      dynamic_cast<visitor<S_msrGlyph>*> (v)) {
+      visitor<S_msrGlyph>::cast (v)) {
         S_msrGlyph elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -2029,7 +2029,7 @@ void msrOtherAppearance::acceptIn (basevisitor* v)
 
   if (visitor<S_msrOtherAppearance>*
     p =
-      dynamic_cast<visitor<S_msrOtherAppearance>*> (v)) {
+      visitor<S_msrOtherAppearance>::cast (v)) {
         S_msrOtherAppearance elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -2065,7 +2065,7 @@ void msrOtherAppearance::acceptOut (basevisitor* v)
 
   if (visitor<S_msrOtherAppearance>*
     p =
-      dynamic_cast<visitor<S_msrOtherAppearance>*> (v)) {
+      visitor<S_msrOtherAppearance>::cast (v)) {
         S_msrOtherAppearance elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -2187,7 +2187,7 @@ void msrAppearance::acceptIn (basevisitor* v)
 
   if (visitor<S_msrAppearance>*
     p =
-      dynamic_cast<visitor<S_msrAppearance>*> (v)) {
+      visitor<S_msrAppearance>::cast (v)) {
         S_msrAppearance elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -2223,7 +2223,7 @@ void msrAppearance::acceptOut (basevisitor* v)
 
   if (visitor<S_msrAppearance>*
     p =
-      dynamic_cast<visitor<S_msrAppearance>*> (v)) {
+      visitor<S_msrAppearance>::cast (v)) {
         S_msrAppearance elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
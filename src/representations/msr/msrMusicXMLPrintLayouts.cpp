@@ -100,7 +100,7 @@ void msrMusicXMLPrintLayout::acceptIn (basevisitor* v)
 
   if (visitor<S_msrMusicXMLPrintLayout>*
     p =
-      dynamic_cast<visitor<S_msrMusicXMLPrintLayout>*> (v)) {
+      visitor<S_msrMusicXMLPrintLayout>::cast (v)) {
         S_msrMusicXMLPrintLayout elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -136,7 +136,7 @@ void msrMusicXMLPrintLayout::acceptOut (basevisitor* v)
 
   if (visitor<S_msrMusicXMLPrintLayout>*
     p =
-      dynamic_cast<visitor<S_msrMusicXMLPrintLayout>*> (v)) {
+      visitor<S_msrMusicXMLPrintLayout>::cast (v)) {
         S_msrMusicXMLPrintLayout elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -371,6 +371,18 @@ void msrNote::initializeNote ()
 msrNote::~msrNote ()
 {}
 
+// the attached elements that most notes don't have
+const msrNoteAttachments msrNote::sEmptyNoteAttachments;
+
+msrNoteAttachments& msrNote::noteAttachmentsToModify ()
+{
+  if (! fNoteAttachments) {
+    fNoteAttachments = std::make_unique <msrNoteAttachments> ();
+  }
+
+  return *fNoteAttachments;
+}
+
 // uplink to tuplet
 void msrNote::setNoteShortcutUpLinkToTuplet (
 	const S_msrTuplet& tuplet)
@@ -980,13 +992,13 @@ S_msrNote msrNote::createNoteDeepClone (
 
   for (
     std::list <S_msrSpanner>::const_iterator i =
-      fNoteSpannersList.begin ();
-      i != fNoteSpannersList.end ();
+      getNoteSpannersList ().begin ();
+      i != getNoteSpannersList ().end ();
       ++i
   ) {
     // share this data
     deepClone->
-      fNoteSpannersList.push_back ((*i));
+      noteAttachmentsToModify ().fNoteSpannersList.push_back ((*i));
   } // for
 
   // technicals
@@ -995,39 +1007,39 @@ S_msrNote msrNote::createNoteDeepClone (
   {
     std::list <S_msrTechnical>::const_iterator i;
     for (
-      i = fNoteTechnicalsList.begin ();
-      i != fNoteTechnicalsList.end ();
+      i = getNoteTechnicalsList ().begin ();
+      i != getNoteTechnicalsList ().end ();
       ++i
   ) {
       // share this data
       deepClone->
-        fNoteTechnicalsList.push_back ((*i));
+        noteAttachmentsToModify ().fNoteTechnicalsList.push_back ((*i));
     } // for
   }
 
   {
     std::list <S_msrTechnicalWithInteger>::const_iterator i;
     for (
-      i = fNoteTechnicalWithIntegersList.begin ();
-      i != fNoteTechnicalWithIntegersList.end ();
+      i = getNoteTechnicalWithIntegersList ().begin ();
+      i != getNoteTechnicalWithIntegersList ().end ();
       ++i
   ) {
       // share this data
       deepClone->
-        fNoteTechnicalWithIntegersList.push_back ((*i));
+        noteAttachmentsToModify ().fNoteTechnicalWithIntegersList.push_back ((*i));
     } // for
   }
 
   {
     std::list <S_msrTechnicalWithString>::const_iterator i;
     for (
-      i = fNoteTechnicalWithStringsList.begin ();
-      i != fNoteTechnicalWithStringsList.end ();
+      i = getNoteTechnicalWithStringsList ().begin ();
+      i != getNoteTechnicalWithStringsList ().end ();
       ++i
   ) {
       // share this data
       deepClone->
-        fNoteTechnicalWithStringsList.push_back ((*i));
+        noteAttachmentsToModify ().fNoteTechnicalWithStringsList.push_back ((*i));
     } // for
   }
 
@@ -1036,10 +1048,10 @@ S_msrNote msrNote::createNoteDeepClone (
 
   {
     std::list <S_msrOrnament>::const_iterator i;
-    for (i = fNoteOrnamentsList.begin (); i != fNoteOrnamentsList.end (); ++i) {
+    for (i = getNoteOrnamentsList ().begin (); i != getNoteOrnamentsList ().end (); ++i) {
       // share this data
       deepClone->
-        fNoteOrnamentsList.push_back ((*i));
+        noteAttachmentsToModify ().fNoteOrnamentsList.push_back ((*i));
     } // for
   }
 
@@ -1048,10 +1060,10 @@ S_msrNote msrNote::createNoteDeepClone (
 
   {
     std::list <S_msrGlissando>::const_iterator i;
-    for (i = fNoteGlissandosList.begin (); i != fNoteGlissandosList.end (); ++i) {
+    for (i = getNoteGlissandosList ().begin (); i != getNoteGlissandosList ().end (); ++i) {
       // share this data
       deepClone->
-        fNoteGlissandosList.push_back ((*i));
+        noteAttachmentsToModify ().fNoteGlissandosList.push_back ((*i));
     } // for
   }
 
@@ -1060,10 +1072,10 @@ S_msrNote msrNote::createNoteDeepClone (
 
   {
     std::list <S_msrSlide>::const_iterator i;
-    for (i = fNoteSlidesList.begin (); i != fNoteSlidesList.end (); ++i) {
+    for (i = getNoteSlidesList ().begin (); i != getNoteSlidesList ().end (); ++i) {
       // share this data
       deepClone->
-        fNoteSlidesList.push_back ((*i));
+        noteAttachmentsToModify ().fNoteSlidesList.push_back ((*i));
     } // for
   }
 
@@ -1101,19 +1113,19 @@ S_msrNote msrNote::createNoteDeepClone (
 
   {
     std::list <S_msrDynamic>::const_iterator i;
-    for (i = fNoteDynamicsList.begin (); i != fNoteDynamicsList.end (); ++i) {
+    for (i = getNoteDynamicsList ().begin (); i != getNoteDynamicsList ().end (); ++i) {
       // share this data
       deepClone->
-        fNoteDynamicsList.push_back ((*i));
+        noteAttachmentsToModify ().fNoteDynamicsList.push_back ((*i));
     } // for
   }
 
   {
     std::list <S_msrOtherDynamic>::const_iterator i;
-    for (i = fNoteOtherDynamicsList.begin (); i != fNoteOtherDynamicsList.end (); ++i) {
+    for (i = getNoteOtherDynamicsList ().begin (); i != getNoteOtherDynamicsList ().end (); ++i) {
       // share this data
       deepClone->
-        fNoteOtherDynamicsList.push_back ((*i));
+        noteAttachmentsToModify ().fNoteOtherDynamicsList.push_back ((*i));
     } // for
   }
 
@@ -1122,10 +1134,10 @@ S_msrNote msrNote::createNoteDeepClone (
 
   {
     std::list <S_msrSlash>::const_iterator i;
-    for (i = fNoteSlashesList.begin (); i != fNoteSlashesList.end (); ++i) {
+    for (i = getNoteSlashesList ().begin (); i != getNoteSlashesList ().end (); ++i) {
       // share this data
       deepClone->
-        fNoteSlashesList.push_back ((*i));
+        noteAttachmentsToModify ().fNoteSlashesList.push_back ((*i));
     } // for
   }
 
@@ -1133,10 +1145,10 @@ S_msrNote msrNote::createNoteDeepClone (
   // ------------------------------------------------------
 
   {
-    for (S_msrCrescDecresc crescDecresc : fNoteCrescDecrescsList) {
+    for (S_msrCrescDecresc crescDecresc : getNoteCrescDecrescsList ()) {
       // share this data
       deepClone->
-        fNoteCrescDecrescsList.push_back (crescDecresc);
+        noteAttachmentsToModify ().fNoteCrescDecrescsList.push_back (crescDecresc);
     } // for
   }
 
@@ -1145,10 +1157,10 @@ S_msrNote msrNote::createNoteDeepClone (
 
   {
     std::list <S_msrWedge>::const_iterator i;
-    for (i = fNoteWedgesList.begin (); i != fNoteWedgesList.end (); ++i) {
+    for (i = getNoteWedgesList ().begin (); i != getNoteWedgesList ().end (); ++i) {
       // share this data
       deepClone->
-        fNoteWedgesList.push_back ((*i));
+        noteAttachmentsToModify ().fNoteWedgesList.push_back ((*i));
     } // for
   }
 
@@ -1157,10 +1169,10 @@ S_msrNote msrNote::createNoteDeepClone (
 
   {
     std::list <S_msrEyeGlasses>::const_iterator i;
-    for (i = fNoteEyeGlassesList.begin (); i != fNoteEyeGlassesList.end (); ++i) {
+    for (i = getNoteEyeGlassesList ().begin (); i != getNoteEyeGlassesList ().end (); ++i) {
       // share this data
       deepClone->
-        fNoteEyeGlassesList.push_back ((*i));
+        noteAttachmentsToModify ().fNoteEyeGlassesList.push_back ((*i));
     } // for
   }
 
@@ -1169,10 +1181,10 @@ S_msrNote msrNote::createNoteDeepClone (
 
   {
     std::list <S_msrDamp>::const_iterator i;
-    for (i = fNoteDampsList.begin (); i != fNoteDampsList.end (); ++i) {
+    for (i = getNoteDampsList ().begin (); i != getNoteDampsList ().end (); ++i) {
       // share this data
       deepClone->
-        fNoteDampsList.push_back ((*i));
+        noteAttachmentsToModify ().fNoteDampsList.push_back ((*i));
     } // for
   }
 
@@ -1181,10 +1193,10 @@ S_msrNote msrNote::createNoteDeepClone (
 
   {
     std::list <S_msrDampAll>::const_iterator i;
-    for (i = fNoteDampAllsList.begin (); i != fNoteDampAllsList.end (); ++i) {
+    for (i = getNoteDampAllsList ().begin (); i != getNoteDampAllsList ().end (); ++i) {
       // share this data
       deepClone->
-        fNoteDampAllsList.push_back ((*i));
+        noteAttachmentsToModify ().fNoteDampAllsList.push_back ((*i));
     } // for
   }
 
@@ -1193,10 +1205,10 @@ S_msrNote msrNote::createNoteDeepClone (
 
   {
     std::list <S_msrScordatura>::const_iterator i;
-    for (i = fNoteScordaturasList.begin (); i != fNoteScordaturasList.end (); ++i) {
+    for (i = getNoteScordaturasList ().begin (); i != getNoteScordaturasList ().end (); ++i) {
       // share this data
       deepClone->
-        fNoteScordaturasList.push_back ((*i));
+        noteAttachmentsToModify ().fNoteScordaturasList.push_back ((*i));
     } // for
   }
 
@@ -1205,10 +1217,10 @@ S_msrNote msrNote::createNoteDeepClone (
 
   {
     std::list <S_msrWords>::const_iterator i;
-    for (i = fNoteWordsList.begin (); i != fNoteWordsList.end (); ++i) {
+    for (i = getNoteWordsList ().begin (); i != getNoteWordsList ().end (); ++i) {
       // share this data
       deepClone->
-        fNoteWordsList.push_back ((*i));
+        noteAttachmentsToModify ().fNoteWordsList.push_back ((*i));
     } // for
   }
 
@@ -1228,10 +1240,10 @@ S_msrNote msrNote::createNoteDeepClone (
 
   {
     std::list <S_msrLigature>::const_iterator i;
-    for (i = fNoteLigaturesList.begin (); i != fNoteLigaturesList.end (); ++i) {
+    for (i = getNoteLigaturesList ().begin (); i != getNoteLigaturesList ().end (); ++i) {
       // share this data
       deepClone->
-        fNoteLigaturesList.push_back ((*i));
+        noteAttachmentsToModify ().fNoteLigaturesList.push_back ((*i));
     } // for
   }
 
@@ -1240,24 +1252,28 @@ S_msrNote msrNote::createNoteDeepClone (
 
   {
     std::list <S_msrPedal>::const_iterator i;
-    for (i = fNotePedalsList.begin (); i != fNotePedalsList.end (); ++i) {
+    for (i = getNotePedalsList ().begin (); i != getNotePedalsList ().end (); ++i) {
       // share this data
       deepClone->
-        fNotePedalsList.push_back ((*i));
+        noteAttachmentsToModify ().fNotePedalsList.push_back ((*i));
     } // for
   }
 
   // harmonies
   // ------------------------------------------------------
 
-  deepClone->fNoteHarmoniesList = // JMI ???
-    fNoteHarmoniesList;
+  if (! getNoteHarmoniesList ().empty ()) {
+    deepClone->noteAttachmentsToModify ().fNoteHarmoniesList = // JMI ???
+      getNoteHarmoniesList ();
+  }
 
   // figured bass elements
   // ------------------------------------------------------
 
-  deepClone->fNoteFiguredBassesList = // JMI ???
-    fNoteFiguredBassesList;
+  if (! getNoteFiguredBassesList ().empty ()) {
+    deepClone->noteAttachmentsToModify ().fNoteFiguredBassesList = // JMI ???
+      getNoteFiguredBassesList ();
+  }
 
   // note measure information
   // ------------------------------------------------------
@@ -2379,8 +2395,8 @@ void msrNote::setNoteAttachedElementsPositionInMeasure (
     std::stringstream ss;
 
     ss <<
-      "setNoteAttachedElementsPositionInMeasure(), fNoteHarmoniesList.size (): " <<
-      fNoteHarmoniesList.size ();
+      "setNoteAttachedElementsPositionInMeasure(), getNoteHarmoniesList ().size (): " <<
+      getNoteHarmoniesList ().size ();
 
     gWaeHandler->waeTrace (
       __FILE__, mfInputLineNumber (__LINE__),
@@ -2407,7 +2423,7 @@ void msrNote::setNoteAttachedElementsPositionInMeasure (
 
     ss <<
       "fNoteFiguredBassesList.size (): " <<
-      fNoteFiguredBassesList.size ();
+      getNoteFiguredBassesList ().size ();
 
     gWaeHandler->waeTrace (
       __FILE__, mfInputLineNumber (__LINE__),
@@ -2689,7 +2705,7 @@ void msrNote::appendSpannerToNote (
   } // switch
 
   // append spanner to note spanners
-  fNoteSpannersList.push_back (spanner);
+  noteAttachmentsToModify ().fNoteSpannersList.push_back (spanner);
 }
 
 void msrNote::appendTechnicalToNote (
@@ -2713,7 +2729,7 @@ void msrNote::appendTechnicalToNote (
 #endif // MF_TRACE_IS_ENABLED
 
   // append the technical to the note technicals list
-  fNoteTechnicalsList.push_back (technical);
+  noteAttachmentsToModify ().fNoteTechnicalsList.push_back (technical);
 }
 
 void msrNote::appendTechnicalWithIntegerToNote (
@@ -2737,7 +2753,7 @@ void msrNote::appendTechnicalWithIntegerToNote (
 #endif // MF_TRACE_IS_ENABLED
 
   // append the technical with integer to the note technicals with integers list
-  fNoteTechnicalWithIntegersList.push_back (
+  noteAttachmentsToModify ().fNoteTechnicalWithIntegersList.push_back (
     technicalWithInteger);
 }
 
@@ -2762,7 +2778,7 @@ void msrNote::appendTechnicalWithFloatToNote (
 #endif // MF_TRACE_IS_ENABLED
 
   // append the technical with float to the note technicals with floats list
-  fNoteTechnicalWithFloatsList.push_back (
+  noteAttachmentsToModify ().fNoteTechnicalWithFloatsList.push_back (
     technicalWithFloat);
 }
 
@@ -2787,7 +2803,7 @@ void msrNote::appendTechnicalWithStringToNote (
 #endif // MF_TRACE_IS_ENABLED
 
   // append the technical with string to the note technicals with strings list
-  fNoteTechnicalWithStringsList.push_back (
+  noteAttachmentsToModify ().fNoteTechnicalWithStringsList.push_back (
     technicalWithString);
 }
 
@@ -2811,7 +2827,7 @@ void msrNote::appendOrnamentToNote (
 #endif // MF_TRACE_IS_ENABLED
 
   // append the ornament to the note ornaments list
-  fNoteOrnamentsList.push_back (ornament);
+  noteAttachmentsToModify ().fNoteOrnamentsList.push_back (ornament);
 
   switch (ornament->getOrnamentKind ()) {
     case msrOrnamentKind::kOrnamentTrill:
@@ -2861,7 +2877,7 @@ void msrNote::appendGlissandoToNote (
 #endif // MF_TRACE_IS_ENABLED
 
   // append the glissando to the note glissandos list
-  fNoteGlissandosList.push_back (glissando);
+  noteAttachmentsToModify ().fNoteGlissandosList.push_back (glissando);
 }
 
 void msrNote::appendSlideToNote (
@@ -2884,7 +2900,7 @@ void msrNote::appendSlideToNote (
 #endif // MF_TRACE_IS_ENABLED
 
   // append the slide to the note glissandos list
-  fNoteSlidesList.push_back (slide);
+  noteAttachmentsToModify ().fNoteSlidesList.push_back (slide);
 }
 
 void msrNote::appendTieToNote (
@@ -3035,18 +3051,18 @@ void msrNote::appendDynamicToNote (
   }
 #endif // MF_TRACE_IS_ENABLED
 
-  fNoteDynamicsList.push_back (dynamic);
+  noteAttachmentsToModify ().fNoteDynamicsList.push_back (dynamic);
 }
 void msrNote::appendOtherDynamicToNote (
   const S_msrOtherDynamic& otherDynamic)
 {
-  fNoteOtherDynamicsList.push_back (otherDynamic);
+  noteAttachmentsToModify ().fNoteOtherDynamicsList.push_back (otherDynamic);
 }
 
 void msrNote::appendWordsToNote (
   const S_msrWords& words)
 {
-  fNoteWordsList.push_back (words);
+  noteAttachmentsToModify ().fNoteWordsList.push_back (words);
 }
 
 void msrNote::appendSlurToNote (
@@ -3090,13 +3106,13 @@ void msrNote::appendLigatureToNote (
   }
 #endif // MF_TRACE_IS_ENABLED
 
-  if (fNoteLigaturesList.size ()) {
+  if (getNoteLigaturesList ().size ()) {
     if (
-      fNoteLigaturesList.back ()->getLigatureKind () == msrLigatureKind::kLigatureStart
+      getNoteLigaturesList ().back ()->getLigatureKind () == msrLigatureKind::kLigatureStart
         &&
       ligature->getLigatureKind () == msrLigatureKind::kLigatureStop
         &&
-      fNoteLigaturesList.back ()->getLigatureNumber () == ligature->getLigatureNumber ()
+      getNoteLigaturesList ().back ()->getLigatureNumber () == ligature->getLigatureNumber ()
       ) {
       // it may happen that a given note has a 'ligature start'
       // and a 'ligature stop' in sequence, ignore both
@@ -3133,17 +3149,17 @@ void msrNote::appendLigatureToNote (
       }
 #endif // MF_TRACE_IS_ENABLED
 
-      fNoteLigaturesList.pop_back ();
+      noteAttachmentsToModify ().fNoteLigaturesList.pop_back ();
 
       // don't register 'ligature stop'
     }
 
     else
-      fNoteLigaturesList.push_back (ligature);
+      noteAttachmentsToModify ().fNoteLigaturesList.push_back (ligature);
   }
 
   else
-    fNoteLigaturesList.push_back (ligature);
+    noteAttachmentsToModify ().fNoteLigaturesList.push_back (ligature);
 }
 
 void msrNote::appendPedalToNote (
@@ -3215,7 +3231,7 @@ void msrNote::appendPedalToNote (
 //   else
 //     fNotePedalsList.push_back (pedal);
 
-	fNotePedalsList.push_back (pedal);
+	noteAttachmentsToModify ().fNotePedalsList.push_back (pedal);
 }
 
 void msrNote::appendSlashToNote (
@@ -3237,25 +3253,25 @@ void msrNote::appendSlashToNote (
   }
 #endif // MF_TRACE_IS_ENABLED
 
-  fNoteSlashesList.push_back (slash);
+  noteAttachmentsToModify ().fNoteSlashesList.push_back (slash);
 }
 
 void msrNote::appendCrescDecrescToNote (
   const S_msrCrescDecresc& crescDecresc)
 {
-  fNoteCrescDecrescsList.push_back (crescDecresc);
+  noteAttachmentsToModify ().fNoteCrescDecrescsList.push_back (crescDecresc);
 }
 
 void msrNote::appendWedgeToNote (
   const S_msrWedge& wedge)
 {
-  fNoteWedgesList.push_back (wedge);
+  noteAttachmentsToModify ().fNoteWedgesList.push_back (wedge);
 }
 
 void msrNote::appendSegnoToNote (
   const S_msrSegno& segno)
 {
-  fNoteSegnosList.push_back (segno);
+  noteAttachmentsToModify ().fNoteSegnosList.push_back (segno);
 }
 
 void msrNote::appendDalSegnoToNote (
@@ -3277,37 +3293,37 @@ void msrNote::appendDalSegnoToNote (
   }
 #endif // MF_TRACE_IS_ENABLED
 
-  fNoteDalSegnosList.push_back (dalSegno);
+  noteAttachmentsToModify ().fNoteDalSegnosList.push_back (dalSegno);
 }
 
 void msrNote::appendCodaToNote (
   const S_msrCoda& coda)
 {
-  fNoteCodasList.push_back (coda);
+  noteAttachmentsToModify ().fNoteCodasList.push_back (coda);
 }
 
 void msrNote::appendEyeGlassesToNote (
   const S_msrEyeGlasses& eyeGlasses)
 {
-  fNoteEyeGlassesList.push_back (eyeGlasses);
+  noteAttachmentsToModify ().fNoteEyeGlassesList.push_back (eyeGlasses);
 }
 
 void msrNote::appendDampToNote (
   const S_msrDamp&  damp)
 {
-  fNoteDampsList.push_back (damp);
+  noteAttachmentsToModify ().fNoteDampsList.push_back (damp);
 }
 
 void msrNote::appendDampAllToNote (
   const S_msrDampAll& dampAll)
 {
-  fNoteDampAllsList.push_back (dampAll);
+  noteAttachmentsToModify ().fNoteDampAllsList.push_back (dampAll);
 }
 
 void msrNote::appendScordaturaToNote (
   const S_msrScordatura& scordatura)
 {
-  fNoteScordaturasList.push_back (scordatura);
+  noteAttachmentsToModify ().fNoteScordaturasList.push_back (scordatura);
 }
 
 // this 'override' NOT NEEXDED??? JMI 0.9.66
@@ -3568,7 +3584,7 @@ void msrNote::appendHarmonyToNote (
 //       fMeasureElementSoundingWholeNotes,
 //       "appendHarmonyToNote()");
 
-  fNoteHarmoniesList.push_back (harmony);
+  noteAttachmentsToModify ().fNoteHarmoniesList.push_back (harmony);
 
 //   // register this note as the harmony upLink // JMI 0.9.66 JMI 0.9.66 JMI 0.9.66 MERDUM
 //   harmony->
@@ -3628,7 +3644,7 @@ void msrNote::acceptIn (basevisitor* v)
 
   if (visitor<S_msrNote>*
     p =
-      dynamic_cast<visitor<S_msrNote>*> (v)) {
+      visitor<S_msrNote>::cast (v)) {
         S_msrNote elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -3664,7 +3680,7 @@ void msrNote::acceptOut (basevisitor* v)
 
   if (visitor<S_msrNote>*
     p =
-      dynamic_cast<visitor<S_msrNote>*> (v)) {
+      visitor<S_msrNote>::cast (v)) {
         S_msrNote elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -3769,10 +3785,10 @@ void msrNote::browseData (basevisitor* v)
   }
 
   // browse the spanners if any
-  if (fNoteSpannersList.size ()) {
+  if (getNoteSpannersList ().size ()) {
     ++gIndenter;
     std::list <S_msrSpanner>::const_iterator i;
-    for (i = fNoteSpannersList.begin (); i != fNoteSpannersList.end (); ++i) {
+    for (i = getNoteSpannersList ().begin (); i != getNoteSpannersList ().end (); ++i) {
       // browse the spanner
       msrBrowser<msrSpanner> browser (v);
       browser.browse (*(*i));
@@ -3781,12 +3797,12 @@ void msrNote::browseData (basevisitor* v)
   }
 
   // browse the technicals if any
-  if (fNoteTechnicalsList.size ()) {
+  if (getNoteTechnicalsList ().size ()) {
     ++gIndenter;
     std::list <S_msrTechnical>::const_iterator i;
     for (
-      i = fNoteTechnicalsList.begin ();
-      i != fNoteTechnicalsList.end ();
+      i = getNoteTechnicalsList ().begin ();
+      i != getNoteTechnicalsList ().end ();
       ++i
   ) {
       // browse the technical
@@ -3797,12 +3813,12 @@ void msrNote::browseData (basevisitor* v)
   }
 
   // browse the technicals with integer if any
-  if (fNoteTechnicalWithIntegersList.size ()) {
+  if (getNoteTechnicalWithIntegersList ().size ()) {
     ++gIndenter;
     std::list <S_msrTechnicalWithInteger>::const_iterator i;
     for (
-      i = fNoteTechnicalWithIntegersList.begin ();
-      i != fNoteTechnicalWithIntegersList.end ();
+      i = getNoteTechnicalWithIntegersList ().begin ();
+      i != getNoteTechnicalWithIntegersList ().end ();
       ++i
   ) {
       // browse the technical
@@ -3813,12 +3829,12 @@ void msrNote::browseData (basevisitor* v)
   }
 
   // browse the technicals with float if any
-  if (fNoteTechnicalWithFloatsList.size ()) {
+  if (getNoteTechnicalWithFloatsList ().size ()) {
     ++gIndenter;
     std::list <S_msrTechnicalWithFloat>::const_iterator i;
     for (
-      i = fNoteTechnicalWithFloatsList.begin ();
-      i != fNoteTechnicalWithFloatsList.end ();
+      i = getNoteTechnicalWithFloatsList ().begin ();
+      i != getNoteTechnicalWithFloatsList ().end ();
       ++i
   ) {
       // browse the technical
@@ -3829,12 +3845,12 @@ void msrNote::browseData (basevisitor* v)
   }
 
   // browse the technicals with string if any
-  if (fNoteTechnicalWithStringsList.size ()) {
+  if (getNoteTechnicalWithStringsList ().size ()) {
     ++gIndenter;
     std::list <S_msrTechnicalWithString>::const_iterator i;
     for (
-      i = fNoteTechnicalWithStringsList.begin ();
-      i != fNoteTechnicalWithStringsList.end ();
+      i = getNoteTechnicalWithStringsList ().begin ();
+      i != getNoteTechnicalWithStringsList ().end ();
       ++i
   ) {
       // browse the technical
@@ -3845,10 +3861,10 @@ void msrNote::browseData (basevisitor* v)
   }
 
   // browse the ornaments if any
-  if (fNoteOrnamentsList.size ()) {
+  if (getNoteOrnamentsList ().size ()) {
     ++gIndenter;
     std::list <S_msrOrnament>::const_iterator i;
-    for (i = fNoteOrnamentsList.begin (); i != fNoteOrnamentsList.end (); ++i) {
+    for (i = getNoteOrnamentsList ().begin (); i != getNoteOrnamentsList ().end (); ++i) {
       // browse the ornament
       msrBrowser<msrOrnament> browser (v);
       browser.browse (*(*i));
@@ -3857,10 +3873,10 @@ void msrNote::browseData (basevisitor* v)
   }
 
   // browse the glissandos if any
-  if (fNoteGlissandosList.size ()) {
+  if (getNoteGlissandosList ().size ()) {
     ++gIndenter;
     std::list <S_msrGlissando>::const_iterator i;
-    for (i = fNoteGlissandosList.begin (); i != fNoteGlissandosList.end (); ++i) {
+    for (i = getNoteGlissandosList ().begin (); i != getNoteGlissandosList ().end (); ++i) {
       // browse the glissando
       msrBrowser<msrGlissando> browser (v);
       browser.browse (*(*i));
@@ -3869,10 +3885,10 @@ void msrNote::browseData (basevisitor* v)
   }
 
   // browse the slides if any
-  if (fNoteSlidesList.size ()) {
+  if (getNoteSlidesList ().size ()) {
     ++gIndenter;
     std::list <S_msrSlide>::const_iterator i;
-    for (i = fNoteSlidesList.begin (); i != fNoteSlidesList.end (); ++i) {
+    for (i = getNoteSlidesList ().begin (); i != getNoteSlidesList ().end (); ++i) {
       // browse the glissando
       msrBrowser<msrSlide> browser (v);
       browser.browse (*(*i));
@@ -3899,10 +3915,10 @@ void msrNote::browseData (basevisitor* v)
   }
 
   // browse the dynamics if any
-  if (fNoteDynamicsList.size ()) {
+  if (getNoteDynamicsList ().size ()) {
     ++gIndenter;
     std::list <S_msrDynamic>::const_iterator i;
-    for (i = fNoteDynamicsList.begin (); i != fNoteDynamicsList.end (); ++i) {
+    for (i = getNoteDynamicsList ().begin (); i != getNoteDynamicsList ().end (); ++i) {
       // browse the dynamics
       msrBrowser<msrDynamic> browser (v);
       browser.browse (*(*i));
@@ -3911,10 +3927,10 @@ void msrNote::browseData (basevisitor* v)
   }
 
   // browse the other dynamics if any
-  if (fNoteOtherDynamicsList.size ()) {
+  if (getNoteOtherDynamicsList ().size ()) {
     ++gIndenter;
     std::list <S_msrOtherDynamic>::const_iterator i;
-    for (i = fNoteOtherDynamicsList.begin (); i != fNoteOtherDynamicsList.end (); ++i) {
+    for (i = getNoteOtherDynamicsList ().begin (); i != getNoteOtherDynamicsList ().end (); ++i) {
       // browse the other dynamics
       msrBrowser<msrOtherDynamic> browser (v);
       browser.browse (*(*i));
@@ -3923,10 +3939,10 @@ void msrNote::browseData (basevisitor* v)
   }
 
   // browse the words if any
-  if (fNoteWordsList.size ()) {
+  if (getNoteWordsList ().size ()) {
     ++gIndenter;
     std::list <S_msrWords>::const_iterator i;
-    for (i = fNoteWordsList.begin (); i != fNoteWordsList.end (); ++i) {
+    for (i = getNoteWordsList ().begin (); i != getNoteWordsList ().end (); ++i) {
       // browse the words
       msrBrowser<msrWords> browser (v);
       browser.browse (*(*i));
@@ -3946,10 +3962,10 @@ void msrNote::browseData (basevisitor* v)
   }
 
   // browse the ligatures if any
-  if (fNoteLigaturesList.size ()) {
+  if (getNoteLigaturesList ().size ()) {
     ++gIndenter;
     std::list <S_msrLigature>::const_iterator i;
-    for (i = fNoteLigaturesList.begin (); i != fNoteLigaturesList.end (); ++i) {
+    for (i = getNoteLigaturesList ().begin (); i != getNoteLigaturesList ().end (); ++i) {
       // browse the ligature
       msrBrowser<msrLigature> browser (v);
       browser.browse (*(*i));
@@ -3958,10 +3974,10 @@ void msrNote::browseData (basevisitor* v)
   }
 
   // browse the pedals if any
-  if (fNotePedalsList.size ()) {
+  if (getNotePedalsList ().size ()) {
     ++gIndenter;
     std::list <S_msrPedal>::const_iterator i;
-    for (i = fNotePedalsList.begin (); i != fNotePedalsList.end (); ++i) {
+    for (i = getNotePedalsList ().begin (); i != getNotePedalsList ().end (); ++i) {
       // browse the pedal
       msrBrowser<msrPedal> browser (v);
       browser.browse (*(*i));
@@ -3970,9 +3986,9 @@ void msrNote::browseData (basevisitor* v)
   }
 
   // browse the crescDecresc if any
-  if (fNoteCrescDecrescsList.size ()) {
+  if (getNoteCrescDecrescsList ().size ()) {
     ++gIndenter;
-    for (S_msrCrescDecresc crescDecresc : fNoteCrescDecrescsList) {
+    for (S_msrCrescDecresc crescDecresc : getNoteCrescDecrescsList ()) {
       // browse the crescDecresc
       msrBrowser<msrCrescDecresc> browser (v);
       browser.browse (*crescDecresc);
@@ -3981,9 +3997,9 @@ void msrNote::browseData (basevisitor* v)
   }
 
   // browse the wedges if any
-  if (fNoteWedgesList.size ()) {
+  if (getNoteWedgesList ().size ()) {
     ++gIndenter;
-    for (S_msrWedge wedge : fNoteWedgesList) {
+    for (S_msrWedge wedge : getNoteWedgesList ()) {
       // browse the crescDecresc
       msrBrowser<msrWedge> browser (v);
       browser.browse (*wedge);
@@ -3992,9 +4008,9 @@ void msrNote::browseData (basevisitor* v)
   }
 
   // browse the slashes if any
-  if (fNoteSlashesList.size ()) {
+  if (getNoteSlashesList ().size ()) {
     ++gIndenter;
-    for (S_msrSlash slash : fNoteSlashesList) {
+    for (S_msrSlash slash : getNoteSlashesList ()) {
       // browse the slash
       msrBrowser<msrSlash> browser (v);
       browser.browse (*slash);
@@ -4003,10 +4019,10 @@ void msrNote::browseData (basevisitor* v)
   }
 
   // browse the segnos if any
-  if (fNoteSegnosList.size ()) {
+  if (getNoteSegnosList ().size ()) {
     ++gIndenter;
     std::list <S_msrSegno>::const_iterator i;
-    for (i = fNoteSegnosList.begin (); i != fNoteSegnosList.end (); ++i) {
+    for (i = getNoteSegnosList ().begin (); i != getNoteSegnosList ().end (); ++i) {
       // browse the segno
       msrBrowser<msrSegno> browser (v);
       browser.browse (*(*i));
@@ -4015,10 +4031,10 @@ void msrNote::browseData (basevisitor* v)
   }
 
   // browse the dal segnos if any
-  if (fNoteDalSegnosList.size ()) {
+  if (getNoteDalSegnosList ().size ()) {
     ++gIndenter;
     std::list <S_msrDalSegno>::const_iterator i;
-    for (i = fNoteDalSegnosList.begin (); i != fNoteDalSegnosList.end (); ++i) {
+    for (i = getNoteDalSegnosList ().begin (); i != getNoteDalSegnosList ().end (); ++i) {
       // browse the dal segno
       msrBrowser<msrDalSegno> browser (v);
       browser.browse (*(*i));
@@ -4027,10 +4043,10 @@ void msrNote::browseData (basevisitor* v)
   }
 
   // browse the codas if any
-  if (fNoteCodasList.size ()) {
+  if (getNoteCodasList ().size ()) {
     ++gIndenter;
     std::list <S_msrCoda>::const_iterator i;
-    for (i = fNoteCodasList.begin (); i != fNoteCodasList.end (); ++i) {
+    for (i = getNoteCodasList ().begin (); i != getNoteCodasList ().end (); ++i) {
       // browse the coda
       msrBrowser<msrCoda> browser (v);
       browser.browse (*(*i));
@@ -4039,10 +4055,10 @@ void msrNote::browseData (basevisitor* v)
   }
 
   // browse the eyeglasses if any
-  if (fNoteEyeGlassesList.size ()) {
+  if (getNoteEyeGlassesList ().size ()) {
     ++gIndenter;
     std::list <S_msrEyeGlasses>::const_iterator i;
-    for (i = fNoteEyeGlassesList.begin (); i != fNoteEyeGlassesList.end (); ++i) {
+    for (i = getNoteEyeGlassesList ().begin (); i != getNoteEyeGlassesList ().end (); ++i) {
       // browse the eyeglasses
       msrBrowser<msrEyeGlasses> browser (v);
       browser.browse (*(*i));
@@ -4051,10 +4067,10 @@ void msrNote::browseData (basevisitor* v)
   }
 
   // browse the damps if any
-  if (fNoteDampsList.size ()) {
+  if (getNoteDampsList ().size ()) {
     ++gIndenter;
     std::list <S_msrDamp>::const_iterator i;
-    for (i = fNoteDampsList.begin (); i != fNoteDampsList.end (); ++i) {
+    for (i = getNoteDampsList ().begin (); i != getNoteDampsList ().end (); ++i) {
       // browse the damp
       msrBrowser<msrDamp> browser (v);
       browser.browse (*(*i));
@@ -4063,10 +4079,10 @@ void msrNote::browseData (basevisitor* v)
   }
 
   // browse the damp alls if any
-  if (fNoteDampAllsList.size ()) {
+  if (getNoteDampAllsList ().size ()) {
     ++gIndenter;
     std::list <S_msrDampAll>::const_iterator i;
-    for (i = fNoteDampAllsList.begin (); i != fNoteDampAllsList.end (); ++i) {
+    for (i = getNoteDampAllsList ().begin (); i != getNoteDampAllsList ().end (); ++i) {
       // browse the damp all
       msrBrowser<msrDampAll> browser (v);
       browser.browse (*(*i));
@@ -4075,10 +4091,10 @@ void msrNote::browseData (basevisitor* v)
   }
 
   // browse the scordaturas if any
-  if (fNoteScordaturasList.size ()) {
+  if (getNoteScordaturasList ().size ()) {
     ++gIndenter;
     std::list <S_msrScordatura>::const_iterator i;
-    for (i = fNoteScordaturasList.begin (); i != fNoteScordaturasList.end (); ++i) {
+    for (i = getNoteScordaturasList ().begin (); i != getNoteScordaturasList ().end (); ++i) {
       // browse the scordatura
       msrBrowser<msrScordatura> browser (v);
       browser.browse (*(*i));
@@ -4087,9 +4103,9 @@ void msrNote::browseData (basevisitor* v)
   }
 
   // browse the harmonies if any
-  if (fNoteHarmoniesList.size ()) {
+  if (getNoteHarmoniesList ().size ()) {
     ++gIndenter;
-    for (S_msrHarmony harmony : fNoteHarmoniesList) {
+    for (S_msrHarmony harmony : getNoteHarmoniesList ()) {
       // browse the harmony
       msrBrowser<msrHarmony> browser (v);
       browser.browse (*harmony);
@@ -4098,9 +4114,9 @@ void msrNote::browseData (basevisitor* v)
   }
 
   // browse the figured basses if any
-  if (fNoteFiguredBassesList.size ()) {
+  if (getNoteFiguredBassesList ().size ()) {
     ++gIndenter;
-    for (S_msrFiguredBass figuredBass : fNoteFiguredBassesList) {
+    for (S_msrFiguredBass figuredBass : getNoteFiguredBassesList ()) {
       // browse the figured bass
       msrBrowser<msrFiguredBass> browser (v);
       browser.browse (*figuredBass);
@@ -5273,7 +5289,7 @@ void msrNote::print (std::ostream& os) const
   }
 
   // print the spanners if any
-  if (fNoteSpannersList.size ()) {
+  if (getNoteSpannersList ().size ()) {
 		os << std::left <<
 			std::setw (fieldWidth) <<
 			"fNoteSpannersList" << ": " <<
@@ -5282,8 +5298,8 @@ void msrNote::print (std::ostream& os) const
 		++gIndenter;
 
 		std::list <S_msrSpanner>::const_iterator
-			iBegin = fNoteSpannersList.begin (),
-			iEnd   = fNoteSpannersList.end (),
+			iBegin = getNoteSpannersList ().begin (),
+			iEnd   = getNoteSpannersList ().end (),
 			i      = iBegin;
 		for ( ; ; ) {
 			(*i)->print (os);
@@ -5295,7 +5311,7 @@ void msrNote::print (std::ostream& os) const
   }
 
   // print the technicals if any
-  if (fNoteTechnicalsList.size ()) {
+  if (getNoteTechnicalsList ().size ()) {
     os << std::left <<
       std::setw (fieldWidth) <<
       "fNoteTechnicalsList" << ": " <<
@@ -5304,8 +5320,8 @@ void msrNote::print (std::ostream& os) const
     ++gIndenter;
 
     std::list <S_msrTechnical>::const_iterator
-      iBegin = fNoteTechnicalsList.begin (),
-      iEnd   = fNoteTechnicalsList.end (),
+      iBegin = getNoteTechnicalsList ().begin (),
+      iEnd   = getNoteTechnicalsList ().end (),
       i      = iBegin;
     for ( ; ; ) {
       (*i)->print (os);
@@ -5317,7 +5333,7 @@ void msrNote::print (std::ostream& os) const
   }
 
   // print the technicals with integer if any
-  if (fNoteTechnicalWithIntegersList.size ()) {
+  if (getNoteTechnicalWithIntegersList ().size ()) {
     os << std::left <<
       std::setw (fieldWidth) <<
       "fNoteTechnicalWithIntegersList" << ": " <<
@@ -5326,8 +5342,8 @@ void msrNote::print (std::ostream& os) const
     ++gIndenter;
 
     std::list <S_msrTechnicalWithInteger>::const_iterator
-      iBegin = fNoteTechnicalWithIntegersList.begin (),
-      iEnd   = fNoteTechnicalWithIntegersList.end (),
+      iBegin = getNoteTechnicalWithIntegersList ().begin (),
+      iEnd   = getNoteTechnicalWithIntegersList ().end (),
       i      = iBegin;
     for ( ; ; ) {
       (*i)->print (os);
@@ -5339,7 +5355,7 @@ void msrNote::print (std::ostream& os) const
   }
 
   // print the technicals with float if any
-  if (fNoteTechnicalWithFloatsList.size ()) {
+  if (getNoteTechnicalWithFloatsList ().size ()) {
     os << std::left <<
       std::setw (fieldWidth) <<
       "fNoteTechnicalWithFloatsList" << ": " <<
@@ -5348,8 +5364,8 @@ void msrNote::print (std::ostream& os) const
     ++gIndenter;
 
     std::list <S_msrTechnicalWithFloat>::const_iterator
-      iBegin = fNoteTechnicalWithFloatsList.begin (),
-      iEnd   = fNoteTechnicalWithFloatsList.end (),
+      iBegin = getNoteTechnicalWithFloatsList ().begin (),
+      iEnd   = getNoteTechnicalWithFloatsList ().end (),
       i      = iBegin;
     for ( ; ; ) {
       (*i)->print (os);
@@ -5361,7 +5377,7 @@ void msrNote::print (std::ostream& os) const
   }
 
   // print the technicals with string if any
-  if (fNoteTechnicalWithStringsList.size ()) {
+  if (getNoteTechnicalWithStringsList ().size ()) {
     os << std::left <<
       std::setw (fieldWidth) <<
       "fNoteTechnicalWithStringsList" << ": " <<
@@ -5370,8 +5386,8 @@ void msrNote::print (std::ostream& os) const
     ++gIndenter;
 
     std::list <S_msrTechnicalWithString>::const_iterator
-      iBegin = fNoteTechnicalWithStringsList.begin (),
-      iEnd   = fNoteTechnicalWithStringsList.end (),
+      iBegin = getNoteTechnicalWithStringsList ().begin (),
+      iEnd   = getNoteTechnicalWithStringsList ().end (),
       i      = iBegin;
     for ( ; ; ) {
       (*i)->print (os);
@@ -5383,7 +5399,7 @@ void msrNote::print (std::ostream& os) const
   }
 
   // print the ornaments if any
-  if (fNoteOrnamentsList.size ()) {
+  if (getNoteOrnamentsList ().size ()) {
     os << std::left <<
       std::setw (fieldWidth) <<
       "fNoteOrnamentsList:" << ": " <<
@@ -5392,8 +5408,8 @@ void msrNote::print (std::ostream& os) const
     ++gIndenter;
 
     std::list <S_msrOrnament>::const_iterator
-      iBegin = fNoteOrnamentsList.begin (),
-      iEnd   = fNoteOrnamentsList.end (),
+      iBegin = getNoteOrnamentsList ().begin (),
+      iEnd   = getNoteOrnamentsList ().end (),
       i      = iBegin;
     for ( ; ; ) {
       (*i)->print (os);
@@ -5405,7 +5421,7 @@ void msrNote::print (std::ostream& os) const
   }
 
   // print the glissandos if any
-  if (fNoteGlissandosList.size ()) {
+  if (getNoteGlissandosList ().size ()) {
     os << std::left <<
       std::setw (fieldWidth) <<
       "fNoteGlissandosList" << ": " <<
@@ -5414,8 +5430,8 @@ void msrNote::print (std::ostream& os) const
     ++gIndenter;
 
     std::list <S_msrGlissando>::const_iterator
-      iBegin = fNoteGlissandosList.begin (),
-      iEnd   = fNoteGlissandosList.end (),
+      iBegin = getNoteGlissandosList ().begin (),
+      iEnd   = getNoteGlissandosList ().end (),
       i      = iBegin;
     for ( ; ; ) {
       (*i)->print (os);
@@ -5427,7 +5443,7 @@ void msrNote::print (std::ostream& os) const
   }
 
   // print the slides if any
-  if (fNoteSlidesList.size ()) {
+  if (getNoteSlidesList ().size ()) {
     os << std::left <<
       std::setw (fieldWidth) <<
       "fNoteSlidesList" << ": " <<
@@ -5436,8 +5452,8 @@ void msrNote::print (std::ostream& os) const
     ++gIndenter;
 
     std::list <S_msrSlide>::const_iterator
-      iBegin = fNoteSlidesList.begin (),
-      iEnd   = fNoteSlidesList.end (),
+      iBegin = getNoteSlidesList ().begin (),
+      iEnd   = getNoteSlidesList ().end (),
       i      = iBegin;
     for ( ; ; ) {
       (*i)->print (os);
@@ -5463,7 +5479,7 @@ void msrNote::print (std::ostream& os) const
   }
 
   // print the dynamics if any
-  if (fNoteDynamicsList.size ()) {
+  if (getNoteDynamicsList ().size ()) {
     os << std::left <<
       std::setw (fieldWidth) <<
       "fNoteDynamicsList" << ": " <<
@@ -5472,8 +5488,8 @@ void msrNote::print (std::ostream& os) const
     ++gIndenter;
 
     std::list <S_msrDynamic>::const_iterator
-      iBegin = fNoteDynamicsList.begin (),
-      iEnd   = fNoteDynamicsList.end (),
+      iBegin = getNoteDynamicsList ().begin (),
+      iEnd   = getNoteDynamicsList ().end (),
       i      = iBegin;
     for ( ; ; ) {
       (*i)->print (os);
@@ -5485,7 +5501,7 @@ void msrNote::print (std::ostream& os) const
   }
 
   // print the other dynamics if any
-  if (fNoteOtherDynamicsList.size ()) {
+  if (getNoteOtherDynamicsList ().size ()) {
     os << std::left <<
       std::setw (fieldWidth) <<
       "fNoteOtherDynamicsList" << ": " <<
@@ -5494,8 +5510,8 @@ void msrNote::print (std::ostream& os) const
     ++gIndenter;
 
     std::list <S_msrOtherDynamic>::const_iterator
-      iBegin = fNoteOtherDynamicsList.begin (),
-      iEnd   = fNoteOtherDynamicsList.end (),
+      iBegin = getNoteOtherDynamicsList ().begin (),
+      iEnd   = getNoteOtherDynamicsList ().end (),
       i      = iBegin;
     for ( ; ; ) {
       (*i)->print (os);
@@ -5507,7 +5523,7 @@ void msrNote::print (std::ostream& os) const
   }
 
   // print the words if any
-  if (fNoteWordsList.size ()) {
+  if (getNoteWordsList ().size ()) {
     os << std::left <<
       std::setw (fieldWidth) <<
       "fNoteWordsList" << ": " <<
@@ -5516,8 +5532,8 @@ void msrNote::print (std::ostream& os) const
     ++gIndenter;
 
     std::list <S_msrWords>::const_iterator
-      iBegin = fNoteWordsList.begin (),
-      iEnd   = fNoteWordsList.end (),
+      iBegin = getNoteWordsList ().begin (),
+      iEnd   = getNoteWordsList ().end (),
       i      = iBegin;
     for ( ; ; ) {
       (*i)->print (os);
@@ -5545,7 +5561,7 @@ void msrNote::print (std::ostream& os) const
   }
 
   // print the ligatures if any
-  if (fNoteLigaturesList.size ()) {
+  if (getNoteLigaturesList ().size ()) {
     os << std::left <<
       std::setw (fieldWidth) <<
       "fNoteLigaturesList" << ": " <<
@@ -5554,8 +5570,8 @@ void msrNote::print (std::ostream& os) const
     ++gIndenter;
 
     std::list <S_msrLigature>::const_iterator
-      iBegin = fNoteLigaturesList.begin (),
-      iEnd   = fNoteLigaturesList.end (),
+      iBegin = getNoteLigaturesList ().begin (),
+      iEnd   = getNoteLigaturesList ().end (),
       i      = iBegin;
     for ( ; ; ) {
       (*i)->print (os);
@@ -5567,7 +5583,7 @@ void msrNote::print (std::ostream& os) const
   }
 
   // print the pedals if any
-  if (fNotePedalsList.size ()) {
+  if (getNotePedalsList ().size ()) {
     os << std::left <<
       std::setw (fieldWidth) <<
       "fNotePedalsList" << ": " <<
@@ -5576,8 +5592,8 @@ void msrNote::print (std::ostream& os) const
     ++gIndenter;
 
     std::list <S_msrPedal>::const_iterator
-      iBegin = fNotePedalsList.begin (),
-      iEnd   = fNotePedalsList.end (),
+      iBegin = getNotePedalsList ().begin (),
+      iEnd   = getNotePedalsList ().end (),
       i      = iBegin;
     for ( ; ; ) {
       (*i)->print (os);
@@ -5589,7 +5605,7 @@ void msrNote::print (std::ostream& os) const
   }
 
   // print the slashes if any
-  if (fNoteSlashesList.size ()) {
+  if (getNoteSlashesList ().size ()) {
     os << std::left <<
       std::setw (fieldWidth) <<
       "fNoteSlashesList" << ": " <<
@@ -5598,8 +5614,8 @@ void msrNote::print (std::ostream& os) const
     ++gIndenter;
 
     std::list <S_msrSlash>::const_iterator
-      iBegin = fNoteSlashesList.begin (),
-      iEnd   = fNoteSlashesList.end (),
+      iBegin = getNoteSlashesList ().begin (),
+      iEnd   = getNoteSlashesList ().end (),
       i      = iBegin;
     for ( ; ; ) {
       (*i)->print (os);
@@ -5611,7 +5627,7 @@ void msrNote::print (std::ostream& os) const
   }
 
   // print the crescDecresc if any
-  if (fNoteCrescDecrescsList.size ()) {
+  if (getNoteCrescDecrescsList ().size ()) {
     os << std::left <<
       std::setw (fieldWidth) <<
       "fNoteCrescDecrescsList" << ": " <<
@@ -5620,8 +5636,8 @@ void msrNote::print (std::ostream& os) const
     ++gIndenter;
 
     std::list <S_msrCrescDecresc>::const_iterator
-      iBegin = fNoteCrescDecrescsList.begin (),
-      iEnd   = fNoteCrescDecrescsList.end (),
+      iBegin = getNoteCrescDecrescsList ().begin (),
+      iEnd   = getNoteCrescDecrescsList ().end (),
       i      = iBegin;
     for ( ; ; ) {
       (*i)->print (os);
@@ -5633,7 +5649,7 @@ void msrNote::print (std::ostream& os) const
   }
 
   // print the wedges if any
-  if (fNoteWedgesList.size ()) {
+  if (getNoteWedgesList ().size ()) {
     os << std::left <<
       std::setw (fieldWidth) <<
       "fNoteWedgesList" << ": " <<
@@ -5642,8 +5658,8 @@ void msrNote::print (std::ostream& os) const
     ++gIndenter;
 
     std::list <S_msrWedge>::const_iterator
-      iBegin = fNoteWedgesList.begin (),
-      iEnd   = fNoteWedgesList.end (),
+      iBegin = getNoteWedgesList ().begin (),
+      iEnd   = getNoteWedgesList ().end (),
       i      = iBegin;
     for ( ; ; ) {
       (*i)->print (os);
@@ -5655,7 +5671,7 @@ void msrNote::print (std::ostream& os) const
   }
 
   // print the segnos if any
-  if (fNoteSegnosList.size ()) {
+  if (getNoteSegnosList ().size ()) {
     os << std::left <<
       std::setw (fieldWidth) <<
       "fNoteSegnosList" << ": " <<
@@ -5664,8 +5680,8 @@ void msrNote::print (std::ostream& os) const
     ++gIndenter;
 
     std::list <S_msrSegno>::const_iterator
-      iBegin = fNoteSegnosList.begin (),
-      iEnd   = fNoteSegnosList.end (),
+      iBegin = getNoteSegnosList ().begin (),
+      iEnd   = getNoteSegnosList ().end (),
       i      = iBegin;
     for ( ; ; ) {
       (*i)->print (os);
@@ -5677,7 +5693,7 @@ void msrNote::print (std::ostream& os) const
   }
 
   // print the dal segnos if any
-  if (fNoteDalSegnosList.size ()) {
+  if (getNoteDalSegnosList ().size ()) {
     os << std::left <<
       std::setw (fieldWidth) <<
       "fNoteDalSegnosList" << ": " <<
@@ -5686,8 +5702,8 @@ void msrNote::print (std::ostream& os) const
     ++gIndenter;
 
     std::list <S_msrDalSegno>::const_iterator
-      iBegin = fNoteDalSegnosList.begin (),
-      iEnd   = fNoteDalSegnosList.end (),
+      iBegin = getNoteDalSegnosList ().begin (),
+      iEnd   = getNoteDalSegnosList ().end (),
       i      = iBegin;
     for ( ; ; ) {
       (*i)->print (os);
@@ -5699,7 +5715,7 @@ void msrNote::print (std::ostream& os) const
   }
 
   // print the codas if any
-  if (fNoteCodasList.size ()) {
+  if (getNoteCodasList ().size ()) {
     os << std::left <<
       std::setw (fieldWidth) <<
       "fNoteCodasList" << ": " <<
@@ -5708,8 +5724,8 @@ void msrNote::print (std::ostream& os) const
     ++gIndenter;
 
     std::list <S_msrCoda>::const_iterator
-      iBegin = fNoteCodasList.begin (),
-      iEnd   = fNoteCodasList.end (),
+      iBegin = getNoteCodasList ().begin (),
+      iEnd   = getNoteCodasList ().end (),
       i      = iBegin;
     for ( ; ; ) {
       (*i)->print (os);
@@ -5721,7 +5737,7 @@ void msrNote::print (std::ostream& os) const
   }
 
   // print the eyeglasses if any
-  if (fNoteEyeGlassesList.size ()) {
+  if (getNoteEyeGlassesList ().size ()) {
     os << std::left <<
       std::setw (fieldWidth) <<
       "fNoteEyeGlassesList" << ": " <<
@@ -5730,8 +5746,8 @@ void msrNote::print (std::ostream& os) const
     ++gIndenter;
 
     std::list <S_msrEyeGlasses>::const_iterator
-      iBegin = fNoteEyeGlassesList.begin (),
-      iEnd   = fNoteEyeGlassesList.end (),
+      iBegin = getNoteEyeGlassesList ().begin (),
+      iEnd   = getNoteEyeGlassesList ().end (),
       i      = iBegin;
     for ( ; ; ) {
       (*i)->print (os);
@@ -5743,7 +5759,7 @@ void msrNote::print (std::ostream& os) const
   }
 
   // print the damps if any
-  if (fNoteDampsList.size ()) {
+  if (getNoteDampsList ().size ()) {
     os << std::left <<
       std::setw (fieldWidth) <<
       "fNoteDampsList" << ": " <<
@@ -5752,8 +5768,8 @@ void msrNote::print (std::ostream& os) const
     ++gIndenter;
 
     std::list <S_msrDamp>::const_iterator
-      iBegin = fNoteDampsList.begin (),
-      iEnd   = fNoteDampsList.end (),
+      iBegin = getNoteDampsList ().begin (),
+      iEnd   = getNoteDampsList ().end (),
       i      = iBegin;
     for ( ; ; ) {
       (*i)->print (os);
@@ -5765,7 +5781,7 @@ void msrNote::print (std::ostream& os) const
   }
 
   // print the dampAlls if any
-  if (fNoteDampAllsList.size ()) {
+  if (getNoteDampAllsList ().size ()) {
     os << std::left <<
       std::setw (fieldWidth) <<
       "fNoteDampAllsList" << ": " <<
@@ -5774,8 +5790,8 @@ void msrNote::print (std::ostream& os) const
     ++gIndenter;
 
     std::list <S_msrDampAll>::const_iterator
-      iBegin = fNoteDampAllsList.begin (),
-      iEnd   = fNoteDampAllsList.end (),
+      iBegin = getNoteDampAllsList ().begin (),
+      iEnd   = getNoteDampAllsList ().end (),
       i      = iBegin;
     for ( ; ; ) {
       (*i)->print (os);
@@ -5787,7 +5803,7 @@ void msrNote::print (std::ostream& os) const
   }
 
   // print the scordaturas if any
-  if (fNoteScordaturasList.size ()) {
+  if (getNoteScordaturasList ().size ()) {
     os << std::left <<
       std::setw (fieldWidth) <<
       "fNoteScordaturasList" << ": " <<
@@ -5796,8 +5812,8 @@ void msrNote::print (std::ostream& os) const
     ++gIndenter;
 
     std::list <S_msrScordatura>::const_iterator
-      iBegin = fNoteScordaturasList.begin (),
-      iEnd   = fNoteScordaturasList.end (),
+      iBegin = getNoteScordaturasList ().begin (),
+      iEnd   = getNoteScordaturasList ().end (),
       i      = iBegin;
     for ( ; ; ) {
       (*i)->print (os);
@@ -5809,7 +5825,7 @@ void msrNote::print (std::ostream& os) const
   }
 
   // print the harmonies associated to this note if any
-  if (fNoteHarmoniesList.size ()) {
+  if (getNoteHarmoniesList ().size ()) {
     os << std::left <<
       std::setw (fieldWidth) <<
       "fNoteHarmoniesList" << ": " <<
@@ -5818,8 +5834,8 @@ void msrNote::print (std::ostream& os) const
     ++gIndenter;
 
     std::list <S_msrHarmony>::const_iterator
-      iBegin = fNoteHarmoniesList.begin (),
-      iEnd   = fNoteHarmoniesList.end (),
+      iBegin = getNoteHarmoniesList ().begin (),
+      iEnd   = getNoteHarmoniesList ().end (),
       i      = iBegin;
     for ( ; ; ) {
       S_msrHarmony
@@ -5835,7 +5851,7 @@ void msrNote::print (std::ostream& os) const
   }
 
   // print the figured bass elements associated to this note if any
-  if (fNoteFiguredBassesList.size ()) {
+  if (getNoteFiguredBassesList ().size ()) {
     os << std::left <<
       std::setw (fieldWidth) <<
       "fNoteFiguredBassesList" << ": " <<
@@ -5844,8 +5860,8 @@ void msrNote::print (std::ostream& os) const
     ++gIndenter;
 
     std::list <S_msrFiguredBass>::const_iterator
-      iBegin = fNoteFiguredBassesList.begin (),
-      iEnd   = fNoteFiguredBassesList.end (),
+      iBegin = getNoteFiguredBassesList ().begin (),
+      iEnd   = getNoteFiguredBassesList ().end (),
       i      = iBegin;
     for ( ; ; ) {
       S_msrFiguredBass
@@ -6863,14 +6879,14 @@ void msrNote::printFull (std::ostream& os) const
   os <<
     std::setw (fieldWidth) <<
     "fNoteSpannersList";
-  if (fNoteSpannersList.size ()) {
+  if (getNoteSpannersList ().size ()) {
     os << std::endl;
 
     ++gIndenter;
 
     std::list <S_msrSpanner>::const_iterator
-      iBegin = fNoteSpannersList.begin (),
-      iEnd   = fNoteSpannersList.end (),
+      iBegin = getNoteSpannersList ().begin (),
+      iEnd   = getNoteSpannersList ().end (),
       i      = iBegin;
     for ( ; ; ) {
       (*i)->printFull (os);
@@ -6890,14 +6906,14 @@ void msrNote::printFull (std::ostream& os) const
   os <<
     std::setw (fieldWidth) <<
     "fNoteTechnicalsList";
-  if (fNoteTechnicalsList.size ()) {
+  if (getNoteTechnicalsList ().size ()) {
     os << std::endl;
 
     ++gIndenter;
 
     std::list <S_msrTechnical>::const_iterator
-      iBegin = fNoteTechnicalsList.begin (),
-      iEnd   = fNoteTechnicalsList.end (),
+      iBegin = getNoteTechnicalsList ().begin (),
+      iEnd   = getNoteTechnicalsList ().end (),
       i      = iBegin;
     for ( ; ; ) {
       (*i)->printFull (os);
@@ -6917,14 +6933,14 @@ void msrNote::printFull (std::ostream& os) const
   os <<
     std::setw (fieldWidth) <<
     "fNoteTechnicalWithIntegersList";
-  if (fNoteTechnicalWithIntegersList.size ()) {
+  if (getNoteTechnicalWithIntegersList ().size ()) {
     os << std::endl;
 
     ++gIndenter;
 
     std::list <S_msrTechnicalWithInteger>::const_iterator
-      iBegin = fNoteTechnicalWithIntegersList.begin (),
-      iEnd   = fNoteTechnicalWithIntegersList.end (),
+      iBegin = getNoteTechnicalWithIntegersList ().begin (),
+      iEnd   = getNoteTechnicalWithIntegersList ().end (),
       i      = iBegin;
     for ( ; ; ) {
       (*i)->printFull (os);
@@ -6944,14 +6960,14 @@ void msrNote::printFull (std::ostream& os) const
   os <<
     std::setw (fieldWidth) <<
     "fNoteTechnicalWithFloatsList";
-  if (fNoteTechnicalWithFloatsList.size ()) {
+  if (getNoteTechnicalWithFloatsList ().size ()) {
     os << std::endl;
 
     ++gIndenter;
 
     std::list <S_msrTechnicalWithFloat>::const_iterator
-      iBegin = fNoteTechnicalWithFloatsList.begin (),
-      iEnd   = fNoteTechnicalWithFloatsList.end (),
+      iBegin = getNoteTechnicalWithFloatsList ().begin (),
+      iEnd   = getNoteTechnicalWithFloatsList ().end (),
       i      = iBegin;
     for ( ; ; ) {
       (*i)->printFull (os);
@@ -6971,14 +6987,14 @@ void msrNote::printFull (std::ostream& os) const
   os <<
     std::setw (fieldWidth) <<
     "fNoteTechnicalWithStringsList";
-  if (fNoteTechnicalWithStringsList.size ()) {
+  if (getNoteTechnicalWithStringsList ().size ()) {
     os << std::endl;
 
     ++gIndenter;
 
     std::list <S_msrTechnicalWithString>::const_iterator
-      iBegin = fNoteTechnicalWithStringsList.begin (),
-      iEnd   = fNoteTechnicalWithStringsList.end (),
+      iBegin = getNoteTechnicalWithStringsList ().begin (),
+      iEnd   = getNoteTechnicalWithStringsList ().end (),
       i      = iBegin;
     for ( ; ; ) {
       (*i)->printFull (os);
@@ -6998,14 +7014,14 @@ void msrNote::printFull (std::ostream& os) const
   os <<
     std::setw (fieldWidth) <<
     "fNoteOrnamentsList";
-  if (fNoteOrnamentsList.size ()) {
+  if (getNoteOrnamentsList ().size ()) {
     os << std::endl;
 
     ++gIndenter;
 
     std::list <S_msrOrnament>::const_iterator
-      iBegin = fNoteOrnamentsList.begin (),
-      iEnd   = fNoteOrnamentsList.end (),
+      iBegin = getNoteOrnamentsList ().begin (),
+      iEnd   = getNoteOrnamentsList ().end (),
       i      = iBegin;
     for ( ; ; ) {
       (*i)->printFull (os);
@@ -7025,14 +7041,14 @@ void msrNote::printFull (std::ostream& os) const
   os <<
     std::setw (fieldWidth) <<
     "fNoteGlissandosList";
-  if (fNoteGlissandosList.size ()) {
+  if (getNoteGlissandosList ().size ()) {
     os << std::endl;
 
     ++gIndenter;
 
     std::list <S_msrGlissando>::const_iterator
-      iBegin = fNoteGlissandosList.begin (),
-      iEnd   = fNoteGlissandosList.end (),
+      iBegin = getNoteGlissandosList ().begin (),
+      iEnd   = getNoteGlissandosList ().end (),
       i      = iBegin;
     for ( ; ; ) {
       (*i)->printFull (os);
@@ -7052,14 +7068,14 @@ void msrNote::printFull (std::ostream& os) const
   os <<
     std::setw (fieldWidth) <<
     "fNoteSlidesList";
-  if (fNoteSlidesList.size ()) {
+  if (getNoteSlidesList ().size ()) {
     os << std::endl;
 
     ++gIndenter;
 
     std::list <S_msrSlide>::const_iterator
-      iBegin = fNoteSlidesList.begin (),
-      iEnd   = fNoteSlidesList.end (),
+      iBegin = getNoteSlidesList ().begin (),
+      iEnd   = getNoteSlidesList ().end (),
       i      = iBegin;
     for ( ; ; ) {
       (*i)->printFull (os);
@@ -7098,14 +7114,14 @@ void msrNote::printFull (std::ostream& os) const
   os <<
     std::setw (fieldWidth) <<
     "fNoteDynamicsList";
-  if (fNoteDynamicsList.size ()) {
+  if (getNoteDynamicsList ().size ()) {
     os << std::endl;
 
     ++gIndenter;
 
     std::list <S_msrDynamic>::const_iterator
-      iBegin = fNoteDynamicsList.begin (),
-      iEnd   = fNoteDynamicsList.end (),
+      iBegin = getNoteDynamicsList ().begin (),
+      iEnd   = getNoteDynamicsList ().end (),
       i      = iBegin;
     for ( ; ; ) {
       (*i)->printFull (os);
@@ -7125,14 +7141,14 @@ void msrNote::printFull (std::ostream& os) const
   os <<
     std::setw (fieldWidth) <<
     "fNoteOtherDynamicsList";
-  if (fNoteOtherDynamicsList.size ()) {
+  if (getNoteOtherDynamicsList ().size ()) {
     os << std::endl;
 
     ++gIndenter;
 
     std::list <S_msrOtherDynamic>::const_iterator
-      iBegin = fNoteOtherDynamicsList.begin (),
-      iEnd   = fNoteOtherDynamicsList.end (),
+      iBegin = getNoteOtherDynamicsList ().begin (),
+      iEnd   = getNoteOtherDynamicsList ().end (),
       i      = iBegin;
     for ( ; ; ) {
       (*i)->printFull (os);
@@ -7152,13 +7168,13 @@ void msrNote::printFull (std::ostream& os) const
   os <<
     std::setw (fieldWidth) <<
     "fNoteWordsList";
-  if (fNoteWordsList.size ()) {
+  if (getNoteWordsList ().size ()) {
     os << std::endl;
     ++gIndenter;
 
     std::list <S_msrWords>::const_iterator
-      iBegin = fNoteWordsList.begin (),
-      iEnd   = fNoteWordsList.end (),
+      iBegin = getNoteWordsList ().begin (),
+      iEnd   = getNoteWordsList ().end (),
       i      = iBegin;
     for ( ; ; ) {
       (*i)->printFull (os);
@@ -7199,14 +7215,14 @@ void msrNote::printFull (std::ostream& os) const
   os <<
     std::setw (fieldWidth) <<
     "fNoteLigaturesList";
-  if (fNoteLigaturesList.size ()) {
+  if (getNoteLigaturesList ().size ()) {
     os << std::endl;
 
     ++gIndenter;
 
     std::list <S_msrLigature>::const_iterator
-      iBegin = fNoteLigaturesList.begin (),
-      iEnd   = fNoteLigaturesList.end (),
+      iBegin = getNoteLigaturesList ().begin (),
+      iEnd   = getNoteLigaturesList ().end (),
       i      = iBegin;
     for ( ; ; ) {
       (*i)->printFull (os);
@@ -7226,14 +7242,14 @@ void msrNote::printFull (std::ostream& os) const
   os <<
     std::setw (fieldWidth) <<
     "fNotePedalsList";
-  if (fNotePedalsList.size ()) {
+  if (getNotePedalsList ().size ()) {
     os << std::endl;
 
     ++gIndenter;
 
     std::list <S_msrPedal>::const_iterator
-      iBegin = fNotePedalsList.begin (),
-      iEnd   = fNotePedalsList.end (),
+      iBegin = getNotePedalsList ().begin (),
+      iEnd   = getNotePedalsList ().end (),
       i      = iBegin;
     for ( ; ; ) {
       (*i)->printFull (os);
@@ -7253,14 +7269,14 @@ void msrNote::printFull (std::ostream& os) const
   os <<
     std::setw (fieldWidth) <<
     "fNoteSlashesList";
-  if (fNoteSlashesList.size ()) {
+  if (getNoteSlashesList ().size ()) {
     os << std::endl;
 
     ++gIndenter;
 
     std::list <S_msrSlash>::const_iterator
-      iBegin = fNoteSlashesList.begin (),
-      iEnd   = fNoteSlashesList.end (),
+      iBegin = getNoteSlashesList ().begin (),
+      iEnd   = getNoteSlashesList ().end (),
       i      = iBegin;
     for ( ; ; ) {
       (*i)->printFull (os);
@@ -7280,14 +7296,14 @@ void msrNote::printFull (std::ostream& os) const
   os <<
     std::setw (fieldWidth) <<
     "fNoteCrescDecrescsList";
-  if (fNoteCrescDecrescsList.size ()) {
+  if (getNoteCrescDecrescsList ().size ()) {
     os << std::endl;
 
     ++gIndenter;
 
     std::list <S_msrCrescDecresc>::const_iterator
-      iBegin = fNoteCrescDecrescsList.begin (),
-      iEnd   = fNoteCrescDecrescsList.end (),
+      iBegin = getNoteCrescDecrescsList ().begin (),
+      iEnd   = getNoteCrescDecrescsList ().end (),
       i      = iBegin;
     for ( ; ; ) {
       (*i)->printFull (os);
@@ -7307,14 +7323,14 @@ void msrNote::printFull (std::ostream& os) const
   os <<
     std::setw (fieldWidth) <<
     "fNoteWedgesList";
-  if (fNoteWedgesList.size ()) {
+  if (getNoteWedgesList ().size ()) {
     os << std::endl;
 
     ++gIndenter;
 
     std::list <S_msrWedge>::const_iterator
-      iBegin = fNoteWedgesList.begin (),
-      iEnd   = fNoteWedgesList.end (),
+      iBegin = getNoteWedgesList ().begin (),
+      iEnd   = getNoteWedgesList ().end (),
       i      = iBegin;
     for ( ; ; ) {
       (*i)->printFull (os);
@@ -7334,14 +7350,14 @@ void msrNote::printFull (std::ostream& os) const
   os <<
     std::setw (fieldWidth) <<
     "fNoteSegnosList";
-  if (fNoteSegnosList.size ()) {
+  if (getNoteSegnosList ().size ()) {
     os << std::endl;
 
     ++gIndenter;
 
     std::list <S_msrSegno>::const_iterator
-      iBegin = fNoteSegnosList.begin (),
-      iEnd   = fNoteSegnosList.end (),
+      iBegin = getNoteSegnosList ().begin (),
+      iEnd   = getNoteSegnosList ().end (),
       i      = iBegin;
     for ( ; ; ) {
       (*i)->printFull (os);
@@ -7361,14 +7377,14 @@ void msrNote::printFull (std::ostream& os) const
   os <<
     std::setw (fieldWidth) <<
     "fNoteDalSegnosList";
-  if (fNoteDalSegnosList.size ()) {
+  if (getNoteDalSegnosList ().size ()) {
     os << std::endl;
 
     ++gIndenter;
 
     std::list <S_msrDalSegno>::const_iterator
-      iBegin = fNoteDalSegnosList.begin (),
-      iEnd   = fNoteDalSegnosList.end (),
+      iBegin = getNoteDalSegnosList ().begin (),
+      iEnd   = getNoteDalSegnosList ().end (),
       i      = iBegin;
     for ( ; ; ) {
       (*i)->printFull (os);
@@ -7388,14 +7404,14 @@ void msrNote::printFull (std::ostream& os) const
   os <<
     std::setw (fieldWidth) <<
     "fNoteCodasList";
-  if (fNoteCodasList.size ()) {
+  if (getNoteCodasList ().size ()) {
     os << std::endl;
 
     ++gIndenter;
 
     std::list <S_msrCoda>::const_iterator
-      iBegin = fNoteCodasList.begin (),
-      iEnd   = fNoteCodasList.end (),
+      iBegin = getNoteCodasList ().begin (),
+      iEnd   = getNoteCodasList ().end (),
       i      = iBegin;
     for ( ; ; ) {
       (*i)->printFull (os);
@@ -7415,14 +7431,14 @@ void msrNote::printFull (std::ostream& os) const
   os <<
     std::setw (fieldWidth) <<
     "fNoteEyeGlassesList";
-  if (fNoteEyeGlassesList.size ()) {
+  if (getNoteEyeGlassesList ().size ()) {
     os << std::endl;
 
     ++gIndenter;
 
     std::list <S_msrEyeGlasses>::const_iterator
-      iBegin = fNoteEyeGlassesList.begin (),
-      iEnd   = fNoteEyeGlassesList.end (),
+      iBegin = getNoteEyeGlassesList ().begin (),
+      iEnd   = getNoteEyeGlassesList ().end (),
       i      = iBegin;
     for ( ; ; ) {
       (*i)->printFull (os);
@@ -7442,14 +7458,14 @@ void msrNote::printFull (std::ostream& os) const
   os <<
     std::setw (fieldWidth) <<
     "fNoteDampsList";
-  if (fNoteDampsList.size ()) {
+  if (getNoteDampsList ().size ()) {
     os << std::endl;
 
     ++gIndenter;
 
     std::list <S_msrDamp>::const_iterator
-      iBegin = fNoteDampsList.begin (),
-      iEnd   = fNoteDampsList.end (),
+      iBegin = getNoteDampsList ().begin (),
+      iEnd   = getNoteDampsList ().end (),
       i      = iBegin;
     for ( ; ; ) {
       (*i)->printFull (os);
@@ -7469,14 +7485,14 @@ void msrNote::printFull (std::ostream& os) const
   os <<
     std::setw (fieldWidth) <<
     "fNoteDampAllsList";
-  if (fNoteDampAllsList.size ()) {
+  if (getNoteDampAllsList ().size ()) {
     os << std::endl;
 
     ++gIndenter;
 
     std::list <S_msrDampAll>::const_iterator
-      iBegin = fNoteDampAllsList.begin (),
-      iEnd   = fNoteDampAllsList.end (),
+      iBegin = getNoteDampAllsList ().begin (),
+      iEnd   = getNoteDampAllsList ().end (),
       i      = iBegin;
     for ( ; ; ) {
       (*i)->printFull (os);
@@ -7496,14 +7512,14 @@ void msrNote::printFull (std::ostream& os) const
   os <<
     std::setw (fieldWidth) <<
     "fNoteScordaturasList";
-  if (fNoteScordaturasList.size ()) {
+  if (getNoteScordaturasList ().size ()) {
     os << std::endl;
 
     ++gIndenter;
 
     std::list <S_msrScordatura>::const_iterator
-      iBegin = fNoteScordaturasList.begin (),
-      iEnd   = fNoteScordaturasList.end (),
+      iBegin = getNoteScordaturasList ().begin (),
+      iEnd   = getNoteScordaturasList ().end (),
       i      = iBegin;
     for ( ; ; ) {
       (*i)->printFull (os);
@@ -7523,14 +7539,14 @@ void msrNote::printFull (std::ostream& os) const
   os <<
     std::setw (fieldWidth) <<
     "fNoteHarmoniesList";
-  if (fNoteHarmoniesList.size ()) {
+  if (getNoteHarmoniesList ().size ()) {
     os << std::endl;
 
     ++gIndenter;
 
     std::list <S_msrHarmony>::const_iterator
-      iBegin = fNoteHarmoniesList.begin (),
-      iEnd   = fNoteHarmoniesList.end (),
+      iBegin = getNoteHarmoniesList ().begin (),
+      iEnd   = getNoteHarmoniesList ().end (),
       i      = iBegin;
     for ( ; ; ) {
       S_msrHarmony
@@ -7552,14 +7568,14 @@ void msrNote::printFull (std::ostream& os) const
   os <<
     std::setw (fieldWidth) <<
     "fNoteFiguredBassesList";
-  if (fNoteFiguredBassesList.size ()) {
+  if (getNoteFiguredBassesList ().size ()) {
     os << std::endl;
 
     ++gIndenter;
 
     std::list <S_msrFiguredBass>::const_iterator
-      iBegin = fNoteFiguredBassesList.begin (),
-      iEnd   = fNoteFiguredBassesList.end (),
+      iBegin = getNoteFiguredBassesList ().begin (),
+      iEnd   = getNoteFiguredBassesList ().end (),
       i      = iBegin;
     for ( ; ; ) {
       S_msrFiguredBass
@@ -12,6 +12,8 @@
 #ifndef ___msrNotes___
 #define ___msrNotes___
 
+#include <memory>
+
 #include "msrTypesForwardDeclarations.h"
 
 #include "msrNotesEnumTypes.h"
@@ -50,6 +52,99 @@
 namespace MusicFormats
 {
 
+//______________________________________________________________________________
+// most notes have none of these elements attached:
+// they are stored apart from the note, which thus remains small
+struct msrNoteAttachments
+{
+  // spanners
+  std::list <S_msrSpanner>
+                        fNoteSpannersList;
+
+  // technicals
+  std::list <S_msrTechnical>
+                        fNoteTechnicalsList;
+
+  std::list <S_msrTechnicalWithInteger>
+                        fNoteTechnicalWithIntegersList;
+
+  std::list <S_msrTechnicalWithFloat>
+                        fNoteTechnicalWithFloatsList;
+
+  std::list <S_msrTechnicalWithString>
+                        fNoteTechnicalWithStringsList;
+
+  // ornaments
+  std::list <S_msrOrnament>
+                        fNoteOrnamentsList;
+
+  // glissandos
+  std::list <S_msrGlissando>
+                        fNoteGlissandosList;
+
+  // slides
+  std::list <S_msrSlide> fNoteSlidesList;
+
+  // dynamics
+  std::list <S_msrDynamic>
+                        fNoteDynamicsList;
+  std::list <S_msrOtherDynamic>
+                        fNoteOtherDynamicsList;
+
+  // slashes
+  std::list <S_msrSlash> fNoteSlashesList;
+
+  // cresc/decresc
+  std::list <S_msrCrescDecresc>
+                        fNoteCrescDecrescsList;
+
+  // wedges
+  std::list <S_msrWedge> fNoteWedgesList;
+
+  // segnos
+  std::list <S_msrSegno> fNoteSegnosList;
+
+  // dal segnos
+  std::list <S_msrDalSegno>
+                        fNoteDalSegnosList;
+
+  // coda
+  std::list <S_msrCoda>  fNoteCodasList;
+
+  // eyeglasses
+  std::list <S_msrEyeGlasses>
+                        fNoteEyeGlassesList;
+
+  // damps
+  std::list <S_msrDamp>  fNoteDampsList;
+
+  // damp alls
+  std::list <S_msrDampAll>
+                        fNoteDampAllsList;
+
+  // scordaturas
+  std::list <S_msrScordatura>
+                        fNoteScordaturasList;
+
+  // words
+  std::list <S_msrWords> fNoteWordsList;
+
+  // ligatures
+  std::list <S_msrLigature>
+                        fNoteLigaturesList;
+
+  // pedals
+  std::list <S_msrPedal> fNotePedalsList;
+
+  // harmonies
+  std::list <S_msrHarmony>
+                        fNoteHarmoniesList;
+
+  // figured bass
+  std::list <S_msrFiguredBass>
+                        fNoteFiguredBassesList;
+};
+
 //______________________________________________________________________________
 class EXP msrNote : public msrTupletElement
 {
@@ -215,6 +310,23 @@ class EXP msrNote : public msrTupletElement
 
     void                  initializeNote ();
 
+    // the attached elements that most notes don't have
+    // ------------------------------------------------------
+
+    const msrNoteAttachments&
+                          fetchNoteAttachments () const
+                              {
+                                return
+                                  fNoteAttachments
+                                    ? *fNoteAttachments
+                                    : sEmptyNoteAttachments;
+                              }
+
+    msrNoteAttachments&   noteAttachmentsToModify ();
+
+    static const msrNoteAttachments
+                          sEmptyNoteAttachments;
+
   public:
 
     // set and get
@@ -459,7 +571,7 @@ class EXP msrNote : public msrTupletElement
 
     const std::list <S_msrHarmony>&
                           getNoteHarmoniesList () const
-                              { return fNoteHarmoniesList; }
+                              { return fetchNoteAttachments ().fNoteHarmoniesList; }
 
     // figured bass
 //     void                  appendFiguredBassToNote (
@@ -467,7 +579,7 @@ class EXP msrNote : public msrTupletElement
 
     const std::list <S_msrFiguredBass>&
                           getNoteFiguredBassesList () const
-                              { return fNoteFiguredBassesList; }
+                              { return fetchNoteAttachments ().fNoteFiguredBassesList; }
 
     // note lyrics
     // -------------------------------
@@ -502,43 +614,43 @@ class EXP msrNote : public msrTupletElement
     // spanners
     const std::list <S_msrSpanner>&
                           getNoteSpannersList () const
-                              { return fNoteSpannersList; }
+                              { return fetchNoteAttachments ().fNoteSpannersList; }
 
     std::list <S_msrSpanner>&
                           getNoteSpannersListNonConst ()
-                              { return fNoteSpannersList; }
+                              { return noteAttachmentsToModify ().fNoteSpannersList; }
 
     // technicals
     const std::list <S_msrTechnical>&
                           getNoteTechnicalsList () const
-                              { return fNoteTechnicalsList; }
+                              { return fetchNoteAttachments ().fNoteTechnicalsList; }
 
     const std::list <S_msrTechnicalWithInteger>&
                           getNoteTechnicalWithIntegersList () const
-                              { return fNoteTechnicalWithIntegersList; }
+                              { return fetchNoteAttachments ().fNoteTechnicalWithIntegersList; }
 
     const std::list <S_msrTechnicalWithFloat>&
                           getNoteTechnicalWithFloatsList () const
-                              { return fNoteTechnicalWithFloatsList; }
+                              { return fetchNoteAttachments ().fNoteTechnicalWithFloatsList; }
 
     const std::list <S_msrTechnicalWithString>&
                           getNoteTechnicalWithStringsList () const
-                              { return fNoteTechnicalWithStringsList; }
+                              { return fetchNoteAttachments ().fNoteTechnicalWithStringsList; }
 
     // ornaments
     const std::list <S_msrOrnament>&
                           getNoteOrnamentsList () const
-                              { return fNoteOrnamentsList; }
+                              { return fetchNoteAttachments ().fNoteOrnamentsList; }
 
     // glissandos
     const std::list <S_msrGlissando>&
                           getNoteGlissandosList () const
-                              { return fNoteGlissandosList; }
+                              { return fetchNoteAttachments ().fNoteGlissandosList; }
 
     // slides
     const std::list <S_msrSlide>&
                           getNoteSlidesList () const
-                              { return fNoteSlidesList; }
+                              { return fetchNoteAttachments ().fNoteSlidesList; }
 
     // grace notes
     void                  setGraceNotesGroupBeforeNote (
@@ -578,72 +690,72 @@ class EXP msrNote : public msrTupletElement
     // dynamics
     const std::list <S_msrDynamic>&
                           getNoteDynamicsList () const
-                              { return fNoteDynamicsList; }
+                              { return fetchNoteAttachments ().fNoteDynamicsList; }
     const std::list <S_msrOtherDynamic>&
                           getNoteOtherDynamicsList () const
-                              { return fNoteOtherDynamicsList; }
+                              { return fetchNoteAttachments ().fNoteOtherDynamicsList; }
 
     // words
     const std::list <S_msrWords>&
                           getNoteWordsList () const
-                              { return fNoteWordsList; }
+                              { return fetchNoteAttachments ().fNoteWordsList; }
 
     std::list <S_msrWords>&     getNoteWordsListNonConst ()
-                              { return fNoteWordsList; }
+                              { return noteAttachmentsToModify ().fNoteWordsList; }
 
     // slashes
     const std::list <S_msrSlash>&
                           getNoteSlashesList () const
-                              { return fNoteSlashesList; }
+                              { return fetchNoteAttachments ().fNoteSlashesList; }
 
     // wedges
     const std::list <S_msrCrescDecresc>&
                           getNoteCrescDecrescsList () const
-                              { return fNoteCrescDecrescsList; }
+                              { return fetchNoteAttachments ().fNoteCrescDecrescsList; }
 
     // wedges
     const std::list <S_msrWedge>&
                           getNoteWedgesList () const
-                              { return fNoteWedgesList; }
+                              { return fetchNoteAttachments ().fNoteWedgesList; }
 
     std::list <S_msrWedge>&
                           getNoteWedgesListNonConst ()
-                              { return fNoteWedgesList; }
+                              { return noteAttachmentsToModify ().fNoteWedgesList; }
 
     // segnos
     const std::list <S_msrSegno>&
                           getNoteSegnosList () const
-                              { return fNoteSegnosList; }
+                              { return fetchNoteAttachments ().fNoteSegnosList; }
 
     // dal segnos
     const std::list <S_msrDalSegno>&
                           getNoteDalSegnosList () const
-                              { return fNoteDalSegnosList; }
+                              { return fetchNoteAttachments ().fNoteDalSegnosList; }
 
     // coda
     const std::list <S_msrCoda>&
                           getNoteCodasList () const
-                              { return fNoteCodasList; }
+                              { return fetchNoteAttachments ().fNoteCodasList; }
 
     // eyeglasses
     const std::list <S_msrEyeGlasses>&
                           getNoteEyeGlassesList () const
-                              { return fNoteEyeGlassesList; }
+                              { return fetchNoteAttachments ().fNoteEyeGlassesList; }
 
     // damps
     const std::list <S_msrDamp>&
                           getNoteDampsList () const
-                              { return fNoteDampsList; }
+                              { return fetchNoteAttachments ().fNoteDampsList; }
 
     // damp alls
     const std::list <S_msrDampAll>&
                           getNoteDampAllsList () const
-                              { return fNoteDampAllsList; }
+                              { return fetchNoteAttachments ().fNoteDampAllsList; }
 
     // scordaturas
     const std::list <S_msrScordatura>&
                           getNoteScordaturasList () const
-                              { return fNoteScordaturasList; }
+                              { return fetchNoteAttachments ().fNoteScordaturasList; }
 
     // slurs
     const std::list <S_msrSlur>&
@@ -653,12 +765,12 @@ class EXP msrNote : public msrTupletElement
     // ligatures
     const std::list <S_msrLigature>&
                           getNoteLigaturesList () const
-                              { return fNoteLigaturesList; }
+                              { return fetchNoteAttachments ().fNoteLigaturesList; }
 
     // pedals
     const std::list <S_msrPedal>&
                           getNotePedalsList () const
-                              { return fNotePedalsList; }
+                              { return fetchNoteAttachments ().fNotePedalsList; }
 
     // note measure information
     // -------------------------------
@@ -1085,44 +1197,6 @@ class EXP msrNote : public msrTupletElement
     std::list <S_msrArticulation>
                           fNoteArticulationsList;
 
-    // spanners
-    // ------------------------------------------------------
-
-    std::list <S_msrSpanner>
-                          fNoteSpannersList;
-
-    // technicals
-    // ------------------------------------------------------
-
-    std::list <S_msrTechnical>
-                          fNoteTechnicalsList;
-
-    std::list <S_msrTechnicalWithInteger>
-                          fNoteTechnicalWithIntegersList;
-
-    std::list <S_msrTechnicalWithFloat>
-                          fNoteTechnicalWithFloatsList;
-
-    std::list <S_msrTechnicalWithString>
-                          fNoteTechnicalWithStringsList;
-
-    // ornaments
-    // ------------------------------------------------------
-
-    std::list <S_msrOrnament>
-                          fNoteOrnamentsList;
-
-    // glissandos
-    // ------------------------------------------------------
-
-    std::list <S_msrGlissando>
-                          fNoteGlissandosList;
-
-    // slides
-    // ------------------------------------------------------
-
-    std::list <S_msrSlide> fNoteSlidesList;
-
     // grace notes
     // ------------------------------------------------------
 
@@ -1140,101 +1214,16 @@ class EXP msrNote : public msrTupletElement
 
     std::list <S_msrTie>  fNoteTiesList;
 
-    // dynamics
-    // ------------------------------------------------------
-
-    std::list <S_msrDynamic>
-                          fNoteDynamicsList;
-    std::list <S_msrOtherDynamic>
-                          fNoteOtherDynamicsList;
-
-    // slashes
-    // ------------------------------------------------------
-
-    std::list <S_msrSlash> fNoteSlashesList;
-
-    // cresc/decresc
-    // ------------------------------------------------------
-
-    std::list <S_msrCrescDecresc>
-                          fNoteCrescDecrescsList;
-
-    // wedges
-    // ------------------------------------------------------
-
-    std::list <S_msrWedge> fNoteWedgesList;
-
-    // segnos
-    // ------------------------------------------------------
-
-    std::list <S_msrSegno> fNoteSegnosList;
-
-    // dal segnos
-    // ------------------------------------------------------
-
-    std::list <S_msrDalSegno>
-                          fNoteDalSegnosList;
-
-    // coda
-    // ------------------------------------------------------
-
-    std::list <S_msrCoda>  fNoteCodasList;
-
-    // eyeglasses
-    // ------------------------------------------------------
-
-    std::list <S_msrEyeGlasses>
-                          fNoteEyeGlassesList;
-
-    // damps
-    // ------------------------------------------------------
-
-    std::list <S_msrDamp>  fNoteDampsList;
-
-    // damp alls
-    // ------------------------------------------------------
-
-    std::list <S_msrDampAll>
-                          fNoteDampAllsList;
-
-    // scordaturas
-    // ------------------------------------------------------
-
-    std::list <S_msrScordatura>
-                          fNoteScordaturasList;
-
-    // words
-    // ------------------------------------------------------
-
-    std::list <S_msrWords> fNoteWordsList;
-
     // slurs
     // ------------------------------------------------------
 
     std::list <S_msrSlur>  fNoteSlursList;
 
-    // ligatures
-    // ------------------------------------------------------
-
-    std::list <S_msrLigature>
-                          fNoteLigaturesList;
-
-    // pedals
-    // ------------------------------------------------------
-
-    std::list <S_msrPedal> fNotePedalsList;
-
-    // harmonies
-    // ------------------------------------------------------
-
-    std::list <S_msrHarmony>
-                          fNoteHarmoniesList;
-
-    // figured bass
+    // the other attached elements, created when the first one is attached
     // ------------------------------------------------------
 
-    std::list <S_msrFiguredBass>
-                          fNoteFiguredBassesList;
+    std::unique_ptr <msrNoteAttachments>
+                          fNoteAttachments;
 
     // note redundant information (for speed)
     // ------------------------------------------------------
@@ -167,7 +167,7 @@ void msrPitchesLanguageAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_msrPitchesLanguageAtom>*
     p =
-      dynamic_cast<visitor<S_msrPitchesLanguageAtom>*> (v)) {
+      visitor<S_msrPitchesLanguageAtom>::cast (v)) {
         S_msrPitchesLanguageAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -203,7 +203,7 @@ void msrPitchesLanguageAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_msrPitchesLanguageAtom>*
     p =
-      dynamic_cast<visitor<S_msrPitchesLanguageAtom>*> (v)) {
+      visitor<S_msrPitchesLanguageAtom>::cast (v)) {
         S_msrPitchesLanguageAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -512,7 +512,7 @@ void msrRenamePartAtom::acceptIn (basevisitor* v)
 
   if (visitor<S_msrRenamePartAtom>*
     p =
-      dynamic_cast<visitor<S_msrRenamePartAtom>*> (v)) {
+      visitor<S_msrRenamePartAtom>::cast (v)) {
         S_msrRenamePartAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -548,7 +548,7 @@ void msrRenamePartAtom::acceptOut (basevisitor* v)
 
   if (visitor<S_msrRenamePartAtom>*
     p =
-      dynamic_cast<visitor<S_msrRenamePartAtom>*> (v)) {
+      visitor<S_msrRenamePartAtom>::cast (v)) {
         S_msrRenamePartAtom elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -1565,7 +1565,7 @@ void msrOahGroup::acceptIn (basevisitor* v)
 
   if (visitor<S_msrOahGroup>*
     p =
-      dynamic_cast<visitor<S_msrOahGroup>*> (v)) {
+      visitor<S_msrOahGroup>::cast (v)) {
         S_msrOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -1601,7 +1601,7 @@ void msrOahGroup::acceptOut (basevisitor* v)
 
   if (visitor<S_msrOahGroup>*
     p =
-      dynamic_cast<visitor<S_msrOahGroup>*> (v)) {
+      visitor<S_msrOahGroup>::cast (v)) {
         S_msrOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
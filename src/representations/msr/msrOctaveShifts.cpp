@@ -126,7 +126,7 @@ void msrOctaveShift::acceptIn (basevisitor* v)
 
   if (visitor<S_msrOctaveShift>*
     p =
-      dynamic_cast<visitor<S_msrOctaveShift>*> (v)) {
+      visitor<S_msrOctaveShift>::cast (v)) {
         S_msrOctaveShift elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -162,7 +162,7 @@ void msrOctaveShift::acceptOut (basevisitor* v)
 
   if (visitor<S_msrOctaveShift>*
     p =
-      dynamic_cast<visitor<S_msrOctaveShift>*> (v)) {
+      visitor<S_msrOctaveShift>::cast (v)) {
         S_msrOctaveShift elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -71,7 +71,7 @@ void msrOrnament::acceptIn (basevisitor* v)
 
   if (visitor<S_msrOrnament>*
     p =
-      dynamic_cast<visitor<S_msrOrnament>*> (v)) {
+      visitor<S_msrOrnament>::cast (v)) {
         S_msrOrnament elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -107,7 +107,7 @@ void msrOrnament::acceptOut (basevisitor* v)
 
   if (visitor<S_msrOrnament>*
     p =
-      dynamic_cast<visitor<S_msrOrnament>*> (v)) {
+      visitor<S_msrOrnament>::cast (v)) {
         S_msrOrnament elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -163,7 +163,7 @@ void msrPageBreak::acceptIn (basevisitor* v)
 
   if (visitor<S_msrPageBreak>*
     p =
-      dynamic_cast<visitor<S_msrPageBreak>*> (v)) {
+      visitor<S_msrPageBreak>::cast (v)) {
         S_msrPageBreak elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -199,7 +199,7 @@ void msrPageBreak::acceptOut (basevisitor* v)
 
   if (visitor<S_msrPageBreak>*
     p =
-      dynamic_cast<visitor<S_msrPageBreak>*> (v)) {
+      visitor<S_msrPageBreak>::cast (v)) {
         S_msrPageBreak elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
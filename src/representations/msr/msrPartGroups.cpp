@@ -1249,7 +1249,7 @@ void msrPartGroup::acceptIn (basevisitor* v)
 
   if (visitor<S_msrPartGroup>*
     p =
-      dynamic_cast<visitor<S_msrPartGroup>*> (v)) {
+      visitor<S_msrPartGroup>::cast (v)) {
         S_msrPartGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -1285,7 +1285,7 @@ void msrPartGroup::acceptOut (basevisitor* v)
 
   if (visitor<S_msrPartGroup>*
     p =
-      dynamic_cast<visitor<S_msrPartGroup>*> (v)) {
+      visitor<S_msrPartGroup>::cast (v)) {
         S_msrPartGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -3491,7 +3491,7 @@ void msrPart::acceptIn (basevisitor* v)
 
   if (visitor<S_msrPart>*
     p =
-      dynamic_cast<visitor<S_msrPart>*> (v)) {
+      visitor<S_msrPart>::cast (v)) {
         S_msrPart elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -3527,7 +3527,7 @@ void msrPart::acceptOut (basevisitor* v)
 
   if (visitor<S_msrPart>*
     p =
-      dynamic_cast<visitor<S_msrPart>*> (v)) {
+      visitor<S_msrPart>::cast (v)) {
         S_msrPart elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
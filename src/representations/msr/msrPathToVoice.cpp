@@ -178,7 +178,7 @@ Bool msrPathToVoice::pathContainsVoice (const S_msrVoice& voice)
 //
 //   if (visitor<S_msrPathToVoice>*
 //     p =
-//       dynamic_cast<visitor<S_msrPathToVoice>*> (v)) {
+//       visitor<S_msrPathToVoice>::cast (v)) {
 //         S_msrPathToVoice elem = this;
 //
 //         if (gMsrOahGroup->getTraceMsrVisitors ()) {
@@ -200,7 +200,7 @@ Bool msrPathToVoice::pathContainsVoice (const S_msrVoice& voice)
 //
 //   if (visitor<S_msrPathToVoice>*
 //     p =
-//       dynamic_cast<visitor<S_msrPathToVoice>*> (v)) {
+//       visitor<S_msrPathToVoice>::cast (v)) {
 //         S_msrPathToVoice elem = this;
 //
 //         if (gMsrOahGroup->getTraceMsrVisitors ()) {
@@ -9,6 +9,7 @@
   https://github.com/jacques-menu/musicformats
 */
 
+#include <iterator>
 #include <sstream>
 
 #include "msrPitches.h"
@@ -1534,749 +1535,255 @@ std::string availableQuarterTonesPitchesLanguageKinds (size_t namesListMaxLength
   return ss.str ();
 }
 
-// quarter tones pitches
+// pitches kinds conversions
 //______________________________________________________________________________
-msrQuarterTonesPitchKind quarterTonesPitchKindFromDiatonicPitchAndAlteration (
-  const mfInputLineNumber& inputLineNumber,
-  msrDiatonicPitchKind diatonicPitchKind,
-  msrAlterationKind    alterationKind)
-{
+// msrSemiTonesPitchKind lists the diatonic pitches from C to B,
+// and msrQuarterTonesPitchKind lists them from A to G,
+// each one with its alterations in msrAlterationKind order:
+// the conversions between them are lookup tables computed at compile time
+
+constexpr size_t
+  K_MSR_DIATONIC_PITCH_KINDS_NUMBER =
+    size_t (msrDiatonicPitchKind::kDiatonicPitchB) + 1,
+  K_MSR_ALTERATION_KINDS_NUMBER =
+    size_t (msrAlterationKind::kAlterationTripleSharp) + 1,
+  K_MSR_SEMI_TONES_PITCH_KINDS_NUMBER =
+    size_t (msrSemiTonesPitchKind::kSTP_B_TripleSharp) + 1,
+  K_MSR_QUARTER_TONES_PITCH_KINDS_NUMBER =
+    size_t (msrQuarterTonesPitchKind::kQTP_G_TripleSharp) + 1;
+
+struct msrPitchKindsConversionsTables {
   msrQuarterTonesPitchKind
-    result =
-      msrQuarterTonesPitchKind::kQTP_UNKNOWN_;
-
-  switch (diatonicPitchKind) {
-    case msrDiatonicPitchKind::kDiatonicPitch_UNKNOWN_:
-      {
-        result = msrQuarterTonesPitchKind::kQTP_UNKNOWN_;
-        /* JMI
-        std::stringstream ss;
-
-        ss <<
-          "cannot convert msrDiatonicPitchKind::kDiatonicPitch_UNKNOWN_ to a quarter tones pitch"
-          ", line: " << inputLineNumber;
-
-        msrInternalError (
-          gServiceRunData->getInputSourceName (),
-          inputLineNumber,
-          __FILE__, mfInputLineNumber (__LINE__),
-          ss.str ());
-          */
-      }
-      break;
-
-    case msrDiatonicPitchKind::kDiatonicPitchA:
-      switch (alterationKind) {
-        case msrAlterationKind::kAlterationTripleFlat:
-          result = msrQuarterTonesPitchKind::kQTP_A_TripleFlat;
-          break;
-        case msrAlterationKind::kAlterationDoubleFlat:
-          result = msrQuarterTonesPitchKind::kQTP_A_DoubleFlat;
-          break;
-        case msrAlterationKind::kAlterationSesquiFlat:
-          result = msrQuarterTonesPitchKind::kQTP_A_SesquiFlat;
-          break;
-        case msrAlterationKind::kAlterationFlat:
-          result = msrQuarterTonesPitchKind::kQTP_A_Flat;
-          break;
-        case msrAlterationKind::kAlterationSemiFlat:
-          result = msrQuarterTonesPitchKind::kQTP_A_SemiFlat;
-          break;
-        case msrAlterationKind::kAlterationNatural:
-          result = msrQuarterTonesPitchKind::kQTP_A_Natural;
-          break;
-        case msrAlterationKind::kAlterationSemiSharp:
-          result = msrQuarterTonesPitchKind::kQTP_A_SemiSharp;
-          break;
-        case msrAlterationKind::kAlterationSharp:
-          result = msrQuarterTonesPitchKind::kQTP_A_Sharp;
-          break;
-        case msrAlterationKind::kAlterationSesquiSharp:
-          result = msrQuarterTonesPitchKind::kQTP_A_SesquiSharp;
-          break;
-        case msrAlterationKind::kAlterationDoubleSharp:
-          result = msrQuarterTonesPitchKind::kQTP_A_DoubleSharp;
-          break;
-        case msrAlterationKind::kAlterationTripleSharp:
-          result = msrQuarterTonesPitchKind::kQTP_A_TripleSharp;
-          break;
-        case msrAlterationKind::kAlteration_UNKNOWN_:
-          {
-            std::stringstream ss;
-
-            ss <<
-              "'A' alteration has not been set"
-              ", line: " << inputLineNumber;
-
-            msrInternalError (
-              gServiceRunData->getInputSourceName (),
-              inputLineNumber,
-              __FILE__, mfInputLineNumber (__LINE__),
-              ss.str ());
-          }
-          break;
-      } // switch
-      break;
-
-    case msrDiatonicPitchKind::kDiatonicPitchB:
-      switch (alterationKind) {
-        case msrAlterationKind::kAlterationTripleFlat:
-          result = msrQuarterTonesPitchKind::kQTP_B_TripleFlat;
-          break;
-        case msrAlterationKind::kAlterationDoubleFlat:
-          result = msrQuarterTonesPitchKind::kQTP_B_DoubleFlat;
-          break;
-        case msrAlterationKind::kAlterationSesquiFlat:
-          result = msrQuarterTonesPitchKind::kQTP_B_SesquiFlat;
-          break;
-        case msrAlterationKind::kAlterationFlat:
-          result = msrQuarterTonesPitchKind::kQTP_B_Flat;
-          break;
-        case msrAlterationKind::kAlterationSemiFlat:
-          result = msrQuarterTonesPitchKind::kQTP_B_SemiFlat;
-          break;
-        case msrAlterationKind::kAlterationNatural:
-          result = msrQuarterTonesPitchKind::kQTP_B_Natural;
-          break;
-        case msrAlterationKind::kAlterationSemiSharp:
-          result = msrQuarterTonesPitchKind::kQTP_B_SemiSharp;
-          break;
-        case msrAlterationKind::kAlterationSharp:
-          result = msrQuarterTonesPitchKind::kQTP_B_Sharp;
-          break;
-        case msrAlterationKind::kAlterationSesquiSharp:
-          result = msrQuarterTonesPitchKind::kQTP_B_SesquiSharp;
-          break;
-        case msrAlterationKind::kAlterationDoubleSharp:
-          result = msrQuarterTonesPitchKind::kQTP_B_DoubleSharp;
-          break;
-        case msrAlterationKind::kAlterationTripleSharp:
-          result = msrQuarterTonesPitchKind::kQTP_B_TripleSharp;
-          break;
-        case msrAlterationKind::kAlteration_UNKNOWN_:
-          {
-            std::stringstream ss;
-
-            ss <<
-              "'B' alteration has not been set"
-              ", line: " << inputLineNumber;
-
-            msrInternalError (
-              gServiceRunData->getInputSourceName (),
-              inputLineNumber,
-              __FILE__, mfInputLineNumber (__LINE__),
-              ss.str ());
-          }
-          break;
-      } // switch
-      break;
-
-      break;
-
-    case msrDiatonicPitchKind::kDiatonicPitchC:
-      switch (alterationKind) {
-        case msrAlterationKind::kAlterationTripleFlat:
-          result = msrQuarterTonesPitchKind::kQTP_C_TripleFlat;
-          break;
-        case msrAlterationKind::kAlterationDoubleFlat:
-          result = msrQuarterTonesPitchKind::kQTP_C_DoubleFlat;
-          break;
-        case msrAlterationKind::kAlterationSesquiFlat:
-          result = msrQuarterTonesPitchKind::kQTP_C_SesquiFlat;
-          break;
-        case msrAlterationKind::kAlterationFlat:
-          result = msrQuarterTonesPitchKind::kQTP_C_Flat;
-          break;
-        case msrAlterationKind::kAlterationSemiFlat:
-          result = msrQuarterTonesPitchKind::kQTP_C_SemiFlat;
-          break;
-        case msrAlterationKind::kAlterationNatural:
-          result = msrQuarterTonesPitchKind::kQTP_C_Natural;
-          break;
-        case msrAlterationKind::kAlterationSemiSharp:
-          result = msrQuarterTonesPitchKind::kQTP_C_SemiSharp;
-          break;
-        case msrAlterationKind::kAlterationSharp:
-          result = msrQuarterTonesPitchKind::kQTP_C_Sharp;
-          break;
-        case msrAlterationKind::kAlterationSesquiSharp:
-          result = msrQuarterTonesPitchKind::kQTP_C_SesquiSharp;
-          break;
-        case msrAlterationKind::kAlterationDoubleSharp:
-          result = msrQuarterTonesPitchKind::kQTP_C_DoubleSharp;
-          break;
-        case msrAlterationKind::kAlterationTripleSharp:
-          result = msrQuarterTonesPitchKind::kQTP_C_TripleSharp;
-          break;
-        case msrAlterationKind::kAlteration_UNKNOWN_:
-          {
-            std::stringstream ss;
-
-            ss <<
-              "'C' alteration has not been set"
-              ", line: " << inputLineNumber;
-
-            msrInternalError (
-              gServiceRunData->getInputSourceName (),
-              inputLineNumber,
-              __FILE__, mfInputLineNumber (__LINE__),
-              ss.str ());
-          }
-          break;
-      } // switch
-      break;
-
-    case msrDiatonicPitchKind::kDiatonicPitchD:
-      switch (alterationKind) {
-        case msrAlterationKind::kAlterationTripleFlat:
-          result = msrQuarterTonesPitchKind::kQTP_D_TripleFlat;
-          break;
-        case msrAlterationKind::kAlterationDoubleFlat:
-          result = msrQuarterTonesPitchKind::kQTP_D_DoubleFlat;
-          break;
-        case msrAlterationKind::kAlterationSesquiFlat:
-          result = msrQuarterTonesPitchKind::kQTP_D_SesquiFlat;
-          break;
-        case msrAlterationKind::kAlterationFlat:
-          result = msrQuarterTonesPitchKind::kQTP_D_Flat;
-          break;
-        case msrAlterationKind::kAlterationSemiFlat:
-          result = msrQuarterTonesPitchKind::kQTP_D_SemiFlat;
-          break;
-        case msrAlterationKind::kAlterationNatural:
-          result = msrQuarterTonesPitchKind::kQTP_D_Natural;
-          break;
-        case msrAlterationKind::kAlterationSemiSharp:
-          result = msrQuarterTonesPitchKind::kQTP_D_SemiSharp;
-          break;
-        case msrAlterationKind::kAlterationSharp:
-          result = msrQuarterTonesPitchKind::kQTP_D_Sharp;
-          break;
-        case msrAlterationKind::kAlterationSesquiSharp:
-          result = msrQuarterTonesPitchKind::kQTP_D_SesquiSharp;
-          break;
-        case msrAlterationKind::kAlterationDoubleSharp:
-          result = msrQuarterTonesPitchKind::kQTP_D_DoubleSharp;
-          break;
-        case msrAlterationKind::kAlterationTripleSharp:
-          result = msrQuarterTonesPitchKind::kQTP_D_TripleSharp;
-          break;
-        case msrAlterationKind::kAlteration_UNKNOWN_:
-          {
-            std::stringstream ss;
-
-            ss <<
-              "'D' alteration has not been set"
-              ", line: " << inputLineNumber;
-
-            msrInternalError (
-              gServiceRunData->getInputSourceName (),
-              inputLineNumber,
-              __FILE__, mfInputLineNumber (__LINE__),
-              ss.str ());
-          }
-          break;
-      } // switch
-      break;
-
-    case msrDiatonicPitchKind::kDiatonicPitchE:
-      switch (alterationKind) {
-        case msrAlterationKind::kAlterationTripleFlat:
-          result = msrQuarterTonesPitchKind::kQTP_E_TripleFlat;
-          break;
-        case msrAlterationKind::kAlterationDoubleFlat:
-          result = msrQuarterTonesPitchKind::kQTP_E_DoubleFlat;
-          break;
-        case msrAlterationKind::kAlterationSesquiFlat:
-          result = msrQuarterTonesPitchKind::kQTP_E_SesquiFlat;
-          break;
-        case msrAlterationKind::kAlterationFlat:
-          result = msrQuarterTonesPitchKind::kQTP_E_Flat;
-          break;
-        case msrAlterationKind::kAlterationSemiFlat:
-          result = msrQuarterTonesPitchKind::kQTP_E_SemiFlat;
-          break;
-        case msrAlterationKind::kAlterationNatural:
-          result = msrQuarterTonesPitchKind::kQTP_E_Natural;
-          break;
-        case msrAlterationKind::kAlterationSemiSharp:
-          result = msrQuarterTonesPitchKind::kQTP_E_SemiSharp;
-          break;
-        case msrAlterationKind::kAlterationSharp:
-          result = msrQuarterTonesPitchKind::kQTP_E_Sharp;
-          break;
-        case msrAlterationKind::kAlterationSesquiSharp:
-          result = msrQuarterTonesPitchKind::kQTP_E_SesquiSharp;
-          break;
-        case msrAlterationKind::kAlterationDoubleSharp:
-          result = msrQuarterTonesPitchKind::kQTP_E_DoubleSharp;
-          break;
-        case msrAlterationKind::kAlterationTripleSharp:
-          result = msrQuarterTonesPitchKind::kQTP_E_TripleSharp;
-          break;
-        case msrAlterationKind::kAlteration_UNKNOWN_:
-          {
-            std::stringstream ss;
-
-            ss <<
-              "'E' alteration has not been set"
-              ", line: " << inputLineNumber;
-
-            msrInternalError (
-              gServiceRunData->getInputSourceName (),
-              inputLineNumber,
-              __FILE__, mfInputLineNumber (__LINE__),
-              ss.str ());
-          }
-          break;
-      } // switch
-      break;
-
-    case msrDiatonicPitchKind::kDiatonicPitchF:
-      switch (alterationKind) {
-        case msrAlterationKind::kAlterationTripleFlat:
-          result = msrQuarterTonesPitchKind::kQTP_F_TripleFlat;
-          break;
-        case msrAlterationKind::kAlterationDoubleFlat:
-          result = msrQuarterTonesPitchKind::kQTP_F_DoubleFlat;
-          break;
-        case msrAlterationKind::kAlterationSesquiFlat:
-          result = msrQuarterTonesPitchKind::kQTP_F_SesquiFlat;
-          break;
-        case msrAlterationKind::kAlterationFlat:
-          result = msrQuarterTonesPitchKind::kQTP_F_Flat;
-          break;
-        case msrAlterationKind::kAlterationSemiFlat:
-          result = msrQuarterTonesPitchKind::kQTP_F_SemiFlat;
-          break;
-        case msrAlterationKind::kAlterationNatural:
-          result = msrQuarterTonesPitchKind::kQTP_F_Natural;
-          break;
-        case msrAlterationKind::kAlterationSemiSharp:
-          result = msrQuarterTonesPitchKind::kQTP_F_SemiSharp;
-          break;
-        case msrAlterationKind::kAlterationSharp:
-          result = msrQuarterTonesPitchKind::kQTP_F_Sharp;
-          break;
-        case msrAlterationKind::kAlterationSesquiSharp:
-          result = msrQuarterTonesPitchKind::kQTP_F_SesquiSharp;
-          break;
-        case msrAlterationKind::kAlterationDoubleSharp:
-          result = msrQuarterTonesPitchKind::kQTP_F_DoubleSharp;
-          break;
-        case msrAlterationKind::kAlterationTripleSharp:
-          result = msrQuarterTonesPitchKind::kQTP_F_TripleSharp;
-          break;
-        case msrAlterationKind::kAlteration_UNKNOWN_:
-          {
-            std::stringstream ss;
-
-            ss <<
-              "'F' alteration has not been set"
-              ", line: " << inputLineNumber;
-
-            msrInternalError (
-              gServiceRunData->getInputSourceName (),
-              inputLineNumber,
-              __FILE__, mfInputLineNumber (__LINE__),
-              ss.str ());
-          }
-          break;
-      } // switch
-      break;
-
-    case msrDiatonicPitchKind::kDiatonicPitchG:
-      switch (alterationKind) {
-        case msrAlterationKind::kAlterationTripleFlat:
-          result = msrQuarterTonesPitchKind::kQTP_G_TripleFlat;
-          break;
-        case msrAlterationKind::kAlterationDoubleFlat:
-          result = msrQuarterTonesPitchKind::kQTP_G_DoubleFlat;
-          break;
-        case msrAlterationKind::kAlterationSesquiFlat:
-          result = msrQuarterTonesPitchKind::kQTP_G_SesquiFlat;
-          break;
-        case msrAlterationKind::kAlterationFlat:
-          result = msrQuarterTonesPitchKind::kQTP_G_Flat;
-          break;
-        case msrAlterationKind::kAlterationSemiFlat:
-          result = msrQuarterTonesPitchKind::kQTP_G_SemiFlat;
-          break;
-        case msrAlterationKind::kAlterationNatural:
-          result = msrQuarterTonesPitchKind::kQTP_G_Natural;
-          break;
-        case msrAlterationKind::kAlterationSemiSharp:
-          result = msrQuarterTonesPitchKind::kQTP_G_SemiSharp;
-          break;
-        case msrAlterationKind::kAlterationSharp:
-          result = msrQuarterTonesPitchKind::kQTP_G_Sharp;
-          break;
-        case msrAlterationKind::kAlterationSesquiSharp:
-          result = msrQuarterTonesPitchKind::kQTP_G_SesquiSharp;
-          break;
-        case msrAlterationKind::kAlterationDoubleSharp:
-          result = msrQuarterTonesPitchKind::kQTP_G_DoubleSharp;
-          break;
-        case msrAlterationKind::kAlterationTripleSharp:
-          result = msrQuarterTonesPitchKind::kQTP_G_TripleSharp;
-          break;
-        case msrAlterationKind::kAlteration_UNKNOWN_:
-          {
-            std::stringstream ss;
-
-            ss <<
-              "'G' alteration has not been set"
-              ", line: " << inputLineNumber;
-
-            msrInternalError (
-              gServiceRunData->getInputSourceName (),
-              inputLineNumber,
-              __FILE__, mfInputLineNumber (__LINE__),
-              ss.str ());
-          }
-          break;
-      } // switch
-      break;
-  } // switch
-
-  return result;
-}
+                          fQuarterTonesPitchKindsFromDiatonicPitchAndAlteration
+                            [K_MSR_DIATONIC_PITCH_KINDS_NUMBER]
+                            [K_MSR_ALTERATION_KINDS_NUMBER];
 
-msrDiatonicPitchKind diatonicPitchKindFromQuarterTonesPitchKind (
-  const mfInputLineNumber& inputLineNumber,
-  msrQuarterTonesPitchKind quarterTonesPitchKind)
-{
-  msrDiatonicPitchKind result = msrDiatonicPitchKind::kDiatonicPitch_UNKNOWN_;
+  msrDiatonicPitchKind    fDiatonicPitchKindsFromQuarterTonesPitchKinds
+                            [K_MSR_QUARTER_TONES_PITCH_KINDS_NUMBER];
+  msrAlterationKind       fAlterationKindsFromQuarterTonesPitchKinds
+                            [K_MSR_QUARTER_TONES_PITCH_KINDS_NUMBER];
 
-  switch (quarterTonesPitchKind) {
-    case msrQuarterTonesPitchKind::kQTP_A_TripleFlat:
-    case msrQuarterTonesPitchKind::kQTP_A_DoubleFlat:
-    case msrQuarterTonesPitchKind::kQTP_A_SesquiFlat:
-    case msrQuarterTonesPitchKind::kQTP_A_Flat:
-    case msrQuarterTonesPitchKind::kQTP_A_SemiFlat:
-    case msrQuarterTonesPitchKind::kQTP_A_Natural:
-    case msrQuarterTonesPitchKind::kQTP_A_SemiSharp:
-    case msrQuarterTonesPitchKind::kQTP_A_Sharp:
-    case msrQuarterTonesPitchKind::kQTP_A_SesquiSharp:
-    case msrQuarterTonesPitchKind::kQTP_A_DoubleSharp:
-    case msrQuarterTonesPitchKind::kQTP_A_TripleSharp:
-      result = msrDiatonicPitchKind::kDiatonicPitchA;
-      break;
-
-    case msrQuarterTonesPitchKind::kQTP_B_TripleFlat:
-    case msrQuarterTonesPitchKind::kQTP_B_DoubleFlat:
-    case msrQuarterTonesPitchKind::kQTP_B_SesquiFlat:
-    case msrQuarterTonesPitchKind::kQTP_B_Flat:
-    case msrQuarterTonesPitchKind::kQTP_B_SemiFlat:
-    case msrQuarterTonesPitchKind::kQTP_B_Natural:
-    case msrQuarterTonesPitchKind::kQTP_B_SemiSharp:
-    case msrQuarterTonesPitchKind::kQTP_B_Sharp:
-    case msrQuarterTonesPitchKind::kQTP_B_SesquiSharp:
-    case msrQuarterTonesPitchKind::kQTP_B_DoubleSharp:
-    case msrQuarterTonesPitchKind::kQTP_B_TripleSharp:
-      result = msrDiatonicPitchKind::kDiatonicPitchB;
-      break;
-
-    case msrQuarterTonesPitchKind::kQTP_C_TripleFlat:
-    case msrQuarterTonesPitchKind::kQTP_C_DoubleFlat:
-    case msrQuarterTonesPitchKind::kQTP_C_SesquiFlat:
-    case msrQuarterTonesPitchKind::kQTP_C_Flat:
-    case msrQuarterTonesPitchKind::kQTP_C_SemiFlat:
-    case msrQuarterTonesPitchKind::kQTP_C_Natural:
-    case msrQuarterTonesPitchKind::kQTP_C_SemiSharp:
-    case msrQuarterTonesPitchKind::kQTP_C_Sharp:
-    case msrQuarterTonesPitchKind::kQTP_C_SesquiSharp:
-    case msrQuarterTonesPitchKind::kQTP_C_DoubleSharp:
-    case msrQuarterTonesPitchKind::kQTP_C_TripleSharp:
-      result = msrDiatonicPitchKind::kDiatonicPitchC;
-      break;
-
-    case msrQuarterTonesPitchKind::kQTP_D_TripleFlat:
-    case msrQuarterTonesPitchKind::kQTP_D_DoubleFlat:
-    case msrQuarterTonesPitchKind::kQTP_D_SesquiFlat:
-    case msrQuarterTonesPitchKind::kQTP_D_Flat:
-    case msrQuarterTonesPitchKind::kQTP_D_SemiFlat:
-    case msrQuarterTonesPitchKind::kQTP_D_Natural:
-    case msrQuarterTonesPitchKind::kQTP_D_SemiSharp:
-    case msrQuarterTonesPitchKind::kQTP_D_Sharp:
-    case msrQuarterTonesPitchKind::kQTP_D_SesquiSharp:
-    case msrQuarterTonesPitchKind::kQTP_D_DoubleSharp:
-    case msrQuarterTonesPitchKind::kQTP_D_TripleSharp:
-      result = msrDiatonicPitchKind::kDiatonicPitchD;
-      break;
-
-    case msrQuarterTonesPitchKind::kQTP_E_TripleFlat:
-    case msrQuarterTonesPitchKind::kQTP_E_DoubleFlat:
-    case msrQuarterTonesPitchKind::kQTP_E_SesquiFlat:
-    case msrQuarterTonesPitchKind::kQTP_E_Flat:
-    case msrQuarterTonesPitchKind::kQTP_E_SemiFlat:
-    case msrQuarterTonesPitchKind::kQTP_E_Natural:
-    case msrQuarterTonesPitchKind::kQTP_E_SemiSharp:
-    case msrQuarterTonesPitchKind::kQTP_E_Sharp:
-    case msrQuarterTonesPitchKind::kQTP_E_SesquiSharp:
-    case msrQuarterTonesPitchKind::kQTP_E_DoubleSharp:
-    case msrQuarterTonesPitchKind::kQTP_E_TripleSharp:
-      result = msrDiatonicPitchKind::kDiatonicPitchE;
-      break;
-
-    case msrQuarterTonesPitchKind::kQTP_F_TripleFlat:
-    case msrQuarterTonesPitchKind::kQTP_F_DoubleFlat:
-    case msrQuarterTonesPitchKind::kQTP_F_SesquiFlat:
-    case msrQuarterTonesPitchKind::kQTP_F_Flat:
-    case msrQuarterTonesPitchKind::kQTP_F_SemiFlat:
-    case msrQuarterTonesPitchKind::kQTP_F_Natural:
-    case msrQuarterTonesPitchKind::kQTP_F_SemiSharp:
-    case msrQuarterTonesPitchKind::kQTP_F_Sharp:
-    case msrQuarterTonesPitchKind::kQTP_F_SesquiSharp:
-    case msrQuarterTonesPitchKind::kQTP_F_DoubleSharp:
-    case msrQuarterTonesPitchKind::kQTP_F_TripleSharp:
-      result = msrDiatonicPitchKind::kDiatonicPitchF;
-      break;
-
-    case msrQuarterTonesPitchKind::kQTP_G_TripleFlat:
-    case msrQuarterTonesPitchKind::kQTP_G_DoubleFlat:
-    case msrQuarterTonesPitchKind::kQTP_G_SesquiFlat:
-    case msrQuarterTonesPitchKind::kQTP_G_Flat:
-    case msrQuarterTonesPitchKind::kQTP_G_SemiFlat:
-    case msrQuarterTonesPitchKind::kQTP_G_Natural:
-    case msrQuarterTonesPitchKind::kQTP_G_SemiSharp:
-    case msrQuarterTonesPitchKind::kQTP_G_Sharp:
-    case msrQuarterTonesPitchKind::kQTP_G_SesquiSharp:
-    case msrQuarterTonesPitchKind::kQTP_G_DoubleSharp:
-    case msrQuarterTonesPitchKind::kQTP_G_TripleSharp:
-      result = msrDiatonicPitchKind::kDiatonicPitchG;
-      break;
-
-    case msrQuarterTonesPitchKind::kQTP_Rest:
-      {
-        std::stringstream ss;
-
-        ss <<
-          "cannot get the diatonic pitch of a rest"
-          ", line: " << inputLineNumber;
-
-#ifdef MF_MAINTAINANCE_RUNS_ARE_ENABLED
-        if (gWaeOahGroup->getMaintainanceRun ()) { // MAINTAINANCE_RUN
-          msrInternalError (
-            gServiceRunData->getInputSourceName (),
-            inputLineNumber,
-            __FILE__, mfInputLineNumber (__LINE__),
-            ss.str ());
-        }
-#endif // MF_MAINTAINANCE_RUNS_ARE_ENABLED
-      }
-      break;
-
-    case msrQuarterTonesPitchKind::kQTP_Skip:
-      {
-        std::stringstream ss;
-
-        ss <<
-          "cannot get the diatonic pitch of a skip"
-          ", line: " << inputLineNumber;
-
-#ifdef MF_MAINTAINANCE_RUNS_ARE_ENABLED
-        if (gWaeOahGroup->getMaintainanceRun ()) { // MAINTAINANCE_RUN
-          msrInternalError (
-            gServiceRunData->getInputSourceName (),
-            inputLineNumber,
-            __FILE__, mfInputLineNumber (__LINE__),
-            ss.str ());
-        }
-#endif // MF_MAINTAINANCE_RUNS_ARE_ENABLED
-      }
-      break;
-
-    case msrQuarterTonesPitchKind::kQTP_UNKNOWN_:
-      {
-        result = msrDiatonicPitchKind::kDiatonicPitch_UNKNOWN_;
-
-        /* JMI
-        std::stringstream ss;
-
-        ss <<
-          "cannot get the diatonic pitch of a msrQuarterTonesPitchKind::kQTP_UNKNOWN_"
-          ", line: " << inputLineNumber;
-
-        msrInternalError (
-          gServiceRunData->getInputSourceName (),
-          inputLineNumber,
-          __FILE__, mfInputLineNumber (__LINE__),
-          ss.str ());
-          */
-      }
-      break;
-  } // switch
-
-  return result;
-}
+  msrQuarterTonesPitchKind
+                          fQuarterTonesPitchKindsFromSemiTonesPitchKinds
+                            [K_MSR_SEMI_TONES_PITCH_KINDS_NUMBER];
+  msrSemiTonesPitchKind   fSemiTonesPitchKindsFromQuarterTonesPitchKinds
+                            [K_MSR_QUARTER_TONES_PITCH_KINDS_NUMBER];
+};
 
-msrAlterationKind alterationKindFromQuarterTonesPitchKind (
-  const mfInputLineNumber& inputLineNumber,
-  msrQuarterTonesPitchKind quarterTonesPitchKind)
+constexpr msrPitchKindsConversionsTables createPitchKindsConversionsTables ()
 {
-  msrAlterationKind result = msrAlterationKind::kAlteration_UNKNOWN_;
-
-  switch (quarterTonesPitchKind) {
-    case msrQuarterTonesPitchKind::kQTP_A_TripleFlat:
-    case msrQuarterTonesPitchKind::kQTP_B_TripleFlat:
-    case msrQuarterTonesPitchKind::kQTP_C_TripleFlat:
-    case msrQuarterTonesPitchKind::kQTP_D_TripleFlat:
-    case msrQuarterTonesPitchKind::kQTP_E_TripleFlat:
-    case msrQuarterTonesPitchKind::kQTP_F_TripleFlat:
-    case msrQuarterTonesPitchKind::kQTP_G_TripleFlat:
-      result = msrAlterationKind::kAlterationTripleFlat;
-      break;
-
-    case msrQuarterTonesPitchKind::kQTP_A_DoubleFlat:
-    case msrQuarterTonesPitchKind::kQTP_B_DoubleFlat:
-    case msrQuarterTonesPitchKind::kQTP_C_DoubleFlat:
-    case msrQuarterTonesPitchKind::kQTP_D_DoubleFlat:
-    case msrQuarterTonesPitchKind::kQTP_E_DoubleFlat:
-    case msrQuarterTonesPitchKind::kQTP_F_DoubleFlat:
-    case msrQuarterTonesPitchKind::kQTP_G_DoubleFlat:
-      result = msrAlterationKind::kAlterationDoubleFlat;
-      break;
-
-    case msrQuarterTonesPitchKind::kQTP_A_SesquiFlat:
-    case msrQuarterTonesPitchKind::kQTP_B_SesquiFlat:
-    case msrQuarterTonesPitchKind::kQTP_C_SesquiFlat:
-    case msrQuarterTonesPitchKind::kQTP_D_SesquiFlat:
-    case msrQuarterTonesPitchKind::kQTP_E_SesquiFlat:
-    case msrQuarterTonesPitchKind::kQTP_F_SesquiFlat:
-    case msrQuarterTonesPitchKind::kQTP_G_SesquiFlat:
-      result = msrAlterationKind::kAlterationSesquiFlat;
-      break;
-
-    case msrQuarterTonesPitchKind::kQTP_A_Flat:
-    case msrQuarterTonesPitchKind::kQTP_B_Flat:
-    case msrQuarterTonesPitchKind::kQTP_C_Flat:
-    case msrQuarterTonesPitchKind::kQTP_D_Flat:
-    case msrQuarterTonesPitchKind::kQTP_E_Flat:
-    case msrQuarterTonesPitchKind::kQTP_F_Flat:
-    case msrQuarterTonesPitchKind::kQTP_G_Flat:
-      result = msrAlterationKind::kAlterationFlat;
-      break;
-
-    case msrQuarterTonesPitchKind::kQTP_A_SemiFlat:
-    case msrQuarterTonesPitchKind::kQTP_B_SemiFlat:
-    case msrQuarterTonesPitchKind::kQTP_C_SemiFlat:
-    case msrQuarterTonesPitchKind::kQTP_D_SemiFlat:
-    case msrQuarterTonesPitchKind::kQTP_E_SemiFlat:
-    case msrQuarterTonesPitchKind::kQTP_F_SemiFlat:
-    case msrQuarterTonesPitchKind::kQTP_G_SemiFlat:
-      result = msrAlterationKind::kAlterationSemiFlat;
-      break;
+  // the alterations of the semitones pitches of a given diatonic pitch
+  constexpr msrAlterationKind kSemiTonesPitchesAlterationKinds [] = {
+    msrAlterationKind::kAlterationTripleFlat,
+    msrAlterationKind::kAlterationDoubleFlat,
+    msrAlterationKind::kAlterationFlat,
+    msrAlterationKind::kAlterationNatural,
+    msrAlterationKind::kAlterationSharp,
+    msrAlterationKind::kAlterationDoubleSharp,
+    msrAlterationKind::kAlterationTripleSharp
+  };
+
+  constexpr size_t
+    kSemiTonesPitchesAlterationsNumber =
+      std::size (kSemiTonesPitchesAlterationKinds),
+    kQuarterTonesPitchesAlterationsNumber =
+      K_MSR_ALTERATION_KINDS_NUMBER - 1;
+
+  // the UNKNOWN_ and 'no pitch' values are 0
+  msrPitchKindsConversionsTables result {};
+
+  for (
+    size_t diatonicPitch = size_t (msrDiatonicPitchKind::kDiatonicPitchC);
+    diatonicPitch < K_MSR_DIATONIC_PITCH_KINDS_NUMBER;
+    ++diatonicPitch
+  ) {
+    // A and B come first in msrQuarterTonesPitchKind
+    size_t
+      quarterTonesPitchesBase =
+        size_t (msrQuarterTonesPitchKind::kQTP_A_TripleFlat)
+          +
+        ((diatonicPitch + 1) % 7) * kQuarterTonesPitchesAlterationsNumber,
+      semiTonesPitchesBase =
+        size_t (msrSemiTonesPitchKind::kSTP_C_TripleFlat)
+          +
+        (diatonicPitch - 1) * kSemiTonesPitchesAlterationsNumber;
 
-    case msrQuarterTonesPitchKind::kQTP_A_Natural:
-    case msrQuarterTonesPitchKind::kQTP_B_Natural:
-    case msrQuarterTonesPitchKind::kQTP_C_Natural:
-    case msrQuarterTonesPitchKind::kQTP_D_Natural:
-    case msrQuarterTonesPitchKind::kQTP_E_Natural:
-    case msrQuarterTonesPitchKind::kQTP_F_Natural:
-    case msrQuarterTonesPitchKind::kQTP_G_Natural:
-      result = msrAlterationKind::kAlterationNatural;
-      break;
+    for (
+      size_t alteration = size_t (msrAlterationKind::kAlterationTripleFlat);
+      alteration < K_MSR_ALTERATION_KINDS_NUMBER;
+      ++alteration
+    ) {
+      size_t
+        quarterTonesPitch =
+          quarterTonesPitchesBase + alteration - 1;
+
+      result.fQuarterTonesPitchKindsFromDiatonicPitchAndAlteration
+        [diatonicPitch] [alteration] =
+          msrQuarterTonesPitchKind (quarterTonesPitch);
+
+      result.fDiatonicPitchKindsFromQuarterTonesPitchKinds
+        [quarterTonesPitch] =
+          msrDiatonicPitchKind (diatonicPitch);
+      result.fAlterationKindsFromQuarterTonesPitchKinds
+        [quarterTonesPitch] =
+          msrAlterationKind (alteration);
+    } // for
 
-    case msrQuarterTonesPitchKind::kQTP_A_SemiSharp:
-    case msrQuarterTonesPitchKind::kQTP_B_SemiSharp:
-    case msrQuarterTonesPitchKind::kQTP_C_SemiSharp:
-    case msrQuarterTonesPitchKind::kQTP_D_SemiSharp:
-    case msrQuarterTonesPitchKind::kQTP_E_SemiSharp:
-    case msrQuarterTonesPitchKind::kQTP_F_SemiSharp:
-    case msrQuarterTonesPitchKind::kQTP_G_SemiSharp:
-      result = msrAlterationKind::kAlterationSemiSharp;
-      break;
+    for (size_t i = 0; i < kSemiTonesPitchesAlterationsNumber; ++i) {
+      msrAlterationKind
+        alterationKind =
+          kSemiTonesPitchesAlterationKinds [i];
 
-    case msrQuarterTonesPitchKind::kQTP_A_Sharp:
-    case msrQuarterTonesPitchKind::kQTP_B_Sharp:
-    case msrQuarterTonesPitchKind::kQTP_C_Sharp:
-    case msrQuarterTonesPitchKind::kQTP_D_Sharp:
-    case msrQuarterTonesPitchKind::kQTP_E_Sharp:
-    case msrQuarterTonesPitchKind::kQTP_F_Sharp:
-    case msrQuarterTonesPitchKind::kQTP_G_Sharp:
-      result = msrAlterationKind::kAlterationSharp;
-      break;
+      size_t
+        semiTonesPitch =
+          semiTonesPitchesBase + i,
+        quarterTonesPitch =
+          quarterTonesPitchesBase + size_t (alterationKind) - 1;
 
-    case msrQuarterTonesPitchKind::kQTP_A_SesquiSharp:
-    case msrQuarterTonesPitchKind::kQTP_B_SesquiSharp:
-    case msrQuarterTonesPitchKind::kQTP_C_SesquiSharp:
-    case msrQuarterTonesPitchKind::kQTP_D_SesquiSharp:
-    case msrQuarterTonesPitchKind::kQTP_E_SesquiSharp:
-    case msrQuarterTonesPitchKind::kQTP_F_SesquiSharp:
-    case msrQuarterTonesPitchKind::kQTP_G_SesquiSharp:
-      result = msrAlterationKind::kAlterationSesquiSharp;
-      break;
+      result.fQuarterTonesPitchKindsFromSemiTonesPitchKinds
+        [semiTonesPitch] =
+          msrQuarterTonesPitchKind (quarterTonesPitch);
 
-    case msrQuarterTonesPitchKind::kQTP_A_DoubleSharp:
-    case msrQuarterTonesPitchKind::kQTP_B_DoubleSharp:
-    case msrQuarterTonesPitchKind::kQTP_C_DoubleSharp:
-    case msrQuarterTonesPitchKind::kQTP_D_DoubleSharp:
-    case msrQuarterTonesPitchKind::kQTP_E_DoubleSharp:
-    case msrQuarterTonesPitchKind::kQTP_F_DoubleSharp:
-    case msrQuarterTonesPitchKind::kQTP_G_DoubleSharp:
-      result = msrAlterationKind::kAlterationDoubleSharp;
-      break;
+      // only the flat, natural and sharp quarter tones pitches
+      // are converted to semitones pitches
+      switch (alterationKind) {
+        case msrAlterationKind::kAlterationFlat:
+        case msrAlterationKind::kAlterationNatural:
+        case msrAlterationKind::kAlterationSharp:
+          result.fSemiTonesPitchKindsFromQuarterTonesPitchKinds
+            [quarterTonesPitch] =
+              msrSemiTonesPitchKind (semiTonesPitch);
+          break;
+        default:
+          ;
+      } // switch
+    } // for
+  } // for
 
-    case msrQuarterTonesPitchKind::kQTP_A_TripleSharp:
-    case msrQuarterTonesPitchKind::kQTP_B_TripleSharp:
-    case msrQuarterTonesPitchKind::kQTP_C_TripleSharp:
-    case msrQuarterTonesPitchKind::kQTP_D_TripleSharp:
-    case msrQuarterTonesPitchKind::kQTP_E_TripleSharp:
-    case msrQuarterTonesPitchKind::kQTP_F_TripleSharp:
-    case msrQuarterTonesPitchKind::kQTP_G_TripleSharp:
-      result = msrAlterationKind::kAlterationTripleSharp;
-      break;
+  return result;
+}
 
-    case msrQuarterTonesPitchKind::kQTP_Rest:
-      {
-        std::stringstream ss;
+constexpr msrPitchKindsConversionsTables
+  kPitchKindsConversionsTables =
+    createPitchKindsConversionsTables ();
+
+static_assert (
+  kPitchKindsConversionsTables.
+    fQuarterTonesPitchKindsFromDiatonicPitchAndAlteration
+      [size_t (msrDiatonicPitchKind::kDiatonicPitchC)]
+      [size_t (msrAlterationKind::kAlterationSesquiFlat)]
+    ==
+  msrQuarterTonesPitchKind::kQTP_C_SesquiFlat
+    &&
+  kPitchKindsConversionsTables.
+    fQuarterTonesPitchKindsFromDiatonicPitchAndAlteration
+      [size_t (msrDiatonicPitchKind::kDiatonicPitchB)]
+      [size_t (msrAlterationKind::kAlterationTripleSharp)]
+    ==
+  msrQuarterTonesPitchKind::kQTP_B_TripleSharp,
+  "msrQuarterTonesPitchKind should list the alterations of A to G in msrAlterationKind order");
+
+static_assert (
+  kPitchKindsConversionsTables.
+    fQuarterTonesPitchKindsFromSemiTonesPitchKinds
+      [size_t (msrSemiTonesPitchKind::kSTP_F_DoubleleFlat)]
+    ==
+  msrQuarterTonesPitchKind::kQTP_F_DoubleFlat
+    &&
+  kPitchKindsConversionsTables.
+    fSemiTonesPitchKindsFromQuarterTonesPitchKinds
+      [size_t (msrQuarterTonesPitchKind::kQTP_G_Sharp)]
+    ==
+  msrSemiTonesPitchKind::kSTP_G_Sharp,
+  "msrSemiTonesPitchKind should list the alterations of C to B from triple flat to triple sharp");
 
-        ss <<
-          "cannot get the alteration kind of a rest"
-          ", line: " << inputLineNumber;
+// quarter tones pitches
+//______________________________________________________________________________
+msrQuarterTonesPitchKind quarterTonesPitchKindFromDiatonicPitchAndAlteration (
+  const mfInputLineNumber& inputLineNumber,
+  msrDiatonicPitchKind diatonicPitchKind,
+  msrAlterationKind    alterationKind)
+{
+  if (
+    alterationKind == msrAlterationKind::kAlteration_UNKNOWN_
+      &&
+    diatonicPitchKind != msrDiatonicPitchKind::kDiatonicPitch_UNKNOWN_
+  ) {
+    std::stringstream ss;
+
+    ss <<
+      '\'' << msrDiatonicPitchKindAsString (diatonicPitchKind) <<
+      "' alteration has not been set"
+      ", line: " << inputLineNumber;
+
+    msrInternalError (
+      gServiceRunData->getInputSourceName (),
+      inputLineNumber,
+      __FILE__, mfInputLineNumber (__LINE__),
+      ss.str ());
+  }
 
-#ifdef MF_MAINTAINANCE_RUNS_ARE_ENABLED
-        if (gWaeOahGroup->getMaintainanceRun ()) { // MAINTAINANCE_RUN
-          msrInternalError (
-            gServiceRunData->getInputSourceName (),
-            inputLineNumber,
-            __FILE__, mfInputLineNumber (__LINE__),
-            ss.str ());
-        }
-#endif // MF_MAINTAINANCE_RUNS_ARE_ENABLED
-      }
-      break;
+  // the UNKNOWN_ diatonic pitch and alteration lead to kQTP_UNKNOWN_
+  return
+    kPitchKindsConversionsTables.
+      fQuarterTonesPitchKindsFromDiatonicPitchAndAlteration
+        [size_t (diatonicPitchKind)]
+        [size_t (alterationKind)];
+}
 
+msrDiatonicPitchKind diatonicPitchKindFromQuarterTonesPitchKind (
+  const mfInputLineNumber& inputLineNumber,
+  msrQuarterTonesPitchKind quarterTonesPitchKind)
+{
+#ifdef MF_MAINTAINANCE_RUNS_ARE_ENABLED
+  switch (quarterTonesPitchKind) {
+    case msrQuarterTonesPitchKind::kQTP_Rest:
     case msrQuarterTonesPitchKind::kQTP_Skip:
-      {
+      if (gWaeOahGroup->getMaintainanceRun ()) { // MAINTAINANCE_RUN
         std::stringstream ss;
 
         ss <<
-          "cannot get the alteration kind of a skip"
+          "cannot get the diatonic pitch of a " <<
+          (quarterTonesPitchKind == msrQuarterTonesPitchKind::kQTP_Rest
+            ? "rest"
+            : "skip") <<
           ", line: " << inputLineNumber;
 
-#ifdef MF_MAINTAINANCE_RUNS_ARE_ENABLED
-      if (gWaeOahGroup->getMaintainanceRun ()) { // MAINTAINANCE_RUN
         msrInternalError (
           gServiceRunData->getInputSourceName (),
           inputLineNumber,
           __FILE__, mfInputLineNumber (__LINE__),
           ss.str ());
       }
-#endif // MF_MAINTAINANCE_RUNS_ARE_ENABLED
-      }
       break;
+    default:
+      ;
+  } // switch
+#endif // MF_MAINTAINANCE_RUNS_ARE_ENABLED
 
-    case msrQuarterTonesPitchKind::kQTP_UNKNOWN_:
-      {
-        result = msrAlterationKind::kAlteration_UNKNOWN_;
+  // kQTP_UNKNOWN_, kQTP_Rest and kQTP_Skip lead to kDiatonicPitch_UNKNOWN_
+  return
+    kPitchKindsConversionsTables.
+      fDiatonicPitchKindsFromQuarterTonesPitchKinds
+        [size_t (quarterTonesPitchKind)];
+}
 
-        /* JMI
+msrAlterationKind alterationKindFromQuarterTonesPitchKind (
+  const mfInputLineNumber& inputLineNumber,
+  msrQuarterTonesPitchKind quarterTonesPitchKind)
+{
+#ifdef MF_MAINTAINANCE_RUNS_ARE_ENABLED
+  switch (quarterTonesPitchKind) {
+    case msrQuarterTonesPitchKind::kQTP_Rest:
+    case msrQuarterTonesPitchKind::kQTP_Skip:
+      if (gWaeOahGroup->getMaintainanceRun ()) { // MAINTAINANCE_RUN
         std::stringstream ss;
 
         ss <<
-          "cannot get the diatonic pitch of a msrQuarterTonesPitchKind::kQTP_UNKNOWN_"
+          "cannot get the alteration kind of a " <<
+          (quarterTonesPitchKind == msrQuarterTonesPitchKind::kQTP_Rest
+            ? "rest"
+            : "skip") <<
           ", line: " << inputLineNumber;
 
         msrInternalError (
@@ -2284,268 +1791,38 @@ msrAlterationKind alterationKindFromQuarterTonesPitchKind (
           inputLineNumber,
           __FILE__, mfInputLineNumber (__LINE__),
           ss.str ());
-          */
       }
+      break;
+    default:
+      ;
   } // switch
+#endif // MF_MAINTAINANCE_RUNS_ARE_ENABLED
 
-  return result;
+  // kQTP_UNKNOWN_, kQTP_Rest and kQTP_Skip lead to kAlteration_UNKNOWN_
+  return
+    kPitchKindsConversionsTables.
+      fAlterationKindsFromQuarterTonesPitchKinds
+        [size_t (quarterTonesPitchKind)];
 }
 
 msrQuarterTonesPitchKind quarterTonesPitchKindFromSemiTonesPitchKind (
   msrSemiTonesPitchKind semiTonesPitchKind)
 {
-  msrQuarterTonesPitchKind result = msrQuarterTonesPitchKind::kQTP_UNKNOWN_;
-
-  switch (semiTonesPitchKind) {
-    case msrSemiTonesPitchKind::kSTP_NoSemiTonesPitch:
-      break;
-
-    case msrSemiTonesPitchKind::kSTP_C_TripleFlat:
-      result = msrQuarterTonesPitchKind::kQTP_C_TripleFlat;
-      break;
-    case msrSemiTonesPitchKind::kSTP_C_DoubleFlat:
-      result = msrQuarterTonesPitchKind::kQTP_C_DoubleFlat;
-      break;
-    case msrSemiTonesPitchKind::kSTP_C_Flat:
-      result = msrQuarterTonesPitchKind::kQTP_C_Flat;
-      break;
-    case msrSemiTonesPitchKind::kSTP_C_Natural:
-      result = msrQuarterTonesPitchKind::kQTP_C_Natural;
-      break;
-    case msrSemiTonesPitchKind::kSTP_C_Sharp:
-      result = msrQuarterTonesPitchKind::kQTP_C_Sharp;
-      break;
-    case msrSemiTonesPitchKind::kSTP_C_DoubleSharp:
-      result = msrQuarterTonesPitchKind::kQTP_C_DoubleSharp;
-      break;
-    case msrSemiTonesPitchKind::kSTP_C_TripleSharp:
-      result = msrQuarterTonesPitchKind::kQTP_C_TripleSharp;
-      break;
-
-    case msrSemiTonesPitchKind::kSTP_D_TripleFlat:
-      result = msrQuarterTonesPitchKind::kQTP_D_TripleFlat;
-      break;
-    case msrSemiTonesPitchKind::kSTP_D_DoubleFlat:
-      result = msrQuarterTonesPitchKind::kQTP_D_DoubleFlat;
-      break;
-    case msrSemiTonesPitchKind::kSTP_D_Flat:
-      result = msrQuarterTonesPitchKind::kQTP_D_Flat;
-      break;
-    case msrSemiTonesPitchKind::kSTP_D_Natural:
-      result = msrQuarterTonesPitchKind::kQTP_D_Natural;
-      break;
-    case msrSemiTonesPitchKind::kSTP_D_Sharp:
-      result = msrQuarterTonesPitchKind::kQTP_D_Sharp;
-      break;
-    case msrSemiTonesPitchKind::kSTP_D_DoubleSharp:
-      result = msrQuarterTonesPitchKind::kQTP_D_DoubleSharp;
-      break;
-    case msrSemiTonesPitchKind::kSTP_D_TripleSharp:
-      result = msrQuarterTonesPitchKind::kQTP_D_TripleSharp;
-      break;
-
-    case msrSemiTonesPitchKind::kSTP_E_TripleFlat:
-      result = msrQuarterTonesPitchKind::kQTP_E_TripleFlat;
-      break;
-    case msrSemiTonesPitchKind::kSTP_E_DoubleFlat:
-      result = msrQuarterTonesPitchKind::kQTP_E_DoubleFlat;
-      break;
-    case msrSemiTonesPitchKind::kSTP_E_Flat:
-      result = msrQuarterTonesPitchKind::kQTP_E_Flat;
-      break;
-    case msrSemiTonesPitchKind::kSTP_E_Natural:
-      result = msrQuarterTonesPitchKind::kQTP_E_Natural;
-      break;
-    case msrSemiTonesPitchKind::kSTP_E_Sharp:
-      result = msrQuarterTonesPitchKind::kQTP_E_Sharp;
-      break;
-    case msrSemiTonesPitchKind::kSTP_E_DoubleSharp:
-      result = msrQuarterTonesPitchKind::kQTP_E_DoubleSharp;
-      break;
-    case msrSemiTonesPitchKind::kSTP_E_TripleSharp:
-      result = msrQuarterTonesPitchKind::kQTP_E_TripleSharp;
-      break;
-
-    case msrSemiTonesPitchKind::kSTP_F_TripleFlat:
-      result = msrQuarterTonesPitchKind::kQTP_F_TripleFlat;
-      break;
-    case msrSemiTonesPitchKind::kSTP_F_DoubleleFlat:
-      result = msrQuarterTonesPitchKind::kQTP_F_DoubleFlat;
-      break;
-    case msrSemiTonesPitchKind::kSTP_F_Flat:
-      result = msrQuarterTonesPitchKind::kQTP_F_Flat;
-      break;
-    case msrSemiTonesPitchKind::kSTP_F_Natural:
-      result = msrQuarterTonesPitchKind::kQTP_F_Natural;
-      break;
-    case msrSemiTonesPitchKind::kSTP_F_Sharp:
-      result = msrQuarterTonesPitchKind::kQTP_F_Sharp;
-      break;
-    case msrSemiTonesPitchKind::kSTP_F_DoubleSharp:
-      result = msrQuarterTonesPitchKind::kQTP_F_DoubleSharp;
-      break;
-    case msrSemiTonesPitchKind::kSTP_F_TripleSharp:
-      result = msrQuarterTonesPitchKind::kQTP_F_TripleSharp;
-      break;
-
-    case msrSemiTonesPitchKind::kSTP_G_TripleFlat:
-      result = msrQuarterTonesPitchKind::kQTP_G_TripleFlat;
-      break;
-    case msrSemiTonesPitchKind::kSTP_G_DoubleFlat:
-      result = msrQuarterTonesPitchKind::kQTP_G_DoubleFlat;
-      break;
-    case msrSemiTonesPitchKind::kSTP_G_Flat:
-      result = msrQuarterTonesPitchKind::kQTP_G_Flat;
-      break;
-    case msrSemiTonesPitchKind::kSTP_G_Natural:
-      result = msrQuarterTonesPitchKind::kQTP_G_Natural;
-      break;
-    case msrSemiTonesPitchKind::kSTP_G_Sharp:
-      result = msrQuarterTonesPitchKind::kQTP_G_Sharp;
-      break;
-    case msrSemiTonesPitchKind::kSTP_G_DoubleSharp:
-      result = msrQuarterTonesPitchKind::kQTP_G_DoubleSharp;
-      break;
-    case msrSemiTonesPitchKind::kSTP_G_TripleSharp:
-      result = msrQuarterTonesPitchKind::kQTP_G_TripleSharp;
-      break;
-
-    case msrSemiTonesPitchKind::kSTP_A_TripleFlat:
-      result = msrQuarterTonesPitchKind::kQTP_A_TripleFlat;
-      break;
-    case msrSemiTonesPitchKind::kSTP_A_DoubleFlat:
-      result = msrQuarterTonesPitchKind::kQTP_A_DoubleFlat;
-      break;
-    case msrSemiTonesPitchKind::kSTP_A_Flat:
-      result = msrQuarterTonesPitchKind::kQTP_A_Flat;
-      break;
-    case msrSemiTonesPitchKind::kSTP_A_Natural:
-      result = msrQuarterTonesPitchKind::kQTP_A_Natural;
-      break;
-    case msrSemiTonesPitchKind::kSTP_A_Sharp:
-      result = msrQuarterTonesPitchKind::kQTP_A_Sharp;
-      break;
-    case msrSemiTonesPitchKind::kSTP_A_DoubleSharp:
-      result = msrQuarterTonesPitchKind::kQTP_A_DoubleSharp;
-      break;
-    case msrSemiTonesPitchKind::kSTP_A_TripleSharp:
-      result = msrQuarterTonesPitchKind::kQTP_A_TripleSharp;
-      break;
-
-    case msrSemiTonesPitchKind::kSTP_B_TripleFlat:
-      result = msrQuarterTonesPitchKind::kQTP_B_TripleFlat;
-      break;
-    case msrSemiTonesPitchKind::kSTP_B_DoubleFlat:
-      result = msrQuarterTonesPitchKind::kQTP_B_DoubleFlat;
-      break;
-    case msrSemiTonesPitchKind::kSTP_B_Flat:
-      result = msrQuarterTonesPitchKind::kQTP_B_Flat;
-      break;
-    case msrSemiTonesPitchKind::kSTP_B_Natural:
-      result = msrQuarterTonesPitchKind::kQTP_B_Natural;
-      break;
-    case msrSemiTonesPitchKind::kSTP_B_Sharp:
-      result = msrQuarterTonesPitchKind::kQTP_B_Sharp;
-      break;
-    case msrSemiTonesPitchKind::kSTP_B_DoubleSharp:
-      result = msrQuarterTonesPitchKind::kQTP_B_DoubleSharp;
-      break;
-    case msrSemiTonesPitchKind::kSTP_B_TripleSharp:
-      result = msrQuarterTonesPitchKind::kQTP_B_TripleSharp;
-      break;
-  } // switch
-
-  return result;
+  return
+    kPitchKindsConversionsTables.
+      fQuarterTonesPitchKindsFromSemiTonesPitchKinds
+        [size_t (semiTonesPitchKind)];
 }
 
 msrSemiTonesPitchKind semiTonesPitchKindFromQuarterTonesPitchKind (
   msrQuarterTonesPitchKind quarterTonesPitchKind)
 {
-  msrSemiTonesPitchKind result = msrSemiTonesPitchKind::kSTP_NoSemiTonesPitch;
-
-    switch (quarterTonesPitchKind) {
-      case msrQuarterTonesPitchKind::kQTP_UNKNOWN_:
-        break;
-
-      case msrQuarterTonesPitchKind::kQTP_Rest:
-      case msrQuarterTonesPitchKind::kQTP_Skip:
-        break;
-
-      case msrQuarterTonesPitchKind::kQTP_A_Flat:
-        result = msrSemiTonesPitchKind::kSTP_A_Flat;
-        break;
-      case msrQuarterTonesPitchKind::kQTP_A_Natural:
-        result = msrSemiTonesPitchKind::kSTP_A_Natural;
-        break;
-      case msrQuarterTonesPitchKind::kQTP_A_Sharp:
-        result = msrSemiTonesPitchKind::kSTP_A_Sharp;
-        break;
-
-      case msrQuarterTonesPitchKind::kQTP_B_Flat:
-        result = msrSemiTonesPitchKind::kSTP_B_Flat;
-        break;
-      case msrQuarterTonesPitchKind::kQTP_B_Natural:
-        result = msrSemiTonesPitchKind::kSTP_B_Natural;
-        break;
-      case msrQuarterTonesPitchKind::kQTP_B_Sharp:
-        result = msrSemiTonesPitchKind::kSTP_B_Sharp;
-        break;
-
-      case msrQuarterTonesPitchKind::kQTP_C_Flat:
-        result = msrSemiTonesPitchKind::kSTP_C_Flat;
-        break;
-      case msrQuarterTonesPitchKind::kQTP_C_Natural:
-        result = msrSemiTonesPitchKind::kSTP_C_Natural;
-        break;
-      case msrQuarterTonesPitchKind::kQTP_C_Sharp:
-        result = msrSemiTonesPitchKind::kSTP_C_Sharp;
-        break;
-
-      case msrQuarterTonesPitchKind::kQTP_D_Flat:
-        result = msrSemiTonesPitchKind::kSTP_D_Flat;
-        break;
-      case msrQuarterTonesPitchKind::kQTP_D_Natural:
-        result = msrSemiTonesPitchKind::kSTP_D_Natural;
-        break;
-      case msrQuarterTonesPitchKind::kQTP_D_Sharp:
-        result = msrSemiTonesPitchKind::kSTP_D_Sharp;
-        break;
-
-      case msrQuarterTonesPitchKind::kQTP_E_Flat:
-        result = msrSemiTonesPitchKind::kSTP_E_Flat;
-        break;
-      case msrQuarterTonesPitchKind::kQTP_E_Natural:
-        result = msrSemiTonesPitchKind::kSTP_E_Natural;
-        break;
-      case msrQuarterTonesPitchKind::kQTP_E_Sharp:
-        result = msrSemiTonesPitchKind::kSTP_E_Sharp;
-        break;
-
-      case msrQuarterTonesPitchKind::kQTP_F_Flat:
-        result = msrSemiTonesPitchKind::kSTP_F_Flat;
-        break;
-      case msrQuarterTonesPitchKind::kQTP_F_Natural:
-        result = msrSemiTonesPitchKind::kSTP_F_Natural;
-        break;
-      case msrQuarterTonesPitchKind::kQTP_F_Sharp:
-        result = msrSemiTonesPitchKind::kSTP_F_Sharp;
-        break;
-
-      case msrQuarterTonesPitchKind::kQTP_G_Flat:
-        result = msrSemiTonesPitchKind::kSTP_G_Flat;
-        break;
-      case msrQuarterTonesPitchKind::kQTP_G_Natural:
-        result = msrSemiTonesPitchKind::kSTP_G_Natural;
-        break;
-      case msrQuarterTonesPitchKind::kQTP_G_Sharp:
-        result = msrSemiTonesPitchKind::kSTP_G_Sharp;
-        break;
-
-      default:
-        ;
-    } // switch
-
-  return result;
+  // the quarter tones pitches other than flat, natural and sharp
+  // lead to kSTP_NoSemiTonesPitch
+  return
+    kPitchKindsConversionsTables.
+      fSemiTonesPitchKindsFromQuarterTonesPitchKinds
+        [size_t (quarterTonesPitchKind)];
 }
 
 std::string availableMsrQuarterTonesPitchesLanguageKinds (
@@ -132,7 +132,7 @@ void msrRehearsalMark::acceptIn (basevisitor* v)
 
   if (visitor<S_msrRehearsalMark>*
     p =
-      dynamic_cast<visitor<S_msrRehearsalMark>*> (v)) {
+      visitor<S_msrRehearsalMark>::cast (v)) {
         S_msrRehearsalMark elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -168,7 +168,7 @@ void msrRehearsalMark::acceptOut (basevisitor* v)
 
   if (visitor<S_msrRehearsalMark>*
     p =
-      dynamic_cast<visitor<S_msrRehearsalMark>*> (v)) {
+      visitor<S_msrRehearsalMark>::cast (v)) {
         S_msrRehearsalMark elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -193,7 +193,7 @@ void msrRepeatCoda::acceptIn (basevisitor* v)
 
   if (visitor<S_msrRepeatCoda>*
     p =
-      dynamic_cast<visitor<S_msrRepeatCoda>*> (v)) {
+      visitor<S_msrRepeatCoda>::cast (v)) {
         S_msrRepeatCoda elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -229,7 +229,7 @@ void msrRepeatCoda::acceptOut (basevisitor* v)
 
   if (visitor<S_msrRepeatCoda>*
     p =
-      dynamic_cast<visitor<S_msrRepeatCoda>*> (v)) {
+      visitor<S_msrRepeatCoda>::cast (v)) {
         S_msrRepeatCoda elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
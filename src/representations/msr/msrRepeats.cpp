@@ -351,7 +351,7 @@ void msrRepeatCommonPart::acceptIn (basevisitor* v)
 
   if (visitor<S_msrRepeatCommonPart>*
     p =
-      dynamic_cast<visitor<S_msrRepeatCommonPart>*> (v)) {
+      visitor<S_msrRepeatCommonPart>::cast (v)) {
         S_msrRepeatCommonPart elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -387,7 +387,7 @@ void msrRepeatCommonPart::acceptOut (basevisitor* v)
 
   if (visitor<S_msrRepeatCommonPart>*
     p =
-      dynamic_cast<visitor<S_msrRepeatCommonPart>*> (v)) {
+      visitor<S_msrRepeatCommonPart>::cast (v)) {
         S_msrRepeatCommonPart elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -788,7 +788,7 @@ void msrRepeatEnding::acceptIn (basevisitor* v)
 
   if (visitor<S_msrRepeatEnding>*
     p =
-      dynamic_cast<visitor<S_msrRepeatEnding>*> (v)) {
+      visitor<S_msrRepeatEnding>::cast (v)) {
         S_msrRepeatEnding elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -824,7 +824,7 @@ void msrRepeatEnding::acceptOut (basevisitor* v)
 
   if (visitor<S_msrRepeatEnding>*
     p =
-      dynamic_cast<visitor<S_msrRepeatEnding>*> (v)) {
+      visitor<S_msrRepeatEnding>::cast (v)) {
         S_msrRepeatEnding elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -1747,7 +1747,7 @@ void msrRepeat::acceptIn (basevisitor* v)
 
   if (visitor<S_msrRepeat>*
     p =
-      dynamic_cast<visitor<S_msrRepeat>*> (v)) {
+      visitor<S_msrRepeat>::cast (v)) {
         S_msrRepeat elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -1783,7 +1783,7 @@ void msrRepeat::acceptOut (basevisitor* v)
 
   if (visitor<S_msrRepeat>*
     p =
-      dynamic_cast<visitor<S_msrRepeat>*> (v)) {
+      visitor<S_msrRepeat>::cast (v)) {
         S_msrRepeat elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -197,7 +197,7 @@ void msrScaling::acceptIn (basevisitor* v)
 
   if (visitor<S_msrScaling>*
     p =
-      dynamic_cast<visitor<S_msrScaling>*> (v)) {
+      visitor<S_msrScaling>::cast (v)) {
         S_msrScaling elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -233,7 +233,7 @@ void msrScaling::acceptOut (basevisitor* v)
 
   if (visitor<S_msrScaling>*
     p =
-      dynamic_cast<visitor<S_msrScaling>*> (v)) {
+      visitor<S_msrScaling>::cast (v)) {
         S_msrScaling elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -431,7 +431,7 @@ void msrScore::acceptIn (basevisitor* v)
 
   if (visitor<S_msrScore>*
     p =
-      dynamic_cast<visitor<S_msrScore>*> (v)) {
+      visitor<S_msrScore>::cast (v)) {
         S_msrScore elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -467,7 +467,7 @@ void msrScore::acceptOut (basevisitor* v)
 
   if (visitor<S_msrScore>*
     p =
-      dynamic_cast<visitor<S_msrScore>*> (v)) {
+      visitor<S_msrScore>::cast (v)) {
         S_msrScore elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
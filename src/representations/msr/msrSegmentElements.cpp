@@ -98,7 +98,7 @@ void msrSegmentElement::acceptIn (basevisitor* v)
 
   if (visitor<S_msrSegmentElement>*
     p =
-      dynamic_cast<visitor<S_msrSegmentElement>*> (v)) {
+      visitor<S_msrSegmentElement>::cast (v)) {
         S_msrSegmentElement elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -134,7 +134,7 @@ void msrSegmentElement::acceptOut (basevisitor* v)
 
   if (visitor<S_msrSegmentElement>*
     p =
-      dynamic_cast<visitor<S_msrSegmentElement>*> (v)) {
+      visitor<S_msrSegmentElement>::cast (v)) {
         S_msrSegmentElement elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -3154,7 +3154,7 @@ void msrSegment::acceptIn (basevisitor* v)
 
   if (visitor<S_msrSegment>*
     p =
-      dynamic_cast<visitor<S_msrSegment>*> (v)) {
+      visitor<S_msrSegment>::cast (v)) {
         S_msrSegment elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -3190,7 +3190,7 @@ void msrSegment::acceptOut (basevisitor* v)
 
   if (visitor<S_msrSegment>*
     p =
-      dynamic_cast<visitor<S_msrSegment>*> (v)) {
+      visitor<S_msrSegment>::cast (v)) {
         S_msrSegment elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
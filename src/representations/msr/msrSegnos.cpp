@@ -149,7 +149,7 @@ void msrSegno::acceptIn (basevisitor* v)
 
   if (visitor<S_msrSegno>*
     p =
-      dynamic_cast<visitor<S_msrSegno>*> (v)) {
+      visitor<S_msrSegno>::cast (v)) {
         S_msrSegno elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -185,7 +185,7 @@ void msrSegno::acceptOut (basevisitor* v)
 
   if (visitor<S_msrSegno>*
     p =
-      dynamic_cast<visitor<S_msrSegno>*> (v)) {
+      visitor<S_msrSegno>::cast (v)) {
         S_msrSegno elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -336,7 +336,7 @@ void msrDalSegno::acceptIn (basevisitor* v)
 
   if (visitor<S_msrDalSegno>*
     p =
-      dynamic_cast<visitor<S_msrDalSegno>*> (v)) {
+      visitor<S_msrDalSegno>::cast (v)) {
         S_msrDalSegno elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -372,7 +372,7 @@ void msrDalSegno::acceptOut (basevisitor* v)
 
   if (visitor<S_msrDalSegno>*
     p =
-      dynamic_cast<visitor<S_msrDalSegno>*> (v)) {
+      visitor<S_msrDalSegno>::cast (v)) {
         S_msrDalSegno elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -77,7 +77,7 @@ void msrSingleTremolo::acceptIn (basevisitor* v)
 
   if (visitor<S_msrSingleTremolo>*
     p =
-      dynamic_cast<visitor<S_msrSingleTremolo>*> (v)) {
+      visitor<S_msrSingleTremolo>::cast (v)) {
         S_msrSingleTremolo elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -113,7 +113,7 @@ void msrSingleTremolo::acceptOut (basevisitor* v)
 
   if (visitor<S_msrSingleTremolo>*
     p =
-      dynamic_cast<visitor<S_msrSingleTremolo>*> (v)) {
+      visitor<S_msrSingleTremolo>::cast (v)) {
         S_msrSingleTremolo elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -187,7 +187,7 @@ void msrSlash::acceptIn (basevisitor* v)
 
   if (visitor<S_msrSlash>*
     p =
-      dynamic_cast<visitor<S_msrSlash>*> (v)) {
+      visitor<S_msrSlash>::cast (v)) {
         S_msrSlash elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -223,7 +223,7 @@ void msrSlash::acceptOut (basevisitor* v)
 
   if (visitor<S_msrSlash>*
     p =
-      dynamic_cast<visitor<S_msrSlash>*> (v)) {
+      visitor<S_msrSlash>::cast (v)) {
         S_msrSlash elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -138,7 +138,7 @@ void msrSlide::acceptIn (basevisitor* v)
 
   if (visitor<S_msrSlide>*
     p =
-      dynamic_cast<visitor<S_msrSlide>*> (v)) {
+      visitor<S_msrSlide>::cast (v)) {
         S_msrSlide elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -174,7 +174,7 @@ void msrSlide::acceptOut (basevisitor* v)
 
   if (visitor<S_msrSlide>*
     p =
-      dynamic_cast<visitor<S_msrSlide>*> (v)) {
+      visitor<S_msrSlide>::cast (v)) {
         S_msrSlide elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -151,7 +151,7 @@ void msrSlur::acceptIn (basevisitor* v)
 
   if (visitor<S_msrSlur>*
     p =
-      dynamic_cast<visitor<S_msrSlur>*> (v)) {
+      visitor<S_msrSlur>::cast (v)) {
         S_msrSlur elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -187,7 +187,7 @@ void msrSlur::acceptOut (basevisitor* v)
 
   if (visitor<S_msrSlur>*
     p =
-      dynamic_cast<visitor<S_msrSlur>*> (v)) {
+      visitor<S_msrSlur>::cast (v)) {
         S_msrSlur elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
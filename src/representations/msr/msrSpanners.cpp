@@ -137,7 +137,7 @@ void msrSpanner::acceptIn (basevisitor* v)
 
   if (visitor<S_msrSpanner>*
     p =
-      dynamic_cast<visitor<S_msrSpanner>*> (v)) {
+      visitor<S_msrSpanner>::cast (v)) {
         S_msrSpanner elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -173,7 +173,7 @@ void msrSpanner::acceptOut (basevisitor* v)
 
   if (visitor<S_msrSpanner>*
     p =
-      dynamic_cast<visitor<S_msrSpanner>*> (v)) {
+      visitor<S_msrSpanner>::cast (v)) {
         S_msrSpanner elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
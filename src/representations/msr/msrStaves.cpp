@@ -3410,7 +3410,7 @@ void msrStaff::acceptIn (basevisitor* v)
 
   if (visitor<S_msrStaff>*
     p =
-      dynamic_cast<visitor<S_msrStaff>*> (v)) {
+      visitor<S_msrStaff>::cast (v)) {
         S_msrStaff elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -3446,7 +3446,7 @@ void msrStaff::acceptOut (basevisitor* v)
 
   if (visitor<S_msrStaff>*
     p =
-      dynamic_cast<visitor<S_msrStaff>*> (v)) {
+      visitor<S_msrStaff>::cast (v)) {
         S_msrStaff elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -193,7 +193,7 @@ void msrStaffTuning::acceptIn (basevisitor* v)
 
   if (visitor<S_msrStaffTuning>*
     p =
-      dynamic_cast<visitor<S_msrStaffTuning>*> (v)) {
+      visitor<S_msrStaffTuning>::cast (v)) {
         S_msrStaffTuning elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -229,7 +229,7 @@ void msrStaffTuning::acceptOut (basevisitor* v)
 
   if (visitor<S_msrStaffTuning>*
     p =
-      dynamic_cast<visitor<S_msrStaffTuning>*> (v)) {
+      visitor<S_msrStaffTuning>::cast (v)) {
         S_msrStaffTuning elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -423,7 +423,7 @@ void msrStaffDetails::acceptIn (basevisitor* v)
 
   if (visitor<S_msrStaffDetails>*
     p =
-      dynamic_cast<visitor<S_msrStaffDetails>*> (v)) {
+      visitor<S_msrStaffDetails>::cast (v)) {
         S_msrStaffDetails elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -459,7 +459,7 @@ void msrStaffDetails::acceptOut (basevisitor* v)
 
   if (visitor<S_msrStaffDetails>*
     p =
-      dynamic_cast<visitor<S_msrStaffDetails>*> (v)) {
+      visitor<S_msrStaffDetails>::cast (v)) {
         S_msrStaffDetails elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
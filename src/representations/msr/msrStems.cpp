@@ -99,7 +99,7 @@ void msrStem::acceptIn (basevisitor* v)
 
   if (visitor<S_msrStem>*
     p =
-      dynamic_cast<visitor<S_msrStem>*> (v)) {
+      visitor<S_msrStem>::cast (v)) {
         S_msrStem elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -135,7 +135,7 @@ void msrStem::acceptOut (basevisitor* v)
 
   if (visitor<S_msrStem>*
     p =
-      dynamic_cast<visitor<S_msrStem>*> (v)) {
+      visitor<S_msrStem>::cast (v)) {
         S_msrStem elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
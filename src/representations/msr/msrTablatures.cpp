@@ -149,7 +149,7 @@ void msrFrameNote::acceptIn (basevisitor* v)
 
   if (visitor<S_msrFrameNote>*
     p =
-      dynamic_cast<visitor<S_msrFrameNote>*> (v)) {
+      visitor<S_msrFrameNote>::cast (v)) {
         S_msrFrameNote elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -185,7 +185,7 @@ void msrFrameNote::acceptOut (basevisitor* v)
 
   if (visitor<S_msrFrameNote>*
     p =
-      dynamic_cast<visitor<S_msrFrameNote>*> (v)) {
+      visitor<S_msrFrameNote>::cast (v)) {
         S_msrFrameNote elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -415,7 +415,7 @@ void msrFrame::acceptIn (basevisitor* v)
 
   if (visitor<S_msrFrame>*
     p =
-      dynamic_cast<visitor<S_msrFrame>*> (v)) {
+      visitor<S_msrFrame>::cast (v)) {
         S_msrFrame elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -451,7 +451,7 @@ void msrFrame::acceptOut (basevisitor* v)
 
   if (visitor<S_msrFrame>*
     p =
-      dynamic_cast<visitor<S_msrFrame>*> (v)) {
+      visitor<S_msrFrame>::cast (v)) {
         S_msrFrame elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -243,7 +243,7 @@ void msrTechnical::acceptIn (basevisitor* v)
 
   if (visitor<S_msrTechnical>*
     p =
-      dynamic_cast<visitor<S_msrTechnical>*> (v)) {
+      visitor<S_msrTechnical>::cast (v)) {
         S_msrTechnical elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -279,7 +279,7 @@ void msrTechnical::acceptOut (basevisitor* v)
 
   if (visitor<S_msrTechnical>*
     p =
-      dynamic_cast<visitor<S_msrTechnical>*> (v)) {
+      visitor<S_msrTechnical>::cast (v)) {
         S_msrTechnical elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -381,7 +381,7 @@ void msrTechnicalWithInteger::acceptIn (basevisitor* v)
 
   if (visitor<S_msrTechnicalWithInteger>*
     p =
-      dynamic_cast<visitor<S_msrTechnicalWithInteger>*> (v)) {
+      visitor<S_msrTechnicalWithInteger>::cast (v)) {
         S_msrTechnicalWithInteger elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -417,7 +417,7 @@ void msrTechnicalWithInteger::acceptOut (basevisitor* v)
 
   if (visitor<S_msrTechnicalWithInteger>*
     p =
-      dynamic_cast<visitor<S_msrTechnicalWithInteger>*> (v)) {
+      visitor<S_msrTechnicalWithInteger>::cast (v)) {
         S_msrTechnicalWithInteger elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -542,7 +542,7 @@ void msrTechnicalWithFloat::acceptIn (basevisitor* v)
 
   if (visitor<S_msrTechnicalWithFloat>*
     p =
-      dynamic_cast<visitor<S_msrTechnicalWithFloat>*> (v)) {
+      visitor<S_msrTechnicalWithFloat>::cast (v)) {
         S_msrTechnicalWithFloat elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -578,7 +578,7 @@ void msrTechnicalWithFloat::acceptOut (basevisitor* v)
 
   if (visitor<S_msrTechnicalWithFloat>*
     p =
-      dynamic_cast<visitor<S_msrTechnicalWithFloat>*> (v)) {
+      visitor<S_msrTechnicalWithFloat>::cast (v)) {
         S_msrTechnicalWithFloat elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -709,7 +709,7 @@ void msrTechnicalWithString::acceptIn (basevisitor* v)
 
   if (visitor<S_msrTechnicalWithString>*
     p =
-      dynamic_cast<visitor<S_msrTechnicalWithString>*> (v)) {
+      visitor<S_msrTechnicalWithString>::cast (v)) {
         S_msrTechnicalWithString elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -745,7 +745,7 @@ void msrTechnicalWithString::acceptOut (basevisitor* v)
 
   if (visitor<S_msrTechnicalWithString>*
     p =
-      dynamic_cast<visitor<S_msrTechnicalWithString>*> (v)) {
+      visitor<S_msrTechnicalWithString>::cast (v)) {
         S_msrTechnicalWithString elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
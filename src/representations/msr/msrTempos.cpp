@@ -91,7 +91,7 @@ void msrTempoNote::acceptIn (basevisitor* v)
 
   if (visitor<S_msrTempoNote>*
     p =
-      dynamic_cast<visitor<S_msrTempoNote>*> (v)) {
+      visitor<S_msrTempoNote>::cast (v)) {
         S_msrTempoNote elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -127,7 +127,7 @@ void msrTempoNote::acceptOut (basevisitor* v)
 
   if (visitor<S_msrTempoNote>*
     p =
-      dynamic_cast<visitor<S_msrTempoNote>*> (v)) {
+      visitor<S_msrTempoNote>::cast (v)) {
         S_msrTempoNote elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -598,7 +598,7 @@ void msrTempoTuplet::acceptIn (basevisitor* v)
 
   if (visitor<S_msrTempoTuplet>*
     p =
-      dynamic_cast<visitor<S_msrTempoTuplet>*> (v)) {
+      visitor<S_msrTempoTuplet>::cast (v)) {
         S_msrTempoTuplet elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -634,7 +634,7 @@ void msrTempoTuplet::acceptOut (basevisitor* v)
 
   if (visitor<S_msrTempoTuplet>*
     p =
-      dynamic_cast<visitor<S_msrTempoTuplet>*> (v)) {
+      visitor<S_msrTempoTuplet>::cast (v)) {
         S_msrTempoTuplet elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -936,7 +936,7 @@ void msrTempoNotesRelationshipElements::acceptIn (basevisitor* v)
 
   if (visitor<S_msrTempoNotesRelationshipElements>*
     p =
-      dynamic_cast<visitor<S_msrTempoNotesRelationshipElements>*> (v)) {
+      visitor<S_msrTempoNotesRelationshipElements>::cast (v)) {
         S_msrTempoNotesRelationshipElements elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -972,7 +972,7 @@ void msrTempoNotesRelationshipElements::acceptOut (basevisitor* v)
 
   if (visitor<S_msrTempoNotesRelationshipElements>*
     p =
-      dynamic_cast<visitor<S_msrTempoNotesRelationshipElements>*> (v)) {
+      visitor<S_msrTempoNotesRelationshipElements>::cast (v)) {
         S_msrTempoNotesRelationshipElements elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -1431,7 +1431,7 @@ void msrTempo::acceptIn (basevisitor* v)
 
   if (visitor<S_msrTempo>*
     p =
-      dynamic_cast<visitor<S_msrTempo>*> (v)) {
+      visitor<S_msrTempo>::cast (v)) {
         S_msrTempo elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -1467,7 +1467,7 @@ void msrTempo::acceptOut (basevisitor* v)
 
   if (visitor<S_msrTempo>*
     p =
-      dynamic_cast<visitor<S_msrTempo>*> (v)) {
+      visitor<S_msrTempo>::cast (v)) {
         S_msrTempo elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -118,7 +118,7 @@ void msrTie::acceptIn (basevisitor* v)
 
   if (visitor<S_msrTie>*
     p =
-      dynamic_cast<visitor<S_msrTie>*> (v)) {
+      visitor<S_msrTie>::cast (v)) {
         S_msrTie elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -154,7 +154,7 @@ void msrTie::acceptOut (basevisitor* v)
 
   if (visitor<S_msrTie>*
     p =
-      dynamic_cast<visitor<S_msrTie>*> (v)) {
+      visitor<S_msrTie>::cast (v)) {
         S_msrTie elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -291,7 +291,7 @@ void msrTimeSignatureItem::acceptIn (basevisitor* v)
 
   if (visitor<S_msrTimeSignatureItem>*
     p =
-      dynamic_cast<visitor<S_msrTimeSignatureItem>*> (v)) {
+      visitor<S_msrTimeSignatureItem>::cast (v)) {
         S_msrTimeSignatureItem elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -327,7 +327,7 @@ void msrTimeSignatureItem::acceptOut (basevisitor* v)
 
   if (visitor<S_msrTimeSignatureItem>*
     p =
-      dynamic_cast<visitor<S_msrTimeSignatureItem>*> (v)) {
+      visitor<S_msrTimeSignatureItem>::cast (v)) {
         S_msrTimeSignatureItem elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -1195,7 +1195,7 @@ void msrTimeSignature::acceptIn (basevisitor* v)
 
   if (visitor<S_msrTimeSignature>*
     p =
-      dynamic_cast<visitor<S_msrTimeSignature>*> (v)) {
+      visitor<S_msrTimeSignature>::cast (v)) {
         S_msrTimeSignature elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -1231,7 +1231,7 @@ void msrTimeSignature::acceptOut (basevisitor* v)
 
   if (visitor<S_msrTimeSignature>*
     p =
-      dynamic_cast<visitor<S_msrTimeSignature>*> (v)) {
+      visitor<S_msrTimeSignature>::cast (v)) {
         S_msrTimeSignature elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -173,7 +173,7 @@ void msrTransposition::acceptIn (basevisitor* v)
 
   if (visitor<S_msrTransposition>*
     p =
-      dynamic_cast<visitor<S_msrTransposition>*> (v)) {
+      visitor<S_msrTransposition>::cast (v)) {
         S_msrTransposition elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -209,7 +209,7 @@ void msrTransposition::acceptOut (basevisitor* v)
 
   if (visitor<S_msrTransposition>*
     p =
-      dynamic_cast<visitor<S_msrTransposition>*> (v)) {
+      visitor<S_msrTransposition>::cast (v)) {
         S_msrTransposition elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
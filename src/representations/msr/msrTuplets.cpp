@@ -931,7 +931,7 @@ void msrTuplet::acceptIn (basevisitor* v)
 
   if (visitor<S_msrTuplet>*
     p =
-      dynamic_cast<visitor<S_msrTuplet>*> (v)) {
+      visitor<S_msrTuplet>::cast (v)) {
         S_msrTuplet elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -967,7 +967,7 @@ void msrTuplet::acceptOut (basevisitor* v)
 
   if (visitor<S_msrTuplet>*
     p =
-      dynamic_cast<visitor<S_msrTuplet>*> (v)) {
+      visitor<S_msrTuplet>::cast (v)) {
         S_msrTuplet elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -136,7 +136,7 @@ void msrVoiceStaffChange::acceptIn (basevisitor* v)
 
   if (visitor<S_msrVoiceStaffChange>*
     p =
-      dynamic_cast<visitor<S_msrVoiceStaffChange>*> (v)) {
+      visitor<S_msrVoiceStaffChange>::cast (v)) {
         S_msrVoiceStaffChange elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -172,7 +172,7 @@ void msrVoiceStaffChange::acceptOut (basevisitor* v)
 
   if (visitor<S_msrVoiceStaffChange>*
     p =
-      dynamic_cast<visitor<S_msrVoiceStaffChange>*> (v)) {
+      visitor<S_msrVoiceStaffChange>::cast (v)) {
         S_msrVoiceStaffChange elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -11451,7 +11451,7 @@ void msrVoice::acceptIn (basevisitor* v)
 
   if (visitor<S_msrVoice>*
     p =
-      dynamic_cast<visitor<S_msrVoice>*> (v)) {
+      visitor<S_msrVoice>::cast (v)) {
         S_msrVoice elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -11487,7 +11487,7 @@ void msrVoice::acceptOut (basevisitor* v)
 
   if (visitor<S_msrVoice>*
     p =
-      dynamic_cast<visitor<S_msrVoice>*> (v)) {
+      visitor<S_msrVoice>::cast (v)) {
         S_msrVoice elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -110,7 +110,7 @@ void msrWords::acceptIn (basevisitor* v)
 
   if (visitor<S_msrWords>*
     p =
-      dynamic_cast<visitor<S_msrWords>*> (v)) {
+      visitor<S_msrWords>::cast (v)) {
         S_msrWords elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -146,7 +146,7 @@ void msrWords::acceptOut (basevisitor* v)
 
   if (visitor<S_msrWords>*
     p =
-      dynamic_cast<visitor<S_msrWords>*> (v)) {
+      visitor<S_msrWords>::cast (v)) {
         S_msrWords elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
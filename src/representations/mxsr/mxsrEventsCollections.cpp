@@ -467,10 +467,13 @@ void mxsrEventsCollection::registerStaffChangeTakeOff (
   }
 #endif // MF_TRACE_IS_ENABLED
 
-  fStaffChangeTakeOffsMap.insert (
-    std::make_pair (
-      noteSequentialNumber,
-      staffChangeEvent));
+  fStaffChangeTakeOffsVector.insert (
+    noteSequentialNumber.getBareValue (),
+    staffChangeEvent);
+
+  registerNoteEventKind (
+    noteSequentialNumber,
+    kStaffChangeTakeOffBit);
 
   fStaffChangeEventsList.push_back (staffChangeEvent);
 
@@ -521,10 +524,13 @@ void mxsrEventsCollection::registerStaffChangeLanding (
   }
 #endif // MF_TRACE_IS_ENABLED
 
-  fStaffChangeLandingsMap.insert (
-    std::make_pair (
-      noteSequentialNumber,
-      staffChangeEvent));
+  fStaffChangeLandingsVector.insert (
+    noteSequentialNumber.getBareValue (),
+    staffChangeEvent);
+
+  registerNoteEventKind (
+    noteSequentialNumber,
+    kStaffChangeLandingBit);
 
   fStaffChangeEventsList.push_back (staffChangeEvent);
 
@@ -568,10 +574,13 @@ void mxsrEventsCollection::registerGraceBegin (
   }
 #endif // MF_TRACE_IS_ENABLED
 
-  fGraceBeginsMap.insert (
-    std::make_pair (
-      noteSequentialNumber,
-      graceEvent));
+  fGraceBeginsVector.insert (
+    noteSequentialNumber.getBareValue (),
+    graceEvent);
+
+  registerNoteEventKind (
+    noteSequentialNumber,
+    kGraceBeginBit);
 
   fAllEventsList.push_back (graceEvent);
 }
@@ -612,10 +621,13 @@ void mxsrEventsCollection::registerGraceEnd (
   }
 #endif // MF_TRACE_IS_ENABLED
 
-  fGraceEndsMap.insert (
-    std::make_pair (
-      noteSequentialNumber,
-      graceEvent));
+  fGraceEndsVector.insert (
+    noteSequentialNumber.getBareValue (),
+    graceEvent);
+
+  registerNoteEventKind (
+    noteSequentialNumber,
+    kGraceEndBit);
 
   fAllEventsList.push_back (graceEvent);
 }
@@ -678,11 +690,13 @@ void mxsrEventsCollection::registerCueBeginEvent (
   }
 #endif // MF_TRACE_IS_ENABLED
 
-  fCueBeginsMap.insert (
-    std::make_pair (
-//       cueBeginEvent->getNoteSequentialNumber ().getBareValue (),
-      cueBeginEvent->getNoteSequentialNumber (),
-      cueBeginEvent));
+  fCueBeginsVector.insert (
+    cueBeginEvent->getNoteSequentialNumber ().getBareValue (),
+    cueBeginEvent);
+
+  registerNoteEventKind (
+    cueBeginEvent->getNoteSequentialNumber (),
+    kCueBeginBit);
 
   fAllEventsList.push_back (cueBeginEvent);
 }
@@ -744,11 +758,13 @@ void mxsrEventsCollection::registerCueEndEvent (
   }
 #endif // MF_TRACE_IS_ENABLED
 
-  fCueEndsMap.insert (
-    std::make_pair (
-//       cueEndEvent->getNoteSequentialNumber ().getBareValue (),
-      cueEndEvent->getNoteSequentialNumber (),
-      cueEndEvent));
+  fCueEndsVector.insert (
+    cueEndEvent->getNoteSequentialNumber ().getBareValue (),
+    cueEndEvent);
+
+  registerNoteEventKind (
+    cueEndEvent->getNoteSequentialNumber (),
+    kCueEndBit);
 
   fAllEventsList.push_back (cueEndEvent);
 }
@@ -811,11 +827,13 @@ void mxsrEventsCollection::registerChordBeginEvent (
   }
 #endif // MF_TRACE_IS_ENABLED
 
-  fChordBeginsMap.insert (
-    std::make_pair (
-//       cueEndEchordBeginEventvent->getNoteSequentialNumber ().getBareValue (),
-      chordBeginEvent->getNoteSequentialNumber (),
-      chordBeginEvent));
+  fChordBeginsVector.insert (
+    chordBeginEvent->getNoteSequentialNumber ().getBareValue (),
+    chordBeginEvent);
+
+  registerNoteEventKind (
+    chordBeginEvent->getNoteSequentialNumber (),
+    kChordBeginBit);
 
   fAllEventsList.push_back (chordBeginEvent);
 }
@@ -877,10 +895,13 @@ void mxsrEventsCollection::registerChordEndEvent (
   }
 #endif // MF_TRACE_IS_ENABLED
 
-  fChordEndsMap.insert (
-    std::make_pair (
-      chordEndEvent->getNoteSequentialNumber (),
-      chordEndEvent));
+  fChordEndsVector.insert (
+    chordEndEvent->getNoteSequentialNumber ().getBareValue (),
+    chordEndEvent);
+
+  registerNoteEventKind (
+    chordEndEvent->getNoteSequentialNumber (),
+    kChordEndBit);
 
   fAllEventsList.push_back (chordEndEvent);
 }
@@ -990,10 +1011,13 @@ void mxsrEventsCollection::registerTupletBeginEvent (
   }
 #endif // MF_TRACE_IS_ENABLED
 
-  fTupletBeginsMultiMap.insert (
-    std::make_pair (
-      tupletBeginEvent->getNoteSequentialNumber (),
-      tupletBeginEvent));
+  fTupletBeginsVector.insertMulti (
+    tupletBeginEvent->getNoteSequentialNumber ().getBareValue (),
+    tupletBeginEvent);
+
+  registerNoteEventKind (
+    tupletBeginEvent->getNoteSequentialNumber (),
+    kTupletBeginBit);
 
   fTupletBeginNumbersMap.insert (
     std::make_pair (
@@ -1021,10 +1045,13 @@ void mxsrEventsCollection::registerTupletEndEvent (
   }
 #endif // MF_TRACE_IS_ENABLED
 
-  fTupletEndsMultiMap.insert (
-    std::make_pair (
-      tupletEndEvent->getNoteSequentialNumber (),
-      tupletEndEvent));
+  fTupletEndsVector.insertMulti (
+    tupletEndEvent->getNoteSequentialNumber ().getBareValue (),
+    tupletEndEvent);
+
+  registerNoteEventKind (
+    tupletEndEvent->getNoteSequentialNumber (),
+    kTupletEndBit);
 
   fTupletEndNumbersMap.insert (
     std::make_pair (
@@ -1034,6 +1061,25 @@ void mxsrEventsCollection::registerTupletEndEvent (
   fAllEventsList.push_back (tupletEndEvent);
 }
 
+//________________________________________________________________________
+void mxsrEventsCollection::registerNoteEventKind (
+  const mxsrNoteSequentialNumber& noteSequentialNumber,
+  unsigned int                    noteEventKindBit)
+{
+  int
+    noteSequentialBareNumber =
+      noteSequentialNumber.getBareValue ();
+
+  if (noteSequentialBareNumber >= 0) {
+    if (noteSequentialBareNumber >= (int) fNoteEventKindsVector.size ()) {
+      fNoteEventKindsVector.resize (
+        noteSequentialBareNumber + 1);
+    }
+
+    fNoteEventKindsVector [noteSequentialBareNumber] |= noteEventKindBit;
+  }
+}
+
 //________________________________________________________________________
 void mxsrEventsCollection::sortTheMxsrEventsLists ()
 {
@@ -1130,132 +1176,92 @@ S_mxsrMeasureRepeatEvent mxsrEventsCollection::fetchMeasureRepeatEndAtMeasureNum
 S_mxsrStaffChangeEvent mxsrEventsCollection::fetchStaffChangeTakeOffAtNoteSequentialNumber (
   int noteSequentialNumber) const
 {
-  S_mxsrStaffChangeEvent result;
-
-  std::map <mxsrNoteSequentialNumber, S_mxsrStaffChangeEvent>::const_iterator it;
-
-  it = fStaffChangeTakeOffsMap.find (noteSequentialNumber);
-
-  if (it != fStaffChangeTakeOffsMap.end ()) {
-    result = (*it).second;
+  if (! noteMayHaveEventKind (noteSequentialNumber, kStaffChangeTakeOffBit)) {
+    return S_mxsrStaffChangeEvent ();
   }
 
-  return result;
+  return
+    fStaffChangeTakeOffsVector.find (noteSequentialNumber);
 }
 
 S_mxsrStaffChangeEvent mxsrEventsCollection::fetchStaffChangeLandingAtNoteSequentialNumber (
   int noteSequentialNumber) const
 {
-  S_mxsrStaffChangeEvent result;
-
-  std::map <mxsrNoteSequentialNumber, S_mxsrStaffChangeEvent>::const_iterator it;
-
-  it = fStaffChangeLandingsMap.find (noteSequentialNumber);
-
-  if (it != fStaffChangeLandingsMap.end ()) {
-    result = (*it).second;
+  if (! noteMayHaveEventKind (noteSequentialNumber, kStaffChangeLandingBit)) {
+    return S_mxsrStaffChangeEvent ();
   }
 
-  return result;
+  return
+    fStaffChangeLandingsVector.find (noteSequentialNumber);
 }
 
 //________________________________________________________________________
 S_mxsrGraceEvent mxsrEventsCollection::fetchGraceBeginAtNoteSequentialNumber (
   int noteSequentialNumber) const
 {
-  S_mxsrGraceEvent result;
-
-  std::map <mxsrNoteSequentialNumber, S_mxsrGraceEvent>::const_iterator it;
-
-  it = fGraceBeginsMap.find (noteSequentialNumber);
-
-  if (it != fGraceBeginsMap.end ()) {
-    result = (*it).second;
+  if (! noteMayHaveEventKind (noteSequentialNumber, kGraceBeginBit)) {
+    return S_mxsrGraceEvent ();
   }
 
-  return result;
+  return
+    fGraceBeginsVector.find (noteSequentialNumber);
 }
 
 S_mxsrGraceEvent mxsrEventsCollection::fetchGraceEndAtNoteSequentialNumber (
   int noteSequentialNumber) const
 {
-  S_mxsrGraceEvent result;
-
-  std::map <mxsrNoteSequentialNumber, S_mxsrGraceEvent>::const_iterator it;
-
-  it = fGraceEndsMap.find (noteSequentialNumber);
-
-  if (it != fGraceEndsMap.end ()) {
-    result = (*it).second;
+  if (! noteMayHaveEventKind (noteSequentialNumber, kGraceEndBit)) {
+    return S_mxsrGraceEvent ();
   }
 
-  return result;
+  return
+    fGraceEndsVector.find (noteSequentialNumber);
 }
 
 //________________________________________________________________________
 S_mxsrCueEvent mxsrEventsCollection::fetchCueBeginAtNoteSequentialNumber (
   int noteSequentialNumber) const
 {
-  S_mxsrCueEvent result;
-
-  std::map <mxsrNoteSequentialNumber, S_mxsrCueEvent>::const_iterator it;
-
-  it = fCueBeginsMap.find (noteSequentialNumber);
-
-  if (it != fCueBeginsMap.end ()) {
-    result = (*it).second;
+  if (! noteMayHaveEventKind (noteSequentialNumber, kCueBeginBit)) {
+    return S_mxsrCueEvent ();
   }
 
-  return result;
+  return
+    fCueBeginsVector.find (noteSequentialNumber);
 }
 
 S_mxsrCueEvent mxsrEventsCollection::fetchCueEndAtNoteSequentialNumber (
   int noteSequentialNumber) const
 {
-  S_mxsrCueEvent result;
-
-  std::map <mxsrNoteSequentialNumber, S_mxsrCueEvent>::const_iterator it;
-
-  it = fCueEndsMap.find (noteSequentialNumber);
-
-  if (it != fCueEndsMap.end ()) {
-    result = (*it).second;
+  if (! noteMayHaveEventKind (noteSequentialNumber, kCueEndBit)) {
+    return S_mxsrCueEvent ();
   }
 
-  return result;
+  return
+    fCueEndsVector.find (noteSequentialNumber);
 }
 
 //________________________________________________________________________
 S_mxsrChordEvent mxsrEventsCollection::fetchChordBeginAtNoteSequentialNumber (
   int noteSequentialNumber) const
 {
-  S_mxsrChordEvent result;
-
-  std::map <mxsrNoteSequentialNumber, S_mxsrChordEvent>::const_iterator
-    it =
-      fChordBeginsMap.find (noteSequentialNumber);
-
-  if (it != fChordBeginsMap.end ()) {
-    result = (*it).second;
+  if (! noteMayHaveEventKind (noteSequentialNumber, kChordBeginBit)) {
+    return S_mxsrChordEvent ();
   }
 
-  return result;
+  return
+    fChordBeginsVector.find (noteSequentialNumber);
 }
 
 S_mxsrChordEvent mxsrEventsCollection::fetchChordEndAtNoteSequentialNumber (
   int noteSequentialNumber) const
 {
-  S_mxsrChordEvent result;
-
-  std::map <mxsrNoteSequentialNumber, S_mxsrChordEvent>::const_iterator
-    it =
-      fChordEndsMap.find (noteSequentialNumber);
-
-  if (it != fChordEndsMap.end ()) {
-    result = (*it).second;
+  if (! noteMayHaveEventKind (noteSequentialNumber, kChordEndBit)) {
+    return S_mxsrChordEvent ();
   }
 
-  return result;
+  return
+    fChordEndsVector.find (noteSequentialNumber);
 }
 
 //________________________________________________________________________
@@ -1266,7 +1272,7 @@ S_mxsrTupletEvent mxsrEventsCollection::fetchTupletBeginForTupletNumber (
 
   result = fTupletBeginNumbersMap [tupletNumber];
 
-//   for (std::pair <mxsrNoteSequentialNumber, S_mxsrTupletEvent> thePair : fTupletBeginsMultiMap) {
+//   for (std::pair <int, S_mxsrTupletEvent> thePair : fTupletBeginsVector) {
 //     S_mxsrTupletEvent
 //       tupletBeginEvent = thePair.second;
 //
@@ -1297,29 +1303,11 @@ void mxsrEventsCollection::fetchTupletBeginsAtNoteSequentialNumber (
   }
 #endif // MF_TRACE_IS_ENABLED
 
-  // see https://cplusplus.com/reference/map/multimap/equal_range/
-
-  std::pair <
-    std::multimap <mxsrNoteSequentialNumber, S_mxsrTupletEvent>::const_iterator,
-    std::multimap <mxsrNoteSequentialNumber, S_mxsrTupletEvent>::const_iterator
-  > iteratorsPair;
-
-  iteratorsPair = fTupletBeginsMultiMap.equal_range (
-    noteSequentialNumber);
-
-  for (
-    std::multimap <mxsrNoteSequentialNumber, S_mxsrTupletEvent>::const_iterator it =
-      iteratorsPair.first;
-    it != iteratorsPair.second;
-    ++it
-  ) {
-    S_mxsrTupletEvent tupletEvent = it->second;
-
-//     std::cout << "tupletEvent: " << tupletEvent << std::endl; JMI
-
-    recipientTupletBeginsList.push_back (tupletEvent);
-//     recipientTupletBeginsList.push_front (tupletEvent);
-  } // for
+  if (noteMayHaveEventKind (noteSequentialNumber, kTupletBeginBit)) {
+    fTupletBeginsVector.fetchAll (
+      noteSequentialNumber,
+      recipientTupletBeginsList);
+  }
 
 #ifdef MF_TRACE_IS_ENABLED
   if (gTraceOahGroup->getTraceTupletsBasics ()) {
@@ -1349,27 +1337,11 @@ void mxsrEventsCollection::fetchTupletEndsListAtNoteSequentialNumber (
   }
 #endif // MF_TRACE_IS_ENABLED
 
-  std::pair <
-    std::multimap <mxsrNoteSequentialNumber, S_mxsrTupletEvent>::const_iterator,
-    std::multimap <mxsrNoteSequentialNumber, S_mxsrTupletEvent>::const_iterator
-  > iteratorsPair;
-
-  iteratorsPair = fTupletEndsMultiMap.equal_range (
-    noteSequentialNumber);
-
-  for (
-    std::multimap <mxsrNoteSequentialNumber, S_mxsrTupletEvent>::const_iterator it =
-      iteratorsPair.first;
-    it != iteratorsPair.second;
-    ++it
-  ) {
-    S_mxsrTupletEvent tupletEvent = it->second;
-
-//     std::cout << "tupletEvent: " << tupletEvent << std::endl; JMI
-
-    recipientTupletEndsList.push_back (tupletEvent);
-//     recipientTupletEndsList.push_front (tupletEvent);
-  } // for
+  if (noteMayHaveEventKind (noteSequentialNumber, kTupletEndBit)) {
+    fTupletEndsVector.fetchAll (
+      noteSequentialNumber,
+      recipientTupletEndsList);
+  }
 
 #ifdef MF_TRACE_IS_ENABLED
   if (gTraceOahGroup->getTraceTupletsBasics ()) {
@@ -1388,20 +1360,20 @@ std::string mxsrEventsCollection::asShortString () const
 
   ss <<
     "[EventsCollection" <<
-    ", fStaffChangeTakeOffsMap.size (): " << fStaffChangeTakeOffsMap.size () <<
-    ", fStaffChangeLandingsMap.size (): " << fStaffChangeLandingsMap.size () <<
+    ", fStaffChangeTakeOffsVector.size (): " << fStaffChangeTakeOffsVector.size () <<
+    ", fStaffChangeLandingsVector.size (): " << fStaffChangeLandingsVector.size () <<
 
-    ", fGraceBeginsMap.size (): " << fGraceBeginsMap.size () <<
-    ", fGraceEndsMap.size (): " << fGraceEndsMap.size () <<
+    ", fGraceBeginsVector.size (): " << fGraceBeginsVector.size () <<
+    ", fGraceEndsVector.size (): " << fGraceEndsVector.size () <<
 
-    ", fCueBeginsMap.size (): " << fCueBeginsMap.size () <<
-    ", fCueEndsMap.size (): " << fCueEndsMap.size () <<
+    ", fCueBeginsVector.size (): " << fCueBeginsVector.size () <<
+    ", fCueEndsVector.size (): " << fCueEndsVector.size () <<
 
-    ", fChordBeginsMap.size (): " << fChordBeginsMap.size () <<
-    ", fChordEndsMap.size (): " << fChordEndsMap.size () <<
+    ", fChordBeginsVector.size (): " << fChordBeginsVector.size () <<
+    ", fChordEndsVector.size (): " << fChordEndsVector.size () <<
 
-    ", fTupletBeginsMultiMap.size (): " << fTupletBeginsMultiMap.size () <<
-    ", fTupletEndsMultiMap.size (): " << fTupletEndsMultiMap.size () <<
+    ", fTupletBeginsVector.size (): " << fTupletBeginsVector.size () <<
+    ", fTupletEndsVector.size (): " << fTupletEndsVector.size () <<
 
     ", fAllEventsList.size (): " << fAllEventsList.size () <<
     ']';
@@ -1627,9 +1599,9 @@ void mxsrEventsCollection::printStaffChangeEvents (std::ostream& os) const
   os << "--------" << std::endl << std::endl;
 
   os <<
-    "fStaffChangeTakeOffsMap: " <<
+    "fStaffChangeTakeOffsVector: " <<
     mfSingularOrPlural (
-      fStaffChangeTakeOffsMap.size (),
+      fStaffChangeTakeOffsVector.size (),
       "element",
       "elements") <<
     ", in note sequential number order" <<
@@ -1637,7 +1609,7 @@ void mxsrEventsCollection::printStaffChangeEvents (std::ostream& os) const
 
   ++gIndenter;
 
-  for (std::pair <mxsrNoteSequentialNumber, S_mxsrStaffChangeEvent> thePair : fStaffChangeTakeOffsMap
+  for (std::pair <int, S_mxsrStaffChangeEvent> thePair : fStaffChangeTakeOffsVector
   ) {
     mxsrNoteSequentialNumber
       eventSequentialNumber = thePair.first;
@@ -1662,9 +1634,9 @@ void mxsrEventsCollection::printStaffChangeEvents (std::ostream& os) const
   os << "--------" << std::endl << std::endl;
 
   os <<
-    "fStaffChangeLandingsMap: " <<
+    "fStaffChangeLandingsVector: " <<
     mfSingularOrPlural (
-      fStaffChangeLandingsMap.size (),
+      fStaffChangeLandingsVector.size (),
       "element",
       "elements") <<
     ", in note sequential number order" <<
@@ -1672,7 +1644,7 @@ void mxsrEventsCollection::printStaffChangeEvents (std::ostream& os) const
 
   ++gIndenter;
 
-  for (std::pair <mxsrNoteSequentialNumber, S_mxsrStaffChangeEvent> thePair : fStaffChangeLandingsMap
+  for (std::pair <int, S_mxsrStaffChangeEvent> thePair : fStaffChangeLandingsVector
   ) {
     mxsrNoteSequentialNumber
       eventSequentialNumber = thePair.first;
@@ -1699,9 +1671,9 @@ void mxsrEventsCollection::printStaffChangeEvents (std::ostream& os) const
 void mxsrEventsCollection::printGraceEvents (std::ostream& os) const
 {
   os <<
-    "fGraceBeginsMap: " <<
+    "fGraceBeginsVector: " <<
     mfSingularOrPlural (
-      fGraceBeginsMap.size (),
+      fGraceBeginsVector.size (),
       "element",
       "elements") <<
     ", in note sequential number order" <<
@@ -1709,7 +1681,7 @@ void mxsrEventsCollection::printGraceEvents (std::ostream& os) const
 
   ++gIndenter;
 
-  for (std::pair <mxsrNoteSequentialNumber, S_mxsrGraceEvent> thePair : fGraceBeginsMap) {
+  for (std::pair <int, S_mxsrGraceEvent> thePair : fGraceBeginsVector) {
     mxsrNoteSequentialNumber
       eventSequentialNumber = thePair.first;
 
@@ -1733,9 +1705,9 @@ void mxsrEventsCollection::printGraceEvents (std::ostream& os) const
   os << std::endl << "--------" << std::endl << std::endl;
 
   os <<
-    "fGraceEndsMap: " <<
+    "fGraceEndsVector: " <<
     mfSingularOrPlural (
-      fGraceEndsMap.size (),
+      fGraceEndsVector.size (),
       "element",
       "elements") <<
     ", in note sequential number order" <<
@@ -1743,7 +1715,7 @@ void mxsrEventsCollection::printGraceEvents (std::ostream& os) const
 
   ++gIndenter;
 
-  for (std::pair <mxsrNoteSequentialNumber, S_mxsrGraceEvent> thePair : fGraceEndsMap) {
+  for (std::pair <int, S_mxsrGraceEvent> thePair : fGraceEndsVector) {
     mxsrNoteSequentialNumber
       eventSequentialNumber = thePair.first;
 
@@ -1769,9 +1741,9 @@ void mxsrEventsCollection::printGraceEvents (std::ostream& os) const
 void mxsrEventsCollection::printCueEvents (std::ostream& os) const
 {
   os <<
-    "fCueBeginsMap: " <<
+    "fCueBeginsVector: " <<
     mfSingularOrPlural (
-      fCueBeginsMap.size (),
+      fCueBeginsVector.size (),
       "element",
       "elements") <<
     ", in note sequential number order" <<
@@ -1779,7 +1751,7 @@ void mxsrEventsCollection::printCueEvents (std::ostream& os) const
 
   ++gIndenter;
 
-  for (std::pair <mxsrNoteSequentialNumber, S_mxsrCueEvent> thePair : fCueBeginsMap) {
+  for (std::pair <int, S_mxsrCueEvent> thePair : fCueBeginsVector) {
     mxsrNoteSequentialNumber
       eventSequentialNumber = thePair.first;
 
@@ -1803,9 +1775,9 @@ void mxsrEventsCollection::printCueEvents (std::ostream& os) const
   os << std::endl << "--------" << std::endl << std::endl;
 
   os <<
-    "fCueEndsMap: " <<
+    "fCueEndsVector: " <<
     mfSingularOrPlural (
-      fCueEndsMap.size (),
+      fCueEndsVector.size (),
       "element",
       "elements") <<
     ", in note sequential number order" <<
@@ -1813,7 +1785,7 @@ void mxsrEventsCollection::printCueEvents (std::ostream& os) const
 
   ++gIndenter;
 
-  for (std::pair <mxsrNoteSequentialNumber, S_mxsrCueEvent> thePair : fCueEndsMap) {
+  for (std::pair <int, S_mxsrCueEvent> thePair : fCueEndsVector) {
     mxsrNoteSequentialNumber
       eventSequentialNumber = thePair.first;
 
@@ -1840,9 +1812,9 @@ void mxsrEventsCollection::printCueEvents (std::ostream& os) const
 void mxsrEventsCollection::printChordEvents (std::ostream& os) const
 {
   os <<
-    "fChordBeginsMap: " <<
+    "fChordBeginsVector: " <<
     mfSingularOrPlural (
-      fChordBeginsMap.size (),
+      fChordBeginsVector.size (),
       "element",
       "elements") <<
     ", in note sequential number order" <<
@@ -1850,7 +1822,7 @@ void mxsrEventsCollection::printChordEvents (std::ostream& os) const
 
   ++gIndenter;
 
-  for (std::pair <mxsrNoteSequentialNumber, S_mxsrChordEvent> thePair : fChordBeginsMap) {
+  for (std::pair <int, S_mxsrChordEvent> thePair : fChordBeginsVector) {
     mxsrNoteSequentialNumber
       eventSequentialNumber = thePair.first;
 
@@ -1874,9 +1846,9 @@ void mxsrEventsCollection::printChordEvents (std::ostream& os) const
   os << std::endl << "--------" << std::endl << std::endl;
 
   os <<
-    "fChordEndsMap: " <<
+    "fChordEndsVector: " <<
     mfSingularOrPlural (
-      fChordEndsMap.size (),
+      fChordEndsVector.size (),
       "element",
       "elements") <<
     ", in note sequential number order" <<
@@ -1884,7 +1856,7 @@ void mxsrEventsCollection::printChordEvents (std::ostream& os) const
 
   ++gIndenter;
 
-  for (std::pair <mxsrNoteSequentialNumber, S_mxsrChordEvent> thePair : fChordEndsMap) {
+  for (std::pair <int, S_mxsrChordEvent> thePair : fChordEndsVector) {
     mxsrNoteSequentialNumber
       eventSequentialNumber = thePair.first;
 
@@ -1911,9 +1883,9 @@ void mxsrEventsCollection::printChordEvents (std::ostream& os) const
 void mxsrEventsCollection::printTupletEvents (std::ostream& os) const
 {
   os <<
-    "fTupletBeginsMultiMap: " <<
+    "fTupletBeginsVector: " <<
     mfSingularOrPlural (
-      fTupletBeginsMultiMap.size (),
+      fTupletBeginsVector.size (),
       "element",
       "elements") <<
     ", in note sequential number order" <<
@@ -1921,7 +1893,7 @@ void mxsrEventsCollection::printTupletEvents (std::ostream& os) const
 
   ++gIndenter;
 
-  for (std::pair <mxsrNoteSequentialNumber, S_mxsrTupletEvent> thePair : fTupletBeginsMultiMap) {
+  for (std::pair <int, S_mxsrTupletEvent> thePair : fTupletBeginsVector) {
     S_mxsrTupletEvent
       tupletEvent = thePair.second;
 
@@ -1946,9 +1918,9 @@ void mxsrEventsCollection::printTupletEvents (std::ostream& os) const
   os << std::endl << "--------" << std::endl << std::endl;
 
   os <<
-    "fTupletEndsMultiMap: " <<
+    "fTupletEndsVector: " <<
     mfSingularOrPlural (
-      fTupletEndsMultiMap.size (),
+      fTupletEndsVector.size (),
       "element",
       "elements") <<
     ", in note sequential number order" <<
@@ -1956,7 +1928,7 @@ void mxsrEventsCollection::printTupletEvents (std::ostream& os) const
 
   ++gIndenter;
 
-  for (std::pair <mxsrNoteSequentialNumber, S_mxsrTupletEvent> thePair : fTupletEndsMultiMap) {
+  for (std::pair <int, S_mxsrTupletEvent> thePair : fTupletEndsVector) {
     S_mxsrTupletEvent
       tupletEvent = thePair.second;
 
@@ -2122,16 +2094,16 @@ void mxsrEventsCollection::print (std::ostream& os) const
 
   os << std::left <<
     std::setw (fieldWidth) <<
-    "fStaffChangeTakeOffsMap" << ": " <<
+    "fStaffChangeTakeOffsVector" << ": " <<
     mfSingularOrPlural (
-      fStaffChangeTakeOffsMap.size (),
+      fStaffChangeTakeOffsVector.size (),
       "element",
       "elements") <<
     std::endl <<
     std::setw (fieldWidth) <<
-    "fStaffChangeLandingsMap" << ": " <<
+    "fStaffChangeLandingsVector" << ": " <<
     mfSingularOrPlural (
-      fStaffChangeLandingsMap.size (),
+      fStaffChangeLandingsVector.size (),
       "element",
       "elements") <<
     std::endl;
@@ -2140,16 +2112,16 @@ void mxsrEventsCollection::print (std::ostream& os) const
 
   os << std::left <<
     std::setw (fieldWidth) <<
-    "fGraceBeginsMap" << ": " <<
+    "fGraceBeginsVector" << ": " <<
     mfSingularOrPlural (
-      fGraceBeginsMap.size (),
+      fGraceBeginsVector.size (),
       "element",
       "elements") <<
     std::endl <<
     std::setw (fieldWidth) <<
-    "fGraceEndsMap" << ": " <<
+    "fGraceEndsVector" << ": " <<
     mfSingularOrPlural (
-      fGraceEndsMap.size (),
+      fGraceEndsVector.size (),
       "element",
       "elements") <<
     std::endl;
@@ -2158,16 +2130,16 @@ void mxsrEventsCollection::print (std::ostream& os) const
 
   os << std::left <<
     std::setw (fieldWidth) <<
-    "fCueBeginsMap" << ": " <<
+    "fCueBeginsVector" << ": " <<
     mfSingularOrPlural (
-      fCueBeginsMap.size (),
+      fCueBeginsVector.size (),
       "element",
       "elements") <<
     std::endl <<
     std::setw (fieldWidth) <<
-    "fCueEndsMap" << ": " <<
+    "fCueEndsVector" << ": " <<
     mfSingularOrPlural (
-      fCueEndsMap.size (),
+      fCueEndsVector.size (),
       "element",
       "elements") <<
     std::endl;
@@ -2176,16 +2148,16 @@ void mxsrEventsCollection::print (std::ostream& os) const
 
   os << std::left <<
     std::setw (fieldWidth) <<
-    "fChordBeginsMap" << ": " <<
+    "fChordBeginsVector" << ": " <<
     mfSingularOrPlural (
-      fChordBeginsMap.size (),
+      fChordBeginsVector.size (),
       "element",
       "elements") <<
     std::endl <<
     std::setw (fieldWidth) <<
-    "fChordEndsMap" << ": " <<
+    "fChordEndsVector" << ": " <<
     mfSingularOrPlural (
-      fChordEndsMap.size (),
+      fChordEndsVector.size (),
       "element",
       "elements") <<
     std::endl;
@@ -2194,16 +2166,16 @@ void mxsrEventsCollection::print (std::ostream& os) const
 
   os << std::left <<
     std::setw (fieldWidth) <<
-    "fTupletBeginsMultiMap" << ": " <<
+    "fTupletBeginsVector" << ": " <<
     mfSingularOrPlural (
-      fTupletBeginsMultiMap.size (),
+      fTupletBeginsVector.size (),
       "element",
       "elements") <<
     std::endl <<
     std::setw (fieldWidth) <<
-    "fTupletEndsMultiMap" << ": " <<
+    "fTupletEndsVector" << ": " <<
     mfSingularOrPlural (
-      fTupletEndsMultiMap.size (),
+      fTupletEndsVector.size (),
       "element",
       "elements") <<
     std::endl;
@@ -2238,7 +2210,7 @@ void mxsrEventsCollection::print (std::ostream& os) const
 
   // staff change events
 #ifdef MF_TRACE_IS_ENABLED
-  if (! (fStaffChangeTakeOffsMap.empty () && fStaffChangeLandingsMap.empty ())) {
+  if (! (fStaffChangeTakeOffsVector.empty () && fStaffChangeLandingsVector.empty ())) {
     os << "--------" << std::endl << std::endl;
     printStaffChangeEvents (os);
   }
@@ -2246,7 +2218,7 @@ void mxsrEventsCollection::print (std::ostream& os) const
 
   // grace events
 #ifdef MF_TRACE_IS_ENABLED
-  if (! (fGraceBeginsMap.empty () && fGraceEndsMap.empty ())) {
+  if (! (fGraceBeginsVector.empty () && fGraceEndsVector.empty ())) {
     os << "--------" << std::endl << std::endl;
     printGraceEvents (os);
   }
@@ -2254,7 +2226,7 @@ void mxsrEventsCollection::print (std::ostream& os) const
 
   // cue events
 #ifdef MF_TRACE_IS_ENABLED
-  if (! (fCueBeginsMap.empty () && fCueEndsMap.empty ())) {
+  if (! (fCueBeginsVector.empty () && fCueEndsVector.empty ())) {
     os << "--------" << std::endl << std::endl;
     printCueEvents (os);
   }
@@ -2262,7 +2234,7 @@ void mxsrEventsCollection::print (std::ostream& os) const
 
   // chord events
 #ifdef MF_TRACE_IS_ENABLED
-  if (! (fChordBeginsMap.empty () && fChordEndsMap.empty ())) {
+  if (! (fChordBeginsVector.empty () && fChordEndsVector.empty ())) {
     os << "--------" << std::endl << std::endl;
     printChordEvents (os);
   }
@@ -2270,7 +2242,7 @@ void mxsrEventsCollection::print (std::ostream& os) const
 
   // tuplet events
 #ifdef MF_TRACE_IS_ENABLED
-  if (! (fTupletBeginsMultiMap.empty () && fTupletEndsMultiMap.empty ())) {
+  if (! (fTupletBeginsVector.empty () && fTupletEndsVector.empty ())) {
     os << "--------" << std::endl << std::endl;
     printTupletEvents (os);
   }
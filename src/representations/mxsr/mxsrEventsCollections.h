@@ -12,8 +12,10 @@
 #ifndef ___mxsrEventsCollections___
 #define ___mxsrEventsCollections___
 
+#include <algorithm>
 #include <list>
 #include <map>
+#include <vector>
 
 #include "exports.h"
 #include "smartpointer.h"
@@ -35,6 +37,125 @@ using namespace MusicXML2;
 namespace MusicFormats
 {
 
+//------------------------------------------------------------------------
+/*
+  The events attached to notes, sorted by note sequential number.
+
+  Notes sequential numbers are assigned in document order,
+  so events are nearly always appended at the end:
+  this vector is cheaper to fill and to search than a map,
+  and its contents are contiguous in memory.
+  The events of a given note are kept in insertion order.
+*/
+template <typename T>
+class mxsrNoteEventsVector
+{
+  public:
+
+    using mxsrNoteEventPair = std::pair <int, T>;
+
+    size_t                size () const
+                              { return fNoteEventPairsVector.size (); }
+
+    bool                  empty () const
+                              { return fNoteEventPairsVector.empty (); }
+
+    typename std::vector <mxsrNoteEventPair>::const_iterator
+                          begin () const
+                              { return fNoteEventPairsVector.begin (); }
+
+    typename std::vector <mxsrNoteEventPair>::const_iterator
+                          end () const
+                              { return fNoteEventPairsVector.end (); }
+
+    // adds an event to those of the note, like std::multimap::insert()
+    void                  insertMulti (
+                            int      noteSequentialNumber,
+                            const T& event)
+                              {
+                                if (
+                                  fNoteEventPairsVector.empty ()
+                                    ||
+                                  fNoteEventPairsVector.back ().first <= noteSequentialNumber
+                                ) {
+                                  // the usual case
+                                  fNoteEventPairsVector.push_back (
+                                    mxsrNoteEventPair (noteSequentialNumber, event));
+                                }
+                                else {
+                                  fNoteEventPairsVector.insert (
+                                    upperBound (noteSequentialNumber),
+                                    mxsrNoteEventPair (noteSequentialNumber, event));
+                                }
+                              }
+
+    // adds an event unless the note already has one, like std::map::insert()
+    void                  insert (
+                            int      noteSequentialNumber,
+                            const T& event)
+                              {
+                                if (! find (noteSequentialNumber)) {
+                                  insertMulti (noteSequentialNumber, event);
+                                }
+                              }
+
+    // the first event of the note, nullptr if there is none
+    T                     find (int noteSequentialNumber) const
+                              {
+                                auto it = lowerBound (noteSequentialNumber);
+
+                                return
+                                  it != fNoteEventPairsVector.end ()
+                                    &&
+                                  it->first == noteSequentialNumber
+                                    ? it->second
+                                    : T ();
+                              }
+
+    // appends the events of the note to eventsList
+    void                  fetchAll (
+                            int            noteSequentialNumber,
+                            std::list <T>& eventsList) const
+                              {
+                                for (
+                                  auto it = lowerBound (noteSequentialNumber);
+                                  it != fNoteEventPairsVector.end () && it->first == noteSequentialNumber;
+                                  ++it
+                                ) {
+                                  eventsList.push_back (it->second);
+                                } // for
+                              }
+
+  private:
+
+    typename std::vector <mxsrNoteEventPair>::const_iterator
+                          lowerBound (int noteSequentialNumber) const
+                              {
+                                return
+                                  std::lower_bound (
+                                    fNoteEventPairsVector.begin (),
+                                    fNoteEventPairsVector.end (),
+                                    noteSequentialNumber,
+                                    [] (const mxsrNoteEventPair& pair, int number)
+                                      { return pair.first < number; });
+                              }
+
+    typename std::vector <mxsrNoteEventPair>::const_iterator
+                          upperBound (int noteSequentialNumber) const
+                              {
+                                return
+                                  std::upper_bound (
+                                    fNoteEventPairsVector.begin (),
+                                    fNoteEventPairsVector.end (),
+                                    noteSequentialNumber,
+                                    [] (int number, const mxsrNoteEventPair& pair)
+                                      { return number < pair.first; });
+                              }
+
+    std::vector <mxsrNoteEventPair>
+                          fNoteEventPairsVector;
+};
+
 //------------------------------------------------------------------------
 class EXP mxsrEventsCollection : public smartable
 {
@@ -72,53 +193,53 @@ class EXP mxsrEventsCollection : public smartable
                               { return fThereIsAnImplicitInitialForwardRepeat; }
 
     // staff change events
-    const std::map <mxsrNoteSequentialNumber, S_mxsrStaffChangeEvent>&
-                          getStaffChangeTakeOffsMap () const
-                              { return fStaffChangeTakeOffsMap; }
+    const mxsrNoteEventsVector <S_mxsrStaffChangeEvent>&
+                          getStaffChangeTakeOffsVector () const
+                              { return fStaffChangeTakeOffsVector; }
 
-    const std::map <mxsrNoteSequentialNumber, S_mxsrStaffChangeEvent>&
-                          getStaffChangeLandingsMap () const
-                              { return fStaffChangeLandingsMap; }
+    const mxsrNoteEventsVector <S_mxsrStaffChangeEvent>&
+                          getStaffChangeLandingsVector () const
+                              { return fStaffChangeLandingsVector; }
 
     const std::list <S_mxsrStaffChangeEvent>&
                           getStaffChangeEventsList () const
                               { return fStaffChangeEventsList; }
 
     // grace events
-    const std::map <mxsrNoteSequentialNumber, S_mxsrGraceEvent>&
-                          getGraceBeginsMap () const
-                              { return fGraceBeginsMap; }
+    const mxsrNoteEventsVector <S_mxsrGraceEvent>&
+                          getGraceBeginsVector () const
+                              { return fGraceBeginsVector; }
 
-    const std::map <mxsrNoteSequentialNumber, S_mxsrGraceEvent>&
-                          getGraceEndsMap () const
-                              { return fGraceEndsMap; }
+    const mxsrNoteEventsVector <S_mxsrGraceEvent>&
+                          getGraceEndsVector () const
+                              { return fGraceEndsVector; }
 
     // cue events
-    const std::map <mxsrNoteSequentialNumber, S_mxsrCueEvent>&
-                          getCueBeginsMap () const
-                              { return fCueBeginsMap; }
+    const mxsrNoteEventsVector <S_mxsrCueEvent>&
+                          getCueBeginsVector () const
+                              { return fCueBeginsVector; }
 
-    const std::map <mxsrNoteSequentialNumber, S_mxsrCueEvent>&
-                          getCueEndsMap () const
-                              { return fCueEndsMap; }
+    const mxsrNoteEventsVector <S_mxsrCueEvent>&
+                          getCueEndsVector () const
+                              { return fCueEndsVector; }
 
     // chord events
-    const std::map <mxsrNoteSequentialNumber, S_mxsrChordEvent>&
-                          getChordBeginsMap () const
-                              { return fChordBeginsMap; }
+    const mxsrNoteEventsVector <S_mxsrChordEvent>&
+                          getChordBeginsVector () const
+                              { return fChordBeginsVector; }
 
-    const std::map <mxsrNoteSequentialNumber, S_mxsrChordEvent>&
-                          getChordEndsMap () const
-                              { return fChordEndsMap; }
+    const mxsrNoteEventsVector <S_mxsrChordEvent>&
+                          getChordEndsVector () const
+                              { return fChordEndsVector; }
 
     // tuplet events
-    const std::multimap <mxsrNoteSequentialNumber, S_mxsrTupletEvent>&
-                          getTupletBeginsMultiMap () const
-                              { return fTupletBeginsMultiMap; }
+    const mxsrNoteEventsVector <S_mxsrTupletEvent>&
+                          getTupletBeginsVector () const
+                              { return fTupletBeginsVector; }
 
-    const std::multimap <mxsrNoteSequentialNumber, S_mxsrTupletEvent>&
-                          getTupletEndsMultiMap () const
-                              { return fTupletEndsMultiMap; }
+    const mxsrNoteEventsVector <S_mxsrTupletEvent>&
+                          getTupletEndsVector () const
+                              { return fTupletEndsVector; }
 
     // all events
     const std::list <S_mxsrEvent>&
@@ -360,6 +481,26 @@ class EXP mxsrEventsCollection : public smartable
     // private services
     // ------------------------------------------------------
 
+    void                  registerNoteEventKind (
+                            const mxsrNoteSequentialNumber& noteSequentialNumber,
+                            unsigned int                    noteEventKindBit);
+
+    Bool                  noteMayHaveEventKind (
+                            int          noteSequentialNumber,
+                            unsigned int noteEventKindBit) const
+                              {
+                                // the events of notes without a sequential number
+                                // are not indexed, they have to be searched
+                                return
+                                  noteSequentialNumber < 0
+                                    ||
+                                  (
+                                    noteSequentialNumber < (int) fNoteEventKindsVector.size ()
+                                      &&
+                                    (fNoteEventKindsVector [noteSequentialNumber] & noteEventKindBit)
+                                  );
+                              }
+
   public:
 
     // print
@@ -431,14 +572,34 @@ class EXP mxsrEventsCollection : public smartable
                           fMeasureRepeatBeginsMap,
                           fMeasureRepeatEndsMap;
 
+    // the kinds of events attached to each note, indexed by note sequential number:
+    // most notes have none, in which case the events vectors are not searched
+    // ------------------------------------------------------
+
+    enum {
+      kStaffChangeTakeOffBit = 1 << 0,
+      kStaffChangeLandingBit = 1 << 1,
+      kGraceBeginBit         = 1 << 2,
+      kGraceEndBit           = 1 << 3,
+      kCueBeginBit           = 1 << 4,
+      kCueEndBit             = 1 << 5,
+      kChordBeginBit         = 1 << 6,
+      kChordEndBit           = 1 << 7,
+      kTupletBeginBit        = 1 << 8,
+      kTupletEndBit          = 1 << 9
+    };
+
+    std::vector <unsigned short>
+                          fNoteEventKindsVector;
+
     // staff change events
     // ------------------------------------------------------
 
     // there can be two staff changes per note,
-    // hence these two maps, indexed by note sequential number
-    std::map <mxsrNoteSequentialNumber, S_mxsrStaffChangeEvent>
-                          fStaffChangeTakeOffsMap,
-                          fStaffChangeLandingsMap;
+    // hence these two vectors, indexed by note sequential number
+    mxsrNoteEventsVector <S_mxsrStaffChangeEvent>
+                          fStaffChangeTakeOffsVector,
+                          fStaffChangeLandingsVector;
 
     std::list <S_mxsrStaffChangeEvent>
                           fStaffChangeEventsList;
@@ -447,37 +608,37 @@ class EXP mxsrEventsCollection : public smartable
     // ------------------------------------------------------
 
     // there can be only one grace note begin and one chord end per note,
-    // hence these two maps, indexed by note sequential number
-    std::map <mxsrNoteSequentialNumber, S_mxsrGraceEvent>
-                          fGraceBeginsMap,
-                          fGraceEndsMap;
+    // hence these two vectors, indexed by note sequential number
+    mxsrNoteEventsVector <S_mxsrGraceEvent>
+                          fGraceBeginsVector,
+                          fGraceEndsVector;
 
     // cue notes events
     // ------------------------------------------------------
 
     // there can be only one cue note begin and one chord end per note,
-    // hence these two maps, indexed by note sequential number
-    std::map <mxsrNoteSequentialNumber, S_mxsrCueEvent>
-                          fCueBeginsMap,
-                          fCueEndsMap;
+    // hence these two vectors, indexed by note sequential number
+    mxsrNoteEventsVector <S_mxsrCueEvent>
+                          fCueBeginsVector,
+                          fCueEndsVector;
 
     // chord events
     // ------------------------------------------------------
 
     // there can be only one chord begin and one chord end per note,
-    // hence these two maps, indexed by note sequential number
-    std::map <mxsrNoteSequentialNumber, S_mxsrChordEvent>
-                          fChordBeginsMap,
-                          fChordEndsMap;
+    // hence these two vectors, indexed by note sequential number
+    mxsrNoteEventsVector <S_mxsrChordEvent>
+                          fChordBeginsVector,
+                          fChordEndsVector;
 
     // tuplet events
     // ------------------------------------------------------
 
     // there can be several tuplet start and/or stop events per note,
-    // hence these two multimaps, indexed by note sequential number
-    std::multimap <mxsrNoteSequentialNumber, S_mxsrTupletEvent>
-                          fTupletBeginsMultiMap,
-                          fTupletEndsMultiMap;
+    // hence these two vectors, indexed by note sequential number
+    mxsrNoteEventsVector <S_mxsrTupletEvent>
+                          fTupletBeginsVector,
+                          fTupletEndsVector;
 
     // we need to fetch a tuplet event by its tuplet number,
     // hence the two maps, indexed by tuplet number
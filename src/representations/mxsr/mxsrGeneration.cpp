@@ -12,7 +12,8 @@
 #include <sstream>
 
 #include "mxsrGeneration.h"
-#include "xmlvisitor.h"
+#include "tree_browser.h"
+#include "xmlwriter.h"
 
 #include "mfPreprocessorSettings.h"
 
@@ -46,9 +47,10 @@ std::string mxmlelementAsString (Sxmlelement elem)
 
 void printMxsr (const Sxmlelement theMxsr, std::ostream& os)
 {
-  xmlvisitor v (os);
-  tree_browser<xmlelement> browser (&v);
+  xmlwriter w (os);
+  tree_browser<xmlelement> browser (&w);
   browser.browse (*theMxsr);
+  w.flush ();
 }
 
 //------------------------------------------------------------------------
@@ -0,0 +1,30 @@
+/*
+  MusicFormats Library
+  Copyright (C) Jacques Menu 2016-2025
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, you can obtain one at http://mozilla.org/MPL/2.0/.
+
+  https://github.com/jacques-menu/musicformats
+*/
+
+#ifndef __xml2allInterface___
+#define __xml2allInterface___
+
+#include <ostream>
+
+#include "exports.h"
+
+
+namespace MusicFormats
+{
+
+//_______________________________________________________________________________
+EXP int xml2all (
+  int   argc,
+  char* argv[]);
+
+}
+
+#endif // __xml2allInterface___
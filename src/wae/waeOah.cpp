@@ -163,7 +163,7 @@ void waeOahGroup::acceptIn (basevisitor* v)
 
   if (visitor<S_waeOahGroup>*
     p =
-      dynamic_cast<visitor<S_waeOahGroup>*> (v)) {
+      visitor<S_waeOahGroup>::cast (v)) {
         S_waeOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED
@@ -199,7 +199,7 @@ void waeOahGroup::acceptOut (basevisitor* v)
 
   if (visitor<S_waeOahGroup>*
     p =
-      dynamic_cast<visitor<S_waeOahGroup>*> (v)) {
+      visitor<S_waeOahGroup>::cast (v)) {
         S_waeOahGroup elem = this;
 
 #ifdef MF_TRACE_IS_ENABLED